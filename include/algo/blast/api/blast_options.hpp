@@ -372,6 +372,11 @@ public:
     double GetLowScorePerc() const;
     void SetLowScorePerc(double p = 0.0);
 
+    /// Approximate number of bytes the HSPs saved during the preliminary
+    /// search may occupy before being spilled to disk (0 means no limit).
+    Int8 GetPrelimMemoryLimit() const;
+    void SetPrelimMemoryLimit(Int8 limit);
+
     // Return only paired reads, for mapping
     bool GetPaired() const;
     void SetPaired(bool p);
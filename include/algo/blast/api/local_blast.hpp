@@ -112,7 +112,38 @@ public:
     /// Get the diagnostics structure (deep copy, needs to be deleted by caller)
     BlastDiagnostics* GetDiagnostics();
 
+    /// Query batches searched together in throughput mode
+    typedef vector< CRef<IQueryFactory> > TQueryFactories;
+
+    /// Searches several query batches against the same database in
+    /// throughput mode: the preliminary stage scans the database once for
+    /// all batches, running each subject sequence against the lookup table
+    /// of every batch, and the traceback stages of the batches run
+    /// concurrently. The results are the same as those of searching each
+    /// batch with its own CLocalBlast object. Batches which cannot share
+    /// the scan (e.g. split queries, RPS-BLAST, indexed megablast) are
+    /// searched one at a time.
+    /// @param query_batches query batches to search [in]
+    /// @param opts_handle BLAST options handle [in]
+    /// @param db subject adapter [in]
+    /// @param num_threads number of threads to use [in]
+    /// @return one result set per query batch, in the order of query_batches
+    static vector< CRef<CSearchResultSet> >
+    RunThroughputMode(const TQueryFactories& query_batches,
+                      CRef<CBlastOptionsHandle> opts_handle,
+                      CRef<CLocalDbAdapter> db,
+                      size_t num_threads = 1);
+
 private:
+    /// Constructor used by RunThroughputMode, the options are not shared
+    /// with other searches
+    CLocalBlast(CRef<IQueryFactory> query_factory,
+                CRef<CBlastOptions> options,
+                CRef<CLocalDbAdapter> db);
+
+    /// Runs the traceback stage once the preliminary stage is done
+    CRef<CSearchResultSet> x_RunTraceback();
+
     /// Query factory from which to obtain the query sequence data
     CRef<IQueryFactory> m_QueryFactory;
     
@@ -141,6 +172,7 @@ private:
 
     friend class ::CBlastFilterTest;
     friend class CBl2Seq;
+    friend class CLocalBlastTracebackThread;
 };
 
 inline TSearchMessages
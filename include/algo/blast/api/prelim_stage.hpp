@@ -133,6 +133,22 @@ public:
     const TSeqLocInfoVector& GetQueryMasks(void) const
     {return m_MasksForAllQueries;}
 
+    /// Returns true if this search can take part in a shared scan of the
+    /// database (see RunSharedScan): the query is not split into chunks and
+    /// the search does not use RPS-BLAST, PHI-BLAST or a megablast index
+    bool CanShareScan() const;
+
+    /// Runs the preliminary stage of several searches with a single scan of
+    /// the database shared by all of them. The searches must use the same
+    /// BlastSeqSrc and program, each with its own copy of the options, and
+    /// CanShareScan must be true for all of them.
+    /// @param searches searches to run [in]
+    /// @param num_threads number of threads to use [in]
+    /// @return the internal data of each search, in the order of searches
+    static vector< CRef<SInternalData> >
+    RunSharedScan(const vector< CRef<CBlastPrelimSearch> >& searches,
+                  size_t num_threads);
+
 private:
     /// Prohibit copy constructor
     CBlastPrelimSearch(const CBlastPrelimSearch& rhs);
@@ -1163,9 +1163,15 @@ class NCBI_BLASTINPUT_EXPORT CMTArgs : public IBlastCmdLineArgs
 {
 public:
     /// Default Constructor
-    CMTArgs(bool isRpsBlast = false) :
+    /// @param isRpsBlast true for RPS-BLAST programs
+    /// @param supportsThroughputMode true if the program can search several
+    /// query batches with one database scan (see
+    /// CLocalBlast::RunThroughputMode)
+    CMTArgs(bool isRpsBlast = false, bool supportsThroughputMode = false) :
     	m_NumThreads(isRpsBlast? 0:CThreadable::kMinNumThreads),
-    	m_IsRpsBlast(isRpsBlast) {
+    	m_IsRpsBlast(isRpsBlast),
+    	m_SupportsThroughputMode(supportsThroughputMode),
+    	m_ThroughputBatches(1) {
 #ifdef NCBI_NO_THREADS
         // No threads can be set in NON-MT mode
         m_NumThreads = CThreadable::kMinNumThreads;
@@ -1179,9 +1185,13 @@ public:
 
     /// Get the number of threads to spawn
     size_t GetNumThreads() const { return m_NumThreads; }
+    /// Get the number of query batches searched with one database scan
+    size_t GetThroughputBatches() const { return m_ThroughputBatches; }
 private:
     size_t m_NumThreads;        ///< Number of threads to spawn
     bool m_IsRpsBlast;
+    bool m_SupportsThroughputMode; ///< Add the throughput mode argument?
+    size_t m_ThroughputBatches; ///< Query batches sharing a database scan
     static const int kDefaultRpsNumThreads = 1;
 
     void x_SetArgumentDescriptionsRpsBlast(CArgDescriptions& arg_desc);
@@ -1326,6 +1336,11 @@ public:
         return m_MTArgs->GetNumThreads();
     }
 
+    /// Get the number of query batches searched with one database scan
+    size_t GetThroughputBatches() const {
+        return m_MTArgs->GetThroughputBatches();
+    }
+
     /// Get the input stream
     CNcbiIstream& GetInputStream() const {
         return m_StdCmdLineArgs->GetInputStream();
@@ -97,6 +97,9 @@ NCBI_BLASTINPUT_EXPORT extern const string kArgRemote;
 /// Argument to determine the number of threads to use when running BLAST
 NCBI_BLASTINPUT_EXPORT extern const string kArgNumThreads;
 
+/// Argument to set the number of query batches that share one database scan
+NCBI_BLASTINPUT_EXPORT extern const string kArgThroughputBatches;
+
 /// Argument for scoring matrix
 NCBI_BLASTINPUT_EXPORT extern const string kArgMatrixName;
 
@@ -327,6 +330,9 @@ NCBI_BLASTINPUT_EXPORT extern const string kArgDMBTemplateLength;
 
 /// Argument to specify the maximum number of HPSs to save per subject for each query
 NCBI_BLASTINPUT_EXPORT extern const string kArgMaxHSPsPerSubject;
+/// Argument to specify the memory (in megabytes) the HSPs saved during the
+/// preliminary search may occupy before they are spilled to disk
+NCBI_BLASTINPUT_EXPORT extern const string kArgPrelimMemoryLimit;
 
 /// Argument to turn on sum statistics
 NCBI_BLASTINPUT_EXPORT extern const string kArgSumStats;
@@ -209,6 +209,47 @@ Blast_RunPreliminarySearchWithInterrupt(EBlastProgramType program,
    BlastHSPStream* hsp_stream, BlastDiagnostics* diagnostics,
    TInterruptFnPtr interrupt_search, SBlastProgress* progress_info);
 
+/** Input for one query batch of a preliminary search that shares the scan
+ * of the subject sequences with other batches. All structures are owned by
+ * the caller and must have been set up as for
+ * Blast_RunPreliminarySearchWithInterrupt.
+ */
+typedef struct SBlastPrelimBatch {
+    BLAST_SequenceBlk* query;           /**< Query sequence(s) of the batch */
+    BlastQueryInfo* query_info;         /**< Query information */
+    BlastScoreBlk* sbp;                 /**< Scoring and statistical
+                                          parameters */
+    LookupTableWrap* lookup_wrap;       /**< Lookup table of the batch */
+    const BlastScoringOptions* score_options; /**< Hit scoring options */
+    const BlastInitialWordOptions* word_options; /**< Initial word options */
+    const BlastExtensionOptions* ext_options; /**< Gapped extension options */
+    const BlastHitSavingOptions* hit_options; /**< Hit saving options */
+    const BlastEffectiveLengthsOptions* eff_len_options; /**< Effective
+                                                   lengths options */
+    BlastHSPStream* hsp_stream;         /**< Results of the batch [out] */
+    BlastDiagnostics* diagnostics;      /**< Statistics of the batch [out] */
+} SBlastPrelimBatch;
+
+/** Performs the preliminary stage of the BLAST search for several query
+ * batches with a single pass over the subject sequences: each subject is
+ * retrieved once and then searched with the lookup table of every batch, so
+ * the HSPs written to each batch's stream are the same as those of a
+ * separate Blast_RunPreliminarySearchWithInterrupt call for that batch.
+ * RPS-BLAST and indexed megablast searches are not supported.
+ * @param program Type of BLAST program [in]
+ * @param batches Array of query batches [in] [out]
+ * @param num_batches Number of elements in batches [in]
+ * @param seq_src Structure containing BLAST database [in]
+ * @param db_options Options for handling BLAST database [in]
+ * @param interrupt_search User defined function to interrupt search [in]
+ * @param progress_info User supplied data structure to aid interrupt [in]
+ */
+Int2
+Blast_RunPreliminarySearchMultiBatch(EBlastProgramType program,
+   SBlastPrelimBatch* batches, Int4 num_batches,
+   const BlastSeqSrc* seq_src, const BlastDatabaseOptions* db_options,
+   TInterruptFnPtr interrupt_search, SBlastProgress* progress_info);
+
 /** Gapped extension function pointer type */
 typedef Int2 (*BlastGetGappedScoreType) 
      (EBlastProgramType, /**< @todo comment function pointer types */
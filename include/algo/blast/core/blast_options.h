@@ -420,6 +420,12 @@ typedef struct BlastHitSavingOptions {
    /**< Splice HSPs for each query (for mapping RNA-Seq to a genome) */
    Boolean splice;
 
+   /** Approximate number of bytes the HSPs saved during the preliminary
+    * search may occupy before they are spilled to a temporary file (see
+    * hspfilter_bounded.h). Zero means no limit.
+    */
+   Int8 prelim_memory_limit;
+
 } BlastHitSavingOptions;
 
 /** Scoring options block 
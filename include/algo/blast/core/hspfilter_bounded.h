@@ -0,0 +1,114 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file hspfilter_bounded.h
+ * Implementation of a BlastHSPWriter that collects hits like the default
+ * collector, but keeps the memory used by the saved HSPs within a budget.
+ */
+
+#ifndef ALGO_BLAST_CORE__HSPFILTER_BOUNDED__H
+#define ALGO_BLAST_CORE__HSPFILTER_BOUNDED__H
+
+#include <algo/blast/core/ncbi_std.h>
+#include <algo/blast/core/blast_program.h>
+#include <algo/blast/core/blast_options.h>
+#include <algo/blast/core/blast_hspfilter.h>
+#include <algo/blast/core/blast_hits.h>
+#include <connect/ncbi_core.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/************************************************************************/
+/** The "bounded" writer
+
+   Saves HSP lists in the same per-query heaps as the default collector, so
+   the set and order of the hits it returns are identical to the collector's.
+   In addition:
+   1. HSP lists which cannot enter a query's hit list because it is already
+      full of better hits (by e-value) are discarded as soon as they arrive,
+      after being split by query and before being inserted into the hit
+      list.
+
+   2. The memory held by the saved HSPs is tracked. When it exceeds the
+      configured budget, all HSPs except the best one of each saved HSP list
+      are moved to a temporary file, together with their edit scripts. The
+      best HSP stays in memory, so the ranking of the HSP lists within the
+      hit list is not affected. HSP lists with PHI BLAST or mapping
+      information are kept in memory.
+
+   3. When the writer is finalized, the spilled HSPs of the HSP lists which
+      survived until the end of the search are read back in their original
+      order; those of HSP lists evicted in the meantime are dropped.
+  */
+
+/** Keeps prelim_hitlist_size, hsp_num_max and the memory budget together. */
+typedef struct BlastHSPBoundedParams {
+   EBlastProgramType program;/**< program type */
+   Int4 prelim_hitlist_size; /**< number of hits saved during preliminary
+                                  part of search. */
+   Int4 hsp_num_max;         /**< number of HSPs to save per db sequence.*/
+   Int8 memory_limit;        /**< approximate number of bytes the saved HSPs
+                                  may occupy before they are spilled to
+                                  disk */
+} BlastHSPBoundedParams;
+
+/** Sets up parameter set for use by the bounded collector.
+ * @param hit_options field hitlist_size, hsp_num_max and
+ *      prelim_memory_limit needed here. [in]
+ * @param compositionBasedStats from ext_options. [in]
+ * @param gapped_calculation from scoring_options. [in]
+ * @return the pointer to the allocated parameter
+ */
+NCBI_XBLAST_EXPORT
+BlastHSPBoundedParams*
+BlastHSPBoundedParamsNew(const BlastHitSavingOptions* hit_options,
+                         Int4 compositionBasedStats,
+                         Boolean gapped_calculation);
+
+/** Deallocates the BlastHSPBoundedParams structure passed in
+ * @param opts structure to deallocate [in]
+ * @return NULL
+ */
+NCBI_XBLAST_EXPORT
+BlastHSPBoundedParams*
+BlastHSPBoundedParamsFree(BlastHSPBoundedParams* opts);
+
+/** WriterInfo to create the bounded collector writer
+ * @param params The bounded collector parameters.
+ * @return pointer to WriterInfo
+ */
+NCBI_XBLAST_EXPORT
+BlastHSPWriterInfo* 
+BlastHSPBoundedInfoNew(BlastHSPBoundedParams* params);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !ALGO_BLAST_CORE__HSPFILTER_BOUNDED__H */
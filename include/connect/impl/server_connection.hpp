@@ -59,10 +59,12 @@ std::string g_ServerConnTypeToString(enum EServerConnType  conn_type);
 
 
 class CServer_ConnectionPool;
+class CServer_Reactor;
 
 class IServer_ConnectionBase
 {
 public:
+    IServer_ConnectionBase() : reactor(NULL) { }
     virtual ~IServer_ConnectionBase() { }
     virtual EIO_Event GetEventsToPollFor(const CTime** /*alarm_time*/) const
         { return eIO_Read; }
@@ -79,11 +81,15 @@ public:
 
 private:
     friend class CServer_ConnectionPool;
+    friend class CServer_Reactor;
+    friend class CAcceptRequest;
     friend class IServer_MessageHandler;
 
     CTime expiration;
     CFastMutex type_lock;
     volatile EServerConnType type;
+    /// Reactor thread which polls this connection (NULL for poll() loop)
+    CServer_Reactor* reactor;
 };
 
 class NCBI_XCONNECT_EXPORT CServer_Connection : public IServer_ConnectionBase,
@@ -119,7 +125,13 @@ class CServer_Listener : public IServer_ConnectionBase,
 {
 public:
     CServer_Listener(IServer_ConnectionFactory* factory, unsigned short port)
-        : m_Factory(factory), m_Port(port)
+        : m_Factory(factory), m_Port(port), m_ListenFlags(fSOCK_LogDefault)
+        { }
+    /// Create another listener on the same port, sharing the factory.
+    /// Used by reactor threads, each of which listens on its own socket.
+    CServer_Listener(const CServer_Listener& primary)
+        : m_Factory(primary.m_Factory.get(), eNoOwnership),
+          m_Port(primary.m_Port), m_ListenFlags(primary.m_ListenFlags)
         { }
     virtual CStdRequest* CreateRequest(EServIO_Event event,
                                        CServer_ConnectionPool& connPool,
@@ -129,7 +141,8 @@ public:
         while (st != eIO_Success) {
             // Set backlog to high enough value because Windows actually
             // uses it and we have no reason not to buffer incoming connections
-            if ((st = Listen(m_Port, 128)) == eIO_Success) return;
+            if ((st = Listen(m_Port, 128, m_ListenFlags)) == eIO_Success)
+                return;
             IServer_ConnectionFactory::EListenAction action =
                 m_Factory->OnFailure(&m_Port);
             if (action == IServer_ConnectionFactory::eLAFail)
@@ -140,10 +153,18 @@ public:
     }
     virtual void Passivate(void) { Close(); }
     unsigned short GetPort(void) const { return m_Port; }
+    /// Let other sockets listen on the same port (see fSOCK_ReusePort)
+    void SetReusePort(void) { m_ListenFlags |= fSOCK_ReusePort; }
+    /// Listen on the port that the primary listener is bound to
+    EIO_Status ListenAlongside(const CServer_Listener& primary) {
+        return Listen(primary.CListeningSocket::GetPort(eNH_HostByteOrder),
+                      128, m_ListenFlags);
+    }
 private:
     friend class CAcceptRequest;
-    auto_ptr<IServer_ConnectionFactory> m_Factory;
+    AutoPtr<IServer_ConnectionFactory> m_Factory;
     unsigned short m_Port;
+    TSOCK_Flags m_ListenFlags;
 } ;
 
 
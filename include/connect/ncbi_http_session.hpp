@@ -36,6 +36,7 @@
 
 #include <corelib/ncbi_cookies.hpp>
 #include <connect/ncbi_conn_stream.hpp>
+#include <memory>
 
 
 /** @addtogroup HttpSession
@@ -555,6 +556,31 @@ private:
                          void*         user_data,
                          unsigned int  failure_count);
 
+    // Requests to be sent through the session connection pool
+    // (see CHttpConnectionPool).
+    bool x_IsPooled(void) const;
+    // Get I/O timeout and number of attempts for the pooled request.
+    const STimeout* x_GetPooledLimits(STimeout& tmo, unsigned& max_try) const;
+    // Get the request body written to the content stream so far.
+    string x_GetPooledBody(void);
+    string x_ComposePooledRequest(EReqMethod    method,
+                                  const CUrl&   url,
+                                  const string& body);
+    // Send the request over pooled connections, following redirects.
+    void x_ExecutePooled(EReqMethod method, CUrl url, string body);
+    // Store a response header read from a pooled connection. Return true if
+    // the request has to be repeated for the new response location
+    // (redirect), method and body are adjusted for that.  Otherwise the
+    // caller sets the response body stream.
+    bool x_SetPooledResponse(const string& header,
+                             EReqMethod& method, string& body);
+    // Set the stream the pooled response body is read from.
+    void x_SetPooledBody(CConn_IOStream* stream);
+    // Store the pooled request failure.
+    void x_SetPooledFailure(const string& error);
+    // Whether it is safe to pipeline the request.
+    bool x_IsIdempotent(void) const;
+
     typedef CHttpResponse::CHttpStreamRef TStreamRef;
 
     CRef<CHttpSession>  m_Session;
@@ -570,6 +596,110 @@ private:
     CTimeout            m_Deadline;
     ESwitch             m_RetryProcessing;
     CRef<CAdjustUrlCallback_Base> m_AdjustUrl;
+    bool                m_Pooled;
+    unsigned            m_Redirects;
+};
+
+
+/// Pool of persistent HTTP/1.1 connections.
+///
+/// Sessions having a pool set (see CHttpSession::SetConnectionPool()) send
+/// requests to http and https URLs (not to named services and not through
+/// a proxy) over kept-alive connections, so that TCP and TLS handshakes are
+/// made only once per connection rather than per request.  One pool can be
+/// shared by any number of sessions and threads.  Idle connections are kept
+/// per host up to the configured limit and are closed when not used for the
+/// idle timeout.
+class NCBI_XCONNECT_EXPORT CHttpConnectionPool : public CObject
+{
+public:
+    CHttpConnectionPool(void);
+    virtual ~CHttpConnectionPool(void);
+
+    /// Maximum number of idle connections kept per host (default 8).
+    void SetMaxIdlePerHost(unsigned max_idle);
+    unsigned GetMaxIdlePerHost(void) const;
+
+    /// Maximum number of connections (in use and idle) per host.  When it
+    /// is reached, requests wait for a connection to be released.
+    /// Zero (default) means no limit.
+    void SetMaxPerHost(unsigned max_connections);
+    unsigned GetMaxPerHost(void) const;
+
+    /// Idle connections are closed after this time (default 30 seconds).
+    void SetIdleTimeout(const CTimeout& timeout);
+    CTimeout GetIdleTimeout(void) const;
+
+    /// Maximum number of idempotent (GET, HEAD) requests sent over one
+    /// connection before reading their responses by
+    /// CHttpSession::ExecuteAll().  1 (default) disables pipelining.
+    void SetMaxPipelineDepth(unsigned depth);
+    unsigned GetMaxPipelineDepth(void) const;
+
+    /// Pool statistics
+    struct SStats
+    {
+        Uint8  opened;        ///< Connections opened
+        Uint8  reused;        ///< Requests sent over reused connections
+        Uint8  closed;        ///< Connections closed (errors, limits, idle)
+        Uint8  expired;       ///< Of them closed by the idle timeout
+        Uint8  requests;      ///< Requests sent
+        Uint8  pipelined;     ///< Of them sent before the previous replies
+        Uint8  waits;         ///< Waits for a connection (per host limit)
+        size_t idle;          ///< Connections idle now
+        size_t in_use;        ///< Connections in use now
+        size_t hosts;         ///< Hosts having connections now
+    };
+    SStats GetStats(void) const;
+
+    /// Close all idle connections.
+    void Purge(void);
+
+private:
+    friend class CHttpRequest;
+    friend class CHttpSession;
+
+    struct SImpl;
+    struct SConnection;
+    struct SBodyReader;
+
+    // Get a connection to the URL host.  Returns NULL if "wait" is false
+    // and the per host limit is reached.
+    SConnection* x_Acquire(const CUrl& url, const STimeout* timeout,
+                           bool wait = true);
+    // Return the connection to the pool (or close it if not reusable).
+    void x_Release(SConnection* conn, bool reusable);
+
+    // Send a request, return false on failure.
+    static bool x_Send(SConnection* conn, const string& request);
+    // Read a response header, return false if the connection has failed
+    // or the header is malformed.  The body is then read by x_ReadBody().
+    static bool x_ReceiveHeader(SConnection* conn, bool head,
+                                string& header);
+    // Read a part of the response body.  Return eIO_Closed at the end of
+    // the body, other statuses than eIO_Success mean a failure.
+    static EIO_Status x_ReadBody(SConnection* conn,
+                                 void* buf, size_t size, size_t* n_read);
+    // Read the rest of the response body (to "body" unless it is NULL),
+    // return false if the connection has failed.
+    static bool x_ReceiveBody(SConnection* conn, string* body);
+    // Read a whole response, return false if the connection has failed.
+    static bool x_Receive(SConnection* conn, bool head,
+                          string& header, string& body);
+    // Whether the response body has been read and the server keeps the
+    // connection alive.
+    static bool x_IsReusable(const SConnection* conn);
+    // Make a stream reading the response body from the connection.  The
+    // connection is returned to the pool at the end of the body (or closed
+    // if the stream is destroyed before that).
+    CConn_IOStream* x_GetBodyStream(SConnection* conn);
+    // Whether any requests have been sent over the connection.
+    static bool x_WasUsed(const SConnection* conn);
+
+    unique_ptr<SImpl> m_Impl;
+
+    CHttpConnectionPool(const CHttpConnectionPool&);
+    CHttpConnectionPool& operator=(const CHttpConnectionPool&);
 };
 
 
@@ -634,6 +764,29 @@ public:
                       const CTimeout& timeout = CTimeout(CTimeout::eDefault),
                       THttpRetries    retries = null);
 
+    /// Responses to several requests, in the order of the requests.
+    typedef vector<CHttpResponse> TResponses;
+
+    /// Execute several requests of this session concurrently.
+    /// Without a connection pool, the requests are simply executed one by
+    /// one.  With a pool, requests to the same host are spread over up to
+    /// max-idle-per-host pooled connections (but not over max-per-host) and
+    /// idempotent ones are pipelined (see
+    /// CHttpConnectionPool::SetMaxPipelineDepth()), so that all of them
+    /// take about as long as the slowest one rather than the sum.
+    /// Requests that cannot go through the pool (named services, proxies,
+    /// retry processing on) and redirected ones are executed one by one
+    /// after the rest.  As after Execute(), the requests can be reused.
+    TResponses ExecuteAll(vector<CHttpRequest>& requests);
+
+    /// Set connection pool to keep connections alive between requests.
+    /// NULL (default) disables pooling - each request makes its own
+    /// connection.
+    void SetConnectionPool(CHttpConnectionPool* pool) { m_Pool.Reset(pool); }
+    /// Get current connection pool (NULL if none).
+    CHttpConnectionPool* GetConnectionPool(void) const
+        { return m_Pool.GetNCPointerOrNull(); }
+
     /// Get all stored cookies.
     const CHttpCookies& Cookies(void) const { return m_Cookies; }
     /// Get all stored cookies, non-const.
@@ -673,6 +826,7 @@ private:
     EProtocol    m_Protocol;
     THTTP_Flags  m_HttpFlags;
     CHttpCookies m_Cookies;
+    CRef<CHttpConnectionPool> m_Pool;
 };
 
 
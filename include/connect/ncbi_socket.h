@@ -414,7 +414,10 @@ typedef enum {
     fSOCK_KeepOnClose  = 0x80, /**< retain OS handle in SOCK_Close[Ex]()     */
     fSOCK_CloseOnClose = 0,    /**< close  OS handle in SOCK_Close[Ex]()     */
     fSOCK_ReadOnWrite       = 0x100,
-    fSOCK_InterruptOnSignal = 0x200
+    fSOCK_InterruptOnSignal = 0x200,
+    fSOCK_ReusePort         = 0x400 /**< LSOCK: allow several listening sockets
+                                       on the same port (SO_REUSEPORT), if
+                                       supported by OS; ignored otherwise    */
 } ESOCK_Flags;
 typedef unsigned int TSOCK_Flags;  /**< bitwise "OR" of ESOCK_Flags */
 
@@ -1871,6 +1874,153 @@ extern NCBI_XCONNECT_EXPORT TRIGGER  POLLABLE_ToTRIGGER(POLLABLE);
 
 
 
+/******************************************************************************
+ *  POLL SET (persistent set of POLLABLEs to wait on)
+ *
+ *  POLLABLE_Poll() and SOCK_Poll() take the whole array of handles on every
+ *  call, and so spend time proportional to the number of handles in each
+ *  wait.  A poll set keeps the handles registered between the waits (in an
+ *  epoll(7) set on Linux), so that the cost of a wait depends only on the
+ *  number of handles that actually got ready.  On other platforms the poll
+ *  set falls back to POLLABLE_Poll() over all registered handles.
+ *
+ *  Readiness is reported exactly like POLLABLE_Poll() does it (in particular,
+ *  data already buffered inside a SOCK makes it readable; and pending output
+ *  of a SOCK waited for reading gets flushed when possible).  Handles
+ *  reported ready are re-examined in the next wait, so there is no need to
+ *  drain them completely.  However, if I/O is done on a handle which has not
+ *  been reported ready (so some data may have got buffered in it), call
+ *  POLLSET_Modify() to let the poll set take a fresh look at it.
+ *
+ *  Every handle may also have a one-shot timer attached, which is reported
+ *  (with the "expired" flag set) when it goes off.
+ *
+ *  Connections (CONN) are waited on through their sockets:  add the SOCK
+ *  that CONN_GetSOCK() (CConn_IOStream::GetSOCK() in C++) returns for an
+ *  open connection.  That includes service connections (see
+ *  SERVICE_CreateConnector()) that have got a stateful server, as their I/O
+ *  then goes straight to a socket connector.  Data peeked at or pushed back
+ *  into the CONN itself are not in the SOCK, so read them out first.
+ *  HTTP connections (and so stateless services) cannot be waited on this
+ *  way:  the HTTP connector has no socket until the request is flushed,
+ *  may switch sockets (and servers) on redirects and retries, closes the
+ *  socket after each response, and keeps the decoded response in its own
+ *  buffer, so no handle stays registered that reflects the CONN readiness.
+ *  Use CONN_Wait() (or a thread per connection) for those.
+ *
+ *  NOTE:  A poll set is not MT-safe, and must not be used by more than one
+ *         thread at a time.  Handles must be removed from the set before
+ *         they get closed.
+ */
+
+
+/*fwdecl; opaque*/
+struct SPOLLSET_tag;
+typedef struct SPOLLSET_tag* POLLSET;
+
+typedef struct {
+    POLLABLE    poll;     /**< the handle that got ready                     */
+    EIO_Event   revent;   /**< as in SPOLLABLE_Poll (eIO_Open: timer only)   */
+    int/*bool*/ expired;  /**< whether the handle's timer has gone off       */
+    void*       data;     /**< user data given in POLLSET_Add/Modify()       */
+} SPOLLSET_Event;
+
+
+/** Create an empty poll set.
+ * @param pollset
+ *  [out] the new poll set, or 0 on error
+ */
+extern NCBI_XCONNECT_EXPORT EIO_Status POLLSET_Create
+(POLLSET* pollset
+ );
+
+
+/** Add a handle to the set.
+ * @param event
+ *  [in]  events to wait for (eIO_Open to keep the handle in the set but not
+ *        to wait on it, e.g. while it is being processed)
+ * @param data
+ *  [in]  arbitrary user data to return along with the handle's events
+ * @return
+ *  eIO_InvalidArg if the handle is invalid, or already is in the set
+ */
+extern NCBI_XCONNECT_EXPORT EIO_Status POLLSET_Add
+(POLLSET   pollset,
+ POLLABLE  poll,
+ EIO_Event event,
+ void*     data
+ );
+
+
+/** Change the events and user data of a handle in the set.
+ * @return
+ *  eIO_InvalidArg if the handle is not in the set
+ */
+extern NCBI_XCONNECT_EXPORT EIO_Status POLLSET_Modify
+(POLLSET   pollset,
+ POLLABLE  poll,
+ EIO_Event event,
+ void*     data
+ );
+
+
+/** Remove a handle (and its timer) from the set.
+ * @return
+ *  eIO_InvalidArg if the handle is not in the set
+ */
+extern NCBI_XCONNECT_EXPORT EIO_Status POLLSET_Remove
+(POLLSET  pollset,
+ POLLABLE poll
+ );
+
+
+/** Arm (or, with "timeout" == kInfiniteTimeout, disarm) the one-shot timer
+ * of a handle in the set, to go off after the given time.
+ */
+extern NCBI_XCONNECT_EXPORT EIO_Status POLLSET_SetTimer
+(POLLSET         pollset,
+ POLLABLE        poll,
+ const STimeout* timeout
+ );
+
+
+/** Wait for at least one handle in the set to become ready for its events,
+ * or for at least one timer to go off.
+ * @param timeout
+ *  [in]  how long to wait at most
+ * @param events
+ *  [out] array to store the ready handles into
+ * @param n
+ *  [in]  number of elements in "events";  handles which did not fit are
+ *        reported by the next call
+ * @param n_ready
+ *  [out] number of elements stored in "events"
+ * @return
+ *  eIO_Success if something got ready, eIO_Timeout if nothing did within
+ *  the timeout, or other error code
+ */
+extern NCBI_XCONNECT_EXPORT EIO_Status POLLSET_Wait
+(POLLSET         pollset,
+ const STimeout* timeout,
+ SPOLLSET_Event  events[],
+ size_t          n,
+ size_t*         n_ready
+ );
+
+
+/** Return the number of handles in the set */
+extern NCBI_XCONNECT_EXPORT size_t POLLSET_GetCount
+(POLLSET pollset
+ );
+
+
+/** Destroy the poll set (the handles in it are not affected) */
+extern NCBI_XCONNECT_EXPORT void POLLSET_Destroy
+(POLLSET pollset
+ );
+
+
+
 /******************************************************************************
  *  AUXILIARY NETWORK-SPECIFIC FUNCTIONS (added for the portability reasons)
  */
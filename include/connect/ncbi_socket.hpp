@@ -37,6 +37,7 @@
 
 #include <corelib/ncbistr.hpp>
 #include <connect/ncbi_socket_unix.h>
+#include <map>
 
 
 /** @addtogroup Sockets
@@ -775,6 +776,73 @@ public:
 };
 
 
+
+/////////////////////////////////////////////////////////////////////////////
+///
+///  CSocketPollSet::
+///
+/// Persistent set of CPollable objects to wait on:  unlike
+/// CSocketAPI::Poll(), the cost of each Wait() depends only on the number
+/// of objects that got ready, not on the size of the set (on Linux; other
+/// platforms fall back to polling the whole set).  Each object may carry
+/// user data and a one-shot timer.
+///
+/// @note  For documentation see POLLSET_***() functions in "ncbi_socket.h".
+///        In particular, the set is not MT-safe, and objects must be
+///        removed from it before they get closed or destroyed.
+///
+
+class NCBI_XCONNECT_EXPORT CSocketPollSet
+{
+public:
+    struct SEvent {
+        CPollable* m_Pollable;  ///< object that got ready
+        EIO_Event  m_REvent;    ///< event ready (eIO_Open if timer only)
+        bool       m_Expired;   ///< whether the object's timer went off
+        void*      m_Data;      ///< user data given in Add() or Modify()
+    };
+
+    CSocketPollSet(void);
+    ~CSocketPollSet();
+
+    /// eIO_Success if the set was created successfully
+    EIO_Status GetStatus(void) const;
+
+    EIO_Status Add   (CPollable& pollable, EIO_Event event, void* data = 0);
+    EIO_Status Modify(CPollable& pollable, EIO_Event event, void* data = 0);
+    EIO_Status Remove(CPollable& pollable);
+
+    /// Arm (or, with kInfiniteTimeout, disarm) the one-shot timer
+    EIO_Status SetTimer(CPollable& pollable, const STimeout* timeout);
+
+    /// Wait for objects to get ready (or their timers to go off), and
+    /// return at most "max_events" of them in "events"
+    EIO_Status Wait(vector<SEvent>& events,
+                    const STimeout* timeout,
+                    size_t          max_events = 256);
+
+    size_t  GetCount(void) const { return POLLSET_GetCount(m_PollSet); }
+
+    POLLSET GetPOLLSET(void) const { return m_PollSet; }
+
+private:
+    struct SEntry {
+        CPollable* m_Pollable;
+        POLLABLE   m_Handle;    ///< as registered (may change on close)
+        void*      m_Data;
+    };
+    typedef map<CPollable*, SEntry> TEntries;
+
+    POLLSET                m_PollSet;
+    TEntries               m_Entries;
+    vector<SPOLLSET_Event> m_Events;
+
+    // disable copy constructor and assignment
+    CSocketPollSet(const CSocketPollSet&);
+    CSocketPollSet& operator= (const CSocketPollSet&);
+};
+
+
 /* @} */
 
 
@@ -191,6 +191,7 @@ protected:
 
 private:
     void x_DoRun(void);
+    void x_DoRunReactors(void);
 
     friend class CNetCacheServer;
     CPoolOfThreads_ForServer* GetThreadPool(void) { return m_ThreadPool; }
@@ -446,6 +447,15 @@ struct NCBI_XCONNECT_EXPORT SServer_Parameters
     unsigned int    max_threads;     ///< Maximum simultaneous threads
     unsigned int    spawn_threshold; ///< Controls when to spawn more threads
 
+    /// Number of reactor threads which wait for socket events instead of
+    /// the single poll() loop of Run() (default: 0, i.e. use the poll()
+    /// loop).  Each reactor owns its connections, waits for them in a
+    /// CSocketPollSet (epoll on Linux), and listens on every port with a
+    /// socket of its own (SO_REUSEPORT where available), so large numbers
+    /// of mostly idle connections cost nothing per event.  Connection
+    /// handlers see no difference.
+    unsigned int    reactor_threads;
+
     /// Create structure with the default set of parameters
     SServer_Parameters();
 };
@@ -126,6 +126,104 @@ BEGIN_NCBI_SCOPE
  */
 
 struct SNetCacheAPIImpl;
+struct SNetCacheBatchImpl;
+
+/// Outcome of one operation of a batch.
+/// @see CNetCacheBatch, CNetICacheBatch
+struct SNetCacheBatchResult
+{
+    /// Type of the operation
+    enum EOperation {
+        eGet,       ///< Read the whole blob
+        eHasBlob,   ///< Check if the blob exists
+        ePut        ///< Write the whole blob
+    };
+
+    /// The number returned by the method that added the operation
+    size_t index = 0;
+
+    EOperation operation = eGet;
+
+    /// Blob key (for CNetICacheBatch, the key without version and
+    /// subkey).  For ePut operations of CNetCacheBatch, this is the key
+    /// of the (possibly newly created) blob.
+    string key;
+
+    /// Whether the operation has been completed.  A blob that is
+    /// not found does not make the operation fail, see "exists".
+    bool success = false;
+
+    /// For eGet and eHasBlob: whether the blob has been found
+    bool exists = false;
+
+    /// For eGet: the blob contents
+    string data;
+
+    /// Description of the error if the operation failed
+    string error;
+};
+
+/// Execution of many small blob operations without waiting for
+/// a reply to each of them.
+///
+/// Operations are queued with the Add*() methods and sent out by Next().
+/// Commands for the same server are sent over one connection one after
+/// another, without waiting for replies (pipelining), and several servers
+/// are talked to at a time.  Next() returns results in the order replies
+/// arrive, which is not necessarily the order operations were added in,
+/// so the results should be matched by SNetCacheBatchResult::index.
+/// Operations can be added while results are being consumed.
+///
+/// Operations that cannot be pipelined (e.g. for keys that require the
+/// server to be looked up in another service) and the ones that failed
+/// because of a connection problem are executed one by one with the
+/// regular methods of CNetCacheAPI, so mirrors and fallback servers
+/// are still taken into account.
+///
+/// @code
+/// CNetCacheBatch batch(nc_api.NewBatch());
+///
+/// for (const auto& key : keys)
+///     batch.AddGet(key);
+///
+/// SNetCacheBatchResult result;
+///
+/// while (batch.Next(result)) {
+///     if (!result.success)
+///         ERR_POST(keys[result.index] << ": " << result.error);
+///     else if (result.exists)
+///         Process(keys[result.index], result.data);
+/// }
+/// @endcode
+///
+/// @note The whole blob is kept in memory, so batches are
+///   meant for small blobs.
+///
+class NCBI_XCONNECT_EXPORT CNetCacheBatch
+{
+    NCBI_NET_COMPONENT(NetCacheBatch);
+
+    /// Read the whole blob
+    /// @return
+    ///    Index of the operation
+    size_t AddGet(const string& key);
+
+    /// Check if the blob exists
+    /// @return
+    ///    Index of the operation
+    size_t AddHasBlob(const string& key);
+
+    /// Write the whole blob.  If the key is empty, a new blob is created,
+    /// and its key is returned in SNetCacheBatchResult::key.
+    /// @return
+    ///    Index of the operation
+    size_t AddPut(const string& key, const string& data);
+
+    /// Wait for the next operation to complete.
+    /// @return
+    ///    False if there are no more operations in the batch.
+    bool Next(SNetCacheBatchResult& result);
+};
 
 /// Client API for NetCache server.
 ///
@@ -459,6 +557,16 @@ class NCBI_XCONNECT_EXPORT CNetCacheAPI
     void Remove(const string& blob_id,
             const CNamedParameterList* optional = NULL);
 
+    /// Create a batch for pipelined execution of many blob operations.
+    ///
+    /// @param optional
+    ///    An optional list of named blob creation parameters in the
+    ///    form of (param_name = param_value, ...) applied to all
+    ///    operations of the batch.
+    ///    @see NetCacheClientParams
+    /// @see CNetCacheBatch
+    CNetCacheBatch NewBatch(const CNamedParameterList* optional = NULL);
+
     /// Return a CNetServerMultilineCmdOutput object for reading
     /// meta information about the specified blob.
     ///
@@ -62,6 +62,38 @@ BEGIN_NCBI_SCOPE
  */
 
 struct SNetICacheClientImpl;
+struct SNetICacheBatchImpl;
+
+/// Pipelined execution of many ICache blob operations.
+///
+/// This is the ICache counterpart of CNetCacheBatch; see the latter
+/// for details.
+///
+class NCBI_NET_CACHE_EXPORT CNetICacheBatch
+{
+    NCBI_NET_COMPONENT(NetICacheBatch);
+
+    /// Read the whole blob
+    /// @return
+    ///    Index of the operation
+    size_t AddRead(const string& key, int version, const string& subkey);
+
+    /// Check if the blob exists
+    /// @return
+    ///    Index of the operation
+    size_t AddHasBlob(const string& key, const string& subkey);
+
+    /// Write the whole blob (always with server confirmation)
+    /// @return
+    ///    Index of the operation
+    size_t AddStore(const string& key, int version, const string& subkey,
+            const string& data, unsigned int time_to_live = 0);
+
+    /// Wait for the next operation to complete.
+    /// @return
+    ///    False if there are no more operations in the batch.
+    bool Next(SNetCacheBatchResult& result);
+};
 
 /// Client to NetCache server (implements ICache interface)
 ///
@@ -310,6 +342,11 @@ class NCBI_NET_CACHE_EXPORT CNetICacheClient : public ICache
     bool HasBlob(const string& key, const string& subkey,
             const CNamedParameterList* optional = NULL);
 
+    /// Create a batch for pipelined execution of many blob operations.
+    /// The optional parameters apply to all operations of the batch.
+    /// @see CNetICacheBatch
+    CNetICacheBatch NewBatch(const CNamedParameterList* optional = NULL);
+
     virtual void Purge(time_t           access_timeout,
                        EKeepVersions    keep_last_version = eDropAll);
 
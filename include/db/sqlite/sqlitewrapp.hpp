@@ -185,10 +185,15 @@ public:
                                   ///< recommended - transactions cannot be
                                   ///< rollbacked unless they consist of just
                                   ///< one simple operation)
+        fJournalWAL      = 0x800, ///< Write-ahead log; readers are not
+                                  ///< blocked by a writer and see the last
+                                  ///< committed state (requires SQLite
+                                  ///< 3.7.0, otherwise the same as
+                                  ///< fJournalDelete)
         /// Default value for journaling group of flags
         fDefaultJournal  = fJournalDelete,
         eAllJournal      = fJournalDelete + fJournalTruncate + fJournalPersist
-                           + fJournalMemory + fJournalOff,
+                           + fJournalMemory + fJournalOff + fJournalWAL,
 
         // Mode of reliable synchronization with disk database file
         fSyncFull    = 0x000,  ///< Full synchronization, database cannot be
@@ -0,0 +1,226 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file FeatureDescr_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'biotree.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_BIOTREE_FEATUREDESCR_BASE_HPP
+#define OBJECTS_BIOTREE_FEATUREDESCR_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_BIOTREE_EXPORT CFeatureDescr_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CFeatureDescr_Base(void);
+    // destructor
+    virtual ~CFeatureDescr_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef int TId;
+    typedef string TName;
+
+    // getters
+    // setters
+
+    /// feature id
+    /// mandatory
+    /// typedef int TId
+    ///  Check whether the Id data member has been assigned a value.
+    bool IsSetId(void) const;
+    /// Check whether it is safe or not to call GetId method.
+    bool CanGetId(void) const;
+    void ResetId(void);
+    TId GetId(void) const;
+    void SetId(TId value);
+    TId& SetId(void);
+
+    /// feature name
+    /// mandatory
+    /// typedef string TName
+    ///  Check whether the Name data member has been assigned a value.
+    bool IsSetName(void) const;
+    /// Check whether it is safe or not to call GetName method.
+    bool CanGetName(void) const;
+    void ResetName(void);
+    const TName& GetName(void) const;
+    void SetName(const TName& value);
+    TName& SetName(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CFeatureDescr_Base(const CFeatureDescr_Base&);
+    CFeatureDescr_Base& operator=(const CFeatureDescr_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    int m_Id;
+    string m_Name;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CFeatureDescr_Base::IsSetId(void) const
+{
+    return ((m_set_State[0] & 0x3) != 0);
+}
+
+inline
+bool CFeatureDescr_Base::CanGetId(void) const
+{
+    return IsSetId();
+}
+
+inline
+void CFeatureDescr_Base::ResetId(void)
+{
+    m_Id = 0;
+    m_set_State[0] &= ~0x3;
+}
+
+inline
+CFeatureDescr_Base::TId CFeatureDescr_Base::GetId(void) const
+{
+    if (!CanGetId()) {
+        ThrowUnassigned(0);
+    }
+    return m_Id;
+}
+
+inline
+void CFeatureDescr_Base::SetId(CFeatureDescr_Base::TId value)
+{
+    m_Id = value;
+    m_set_State[0] |= 0x3;
+}
+
+inline
+CFeatureDescr_Base::TId& CFeatureDescr_Base::SetId(void)
+{
+#ifdef _DEBUG
+    if (!IsSetId()) {
+        memset(&m_Id,UnassignedByte(),sizeof(m_Id));
+    }
+#endif
+    m_set_State[0] |= 0x1;
+    return m_Id;
+}
+
+inline
+bool CFeatureDescr_Base::IsSetName(void) const
+{
+    return ((m_set_State[0] & 0xc) != 0);
+}
+
+inline
+bool CFeatureDescr_Base::CanGetName(void) const
+{
+    return IsSetName();
+}
+
+inline
+const CFeatureDescr_Base::TName& CFeatureDescr_Base::GetName(void) const
+{
+    if (!CanGetName()) {
+        ThrowUnassigned(1);
+    }
+    return m_Name;
+}
+
+inline
+void CFeatureDescr_Base::SetName(const CFeatureDescr_Base::TName& value)
+{
+    m_Name = value;
+    m_set_State[0] |= 0xc;
+}
+
+inline
+CFeatureDescr_Base::TName& CFeatureDescr_Base::SetName(void)
+{
+#ifdef _DEBUG
+    if (!IsSetName()) {
+        m_Name = UnassignedString();
+    }
+#endif
+    m_set_State[0] |= 0x4;
+    return m_Name;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_BIOTREE_FEATUREDESCR_BASE_HPP
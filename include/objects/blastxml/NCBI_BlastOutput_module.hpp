@@ -0,0 +1,59 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'blastxml.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#ifndef NCBI_BlastOutput_REGISTERMODULECLASSES_HPP
+#define NCBI_BlastOutput_REGISTERMODULECLASSES_HPP
+
+#include <serial/serialbase.hpp>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+NCBI_BLASTXML_EXPORT
+void NCBI_BlastOutput_RegisterModuleClasses(void);
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // NCBI_BlastOutput_REGISTERMODULECLASSES_HPP
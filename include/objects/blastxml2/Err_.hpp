@@ -0,0 +1,232 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Err_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'blastxml2.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_BLASTXML2_ERR_BASE_HPP
+#define OBJECTS_BLASTXML2_ERR_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+#ifndef BEGIN_blastxml2_SCOPE
+#  define BEGIN_blastxml2_SCOPE BEGIN_SCOPE(blastxml2)
+#  define END_blastxml2_SCOPE END_SCOPE(blastxml2)
+#endif
+BEGIN_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_BLASTXML2_EXPORT CErr_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CErr_Base(void);
+    // destructor
+    virtual ~CErr_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef int TCode;
+    typedef string TMessage;
+
+    // getters
+    // setters
+
+    /// mandatory
+    /// typedef int TCode
+    ///  Check whether the Code data member has been assigned a value.
+    bool IsSetCode(void) const;
+    /// Check whether it is safe or not to call GetCode method.
+    bool CanGetCode(void) const;
+    void ResetCode(void);
+    TCode GetCode(void) const;
+    void SetCode(TCode value);
+    TCode& SetCode(void);
+
+    /// optional
+    /// typedef string TMessage
+    ///  Check whether the Message data member has been assigned a value.
+    bool IsSetMessage(void) const;
+    /// Check whether it is safe or not to call GetMessage method.
+    bool CanGetMessage(void) const;
+    void ResetMessage(void);
+    const TMessage& GetMessage(void) const;
+    void SetMessage(const TMessage& value);
+    TMessage& SetMessage(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CErr_Base(const CErr_Base&);
+    CErr_Base& operator=(const CErr_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    int m_Code;
+    string m_Message;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CErr_Base::IsSetCode(void) const
+{
+    return ((m_set_State[0] & 0x3) != 0);
+}
+
+inline
+bool CErr_Base::CanGetCode(void) const
+{
+    return IsSetCode();
+}
+
+inline
+void CErr_Base::ResetCode(void)
+{
+    m_Code = 0;
+    m_set_State[0] &= ~0x3;
+}
+
+inline
+CErr_Base::TCode CErr_Base::GetCode(void) const
+{
+    if (!CanGetCode()) {
+        ThrowUnassigned(0);
+    }
+    return m_Code;
+}
+
+inline
+void CErr_Base::SetCode(CErr_Base::TCode value)
+{
+    m_Code = value;
+    m_set_State[0] |= 0x3;
+}
+
+inline
+CErr_Base::TCode& CErr_Base::SetCode(void)
+{
+#ifdef _DEBUG
+    if (!IsSetCode()) {
+        memset(&m_Code,UnassignedByte(),sizeof(m_Code));
+    }
+#endif
+    m_set_State[0] |= 0x1;
+    return m_Code;
+}
+
+inline
+bool CErr_Base::IsSetMessage(void) const
+{
+    return ((m_set_State[0] & 0xc) != 0);
+}
+
+inline
+bool CErr_Base::CanGetMessage(void) const
+{
+    return IsSetMessage();
+}
+
+inline
+const CErr_Base::TMessage& CErr_Base::GetMessage(void) const
+{
+    if (!CanGetMessage()) {
+        ThrowUnassigned(1);
+    }
+    return m_Message;
+}
+
+inline
+void CErr_Base::SetMessage(const CErr_Base::TMessage& value)
+{
+    m_Message = value;
+    m_set_State[0] |= 0xc;
+}
+
+inline
+CErr_Base::TMessage& CErr_Base::SetMessage(void)
+{
+#ifdef _DEBUG
+    if (!IsSetMessage()) {
+        m_Message = UnassignedString();
+    }
+#endif
+    m_set_State[0] |= 0x4;
+    return m_Message;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_BLASTXML2_ERR_BASE_HPP
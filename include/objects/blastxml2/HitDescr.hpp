@@ -0,0 +1,91 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file HitDescr.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'blastxml2.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: HitDescr_.hpp
+
+
+#ifndef OBJECTS_BLASTXML2_HITDESCR_HPP
+#define OBJECTS_BLASTXML2_HITDESCR_HPP
+
+
+// generated includes
+#include <objects/blastxml2/HitDescr_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+BEGIN_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_BLASTXML2_EXPORT CHitDescr : public CHitDescr_Base
+{
+    typedef CHitDescr_Base Tparent;
+public:
+    // constructor
+    CHitDescr(void);
+    // destructor
+    ~CHitDescr(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CHitDescr(const CHitDescr& value);
+    CHitDescr& operator=(const CHitDescr& value);
+
+};
+
+/////////////////// CHitDescr inline methods
+
+// constructor
+inline
+CHitDescr::CHitDescr(void)
+{
+}
+
+
+/////////////////// end of CHitDescr inline methods
+
+
+END_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_BLASTXML2_HITDESCR_HPP
+/* Original file checksum: lines: 90, chars: 2529, CRC32: 5396774f */
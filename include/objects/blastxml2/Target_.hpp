@@ -0,0 +1,246 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Target_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'blastxml2.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_BLASTXML2_TARGET_BASE_HPP
+#define OBJECTS_BLASTXML2_TARGET_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <list>
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+#ifndef BEGIN_blastxml2_SCOPE
+#  define BEGIN_blastxml2_SCOPE BEGIN_SCOPE(blastxml2)
+#  define END_blastxml2_SCOPE END_SCOPE(blastxml2)
+#endif
+BEGIN_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_BLASTXML2_EXPORT CTarget_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CTarget_Base(void);
+    // destructor
+    virtual ~CTarget_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+
+    /// Choice variants.
+    enum E_Choice {
+        e_not_set = 0,  ///< No variant selected
+        e_Db,           ///< BLAST Database name
+        e_Subjects      ///< Subject IDs
+    };
+    /// Maximum+1 value of the choice variant enumerator.
+    enum E_ChoiceStopper {
+        e_MaxChoice = 3 ///< == e_Subjects+1
+    };
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+    /// Reset the selection (set it to e_not_set).
+    virtual void ResetSelection(void);
+
+    /// Which variant is currently selected.
+    E_Choice Which(void) const;
+
+    /// Verify selection, throw exception if it differs from the expected.
+    void CheckSelected(E_Choice index) const;
+
+    /// Throw 'InvalidSelection' exception.
+    NCBI_NORETURN void ThrowInvalidSelection(E_Choice index) const;
+
+    /// Retrieve selection name (for diagnostic purposes).
+    static string SelectionName(E_Choice index);
+
+    /// Select the requested variant if needed.
+    void Select(E_Choice index, EResetVariant reset = eDoResetVariant);
+    /// Select the requested variant if needed,
+    /// allocating CObject variants from memory pool.
+    void Select(E_Choice index,
+                EResetVariant reset,
+                CObjectMemoryPool* pool);
+
+    // types
+    typedef string TDb;
+    typedef list< string > TSubjects;
+
+    // getters
+    // setters
+
+    // typedef string TDb
+    bool IsDb(void) const;
+    const TDb& GetDb(void) const;
+    TDb& SetDb(void);
+    void SetDb(const TDb& value);
+
+    // typedef list< string > TSubjects
+    bool IsSubjects(void) const;
+    const TSubjects& GetSubjects(void) const;
+    TSubjects& SetSubjects(void);
+
+
+private:
+    // copy constructor and assignment operator
+    CTarget_Base(const CTarget_Base& );
+    CTarget_Base& operator=(const CTarget_Base& );
+    // choice state
+    E_Choice m_choice;
+    // helper methods
+    void DoSelect(E_Choice index, CObjectMemoryPool* pool = 0);
+
+    static const char* const sm_SelectionNames[];
+    // data
+    union {
+        NCBI_NS_NCBI::CUnionBuffer<TSubjects> m_Subjects;
+        NCBI_NS_NCBI::CUnionBuffer<NCBI_NS_STD::string> m_string;
+        void* m_dummy_pointer_for_alignment;
+    };
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+CTarget_Base::E_Choice CTarget_Base::Which(void) const
+{
+    return m_choice;
+}
+
+inline
+void CTarget_Base::CheckSelected(E_Choice index) const
+{
+    if ( m_choice != index )
+        ThrowInvalidSelection(index);
+}
+
+inline
+void CTarget_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    if ( reset == NCBI_NS_NCBI::eDoResetVariant || m_choice != index ) {
+        if ( m_choice != e_not_set )
+            ResetSelection();
+        DoSelect(index, pool);
+    }
+}
+
+inline
+void CTarget_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset)
+{
+    Select(index, reset, 0);
+}
+
+inline
+bool CTarget_Base::IsDb(void) const
+{
+    return m_choice == e_Db;
+}
+
+inline
+const CTarget_Base::TDb& CTarget_Base::GetDb(void) const
+{
+    CheckSelected(e_Db);
+    return *m_string;
+}
+
+inline
+CTarget_Base::TDb& CTarget_Base::SetDb(void)
+{
+    Select(e_Db, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *m_string;
+}
+
+inline
+bool CTarget_Base::IsSubjects(void) const
+{
+    return m_choice == e_Subjects;
+}
+
+inline
+const CTarget_Base::TSubjects& CTarget_Base::GetSubjects(void) const
+{
+    CheckSelected(e_Subjects);
+    return *m_Subjects;
+}
+
+inline
+CTarget_Base::TSubjects& CTarget_Base::SetSubjects(void)
+{
+    Select(e_Subjects, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *m_Subjects;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_BLASTXML2_TARGET_BASE_HPP
@@ -0,0 +1,38 @@
+#include <objects/entrez2/E2Reply.hpp>
+#include <objects/entrez2/E2Request.hpp>
+#include <objects/entrez2/Entrez2_boolean_element.hpp>
+#include <objects/entrez2/Entrez2_boolean_exp.hpp>
+#include <objects/entrez2/Entrez2_boolean_reply.hpp>
+#include <objects/entrez2/Entrez2_boolean_term.hpp>
+#include <objects/entrez2/Entrez2_db_id.hpp>
+#include <objects/entrez2/Entrez2_db_info.hpp>
+#include <objects/entrez2/Entrez2_docsum.hpp>
+#include <objects/entrez2/Entrez2_docsum_data.hpp>
+#include <objects/entrez2/Entrez2_docsum_field_info.hpp>
+#include <objects/entrez2/Entrez2_docsum_field_type.hpp>
+#include <objects/entrez2/Entrez2_docsum_list.hpp>
+#include <objects/entrez2/Entrez2_dt.hpp>
+#include <objects/entrez2/Entrez2_dt_filter.hpp>
+#include <objects/entrez2/Entrez2_eval_boolean.hpp>
+#include <objects/entrez2/Entrez2_field_id.hpp>
+#include <objects/entrez2/Entrez2_field_info.hpp>
+#include <objects/entrez2/Entrez2_get_links.hpp>
+#include <objects/entrez2/Entrez2_hier_node.hpp>
+#include <objects/entrez2/Entrez2_hier_query.hpp>
+#include <objects/entrez2/Entrez2_id.hpp>
+#include <objects/entrez2/Entrez2_id_list.hpp>
+#include <objects/entrez2/Entrez2_info.hpp>
+#include <objects/entrez2/Entrez2_limits.hpp>
+#include <objects/entrez2/Entrez2_link_count.hpp>
+#include <objects/entrez2/Entrez2_link_count_list.hpp>
+#include <objects/entrez2/Entrez2_link_id.hpp>
+#include <objects/entrez2/Entrez2_link_info.hpp>
+#include <objects/entrez2/Entrez2_link_set.hpp>
+#include <objects/entrez2/Entrez2_operator.hpp>
+#include <objects/entrez2/Entrez2_reply.hpp>
+#include <objects/entrez2/Entrez2_request.hpp>
+#include <objects/entrez2/Entrez2_term.hpp>
+#include <objects/entrez2/Entrez2_term_list.hpp>
+#include <objects/entrez2/Entrez2_term_pos.hpp>
+#include <objects/entrez2/Entrez2_term_query.hpp>
+#include <objects/entrez2/NCBI_Entrez2_module.hpp>
@@ -0,0 +1,206 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file GBStrucComment_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'gbseq.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_GBSEQ_GBSTRUCCOMMENT_BASE_HPP
+#define OBJECTS_GBSEQ_GBSTRUCCOMMENT_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <list>
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CGBStrucCommentItem;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_GBSEQ_EXPORT CGBStrucComment_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CGBStrucComment_Base(void);
+    // destructor
+    virtual ~CGBStrucComment_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef string TName;
+    typedef list< CRef< CGBStrucCommentItem > > TItems;
+
+    // getters
+    // setters
+
+    /// optional
+    /// typedef string TName
+    ///  Check whether the Name data member has been assigned a value.
+    bool IsSetName(void) const;
+    /// Check whether it is safe or not to call GetName method.
+    bool CanGetName(void) const;
+    void ResetName(void);
+    const TName& GetName(void) const;
+    void SetName(const TName& value);
+    TName& SetName(void);
+
+    /// mandatory
+    /// typedef list< CRef< CGBStrucCommentItem > > TItems
+    ///  Check whether the Items data member has been assigned a value.
+    bool IsSetItems(void) const;
+    /// Check whether it is safe or not to call GetItems method.
+    bool CanGetItems(void) const;
+    void ResetItems(void);
+    const TItems& GetItems(void) const;
+    TItems& SetItems(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CGBStrucComment_Base(const CGBStrucComment_Base&);
+    CGBStrucComment_Base& operator=(const CGBStrucComment_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    string m_Name;
+    list< CRef< CGBStrucCommentItem > > m_Items;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CGBStrucComment_Base::IsSetName(void) const
+{
+    return ((m_set_State[0] & 0x3) != 0);
+}
+
+inline
+bool CGBStrucComment_Base::CanGetName(void) const
+{
+    return IsSetName();
+}
+
+inline
+const CGBStrucComment_Base::TName& CGBStrucComment_Base::GetName(void) const
+{
+    if (!CanGetName()) {
+        ThrowUnassigned(0);
+    }
+    return m_Name;
+}
+
+inline
+void CGBStrucComment_Base::SetName(const CGBStrucComment_Base::TName& value)
+{
+    m_Name = value;
+    m_set_State[0] |= 0x3;
+}
+
+inline
+CGBStrucComment_Base::TName& CGBStrucComment_Base::SetName(void)
+{
+#ifdef _DEBUG
+    if (!IsSetName()) {
+        m_Name = UnassignedString();
+    }
+#endif
+    m_set_State[0] |= 0x1;
+    return m_Name;
+}
+
+inline
+bool CGBStrucComment_Base::IsSetItems(void) const
+{
+    return ((m_set_State[0] & 0xc) != 0);
+}
+
+inline
+bool CGBStrucComment_Base::CanGetItems(void) const
+{
+    return true;
+}
+
+inline
+const CGBStrucComment_Base::TItems& CGBStrucComment_Base::GetItems(void) const
+{
+    return m_Items;
+}
+
+inline
+CGBStrucComment_Base::TItems& CGBStrucComment_Base::SetItems(void)
+{
+    m_set_State[0] |= 0x4;
+    return m_Items;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_GBSEQ_GBSTRUCCOMMENT_BASE_HPP
@@ -0,0 +1,19 @@
+#include <objects/gbseq/GBAltSeqData.hpp>
+#include <objects/gbseq/GBAltSeqItem.hpp>
+#include <objects/gbseq/GBAuthor.hpp>
+#include <objects/gbseq/GBComment.hpp>
+#include <objects/gbseq/GBCommentParagraph.hpp>
+#include <objects/gbseq/GBFeature.hpp>
+#include <objects/gbseq/GBFeatureSet.hpp>
+#include <objects/gbseq/GBInterval.hpp>
+#include <objects/gbseq/GBKeyword.hpp>
+#include <objects/gbseq/GBQualifier.hpp>
+#include <objects/gbseq/GBReference.hpp>
+#include <objects/gbseq/GBSecondary_accn.hpp>
+#include <objects/gbseq/GBSeq.hpp>
+#include <objects/gbseq/GBSeqid.hpp>
+#include <objects/gbseq/GBSet.hpp>
+#include <objects/gbseq/GBStrucComment.hpp>
+#include <objects/gbseq/GBStrucCommentItem.hpp>
+#include <objects/gbseq/GBXref.hpp>
+#include <objects/gbseq/NCBI_GBSeq_module.hpp>
@@ -0,0 +1,210 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file GC_Assembly_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'genome_collection.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_GENOMECOLL_GC_ASSEMBLY_BASE_HPP
+#define OBJECTS_GENOMECOLL_GC_ASSEMBLY_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CGC_AssemblySet;
+class CGC_AssemblyUnit;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// A GC-Assembly is either a single assembly unit or it is a set of assemblies
+///
+class NCBI_GENOME_COLLECTION_EXPORT CGC_Assembly_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CGC_Assembly_Base(void);
+    // destructor
+    virtual ~CGC_Assembly_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+
+    /// Choice variants.
+    enum E_Choice {
+        e_not_set = 0,   ///< No variant selected
+        e_Unit,
+        e_Assembly_set
+    };
+    /// Maximum+1 value of the choice variant enumerator.
+    enum E_ChoiceStopper {
+        e_MaxChoice = 3 ///< == e_Assembly_set+1
+    };
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+    /// Reset the selection (set it to e_not_set).
+    virtual void ResetSelection(void);
+
+    /// Which variant is currently selected.
+    E_Choice Which(void) const;
+
+    /// Verify selection, throw exception if it differs from the expected.
+    void CheckSelected(E_Choice index) const;
+
+    /// Throw 'InvalidSelection' exception.
+    NCBI_NORETURN void ThrowInvalidSelection(E_Choice index) const;
+
+    /// Retrieve selection name (for diagnostic purposes).
+    static string SelectionName(E_Choice index);
+
+    /// Select the requested variant if needed.
+    void Select(E_Choice index, EResetVariant reset = eDoResetVariant);
+    /// Select the requested variant if needed,
+    /// allocating CObject variants from memory pool.
+    void Select(E_Choice index,
+                EResetVariant reset,
+                CObjectMemoryPool* pool);
+
+    // types
+    typedef CGC_AssemblyUnit TUnit;
+    typedef CGC_AssemblySet TAssembly_set;
+
+    // getters
+    // setters
+
+    // typedef CGC_AssemblyUnit TUnit
+    bool IsUnit(void) const;
+    const TUnit& GetUnit(void) const;
+    TUnit& SetUnit(void);
+    void SetUnit(TUnit& value);
+
+    // typedef CGC_AssemblySet TAssembly_set
+    bool IsAssembly_set(void) const;
+    const TAssembly_set& GetAssembly_set(void) const;
+    TAssembly_set& SetAssembly_set(void);
+    void SetAssembly_set(TAssembly_set& value);
+
+
+private:
+    // copy constructor and assignment operator
+    CGC_Assembly_Base(const CGC_Assembly_Base& );
+    CGC_Assembly_Base& operator=(const CGC_Assembly_Base& );
+    // choice state
+    E_Choice m_choice;
+    // helper methods
+    void DoSelect(E_Choice index, CObjectMemoryPool* pool = 0);
+
+    static const char* const sm_SelectionNames[];
+    // data
+    NCBI_NS_NCBI::CSerialObject *m_object;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+CGC_Assembly_Base::E_Choice CGC_Assembly_Base::Which(void) const
+{
+    return m_choice;
+}
+
+inline
+void CGC_Assembly_Base::CheckSelected(E_Choice index) const
+{
+    if ( m_choice != index )
+        ThrowInvalidSelection(index);
+}
+
+inline
+void CGC_Assembly_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    if ( reset == NCBI_NS_NCBI::eDoResetVariant || m_choice != index ) {
+        if ( m_choice != e_not_set )
+            ResetSelection();
+        DoSelect(index, pool);
+    }
+}
+
+inline
+void CGC_Assembly_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset)
+{
+    Select(index, reset, 0);
+}
+
+inline
+bool CGC_Assembly_Base::IsUnit(void) const
+{
+    return m_choice == e_Unit;
+}
+
+inline
+bool CGC_Assembly_Base::IsAssembly_set(void) const
+{
+    return m_choice == e_Assembly_set;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_GENOMECOLL_GC_ASSEMBLY_BASE_HPP
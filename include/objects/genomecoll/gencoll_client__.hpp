@@ -0,0 +1,17 @@
+#include <objects/genomecoll/GCClientRequest.hpp>
+#include <objects/genomecoll/GCClientResponse.hpp>
+#include <objects/genomecoll/GCClient_AssembliesForSequ.hpp>
+#include <objects/genomecoll/GCClient_AssemblyInfo.hpp>
+#include <objects/genomecoll/GCClient_AssemblySequenceI.hpp>
+#include <objects/genomecoll/GCClient_AttributeFlags.hpp>
+#include <objects/genomecoll/GCClient_EquivalentAssembl.hpp>
+#include <objects/genomecoll/GCClient_Error.hpp>
+#include <objects/genomecoll/GCClient_FindBestAssemblyF.hpp>
+#include <objects/genomecoll/GCClient_FindBestAssemblyR.hpp>
+#include <objects/genomecoll/GCClient_FindBestAssemblyS.hpp>
+#include <objects/genomecoll/GCClient_GetAssemblyBlobRe.hpp>
+#include <objects/genomecoll/GCClient_GetAssemblyBySequ.hpp>
+#include <objects/genomecoll/GCClient_GetAssemblyReques.hpp>
+#include <objects/genomecoll/GCClient_GetEquivalentAsse.hpp>
+#include <objects/genomecoll/GCClient_ValidateChrTypeLo.hpp>
+#include <objects/genomecoll/NCBI_GencollClient_module.hpp>
@@ -0,0 +1,20 @@
+#include <objects/genomecoll/GC_Assemblies.hpp>
+#include <objects/genomecoll/GC_Assembly.hpp>
+#include <objects/genomecoll/GC_AssemblyDesc.hpp>
+#include <objects/genomecoll/GC_AssemblySet.hpp>
+#include <objects/genomecoll/GC_AssemblyUnit.hpp>
+#include <objects/genomecoll/GC_DbTagAlias.hpp>
+#include <objects/genomecoll/GC_External_Seqid.hpp>
+#include <objects/genomecoll/GC_Genome.hpp>
+#include <objects/genomecoll/GC_GenomicPart.hpp>
+#include <objects/genomecoll/GC_Project.hpp>
+#include <objects/genomecoll/GC_Query.hpp>
+#include <objects/genomecoll/GC_Replicon.hpp>
+#include <objects/genomecoll/GC_Scaf_stats.hpp>
+#include <objects/genomecoll/GC_SeqIdAlias.hpp>
+#include <objects/genomecoll/GC_Sequence.hpp>
+#include <objects/genomecoll/GC_SequenceRole.hpp>
+#include <objects/genomecoll/GC_SequenceStats.hpp>
+#include <objects/genomecoll/GC_TaggedSequences.hpp>
+#include <objects/genomecoll/GC_TypedSeqId.hpp>
+#include <objects/genomecoll/NCBI_GenomeCollection_module.hpp>
@@ -0,0 +1,203 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file ID2_Reply_Get_Package_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'id2.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_ID2_ID2_REPLY_GET_PACKAGE_BASE_HPP
+#define OBJECTS_ID2_ID2_REPLY_GET_PACKAGE_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CID2_Params;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+/// Reply to ID2-Request-Get-Packages.
+class NCBI_ID2_EXPORT CID2_Reply_Get_Package_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CID2_Reply_Get_Package_Base(void);
+    // destructor
+    virtual ~CID2_Reply_Get_Package_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef string TName;
+    typedef CID2_Params TParams;
+
+    // getters
+    // setters
+
+    /// mandatory
+    /// typedef string TName
+    ///  Check whether the Name data member has been assigned a value.
+    bool IsSetName(void) const;
+    /// Check whether it is safe or not to call GetName method.
+    bool CanGetName(void) const;
+    void ResetName(void);
+    const TName& GetName(void) const;
+    void SetName(const TName& value);
+    TName& SetName(void);
+
+    /// optional
+    /// typedef CID2_Params TParams
+    ///  Check whether the Params data member has been assigned a value.
+    bool IsSetParams(void) const;
+    /// Check whether it is safe or not to call GetParams method.
+    bool CanGetParams(void) const;
+    void ResetParams(void);
+    const TParams& GetParams(void) const;
+    void SetParams(TParams& value);
+    TParams& SetParams(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CID2_Reply_Get_Package_Base(const CID2_Reply_Get_Package_Base&);
+    CID2_Reply_Get_Package_Base& operator=(const CID2_Reply_Get_Package_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    string m_Name;
+    CRef< TParams > m_Params;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CID2_Reply_Get_Package_Base::IsSetName(void) const
+{
+    return ((m_set_State[0] & 0x3) != 0);
+}
+
+inline
+bool CID2_Reply_Get_Package_Base::CanGetName(void) const
+{
+    return IsSetName();
+}
+
+inline
+const CID2_Reply_Get_Package_Base::TName& CID2_Reply_Get_Package_Base::GetName(void) const
+{
+    if (!CanGetName()) {
+        ThrowUnassigned(0);
+    }
+    return m_Name;
+}
+
+inline
+void CID2_Reply_Get_Package_Base::SetName(const CID2_Reply_Get_Package_Base::TName& value)
+{
+    m_Name = value;
+    m_set_State[0] |= 0x3;
+}
+
+inline
+CID2_Reply_Get_Package_Base::TName& CID2_Reply_Get_Package_Base::SetName(void)
+{
+#ifdef _DEBUG
+    if (!IsSetName()) {
+        m_Name = UnassignedString();
+    }
+#endif
+    m_set_State[0] |= 0x1;
+    return m_Name;
+}
+
+inline
+bool CID2_Reply_Get_Package_Base::IsSetParams(void) const
+{
+    return m_Params.NotEmpty();
+}
+
+inline
+bool CID2_Reply_Get_Package_Base::CanGetParams(void) const
+{
+    return IsSetParams();
+}
+
+inline
+const CID2_Reply_Get_Package_Base::TParams& CID2_Reply_Get_Package_Base::GetParams(void) const
+{
+    if (!CanGetParams()) {
+        ThrowUnassigned(1);
+    }
+    return (*m_Params);
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_ID2_ID2_REPLY_GET_PACKAGE_BASE_HPP
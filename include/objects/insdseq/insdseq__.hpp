@@ -0,0 +1,19 @@
+#include <objects/insdseq/INSDAltSeqData.hpp>
+#include <objects/insdseq/INSDAltSeqItem.hpp>
+#include <objects/insdseq/INSDAuthor.hpp>
+#include <objects/insdseq/INSDComment.hpp>
+#include <objects/insdseq/INSDCommentParagraph.hpp>
+#include <objects/insdseq/INSDFeature.hpp>
+#include <objects/insdseq/INSDFeatureSet.hpp>
+#include <objects/insdseq/INSDInterval.hpp>
+#include <objects/insdseq/INSDKeyword.hpp>
+#include <objects/insdseq/INSDQualifier.hpp>
+#include <objects/insdseq/INSDReference.hpp>
+#include <objects/insdseq/INSDSecondary_accn.hpp>
+#include <objects/insdseq/INSDSeq.hpp>
+#include <objects/insdseq/INSDSeqid.hpp>
+#include <objects/insdseq/INSDSet.hpp>
+#include <objects/insdseq/INSDStrucComment.hpp>
+#include <objects/insdseq/INSDStrucCommentItem.hpp>
+#include <objects/insdseq/INSDXref.hpp>
+#include <objects/insdseq/INSD_INSDSeq_module.hpp>
@@ -0,0 +1,80 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file ExistingTextOption_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'macro.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_MACRO_EXISTINGTEXTOPTION_BASE_HPP
+#define OBJECTS_MACRO_EXISTINGTEXTOPTION_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+enum EExistingTextOption {
+    eExistingTextOption_replace_old  =  1,
+    eExistingTextOption_append_semi  =  2,
+    eExistingTextOption_append_space =  3,
+    eExistingTextOption_append_colon =  4,
+    eExistingTextOption_append_comma =  5,
+    eExistingTextOption_append_none  =  6,
+    eExistingTextOption_prefix_semi  =  7,
+    eExistingTextOption_prefix_space =  8,
+    eExistingTextOption_prefix_colon =  9,
+    eExistingTextOption_prefix_comma = 10,
+    eExistingTextOption_prefix_none  = 11,
+    eExistingTextOption_leave_old    = 12,
+    eExistingTextOption_add_qual     = 13
+};
+
+/// Access to EExistingTextOption's attributes (values, names) as defined in spec
+ const NCBI_NS_NCBI::CEnumeratedTypeValues* ENUM_METHOD_NAME(EExistingTextOption)(void);
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MACRO_EXISTINGTEXTOPTION_BASE_HPP
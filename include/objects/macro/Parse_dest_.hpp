@@ -0,0 +1,276 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Parse_dest_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'macro.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_MACRO_PARSE_DEST_BASE_HPP
+#define OBJECTS_MACRO_PARSE_DEST_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CFeature_field_legal;
+class CParse_dst_org;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class CParse_dest_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CParse_dest_Base(void);
+    // destructor
+    virtual ~CParse_dest_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+
+    /// Choice variants.
+    enum E_Choice {
+        e_not_set = 0,         ///< No variant selected
+        e_Defline,
+        e_Org,
+        e_Featqual,
+        e_Comment_descriptor,
+        e_Dbxref
+    };
+    /// Maximum+1 value of the choice variant enumerator.
+    enum E_ChoiceStopper {
+        e_MaxChoice = 6 ///< == e_Dbxref+1
+    };
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+    /// Reset the selection (set it to e_not_set).
+    virtual void ResetSelection(void);
+
+    /// Which variant is currently selected.
+    E_Choice Which(void) const;
+
+    /// Verify selection, throw exception if it differs from the expected.
+    void CheckSelected(E_Choice index) const;
+
+    /// Throw 'InvalidSelection' exception.
+    NCBI_NORETURN void ThrowInvalidSelection(E_Choice index) const;
+
+    /// Retrieve selection name (for diagnostic purposes).
+    static string SelectionName(E_Choice index);
+
+    /// Select the requested variant if needed.
+    void Select(E_Choice index, EResetVariant reset = eDoResetVariant);
+    /// Select the requested variant if needed,
+    /// allocating CObject variants from memory pool.
+    void Select(E_Choice index,
+                EResetVariant reset,
+                CObjectMemoryPool* pool);
+
+    // types
+    typedef CParse_dst_org TOrg;
+    typedef CFeature_field_legal TFeatqual;
+    typedef string TDbxref;
+
+    // getters
+    // setters
+
+
+    bool IsDefline(void) const;
+    void SetDefline(void);
+
+    // typedef CParse_dst_org TOrg
+    bool IsOrg(void) const;
+    const TOrg& GetOrg(void) const;
+    TOrg& SetOrg(void);
+    void SetOrg(TOrg& value);
+
+    // typedef CFeature_field_legal TFeatqual
+    bool IsFeatqual(void) const;
+    const TFeatqual& GetFeatqual(void) const;
+    TFeatqual& SetFeatqual(void);
+    void SetFeatqual(TFeatqual& value);
+
+
+    bool IsComment_descriptor(void) const;
+    void SetComment_descriptor(void);
+
+    // typedef string TDbxref
+    bool IsDbxref(void) const;
+    const TDbxref& GetDbxref(void) const;
+    TDbxref& SetDbxref(void);
+    void SetDbxref(const TDbxref& value);
+
+
+private:
+    // copy constructor and assignment operator
+    CParse_dest_Base(const CParse_dest_Base& );
+    CParse_dest_Base& operator=(const CParse_dest_Base& );
+    // choice state
+    E_Choice m_choice;
+    // helper methods
+    void DoSelect(E_Choice index, CObjectMemoryPool* pool = 0);
+
+    static const char* const sm_SelectionNames[];
+    // data
+    union {
+        NCBI_NS_NCBI::CUnionBuffer<NCBI_NS_STD::string> m_string;
+        NCBI_NS_NCBI::CSerialObject *m_object;
+    };
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+CParse_dest_Base::E_Choice CParse_dest_Base::Which(void) const
+{
+    return m_choice;
+}
+
+inline
+void CParse_dest_Base::CheckSelected(E_Choice index) const
+{
+    if ( m_choice != index )
+        ThrowInvalidSelection(index);
+}
+
+inline
+void CParse_dest_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    if ( reset == NCBI_NS_NCBI::eDoResetVariant || m_choice != index ) {
+        if ( m_choice != e_not_set )
+            ResetSelection();
+        DoSelect(index, pool);
+    }
+}
+
+inline
+void CParse_dest_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset)
+{
+    Select(index, reset, 0);
+}
+
+inline
+bool CParse_dest_Base::IsDefline(void) const
+{
+    return m_choice == e_Defline;
+}
+
+inline
+void CParse_dest_Base::SetDefline(void)
+{
+    Select(e_Defline, NCBI_NS_NCBI::eDoNotResetVariant);
+}
+
+inline
+bool CParse_dest_Base::IsOrg(void) const
+{
+    return m_choice == e_Org;
+}
+
+inline
+bool CParse_dest_Base::IsFeatqual(void) const
+{
+    return m_choice == e_Featqual;
+}
+
+inline
+bool CParse_dest_Base::IsComment_descriptor(void) const
+{
+    return m_choice == e_Comment_descriptor;
+}
+
+inline
+void CParse_dest_Base::SetComment_descriptor(void)
+{
+    Select(e_Comment_descriptor, NCBI_NS_NCBI::eDoNotResetVariant);
+}
+
+inline
+bool CParse_dest_Base::IsDbxref(void) const
+{
+    return m_choice == e_Dbxref;
+}
+
+inline
+const CParse_dest_Base::TDbxref& CParse_dest_Base::GetDbxref(void) const
+{
+    CheckSelected(e_Dbxref);
+    return *m_string;
+}
+
+inline
+CParse_dest_Base::TDbxref& CParse_dest_Base::SetDbxref(void)
+{
+    Select(e_Dbxref, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *m_string;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MACRO_PARSE_DEST_BASE_HPP
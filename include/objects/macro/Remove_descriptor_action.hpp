@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Remove_descriptor_action.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'macro.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Remove_descriptor_action_.hpp
+
+
+#ifndef OBJECTS_MACRO_REMOVE_DESCRIPTOR_ACTION_HPP
+#define OBJECTS_MACRO_REMOVE_DESCRIPTOR_ACTION_HPP
+
+
+// generated includes
+#include <objects/macro/Remove_descriptor_action_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class CRemove_descriptor_action : public CRemove_descriptor_action_Base
+{
+    typedef CRemove_descriptor_action_Base Tparent;
+public:
+    // constructor
+    CRemove_descriptor_action(void);
+    // destructor
+    ~CRemove_descriptor_action(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CRemove_descriptor_action(const CRemove_descriptor_action& value);
+    CRemove_descriptor_action& operator=(const CRemove_descriptor_action& value);
+
+};
+
+/////////////////// CRemove_descriptor_action inline methods
+
+// constructor
+inline
+CRemove_descriptor_action::CRemove_descriptor_action(void)
+{
+}
+
+
+/////////////////// end of CRemove_descriptor_action inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MACRO_REMOVE_DESCRIPTOR_ACTION_HPP
+/* Original file checksum: lines: 86, chars: 2671, CRC32: ab795034 */
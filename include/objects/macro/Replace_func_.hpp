@@ -0,0 +1,227 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Replace_func_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'macro.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_MACRO_REPLACE_FUNC_BASE_HPP
+#define OBJECTS_MACRO_REPLACE_FUNC_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <string>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CSimple_replace;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class CReplace_func_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CReplace_func_Base(void);
+    // destructor
+    virtual ~CReplace_func_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+
+    /// Choice variants.
+    enum E_Choice {
+        e_not_set = 0,     ///< No variant selected
+        e_Simple_replace,
+        e_Haem_replace
+    };
+    /// Maximum+1 value of the choice variant enumerator.
+    enum E_ChoiceStopper {
+        e_MaxChoice = 3 ///< == e_Haem_replace+1
+    };
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+    /// Reset the selection (set it to e_not_set).
+    virtual void ResetSelection(void);
+
+    /// Which variant is currently selected.
+    E_Choice Which(void) const;
+
+    /// Verify selection, throw exception if it differs from the expected.
+    void CheckSelected(E_Choice index) const;
+
+    /// Throw 'InvalidSelection' exception.
+    NCBI_NORETURN void ThrowInvalidSelection(E_Choice index) const;
+
+    /// Retrieve selection name (for diagnostic purposes).
+    static string SelectionName(E_Choice index);
+
+    /// Select the requested variant if needed.
+    void Select(E_Choice index, EResetVariant reset = eDoResetVariant);
+    /// Select the requested variant if needed,
+    /// allocating CObject variants from memory pool.
+    void Select(E_Choice index,
+                EResetVariant reset,
+                CObjectMemoryPool* pool);
+
+    // types
+    typedef CSimple_replace TSimple_replace;
+    typedef string THaem_replace;
+
+    // getters
+    // setters
+
+    // typedef CSimple_replace TSimple_replace
+    bool IsSimple_replace(void) const;
+    const TSimple_replace& GetSimple_replace(void) const;
+    TSimple_replace& SetSimple_replace(void);
+    void SetSimple_replace(TSimple_replace& value);
+
+    // typedef string THaem_replace
+    bool IsHaem_replace(void) const;
+    const THaem_replace& GetHaem_replace(void) const;
+    THaem_replace& SetHaem_replace(void);
+    void SetHaem_replace(const THaem_replace& value);
+
+
+private:
+    // copy constructor and assignment operator
+    CReplace_func_Base(const CReplace_func_Base& );
+    CReplace_func_Base& operator=(const CReplace_func_Base& );
+    // choice state
+    E_Choice m_choice;
+    // helper methods
+    void DoSelect(E_Choice index, CObjectMemoryPool* pool = 0);
+
+    static const char* const sm_SelectionNames[];
+    // data
+    union {
+        NCBI_NS_NCBI::CUnionBuffer<NCBI_NS_STD::string> m_string;
+        NCBI_NS_NCBI::CSerialObject *m_object;
+    };
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+CReplace_func_Base::E_Choice CReplace_func_Base::Which(void) const
+{
+    return m_choice;
+}
+
+inline
+void CReplace_func_Base::CheckSelected(E_Choice index) const
+{
+    if ( m_choice != index )
+        ThrowInvalidSelection(index);
+}
+
+inline
+void CReplace_func_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    if ( reset == NCBI_NS_NCBI::eDoResetVariant || m_choice != index ) {
+        if ( m_choice != e_not_set )
+            ResetSelection();
+        DoSelect(index, pool);
+    }
+}
+
+inline
+void CReplace_func_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset)
+{
+    Select(index, reset, 0);
+}
+
+inline
+bool CReplace_func_Base::IsSimple_replace(void) const
+{
+    return m_choice == e_Simple_replace;
+}
+
+inline
+bool CReplace_func_Base::IsHaem_replace(void) const
+{
+    return m_choice == e_Haem_replace;
+}
+
+inline
+const CReplace_func_Base::THaem_replace& CReplace_func_Base::GetHaem_replace(void) const
+{
+    CheckSelected(e_Haem_replace);
+    return *m_string;
+}
+
+inline
+CReplace_func_Base::THaem_replace& CReplace_func_Base::SetHaem_replace(void)
+{
+    Select(e_Haem_replace, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *m_string;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MACRO_REPLACE_FUNC_BASE_HPP
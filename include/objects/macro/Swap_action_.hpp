@@ -0,0 +1,154 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Swap_action_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'macro.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_MACRO_SWAP_ACTION_BASE_HPP
+#define OBJECTS_MACRO_SWAP_ACTION_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CField_pair_type;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class CSwap_action_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CSwap_action_Base(void);
+    // destructor
+    virtual ~CSwap_action_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef CField_pair_type TFields;
+
+    // getters
+    // setters
+
+    /// mandatory
+    /// typedef CField_pair_type TFields
+    ///  Check whether the Fields data member has been assigned a value.
+    bool IsSetFields(void) const;
+    /// Check whether it is safe or not to call GetFields method.
+    bool CanGetFields(void) const;
+    void ResetFields(void);
+    const TFields& GetFields(void) const;
+    void SetFields(TFields& value);
+    TFields& SetFields(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CSwap_action_Base(const CSwap_action_Base&);
+    CSwap_action_Base& operator=(const CSwap_action_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    CRef< TFields > m_Fields;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CSwap_action_Base::IsSetFields(void) const
+{
+    return m_Fields.NotEmpty();
+}
+
+inline
+bool CSwap_action_Base::CanGetFields(void) const
+{
+    return true;
+}
+
+inline
+const CSwap_action_Base::TFields& CSwap_action_Base::GetFields(void) const
+{
+    if ( !m_Fields ) {
+        const_cast<CSwap_action_Base*>(this)->ResetFields();
+    }
+    return (*m_Fields);
+}
+
+inline
+CSwap_action_Base::TFields& CSwap_action_Base::SetFields(void)
+{
+    if ( !m_Fields ) {
+        ResetFields();
+    }
+    return (*m_Fields);
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MACRO_SWAP_ACTION_BASE_HPP
@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Updat_repla_ec_numbe_actio.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'macro.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Updat_repla_ec_numbe_actio_.hpp
+
+
+#ifndef OBJECTS_MACRO_UPDAT_REPLA_EC_NUMBE_ACTIO_HPP
+#define OBJECTS_MACRO_UPDAT_REPLA_EC_NUMBE_ACTIO_HPP
+
+
+// generated includes
+#include <objects/macro/Updat_repla_ec_numbe_actio_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class CUpdate_replaced_ec_numbers_action : public CUpdate_replaced_ec_numbers_action_Base
+{
+    typedef CUpdate_replaced_ec_numbers_action_Base Tparent;
+public:
+    // constructor
+    CUpdate_replaced_ec_numbers_action(void);
+    // destructor
+    ~CUpdate_replaced_ec_numbers_action(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CUpdate_replaced_ec_numbers_action(const CUpdate_replaced_ec_numbers_action& value);
+    CUpdate_replaced_ec_numbers_action& operator=(const CUpdate_replaced_ec_numbers_action& value);
+
+};
+
+/////////////////// CUpdate_replaced_ec_numbers_action inline methods
+
+// constructor
+inline
+CUpdate_replaced_ec_numbers_action::CUpdate_replaced_ec_numbers_action(void)
+{
+}
+
+
+/////////////////// end of CUpdate_replaced_ec_numbers_action inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MACRO_UPDAT_REPLA_EC_NUMBE_ACTIO_HPP
+/* Original file checksum: lines: 86, chars: 2800, CRC32: b2673efc */
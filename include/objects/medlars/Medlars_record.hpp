@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Medlars_record.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'medlars.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Medlars_record_.hpp
+
+
+#ifndef OBJECTS_MEDLARS_MEDLARS_RECORD_HPP
+#define OBJECTS_MEDLARS_MEDLARS_RECORD_HPP
+
+
+// generated includes
+#include <objects/medlars/Medlars_record_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_MEDLARS_EXPORT CMedlars_record : public CMedlars_record_Base
+{
+    typedef CMedlars_record_Base Tparent;
+public:
+    // constructor
+    CMedlars_record(void);
+    // destructor
+    ~CMedlars_record(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CMedlars_record(const CMedlars_record& value);
+    CMedlars_record& operator=(const CMedlars_record& value);
+
+};
+
+/////////////////// CMedlars_record inline methods
+
+// constructor
+inline
+CMedlars_record::CMedlars_record(void)
+{
+}
+
+
+/////////////////// end of CMedlars_record inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MEDLARS_MEDLARS_RECORD_HPP
+/* Original file checksum: lines: 86, chars: 2511, CRC32: 2f01d618 */
@@ -0,0 +1,8 @@
+#include <objects/medline/DocRef.hpp>
+#include <objects/medline/Medline_entry.hpp>
+#include <objects/medline/Medline_field.hpp>
+#include <objects/medline/Medline_mesh.hpp>
+#include <objects/medline/Medline_qual.hpp>
+#include <objects/medline/Medline_rn.hpp>
+#include <objects/medline/Medline_si.hpp>
+#include <objects/medline/NCBI_Medline_module.hpp>
@@ -0,0 +1,3 @@
+#include <objects/pubmed/Pubmed_entry.hpp>
+#include <objects/pubmed/Pubmed_url.hpp>
+#include <objects/pubmed/NCBI_PubMed_module.hpp>
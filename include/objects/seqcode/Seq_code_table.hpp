@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Seq_code_table.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'seqcode.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Seq_code_table_.hpp
+
+
+#ifndef OBJECTS_SEQCODE_SEQ_CODE_TABLE_HPP
+#define OBJECTS_SEQCODE_SEQ_CODE_TABLE_HPP
+
+
+// generated includes
+#include <objects/seqcode/Seq_code_table_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_SEQCODE_EXPORT CSeq_code_table : public CSeq_code_table_Base
+{
+    typedef CSeq_code_table_Base Tparent;
+public:
+    // constructor
+    CSeq_code_table(void);
+    // destructor
+    ~CSeq_code_table(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CSeq_code_table(const CSeq_code_table& value);
+    CSeq_code_table& operator=(const CSeq_code_table& value);
+
+};
+
+/////////////////// CSeq_code_table inline methods
+
+// constructor
+inline
+CSeq_code_table::CSeq_code_table(void)
+{
+}
+
+
+/////////////////// end of CSeq_code_table inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_SEQCODE_SEQ_CODE_TABLE_HPP
+/* Original file checksum: lines: 86, chars: 2511, CRC32: d8fd7345 */
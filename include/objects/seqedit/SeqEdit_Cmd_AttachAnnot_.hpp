@@ -0,0 +1,202 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file SeqEdit_Cmd_AttachAnnot_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'seqedit.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_SEQEDIT_SEQEDIT_CMD_ATTACHANNOT_BASE_HPP
+#define OBJECTS_SEQEDIT_SEQEDIT_CMD_ATTACHANNOT_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CSeqEdit_Id;
+class CSeq_annot;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+///***************************************************************
+/// Add an annotation to a bioseq or a bioseq-set
+class NCBI_SEQEDIT_EXPORT CSeqEdit_Cmd_AttachAnnot_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CSeqEdit_Cmd_AttachAnnot_Base(void);
+    // destructor
+    virtual ~CSeqEdit_Cmd_AttachAnnot_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef CSeqEdit_Id TId;
+    typedef CSeq_annot TAnnot;
+
+    // getters
+    // setters
+
+    /// Bioseq or Bioseq_set id
+    /// mandatory
+    /// typedef CSeqEdit_Id TId
+    ///  Check whether the Id data member has been assigned a value.
+    bool IsSetId(void) const;
+    /// Check whether it is safe or not to call GetId method.
+    bool CanGetId(void) const;
+    void ResetId(void);
+    const TId& GetId(void) const;
+    void SetId(TId& value);
+    TId& SetId(void);
+
+    /// complete annotation
+    /// mandatory
+    /// typedef CSeq_annot TAnnot
+    ///  Check whether the Annot data member has been assigned a value.
+    bool IsSetAnnot(void) const;
+    /// Check whether it is safe or not to call GetAnnot method.
+    bool CanGetAnnot(void) const;
+    void ResetAnnot(void);
+    const TAnnot& GetAnnot(void) const;
+    void SetAnnot(TAnnot& value);
+    TAnnot& SetAnnot(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CSeqEdit_Cmd_AttachAnnot_Base(const CSeqEdit_Cmd_AttachAnnot_Base&);
+    CSeqEdit_Cmd_AttachAnnot_Base& operator=(const CSeqEdit_Cmd_AttachAnnot_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    CRef< TId > m_Id;
+    CRef< TAnnot > m_Annot;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CSeqEdit_Cmd_AttachAnnot_Base::IsSetId(void) const
+{
+    return m_Id.NotEmpty();
+}
+
+inline
+bool CSeqEdit_Cmd_AttachAnnot_Base::CanGetId(void) const
+{
+    return true;
+}
+
+inline
+const CSeqEdit_Cmd_AttachAnnot_Base::TId& CSeqEdit_Cmd_AttachAnnot_Base::GetId(void) const
+{
+    if ( !m_Id ) {
+        const_cast<CSeqEdit_Cmd_AttachAnnot_Base*>(this)->ResetId();
+    }
+    return (*m_Id);
+}
+
+inline
+CSeqEdit_Cmd_AttachAnnot_Base::TId& CSeqEdit_Cmd_AttachAnnot_Base::SetId(void)
+{
+    if ( !m_Id ) {
+        ResetId();
+    }
+    return (*m_Id);
+}
+
+inline
+bool CSeqEdit_Cmd_AttachAnnot_Base::IsSetAnnot(void) const
+{
+    return m_Annot.NotEmpty();
+}
+
+inline
+bool CSeqEdit_Cmd_AttachAnnot_Base::CanGetAnnot(void) const
+{
+    return true;
+}
+
+inline
+const CSeqEdit_Cmd_AttachAnnot_Base::TAnnot& CSeqEdit_Cmd_AttachAnnot_Base::GetAnnot(void) const
+{
+    if ( !m_Annot ) {
+        const_cast<CSeqEdit_Cmd_AttachAnnot_Base*>(this)->ResetAnnot();
+    }
+    return (*m_Annot);
+}
+
+inline
+CSeqEdit_Cmd_AttachAnnot_Base::TAnnot& CSeqEdit_Cmd_AttachAnnot_Base::SetAnnot(void)
+{
+    if ( !m_Annot ) {
+        ResetAnnot();
+    }
+    return (*m_Annot);
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_SEQEDIT_SEQEDIT_CMD_ATTACHANNOT_BASE_HPP
@@ -0,0 +1,28 @@
+#include <objects/seqsplit/ID2S_Bioseq_Ids.hpp>
+#include <objects/seqsplit/ID2S_Bioseq_Info.hpp>
+#include <objects/seqsplit/ID2S_Bioseq_place_Info.hpp>
+#include <objects/seqsplit/ID2S_Bioseq_set_Ids.hpp>
+#include <objects/seqsplit/ID2S_Bioseqs_Info.hpp>
+#include <objects/seqsplit/ID2S_Chunk.hpp>
+#include <objects/seqsplit/ID2S_Chunk_Content.hpp>
+#include <objects/seqsplit/ID2S_Chunk_Data.hpp>
+#include <objects/seqsplit/ID2S_Chunk_Id.hpp>
+#include <objects/seqsplit/ID2S_Chunk_Info.hpp>
+#include <objects/seqsplit/ID2S_Feat_type_Info.hpp>
+#include <objects/seqsplit/ID2S_Gi_Interval.hpp>
+#include <objects/seqsplit/ID2S_Gi_Ints.hpp>
+#include <objects/seqsplit/ID2S_Gi_Range.hpp>
+#include <objects/seqsplit/ID2S_Interval.hpp>
+#include <objects/seqsplit/ID2S_Seq_annot_Info.hpp>
+#include <objects/seqsplit/ID2S_Seq_annot_place_Info.hpp>
+#include <objects/seqsplit/ID2S_Seq_assembly_Info.hpp>
+#include <objects/seqsplit/ID2S_Seq_data_Info.hpp>
+#include <objects/seqsplit/ID2S_Seq_descr_Info.hpp>
+#include <objects/seqsplit/ID2S_Seq_feat_Ids_Info.hpp>
+#include <objects/seqsplit/ID2S_Seq_id_Interval.hpp>
+#include <objects/seqsplit/ID2S_Seq_id_Ints.hpp>
+#include <objects/seqsplit/ID2S_Seq_loc.hpp>
+#include <objects/seqsplit/ID2S_Seq_map_Info.hpp>
+#include <objects/seqsplit/ID2S_Sequence_Piece.hpp>
+#include <objects/seqsplit/ID2S_Split_Info.hpp>
+#include <objects/seqsplit/NCBI_Seq_split_module.hpp>
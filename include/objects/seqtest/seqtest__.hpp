@@ -0,0 +1,4 @@
+#include <objects/seqtest/SeqTestResults.hpp>
+#include <objects/seqtest/Seq_test_result.hpp>
+#include <objects/seqtest/Seq_test_result_set.hpp>
+#include <objects/seqtest/NCBI_SeqTest_module.hpp>
@@ -0,0 +1,4 @@
+#include <objects/submit/Contact_info.hpp>
+#include <objects/submit/Seq_submit.hpp>
+#include <objects/submit/Submit_block.hpp>
+#include <objects/submit/NCBI_Submit_module.hpp>
@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Taxon1_resp.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'taxon1.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Taxon1_resp_.hpp
+
+
+#ifndef OBJECTS_TAXON1_TAXON1_RESP_HPP
+#define OBJECTS_TAXON1_TAXON1_RESP_HPP
+
+
+// generated includes
+#include <objects/taxon1/Taxon1_resp_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_TAXON1_EXPORT CTaxon1_resp : public CTaxon1_resp_Base
+{
+    typedef CTaxon1_resp_Base Tparent;
+public:
+    // constructor
+    CTaxon1_resp(void);
+    // destructor
+    ~CTaxon1_resp(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CTaxon1_resp(const CTaxon1_resp& value);
+    CTaxon1_resp& operator=(const CTaxon1_resp& value);
+
+};
+
+/////////////////// CTaxon1_resp inline methods
+
+// constructor
+inline
+CTaxon1_resp::CTaxon1_resp(void)
+{
+}
+
+
+/////////////////// end of CTaxon1_resp inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_TAXON1_TAXON1_RESP_HPP
+/* Original file checksum: lines: 86, chars: 2448, CRC32: 6814b4da */
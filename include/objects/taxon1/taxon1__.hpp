@@ -0,0 +1,8 @@
+#include <objects/taxon1/Taxon1_data.hpp>
+#include <objects/taxon1/Taxon1_error.hpp>
+#include <objects/taxon1/Taxon1_info.hpp>
+#include <objects/taxon1/Taxon1_name.hpp>
+#include <objects/taxon1/Taxon1_req.hpp>
+#include <objects/taxon1/Taxon1_resp.hpp>
+#include <objects/taxon1/Taxon2_data.hpp>
+#include <objects/taxon1/NCBI_Taxon1_module.hpp>
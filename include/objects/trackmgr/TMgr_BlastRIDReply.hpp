@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file TMgr_BlastRIDReply.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'trackmgr.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: TMgr_BlastRIDReply_.hpp
+
+
+#ifndef OBJECTS_TRACKMGR_TMGR_BLASTRIDREPLY_HPP
+#define OBJECTS_TRACKMGR_TMGR_BLASTRIDREPLY_HPP
+
+
+// generated includes
+#include <objects/trackmgr/TMgr_BlastRIDReply_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_TRACKMGR_EXPORT CTMgr_BlastRIDReply : public CTMgr_BlastRIDReply_Base
+{
+    typedef CTMgr_BlastRIDReply_Base Tparent;
+public:
+    // constructor
+    CTMgr_BlastRIDReply(void);
+    // destructor
+    ~CTMgr_BlastRIDReply(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CTMgr_BlastRIDReply(const CTMgr_BlastRIDReply& value);
+    CTMgr_BlastRIDReply& operator=(const CTMgr_BlastRIDReply& value);
+
+};
+
+/////////////////// CTMgr_BlastRIDReply inline methods
+
+// constructor
+inline
+CTMgr_BlastRIDReply::CTMgr_BlastRIDReply(void)
+{
+}
+
+
+/////////////////// end of CTMgr_BlastRIDReply inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_TRACKMGR_TMGR_BLASTRIDREPLY_HPP
+/* Original file checksum: lines: 86, chars: 2593, CRC32: e616aea */
@@ -0,0 +1,116 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file TMgr_RenameMyNCBICollectio.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'trackmgr.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: TMgr_RenameMyNCBICollectio_.hpp
+
+
+#ifndef OBJECTS_TRACKMGR_TMGR_RENAMEMYNCBICOLLECTIO_HPP
+#define OBJECTS_TRACKMGR_TMGR_RENAMEMYNCBICOLLECTIO_HPP
+
+
+// generated includes
+#include <objects/trackmgr/TMgr_RenameMyNCBICollectio_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_TRACKMGR_EXPORT CTMgr_RenameMyNCBICollectionRequest : public CTMgr_RenameMyNCBICollectionRequest_Base
+{
+    typedef CTMgr_RenameMyNCBICollectionRequest_Base Tparent;
+public:
+    // constructor
+    CTMgr_RenameMyNCBICollectionRequest(void);
+    // destructor
+    ~CTMgr_RenameMyNCBICollectionRequest(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CTMgr_RenameMyNCBICollectionRequest(const CTMgr_RenameMyNCBICollectionRequest& value);
+    CTMgr_RenameMyNCBICollectionRequest& operator=(const CTMgr_RenameMyNCBICollectionRequest& value);
+
+};
+
+/////////////////// CTMgr_RenameMyNCBICollectionRequest inline methods
+
+// constructor
+inline
+CTMgr_RenameMyNCBICollectionRequest::CTMgr_RenameMyNCBICollectionRequest(void)
+{
+}
+
+
+/////////////////// end of CTMgr_RenameMyNCBICollectionRequest inline methods
+
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_TRACKMGR_EXPORT CTMgr_RenameMyNCBICollectionReply : public CTMgr_RenameMyNCBICollectionReply_Base
+{
+    typedef CTMgr_RenameMyNCBICollectionReply_Base Tparent;
+public:
+    // constructor
+    CTMgr_RenameMyNCBICollectionReply(void);
+    // destructor
+    ~CTMgr_RenameMyNCBICollectionReply(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CTMgr_RenameMyNCBICollectionReply(const CTMgr_RenameMyNCBICollectionReply& value);
+    CTMgr_RenameMyNCBICollectionReply& operator=(const CTMgr_RenameMyNCBICollectionReply& value);
+
+};
+
+/////////////////// CTMgr_RenameMyNCBICollectionReply inline methods
+
+// constructor
+inline
+CTMgr_RenameMyNCBICollectionReply::CTMgr_RenameMyNCBICollectionReply(void)
+{
+}
+
+
+/////////////////// end of CTMgr_RenameMyNCBICollectionReply inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_TRACKMGR_TMGR_RENAMEMYNCBICOLLECTIO_HPP
+/* Original file checksum: lines: 115, chars: 3713, CRC32: 51550be2 */
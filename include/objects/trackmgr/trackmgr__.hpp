@@ -0,0 +1,63 @@
+#include <objects/trackmgr/TMgr_ACL_AccessLevel.hpp>
+#include <objects/trackmgr/TMgr_AnnotCounts.hpp>
+#include <objects/trackmgr/TMgr_AnnotType.hpp>
+#include <objects/trackmgr/TMgr_Assembly.hpp>
+#include <objects/trackmgr/TMgr_AssemblySpec.hpp>
+#include <objects/trackmgr/TMgr_AttrReply.hpp>
+#include <objects/trackmgr/TMgr_AttrRequest.hpp>
+#include <objects/trackmgr/TMgr_AttrSpec.hpp>
+#include <objects/trackmgr/TMgr_AttrValueReply.hpp>
+#include <objects/trackmgr/TMgr_Attribute.hpp>
+#include <objects/trackmgr/TMgr_BlastQuerySeq.hpp>
+#include <objects/trackmgr/TMgr_BlastRIDDetail.hpp>
+#include <objects/trackmgr/TMgr_BlastRIDReply.hpp>
+#include <objects/trackmgr/TMgr_BlastRIDRequest.hpp>
+#include <objects/trackmgr/TMgr_ClientInfo.hpp>
+#include <objects/trackmgr/TMgr_CreateTracksetReply.hpp>
+#include <objects/trackmgr/TMgr_CreateTracksetRequest.hpp>
+#include <objects/trackmgr/TMgr_CreateUserDataItem.hpp>
+#include <objects/trackmgr/TMgr_CreateUserTrackReply.hpp>
+#include <objects/trackmgr/TMgr_CreateUserTrackReques.hpp>
+#include <objects/trackmgr/TMgr_DTrackId.hpp>
+#include <objects/trackmgr/TMgr_DatasetItem.hpp>
+#include <objects/trackmgr/TMgr_DatasetItemSeq.hpp>
+#include <objects/trackmgr/TMgr_DisplayTrack.hpp>
+#include <objects/trackmgr/TMgr_DisplayTrackChoice.hpp>
+#include <objects/trackmgr/TMgr_DisplayTrackReply.hpp>
+#include <objects/trackmgr/TMgr_DisplayTrackRequest.hpp>
+#include <objects/trackmgr/TMgr_GenomeContext.hpp>
+#include <objects/trackmgr/TMgr_Identity.hpp>
+#include <objects/trackmgr/TMgr_IdentityId.hpp>
+#include <objects/trackmgr/TMgr_IdentityIdType.hpp>
+#include <objects/trackmgr/TMgr_ItemResolverReply.hpp>
+#include <objects/trackmgr/TMgr_ItemResolverRequest.hpp>
+#include <objects/trackmgr/TMgr_LengthStats.hpp>
+#include <objects/trackmgr/TMgr_Message.hpp>
+#include <objects/trackmgr/TMgr_MessageLevel.hpp>
+#include <objects/trackmgr/TMgr_PositionStats.hpp>
+#include <objects/trackmgr/TMgr_RemoveUserTrackReply.hpp>
+#include <objects/trackmgr/TMgr_RemoveUserTrackReques.hpp>
+#include <objects/trackmgr/TMgr_RenameMyNCBICollectio.hpp>
+#include <objects/trackmgr/TMgr_Reply.hpp>
+#include <objects/trackmgr/TMgr_Request.hpp>
+#include <objects/trackmgr/TMgr_RetrieveTracksetReply.hpp>
+#include <objects/trackmgr/TMgr_RetrieveTracksetReque.hpp>
+#include <objects/trackmgr/TMgr_SeqTrackIdReply.hpp>
+#include <objects/trackmgr/TMgr_SeqTrackIdRequest.hpp>
+#include <objects/trackmgr/TMgr_Status.hpp>
+#include <objects/trackmgr/TMgr_SupportedAssembliesRe.hpp>
+#include <objects/trackmgr/TMgr_SwitchTrackContextRep.hpp>
+#include <objects/trackmgr/TMgr_SwitchTrackContextReq.hpp>
+#include <objects/trackmgr/TMgr_SwitchTrackException.hpp>
+#include <objects/trackmgr/TMgr_SwitchTrackExceptionC.hpp>
+#include <objects/trackmgr/TMgr_TrackACL_Authorizatio.hpp>
+#include <objects/trackmgr/TMgr_TrackACL_Permission.hpp>
+#include <objects/trackmgr/TMgr_TrackAttrValueReply.hpp>
+#include <objects/trackmgr/TMgr_TrackAttrValueRequest.hpp>
+#include <objects/trackmgr/TMgr_TrackAttributes.hpp>
+#include <objects/trackmgr/TMgr_TrackItems.hpp>
+#include <objects/trackmgr/TMgr_TrackSet.hpp>
+#include <objects/trackmgr/TMgr_TrackSetType.hpp>
+#include <objects/trackmgr/TMgr_TypeStat.hpp>
+#include <objects/trackmgr/TMgr_ValueRequest.hpp>
+#include <objects/trackmgr/NCBI_TrackManager_module.hpp>
@@ -0,0 +1,3 @@
+#include <objects/valerr/ValidErrItem.hpp>
+#include <objects/valerr/ValidError.hpp>
+#include <objects/valerr/NCBI_ValErrors_module.hpp>
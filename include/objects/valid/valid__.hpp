@@ -0,0 +1,9 @@
+#include <objects/valid/Comment_rule.hpp>
+#include <objects/valid/Comment_set.hpp>
+#include <objects/valid/Dependent_field_rule.hpp>
+#include <objects/valid/Dependent_field_set.hpp>
+#include <objects/valid/Field_rule.hpp>
+#include <objects/valid/Field_set.hpp>
+#include <objects/valid/Phrase_list.hpp>
+#include <objects/valid/Severity_level.hpp>
+#include <objects/valid/NCBI_Structured_comment_validation_module.hpp>
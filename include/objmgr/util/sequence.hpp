@@ -827,6 +827,16 @@ public:
     void    SetGapMode (EGapMode mode) { m_GapMode = mode; }
     EGapMode GetGapMode(void) const    { return m_GapMode; }
 
+    /// Number of threads formatting the sequences written by
+    /// Write(const CSeq_entry_Handle&, ...); 1 (the default) formats them
+    /// on the calling thread.  The records are written in the usual order
+    /// and titles are still produced on the calling thread via WriteTitle,
+    /// but overrides of Write(const CBioseq_Handle&, ...) and WriteSequence
+    /// are bypassed when more than one thread is used.
+    unsigned int GetThreads(void) const { return m_Threads; }
+    void    SetThreads (unsigned int threads)
+    { m_Threads = (threads > 0 ? threads : 1); }
+
     /// This indicates the text of the modifiers of a gap.
     struct NCBI_XOBJUTIL_EXPORT SGapModText {
         /// String representing the gap type.
@@ -875,6 +885,7 @@ private:
     TFlags              m_Flags;
     EGapMode            m_GapMode;
     TSeq_id_HandleSet   m_PreviousWholeIds;
+    unsigned int        m_Threads;
     // avoid recomputing for every sequence
     typedef AutoPtr<char, ArrayDeleter<char> > TCharBuf;
     TCharBuf            m_Dashes, m_LC_Ns, m_LC_Xs, m_UC_Ns, m_UC_Xs;
@@ -897,6 +908,24 @@ private:
 
     void x_WriteSequence(const CSeqVector& vec,
                          const TMSMap& masking_state);
+
+    /// Sets up the sequence vector and the masking states for
+    /// WriteSequence; returns false if there is nothing to write.
+    bool x_GetSequence(const CBioseq_Handle& handle,
+                       const CSeq_loc* location,
+                       CSeq_loc::EOpFlags merge_flags,
+                       CSeqVector& vec,
+                       TMSMap& masking_state);
+    /// Appends the formatted sequence to the buffer; if out is given,
+    /// the buffer is written to it whenever it grows large.
+    void x_FormatSequence(const CSeqVector& vec,
+                          const TMSMap& masking_state,
+                          string& buffer,
+                          CNcbiOstream* out);
+    void x_WriteParallel(const CSeq_entry_Handle& handle,
+                         const CSeq_loc* location);
+
+    friend class CFastaFormatThread;
 };
 
 
@@ -340,6 +340,31 @@ public:
         sm_MmapStrategy_Sequence = strategy;
     }
 
+    /// Choose whether sequence and header files are advised according
+    /// to the detected OID access order (the default).
+    static void SetMmapAdaptive_Sequence(bool adaptive)
+    {
+        sm_MmapAdaptive_Sequence = adaptive;
+    }
+
+    /// Get the mmap strategy for index files
+    static EMemoryAdvise GetMmapStrategy_Index()
+    {
+        return sm_MmapStrategy_Index;
+    }
+
+    /// Get the mmap strategy for sequence files
+    static EMemoryAdvise GetMmapStrategy_Sequence()
+    {
+        return sm_MmapStrategy_Sequence;
+    }
+
+    /// Are sequence and header files advised adaptively?
+    static bool GetMmapAdaptive_Sequence()
+    {
+        return sm_MmapAdaptive_Sequence;
+    }
+
     /// Destructor
     ///
     /// Frees or unmaps any memory associated with this region.
@@ -535,6 +560,9 @@ private:
 
     /// Sequence file mmap strategy.
     static EMemoryAdvise sm_MmapStrategy_Sequence;
+
+    /// Sequence file advice follows the OID access order.
+    static bool sm_MmapAdaptive_Sequence;
 };
 
 
@@ -676,6 +704,12 @@ public:
         m_SliceSize = min(m_SliceSize, size);
     }
 
+    /// Return true if OIDs seem to be accessed in sequential order.
+    bool InOrder() const
+    {
+        return m_InOrder;
+    }
+
     /// Return the total memory bound.
     ///
     /// This returns the active memory bound.  If SeqDB is done
@@ -1314,6 +1348,48 @@ public:
     }    
 
     int GetOpenedFilseCount(void) { return m_OpenedFilesCount;}
+
+    /// Return true if OIDs seem to be accessed in sequential order.
+    ///
+    /// This is read without the atlas lock; it is only used to choose
+    /// access hints for mapped files.
+    bool IsSequential() const
+    {
+        return m_Strategy.InOrder();
+    }
+
+    /// Should newly mapped sequence and header files be paged in?
+    ///
+    /// This is enabled with the SEQDB_PRELOAD entry of the [BLAST]
+    /// section of the configuration file (or the equivalent
+    /// NCBI_CONFIG__BLAST__SEQDB_PRELOAD environment variable), or by
+    /// selecting the "will need" strategy for sequence files.
+    bool GetPreload() const
+    {
+        return m_Preload;
+    }
+
+    /// Account for a newly mapped file.
+    /// @param bytes Length of the mapping.
+    /// @param preload Bytes requested to be paged in.
+    /// @param seconds Time spent mapping and advising.
+    void MentionMapped(Int8 bytes, Int8 preload, double seconds);
+
+    /// Account for an unmapped file.
+    /// @param bytes Length of the mapping.
+    void MentionUnmapped(Int8 bytes);
+
+    /// Account for an explicit read-ahead request.
+    /// @param bytes Length of the area requested.
+    /// @param seconds Time spent issuing the request.
+    void MentionReadAhead(Int8 bytes, double seconds);
+
+    /// Account for a mapping re-advised after an access order change.
+    void MentionAdviceChange();
+
+    /// Get memory mapping statistics.
+    /// @param stats The statistics are returned here. [out]
+    void GetMmapStats(SSeqDBMmapStats & stats);
     
 private:
     /// Private method to prevent copy construction.
@@ -1441,6 +1517,19 @@ private:
     map< string, CMemoryFile* > m_FileMemMap;    
     int m_OpenedFilesCount;
     int m_MaxOpenedFilesCount;
+
+    /// Page in sequence and header files when they are mapped.
+    bool m_Preload;
+
+    /// Protects the mapping statistics.
+    CFastMutex m_StatsLock;
+
+    /// Memory mapping statistics.
+    SSeqDBMmapStats m_MmapStats;
+
+    /// Process page fault counts when the atlas was created.
+    Int8 m_MajorFaultsBase;
+    Int8 m_MinorFaultsBase;
 };
 
 
@@ -1528,7 +1617,11 @@ public:
         : m_Atlas(atlas),
           m_DataPtr (NULL),
           m_MappedFile( NULL),
-          m_Mapped(false)
+          m_Mapped(false),
+          m_Adaptive(false),
+          m_Sequential(false),
+          m_ReadAheadMark(0),
+          m_ReadAheadEnd(0)
     {
         Init(filename);
     }
@@ -1537,7 +1630,11 @@ public:
         : m_Atlas(atlas),
           m_DataPtr (NULL),
           m_MappedFile( NULL),
-          m_Mapped(false)
+          m_Mapped(false),
+          m_Adaptive(false),
+          m_Sequential(false),
+          m_ReadAheadMark(0),
+          m_ReadAheadEnd(0)
     {
         
     }
@@ -1563,6 +1660,11 @@ public:
     //m_Filename is set
     void Init(void) {                    
             
+            {{
+                CFastMutexGuard guard(m_HintLock);
+                m_Adaptive = m_Sequential = false;
+                m_ReadAheadMark = m_ReadAheadEnd = 0;
+            }}
             map <string, CMemoryFile* > &fileMemMap = m_Atlas.GetFilesMemMap();
             if(IsIndexFile() && fileMemMap.count(m_Filename) > 0) {        
                 m_MappedFile = fileMemMap[m_Filename];
@@ -1571,6 +1673,7 @@ public:
             }
             else {
                 try {
+                    CStopWatch sw(CStopWatch::eStart);
                     m_MappedFile = new CMemoryFile(m_Filename);
 		    m_Atlas.ChangeOpenedFilseCount(true);
                     //int openedFilesCount = m_Atlas.ChangeOpenedFilseCount(true);
@@ -1578,6 +1681,7 @@ public:
                         fileMemMap.insert(map<string, CMemoryFile * >::value_type(m_Filename,m_MappedFile));
                     }
                     m_Mapped = true;
+                    x_AdviseMapping(sw.Elapsed());
                     //int threadID = CThread::GetSelf();            
                     //cerr << "********Map             CMemoryFile:" << m_Filename << " openedFilesCount=" << openedFilesCount << " threadID=" << threadID << endl;
                 }
@@ -1599,6 +1703,7 @@ public:
     {
         
         if(m_MappedFile && m_Mapped && !IsIndexFile()) { 
+                m_Atlas.MentionUnmapped(m_MappedFile->GetSize());
                 m_MappedFile->Unmap();
 		m_Atlas.ChangeOpenedFilseCount(false);
                 //int threadID = CThread::GetSelf();            
@@ -1607,6 +1712,9 @@ public:
                 delete m_MappedFile;
                 m_MappedFile = NULL;
                 m_Mapped = false;
+
+                CFastMutexGuard guard(m_HintLock);
+                m_Adaptive = m_Sequential = false;
         }        
     }
 
@@ -1620,6 +1728,7 @@ public:
         for (map<string, CMemoryFile *>::iterator it=fileMemMap.begin(); it!=fileMemMap.end(); ++it) {
             string filename = it->first;
             if(NStr::Find(filename,".pin") != NPOS ||  NStr::Find(filename,".nin") != NPOS){                
+                m_Atlas.MentionUnmapped(it->second->GetSize());
                 it->second->Unmap();
                 //cerr << "********Cleaning:Unmap CMemoryFile:" << filename << endl;                
                 delete it->second;
@@ -1660,7 +1769,65 @@ public:
         return isIndex;
     }
 
+    /// Is this a sequence (.psq/.nsq) or header (.phr/.nhr) file?
+    ///
+    /// These files are laid out in OID order, so their access pattern
+    /// follows the order in which the client visits OIDs.
+    bool IsOidOrderedFile() const
+    {
+        size_t len = m_Filename.size();
+        return len > 4 && m_Filename[len-4] == '.' &&
+            (NStr::EndsWith(m_Filename, "sq") ||
+             NStr::EndsWith(m_Filename, "hr"));
+    }
+
+    /// Report an access to the given offset of the mapped file.
+    ///
+    /// If the atlas has changed its opinion of the OID access order
+    /// since this file was advised, the access hint is re-applied.
+    /// During sequential access, an explicit read-ahead request is
+    /// kept about one window in front of the reader.  This is cheap
+    /// for the common case and does nothing for files which are not
+    /// OID ordered.  Readers of the same file may call this from
+    /// several threads; if another thread is updating the hints, this
+    /// access is not reported, since the hints are only advisory.
+    ///
+    /// @param offset
+    ///   The offset about to be read.
+    void MentionAccess(TIndx offset)
+    {
+        if ( !m_HintLock.TryLock() ) {
+            return;
+        }
+        if (m_Adaptive && m_Sequential != m_Atlas.IsSequential()) {
+            x_AdviseAccess(true);
+        }
+        if (m_Sequential && offset >= m_ReadAheadMark) {
+            x_ReadAhead(offset);
+        }
+        m_HintLock.Unlock();
+    }
+
 private:
+    /// Size of the explicit read-ahead window for sequential access.
+    enum {
+        eReadAheadWindow = 8 << 20
+    };
+
+    /// Apply the configured access hints to a newly mapped file.
+    /// @param map_seconds Time taken to map the file.
+    void x_AdviseMapping(double map_seconds);
+
+    /// Advise the kernel of sequential or random access.
+    /// This method assumes m_HintLock is held.
+    /// @param changed True if this replaces earlier advice.
+    void x_AdviseAccess(bool changed);
+
+    /// Request that the window following offset be paged in.
+    /// This method assumes m_HintLock is held.
+    /// @param offset The offset about to be read.
+    void x_ReadAhead(TIndx offset);
+
     CSeqDBAtlas & m_Atlas;    
      /// Points to the beginning of the data area.
     const char * m_DataPtr;
@@ -1670,6 +1837,21 @@ private:
     CMemoryFile *m_MappedFile;
 
     bool m_Mapped;
+
+    /// True if the access hint follows the atlas OID order detection.
+    bool m_Adaptive;
+
+    /// True if the mapping is currently advised as sequential.
+    bool m_Sequential;
+
+    /// Accesses at or past this offset trigger the next read-ahead.
+    TIndx m_ReadAheadMark;
+
+    /// End of the area covered by read-ahead requests so far.
+    TIndx m_ReadAheadEnd;
+
+    /// Protects the access hint state above.
+    CFastMutex m_HintLock;
 };
 
 
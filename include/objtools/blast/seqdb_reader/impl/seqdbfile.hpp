@@ -789,6 +789,7 @@ public:
                    TIndx   start,
                    TIndx   end) const
     {
+        m_Lease.MentionAccess(start);
         x_ReadBytes(buf, start, end);
     }
     
@@ -814,6 +815,7 @@ public:
     ///     A pointer into the file data.
     const char * GetFileDataPtr(TIndx            start) const // commented                           
     {
+        m_Lease.MentionAccess(start);
         const char *p = (const char *)m_Lease.GetFileDataPtr(start);
         
         return p;        
@@ -878,6 +880,7 @@ public:
                    TIndx   start,
                    TIndx   end) const
     {
+        m_Lease.MentionAccess(start);
         x_ReadBytes(buf, start, end);
     }
     
@@ -902,6 +905,7 @@ public:
         // Header data never requires the 'hold' option because asn.1
         // processing is done immediately.
         
+        m_Lease.MentionAccess(start);
         const char *p = (const char *)m_Lease.GetFileDataPtr(start);
         return p;
     }
@@ -1198,9 +1198,54 @@ private:
                                 string       & index_name,
                                 string       & data_name);
 
+    /// Validate the lookup table for a string index.
+    ///
+    /// The lookup table ([np]sl file) is optional.  If it exists and
+    /// matches the ISAM data file, m_LookupBuckets is set and string
+    /// searches will use it; otherwise the ISAM search is used.
+    void x_InitLookup();
+
+    /// Find the lookup table bucket for a key.
+    ///
+    /// This probes the lookup table for the given (lowercase) key.
+    /// Fingerprint matches are verified against the ISAM data file.
+    ///
+    /// @param key The key to search for, folded to lowercase. [in]
+    /// @param hash The key hash from SeqDB_IsamKeyHash(). [in]
+    /// @return A pointer to the bucket, or NULL if not found.
+    const Uint4 * x_LookupBucket(const string & key, Uint8 hash);
+
+    /// Search the lookup table for a string key.
+    ///
+    /// This is the lookup table equivalent of x_StringSearch(); all
+    /// records with a key equal to term_in are returned.
+    ///
+    /// @param term_in The key string to search for. [in]
+    /// @param term_out The key of each match. [out]
+    /// @param value_out The value of each match. [out]
+    /// @param index_out The index of each match. [out]
+    /// @return eNoError if the key was found, otherwise eNotFound.
+    EErrorCode
+    x_LookupStringSearch(const string   & term_in,
+                         vector<string> & term_out,
+                         vector<string> & value_out,
+                         vector<TIndx>  & index_out);
+
+    /// Translate a Seq-id list using the lookup table.
+    ///
+    /// The buckets for all untranslated keys are visited in table
+    /// order, with each bucket prefetched several keys ahead of its
+    /// probe, so that a large list costs about one cache miss per key
+    /// rather than a walk over every data page of the volume.
+    ///
+    /// @param vol_start The starting OID of this volume. [in]
+    /// @param ids The list of Seq-ids to translate. [in|out]
+    void x_TranslateSiListLookup(int vol_start, CSeqDBGiList & ids);
+
     void x_InitLease(void) {
         if(!m_IndexLease.IsMapped()) m_IndexLease.Init();
         if(!m_DataLease.IsMapped()) m_DataLease.Init();
+        if(m_LookupBuckets && !m_LookupLease.IsMapped()) m_LookupLease.Init();
     }
 
     // Data
@@ -1218,6 +1263,9 @@ private:
     /// A persistent lease on the ISAM data file.
     CSeqDBFileMemMap m_DataLease;
     
+    /// A persistent lease on the lookup table file (if used).
+    CSeqDBFileMemMap m_LookupLease;
+
 
     /// The format type of database files found (eNumeric or eString).
     int m_Type;
@@ -1228,6 +1276,9 @@ private:
     /// The filename of the ISAM index file.
     string m_IndexFname;
 
+    /// The filename of the lookup table file.
+    string m_LookupFname;
+
     /// The length of the ISAM data file.
     TIndx m_DataFileLength;
 
@@ -1279,6 +1330,9 @@ private:
     /// size of the numeric key-data pair
     int m_TermSize;
 
+    /// Number of lookup table buckets, or zero if there is no table.
+    Uint4 m_LookupBuckets;
+
     Uint8 x_GetNumericKey(const void *p) {
         if (m_LongId)
             return((Uint8) SeqDB_GetStdOrd((Uint8 *)p));
@@ -207,7 +207,12 @@ public:
         eMmap_Sequential,
 
         /// Expect access in the near future.
-        eMmap_WillNeed
+        eMmap_WillNeed,
+
+        /// Follow the detected OID access order: sequential access is
+        /// advised as such and read ahead explicitly, random access is
+        /// advised as random.  This is the default for sequence files.
+        eMmap_Adaptive
     };
 
     /// Sequence type accepted and returned for OID indices.
@@ -451,8 +456,10 @@ public:
 
     /// Sets mmap strategy to be used when mapping index or sequence files.
     ///
-    /// This method sets internal flags of type EMemoryAdvise for a call to
-    /// MemoryAdvise in CRegionMap::MapMmap.
+    /// This method sets internal flags of type EMemoryAdvise which are
+    /// passed to MemoryAdvise when the files are mapped.  The sequence
+    /// file strategy also applies to header files.  The adaptive
+    /// strategy is only meaningful for sequence files.
     /// Note that these are only hints, the system may or may not
     /// actually alter its behavior when mapping these files.
     static void SetMmapStrategy(
@@ -1469,6 +1476,14 @@ public:
     /// Retrieve the disk usage in bytes for this BLAST database
     Int8 GetDiskUsage() const;
 
+    /// Retrieve memory mapping statistics
+    ///
+    /// The memory layer is shared by all CSeqDB objects in the
+    /// process, so these statistics are not specific to this object.
+    ///
+    /// @param stats The statistics are returned here. [out]
+    void GetMmapStats(SSeqDBMmapStats & stats) const;
+
     /// Set the membership of all volumes
     void SetVolsMemBit(int mbit);
 
@@ -1597,6 +1597,68 @@ struct SSeqDBTaxInfo {
 };
 
 
+/// SSeqDBMmapStats
+///
+/// This structure contains memory mapping statistics for the SeqDB
+/// memory layer.  That layer is shared by all CSeqDB objects in a
+/// process, so the counts cover every database opened since the
+/// oldest live CSeqDB object was constructed.
+
+struct SSeqDBMmapStats {
+    /// Default constructor
+    SSeqDBMmapStats()
+        : files_mapped      (0),
+          bytes_mapped      (0),
+          peak_bytes_mapped (0),
+          preload_bytes     (0),
+          readahead_requests(0),
+          readahead_bytes   (0),
+          advice_changes    (0),
+          major_faults      (-1),
+          minor_faults      (-1),
+          map_seconds       (0.0),
+          sequential        (true)
+    {
+    }
+
+    /// Number of files memory mapped so far.
+    Int8 files_mapped;
+
+    /// Number of bytes currently mapped.
+    Int8 bytes_mapped;
+
+    /// Largest number of bytes mapped at once.
+    Int8 peak_bytes_mapped;
+
+    /// Bytes requested to be paged in as files were mapped.
+    Int8 preload_bytes;
+
+    /// Number of explicit read-ahead requests issued.
+    Int8 readahead_requests;
+
+    /// Bytes covered by explicit read-ahead requests.
+    Int8 readahead_bytes;
+
+    /// Number of times a mapping was re-advised because the OID
+    /// access order changed between sequential and random.
+    Int8 advice_changes;
+
+    /// Major page faults taken by the process since the memory layer
+    /// was created, or -1 if this is not available on this platform.
+    Int8 major_faults;
+
+    /// Minor page faults taken by the process since the memory layer
+    /// was created, or -1 if this is not available on this platform.
+    Int8 minor_faults;
+
+    /// Seconds spent mapping files and issuing page-in requests.
+    double map_seconds;
+
+    /// True if OIDs are currently thought to be accessed in order.
+    bool sequential;
+};
+
+
 /// Resolve a file path using SeqDB's path algorithms.
 ///
 /// This finds a file using the same algorithm used by SeqDB to find
@@ -1673,6 +1735,21 @@ unsigned SeqDB_SequenceHash(const char * sequence,
 NCBI_XOBJREAD_EXPORT
 unsigned SeqDB_SequenceHash(const CBioseq & sequence);
 
+/// String ISAM Key Hashing
+///
+/// This computes the 64 bit hash used by the accession lookup table
+/// ([np]sl files) that may accompany a string ISAM index.  WriteDB
+/// uses it to build the table and SeqDB uses it to probe the table,
+/// so the algorithm (64 bit FNV-1a) must never change for a given
+/// lookup table format version.  The key should already be folded to
+/// lowercase, as it is in the ISAM data file.
+///
+/// @param key A pointer to the key string. [in]
+/// @param length The length of the key in bytes. [in]
+/// @return The 64 bit hash value.
+NCBI_XOBJREAD_EXPORT
+Uint8 SeqDB_IsamKeyHash(const char * key, size_t length);
+
 /// Various identifier formats used in Id lookup
 enum ESeqDBIdType {
     eGiId,     /// Genomic ID is a relatively stable numeric identifier for sequences.
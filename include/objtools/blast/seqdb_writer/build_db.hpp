@@ -389,6 +389,16 @@ public:
     /// @param max_file_size Maximum file size in bytes.
     void SetMaxFileSize(Uint8 max_file_size);
 
+    /// Set the number of threads used to build the database.
+    ///
+    /// With more than one thread, FASTA input is parsed on a separate
+    /// thread ahead of the sequences being written, and full volumes
+    /// are finalized in the background (see CWriteDB::SetNumThreads).
+    /// The database produced is the same as with a single thread.
+    ///
+    /// @param num_threads Number of threads to use.
+    void SetNumThreads(int num_threads);
+
     /// Define a masking algorithm.
     ///
     /// The returned integer ID will be defined as corresponding to the
@@ -634,6 +644,9 @@ private:
     /// masking locations (via SetMaskDataSource). Used to display a warning in
     /// case this didn't happen
     bool m_FoundMatchingMasks;
+
+    /// Number of threads used to build the database.
+    int m_NumThreads;
 };
 
 END_NCBI_SCOPE
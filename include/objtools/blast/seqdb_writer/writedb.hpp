@@ -122,7 +122,10 @@ public:
         // Specialized ISAMs; these can be ORred into the above.
 
         /// Add an index from sequence hash to OID.
-        eAddHash = 0x100
+        eAddHash = 0x100,
+
+        /// Add a hashed lookup table for the string (accession) index.
+        eAddAccLookup = 0x200
     };
     typedef int TIndexType; ///< Bitwise OR of "EIndexType"
 
@@ -341,6 +344,17 @@ public:
     /// @param letters Maximum letters to pack in one volume. [in]
     void SetMaxVolumeLetters(Uint8 letters);
 
+    /// Set the number of threads used to finalize volumes.
+    ///
+    /// With more than one thread, a full volume is closed (its ISAM
+    /// indices sorted and written) in the background while sequences
+    /// are added to the next one, and the component files of a volume
+    /// are finalized concurrently.  The files produced are the same as
+    /// with a single thread.  The default is one thread.
+    ///
+    /// @param num_threads Number of threads to use. [in]
+    void SetNumThreads(int num_threads);
+
     /// Extract Deflines From Bioseq.
     ///
     /// Deflines are extracted from the CBioseq and returned to the
@@ -69,6 +69,9 @@ enum EWriteDBIsamType {
 /// Forward definition for CWriteDB_IsamData class.
 class CWriteDB_IsamData;
 
+/// Forward definition for CWriteDB_IsamLookup class.
+class CWriteDB_IsamLookup;
+
 /// CWriteDB_IsamIndex class
 /// 
 /// Manufacture an isam index file from sequence IDs.
@@ -152,6 +155,14 @@ public:
     /// @return True if no sequences were added.
     bool Empty() const;
     
+    /// Attach a lookup table file to a string index.
+    ///
+    /// If set, the first data file record of each distinct key is
+    /// also reported to this file when the string index is flushed.
+    ///
+    /// @param lookup The lookup table file. [in]
+    void SetLookupFile(CRef<CWriteDB_IsamLookup> lookup);
+    
 private:
     enum {
         eKeyOffset       = 9*4,  ///< Offset of the key offset table.
@@ -354,6 +365,9 @@ private:
     
     /// The data file associated with this index file.
     CRef<CWriteDB_IsamData> m_DataFile;
+    
+    /// The lookup table file for string keys (optional).
+    CRef<CWriteDB_IsamLookup> m_LookupFile;
 
     /// OID being to which seqid strings are being added
     int                     m_Oid;  
@@ -392,6 +406,62 @@ private:
     void x_Flush();
 };
 
+/// CWriteDB_IsamLookup class
+/// 
+/// This manufactures the hashed lookup table that may accompany a
+/// string ISAM index.  The table maps each distinct key directly to
+/// its first record in the ISAM data file, so that SeqDB can resolve
+/// an accession without searching the index samples and data pages.
+
+class NCBI_XOBJWRITE_EXPORT CWriteDB_IsamLookup : public CWriteDB_File {
+public:
+    /// Constructor for an ISAM lookup table file.
+    ///
+    /// @param dbname  Database name (same for all volumes). [in]
+    /// @param protein True for protein, false for nucleotide. [in]
+    /// @param index   Index of the associated volume. [in]
+    CWriteDB_IsamLookup(const string & dbname,
+                        bool           protein,
+                        int            index);
+    
+    /// Destructor.
+    ~CWriteDB_IsamLookup();
+    
+    /// Add a key to the lookup table.
+    ///
+    /// Keys must be added in data file order, once per distinct key,
+    /// using the position of the first record of that key.
+    ///
+    /// @param key         Key string, folded to lowercase. [in]
+    /// @param data_offset Offset of the first record in the data file. [in]
+    /// @param term_num    Index of the first record in the data file. [in]
+    void AddKey(const CTempString & key, int data_offset, int term_num);
+    
+    /// Set the final length of the associated data file.
+    /// @param length Length of the ISAM data file in bytes. [in]
+    void SetDataFileLength(int length)
+    {
+        m_DataFileLength = length;
+    }
+    
+private:
+    /// Build the hash table and write it to disk.
+    void x_Flush();
+    
+    /// Hash value and data file position of one distinct key.
+    struct SLookupKey {
+        Uint8 hash;   ///< Key hash from SeqDB_IsamKeyHash().
+        Uint4 offset; ///< Data file offset of the first record.
+        Uint4 term;   ///< Index of the first record.
+    };
+    
+    /// Keys added since the last flush.
+    vector<SLookupKey> m_Keys;
+    
+    /// Length of the associated data file.
+    int m_DataFileLength;
+};
+
 
 /// CWriteDB_Isam class
 /// 
@@ -415,12 +485,14 @@ public:
     /// @param index         Index of the associated volume. [in]
     /// @param max_file_size Maximum size of any generated file in bytes. [in]
     /// @param sparse        Set to true if sparse mode should be used. [in]
+    /// @param lookup        Also build a lookup table (string only). [in]
     CWriteDB_Isam(EIsamType      itype,
                   const string & dbname,
                   bool           protein,
                   int            index,
                   Uint8          max_file_size,
-                  bool           sparse);
+                  bool           sparse,
+                  bool           lookup = false);
     
     /// Destructor.
     ~CWriteDB_Isam();
@@ -500,6 +572,9 @@ private:
     
     /// Data file, contains one record for each key/oid pair.
     CRef<CWriteDB_IsamData> m_DFile;
+    
+    /// Lookup table file, maps each key to its first data record.
+    CRef<CWriteDB_IsamLookup> m_LFile;
 };
 
 END_NCBI_SCOPE
@@ -39,6 +39,9 @@
 #include <objects/pub/Pub.hpp>
 #include <objects/seqfeat/Cdregion.hpp>
 
+#include <util/limited_size_map.hpp>
+#include <util/section_times.hpp>
+
 
 BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(objects)
@@ -70,7 +73,14 @@ public:
         eClean_NoNcbiUserObjects = 0x4,
         eClean_SyncGenCodes      = 0x8,
         eClean_NoProteinTitles   = 0x10,
-        eClean_KeepTopSet        = 0x20
+        eClean_KeepTopSet        = 0x20,
+        /// Do not walk again the parts of a Seq-entry or Seq-submit that
+        /// this CCleanup has already cleaned with the same options and
+        /// that have not changed since: the top-level entries or, for
+        /// sets of independent records (genbank, pop-set, phy-set,
+        /// mut-set, eco-set, wgs-set), their members one by one.  The
+        /// passes that work on the whole record still run.
+        eClean_SkipUnchanged     = 0x40
     };
 
     enum EScopeOptions {
@@ -502,13 +512,35 @@ public:
 /// @return bool indicates changes were made
     static bool ParseCodeBreaks(CSeq_feat& feat, CScope& scope);
 
+    // per-rule-family timing
+    // When enabled, the time spent in the cleanup passes and in the main
+    // rule families of BasicCleanup and ExtendedCleanup is summed up over
+    // all the cleanups done in the process, from any thread.  The time of
+    // a pass does not include the families run from within it, so the
+    // times add up to the time of the cleanups.
+    typedef CSectionTimes::STime  SRuleTime;
+    typedef CSectionTimes::TTimes TRuleTimes;
+
+    static void EnableRuleTiming(bool enable = true);
+    static bool IsRuleTimingEnabled(void);
+    static void GetRuleTimes(TRuleTimes& times);
+
 private:
+    friend class CNewCleanup_imp;
+
+    static CSectionTimes& x_GetRuleTimes(void);
+
     // Prohibit copy constructor & assignment operator
     CCleanup(const CCleanup&);
     CCleanup& operator= (const CCleanup&);
 
     CRef<CScope>            m_Scope;
 
+    // Digests of the entries cleaned with eClean_SkipUnchanged, by the
+    // kind of cleanup and the label of the entry; the least recently used ones are dropped
+    typedef limited_size_map<string, string> TCleanDigests;
+    TCleanDigests           m_CleanDigests;
+
     static bool x_MergeDupOrgNames(COrgName& on1, const COrgName& add);
     static bool x_MergeDupOrgRefs(COrg_ref& org1, const COrg_ref& add);
 
@@ -53,12 +53,19 @@ class CSubCacheCreate;
 class CChunkFile;
 class CSeqIdChunkFile;
 class CBitVectorWrapper;
+class CAsnFlatIndex;
+class CMemoryFile;
 
 /// CAsnCache is used by clients to access the ASN cache data.  The ASN
 /// cache is a cache of the ID database that is designed for fast access
 /// and retrieval of CSeq_entry blobs.
 /// @note Data in the ASN cache can also be accessed via the object manager
 /// and the ASN cache data loader, CAsnCache_DataLoader.
+/// @note If the cache has up-to-date flat indices (see CAsnFlatIndex,
+/// written by prime_cache -flat-index or cache_index_copy -flat), lookups
+/// use them and memory-mapped chunk files, and a single CAsnCache can be
+/// used from any number of threads at once (see IsThreadSafe()).  Such an
+/// object does not see later updates of the cache (see IsFlatIndexCurrent()).
 class CAsnCache : public CObject
 {
 public:
@@ -95,6 +102,21 @@ public:
     bool EfficientlyGetSeqIds() const
     { return m_SeqIdIndex.get(); }
 
+    ///
+    /// Check if the lookups use the flat indices, so that the object can be
+    /// shared by several threads without locking
+    ///
+    bool IsThreadSafe() const
+    { return m_FlatIndex.get() != NULL; }
+
+    ///
+    /// Check if the flat indices used by the object still match the BDB
+    /// indices.  They are opened once, by the constructor: after the cache
+    /// is updated the object keeps returning the old data, and a new
+    /// object has to be created.  Returns false if no flat index is used.
+    ///
+    bool IsFlatIndexCurrent() const;
+
     /// Return a blob as a CSeq_entry object.
     CRef<objects::CSeq_entry> GetEntry(const objects::CSeq_id_Handle& id);
     vector< CRef<objects::CSeq_entry> > GetMultipleEntries(const objects::CSeq_id_Handle& id);
@@ -134,6 +156,29 @@ private:
                                     CAsnIndex&              index,
                                     CAsnIndex::SIndexInfo&  info);
 
+    static bool s_GetChunkAndOffset(const objects::CSeq_id_Handle&   idh,
+                                    const CAsnFlatIndex&    index,
+                                    vector<CAsnIndex::SIndexInfo>&  info,
+                                    bool                    multiple);
+
+    /// Add an index entry found for the version requested if it is
+    /// the best one so far (or if all are requested).
+    static bool s_AddIndexInfo(const CAsnIndex::SIndexInfo& current_info,
+                               Uint4                        version,
+                               vector<CAsnIndex::SIndexInfo>&  info,
+                               bool                         multiple);
+
+    /// Look up the main or SeqId index, the flat one if available.
+    bool x_GetChunkAndOffset(const objects::CSeq_id_Handle&   idh,
+                             CAsnIndex::E_index_type type,
+                             vector<CAsnIndex::SIndexInfo>&  info,
+                             bool                    multiple);
+    bool x_GetChunkAndOffset(const objects::CSeq_id_Handle&   idh,
+                             CAsnIndex::E_index_type type,
+                             CAsnIndex::SIndexInfo&  info);
+
+    void x_OpenFlatIndex();
+
     string m_DbPath;
     AutoPtr<CAsnIndex> m_Index;
     AutoPtr<CAsnIndex> m_SeqIdIndex;
@@ -143,6 +188,13 @@ private:
 
     AutoPtr<CSeqIdChunkFile> m_SeqIdChunk;
 
+    /// Flat indices and the chunk files mapped by chunk number, used
+    /// instead of the above when available.
+    AutoPtr<CAsnFlatIndex> m_FlatIndex;
+    AutoPtr<CAsnFlatIndex> m_FlatSeqIdIndex;
+    vector< AutoPtr<CMemoryFile> > m_ChunkMaps;
+    AutoPtr<CMemoryFile> m_SeqIdChunkMap;
+
     CAsnIndex & GetIndexRef () const { return *m_Index; }
     bool x_GetBlob(const CAsnIndex::SIndexInfo &info, objects::CCache_blob& blob);
 
@@ -49,6 +49,7 @@ public:
         , eCantOpenChunkFile
         , eCantCopyChunkFile
         , eCantFindChunkFile
+        , eBadIndexFile
     };  
 
     virtual const char* GetErrCodeString() const
@@ -59,6 +60,7 @@ public:
             case eCantOpenChunkFile: return "Unable to open a cache chunk file.";
             case eCantCopyChunkFile: return "Unable to copy a cache chunk file.";
             case eCantFindChunkFile: return "Unable to find a cache chunk file.";
+            case eBadIndexFile: return "Invalid or unwritable cache index file.";
             default:     return CException::GetErrCodeString();
         }   
     }   
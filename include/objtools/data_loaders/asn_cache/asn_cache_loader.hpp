@@ -33,6 +33,7 @@
  *
  */
 
+#include <corelib/ncbicntr.hpp>
 #include <objmgr/data_loader.hpp>
 #include <objtools/data_loaders/asn_cache/asn_cache_export.h>
 
@@ -46,6 +47,10 @@ BEGIN_SCOPE(objects)
 //
 // CAsnCache_DataLoader.
 // CDataLoader implementation for local data storage.
+// If the cache has current flat indices, one CAsnCache is shared by all
+// threads.  The loader checks every few seconds that they still match
+// the BDB indices, so it switches to an updated or re-indexed cache by
+// itself; objects already loaded are not reloaded.
 //
 
 // Parameter names used by loader factory
@@ -107,15 +112,43 @@ private:
 
         CFastMutex      cache_mtx;
         CRef<CAsnCache> cache;
-        size_t          requests;
-        size_t          found;
+        CAtomicCounter_WithAutoInit requests;
+        CAtomicCounter_WithAutoInit found;
+        // used by all threads without locking, see CAsnCache::IsThreadSafe()
+        bool            shared;
+    };
+
+    // locks SCacheInfo::cache_mtx unless the cache is shared
+    class CCacheGuard
+    {
+    public:
+        CCacheGuard(SCacheInfo& index)
+            : m_Guard(eEmptyGuard)
+        {
+            if ( !index.shared ) {
+                m_Guard.Guard(index.cache_mtx);
+            }
+        }
+    private:
+        CFastMutexGuard m_Guard;
     };
 
     typedef vector< AutoPtr<SCacheInfo> > TIndexMap;
     CFastMutex m_Mutex;
     TIndexMap m_IndexMap;
+    // caches which were shared, or whose flat indices went out of date;
+    // kept until the loader is destroyed, since other threads may still
+    // be using them
+    TIndexMap m_KeptIndices;
+    // the cache in m_KeptIndices used by all threads, or NULL
+    SCacheInfo* volatile m_SharedIndex;
+    // time (in seconds) of the next x_CheckIndices()
+    CAtomicCounter_WithAutoInit m_NextIndexCheck;
     string    m_DbPath;
     SCacheInfo& x_GetIndex();
+    // switch to new caches if the flat indices were built or updated,
+    // and stop using the ones which are out of date
+    void x_CheckIndices(time_t now);
 };
 
 END_SCOPE(objects)
@@ -0,0 +1,105 @@
+#ifndef ASN_CACHE_ASN_FLAT_INDEX_HPP__
+#define ASN_CACHE_ASN_FLAT_INDEX_HPP__
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ * Read-only snapshot of a BDB ASN cache index, for concurrent lookups.  The
+ * index entries are stored as fixed-size records sorted by seq-id, version,
+ * gi and timestamp, followed by a pool of the seq-id strings.  The file is
+ * memory-mapped and searched in place, so any number of threads can share
+ * one CAsnFlatIndex without locking.  The file is written in the native
+ * byte order and is not portable between platforms with different ones.
+ */
+
+#include <string>
+#include <vector>
+
+#include <corelib/ncbifile.hpp>
+
+#include <objtools/data_loaders/asn_cache/asn_index.hpp>
+
+BEGIN_NCBI_SCOPE
+
+class CAsnFlatIndex
+{
+public:
+    /// Map the index file.  Throws CASNCacheException if the file is not
+    /// a valid index.
+    explicit CAsnFlatIndex( const string & file_name );
+    ~CAsnFlatIndex();
+
+    CAsnIndex::E_index_type GetIndexType() const;
+    /// Largest chunk number used by the index entries
+    CAsnIndex::TChunkId     GetMaxChunkId() const;
+    Uint8                   GetRecordCount() const;
+    /// True if the index was built from bdb_file_name and that file has
+    /// not changed since: its modification time, to the nanosecond, and
+    /// its size are the ones recorded by Build().
+    bool    IsCurrent( const string & bdb_file_name ) const;
+
+    /// Append all the entries for seq_id with a version not less than
+    /// 'version', in the index order (the same set a BDB cursor returns
+    /// for this range).  Safe to call from several threads.
+    void    Find( const string & seq_id,
+                  CAsnIndex::TVersion version,
+                  vector<CAsnIndex::SIndexInfo> & info ) const;
+    /// Number of the entries Find() would return
+    size_t  Count( const string & seq_id, CAsnIndex::TVersion version ) const;
+
+    /// Write a snapshot of a BDB index to file_name.  The file is written
+    /// under a temporary name and renamed, so readers never see a
+    /// partially written index.  The modification time and size of the
+    /// BDB file are recorded for IsCurrent().  Returns the number of
+    /// entries written.
+    static Uint8    Build( CAsnIndex & index, const string & file_name );
+    /// Write the flat index of the given type for the cache in cache_dir.
+    /// The BDB index must be closed by writers before this is called.
+    static Uint8    Build( const string & cache_dir, CAsnIndex::E_index_type type );
+
+private:
+    struct SHeader;
+    struct SRecord;
+
+    AutoPtr<CMemoryFile>    m_File;
+    const SHeader *         m_Header;
+    const SRecord *         m_Records;
+    const char *            m_Strings;
+
+    /// Seq-id of the record in the string pool; throws CASNCacheException
+    /// if it is not within the pool
+    const char *    x_GetSeqIdPtr( const SRecord & record ) const;
+    string  x_GetSeqId( const SRecord & record ) const;
+    /// Position of the first record not less than (seq_id, version)
+    Uint8   x_LowerBound( const string & seq_id,
+                          CAsnIndex::TVersion version ) const;
+    bool    x_IsSeqId( Uint8 pos, const string & seq_id ) const;
+
+    CAsnFlatIndex( const CAsnFlatIndex & );
+    CAsnFlatIndex & operator=( const CAsnFlatIndex & );
+};
+
+END_NCBI_SCOPE
+#endif  // ASN_CACHE_ASN_FLAT_INDEX_HPP__
@@ -173,6 +173,7 @@ private:
     friend CNcbiOstream &operator<<(CNcbiOstream &ostr, const CAsnIndex::SIndexInfo &info);
 
     friend class CAsnCache;
+    friend class CAsnFlatIndex;
     friend class ::CAsnCacheApplication;
     friend class objects::CAsnCache_DataLoader;
 };
@@ -50,6 +50,15 @@ namespace NASNCacheFileName
                                                                 : GetSeqIdIndex() );
     }
 
+    inline string GetFlatIndex() { return string( "asn_cache.flat" ); }
+    inline string GetFlatSeqIdIndex() { return string( "seq_id_cache.flat" ); }
+    inline string GetFlatIndex( const string & root_dir, CAsnIndex::E_index_type type )
+    {
+        return CDirEntry::ConcatPath( root_dir,
+                                      type == CAsnIndex::e_main ? GetFlatIndex()
+                                                                : GetFlatSeqIdIndex() );
+    }
+
     inline string GetChunkPrefix() { return string( "chunk." ); }
     inline string GetSeqIdChunk() { return string( "seq_id_chunk" ); }
     inline string GetSeqIdChunk( const string & root_dir )
@@ -96,6 +96,26 @@ public:
     void Generate(const CSeq_id& id, const TRange& range,
         ENa_strand strand, CScope& scope, CFlatItemOStream& item_os);
 
+    // Report for a Bioseq to be written to a stream
+    struct SBioseqJob
+    {
+        SBioseqJob(const CBioseq_Handle& b, CNcbiOstream& o)
+            : bsh(b), os(&o) {}
+
+        CBioseq_Handle  bsh;
+        CNcbiOstream*   os;
+    };
+    typedef vector<SBioseqJob> TBioseqJobs;
+
+    // Generate the reports using up to nthreads threads. Each report is
+    // gathered and formatted by one of the threads into its own buffer;
+    // the buffers are written out strictly in the order of the jobs, so
+    // the output is the same as of Generate(job.bsh, *job.os) called for
+    // each job in turn with the feature tree of the Bioseq's top-level
+    // entry set. The scope must not be edited while this runs. Callbacks
+    // of the configuration are called from the worker threads.
+    void Generate(const TBioseqJobs& jobs, unsigned int nthreads);
+
     // for use when generating a range of a Seq-submit
     void SetSubmit(const CSubmit_block& sub) { m_Ctx->SetSubmit(sub); }
 
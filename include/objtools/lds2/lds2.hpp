@@ -40,6 +40,10 @@
 BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(objects)
 
+struct SLDS2_ParsedBlob;
+struct SLDS2_FileJob;
+class CLDS2_IndexThread;
+
 
 /// Class for managing LDS2 database and related data files.
 class NCBI_LDS2_EXPORT CLDS2_Manager : public CObject
@@ -141,19 +145,50 @@ public:
     CFastaReader::TFlags GetFastaFlags(void) const { return m_FastaFlags; }
     void SetFastaFlags(CFastaReader::TFlags flags) { m_FastaFlags = flags; }
 
+    /// Number of threads checking and parsing the data files in
+    /// UpdateData(). The database is still written by the calling thread,
+    /// in the order of the files. 1 (default) does not start any threads.
+    unsigned int GetIndexThreads(void) const { return m_IndexThreads; }
+    void SetIndexThreads(unsigned int threads)
+        { m_IndexThreads = threads > 0 ? threads : 1; }
+
+    /// Write the database in WAL journal mode during UpdateData(), so that
+    /// the data loaders reading it are not blocked by the update (default
+    /// is false). The database is switched back to its normal journal mode
+    /// when the update is finished. Ignored for in-memory databases.
+    bool GetWALUpdate(void) const { return m_WALUpdate; }
+    void SetWALUpdate(bool wal) { m_WALUpdate = wal; }
+
 private:
+    friend class CLDS2_IndexThread;
+
     typedef CLDS2_Database::TStringSet TFiles;
+    typedef vector< AutoPtr<SLDS2_ParsedBlob> > TParsedBlobs;
 
     // Check for gzip file.
     bool x_IsGZipFile(const SLDS2_File& file_info);
 
     // Find handler for the file.
     CLDS2_UrlHandler_Base* x_GetUrlHandler(const SLDS2_File& file_info);
-    // Get file info and handler
+    // Get file info and handler. If the file is already indexed (db_info
+    // is not empty), it is not read again unless the size or time change.
     SLDS2_File x_GetFileInfo(const string&                file_name,
-                             CRef<CLDS2_UrlHandler_Base>& handler);
-    void x_ParseFile(const SLDS2_File&      info,
-                     CLDS2_UrlHandler_Base& handler);
+                             CRef<CLDS2_UrlHandler_Base>& handler,
+                             const SLDS2_File&            db_info);
+    // Parse the file and return the number of top level objects found.
+    // If 'blobs' is not null, the objects are collected there rather than
+    // stored in the database, and the database is not accessed at all.
+    int x_ParseFile(const SLDS2_File&      info,
+                    CLDS2_UrlHandler_Base& handler,
+                    TParsedBlobs*          blobs = 0);
+    // Check and parse the file (on an indexing thread).
+    void x_PrepareFile(SLDS2_FileJob& job);
+    // Update the database with the prepared file.
+    void x_StoreFile(SLDS2_FileJob& job);
+    // UpdateData() with the current database flags.
+    void x_UpdateData(void);
+    // UpdateData() using indexing threads.
+    void x_UpdateDataMT(const TFiles& files);
 
     // All registered handlers by name.
     typedef map<string, CRef<CLDS2_UrlHandler_Base> > THandlers;
@@ -169,6 +204,8 @@ private:
     CFastaReader::TFlags m_FastaFlags;
     THandlers            m_Handlers;
     int                  m_SeqAlignGroupSize;
+    unsigned int         m_IndexThreads;
+    bool                 m_WALUpdate;
 };
 
 
@@ -59,6 +59,13 @@ public:
     /// the information.
     virtual void FillInfo(SLDS2_File& info);
 
+    /// Fill file/url information for re-indexing. If the size and
+    /// timestamp are the same as in the already indexed info, the
+    /// format and CRC are copied from it instead of reading the data.
+    /// Otherwise (including handlers which do not provide a timestamp)
+    /// the virtual FillInfo(info) is called.
+    void FillInfo(SLDS2_File& info, const SLDS2_File& db_info);
+
     /// Save information about chunks for the URL in the database.
     /// The default implementation does nothing.
     virtual void SaveChunks(const SLDS2_File& file_info,
@@ -64,6 +64,8 @@ public:
         fNewCode =      0x1000, // for now don't clobber CGFFReader flags
         fGenbankMode =  0x2000,
         fRetainLocusIds = 0x4000,
+        fStreamBySeqId = 0x8000,    // see ReadSeqAnnot()
+        fStreamByLocus = 0x10000,
     } TFlags;
 
     typedef map<string, CRef<CSeq_feat> > IdToFeatureMap;
@@ -90,6 +92,13 @@ public:
     unsigned int 
     ObjectType() const { return OT_SEQENTRY; };
     
+    // Streaming: with fStreamBySeqId the input must be grouped by seqid.
+    // Each call then returns the features of one seqid, or of one "###"
+    // delimited section, and the features of the previously returned annots
+    // are forgotten, so the memory used depends on the largest annot rather
+    // than on the file. fStreamByLocus (GFF3 only) also requires the input
+    // to be sorted by start, and ends the annot before any feature without
+    // parent that starts past all the features read so far.
     virtual CRef< CSeq_annot >
     ReadSeqAnnot(
         ILineReader& lr,
@@ -157,6 +166,14 @@ public:
     virtual bool xIsCurrentDataType(
         const string&);
 
+    virtual bool xIsStreamBoundary(
+        const vector<CTempStringEx>&);
+
+    virtual bool xIsStreamLocusFeature(
+        const vector<CTempStringEx>&);
+
+    virtual void xResetStreamState();
+
     virtual void xPostProcessAnnot(
         CRef<CSeq_annot>&,
         ILineErrorListener*);
@@ -419,6 +436,8 @@ protected:
     ILineErrorListener* m_pErrors;
     unsigned int mCurrentFeatureCount;
     bool mParsingAlignment;
+    string mStreamSeqId;
+    TSeqPos mStreamMaxTo;
     CRef<CAnnotdesc> m_CurrentBrowserInfo;
     CRef<CAnnotdesc> m_CurrentTrackInfo;
 };
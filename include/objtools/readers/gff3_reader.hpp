@@ -151,6 +151,17 @@ protected:
 
     virtual bool xReadInit();
 
+    virtual bool xParseStructuredComment(
+        const string&);
+
+    virtual bool xIsStreamBoundary(
+        const vector<CTempStringEx>&);
+
+    virtual bool xIsStreamLocusFeature(
+        const vector<CTempStringEx>&);
+
+    virtual void xResetStreamState();
+
     string xNextGenericId();
 
     bool xVerifyExonLocation(
@@ -164,6 +175,7 @@ protected:
     // Data:
     map<string, string> mCdsParentMap;
     map<string, CRef<CSeq_interval> > mMrnaLocs;
+    map<string, TSeqPos> mSequenceRegionEnds;
     static unsigned int msGenericIdCounter;
 };
 
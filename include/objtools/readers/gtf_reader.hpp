@@ -206,6 +206,8 @@ protected:
     virtual bool x_ProcessQualifierSpecialCase(
         CGff2Record::TAttrCit,
         CRef< CSeq_feat > );
+
+    virtual void xResetStreamState();
   
     bool x_CdsIsPartial(
         const CGff2Record& );
@@ -38,13 +38,20 @@
 #include <objtools/readers/reader_base.hpp>
 #include <objtools/readers/message_listener.hpp>
 #include <objects/seq/Seq_annot.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+
+#include <set>
 
 
 BEGIN_NCBI_SCOPE
 
+class CStdPoolOfThreads;
+
 BEGIN_SCOPE(objects) // namespace ncbi::objects::
 
 class CVcfData;
+class CVcfDataBlock;
+class CVcfDataLineTask;
 
 //  ----------------------------------------------------------------------------
 enum ESpecType
@@ -147,11 +154,44 @@ public:
     enum {
         fNormal = 0,
         fUseSetFormat = 1<<8,
+        // keep INFO and the sample columns as raw text in the feature
+        // instead of decoding them (see GetInfoData() and
+        // GetGenotypeData()). The variant properties, dbxrefs and id
+        // databases that come from INFO keys are not set then.
+        fLazyGenotypes = 1<<9,
     };
 
     CVcfReader( 
         int =0 );
     virtual ~CVcfReader();
+
+    // Only keep the sample columns of the given samples. Must be set before
+    // the header line is read.
+    void SetSamples(
+        const vector<string>& );
+
+    // Parse the data lines in blocks on a pool of the given number of
+    // threads, while the next block is read. The features and messages
+    // still come in input order.
+    void SetParseThreads(
+        unsigned int );
+
+    // Sample names of the genotype columns, as kept from the header line
+    const vector<string>& GetGenotypeHeaders() const
+        { return m_GenotypeHeaders; };
+
+    // INFO values of a feature by key. Features read without
+    // fLazyGenotypes only keep the keys not turned into variant properties.
+    static bool GetInfoData(
+        const CSeq_feat&,
+        map<string, vector<string> >& );
+
+    // Per sample genotype values of a feature. The raw sample columns of
+    // features read with fLazyGenotypes are decoded here.
+    static bool GetGenotypeData(
+        const CSeq_feat&,
+        const vector<string>&,
+        map<string, vector<string> >& );
     
     //
     //  object interface:
@@ -215,6 +255,56 @@ protected:
         const string&,
         CRef<CSeq_annot>,
         ILineErrorListener*);
+
+    struct SDataLine {
+        SDataLine(unsigned int lineNumber, const string& line) :
+            m_LineNumber(lineNumber), m_Line(line),
+            m_FirstError(0), m_ErrorCount(0) {};
+
+        unsigned int m_LineNumber;
+        string m_Line;
+        CRef<CSeq_feat> m_Feature;
+        size_t m_FirstError;    // messages in the parsing thread listener
+        size_t m_ErrorCount;
+    };
+    typedef vector<SDataLine> TDataLines;
+
+    unsigned int
+    xProcessDataBlock(
+        TDataLines&,
+        CRef<CSeq_annot>,
+        ILineErrorListener*,
+        bool);
+
+    unsigned int
+    xFinishDataBlock(
+        CVcfDataBlock&,
+        CRef<CSeq_annot>,
+        ILineErrorListener*);
+
+    void
+    xDiscardDataBlock();
+
+    //  Messages of the parsing tasks get their line numbers when the block
+    //  is finished, m_uLineNumber moves on with the reading meanwhile.
+    using CReaderBase::ProcessError;
+    using CReaderBase::ProcessWarning;
+
+    void
+    ProcessError(
+        CObjReaderLineException&,
+        ILineErrorListener* );
+
+    void
+    ProcessWarning(
+        CObjReaderLineException&,
+        ILineErrorListener* );
+
+    virtual bool
+    xBuildDataFeature(
+        const string&,
+        CRef<CSeq_feat>&,
+        ILineErrorListener*);
         
     virtual bool
     xAssignVcfMeta(
@@ -321,6 +411,15 @@ protected:
     vector<string> m_GenotypeHeaders;
     CMessageListenerLenient m_ErrorsPrivate;
     bool m_MetaHandled;
+    set<string> m_Samples;
+    vector<size_t> m_SampleColumns;     // selected, counted from the first
+    unsigned int m_ParseThreads;
+    AutoPtr<CStdPoolOfThreads> m_ParsePool;
+    CRef<CVcfDataBlock> m_PendingBlock;   // being parsed on the pool
+
+private:
+    friend class CVcfDataBlock;
+    friend class CVcfDataLineTask;
 };
 
 END_SCOPE(objects)
@@ -43,6 +43,7 @@
 #include <objects/valerr/ValidError.hpp>
 #include <objects/taxon3/itaxon3.hpp>
 #include <objmgr/scope.hpp>
+#include <util/section_times.hpp>
 
 #include <map>
 
@@ -233,7 +234,23 @@ public:
     typedef bool (*TProgressCallback)(CProgressInfo*);
     void SetProgressCallback(TProgressCallback callback, void* user_data = 0);
 
+    // per-check timing
+    // When enabled, the time spent in the individual checks of the bioseq
+    // and feature validators is summed up over all the validations done
+    // in the process, from any thread. Enable it before validating.
+    // The time of a check does not include the checks run from within it.
+    typedef CSectionTimes::STime  SCheckTime;
+    typedef CSectionTimes::TTimes TCheckTimes;
+
+    static void EnableCheckTiming(bool enable = true);
+    static bool IsCheckTimingEnabled(void);
+    static void GetCheckTimes(TCheckTimes& times);
+
 private:
+    friend class CValidError_imp;
+
+    static CSectionTimes& x_GetCheckTimes(void);
+
     // Prohibit copy constructor & assignment operator
     CValidator(const CValidator&);
     CValidator& operator= (const CValidator&);
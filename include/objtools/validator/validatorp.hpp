@@ -36,13 +36,16 @@
 
 #include <corelib/ncbistd.hpp>
 #include <corelib/ncbi_autoinit.hpp>
+#include <corelib/ncbitime.hpp>
 
 #include <objmgr/scope.hpp>
 #include <objmgr/feat_ci.hpp>  // for CMappedFeat
 #include <objmgr/util/seq_loc_util.hpp>
+#include <objmgr/util/sequence.hpp>
 #include <objects/seqset/Bioseq_set.hpp>
 #include <objects/seq/GIBB_mol.hpp>
 #include <util/strsearch.hpp>
+#include <util/itree.hpp>
 #include <objects/misc/sequence_macros.hpp>
 #include <objects/seqfeat/Seq_feat.hpp>
 #include <objects/seqfeat/SeqFeatData.hpp>
@@ -240,6 +243,28 @@ public:
     CBioseq_Handle GetBioseqHandleFromLocation(
         CScope *scope, const CSeq_loc& loc, const CTSE_Handle & tse);
 
+    //////////
+    // Same results as the sequence:: functions of the same names, but
+    // the features of the bioseq are indexed by location once, instead
+    // of running an annotation iterator for every query. Falls back on
+    // the sequence:: functions for locations it can't index (several
+    // bioseqs, crossing the origin, segmented bioseqs) and for bioseqs
+    // with features the annotation iterators see differently (parts on
+    // other bioseqs, circular or empty intervals).
+    void GetOverlappingFeatures(
+        const CSeq_loc& loc,
+        CSeqFeatData::E_Choice feat_type, CSeqFeatData::ESubtype feat_subtype,
+        sequence::EOverlapType overlap_type,
+        sequence::TFeatScores& feats, CScope& scope);
+    CConstRef<CSeq_feat> GetBestOverlappingFeat(
+        const CSeq_loc& loc, CSeqFeatData::ESubtype feat_subtype,
+        sequence::EOverlapType overlap_type, CScope& scope);
+    CConstRef<CSeq_feat> GetBestOverlappingFeat(
+        const CSeq_loc& loc, CSeqFeatData::E_Choice feat_type,
+        sequence::EOverlapType overlap_type, CScope& scope);
+    CConstRef<CSeq_feat> GetOverlappingOperon(
+        const CSeq_loc& loc, CScope& scope);
+
     static const CTSE_Handle kEmptyTSEHandle;
 
 private:
@@ -263,6 +288,24 @@ private:
 
     typedef map<TIdToBioseqKey, TIdToBioseqValue> TIdToBioseqCache;
     TIdToBioseqCache m_IdToBioseqCache;
+
+    // features of one type on a bioseq by their total range
+    struct SFeatRange : public CObject {
+        int         m_Strands;  // strands as the annotation iterator sees them
+        bool        m_Gaps;     // more than one interval
+        size_t      m_Order;    // position in the feature cache
+        CMappedFeat m_Feat;
+    };
+    struct SFeatRangeIndex {
+        SFeatRangeIndex(void) : m_Irregular(false) {}
+
+        CIntervalTree m_Feats;      // of SFeatRange
+        bool          m_Irregular;  // queries go to sequence::
+    };
+    typedef map<SFeatKey, SFeatRangeIndex> TFeatRangeCache;
+    TFeatRangeCache m_featRangeCache;
+
+    const SFeatRangeIndex& x_GetFeatRangeIndex(const SFeatKey& featKey);
 };
 
 typedef CValidator::CCacheImpl CCacheImpl;
@@ -643,6 +686,10 @@ public:
 
     bool IsTransgenic(const CBioSource& bsrc);
 
+    // Per-check timing, see CValidator::EnableCheckTiming().
+    // The times are passed to CValidator on destruction.
+    CLocalSectionTimes& GetCheckTimes(void) { return m_CheckTimes; }
+
 private:
 
     // Setup common options during consturction;
@@ -818,6 +865,8 @@ private:
 
     bool m_IsTbl2Asn;
 
+    CLocalSectionTimes m_CheckTimes;
+
     // seq ids contained within the orignal seq entry. 
     // (used to check for far location)
     vector< CConstRef<CSeq_id> >    m_InitialSeqIds;
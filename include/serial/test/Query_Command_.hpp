@@ -0,0 +1,223 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Query_Command_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'we_cpp.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef SERIAL_TEST_QUERY_COMMAND_BASE_HPP
+#define SERIAL_TEST_QUERY_COMMAND_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CQuery_Related;
+class CQuery_Search;
+class CQuery_Select;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+/// Various types of queries
+class CQuery_Command_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CQuery_Command_Base(void);
+    // destructor
+    virtual ~CQuery_Command_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+
+    /// Choice variants.
+    enum E_Choice {
+        e_not_set = 0,  ///< No variant selected
+        e_Search,       ///< direct search by term
+        e_Select,       ///< select some docs from other query
+        e_Related       ///< related docs from other query
+    };
+    /// Maximum+1 value of the choice variant enumerator.
+    enum E_ChoiceStopper {
+        e_MaxChoice = 4 ///< == e_Related+1
+    };
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+    /// Reset the selection (set it to e_not_set).
+    virtual void ResetSelection(void);
+
+    /// Which variant is currently selected.
+    E_Choice Which(void) const;
+
+    /// Verify selection, throw exception if it differs from the expected.
+    void CheckSelected(E_Choice index) const;
+
+    /// Throw 'InvalidSelection' exception.
+    NCBI_NORETURN void ThrowInvalidSelection(E_Choice index) const;
+
+    /// Retrieve selection name (for diagnostic purposes).
+    static string SelectionName(E_Choice index);
+
+    /// Select the requested variant if needed.
+    void Select(E_Choice index, EResetVariant reset = eDoResetVariant);
+    /// Select the requested variant if needed,
+    /// allocating CObject variants from memory pool.
+    void Select(E_Choice index,
+                EResetVariant reset,
+                CObjectMemoryPool* pool);
+
+    // types
+    typedef CQuery_Search TSearch;
+    typedef CQuery_Select TSelect;
+    typedef CQuery_Related TRelated;
+
+    // getters
+    // setters
+
+    // typedef CQuery_Search TSearch
+    bool IsSearch(void) const;
+    const TSearch& GetSearch(void) const;
+    TSearch& SetSearch(void);
+    void SetSearch(TSearch& value);
+
+    // typedef CQuery_Select TSelect
+    bool IsSelect(void) const;
+    const TSelect& GetSelect(void) const;
+    TSelect& SetSelect(void);
+    void SetSelect(TSelect& value);
+
+    // typedef CQuery_Related TRelated
+    bool IsRelated(void) const;
+    const TRelated& GetRelated(void) const;
+    TRelated& SetRelated(void);
+    void SetRelated(TRelated& value);
+
+
+private:
+    // copy constructor and assignment operator
+    CQuery_Command_Base(const CQuery_Command_Base& );
+    CQuery_Command_Base& operator=(const CQuery_Command_Base& );
+    // choice state
+    E_Choice m_choice;
+    // helper methods
+    void DoSelect(E_Choice index, CObjectMemoryPool* pool = 0);
+
+    static const char* const sm_SelectionNames[];
+    // data
+    NCBI_NS_NCBI::CSerialObject *m_object;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+CQuery_Command_Base::E_Choice CQuery_Command_Base::Which(void) const
+{
+    return m_choice;
+}
+
+inline
+void CQuery_Command_Base::CheckSelected(E_Choice index) const
+{
+    if ( m_choice != index )
+        ThrowInvalidSelection(index);
+}
+
+inline
+void CQuery_Command_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    if ( reset == NCBI_NS_NCBI::eDoResetVariant || m_choice != index ) {
+        if ( m_choice != e_not_set )
+            ResetSelection();
+        DoSelect(index, pool);
+    }
+}
+
+inline
+void CQuery_Command_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset)
+{
+    Select(index, reset, 0);
+}
+
+inline
+bool CQuery_Command_Base::IsSearch(void) const
+{
+    return m_choice == e_Search;
+}
+
+inline
+bool CQuery_Command_Base::IsSelect(void) const
+{
+    return m_choice == e_Select;
+}
+
+inline
+bool CQuery_Command_Base::IsRelated(void) const
+{
+    return m_choice == e_Related;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // SERIAL_TEST_QUERY_COMMAND_BASE_HPP
@@ -0,0 +1,19 @@
+#include <serial/test/Argument.hpp>
+#include <serial/test/Db_Clipboard.hpp>
+#include <serial/test/Db_Env.hpp>
+#include <serial/test/Filter_Value.hpp>
+#include <serial/test/Full_Time.hpp>
+#include <serial/test/Item_Set.hpp>
+#include <serial/test/Name.hpp>
+#include <serial/test/Named_Item_Set.hpp>
+#include <serial/test/Named_Query.hpp>
+#include <serial/test/Query_Command.hpp>
+#include <serial/test/Query_History.hpp>
+#include <serial/test/Query_Related.hpp>
+#include <serial/test/Query_Search.hpp>
+#include <serial/test/Query_Select.hpp>
+#include <serial/test/Time.hpp>
+#include <serial/test/Web_Env.hpp>
+#include <serial/test/Web_Saved.hpp>
+#include <serial/test/Web_Settings.hpp>
+#include <serial/test/NCBI_Env_module.hpp>
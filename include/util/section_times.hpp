@@ -0,0 +1,182 @@
+#ifndef UTIL___SECTION_TIMES__HPP
+#define UTIL___SECTION_TIMES__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file section_times.hpp
+/// Time spent in named sections of code, summed up over threads.
+
+#include <corelib/ncbistd.hpp>
+#include <corelib/ncbicntr.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbitime.hpp>
+#include <map>
+
+
+/** @addtogroup Miscellaneous
+ *
+ * @{
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CSectionTimes --
+///
+/// Process-wide totals of the time spent in named sections of code.
+/// The timing is off until Enable() is called.  The sections are timed
+/// with CSectionTimer into a CLocalSectionTimes, which is owned by one
+/// thread and adds its times to the totals when it is destroyed, so the
+/// timers themselves take no locks.
+///
+/// The time of a section does not include the time of the sections timed
+/// inside it, so that nested sections are not counted twice and the
+/// times add up to the time of the outermost sections.
+///
+class NCBI_XUTIL_EXPORT CSectionTimes
+{
+public:
+    struct STime
+    {
+        STime(void) : m_Seconds(0), m_Calls(0) {}
+        double m_Seconds;
+        size_t m_Calls;
+    };
+    typedef map<string, STime> TTimes;
+
+    CSectionTimes(void);
+
+    void Enable(bool enable = true);
+    bool IsEnabled(void) const;
+
+    void GetTimes(TTimes& times) const;
+    void Add(const TTimes& times);
+
+    /// Print one line per section, the slowest section first:
+    /// the name, the seconds and the number of calls, tab separated.
+    static void Print(CNcbiOstream& out, const TTimes& times,
+                      const string& indent = "  ");
+
+private:
+    CAtomicCounter_WithAutoInit m_Enabled;
+    mutable CFastMutex          m_Mutex;
+    TTimes                      m_Times;
+};
+
+
+class CSectionTimer;
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CLocalSectionTimes --
+///
+/// Times collected by one thread, added to the totals on destruction.
+/// The sections are told apart by the address of their name, which must
+/// be a string literal; the names are only compared as strings when the
+/// times are added to the totals.
+///
+class NCBI_XUTIL_EXPORT CLocalSectionTimes
+{
+public:
+    explicit CLocalSectionTimes(CSectionTimes& totals)
+        : m_Totals(totals), m_Current(NULL)
+    {}
+    ~CLocalSectionTimes(void);
+
+    bool IsEnabled(void) const { return m_Totals.IsEnabled(); }
+    void Add(const char* section, double seconds);
+
+private:
+    friend class CSectionTimer;
+
+    typedef map<const char*, CSectionTimes::STime> TTimes;
+
+    CSectionTimes& m_Totals;
+    TTimes         m_Times;
+    CSectionTimer* m_Current;  ///< innermost running timer
+
+    // Prohibit copy constructor & assignment operator
+    CLocalSectionTimes(const CLocalSectionTimes&);
+    CLocalSectionTimes& operator= (const CLocalSectionTimes&);
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CSectionTimer --
+///
+/// Adds its lifetime, less the time of the timers nested in it, to the
+/// named section if the timing is enabled.
+///
+class CSectionTimer
+{
+public:
+    CSectionTimer(CLocalSectionTimes& times, const char* section)
+        : m_Times(times), m_Section(section),
+          m_Watch(times.IsEnabled() ? CStopWatch::eStart : CStopWatch::eStop),
+          m_Outer(NULL), m_Nested(0)
+    {
+        if (m_Watch.IsRunning()) {
+            m_Outer = m_Times.m_Current;
+            m_Times.m_Current = this;
+        }
+    }
+    ~CSectionTimer(void)
+    {
+        if (m_Watch.IsRunning()) {
+            double elapsed = m_Watch.Elapsed();
+            m_Times.m_Current = m_Outer;
+            if (m_Outer) {
+                m_Outer->m_Nested += elapsed;
+            }
+            m_Times.Add(m_Section, elapsed - m_Nested);
+        }
+    }
+
+private:
+    CLocalSectionTimes& m_Times;
+    const char*         m_Section;
+    CStopWatch          m_Watch;
+    CSectionTimer*      m_Outer;
+    double              m_Nested;
+
+    // Prohibit copy constructor & assignment operator
+    CSectionTimer(const CSectionTimer&);
+    CSectionTimer& operator= (const CSectionTimer&);
+};
+
+
+END_NCBI_SCOPE
+
+/* @} */
+
+#endif  /* UTIL___SECTION_TIMES__HPP */
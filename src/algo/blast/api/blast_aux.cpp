@@ -242,6 +242,7 @@ CBlastHitSavingOptions::DebugDump(CDebugDumpContext ddc, unsigned int /*depth*/)
     ddc.Log("longest_intron", m_Ptr->longest_intron);
     ddc.Log("min_hit_length", m_Ptr->min_hit_length);
     ddc.Log("min_diag_separation", m_Ptr->min_diag_separation);
+    ddc.Log("prelim_memory_limit", m_Ptr->prelim_memory_limit);
     if (m_Ptr->hsp_filt_opt) {
         ddc.Log("hsp_filt_opt->best_hit_stage",
                 m_Ptr->hsp_filt_opt->best_hit_stage);
@@ -2044,6 +2044,22 @@ CBlastOptions::SetLowScorePerc(double p)
         m_Local->SetLowScorePerc(p);
 }
 
+Int8
+CBlastOptions::GetPrelimMemoryLimit() const
+{
+    if (! m_Local) {
+        x_Throwx("Error: GetPrelimMemoryLimit() not available.");
+    }
+    return m_Local->GetPrelimMemoryLimit();
+}
+
+void
+CBlastOptions::SetPrelimMemoryLimit(Int8 limit)
+{
+    if (m_Local) 
+        m_Local->SetPrelimMemoryLimit(limit);
+}
+
 
 bool
 CBlastOptions::GetPaired() const
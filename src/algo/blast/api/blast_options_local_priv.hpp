@@ -253,6 +253,10 @@ public:
     double GetLowScorePerc() const;
     void SetLowScorePerc(double p = 0.0);
 
+    /// Memory budget for the HSPs saved in the preliminary stage
+    Int8 GetPrelimMemoryLimit() const;
+    void SetPrelimMemoryLimit(Int8 limit);
+
     // Paired reads only if set to true
     bool GetPaired() const;
     void SetPaired(bool p);
@@ -1482,6 +1486,18 @@ CBlastOptionsLocal::SetLowScorePerc(double p)
     m_HitSaveOpts->low_score_perc = p;
 }
 
+inline Int8
+CBlastOptionsLocal::GetPrelimMemoryLimit() const
+{
+    return m_HitSaveOpts->prelim_memory_limit;
+}
+
+inline void
+CBlastOptionsLocal::SetPrelimMemoryLimit(Int8 limit)
+{
+    m_HitSaveOpts->prelim_memory_limit = limit;
+}
+
 inline bool
 CBlastOptionsLocal::GetPaired() const
 {
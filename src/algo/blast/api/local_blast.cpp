@@ -39,6 +39,7 @@
 #include <objects/scoremat/PssmWithParameters.hpp>
 #include <algo/blast/api/seqinfosrc_seqdb.hpp>
 #include <algo/blast/api/blast_dbindex.hpp>
+#include <corelib/ncbithr.hpp>
 
 /** @addtogroup AlgoBlast
  *
@@ -138,6 +139,17 @@ CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
   m_SeqInfoSrc      (seqInfoSrc)
 {}
 
+CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
+                         CRef<CBlastOptions> options,
+                         CRef<CLocalDbAdapter> db)
+: m_QueryFactory    (qf),
+  m_Opts            (options),
+  m_InternalData    (0),
+  m_PrelimSearch    (new CBlastPrelimSearch(qf, m_Opts, db)),
+  m_TbackSearch     (0),
+  m_LocalDbAdapter  (db.GetNonNullPointer())
+{}
+
 /** FIXME: this should be removed as soon as we safely can
  * We will be able to do this once we are guaranteed that every
  * constructor to CLocalBlast takes or can construct a IBlastSeqInfoSrc
@@ -236,7 +248,13 @@ CLocalBlast::Run()
 	}
 
     //_ASSERT(m_InternalData);
-    
+
+    return x_RunTraceback();
+}
+
+CRef<CSearchResultSet>
+CLocalBlast::x_RunTraceback()
+{
     TSearchMessages search_msgs = m_PrelimSearch->GetSearchMessages();
     
     CRef<IBlastSeqInfoSrc> seqinfo_src;
@@ -275,6 +293,167 @@ CLocalBlast::Run()
     return retval;
 }
 
+/// Thread running the traceback stage of throughput mode searches, see
+/// CLocalBlast::RunThroughputMode
+class CLocalBlastTracebackThread : public CThread
+{
+public:
+    typedef vector< CRef<CLocalBlast> > TSearches;
+    typedef vector< CRef<CSearchResultSet> > TResults;
+
+    CLocalBlastTracebackThread(const TSearches& searches, TResults& results,
+                               size_t& next_search, CFastMutex& lock)
+        : m_Searches(searches), m_Results(results),
+          m_NextSearch(next_search), m_Lock(lock)
+    {}
+
+    /// Error message of the first search that failed, if any
+    const string& GetErrorMessage() const { return m_ErrorMessage; }
+
+protected:
+    virtual void* Main(void) {
+        for (;;) {
+            size_t index;
+            {{
+                CFastMutexGuard guard(m_Lock);
+                if (m_NextSearch >= m_Searches.size()) {
+                    break;
+                }
+                index = m_NextSearch++;
+            }}
+            try {
+                CRef<CLocalBlast> search = m_Searches[index];
+                m_Results[index] = search->x_RunTraceback();
+            } catch (const CException& e) {
+                m_ErrorMessage = e.GetMsg();
+                break;
+            } catch (const exception& e) {
+                m_ErrorMessage = e.what();
+                break;
+            }
+        }
+        return NULL;
+    }
+
+private:
+    const TSearches& m_Searches;
+    TResults&        m_Results;
+    size_t&          m_NextSearch;
+    CFastMutex&      m_Lock;
+    string           m_ErrorMessage;
+};
+
+vector< CRef<CSearchResultSet> >
+CLocalBlast::RunThroughputMode(const TQueryFactories& query_batches,
+                               CRef<CBlastOptionsHandle> opts_handle,
+                               CRef<CLocalDbAdapter> db,
+                               size_t num_threads)
+{
+    vector< CRef<CSearchResultSet> > retval(query_batches.size());
+    vector< CRef<CLocalBlast> > shared;
+    vector< CRef<CBlastPrelimSearch> > shared_prelim;
+    vector<size_t> shared_index;
+
+    // Each batch gets its own copy of the options, because the preliminary
+    // stage stores per-batch effective search spaces in them
+    for (size_t i = 0; i < query_batches.size(); i++) {
+        CRef<CLocalBlast> search
+            (new CLocalBlast(query_batches[i],
+                             opts_handle->GetOptions().Clone(), db));
+        search->SetNumberOfThreads(num_threads);
+        if (search->m_PrelimSearch->CheckInternalData() == 0 &&
+            search->m_PrelimSearch->CanShareScan()) {
+            shared.push_back(search);
+            shared_prelim.push_back(search->m_PrelimSearch);
+            shared_index.push_back(i);
+        } else {
+            retval[i] = search->Run();
+        }
+    }
+    if (shared.empty()) {
+        return retval;
+    }
+
+    bool scanned = false;
+    try {
+        vector< CRef<SInternalData> > data =
+            CBlastPrelimSearch::RunSharedScan(shared_prelim, num_threads);
+        for (size_t i = 0; i < shared.size(); i++) {
+            shared[i]->m_InternalData = data[i];
+        }
+        scanned = true;
+    } catch (CIndexedDbException&) {
+        throw;
+    } catch (CBlastException& e) {
+        // Same handling as in Run()
+        if (e.GetErrCode() == CBlastException::eCoreBlastError) {
+            throw;
+        }
+    }
+    if ( !scanned ) {
+        // Without the shared scan there is no preliminary data to trace
+        // back; search the batches one at a time instead, as Run() does
+        for (size_t i = 0; i < shared.size(); i++) {
+            CRef<CLocalBlast> search
+                (new CLocalBlast(query_batches[shared_index[i]],
+                                 opts_handle->GetOptions().Clone(), db));
+            search->SetNumberOfThreads(num_threads);
+            retval[shared_index[i]] = search->Run();
+        }
+        return retval;
+    }
+
+    vector< CRef<CSearchResultSet> > results(shared.size());
+    if (num_threads <= 1 || shared.size() == 1) {
+        for (size_t i = 0; i < shared.size(); i++) {
+            results[i] = shared[i]->x_RunTraceback();
+        }
+    } else {
+        // The traceback stages of the batches are independent of each
+        // other; run them concurrently, one thread per batch, each with its
+        // own copy of the BlastSeqSrc
+        db->MakeSeqInfoSrc();
+        NON_CONST_ITERATE(vector< CRef<CLocalBlast> >, it, shared) {
+            TBlastSeqSrc& seqsrc = *(*it)->m_InternalData->m_SeqSrc;
+            (*it)->m_InternalData->m_SeqSrc.Reset
+                (new TBlastSeqSrc(BlastSeqSrcCopy(seqsrc.GetPointer()),
+                                  BlastSeqSrcFree));
+            (*it)->SetNumberOfThreads(1);
+        }
+
+        typedef vector< CRef<CLocalBlastTracebackThread> > TThreads;
+        TThreads the_threads(min(num_threads, shared.size()));
+        size_t next_search = 0;
+        CFastMutex lock;
+        NON_CONST_ITERATE(TThreads, thread, the_threads) {
+            thread->Reset(new CLocalBlastTracebackThread(shared, results,
+                                                         next_search, lock));
+            (*thread)->Run();
+        }
+        string errmsg;
+        NON_CONST_ITERATE(TThreads, thread, the_threads) {
+            (*thread)->Join();
+            if (errmsg.empty()) {
+                errmsg = (*thread)->GetErrorMessage();
+            }
+        }
+        if ( !errmsg.empty() ) {
+            NCBI_THROW(CBlastException, eCoreBlastError, errmsg);
+        }
+        ITERATE(vector< CRef<CSearchResultSet> >, it, results) {
+            if ( it->Empty() ) {
+                NCBI_THROW(CBlastException, eCoreBlastError,
+                           "Traceback of a query batch produced no results");
+            }
+        }
+    }
+
+    for (size_t i = 0; i < shared.size(); i++) {
+        retval[shared_index[i]] = results[i];
+    }
+    return retval;
+}
+
 Int4 CLocalBlast::GetNumExtensions()
 {
     Int4 retv = 0;
@@ -145,6 +145,57 @@ private:
     const CBlastOptionsMemento* m_OptsMemento;
 };
 
+/// Thread class to run the preliminary stage of several query batches with
+/// a shared scan of the database
+class CPrelimSearchMultiBatchThread : public CThread
+{
+public:
+    CPrelimSearchMultiBatchThread(EBlastProgramType program,
+                                  const vector<SBlastPrelimBatch>& batches,
+                                  const BlastSeqSrc* seqsrc,
+                                  const BlastDatabaseOptions* db_opts,
+                                  TInterruptFnPtr fn_interrupt,
+                                  const SBlastProgress* progress)
+        : m_Program(program), m_Batches(batches), m_DbOpts(db_opts),
+          m_FnInterrupt(fn_interrupt), m_Progress(NULL)
+    {
+        // The following fields need to be copied to ensure MT-safety, as in
+        // CPrelimSearchThread
+        m_SeqSrc = BlastSeqSrcCopy(seqsrc);
+        if (progress) {
+            m_Progress = SBlastProgressNew(progress->user_data);
+        }
+        NON_CONST_ITERATE(vector<SBlastPrelimBatch>, batch, m_Batches) {
+            batch->query_info = BlastQueryInfoDup(batch->query_info);
+        }
+    }
+
+protected:
+    virtual ~CPrelimSearchMultiBatchThread(void) {
+        NON_CONST_ITERATE(vector<SBlastPrelimBatch>, batch, m_Batches) {
+            BlastQueryInfoFree(batch->query_info);
+        }
+        SBlastProgressFree(m_Progress);
+        BlastSeqSrcFree(m_SeqSrc);
+    }
+
+    virtual void* Main(void) {
+        return (void*) ((intptr_t)
+            Blast_RunPreliminarySearchMultiBatch(m_Program, &m_Batches[0],
+                                                 (Int4) m_Batches.size(),
+                                                 m_SeqSrc, m_DbOpts,
+                                                 m_FnInterrupt, m_Progress));
+    }
+
+private:
+    EBlastProgramType m_Program;
+    vector<SBlastPrelimBatch> m_Batches;
+    BlastSeqSrc* m_SeqSrc;
+    const BlastDatabaseOptions* m_DbOpts;
+    TInterruptFnPtr m_FnInterrupt;
+    SBlastProgress* m_Progress;
+};
+
 END_SCOPE(blast)
 END_NCBI_SCOPE
 
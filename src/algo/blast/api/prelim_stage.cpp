@@ -309,6 +309,120 @@ CBlastPrelimSearch::Run()
     return m_InternalData;
 }
 
+bool
+CBlastPrelimSearch::CanShareScan() const
+{
+    const EBlastProgramType program = m_Options->GetProgramType();
+    if (Blast_ProgramIsRpsBlast(program) || Blast_ProgramIsPhiBlast(program) ||
+        m_Options->GetUseIndex()) {
+        return false;
+    }
+    CRef<SBlastSetupData> setup_data(new SBlastSetupData(m_QueryFactory,
+                                                         m_Options));
+    return !setup_data->m_QuerySplitter->IsQuerySplit();
+}
+
+vector< CRef<SInternalData> >
+CBlastPrelimSearch::RunSharedScan
+    (const vector< CRef<CBlastPrelimSearch> >& searches, size_t num_threads)
+{
+    vector< CRef<SInternalData> > retval;
+    if (searches.empty()) {
+        return retval;
+    }
+
+    // The effective search space mementos must stay alive until the scan
+    // is done, as in Run()
+    vector< AutoPtr<CEffectiveSearchSpacesMemento> > eff_mementos;
+    vector< AutoPtr<const CBlastOptionsMemento> > opts_mementos;
+    vector<SBlastPrelimBatch> batches;
+
+    ITERATE(vector< CRef<CBlastPrelimSearch> >, it, searches) {
+        CBlastPrelimSearch& search = *it->GetNonNullNCPointer();
+        _ASSERT(search.CanShareScan());
+        search.SetNumberOfThreads(num_threads);
+        SInternalData& data = *search.m_InternalData;
+
+        if (! BlastSeqSrcGetNumSeqs(data.m_SeqSrc->GetPointer())) {
+            string msg =
+                "GI or TI list filtering resulted in an empty database.";
+            search.m_Messages.AddMessageAllQueries(eBlastSevWarning,
+                                                   kBlastMessageNoContext,
+                                                   msg);
+        }
+
+        eff_mementos.push_back(AutoPtr<CEffectiveSearchSpacesMemento>
+            (new CEffectiveSearchSpacesMemento(search.m_Options)));
+        SplitQuery_SetEffectiveSearchSpace(search.m_Options,
+                                           search.m_QueryFactory,
+                                           search.m_InternalData);
+        opts_mementos.push_back(AutoPtr<const CBlastOptionsMemento>
+            (search.m_Options->CreateSnapshot()));
+        const CBlastOptionsMemento* opts = opts_mementos.back().get();
+
+        SBlastProgressReset(data.m_ProgressMonitor->Get());
+        SBlastPrelimBatch batch;
+        batch.query           = data.m_Queries;
+        batch.query_info      = data.m_QueryInfo;
+        batch.sbp             = data.m_ScoreBlk->GetPointer();
+        batch.lookup_wrap     = data.m_LookupTable->GetPointer();
+        batch.score_options   = opts->m_ScoringOpts;
+        batch.word_options    = opts->m_InitWordOpts;
+        batch.ext_options     = opts->m_ExtnOpts;
+        batch.hit_options     = opts->m_HitSaveOpts;
+        batch.eff_len_options = opts->m_EffLenOpts;
+        batch.hsp_stream      = data.m_HspStream->GetPointer();
+        batch.diagnostics     = data.m_Diagnostics->GetPointer();
+        batches.push_back(batch);
+        retval.push_back(search.m_InternalData);
+    }
+
+    // All searches share the database, the first one drives the scan
+    SInternalData& first =
+        *searches.front()->m_InternalData.GetNonNullNCPointer();
+    const CBlastOptionsMemento* first_opts = opts_mementos.front().get();
+    BlastSeqSrc* seqsrc = first.m_SeqSrc->GetPointer();
+    BlastSeqSrcResetChunkIterator(seqsrc);
+    _TRACE("Running shared database scan for " << batches.size()
+           << " query batches with " << num_threads << " threads");
+
+    Uint8 status = 0;
+    if (num_threads > 1) {
+        typedef vector< CRef<CPrelimSearchMultiBatchThread> > TBlastThreads;
+        TBlastThreads the_threads(num_threads);
+        BlastSeqSrcSetNumberOfThreads(seqsrc, (int) num_threads);
+        NON_CONST_ITERATE(TBlastThreads, thread, the_threads) {
+            thread->Reset(new CPrelimSearchMultiBatchThread
+                          (first_opts->m_ProgramType, batches, seqsrc,
+                           first_opts->m_DbOpts, first.m_FnInterrupt,
+                           first.m_ProgressMonitor->Get()));
+        }
+        NON_CONST_ITERATE(TBlastThreads, thread, the_threads) {
+            (*thread)->Run();
+        }
+        NON_CONST_ITERATE(TBlastThreads, thread, the_threads) {
+            void* result(0);
+            (*thread)->Join(&result);
+            if (result) {
+                // see x_LaunchMultiThreadedSearch
+                status = reinterpret_cast<Uint8>(result);
+            }
+        }
+        BlastSeqSrcSetNumberOfThreads(seqsrc, 0);
+    } else {
+        status = Blast_RunPreliminarySearchMultiBatch
+            (first_opts->m_ProgramType, &batches[0], (Int4) batches.size(),
+             seqsrc, first_opts->m_DbOpts, first.m_FnInterrupt,
+             first.m_ProgressMonitor->Get());
+    }
+
+    if (status) {
+        NCBI_THROW(CBlastException, eCoreBlastError,
+                   BlastErrorCode2String((Int2)status));
+    }
+    return retval;
+}
+
 int
 CBlastPrelimSearch::CheckInternalData()
 {
@@ -54,6 +54,7 @@
 #include <algo/blast/core/blast_hspstream.h>
 #include <algo/blast/core/hspfilter_collector.h>
 #include <algo/blast/core/hspfilter_besthit.h>
+#include <algo/blast/core/hspfilter_bounded.h>
 #include <algo/blast/core/hspfilter_culling.h>
 #include <algo/blast/core/hspfilter_mapper.h>
 
@@ -337,6 +338,15 @@ CSetupFactory::CreateHspWriter(const CBlastOptionsMemento* opts_memento,
                      opts_memento->m_ScoringOpts->gapped_calculation);
             writer_info = BlastHSPCullingInfoNew(params);
         }
+    } else if (opts_memento->m_HitSaveOpts->prelim_memory_limit > 0 &&
+               !Blast_ProgramIsRpsBlast(opts_memento->m_ProgramType)) {
+        /* Collect as the default does, but spill HSPs to disk when they
+           exceed the memory budget */
+        BlastHSPBoundedParams* params =
+            BlastHSPBoundedParamsNew(opts_memento->m_HitSaveOpts,
+                       opts_memento->m_ExtnOpts->compositionBasedStats,
+                       opts_memento->m_ScoringOpts->gapped_calculation);
+        writer_info = BlastHSPBoundedInfoNew(params);
     } else {
         /* Use the collector filtering algorithm as the default */
         BlastHSPCollectorParams * params = 
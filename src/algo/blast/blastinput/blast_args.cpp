@@ -183,6 +183,14 @@ CGenericSearchArgs::SetArgumentDescriptions(CArgDescriptions& arg_desc)
     arg_desc.SetConstraint(kArgMaxHSPsPerSubject,
                            new CArgAllowValuesGreaterThanOrEqual(1));
 
+    arg_desc.AddOptionalKey(kArgPrelimMemoryLimit, "int_value",
+                            "Approximate memory (in megabytes) the HSPs saved "
+                            "by the preliminary search may occupy before they "
+                            "are spilled to disk (0: no limit)",
+                            CArgDescriptions::eInteger);
+    arg_desc.SetConstraint(kArgPrelimMemoryLimit,
+                           new CArgAllowValuesGreaterThanOrEqual(0));
+
     arg_desc.SetCurrentGroup("Extension options");
     // ungapped X-drop
     // Default values: blastn=20, megablast=10, others=7
@@ -287,6 +295,11 @@ CGenericSearchArgs::ExtractAlgorithmOptions(const CArgs& args,
     if (args.Exist(kArgSumStats) && args[kArgSumStats]) {
         opt.SetSumStatisticsMode(args[kArgSumStats].AsBoolean());
     }
+
+    if (args.Exist(kArgPrelimMemoryLimit) && args[kArgPrelimMemoryLimit]) {
+        opt.SetPrelimMemoryLimit
+            (Int8(args[kArgPrelimMemoryLimit].AsInteger()) * 1024 * 1024);
+    }
 }
 
 void
@@ -2597,6 +2610,22 @@ CMTArgs::SetArgumentDescriptions(CArgDescriptions& arg_desc)
                            kArgUseIndex);
     */
 #endif
+    if (m_SupportsThroughputMode) {
+        arg_desc.AddDefaultKey(kArgThroughputBatches, "int_value",
+                               "Number of query batches to search with a "
+                               "single scan of the database "
+                               "(throughput mode for many short queries, "
+                               "1 disables it)",
+                               CArgDescriptions::eInteger, "1");
+        arg_desc.SetConstraint(kArgThroughputBatches,
+                               new CArgAllowValuesGreaterThanOrEqual(1));
+        arg_desc.SetDependency(kArgThroughputBatches,
+                               CArgDescriptions::eExcludes,
+                               kArgRemote);
+        arg_desc.SetDependency(kArgThroughputBatches,
+                               CArgDescriptions::eExcludes,
+                               kArgSubject);
+    }
     arg_desc.SetCurrentGroup("");
 }
 
@@ -2646,6 +2675,10 @@ CMTArgs::ExtractAlgorithmOptions(const CArgs& args, CBlastOptions& /* opts */)
                      << "ignored when '" << kArgSubject << "' is specified.");
         }
     }
+    if (args.Exist(kArgThroughputBatches) &&
+        args[kArgThroughputBatches].HasValue()) {
+        m_ThroughputBatches = args[kArgThroughputBatches].AsInteger();
+    }
 }
 
 void
@@ -105,7 +105,7 @@ CBlastnAppArgs::CBlastnAppArgs()
     arg.Reset(m_FormattingArgs);
     m_Args.push_back(arg);
 
-    m_MTArgs.Reset(new CMTArgs);
+    m_MTArgs.Reset(new CMTArgs(false, true));
     arg.Reset(m_MTArgs);
     m_Args.push_back(arg);
 
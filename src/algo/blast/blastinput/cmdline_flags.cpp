@@ -69,6 +69,7 @@ const string kArgDbGeneticCode("db_gencode");
 
 const string kArgRemote("remote");
 const string kArgNumThreads("num_threads");
+const string kArgThroughputBatches("throughput_batches");
 
 const string kArgMatrixName("matrix");
 
@@ -193,6 +194,7 @@ const string kArgDPenalty("D_penalty");
 const string kArgJPenalty("J_penalty");
 const string kArgIgSeqType("ig_seqtype");
 const string kArgMaxHSPsPerSubject("max_hsps");
+const string kArgPrelimMemoryLimit("prelim_mem_limit");
 const string kArgSumStats("sum_stats");
 const string kArgPercentIdentity("perc_identity");
 const string kArgNoGreedyExtension("no_greedy");
@@ -1456,6 +1456,197 @@ static Int4 s_GetMinimumSubjSeqLen(LookupTableWrap* lookup_wrap)
 }
 
 
+/** Runs the preliminary search of one query set against a single subject
+ * sequence and saves the resulting HSPs in the HSP stream. This is the body
+ * of the subject loop in BLAST_PreliminarySearchEngine, shared with
+ * Blast_RunPreliminarySearchMultiBatch.
+ * @param program_number BLAST program type [in]
+ * @param query Query sequence(s) [in]
+ * @param query_info Query information [in]
+ * @param seq_src Source of subject sequences [in]
+ * @param subject Subject sequence, already retrieved from seq_src [in]
+ * @param db_length Total length of the database, 0 if not a database
+ *                  search [in]
+ * @param lookup_wrap Lookup table [in]
+ * @param gap_align Gapped alignment structure [in]
+ * @param score_params Scoring parameters [in]
+ * @param word_params Initial word parameters [in]
+ * @param ext_params Gapped extension parameters [in]
+ * @param hit_params Hit saving parameters [in]
+ * @param eff_len_params Effective lengths parameters [in]
+ * @param db_options Database options [in]
+ * @param diagnostics Hit counts [in] [out]
+ * @param aux_struct Word finder and extension structures [in]
+ * @param hsp_stream Structure for saving the results [in] [out]
+ * @param interrupt_search Interrupt callback [in]
+ * @param progress_info Search progress information [in] [out]
+ * @return Status, 0 on success
+ */
+static Int2
+s_PreliminarySearchOneSubject(EBlastProgramType program_number,
+    BLAST_SequenceBlk* query, BlastQueryInfo* query_info,
+    const BlastSeqSrc* seq_src, BLAST_SequenceBlk* subject, Int8 db_length,
+    LookupTableWrap* lookup_wrap, BlastGapAlignStruct* gap_align,
+    BlastScoringParameters* score_params,
+    BlastInitialWordParameters* word_params,
+    BlastExtensionParameters* ext_params,
+    BlastHitSavingParameters* hit_params,
+    BlastEffectiveLengthsParameters* eff_len_params,
+    const BlastDatabaseOptions* db_options,
+    BlastDiagnostics* diagnostics, BlastCoreAuxStruct* aux_struct,
+    BlastHSPStream* hsp_stream,
+    TInterruptFnPtr interrupt_search, SBlastProgress* progress_info)
+{
+    BlastHSPList* hsp_list = NULL;
+    Int2 status = 0;
+    Int4 stat_length;
+    const BlastScoringOptions* score_options = score_params->options;
+    Boolean gapped_calculation = score_options->gapped_calculation;
+    BlastScoreBlk* sbp = gap_align->sbp;
+    const Boolean kNucleotide = Blast_ProgramIsNucleotide(program_number);
+
+    if (db_length == 0) {
+         /* This is not a database search, hence need to recalculate and save
+          the effective search spaces and length adjustments for all
+          queries based on the length of the current single subject
+          sequence. */
+         if ((status = BLAST_OneSubjectUpdateParameters(program_number,
+                        subject->length, score_options, query_info,
+                        sbp, hit_params, word_params,
+                        eff_len_params)) != 0)
+            return status;
+    }
+
+    stat_length = subject->length;
+
+    /* Calculate cutoff scores for linking HSPs. Do this only for
+       ungapped protein searches and ungapped translated
+       searches. */
+    if (hit_params->link_hsp_params && !kNucleotide &&
+        !gapped_calculation) {
+        CalculateLinkHSPCutoffs(program_number, query_info, sbp,
+          hit_params->link_hsp_params, word_params, db_length,
+          subject->length);
+    }
+
+    if (Blast_SubjectIsTranslated(program_number)) {
+        /* If the subject is translated and the BlastSeqSrc implementation
+         * doesn't provide a genetic code string, use the default genetic
+         * code for all subjects (as in the C toolkit) */
+        if (subject->gen_code_string == NULL) {
+            subject->gen_code_string =
+                GenCodeSingletonFind(db_options->genetic_code);
+        }
+        ASSERT(subject->gen_code_string);
+        stat_length /= CODON_LENGTH;
+    }
+    status =
+        s_BlastSearchEngineCore(program_number, query, query_info,
+                                subject, lookup_wrap, gap_align,
+                                score_params, word_params, ext_params,
+                                hit_params, db_options, diagnostics,
+                                aux_struct, &hsp_list, hsp_stream,
+                                interrupt_search, progress_info);
+    if (status) {
+        hsp_list = Blast_HSPListFree(hsp_list);
+        return status;
+    }
+
+    if (hsp_list && hsp_list->hspcnt > 0) {
+       int query_index=0; /* Used to loop over queries below. */
+       if (!gapped_calculation) {
+      	 if(subject->bases_offset > 0)
+      	 {
+      		 if (Blast_SubjectIsTranslated(program_number))
+      		 	 s_AdjustSubjectForTranslatedSraSearch(hsp_list, subject->bases_offset, subject->length);
+      		 else
+      			 s_AdjustSubjectForSraSearch(hsp_list, subject->bases_offset);
+      	 }
+          /* The following must be performed for any ungapped
+             search with a nucleotide database. */
+             status =
+                Blast_HSPListReevaluateUngapped(
+                          program_number, hsp_list, query,
+                          subject, word_params, hit_params,
+                          query_info, sbp, score_params, seq_src,
+                          subject->gen_code_string);
+             if (status) {
+                hsp_list = Blast_HSPListFree(hsp_list);
+                return status;
+             }
+             /* Relink HSPs if sum statistics is used, because scores might
+              * have changed after reevaluation with ambiguities, and there
+              * will be no traceback stage where relinking is done normally.
+              * If sum statistics are not used, just recalculate e-values.
+              */
+             if (hit_params->link_hsp_params) {
+                 status =
+                     BLAST_LinkHsps(program_number, hsp_list, query_info,
+                                    subject->length, sbp,
+                                    hit_params->link_hsp_params,
+                                    gapped_calculation);
+             } else {
+                Blast_HSPListGetEvalues(program_number, query_info,
+                                        stat_length, hsp_list,
+                                        gapped_calculation, FALSE,
+                                        sbp, 0, 1.0);
+             }
+             /* Use score threshold rather than evalue if
+              * matrix_only_scoring is used.  -RMH-
+              */
+             if ( sbp->matrix_only_scoring )
+             {
+                 status = Blast_HSPListReapByRawScore(hsp_list,
+                                        hit_params->options);
+             }else {
+      	   status = s_Blast_HSPListReapByPrelimEvalue(hsp_list, hit_params);
+             }
+
+             Blast_HSPListReapByQueryCoverage(hsp_list,hit_params->options, query_info, program_number);
+          /* Calculate and fill the bit scores, since there will be no
+             traceback stage where this can be done. */
+          Blast_HSPListGetBitScores(hsp_list, gapped_calculation, sbp);
+       }
+
+       // This should only happen for sra searches
+       if((subject->bases_offset > 0) && (gapped_calculation))
+       {
+      	 if (Blast_SubjectIsTranslated(program_number))
+      		 s_AdjustSubjectForTranslatedSraSearch(hsp_list, subject->bases_offset, subject->length);
+      	 else
+      		 s_AdjustSubjectForSraSearch(hsp_list, subject->bases_offset);
+       }
+
+       /* Save the results. */
+       status = BlastHSPStreamWrite(hsp_stream, &hsp_list);
+       if (status != 0) {
+          hsp_list = Blast_HSPListFree(hsp_list);
+          return status;
+       }
+
+       /* Do anchored search for mapping */
+       if (Blast_ProgramIsMapping(program_number) && getenv("MAPPER_ANCHOR")) {
+           Int4 word_size = 12;
+
+           DoAnchoredSearch(query, subject, word_size,
+                            query_info, gap_align, score_params,
+                            hit_params, hsp_stream);
+       }
+
+       if (hit_params->low_score)
+       {
+ 	    for (query_index=0; query_index<hsp_stream->results->num_queries; query_index++)
+            if (hsp_stream->results->hitlist_array[query_index] && hsp_stream->results->hitlist_array[query_index]->heapified)
+                 hit_params->low_score[query_index] =
+			MAX(hit_params->low_score[query_index],
+                         hit_params->options->low_score_perc*(hsp_stream->results->hitlist_array[query_index]->low_score));
+       }
+    }
+
+    hsp_list = Blast_HSPListFree(hsp_list);
+    return status;
+}
+
 Int4
 BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
     BLAST_SequenceBlk* query, BlastQueryInfo* query_info,
@@ -1472,7 +1663,6 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
     TInterruptFnPtr interrupt_search, SBlastProgress* progress_info)
 {
     BlastCoreAuxStruct* aux_struct = NULL;
-    BlastHSPList* hsp_list = NULL;
     BlastSeqSrcGetSeqArg seq_arg;
     Int2 status = 0;
     Int8 db_length = 0;
@@ -1484,7 +1674,6 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
     Boolean gapped_calculation = score_options->gapped_calculation;
     BlastScoreBlk* sbp = gap_align->sbp;
     BlastSeqSrcIterator* itr;
-    const Boolean kNucleotide = Blast_ProgramIsNucleotide(program_number);
 
     T_MB_IdbCheckOid check_index_oid =
         (T_MB_IdbCheckOid)lookup_wrap->check_index_oid;
@@ -1536,7 +1725,6 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
     /* iterate over all subject sequences */
     while ( (seq_arg.oid = BlastSeqSrcIteratorNext(seq_src, itr))
            != BLAST_SEQSRC_EOF) {
-       Int4 stat_length;
        if (seq_arg.oid == BLAST_SEQSRC_ERROR) {
     	   status = BLASTERR_SEQSRC;
            break;
@@ -1556,149 +1744,19 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
            continue;
        }
 
-       if (db_length == 0) {
-           /* This is not a database search, hence need to recalculate and save
-            the effective search spaces and length adjustments for all
-            queries based on the length of the current single subject
-            sequence. */
-           if ((status = BLAST_OneSubjectUpdateParameters(program_number,
-                          seq_arg.seq->length, score_options, query_info,
-                          sbp, hit_params, word_params,
-                          eff_len_params)) != 0)
-              return status;
-      }
-
-      stat_length = seq_arg.seq->length;
-
-      /* Calculate cutoff scores for linking HSPs. Do this only for
-         ungapped protein searches and ungapped translated
-         searches. */
-      if (hit_params->link_hsp_params && !kNucleotide &&
-          !gapped_calculation) {
-          CalculateLinkHSPCutoffs(program_number, query_info, sbp,
-            hit_params->link_hsp_params, word_params, db_length,
-            seq_arg.seq->length);
-      }
-
-      if (Blast_SubjectIsTranslated(program_number)) {
-          /* If the subject is translated and the BlastSeqSrc implementation
-           * doesn't provide a genetic code string, use the default genetic
-           * code for all subjects (as in the C toolkit) */
-          if (seq_arg.seq->gen_code_string == NULL) {
-              seq_arg.seq->gen_code_string =
-                  GenCodeSingletonFind(db_options->genetic_code);
-          }
-          ASSERT(seq_arg.seq->gen_code_string);
-          stat_length /= CODON_LENGTH;
-      }
       status =
-          s_BlastSearchEngineCore(program_number, query, query_info,
-                                  seq_arg.seq, lookup_wrap, gap_align,
-                                  score_params, word_params, ext_params,
-                                  hit_params, db_options, diagnostics,
-                                  aux_struct, &hsp_list, hsp_stream,
-                                  interrupt_search, progress_info);
+          s_PreliminarySearchOneSubject(program_number, query, query_info,
+                                        seq_src, seq_arg.seq, db_length,
+                                        lookup_wrap, gap_align, score_params,
+                                        word_params, ext_params, hit_params,
+                                        eff_len_params, db_options,
+                                        diagnostics, aux_struct, hsp_stream,
+                                        interrupt_search, progress_info);
       if (status) {
+          BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
           break;
       }
 
-      if (hsp_list && hsp_list->hspcnt > 0) {
-         int query_index=0; /* Used to loop over queries below. */
-         if (!gapped_calculation) {
-        	 if(seq_arg.seq->bases_offset > 0)
-        	 {
-        		 if (Blast_SubjectIsTranslated(program_number))
-        		 	 s_AdjustSubjectForTranslatedSraSearch(hsp_list, seq_arg.seq->bases_offset, seq_arg.seq->length);
-        		 else
-        			 s_AdjustSubjectForSraSearch(hsp_list, seq_arg.seq->bases_offset);
-        	 }
-            /* The following must be performed for any ungapped
-               search with a nucleotide database. */
-               status =
-                  Blast_HSPListReevaluateUngapped(
-                            program_number, hsp_list, query,
-                            seq_arg.seq, word_params, hit_params,
-                            query_info, sbp, score_params, seq_src,
-                            seq_arg.seq->gen_code_string);
-               if (status) {
-                  /* Tell the indexing library that this thread is done with
-                     preliminary search.
-                  */
-                  if( check_index_oid != 0 ) {
-                    ((T_MB_IdxEndSearchIndication)(
-                        lookup_wrap->end_search_indication))( last_vol_idx );
-                  }
-
-                  BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
-                  return status;
-               }
-               /* Relink HSPs if sum statistics is used, because scores might
-                * have changed after reevaluation with ambiguities, and there
-                * will be no traceback stage where relinking is done normally.
-                * If sum statistics are not used, just recalculate e-values.
-                */
-               if (hit_params->link_hsp_params) {
-                   status =
-                       BLAST_LinkHsps(program_number, hsp_list, query_info,
-                                      seq_arg.seq->length, sbp,
-                                      hit_params->link_hsp_params,
-                                      gapped_calculation);
-               } else {
-                  Blast_HSPListGetEvalues(program_number, query_info,
-                                          stat_length, hsp_list,
-                                          gapped_calculation, FALSE,
-                                          sbp, 0, 1.0);
-               }
-               /* Use score threshold rather than evalue if
-                * matrix_only_scoring is used.  -RMH-
-                */
-               if ( sbp->matrix_only_scoring )
-               {
-                   status = Blast_HSPListReapByRawScore(hsp_list,
-                                          hit_params->options);
-               }else {
-        	   status = s_Blast_HSPListReapByPrelimEvalue(hsp_list, hit_params);
-               }
-
-               Blast_HSPListReapByQueryCoverage(hsp_list,hit_params->options, query_info, program_number);
-            /* Calculate and fill the bit scores, since there will be no
-               traceback stage where this can be done. */
-            Blast_HSPListGetBitScores(hsp_list, gapped_calculation, sbp);
-         }
-
-         // This should only happen for sra searches
-         if((seq_arg.seq->bases_offset > 0) && (gapped_calculation))
-         {
-        	 if (Blast_SubjectIsTranslated(program_number))
-        		 s_AdjustSubjectForTranslatedSraSearch(hsp_list, seq_arg.seq->bases_offset, seq_arg.seq->length);
-        	 else
-        		 s_AdjustSubjectForSraSearch(hsp_list, seq_arg.seq->bases_offset);
-         }
-
-         /* Save the results. */
-         status = BlastHSPStreamWrite(hsp_stream, &hsp_list);
-         if (status != 0)
-            break;
-
-         /* Do anchored search for mapping */
-         if (Blast_ProgramIsMapping(program_number) && getenv("MAPPER_ANCHOR")) {
-             Int4 word_size = 12;
-
-             DoAnchoredSearch(query, seq_arg.seq, word_size,
-                              query_info, gap_align, score_params,
-                              hit_params, hsp_stream);
-         }
-
-         if (hit_params->low_score)
-         {
- 	    for (query_index=0; query_index<hsp_stream->results->num_queries; query_index++)
-              if (hsp_stream->results->hitlist_array[query_index] && hsp_stream->results->hitlist_array[query_index]->heapified)
-                   hit_params->low_score[query_index] =
-			MAX(hit_params->low_score[query_index],
-                           hit_params->options->low_score_perc*(hsp_stream->results->hitlist_array[query_index]->low_score));
-         }
-      }
-
       BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
 
       /* check for interrupt */
@@ -1716,7 +1774,6 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
             lookup_wrap->end_search_indication))( last_vol_idx );
     }
 
-    hsp_list = Blast_HSPListFree(hsp_list);  /* in case we were interrupted */
     BlastSequenceBlkFree(seq_arg.seq);
     itr = BlastSeqSrcIteratorFree(itr);
 
@@ -1819,6 +1876,203 @@ Blast_RunPreliminarySearchWithInterrupt(EBlastProgramType program,
     return status;
 }
 
+/** Per-batch structures used by Blast_RunPreliminarySearchMultiBatch */
+typedef struct SPrelimBatchState {
+    BlastScoringParameters* score_params; /**< Scoring parameters */
+    BlastExtensionParameters* ext_params; /**< Gapped extension parameters */
+    BlastHitSavingParameters* hit_params; /**< Hit saving parameters */
+    BlastEffectiveLengthsParameters* eff_len_params; /**< Effective lengths
+                                                        parameters */
+    BlastGapAlignStruct* gap_align;       /**< Gapped alignment structure */
+    BlastInitialWordParameters* word_params; /**< Initial word parameters */
+    BlastCoreAuxStruct* aux_struct;       /**< Word finder structures */
+    BlastDiagnostics* local_diagnostics;  /**< Unshared diagnostics */
+} SPrelimBatchState;
+
+/** Frees the per-batch structures and merges the diagnostics of a batch.
+ * @param batch Input of the batch [in]
+ * @param state Per-batch structures to free [in]
+ */
+static void
+s_PrelimBatchStateCleanUp(const SBlastPrelimBatch* batch,
+                          SPrelimBatchState* state)
+{
+    if (state->local_diagnostics) {
+        if (state->word_params && state->local_diagnostics->cutoffs) {
+            s_FillReturnCutoffsInfo(state->local_diagnostics->cutoffs,
+                                    state->score_params, state->word_params,
+                                    state->ext_params, state->hit_params);
+        }
+        if (batch->diagnostics) {
+            Blast_DiagnosticsUpdate(batch->diagnostics,
+                                    state->local_diagnostics);
+        }
+        state->local_diagnostics =
+            Blast_DiagnosticsFree(state->local_diagnostics);
+    }
+    if (state->word_params)
+        state->word_params =
+            BlastInitialWordParametersFree(state->word_params);
+    if (state->aux_struct)
+        state->aux_struct = s_BlastCoreAuxStructFree(state->aux_struct);
+    if (state->gap_align) {
+        /* Do not destruct score block here */
+        state->gap_align->sbp = NULL;
+        state->gap_align = BLAST_GapAlignStructFree(state->gap_align);
+    }
+    state->score_params = BlastScoringParametersFree(state->score_params);
+    state->hit_params = BlastHitSavingParametersFree(state->hit_params);
+    state->ext_params = BlastExtensionParametersFree(state->ext_params);
+    state->eff_len_params =
+        BlastEffectiveLengthsParametersFree(state->eff_len_params);
+}
+
+Int2
+Blast_RunPreliminarySearchMultiBatch(EBlastProgramType program,
+    SBlastPrelimBatch* batches, Int4 num_batches,
+    const BlastSeqSrc* seq_src, const BlastDatabaseOptions* db_options,
+    TInterruptFnPtr interrupt_search, SBlastProgress* progress_info)
+{
+    Int2 status = 0;
+    Int4 index;
+    Int4 min_subj_seq_length = 1;
+    Int8 db_length = 0;
+    BlastSeqSrcGetSeqArg seq_arg;
+    BlastSeqSrcIterator* itr = NULL;
+    SPrelimBatchState* states = NULL;
+
+    if (!batches || num_batches <= 0 || !seq_src)
+        return BLASTERR_INVALIDPARAM;
+
+    /* RPS-BLAST has no loop over the subject sequences and the database
+       index drives the subject loop on its own, so neither can share it. */
+    if (Blast_ProgramIsRpsBlast(program))
+        return BLASTERR_INVALIDPARAM;
+    for (index = 0; index < num_batches; index++) {
+        if (batches[index].lookup_wrap->check_index_oid != 0)
+            return BLASTERR_INVALIDPARAM;
+    }
+
+    states = (SPrelimBatchState*)
+        calloc(num_batches, sizeof(SPrelimBatchState));
+    if (!states)
+        return BLASTERR_MEMORY;
+
+    for (index = 0; index < num_batches && status == 0; index++) {
+        SBlastPrelimBatch* batch = &batches[index];
+        SPrelimBatchState* state = &states[index];
+
+        /* Use a local diagnostics structure, see
+           Blast_RunPreliminarySearchWithInterrupt */
+        state->local_diagnostics = Blast_DiagnosticsInit();
+        status = BLAST_GapAlignSetUp(program, seq_src, batch->score_options,
+                                     batch->eff_len_options,
+                                     batch->ext_options, batch->hit_options,
+                                     batch->query_info, batch->sbp,
+                                     &state->score_params, &state->ext_params,
+                                     &state->hit_params,
+                                     &state->eff_len_params,
+                                     &state->gap_align);
+        if (status)
+            break;
+
+        BlastInitialWordParametersNew(program, batch->word_options,
+            state->hit_params, batch->lookup_wrap, batch->sbp,
+            batch->query_info, BlastSeqSrcGetAvgSeqLen(seq_src),
+            &state->word_params);
+
+        status = s_BlastSetUpAuxStructures(seq_src, batch->lookup_wrap,
+                     state->word_params, batch->ext_options,
+                     batch->hit_options, batch->query, batch->query_info,
+                     &state->aux_struct);
+        if (status)
+            break;
+
+        BlastLinkHSPParametersUpdate(state->word_params, state->hit_params,
+            batch->score_options->gapped_calculation);
+
+        /* Subjects too short for every batch are skipped before the batch
+           loop, see the per-batch check below */
+        if (Blast_SubjectIsTranslated(program)) {
+            Int4 batch_min_length = s_GetMinimumSubjSeqLen(batch->lookup_wrap);
+            min_subj_seq_length = (index == 0) ? batch_min_length :
+                                  MIN(min_subj_seq_length, batch_min_length);
+        }
+    }
+
+    if (progress_info)
+        progress_info->stage = ePrelimSearch;
+
+    memset((void*) &seq_arg, 0, sizeof(seq_arg));
+    seq_arg.encoding = eBlastEncodingProtein;
+    db_length = BlastSeqSrcGetTotLen(seq_src);
+
+    if (status == 0) {
+        itr = BlastSeqSrcIteratorNewEx(
+                  MAX(BlastSeqSrcGetNumSeqs(seq_src)/100,1));
+    }
+
+    /* Each subject sequence is fetched once and then run against the
+       lookup tables of all batches while it is still in cache. */
+    while (status == 0 &&
+           (seq_arg.oid = BlastSeqSrcIteratorNext(seq_src, itr))
+           != BLAST_SEQSRC_EOF) {
+        if (seq_arg.oid == BLAST_SEQSRC_ERROR) {
+            status = BLASTERR_SEQSRC;
+            break;
+        }
+
+        if (BlastSeqSrcGetSequence(seq_src, &seq_arg) < 0) {
+            continue;
+        }
+
+        if (seq_arg.seq->length < min_subj_seq_length) {
+            BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
+            continue;
+        }
+
+        for (index = 0; index < num_batches; index++) {
+            SBlastPrelimBatch* batch = &batches[index];
+            SPrelimBatchState* state = &states[index];
+
+            if (Blast_SubjectIsTranslated(program) &&
+                seq_arg.seq->length <
+                s_GetMinimumSubjSeqLen(batch->lookup_wrap)) {
+                continue;
+            }
+
+            status =
+                s_PreliminarySearchOneSubject(program, batch->query,
+                    batch->query_info, seq_src, seq_arg.seq, db_length,
+                    batch->lookup_wrap, state->gap_align,
+                    state->score_params, state->word_params,
+                    state->ext_params, state->hit_params,
+                    state->eff_len_params, db_options,
+                    state->local_diagnostics, state->aux_struct,
+                    batch->hsp_stream, interrupt_search, progress_info);
+            if (status)
+                break;
+        }
+
+        BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
+
+        if (status == 0 && interrupt_search &&
+            (*interrupt_search)(progress_info) == TRUE) {
+            status = BLASTERR_INTERRUPTED;
+        }
+    }
+
+    BlastSequenceBlkFree(seq_arg.seq);
+    itr = BlastSeqSrcIteratorFree(itr);
+
+    for (index = 0; index < num_batches; index++) {
+        s_PrelimBatchStateCleanUp(&batches[index], &states[index]);
+    }
+    sfree(states);
+
+    return status;
+}
+
 /** Function to deallocate data structures allocated in Blast_RunFullSearch */
 static void
 s_BlastRunFullSearchCleanUp(BlastGapAlignStruct* gap_align,
@@ -1518,6 +1518,13 @@ BlastHitSavingOptionsValidate(EBlastProgramType program_number,
 		return BLASTERR_OPTION_VALUE_INVALID;
 	}	
 
+	if (options->prelim_memory_limit < 0)
+	{
+		Blast_MessageWrite(blast_msg, eBlastSevError, kBlastMessageNoContext,
+                    "memory limit must be greater than or equal to zero");
+		return BLASTERR_OPTION_VALUE_INVALID;
+	}	
+
     if (options->hsp_filt_opt) {
         if (BlastHSPFilteringOptionsValidate(options->hsp_filt_opt) != 0) {
             Blast_MessageWrite(blast_msg, eBlastSevError, kBlastMessageNoContext,
@@ -0,0 +1,689 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file hspfilter_bounded.c
+ * Implementation of the BlastHSPWriter interface which saves hits the same
+ * way as the default collector, while keeping the memory taken by the saved
+ * HSPs within a budget by spilling them to a temporary file.
+ */
+
+
+#include <algo/blast/core/hspfilter_bounded.h>
+#include <algo/blast/core/blast_util.h>
+#include "blast_hits_priv.h"
+
+/** Header of one spilled HSP list in the temporary file, followed by hspcnt
+ * BlastHSP structures. A BlastHSP with gap_info set is followed by the size
+ * of its edit script and the op_type and num arrays. */
+typedef struct SBoundedSpillRecord {
+   Int4 query_index;         /**< query the HSP list belongs to */
+   Int4 oid;                 /**< subject ordinal id of the HSP list */
+   Int4 hspcnt;              /**< number of HSPs that follow */
+   Int4 allocated;           /**< size of the HSP array before spilling */
+} SBoundedSpillRecord;
+
+/** Data structure used by the writer */
+typedef struct BlastHSPBoundedData {
+   BlastHSPBoundedParams* params;   /**< how many hits to save */
+   BlastHSPResults* results;        /**< place to store hits */
+   FILE* spill_file;                /**< temporary file for spilled HSPs */
+   long spill_end;                  /**< end of valid data in spill_file */
+   Boolean spill_failed;            /**< spill file could not be used */
+   Int8 mem_used;                   /**< estimated bytes used by saved HSPs */
+   Int8 next_check;                 /**< recount memory above this value */
+} BlastHSPBoundedData;
+
+/** Estimate the memory occupied by an HSP list
+ * @param hsp_list HSP list to examine [in]
+ * @return number of bytes
+ */
+static Int8
+s_HSPListMemUsage(const BlastHSPList* hsp_list)
+{
+   Int8 retval = (Int8) sizeof(BlastHSPList) +
+                 (Int8) hsp_list->allocated * sizeof(BlastHSP*) +
+                 (Int8) hsp_list->hspcnt * sizeof(BlastHSP);
+   Int4 index;
+
+   for (index = 0; index < hsp_list->hspcnt; ++index) {
+      const GapEditScript* esp = hsp_list->hsp_array[index]->gap_info;
+      if (esp) {
+         retval += (Int8) sizeof(GapEditScript) +
+                   (Int8) esp->size * (sizeof(EGapAlignOpType) + sizeof(Int4));
+      }
+   }
+   return retval;
+}
+
+/** Estimate the memory occupied by all saved HSP lists
+ * @param results Results to examine [in]
+ * @return number of bytes
+ */
+static Int8
+s_ResultsMemUsage(const BlastHSPResults* results)
+{
+   Int8 retval = 0;
+   Int4 query_index, index;
+
+   for (query_index = 0; query_index < results->num_queries; ++query_index) {
+      const BlastHitList* hit_list = results->hitlist_array[query_index];
+      if (!hit_list)
+         continue;
+      for (index = 0; index < hit_list->hsplist_count; ++index)
+         retval += s_HSPListMemUsage(hit_list->hsplist_array[index]);
+   }
+   return retval;
+}
+
+/** Check whether an HSP list is certain to be rejected by a full hit list,
+ * i.e. its best e-value is worse than that of every saved HSP list. Follows
+ * the comparison in Blast_HitListUpdate.
+ * @param hit_list Hit list the HSP list would be saved into [in]
+ * @param hsp_list HSP list to check [in]
+ * @return TRUE if the HSP list can be discarded
+ */
+static Boolean
+s_HSPListIsDominated(const BlastHitList* hit_list, const BlastHSPList* hsp_list)
+{
+   const double kEpsilon = 1.0e-180;
+   double best_evalue = (double) INT4_MAX;
+   Int4 index;
+
+   if (hit_list->hsplist_count < hit_list->hsplist_max)
+      return FALSE;
+
+   for (index = 0; index < hsp_list->hspcnt; ++index)
+      best_evalue = MIN(hsp_list->hsp_array[index]->evalue, best_evalue);
+
+   if (best_evalue < kEpsilon && hit_list->worst_evalue < kEpsilon)
+      return FALSE;
+
+   return (Boolean) (best_evalue > hit_list->worst_evalue);
+}
+
+/** Sort the HSPs of a saved HSP list the way the collector keeps them
+ * @param hit_list Hit list holding the HSP list [in]
+ * @param hsp_list HSP list to sort [in][out]
+ */
+static void
+s_HSPListRestoreOrder(const BlastHitList* hit_list, BlastHSPList* hsp_list)
+{
+   if (hit_list->heapified)
+      Blast_HSPListSortByEvalue(hsp_list);
+   else
+      Blast_HSPListSortByScore(hsp_list);
+}
+
+/** Check whether the HSPs following the first one can be written to the
+ * spill file. The HSP list must already be sorted by e-value, so that these
+ * are exactly the HSPs s_HSPListSpill moves to disk.
+ * @param hsp_list HSP list to check [in]
+ * @return TRUE if the HSP list can be spilled
+ */
+static Boolean
+s_HSPListCanSpill(const BlastHSPList* hsp_list)
+{
+   Int4 index;
+
+   if (hsp_list->hspcnt < 2)
+      return FALSE;
+
+   for (index = 1; index < hsp_list->hspcnt; ++index) {
+      const BlastHSP* hsp = hsp_list->hsp_array[index];
+      /* PHI BLAST and mapping information is not serialized */
+      if (!hsp || hsp->pat_info || hsp->map_info)
+         return FALSE;
+   }
+   return TRUE;
+}
+
+/** Write one HSP to the spill file, with its edit script if any
+ * @param hsp HSP to write [in]
+ * @param file Spill file [in]
+ * @return 0 on success, -1 on write failure
+ */
+static int
+s_HSPWrite(const BlastHSP* hsp, FILE* file)
+{
+   const GapEditScript* esp = hsp->gap_info;
+
+   if (fwrite(hsp, sizeof(BlastHSP), 1, file) != 1)
+      return -1;
+   if (!esp)
+      return 0;
+   if (fwrite(&esp->size, sizeof(esp->size), 1, file) != 1 ||
+       fwrite(esp->op_type, sizeof(EGapAlignOpType), esp->size, file) !=
+          (size_t) esp->size ||
+       fwrite(esp->num, sizeof(Int4), esp->size, file) != (size_t) esp->size)
+      return -1;
+   return 0;
+}
+
+/** Read one HSP written by s_HSPWrite
+ * @param file Spill file [in]
+ * @return the new HSP, NULL on memory allocation or read failure
+ */
+static BlastHSP*
+s_HSPRead(FILE* file)
+{
+   BlastHSP* hsp = (BlastHSP*) malloc(sizeof(BlastHSP));
+   Int4 size;
+
+   if (!hsp)
+      return NULL;
+   if (fread(hsp, sizeof(BlastHSP), 1, file) != 1) {
+      sfree(hsp);
+      return NULL;
+   }
+   /* The pointers in the file are stale; only the presence of an edit
+      script is meaningful. pat_info and map_info are never spilled. */
+   hsp->pat_info = NULL;
+   hsp->map_info = NULL;
+   if (!hsp->gap_info)
+      return hsp;
+
+   hsp->gap_info = NULL;
+   if (fread(&size, sizeof(size), 1, file) != 1 ||
+       (hsp->gap_info = GapEditScriptNew(size)) == NULL ||
+       fread(hsp->gap_info->op_type, sizeof(EGapAlignOpType), size, file) !=
+          (size_t) size ||
+       fread(hsp->gap_info->num, sizeof(Int4), size, file) != (size_t) size) {
+      return Blast_HSPFree(hsp);
+   }
+   return hsp;
+}
+
+/** Move all HSPs but the first one of an HSP list to the spill file
+ * @param data The writer data [in][out]
+ * @param query_index Query the HSP list belongs to [in]
+ * @param hsp_list HSP list to spill, sorted by e-value [in][out]
+ * @return 0 on success, -1 if the spill file could not be written
+ */
+static int
+s_HSPListSpill(BlastHSPBoundedData* data, Int4 query_index,
+               BlastHSPList* hsp_list)
+{
+   SBoundedSpillRecord record;
+   BlastHSP** hsp_array;
+   Int4 index;
+
+   record.query_index = query_index;
+   record.oid = hsp_list->oid;
+   record.hspcnt = hsp_list->hspcnt - 1;
+   record.allocated = hsp_list->allocated;
+
+   if (fwrite(&record, sizeof(record), 1, data->spill_file) != 1)
+      return -1;
+   for (index = 1; index < hsp_list->hspcnt; ++index) {
+      if (s_HSPWrite(hsp_list->hsp_array[index], data->spill_file) != 0)
+         return -1;
+   }
+   data->spill_end = ftell(data->spill_file);
+
+   /* The HSPs are safely on disk, release them. The first HSP stays, it
+      determines the rank of this HSP list in the hit list. */
+   for (index = 1; index < hsp_list->hspcnt; ++index)
+      hsp_list->hsp_array[index] = Blast_HSPFree(hsp_list->hsp_array[index]);
+   hsp_list->hspcnt = 1;
+
+   hsp_array = (BlastHSP**) realloc(hsp_list->hsp_array, sizeof(BlastHSP*));
+   if (hsp_array) {
+      hsp_list->hsp_array = hsp_array;
+      hsp_list->allocated = 1;
+   }
+   return 0;
+}
+
+/** Recount the memory used by the saved HSPs and, if it is over the budget,
+ * spill HSPs to disk until half of the budget is used.
+ * @param data The writer data [in][out]
+ */
+static void
+s_BoundedEnforceLimit(BlastHSPBoundedData* data)
+{
+   BlastHSPResults* results = data->results;
+   const Int8 kLimit = data->params->memory_limit;
+   Int8 mem_used = s_ResultsMemUsage(results);
+   Int4 query_index, index;
+
+   if (mem_used > kLimit && !data->spill_failed) {
+      if (!data->spill_file) {
+         data->spill_file = tmpfile();
+         data->spill_end = 0;
+         if (!data->spill_file)
+            data->spill_failed = TRUE;
+      }
+
+      for (query_index = 0; query_index < results->num_queries &&
+              !data->spill_failed && mem_used > kLimit / 2; ++query_index) {
+         BlastHitList* hit_list = results->hitlist_array[query_index];
+         if (!hit_list)
+            continue;
+         for (index = 0; index < hit_list->hsplist_count &&
+                 mem_used > kLimit / 2; ++index) {
+            BlastHSPList* hsp_list = hit_list->hsplist_array[index];
+            Int8 before;
+
+            if (hsp_list->hspcnt < 2)
+               continue;
+
+            /* The first HSP stays in memory and must be the one
+               Blast_HitListUpdate ranks the HSP list by */
+            Blast_HSPListSortByEvalue(hsp_list);
+            if (!s_HSPListCanSpill(hsp_list)) {
+               s_HSPListRestoreOrder(hit_list, hsp_list);
+               continue;
+            }
+
+            before = s_HSPListMemUsage(hsp_list);
+            if (s_HSPListSpill(data, query_index, hsp_list) != 0) {
+               /* Drop the partial record; keep the rest in memory */
+               fseek(data->spill_file, data->spill_end, SEEK_SET);
+               data->spill_failed = TRUE;
+               break;
+            }
+            mem_used -= before - s_HSPListMemUsage(hsp_list);
+         }
+      }
+   }
+
+   /* If the budget cannot be met (e.g. all HSP lists have a single HSP),
+      avoid recounting after every saved HSP list. */
+   data->mem_used = mem_used;
+   data->next_check = MAX(kLimit, 2 * mem_used);
+}
+
+/** Callback for sorting HSP lists by subject oid
+ * @param v1 first HSP list [in]
+ * @param v2 second HSP list [in]
+ */
+static int
+s_HSPListOidCompare(const void* v1, const void* v2)
+{
+   const BlastHSPList* h1 = *(BlastHSPList**) v1;
+   const BlastHSPList* h2 = *(BlastHSPList**) v2;
+   return BLAST_CMP(h1->oid, h2->oid);
+}
+
+/** Read the spilled HSPs back into the HSP lists that are still saved
+ * @param data The writer data [in][out]
+ * @return 0 on success, -1 on memory allocation or read failure
+ */
+static int
+s_BoundedReloadSpilled(BlastHSPBoundedData* data)
+{
+   BlastHSPResults* results = data->results;
+   BlastHSPList*** sorted_lists;
+   SBoundedSpillRecord record;
+   Int4 query_index;
+   int status = 0;
+
+   sorted_lists = (BlastHSPList***) calloc(results->num_queries,
+                                           sizeof(BlastHSPList**));
+   if (!sorted_lists)
+      return -1;
+
+   /* Index the surviving HSP lists of each query by subject oid */
+   for (query_index = 0; query_index < results->num_queries; ++query_index) {
+      BlastHitList* hit_list = results->hitlist_array[query_index];
+      if (!hit_list || hit_list->hsplist_count == 0)
+         continue;
+      sorted_lists[query_index] = (BlastHSPList**)
+         BlastMemDup(hit_list->hsplist_array,
+                     hit_list->hsplist_count * sizeof(BlastHSPList*));
+      if (!sorted_lists[query_index]) {
+         status = -1;
+         break;
+      }
+      qsort(sorted_lists[query_index], hit_list->hsplist_count,
+            sizeof(BlastHSPList*), s_HSPListOidCompare);
+   }
+
+   rewind(data->spill_file);
+   while (status == 0 && ftell(data->spill_file) < data->spill_end) {
+      BlastHSPList* key_list;
+      BlastHSPList key;
+      BlastHSPList** found = NULL;
+      BlastHSPList* hsp_list;
+      Int4 index;
+
+      if (fread(&record, sizeof(record), 1, data->spill_file) != 1) {
+         status = -1;
+         break;
+      }
+
+      if (record.query_index >= 0 &&
+          record.query_index < results->num_queries &&
+          sorted_lists[record.query_index]) {
+         key.oid = record.oid;
+         key_list = &key;
+         found = (BlastHSPList**)
+            bsearch(&key_list, sorted_lists[record.query_index],
+                    results->hitlist_array[record.query_index]->hsplist_count,
+                    sizeof(BlastHSPList*), s_HSPListOidCompare);
+      }
+
+      if (!found) {
+         /* This HSP list was evicted from the hit list after spilling; the
+            HSPs have variable size, read and drop them */
+         for (index = 0; index < record.hspcnt; ++index) {
+            BlastHSP* hsp = s_HSPRead(data->spill_file);
+            if (!hsp) {
+               status = -1;
+               break;
+            }
+            Blast_HSPFree(hsp);
+         }
+         continue;
+      }
+
+      hsp_list = *found;
+      ASSERT(hsp_list->hspcnt == 1);
+      {
+         BlastHSP** hsp_array = (BlastHSP**)
+            realloc(hsp_list->hsp_array,
+                    MAX(record.allocated, record.hspcnt + 1) *
+                    sizeof(BlastHSP*));
+         if (!hsp_array) {
+            status = -1;
+            break;
+         }
+         hsp_list->hsp_array = hsp_array;
+         hsp_list->allocated = MAX(record.allocated, record.hspcnt + 1);
+      }
+
+      for (index = 0; index < record.hspcnt; ++index) {
+         BlastHSP* hsp = s_HSPRead(data->spill_file);
+         if (!hsp) {
+            status = -1;
+            break;
+         }
+         hsp_list->hsp_array[hsp_list->hspcnt++] = hsp;
+      }
+
+      /* Restore the order the collector would have left the HSPs in */
+      s_HSPListRestoreOrder(results->hitlist_array[record.query_index],
+                            hsp_list);
+   }
+
+   for (query_index = 0; query_index < results->num_queries; ++query_index)
+      sfree(sorted_lists[query_index]);
+   sfree(sorted_lists);
+
+   return status;
+}
+
+/** Save an HSP list for one query into its hit list
+ * @param data The writer data [in][out]
+ * @param query_index Index of the query [in]
+ * @param hsp_list HSP list to save; ownership is taken [in]
+ * @return 0 on success
+ */
+static int
+s_BoundedSaveHSPList(BlastHSPBoundedData* data, Int4 query_index,
+                     BlastHSPList* hsp_list)
+{
+   BlastHSPResults* results = data->results;
+   BlastHSPBoundedParams* params = data->params;
+   BlastHitList* hit_list = results->hitlist_array[query_index];
+   Int8 list_mem;
+   Int2 status;
+
+   if (!hit_list) {
+      results->hitlist_array[query_index] = hit_list =
+         Blast_HitListNew(params->prelim_hitlist_size);
+   }
+
+   if (s_HSPListIsDominated(hit_list, hsp_list)) {
+      Blast_HSPListFree(hsp_list);
+      return 0;
+   }
+
+   list_mem = s_HSPListMemUsage(hsp_list);
+   status = Blast_HitListUpdate(hit_list, hsp_list);
+   if (status)
+      return status;
+
+   data->mem_used += list_mem;
+   if (params->memory_limit > 0 && data->mem_used > data->next_check)
+      s_BoundedEnforceLimit(data);
+
+   return 0;
+}
+
+/*************************************************************/
+/** The following are implementations for BlastHSPWriter ADT */
+
+/** Perform pre-run stage-specific initialization 
+ * @param data The internal data structure [in][out]
+ * @param results The HSP results to operate on  [in]
+ */ 
+static int 
+s_BlastHSPBoundedInit(void* data, void* hsp_results)
+{
+   BlastHSPBoundedData * bnd_data = data;
+   bnd_data->results = (BlastHSPResults*)hsp_results;
+   bnd_data->mem_used = s_ResultsMemUsage(bnd_data->results);
+   bnd_data->next_check = bnd_data->params->memory_limit;
+   return 0;
+}
+
+/** Perform post-run clean-ups
+ * @param data The buffered data structure [in]
+ * @param results The HSP results to propagate [in][out]
+ */ 
+static int 
+s_BlastHSPBoundedFinal(void* data, void* results)
+{
+   BlastHSPBoundedData * bnd_data = data;
+   int status = 0;
+
+   if (bnd_data->spill_file) {
+      if (bnd_data->results)
+         status = s_BoundedReloadSpilled(bnd_data);
+      fclose(bnd_data->spill_file);
+      bnd_data->spill_file = NULL;
+   }
+   bnd_data->results = NULL;
+   return status;
+}
+
+/** Perform writing task
+ * ownership of the HSP list and sets the dereferenced pointer to NULL.
+ * @param data To store results to [in][out]
+ * @param hsp_list Pointer to the HSP list to save in the collector. [in]
+ */
+static int 
+s_BlastHSPBoundedRun(void* data, BlastHSPList* hsp_list)
+{
+   BlastHSPBoundedData * bnd_data = data;
+   BlastHSPResults* results = bnd_data->results;
+   BlastHSPBoundedParams* params = bnd_data->params;
+   EBlastProgramType program;
+   int status = 0;
+
+   if (!hsp_list)
+      return 0;
+
+   if (!results || !params)
+      return -1;
+
+   program = params->program;
+
+   /* Rearrange HSPs into multiple hit lists if more than one query */
+   if (results->num_queries > 1) {
+      BlastHSP* hsp;
+      BlastHSPList** hsp_list_array;
+      BlastHSPList* tmp_hsp_list;
+      Int4 index;
+
+      hsp_list_array = calloc(results->num_queries, sizeof(BlastHSPList*));
+      if (hsp_list_array == NULL)
+         return -1;
+
+      for (index = 0; index < hsp_list->hspcnt; index++) {
+         Int4 query_index;
+         hsp = hsp_list->hsp_array[index];
+         query_index = Blast_GetQueryIndexFromContext(hsp->context, program);
+
+         if (!(tmp_hsp_list = hsp_list_array[query_index])) {
+            hsp_list_array[query_index] = tmp_hsp_list = 
+               Blast_HSPListNew(params->hsp_num_max);
+            if (tmp_hsp_list == NULL)
+            {
+                 sfree(hsp_list_array);
+                 return -1;
+            }
+            tmp_hsp_list->oid = hsp_list->oid;
+         }
+
+         Blast_HSPListSaveHSP(tmp_hsp_list, hsp);
+         hsp_list->hsp_array[index] = NULL;
+      }
+
+      hsp_list->hspcnt = 0;
+      Blast_HSPListFree(hsp_list);
+
+      for (index = 0; index < results->num_queries; index++) {
+         if (hsp_list_array[index]) {
+            if (status == 0) {
+               status = s_BoundedSaveHSPList(bnd_data, index,
+                                             hsp_list_array[index]);
+            } else {
+               Blast_HSPListFree(hsp_list_array[index]);
+            }
+         }
+      }
+      sfree(hsp_list_array);
+   } else if (hsp_list->hspcnt > 0) {
+      status = s_BoundedSaveHSPList(bnd_data, 0, hsp_list);
+   } else {
+       /* Empty HSPList - free it. */
+       Blast_HSPListFree(hsp_list);
+   }
+       
+   return status; 
+}
+
+/** Free the writer 
+ * @param writer The writer to free [in]
+ * @return NULL.
+ */
+static
+BlastHSPWriter*
+s_BlastHSPBoundedFree(BlastHSPWriter* writer) 
+{
+   BlastHSPBoundedData *data = writer->data;
+   if (data->spill_file)
+      fclose(data->spill_file);
+   sfree(data->params); 
+   sfree(writer->data);
+   sfree(writer);
+   return NULL;
+}
+
+/** create the writer
+ * @param params Pointer to the hit paramters [in]
+ * @param query_info BlastQueryInfo (not used) [in]
+ * @return writer
+ */
+static
+BlastHSPWriter* 
+s_BlastHSPBoundedNew(void* params, BlastQueryInfo* query_info,
+                     BLAST_SequenceBlk* sequence)
+{
+   BlastHSPWriter * writer = NULL;
+   BlastHSPBoundedData * data = NULL;
+   BlastHSPBoundedParams * bnd_param = params;
+
+   /* RPS BLAST bundles several subjects in one HSP list, use the collector */
+   ASSERT(!Blast_ProgramIsRpsBlast(bnd_param->program));
+
+   /* allocate space for writer */
+   writer = malloc(sizeof(BlastHSPWriter));
+
+   /* fill up the function pointers */
+   writer->InitFnPtr   = &s_BlastHSPBoundedInit;
+   writer->FinalFnPtr  = &s_BlastHSPBoundedFinal;
+   writer->FreeFnPtr   = &s_BlastHSPBoundedFree;
+   writer->RunFnPtr    = &s_BlastHSPBoundedRun;
+
+   /* allocate for data structure */
+   writer->data = calloc(1, sizeof(BlastHSPBoundedData));
+   data = writer->data;
+   data->params = bnd_param;
+    
+   return writer;
+}
+
+/*************************************************************/
+/** The following are exported functions to be used by APP   */
+
+BlastHSPBoundedParams*
+BlastHSPBoundedParamsNew(const BlastHitSavingOptions* hit_options,
+                         Int4 compositionBasedStats,
+                         Boolean gapped_calculation)
+{
+       BlastHSPBoundedParams* retval=NULL;
+       Int4 prelim_hitlist_size;
+
+       if (hit_options == NULL)
+           return NULL;
+
+       retval = (BlastHSPBoundedParams*) malloc(sizeof(BlastHSPBoundedParams));
+
+       prelim_hitlist_size = hit_options->hitlist_size;
+       if (compositionBasedStats)
+            prelim_hitlist_size = prelim_hitlist_size * 2 + 50;  
+       else if (gapped_calculation)
+            prelim_hitlist_size = MIN(2 * prelim_hitlist_size, 
+                                      prelim_hitlist_size + 50);
+
+       retval->prelim_hitlist_size = MAX(prelim_hitlist_size, 10);
+       retval->hsp_num_max = BlastHspNumMax(gapped_calculation, hit_options);
+       retval->program = hit_options->program_number;
+       retval->memory_limit = hit_options->prelim_memory_limit;
+       return retval;
+}
+
+BlastHSPBoundedParams*
+BlastHSPBoundedParamsFree(BlastHSPBoundedParams* opts)
+{
+    if ( !opts )
+        return NULL;
+    sfree(opts);
+    return NULL;
+}
+
+BlastHSPWriterInfo*
+BlastHSPBoundedInfoNew(BlastHSPBoundedParams* params) {
+   BlastHSPWriterInfo * writer_info =
+                        malloc(sizeof(BlastHSPWriterInfo)); 
+   writer_info->NewFnPtr = &s_BlastHSPBoundedNew;
+   writer_info->params = params;
+   return writer_info;
+}
@@ -420,6 +420,68 @@ BOOST_AUTO_TEST_CASE(testDiscMegaBlastPartialRun)
     }
 }
 
+// Throughput mode must produce the same alignments as searching each query
+// batch on its own, with the tracebacks of the batches run serially or on
+// several threads.
+static void s_CheckThroughputMode(size_t num_threads)
+{
+    const size_t kNumBatches = 4;
+    const TGi kQueryGis[kNumBatches] = { GI_CONST(14702146),
+                                         GI_CONST(186279),
+                                         GI_CONST(555),
+                                         GI_CONST(14702146) };
+    const string kDbName("data/seqn");
+
+    CSearchDatabase dbinfo(kDbName, CSearchDatabase::eBlastDbIsNucleotide);
+    CRef<CLocalDbAdapter> db(new CLocalDbAdapter(dbinfo));
+    CRef<CBlastOptionsHandle> options(new CBlastNucleotideOptionsHandle);
+
+    CLocalBlast::TQueryFactories queries;
+    for (size_t i = 0; i < kNumBatches; i++) {
+        CRef<CSeq_loc> query_loc(new CSeq_loc());
+        query_loc->SetWhole().SetGi(kQueryGis[i]);
+        CScope* query_scope = new CScope(CTestObjMgr::Instance().GetObjMgr());
+        query_scope->AddDefaults();
+        TSeqLocVector query;
+        query.push_back(SSeqLoc(query_loc, query_scope));
+        queries.push_back(CRef<IQueryFactory>
+                          (new CObjMgr_QueryFactory(query)));
+    }
+
+    vector< CRef<CSearchResultSet> > shared =
+        CLocalBlast::RunThroughputMode(queries, options, db, num_threads);
+    BOOST_REQUIRE_EQUAL(kNumBatches, shared.size());
+
+    for (size_t i = 0; i < kNumBatches; i++) {
+        BOOST_REQUIRE(shared[i].NotEmpty());
+        CLocalBlast blaster(queries[i], options, db);
+        CRef<CSearchResultSet> separate = blaster.Run();
+        BOOST_REQUIRE_EQUAL(separate->GetNumResults(),
+                            shared[i]->GetNumResults());
+
+        const CSeq_align_set::Tdata& expected =
+            (*separate)[0].GetSeqAlign()->Get();
+        const CSeq_align_set::Tdata& actual =
+            (*shared[i])[0].GetSeqAlign()->Get();
+        BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
+        CSeq_align_set::Tdata::const_iterator e = expected.begin();
+        CSeq_align_set::Tdata::const_iterator a = actual.begin();
+        for (; e != expected.end(); ++e, ++a) {
+            BOOST_REQUIRE((*e)->Equals(**a));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testThroughputModeMatchesBatchByBatch)
+{
+    s_CheckThroughputMode(1);
+}
+
+BOOST_AUTO_TEST_CASE(testThroughputModeThreadsMatchBatchByBatch)
+{
+    s_CheckThroughputMode(3);
+}
+
 BOOST_AUTO_TEST_CASE(testBlastpPrelimSearch) 
 {
     const string kDbName("data/seqp");
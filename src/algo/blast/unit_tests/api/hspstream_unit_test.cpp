@@ -38,6 +38,7 @@
 
 #include <algo/blast/core/blast_hspstream.h>
 #include <algo/blast/core/hspfilter_collector.h>
+#include <algo/blast/core/hspfilter_bounded.h>
 
 #include "test_objmgr.hpp"
 #include "hspstream_test_util.hpp"
@@ -236,4 +237,138 @@ BOOST_AUTO_TEST_CASE(testMultiSeqHSPCollector) {
     hit_options = BlastHitSavingOptionsFree(hit_options);
     BOOST_REQUIRE(hit_options == NULL);
 }
+
+BOOST_AUTO_TEST_CASE(testBoundedHSPCollectorSpillsAndReloads) {
+    const int kNumSubjects = 20;
+    const int kNumHsps = 30;
+    const EBlastProgramType kProgram = eBlastTypeBlastp;
+    
+    BlastExtensionOptions* ext_options = NULL;
+    BlastExtensionOptionsNew(kProgram, &ext_options, true);
+
+    BlastScoringOptions* scoring_options = NULL;
+    BlastScoringOptionsNew(kProgram, &scoring_options);
+
+    BlastHitSavingOptions* hit_options = NULL;
+    BlastHitSavingOptionsNew(kProgram, &hit_options,
+                             scoring_options->gapped_calculation);
+    // Small enough to force spilling after every saved HSP list
+    hit_options->prelim_memory_limit = 1;
+
+    BlastHSPWriterInfo * writer_info = BlastHSPBoundedInfoNew(
+            BlastHSPBoundedParamsNew(
+        hit_options, ext_options->compositionBasedStats,
+        scoring_options->gapped_calculation));
+
+    BlastHSPWriter* writer = BlastHSPWriterNew(&writer_info, NULL, NULL);
+    BOOST_REQUIRE(writer_info == NULL);
+
+    BlastHSPStream* hsp_stream = BlastHSPStreamNew(
+        kProgram, ext_options, FALSE, 1, writer);
+
+    scoring_options = BlastScoringOptionsFree(scoring_options);
+    ext_options = BlastExtensionOptionsFree(ext_options);
+
+    int index, status;
+    for (index = 0; index < kNumSubjects; ++index) { 
+        BlastHSPList* hsp_list = Blast_HSPListNew(0);
+        for (int i = 0; i < kNumHsps; ++i) {
+            BlastHSP* hsp = Blast_HSPNew();
+            hsp->score = 1000 - i;
+            hsp->evalue = (i + 1) * 1.0e-10;
+            Blast_HSPListSaveHSP(hsp_list, hsp);
+        }
+        hsp_list->oid = index;
+        status = BlastHSPStreamWrite(hsp_stream, &hsp_list);
+        BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+    }
+
+    // All HSPs must be back in their lists, in the original order
+    for (index = 0; index < kNumSubjects; ++index) {
+        BlastHSPList* hsp_list = NULL;
+        status = BlastHSPStreamRead(hsp_stream, &hsp_list);
+        BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+        BOOST_REQUIRE_EQUAL(index, (int)hsp_list->oid);
+        BOOST_REQUIRE_EQUAL(kNumHsps, hsp_list->hspcnt);
+        for (int i = 0; i < kNumHsps; ++i) {
+            BOOST_REQUIRE_EQUAL(1000 - i, hsp_list->hsp_array[i]->score);
+        }
+        Blast_HSPListFree(hsp_list);
+    }
+    BlastHSPList* hsp_list = NULL;
+    status = BlastHSPStreamRead(hsp_stream, &hsp_list);
+    BOOST_REQUIRE_EQUAL(kBlastHSPStream_Eof, status);
+    hsp_stream = BlastHSPStreamFree(hsp_stream);
+    hit_options = BlastHitSavingOptionsFree(hit_options);
+}
+
+BOOST_AUTO_TEST_CASE(testBoundedHSPCollectorSpillsEditScripts) {
+    const int kNumSubjects = 10;
+    const int kNumHsps = 12;
+    const EBlastProgramType kProgram = eBlastTypeBlastp;
+    
+    BlastExtensionOptions* ext_options = NULL;
+    BlastExtensionOptionsNew(kProgram, &ext_options, true);
+
+    BlastScoringOptions* scoring_options = NULL;
+    BlastScoringOptionsNew(kProgram, &scoring_options);
+
+    BlastHitSavingOptions* hit_options = NULL;
+    BlastHitSavingOptionsNew(kProgram, &hit_options,
+                             scoring_options->gapped_calculation);
+    hit_options->prelim_memory_limit = 1;
+
+    BlastHSPWriterInfo * writer_info = BlastHSPBoundedInfoNew(
+            BlastHSPBoundedParamsNew(
+        hit_options, ext_options->compositionBasedStats,
+        scoring_options->gapped_calculation));
+
+    BlastHSPWriter* writer = BlastHSPWriterNew(&writer_info, NULL, NULL);
+    BlastHSPStream* hsp_stream = BlastHSPStreamNew(
+        kProgram, ext_options, FALSE, 1, writer);
+
+    scoring_options = BlastScoringOptionsFree(scoring_options);
+    ext_options = BlastExtensionOptionsFree(ext_options);
+
+    int index, status;
+    for (index = 0; index < kNumSubjects; ++index) { 
+        BlastHSPList* hsp_list = Blast_HSPListNew(0);
+        // Worst HSP first, so the writer has to sort before spilling
+        for (int i = kNumHsps - 1; i >= 0; --i) {
+            BlastHSP* hsp = Blast_HSPNew();
+            hsp->score = 1000 - i;
+            hsp->evalue = (i + 1) * 1.0e-10;
+            hsp->gap_info = GapEditScriptNew(i + 1);
+            for (int j = 0; j <= i; ++j) {
+                hsp->gap_info->op_type[j] = eGapAlignSub;
+                hsp->gap_info->num[j] = i;
+            }
+            Blast_HSPListSaveHSP(hsp_list, hsp);
+        }
+        hsp_list->oid = index;
+        status = BlastHSPStreamWrite(hsp_stream, &hsp_list);
+        BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+    }
+
+    // The edit scripts of the spilled HSPs must be read back intact
+    for (index = 0; index < kNumSubjects; ++index) {
+        BlastHSPList* hsp_list = NULL;
+        status = BlastHSPStreamRead(hsp_stream, &hsp_list);
+        BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+        BOOST_REQUIRE_EQUAL(kNumHsps, hsp_list->hspcnt);
+        for (int i = 0; i < kNumHsps; ++i) {
+            const BlastHSP* hsp = hsp_list->hsp_array[i];
+            BOOST_REQUIRE_EQUAL(1000 - i, hsp->score);
+            BOOST_REQUIRE(hsp->gap_info != NULL);
+            BOOST_REQUIRE_EQUAL(i + 1, hsp->gap_info->size);
+            for (int j = 0; j <= i; ++j) {
+                BOOST_REQUIRE_EQUAL(eGapAlignSub, hsp->gap_info->op_type[j]);
+                BOOST_REQUIRE_EQUAL(i, hsp->gap_info->num[j]);
+            }
+        }
+        Blast_HSPListFree(hsp_list);
+    }
+    hsp_stream = BlastHSPStreamFree(hsp_stream);
+    hit_options = BlastHitSavingOptionsFree(hit_options);
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -252,6 +252,7 @@ public:
 
     void Init(void);
     int  Run (void);
+    void Exit(void);
 
     bool HandleSeqEntry(CRef<CSeq_entry>& se);
     bool HandleSeqEntry(const CSeq_entry_Handle& seh);
@@ -282,6 +283,7 @@ private:
         const CArgs& args, CSeq_loc& loc);
     CBioseq_Handle x_DeduceTarget(const CSeq_entry_Handle& entry);
     void x_CreateCancelBenchmarkCallback(void);
+    void x_GenerateJobs(void);
 
     // data
     CRef<CObjectManager>        m_Objmgr;       // Object Manager
@@ -300,11 +302,23 @@ private:
     CRef<CFlatFileGenerator>    m_FFGenerator;  // Flat-file generator
     auto_ptr<ICanceled>         m_pCanceledCallback;
     bool                        m_do_cleanup;
+
+    unsigned int                m_NThreads;     // Formatting threads
+    CFlatFileGenerator::TBioseqJobs m_Jobs;     // Reports to generate
+    bool                        m_DeferJobs;    // Collect jobs of entries
+
+    CStopWatch                  m_StopWatch;    // Throughput benchmark
+    Uint8                       m_Records;      // Reports generated
 };
 
 
+// Reports collected per thread before generating them (batch mode)
+static const size_t kJobsPerThread = 16;
+
+
 // constructor
 CAsn2FlatApp::CAsn2FlatApp (void)
+    : m_NThreads(1), m_DeferJobs(false), m_Records(0)
 {
     SetVersionByBuild(1);
 }
@@ -315,6 +329,21 @@ CAsn2FlatApp::~CAsn2FlatApp (void)
 {
 }
 
+void CAsn2FlatApp::Exit(void)
+{
+    if ( !m_StopWatch.IsRunning() ) {
+        return;
+    }
+    double elapsed = m_StopWatch.Elapsed();
+    cerr << "Reports generated: " << m_Records
+         << ", threads: " << m_NThreads
+         << ", seconds: " << elapsed;
+    if ( elapsed > 0 ) {
+        cerr << ", reports per second: " << m_Records / elapsed;
+    }
+    cerr << endl;
+}
+
 void CAsn2FlatApp::Init(void)
 {
     auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
@@ -387,6 +416,13 @@ void CAsn2FlatApp::Init(void)
          arg_desc->AddFlag("c", "Compressed file");
          // propogate top descriptors
          arg_desc->AddFlag("p", "Propagate top descriptors");
+         // threads
+         arg_desc->AddDefaultKey("nthreads", "Threads",
+             "Number of threads generating reports concurrently "
+             "(the output order is preserved)",
+             CArgDescriptions::eInteger, "1");
+         arg_desc->SetConstraint("nthreads",
+                                 new CArgAllow_Integers(1, kMax_Int));
      }}
 
     // in flat_file_config.cpp
@@ -402,6 +438,12 @@ void CAsn2FlatApp::Init(void)
              "Check statistics on how often the flatfile generator checks if "
              "it should be canceled.  This also sets up SIGUSR1 to trigger "
              "cancellation." );
+
+         // benchmark throughput
+         arg_desc->AddFlag(
+             "benchmark-throughput",
+             "Print the number of reports generated per second to stderr "
+             "on exit" );
      }}
 
      CDataLoadersUtil::AddArgumentDescriptions(*arg_desc);
@@ -489,6 +531,19 @@ int CAsn2FlatApp::Run(void)
         m_FFGenerator->SetAnnotSelector().SetMaxSearchTime(float(args["max_search_time"].AsDouble()));
     }
 
+    m_NThreads = args["nthreads"].AsInteger();
+    if ( m_NThreads > 1  &&
+         (args["demo-genbank-callback"]  ||  args["benchmark-cancel-checking"]) ) {
+        // the callbacks are not thread-safe
+        ERR_POST(Warning << "-nthreads is ignored with callback demo options");
+        m_NThreads = 1;
+    }
+    // in batch mode, generate reports of several entries at once
+    m_DeferJobs = m_NThreads > 1  &&  args["batch"];
+    if ( args["benchmark-throughput"] ) {
+        m_StopWatch.Start();
+    }
+
     auto_ptr<CObjectIStream> is;
     is.reset( x_OpenIStream( args ) );
     if (is.get() == NULL) {
@@ -507,6 +562,8 @@ int CAsn2FlatApp::Run(void)
         CGBReleaseFile in( *is.release(), propagate );
         in.RegisterHandler( this );
         in.Read();  // HandleSeqEntry will be called from this function
+        x_GenerateJobs();
+        m_Scope->ResetDataAndHistory();
         return 0;
     }
 
@@ -659,6 +716,7 @@ void CAsn2FlatApp::HandleSeqSubmit(CSeq_submit& sub)
     } else {
         m_FFGenerator->Generate(sub, *scope, *m_Os);
     }
+    ++m_Records;
 }
 
 
@@ -733,8 +791,12 @@ bool CAsn2FlatApp::HandleSeqEntry(const CSeq_entry_Handle& seh )
         }
     }
 
-    m_FFGenerator->SetFeatTree(new feature::CFeatTree(seh));
-    
+    bool use_range = args["from"]  ||  args["to"]  ||  args["strand"];
+    if ( m_NThreads == 1  ||  use_range ) {
+        // with several threads, each builds its own feature tree
+        m_FFGenerator->SetFeatTree(new feature::CFeatTree(seh));
+    }
+
     for (CBioseq_CI bioseq_it(seh);  bioseq_it;  ++bioseq_it) {
         CBioseq_Handle bsh = *bioseq_it;
         CConstRef<CBioseq> bsr = bsh.GetCompleteBioseq();
@@ -822,10 +884,11 @@ bool CAsn2FlatApp::HandleSeqEntry(const CSeq_entry_Handle& seh )
         if ( flatfile_os == NULL ) continue;
 
         // generate flat file
-        if ( args["from"]  ||  args["to"]  ||  args["strand"] ) {
+        if ( use_range ) {
             CSeq_loc loc;
             x_GetLocation( seh, args, loc );
             m_FFGenerator->Generate(loc, seh.GetScope(), *flatfile_os);
+            ++m_Records;
             // emulate the C Toolkit: only produce flatfile for first sequence
             // when range is specified
             return true;
@@ -833,14 +896,35 @@ bool CAsn2FlatApp::HandleSeqEntry(const CSeq_entry_Handle& seh )
         else {
             int count = args["count"].AsInteger();
             for ( int i = 0; i < count; ++i ) {
-                m_FFGenerator->Generate( bsh, *flatfile_os);
+                if ( m_NThreads > 1 ) {
+                    m_Jobs.push_back(
+                        CFlatFileGenerator::SBioseqJob(bsh, *flatfile_os));
+                }
+                else {
+                    m_FFGenerator->Generate( bsh, *flatfile_os);
+                    ++m_Records;
+                }
             }
 
         }
     }
+    if ( !m_DeferJobs ) {
+        x_GenerateJobs();
+    }
     return true;
 }
 
+
+void CAsn2FlatApp::x_GenerateJobs(void)
+{
+    if ( m_Jobs.empty() ) {
+        return;
+    }
+    m_FFGenerator->Generate(m_Jobs, m_NThreads);
+    m_Records += m_Jobs.size();
+    m_Jobs.clear();
+}
+
 CSeq_entry_Handle CAsn2FlatApp::ObtainSeqEntryFromSeqEntry(CObjectIStream& is)
 {
     try {
@@ -899,6 +983,11 @@ bool CAsn2FlatApp::HandleSeqEntry(CRef<CSeq_entry>& se)
     }
 
     bool ret = HandleSeqEntry(entry);
+    if ( m_DeferJobs  &&  m_Jobs.size() < kJobsPerThread * m_NThreads ) {
+        // keep the entry in the scope till enough reports are collected
+        return ret;
+    }
+    x_GenerateJobs();
     // Needed because we can really accumulate a lot of junk otherwise,
     // and we end up with significant slowdown due to repeatedly doing
     // linear scans on a growing CScope.
@@ -36,6 +36,7 @@
 #include <corelib/ncbifile.hpp>
 
 #include <objtools/data_loaders/asn_cache/asn_index.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
 #include <db/bdb/bdb_cursor.hpp>
 
 
@@ -83,6 +84,12 @@ void CCacheIndexCopyApp::Init(void)
                               "main",
                               "seq-id"));
 
+    arg_desc->AddFlag("flat",
+                      "Write the destination as a flat (memory-mapped) index, "
+                      "which CAsnCache uses if it is named asn_cache.flat or "
+                      "seq_id_cache.flat, next to the source, and the source "
+                      "has not changed since");
+
     // Setup arg.descriptions for this application
     arg_desc->SetCurrentGroup("Default application arguments");
     SetupArgDescriptions(arg_desc.release());
@@ -109,6 +116,11 @@ int CCacheIndexCopyApp::Run(void)
     CAsnIndex input(index_type);
     input.Open(input_file, CBDB_RawFile::eReadOnly);
 
+    if (args["flat"]) {
+        CAsnFlatIndex::Build(input, output_file);
+        return 0;
+    }
+
     CFile(output_file).Remove();
     CAsnIndex output(index_type);
     output.SetCacheSize(256 * 1024);
@@ -72,6 +72,7 @@
 
 #include <objtools/data_loaders/asn_cache/Cache_blob.hpp>
 #include <objtools/data_loaders/asn_cache/asn_index.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
 #include <objtools/data_loaders/asn_cache/chunk_file.hpp>
 #include <objtools/data_loaders/asn_cache/seq_id_chunk_file.hpp>
 #include <objtools/data_loaders/asn_cache/asn_cache_util.hpp>
@@ -367,6 +368,10 @@ void CPrimeCacheApplication::Init(void)
     arg_desc->SetDependency("split-sequences",
                             CArgDescriptions::eExcludes, "extract-delta");
 
+    arg_desc->AddFlag("flat-index",
+                      "Also write the flat (memory-mapped) indices, which "
+                      "let readers share the cache between threads");
+
     arg_desc->AddOptionalKey("delta-level", "RecursionLevel",
                              "Number of levels to descend when retrieving "
                              "items in delta sequences",
@@ -1066,6 +1071,14 @@ int CPrimeCacheApplication::Run(void)
         x_Process_Ids(ids, ostr, ifmt == "ids" ? 0 : 1, count);
     }
 
+    if (args["flat-index"]) {
+        string outpath = args["cache"].AsString();
+        m_MainIndex.Close();
+        m_SeqIdIndex.Close();
+        CAsnFlatIndex::Build(outpath, CAsnIndex::e_main);
+        CAsnFlatIndex::Build(outpath, CAsnIndex::e_seq_id);
+    }
+
     GetDiagContext().GetRequestContext().SetRequestStatus(200);
     GetDiagContext().PrintRequestStop();
 
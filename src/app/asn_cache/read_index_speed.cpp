@@ -26,7 +26,8 @@
  * Authors:  Cheinan Marks
  *
  * File Description:
- * Measure the read speed through a BDB Asn Index.
+ * Measure the read speed through a BDB Asn Index, or the speed of random
+ * lookups from several threads, through the flat index if there is one.
  *
  */
 
@@ -38,15 +39,81 @@
 #include <corelib/ncbifile.hpp>
 #include <corelib/ncbistr.hpp>
 #include <corelib/ncbitime.hpp>
+#include <corelib/ncbithr.hpp>
+
+#include <util/random_gen.hpp>
 
 #include <db/bdb/bdb_cursor.hpp>
 
 #include <objtools/data_loaders/asn_cache/asn_index.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
 #include <objtools/data_loaders/asn_cache/file_names.hpp>
 
 USING_NCBI_SCOPE;
 
 
+/////////////////////////////////////////////////////////////////////////////
+//  CIndexLookupThread
+//  Random lookups of seq-ids sampled from the index.  All the threads share
+//  the flat index; with the BDB index each thread opens its own handle.
+
+typedef vector< pair<string, CAsnIndex::TVersion> > TSampleIds;
+
+class CIndexLookupThread : public CThread
+{
+public:
+    CIndexLookupThread( const TSampleIds & ids,
+                        const CAsnFlatIndex * flat_index,
+                        const string & bdb_index_path,
+                        size_t lookups,
+                        CRandom::TValue seed )
+        : m_Ids( ids )
+        , m_FlatIndex( flat_index )
+        , m_BDBIndexPath( bdb_index_path )
+        , m_Lookups( lookups )
+        , m_Random( seed )
+        , m_Found( 0 )
+    {}
+
+    size_t  GetFound() const { return m_Found; }
+
+protected:
+    virtual void* Main(void)
+    {
+        AutoPtr<CAsnIndex>  bdb_index;
+        if ( ! m_FlatIndex ) {
+            bdb_index.reset( new CAsnIndex( CAsnIndex::e_main ) );
+            bdb_index->SetCacheSize( 64 * 1024 * 1024 );
+            bdb_index->Open( m_BDBIndexPath, CBDB_RawFile::eReadOnly );
+        }
+        for ( size_t i = 0;  i < m_Lookups;  ++i ) {
+            const TSampleIds::value_type & id =
+                m_Ids[ m_Random.GetRand( 0, CRandom::TValue( m_Ids.size() - 1 ) ) ];
+            if ( m_FlatIndex ) {
+                m_Found += m_FlatIndex->Count( id.first, id.second );
+            } else {
+                CBDB_FileCursor cursor( *bdb_index );
+                cursor.SetCondition( CBDB_FileCursor::eGE, CBDB_FileCursor::eLE );
+                cursor.From << id.first << id.second;
+                cursor.To   << id.first;
+                while ( cursor.Fetch() == eBDB_Ok ) {
+                    ++m_Found;
+                }
+            }
+        }
+        return NULL;
+    }
+
+private:
+    const TSampleIds &      m_Ids;
+    const CAsnFlatIndex *   m_FlatIndex;
+    string                  m_BDBIndexPath;
+    size_t                  m_Lookups;
+    CRandom                 m_Random;
+    size_t                  m_Found;
+};
+
+
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -67,6 +134,8 @@ private:
     
     void    x_WalkIndex( bool noMultiFetch, bool noGetData, bool prereadIndex );
     void    x_PreReadIndex();
+    void    x_LookupScaling( const string & index_dir,
+                             size_t lookups, unsigned int max_threads );
 };
 
 
@@ -92,6 +161,17 @@ void CReadIndexSpeedApp::Init(void)
     arg_desc->AddFlag("nopreread", "Do not preread the dump index "
                         "(Use if the ID dump is not on panfs).", false );
 
+    arg_desc->AddOptionalKey("lookups", "Lookups",
+                             "Instead of walking the index, do this many "
+                             "random seq-id lookups per thread, with 1, 2, 4... "
+                             "up to -threads threads, and report the scaling.",
+                             CArgDescriptions::eInteger);
+    arg_desc->SetConstraint("lookups", new CArgAllow_Integers(1, kMax_Int));
+    arg_desc->AddDefaultKey("threads", "Threads",
+                            "Maximum number of lookup threads.",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(1, 1024));
+
     // Setup arg.descriptions for this application
     SetupArgDescriptions(arg_desc.release());
 }
@@ -113,6 +193,12 @@ int CReadIndexSpeedApp::Run(void)
         return 2;
     }
 
+    if ( args["lookups"] ) {
+        x_LookupScaling( asn_index_dir.GetPath(), args["lookups"].AsInteger(),
+                         args["threads"].AsInteger() );
+        return 0;
+    }
+
     m_AsnIndex.SetCacheSize( 1 * 1024 * 1024 * 1024 );
     m_AsnIndex.Open( NASNCacheFileName::GetBDBIndex( asn_index_dir.GetPath(), CAsnIndex::e_main),
                         CBDB_RawFile::eReadOnly );
@@ -188,6 +274,93 @@ void    CReadIndexSpeedApp::x_PreReadIndex()
 
 
 
+void    CReadIndexSpeedApp::x_LookupScaling( const string & index_dir,
+                                             size_t lookups,
+                                             unsigned int max_threads )
+{
+    string  bdb_index_path =
+        NASNCacheFileName::GetBDBIndex( index_dir, CAsnIndex::e_main );
+    string  flat_index_path =
+        NASNCacheFileName::GetFlatIndex( index_dir, CAsnIndex::e_main );
+
+    AutoPtr<CAsnFlatIndex>  flat_index;
+    if ( CFile( flat_index_path ).Exists() ) {
+        flat_index.reset( new CAsnFlatIndex( flat_index_path ) );
+        LOG_POST( Info << "Using flat index " << flat_index_path );
+    } else {
+        LOG_POST( Info << "Using BDB index " << bdb_index_path
+                    << " (one handle per thread)" );
+    }
+
+    /// Reservoir sample of the seq-ids to look up
+    const size_t    kMaxSampleIds = 1000000;
+    TSampleIds  ids;
+    {{
+        CStopWatch  sw( CStopWatch::eStart );
+        CRandom     random;
+        CAsnIndex   index( CAsnIndex::e_main );
+        index.SetCacheSize( 64 * 1024 * 1024 );
+        index.Open( bdb_index_path, CBDB_RawFile::eReadOnly );
+        CBDB_FileCursor cursor( index );
+        cursor.InitMultiFetch( 1 * 1024 * 1024 );
+        cursor.SetCondition( CBDB_FileCursor::eFirst, CBDB_FileCursor::eLast );
+        Uint8   seen = 0;
+        while ( cursor.Fetch() == eBDB_Ok ) {
+            ++seen;
+            if ( ids.size() < kMaxSampleIds ) {
+                ids.push_back( make_pair( index.GetSeqId(), index.GetVersion() ) );
+            } else {
+                Uint8   slot = ( Uint8( random.GetRand() ) << 32 | random.GetRand() ) % seen;
+                if ( slot < kMaxSampleIds ) {
+                    ids[slot] = make_pair( index.GetSeqId(), index.GetVersion() );
+                }
+            }
+        }
+        LOG_POST( Info << "Sampled " << ids.size() << " of " << seen
+                    << " index entries in " << sw.Elapsed() << " seconds." );
+    }}
+    if ( ids.empty() ) {
+        LOG_POST( Error << "The index is empty." );
+        return;
+    }
+
+    double  single_rate = 0;
+    for ( unsigned int thread_count = 1;  ;  thread_count *= 2 ) {
+        if ( thread_count > max_threads ) {
+            thread_count = max_threads;
+        }
+        typedef vector< CRef<CIndexLookupThread> > TThreads;
+        TThreads    threads;
+        CStopWatch  sw( CStopWatch::eStart );
+        for ( unsigned int i = 0;  i < thread_count;  ++i ) {
+            CRef<CIndexLookupThread>    thread(
+                new CIndexLookupThread( ids, flat_index.get(), bdb_index_path,
+                                        lookups, i + 1 ) );
+            thread->Run();
+            threads.push_back( thread );
+        }
+        size_t  found = 0;
+        NON_CONST_ITERATE ( TThreads, it, threads ) {
+            (*it)->Join();
+            found += (*it)->GetFound();
+        }
+        double  elapsed = sw.Elapsed();
+        double  rate = elapsed > 0 ? lookups * thread_count / elapsed : 0;
+        if ( thread_count == 1 ) {
+            single_rate = rate;
+        }
+        LOG_POST( Info << thread_count << " threads: "
+                    << lookups * thread_count << " lookups ("
+                    << found << " entries) in " << elapsed << " seconds, "
+                    << NStr::DoubleToString( rate, 0 ) << " lookups/s, speedup "
+                    << NStr::DoubleToString( single_rate > 0 ? rate / single_rate : 0, 2 ) );
+        if ( thread_count == max_threads ) {
+            break;
+        }
+    }
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 //  Cleanup
 
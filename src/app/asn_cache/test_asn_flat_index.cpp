@@ -0,0 +1,304 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Round trip of the flat ASN cache index: a BDB index is filled with
+ *   entries, written out with CAsnFlatIndex::Build(), and every lookup of
+ *   the flat index must return what a BDB cursor returns for the same
+ *   seq-id and version.  Also checks that an update of the BDB index makes
+ *   the flat one out of date, and that a seq-id pointing outside of the
+ *   string pool is reported rather than read.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbifile.hpp>
+#include <db/bdb/bdb_cursor.hpp>
+
+#include <objtools/data_loaders/asn_cache/asn_index.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
+#include <objtools/data_loaders/asn_cache/asn_cache_exception.hpp>
+#include <objtools/data_loaders/asn_cache/file_names.hpp>
+
+#include <algorithm>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+
+
+/// Named like the other asn_cache applications, which are friends of
+/// CAsnIndex and may use CAsnIndex::SIndexInfo.
+class CAsnCacheApplication : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run(void);
+
+private:
+    typedef vector<CAsnIndex::SIndexInfo> TInfo;
+
+    void x_Insert(CAsnIndex& index, const string& seq_id,
+                  CAsnIndex::TVersion version, CAsnIndex::TGi gi,
+                  CAsnIndex::TTimestamp timestamp);
+    void x_FindBDB(CAsnIndex& index, const string& seq_id,
+                   CAsnIndex::TVersion version, TInfo& info);
+    bool x_Compare(const string& seq_id, CAsnIndex::TVersion version,
+                   TInfo& expected, TInfo& found);
+};
+
+
+void CAsnCacheApplication::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Flat ASN cache index round trip");
+    arg_desc->AddDefaultKey("ids", "number",
+                            "Number of distinct seq-ids",
+                            CArgDescriptions::eInteger, "2000");
+    arg_desc->SetConstraint("ids", new CArgAllow_Integers(1, 1000000));
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+void CAsnCacheApplication::x_Insert(CAsnIndex& index, const string& seq_id,
+                                    CAsnIndex::TVersion version,
+                                    CAsnIndex::TGi gi,
+                                    CAsnIndex::TTimestamp timestamp)
+{
+    index.SetSeqId(seq_id);
+    index.SetVersion(version);
+    index.SetGi(gi);
+    index.SetTimestamp(timestamp);
+    index.SetChunkId(CAsnIndex::TChunkId(gi % 7 + 1));
+    index.SetOffset(gi * 1000);
+    index.SetSize(CAsnIndex::TSize(gi % 5000 + 10));
+    index.SetSeqLength(CAsnIndex::TSeqLength(gi % 100000));
+    index.SetTaxId(CAsnIndex::TTaxId(gi % 9606));
+    if (index.UpdateInsert() != eBDB_Ok) {
+        NCBI_THROW(CException, eUnknown, "Failed to add " + seq_id);
+    }
+}
+
+
+// The same range CAsnCache scans in a BDB index
+void CAsnCacheApplication::x_FindBDB(CAsnIndex& index, const string& seq_id,
+                                     CAsnIndex::TVersion version, TInfo& info)
+{
+    CBDB_FileCursor cursor(index);
+    cursor.SetCondition(CBDB_FileCursor::eGE, CBDB_FileCursor::eLE);
+    cursor.From << seq_id << version;
+    cursor.To   << seq_id;
+    while (cursor.Fetch() == eBDB_Ok) {
+        info.push_back(CAsnIndex::SIndexInfo(index));
+    }
+}
+
+
+static bool s_InfoLess(const CAsnIndex::SIndexInfo& a,
+                       const CAsnIndex::SIndexInfo& b)
+{
+    if (a.version != b.version) return a.version < b.version;
+    if (a.gi != b.gi) return a.gi < b.gi;
+    return a.timestamp < b.timestamp;
+}
+
+
+static bool s_InfoEqual(const CAsnIndex::SIndexInfo& a,
+                        const CAsnIndex::SIndexInfo& b)
+{
+    return a.seq_id == b.seq_id  &&  a.version == b.version  &&
+        a.gi == b.gi  &&  a.timestamp == b.timestamp  &&
+        a.chunk == b.chunk  &&  a.offs == b.offs  &&  a.size == b.size  &&
+        a.sequence_length == b.sequence_length  &&
+        a.taxonomy_id == b.taxonomy_id;
+}
+
+
+bool CAsnCacheApplication::x_Compare(const string& seq_id,
+                                     CAsnIndex::TVersion version,
+                                     TInfo& expected, TInfo& found)
+{
+    // The BDB key order of the entries of one seq-id need not be the
+    // numeric one
+    sort(expected.begin(), expected.end(), s_InfoLess);
+    sort(found.begin(), found.end(), s_InfoLess);
+    if (expected.size() == found.size()  &&
+        equal(expected.begin(), expected.end(), found.begin(), s_InfoEqual)) {
+        return true;
+    }
+    ERR_POST(Error << seq_id << " version " << version << ": "
+             << expected.size() << " entries in the BDB index, "
+             << found.size() << " in the flat one");
+    return false;
+}
+
+
+int CAsnCacheApplication::Run(void)
+{
+    int ids = GetArgs()["ids"].AsInteger();
+
+    CDir dir(CDirEntry::GetTmpName());
+    dir.CreatePath();
+    string bdb_path = NASNCacheFileName::GetBDBIndex(dir.GetPath(),
+                                                     CAsnIndex::e_main);
+    string flat_path = NASNCacheFileName::GetFlatIndex(dir.GetPath(),
+                                                       CAsnIndex::e_main);
+    int errors = 0;
+
+    // Seq-ids, some of which are prefixes of others, with one or two
+    // versions and up to three gis each, in no particular order
+    vector<string> seq_ids;
+    {{
+        CAsnIndex index(CAsnIndex::e_main);
+        index.Open(bdb_path, CBDB_RawFile::eCreate);
+        Uint4 seed = 1;
+        for (int i = 0;  i < ids;  ++i) {
+            seed = seed * 1103515245 + 12345;
+            string seq_id = "NC_" + NStr::UIntToString(seed % (ids * 10));
+            if (i % 10 == 0) {
+                seq_id += "|" + NStr::IntToString(i);
+            }
+            seq_ids.push_back(seq_id);
+            for (CAsnIndex::TVersion version = seed % 3;
+                 version < 4;  version += 2) {
+                for (int gi = 0;  gi <= i % 3;  ++gi) {
+                    x_Insert(index, seq_id, version, seed % 100000 + gi,
+                             CAsnIndex::TTimestamp(i + gi));
+                }
+            }
+        }
+    }}
+
+    Uint8 count = CAsnFlatIndex::Build(dir.GetPath(), CAsnIndex::e_main);
+    {{
+        CAsnIndex index(CAsnIndex::e_main);
+        index.Open(bdb_path, CBDB_RawFile::eReadOnly);
+        CAsnFlatIndex flat(flat_path);
+
+        if (flat.GetRecordCount() != count  ||
+            flat.GetIndexType() != CAsnIndex::e_main  ||
+            !flat.IsCurrent(bdb_path)) {
+            ERR_POST(Error << "unexpected flat index header");
+            ++errors;
+        }
+
+        size_t found_count = 0;
+        ITERATE (vector<string>, it, seq_ids) {
+            // Also seq-ids which sort next to this one, and are mostly
+            // not in the index
+            string missing[] = { it->substr(0, it->size() - 1),
+                                 *it + "0", *it + "|" };
+            for (CAsnIndex::TVersion version = 0;  version < 5;  ++version) {
+                TInfo expected, found;
+                x_FindBDB(index, *it, version, expected);
+                flat.Find(*it, version, found);
+                if (flat.Count(*it, version) != found.size()  ||
+                    !x_Compare(*it, version, expected, found)) {
+                    ++errors;
+                }
+                if (version == 0) {
+                    found_count += found.size();
+                }
+                for (size_t i = 0;  i < ArraySize(missing);  ++i) {
+                    expected.clear();
+                    found.clear();
+                    x_FindBDB(index, missing[i], version, expected);
+                    flat.Find(missing[i], version, found);
+                    if ( !x_Compare(missing[i], version, expected, found) ) {
+                        ++errors;
+                    }
+                }
+            }
+        }
+        NcbiCout << count << " index entries, " << found_count
+                 << " found looking up " << seq_ids.size() << " seq-ids"
+                 << NcbiEndl;
+    }}
+
+    // Any update of the BDB index makes the flat one out of date, even
+    // within the same second
+    {{
+        CAsnIndex index(CAsnIndex::e_main);
+        index.Open(bdb_path, CBDB_RawFile::eReadWrite);
+        x_Insert(index, seq_ids.front(), 9, 1, 1);
+    }}
+    {{
+        CAsnFlatIndex flat(flat_path);
+        if (flat.IsCurrent(bdb_path)) {
+            ERR_POST(Error << "flat index is current after an update");
+            ++errors;
+        }
+    }}
+    CAsnFlatIndex::Build(dir.GetPath(), CAsnIndex::e_main);
+    {{
+        CAsnFlatIndex flat(flat_path);
+        if ( !flat.IsCurrent(bdb_path)  ||  flat.Count(seq_ids.front(), 9) != 1 ) {
+            ERR_POST(Error << "rebuilt flat index is not current");
+            ++errors;
+        }
+    }}
+
+    // A seq-id offset past the string pool, in the first record: the
+    // header is 56 bytes and a record starts with the seq-id offset
+    {{
+        CNcbiFstream file(flat_path.c_str(),
+                          IOS_BASE::in | IOS_BASE::out | IOS_BASE::binary);
+        const Uint8 bad_offset = Uint8(1) << 40;
+        file.seekp(56);
+        file.write(reinterpret_cast<const char*>(&bad_offset),
+                   sizeof(bad_offset));
+    }}
+    try {
+        CAsnFlatIndex flat(flat_path);
+        TInfo found;
+        // The search for an empty seq-id ends at the first record
+        flat.Find(string(), 0, found);
+        ERR_POST(Error << "seq-id out of the string pool was not detected");
+        ++errors;
+    }
+    catch (CASNCacheException& e) {
+        NcbiCout << "Expected error: " << e.GetMsg() << NcbiEndl;
+    }
+
+    dir.Remove();
+
+    if (errors) {
+        ERR_POST(Error << errors << " error(s)");
+        return 1;
+    }
+    NcbiCout << "OK" << NcbiEndl;
+    return 0;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CAsnCacheApplication().AppMain(argc, argv);
+}
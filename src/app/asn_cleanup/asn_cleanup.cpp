@@ -132,6 +132,7 @@ private:
     bool x_BasicAndExtended(CSeq_entry_Handle entry, const string& label, bool do_basic = true, bool do_extended = false, Uint4 options = 0);
 
     template<typename T> void x_WriteToFile(const T& s);
+    void x_PrintRuleTimes(void);
 
     // data
     CRef<CObjectManager>        m_Objmgr;       // Object Manager
@@ -256,6 +257,8 @@ void CCleanupApp::Init(void)
         arg_desc->AddFlag("showprogress",
             "List ID for which cleanup is occuring");
         arg_desc->AddFlag("debug", "Save before.sqn");
+        arg_desc->AddFlag("timing",
+            "Report the time spent in the cleanup rule families to the log");
     }}
     SetupArgDescriptions(arg_desc.release());
 }
@@ -625,6 +628,10 @@ int CCleanupApp::Run(void)
         opened_output = true;
     }
 
+    if (args["timing"].AsBoolean()) {
+        CCleanup::EnableRuleTiming();
+    }
+
     if (args["id"]) {
         string seqID = args["id"].AsString();
         HandleSeqID(seqID);
@@ -645,9 +652,24 @@ int CCleanupApp::Run(void)
         // close output file if we opened one
         x_CloseOStream();
     }
+    if (args["timing"].AsBoolean()) {
+        x_PrintRuleTimes();
+    }
     return 0;
 }
 
+
+void CCleanupApp::x_PrintRuleTimes(void)
+{
+    CCleanup::TRuleTimes times;
+    CCleanup::GetRuleTimes(times);
+
+    CNcbiOstrstream out;
+    CSectionTimes::Print(out, times);
+    LOG_POST(Info << "Cleanup rule times, seconds / calls:\n"
+                  << string(CNcbiOstrstreamToString(out)));
+}
+
 bool CCleanupApp::ObtainSeqEntryFromSeqEntry( 
     auto_ptr<CObjectIStream>& is, 
     CRef<CSeq_entry>& se )
@@ -917,7 +939,9 @@ bool CCleanupApp::x_GFF3Batch(CSeq_entry_Handle seh)
     bool any_changes = x_FixCDS(seh, kGFF3CDSFixOptions, kEmptyStr);
     CCleanup cleanup;
     cleanup.SetScope(&(seh.GetScope()));
-    Uint4 options = CCleanup::eClean_NoNcbiUserObjects;
+    // ExtendedCleanup does not walk again what BasicCleanup left unchanged
+    Uint4 options = CCleanup::eClean_NoNcbiUserObjects |
+                    CCleanup::eClean_SkipUnchanged;
     CConstRef<CCleanupChange> changes = cleanup.BasicCleanup(seh, options);
     any_changes |= (!changes.Empty());
     changes = cleanup.ExtendedCleanup(seh, options);
@@ -938,6 +962,10 @@ bool CCleanupApp::x_BasicAndExtended(CSeq_entry_Handle entry, const string& labe
     bool any_changes = false;
     CCleanup cleanup;
     cleanup.SetScope(&(entry.GetScope()));
+    if (do_basic && do_extended) {
+        // ExtendedCleanup does not walk again what BasicCleanup left unchanged
+        options |= CCleanup::eClean_SkipUnchanged;
+    }
 
     if (do_basic) {
         // perform BasicCleanup
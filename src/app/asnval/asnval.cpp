@@ -36,6 +36,8 @@
 #include <corelib/ncbiapp.hpp>
 #include <corelib/ncbienv.hpp>
 #include <corelib/ncbiargs.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbimtx.hpp>
 
 #include <serial/serial.hpp>
 #include <serial/objistr.hpp>
@@ -77,6 +79,9 @@
 #include <util/compress/stream_util.hpp>
 #include <util/format_guess.hpp>
 
+#include <deque>
+#include <exception>
+
 #include <common/test_assert.h>  /* This header must go last */
 
 
@@ -94,6 +99,42 @@ const char * ASNVAL_APP_VER = "10.1";
 //
 
 class CValXMLStream;
+class CAsnvalThread;
+
+
+// A record validated on a worker thread
+struct SAsnvalRecord
+{
+    SAsnvalRecord(CSeq_entry& se, bool skip_failed) :
+        m_Entry(&se), m_SkipFailed(skip_failed), m_Done(false), m_Elapsed(0)
+    {}
+
+    CRef<CSeq_entry> m_Entry;
+    bool             m_SkipFailed;  // -continue: a failure drops this record only
+    bool             m_Done;
+    string           m_Id;
+    double           m_Elapsed;
+    vector< CConstRef<CValidError> > m_Errors;
+    exception_ptr    m_Exception;
+};
+
+
+// Records read so far and not yet reported
+struct SAsnvalQueue
+{
+    SAsnvalQueue(void) : m_First(0), m_Next(0), m_Stop(false) {}
+
+    // References to the elements are not invalidated by push_back()
+    // and pop_front()
+    deque<SAsnvalRecord> m_Records;
+    size_t             m_First;     // Number of the records reported
+    size_t             m_Next;      // Next record to validate
+    bool               m_Stop;
+    CFastMutex         m_Lock;
+    CConditionVariable m_RecordAdded;
+    CConditionVariable m_RecordDone;
+};
+
 
 class CAsnvalApp : public CNcbiApplication, CReadClassMemberHook
 {
@@ -109,6 +150,7 @@ public:
         const CObjectInfo::CMemberIterator& member);
 
 private:
+    friend class CAsnvalThread;
 
     void Setup(const CArgs& args);
 
@@ -143,6 +185,16 @@ private:
 
     CRef<CScope> BuildScope(void);
 
+    // Multi-threaded validation of the records of release files and
+    // catenated input. The main thread reads the records, the workers
+    // validate them, and the results are printed in the input order.
+    void ValidateRecord(CValidator& validator, SAsnvalRecord& record);
+    void x_SubmitRecord(CSeq_entry& se, bool skip_failed = false);
+    void x_ReportFirstRecord(void);
+    void x_FinishRecords(void);
+    void x_StopThreads(void);
+    void x_PrintCheckTimes(void);
+
     void PrintValidError(CConstRef<CValidError> errors, 
         const CArgs& args);
 
@@ -174,6 +226,10 @@ private:
     bool m_DoCleanup;
     CCleanup m_Cleanup;
 
+    unsigned int m_NThreads;
+    SAsnvalQueue m_Queue;
+    vector< CRef<CAsnvalThread> > m_Threads;
+
     EDiagSev m_LowCutoff;
     EDiagSev m_HighCutoff;
 
@@ -187,6 +243,24 @@ private:
 #endif
 };
 
+
+class CAsnvalThread : public CThread
+{
+public:
+    CAsnvalThread(CAsnvalApp& app) :
+        m_App(app), m_Validator(*app.m_ObjMgr)
+    {}
+
+protected:
+    virtual void* Main(void);
+
+private:
+    CAsnvalApp& m_App;
+    // Each thread has its own validator and taxonomy client
+    CValidator  m_Validator;
+};
+
+
 class CValXMLStream: public CObjectOStreamXml
 {
 public:
@@ -199,8 +273,8 @@ public:
 CAsnvalApp::CAsnvalApp(void) :
     m_ObjMgr(0), m_In(0), m_Options(0), m_Continue(false), m_OnlyAnnots(false),
     m_Longest(0), m_CurrentId(""), m_LongestId(""), m_NumFiles(0),
-    m_NumRecords(0), m_Level(0), m_Reported(0), m_verbosity(eVerbosity_min),
-    m_ValidErrorStream(0), m_LogStream(0)
+    m_NumRecords(0), m_Level(0), m_Reported(0), m_NThreads(1),
+    m_verbosity(eVerbosity_min), m_ValidErrorStream(0), m_LogStream(0)
 {
     SetVersionByBuild(1);
 }
@@ -279,6 +353,13 @@ void CAsnvalApp::Init(void)
 
     arg_desc->AddFlag("cleanup", "Perform BasicCleanup before validating (to match C Toolkit)");
 
+    arg_desc->AddDefaultKey("nthreads", "Threads",
+        "Number of threads validating the records of batch (-a t) and "
+        "catenated (-a c) input concurrently (the output order is preserved)",
+        CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint("nthreads", new CArgAllow_Integers(1, kMax_Int));
+    arg_desc->AddFlag("timing", "Report the time spent in the individual bioseq and feature checks to the log");
+
     CDataLoadersUtil::AddArgumentDescriptions(*arg_desc,
                                               CDataLoadersUtil::fDefault |
                                               CDataLoadersUtil::fGenbankOffByDefault);
@@ -427,7 +508,11 @@ void CAsnvalApp::ValidateOneFile(const string& fname)
             // Also log to XML?
             ERR_POST(e);
             ++m_Reported;
+        } catch (...) {
+            x_StopThreads();
+            throw;
         }
+        x_StopThreads();
     }
     m_NumFiles++;
     if (close_error_stream) {
@@ -492,6 +577,10 @@ int CAsnvalApp::Run(void)
 
     m_DoCleanup = args["cleanup"] && args["cleanup"].AsBoolean();
     m_verbosity = static_cast<EVerbosity>(args["v"].AsInteger());
+    m_NThreads = args["nthreads"].AsInteger();
+    if (args["timing"].AsBoolean()) {
+        CValidator::EnableCheckTiming();
+    }
 
     // Process file based on its content
     // Unless otherwise specifien we assume the file in hand is
@@ -531,6 +620,9 @@ int CAsnvalApp::Run(void)
         *m_LogStream << "Finished in " << stop_time - start_time << " seconds" << endl;
         *m_LogStream << "Longest processing time " << m_Longest << " seconds on " << m_LongestId << endl;
         *m_LogStream << "Total number of records " << m_NumRecords << endl;
+        if (args["timing"].AsBoolean()) {
+            x_PrintCheckTimes();
+        }
     }
 
     DestroyOutputStreams();
@@ -568,6 +660,12 @@ void CAsnvalApp::ReadClassMember
                 CRef<CSeq_entry> se(new CSeq_entry);
                 i >> *se;
 
+                if (m_NThreads > 1) {
+                    x_SubmitRecord(*se, m_Continue);
+                    n++;
+                    continue;
+                }
+
                 // Validate Seq-entry
                 CValidator validator(*m_ObjMgr);
                 CRef<CScope> scope = BuildScope();
@@ -643,8 +741,199 @@ void CAsnvalApp::ProcessReleaseFile
     // Read the CBioseq_set, it will call the hook object each time we 
     // encounter a Seq-entry
     *m_In >> *seqset;
+    x_FinishRecords();
+}
+
+void* CAsnvalThread::Main(void)
+{
+    SAsnvalQueue& queue = m_App.m_Queue;
+    for (;;) {
+        SAsnvalRecord* record;
+        {{
+            CFastMutexGuard guard(queue.m_Lock);
+            while ( !queue.m_Stop  &&
+                    queue.m_Next >= queue.m_First + queue.m_Records.size() ) {
+                queue.m_RecordAdded.WaitForSignal(queue.m_Lock);
+            }
+            if ( queue.m_Stop ) {
+                break;
+            }
+            record = &queue.m_Records[queue.m_Next++ - queue.m_First];
+        }}
+
+        try {
+            m_App.ValidateRecord(m_Validator, *record);
+        }
+        catch (...) {
+            record->m_Exception = current_exception();
+        }
+
+        CFastMutexGuard guard(queue.m_Lock);
+        record->m_Done = true;
+        queue.m_RecordDone.SignalAll();
+    }
+    return 0;
+}
+
+
+// Called on a worker thread
+void CAsnvalApp::ValidateRecord(CValidator& validator, SAsnvalRecord& record)
+{
+    CSeq_entry& se = *record.m_Entry;
+    CRef<CScope> scope = BuildScope();
+    if (m_DoCleanup) {
+        CCleanup cleanup;
+        cleanup.SetScope(scope);
+        cleanup.BasicCleanup(se);
+    }
+
+    CSeq_entry_Handle seh;
+    try {
+        seh = scope->AddTopLevelSeqEntry(se);
+    }
+    catch (const CObjMgrException& om_ex) {
+        if (om_ex.GetErrCode() != CObjMgrException::eAddDataError) {
+            throw;
+        }
+        se.ReassignConflictingIds();
+        scope = BuildScope();
+        seh = scope->AddTopLevelSeqEntry(se);
+    }
+
+    CBioseq_CI bi(seh);
+    if (bi) {
+        bi->GetId().front().GetSeqId()->GetLabel(&record.m_Id);
+    }
+
+    CStopWatch sw(CStopWatch::eStart);
+    if ( m_OnlyAnnots ) {
+        for (CSeq_annot_CI ni(seh); ni; ++ni) {
+            record.m_Errors.push_back(validator.Validate(*ni, m_Options));
+        }
+    } else {
+        record.m_Errors.push_back(validator.Validate(seh, m_Options));
+    }
+    record.m_Elapsed = sw.Elapsed();
+}
+
+
+void CAsnvalApp::x_SubmitRecord(CSeq_entry& se, bool skip_failed)
+{
+    if (m_Threads.empty()) {
+        for (unsigned int i = 0; i < m_NThreads; ++i) {
+            CRef<CAsnvalThread> thread(new CAsnvalThread(*this));
+            thread->Run();
+            m_Threads.push_back(thread);
+        }
+    }
+
+    // Limit the number of records held in memory. Only this thread adds
+    // and removes the records, so the size can be read without the lock.
+    while (m_Queue.m_Records.size() >= 4 * m_NThreads) {
+        x_ReportFirstRecord();
+    }
+
+    CFastMutexGuard guard(m_Queue.m_Lock);
+    m_Queue.m_Records.push_back(SAsnvalRecord(se, skip_failed));
+    m_Queue.m_RecordAdded.SignalSome();
+}
+
+
+void CAsnvalApp::x_ReportFirstRecord(void)
+{
+    {{
+        CFastMutexGuard guard(m_Queue.m_Lock);
+        while ( !m_Queue.m_Records.front().m_Done ) {
+            m_Queue.m_RecordDone.WaitForSignal(m_Queue.m_Lock);
+        }
+    }}
+
+    SAsnvalRecord& record = m_Queue.m_Records.front();
+    if (record.m_Exception) {
+        // Same as the single-threaded validation: with -continue only this
+        // record is dropped, otherwise stop at the first failure
+        exception_ptr e = record.m_Exception;
+        if (record.m_SkipFailed) {
+            bool skip = false;
+            try {
+                rethrow_exception(e);
+            }
+            catch (exception&) {
+                skip = true;
+            }
+            catch (...) {
+            }
+            if (skip) {
+                CFastMutexGuard guard(m_Queue.m_Lock);
+                m_Queue.m_Records.pop_front();
+                m_Queue.m_First++;
+                return;
+            }
+        }
+        x_StopThreads();
+        rethrow_exception(e);
+    }
+
+    m_CurrentId = record.m_Id;
+    if (m_LogStream  &&  !m_CurrentId.empty()) {
+        *m_LogStream << m_CurrentId << endl;
+    }
+    time_t elapsed = static_cast<time_t>(record.m_Elapsed);
+    if (elapsed > m_Longest) {
+        m_Longest = elapsed;
+        m_LongestId = m_CurrentId;
+    }
+    ITERATE(vector< CConstRef<CValidError> >, eval, record.m_Errors) {
+        m_NumRecords++;
+        if ( *eval ) {
+            PrintValidError(*eval, GetArgs());
+        }
+    }
+
+    CFastMutexGuard guard(m_Queue.m_Lock);
+    m_Queue.m_Records.pop_front();
+    m_Queue.m_First++;
+}
+
+
+void CAsnvalApp::x_FinishRecords(void)
+{
+    while ( !m_Queue.m_Records.empty() ) {
+        x_ReportFirstRecord();
+    }
+}
+
+
+// Stops the worker threads, the records not reported yet are dropped
+void CAsnvalApp::x_StopThreads(void)
+{
+    {{
+        CFastMutexGuard guard(m_Queue.m_Lock);
+        m_Queue.m_Stop = true;
+        m_Queue.m_RecordAdded.SignalAll();
+    }}
+    NON_CONST_ITERATE(vector< CRef<CAsnvalThread> >, it, m_Threads) {
+        (*it)->Join();
+    }
+    m_Threads.clear();
+
+    m_Queue.m_Records.clear();
+    m_Queue.m_First = 0;
+    m_Queue.m_Next = 0;
+    m_Queue.m_Stop = false;
+}
+
+
+void CAsnvalApp::x_PrintCheckTimes(void)
+{
+    CValidator::TCheckTimes times;
+    CValidator::GetCheckTimes(times);
+
+    *m_LogStream << "Check times, seconds summed over threads / calls:" << endl;
+    CSectionTimes::Print(*m_LogStream, times);
 }
 
+
 CRef<CValidError> CAsnvalApp::ReportReadFailure(void)
 {
     CRef<CValidError> errors(new CValidError());
@@ -680,20 +969,26 @@ CConstRef<CValidError> CAsnvalApp::ProcessCatenated(void)
             }
             catch (const CException& e) {
                 ERR_POST(Error << e);
+                x_FinishRecords();
                 return ReportReadFailure();
             }
-            try {
-                CConstRef<CValidError> eval = ProcessSeqEntry(*se);
-                if ( eval ) {
-                    PrintValidError(eval, GetArgs());
-                }
+            if (m_NThreads > 1) {
+                x_SubmitRecord(*se);
             }
-            catch (const CObjMgrException& om_ex) {
-                if (om_ex.GetErrCode() == CObjMgrException::eAddDataError)
-                  se->ReassignConflictingIds();
-                CConstRef<CValidError> eval = ProcessSeqEntry(*se);
-                if ( eval ) {
-                    PrintValidError(eval, GetArgs());
+            else {
+                try {
+                    CConstRef<CValidError> eval = ProcessSeqEntry(*se);
+                    if ( eval ) {
+                        PrintValidError(eval, GetArgs());
+                    }
+                }
+                catch (const CObjMgrException& om_ex) {
+                    if (om_ex.GetErrCode() == CObjMgrException::eAddDataError)
+                      se->ReassignConflictingIds();
+                    CConstRef<CValidError> eval = ProcessSeqEntry(*se);
+                    if ( eval ) {
+                        PrintValidError(eval, GetArgs());
+                    }
                 }
             }
             try {
@@ -703,9 +998,11 @@ CConstRef<CValidError> CAsnvalApp::ProcessCatenated(void)
                 break;
             }
         }
+        x_FinishRecords();
     }
     catch (const CException& e) {
         ERR_POST(Error << e);
+        x_FinishRecords();
         return ReportReadFailure();
     }
 
@@ -160,35 +160,52 @@ int CBlastpApp::Run(void)
         formatter.PrintProlog();
 
         /*** Process the input ***/
+        // In throughput mode several query batches share one database scan
+        const size_t kThroughputBatches = m_CmdLineArgs->ExecuteRemotely()
+            ? 1 : m_CmdLineArgs->GetThroughputBatches();
         for (; !input.End(); formatter.ResetScopeHistory()) {
 
-            CRef<CBlastQueryVector> query_batch(input.GetNextSeqBatch(*scope));
-            CRef<IQueryFactory> queries(new CObjMgr_QueryFactory(*query_batch));
+            vector< CRef<CBlastQueryVector> > query_batches;
+            CLocalBlast::TQueryFactories queries;
+            do {
+                query_batches.push_back
+                    (CRef<CBlastQueryVector>(input.GetNextSeqBatch(*scope)));
+                queries.push_back(CRef<IQueryFactory>
+                    (new CObjMgr_QueryFactory(*query_batches.back())));
+                SaveSearchStrategy(args, m_CmdLineArgs, queries.back(),
+                                   opts_hndl);
+            } while (queries.size() < kThroughputBatches && !input.End());
 
-            SaveSearchStrategy(args, m_CmdLineArgs, queries, opts_hndl);
-
-            CRef<CSearchResultSet> results;
+            vector< CRef<CSearchResultSet> > results;
 
             if (m_CmdLineArgs->ExecuteRemotely()) {
                 CRef<CRemoteBlast> rmt_blast = 
-                    InitializeRemoteBlast(queries, db_args, opts_hndl,
+                    InitializeRemoteBlast(queries.front(), db_args, opts_hndl,
                           m_CmdLineArgs->ProduceDebugRemoteOutput(),
                           m_CmdLineArgs->GetClientId());
-                results = rmt_blast->GetResultSet();
+                results.push_back(rmt_blast->GetResultSet());
+            } else if (queries.size() > 1) {
+                results = CLocalBlast::RunThroughputMode
+                    (queries, opts_hndl, db_adapter,
+                     m_CmdLineArgs->GetNumThreads());
             } else {
-                CLocalBlast lcl_blast(queries, opts_hndl, db_adapter);
+                CLocalBlast lcl_blast(queries.front(), opts_hndl, db_adapter);
                 lcl_blast.SetNumberOfThreads(m_CmdLineArgs->GetNumThreads());
-                results = lcl_blast.Run();
+                results.push_back(lcl_blast.Run());
             }
 
-            if (fmt_args->ArchiveFormatRequested(args)) {
-                formatter.WriteArchive(*queries, *opts_hndl, *results,  0, bah.GetMessages());
-                bah.ResetMessages();
-            } else {
-                BlastFormatter_PreFetchSequenceData(*results, scope,
-                		                            fmt_args->GetFormattedOutputChoice());
-                ITERATE(CSearchResultSet, result, *results) {
-                    formatter.PrintOneResultSet(**result, query_batch);
+            for (size_t i = 0; i < results.size(); i++) {
+                if (fmt_args->ArchiveFormatRequested(args)) {
+                    formatter.WriteArchive(*queries[i], *opts_hndl,
+                                           *results[i], 0, bah.GetMessages());
+                    bah.ResetMessages();
+                } else {
+                    BlastFormatter_PreFetchSequenceData(*results[i], scope,
+                    		                    fmt_args->GetFormattedOutputChoice());
+                    ITERATE(CSearchResultSet, result, *results[i]) {
+                        formatter.PrintOneResultSet(**result,
+                                                    query_batches[i]);
+                    }
                 }
             }
         }
@@ -234,6 +234,12 @@ void CMakeBlastDBApp::Init()
                       "Create index of sequence hash values.",
                       true);
 
+    arg_desc->AddFlag("acc_lookup_index",
+                      "Create a hashed lookup table for the seqid index "
+                      "(speeds up accession lookups, requires -parse_seqids "
+                      "for FASTA input).",
+                      true);
+
 #if ((!defined(NCBI_COMPILER_WORKSHOP) || (NCBI_COMPILER_VERSION  > 550)) && \
      (!defined(NCBI_COMPILER_MIPSPRO)) )
     arg_desc->SetCurrentGroup("Sequence masking options");
@@ -279,6 +285,12 @@ void CMakeBlastDBApp::Init()
     arg_desc->AddDefaultKey("max_file_sz", "number_of_bytes",
                             "Maximum file size for BLAST database files",
                             CArgDescriptions::eString, "1GB");
+    arg_desc->AddDefaultKey("num_threads", "int_value",
+                            "Number of threads to use in building the "
+                            "database",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint("num_threads",
+                            new CArgAllowValuesGreaterThanOrEqual(1));
     arg_desc->AddOptionalKey("logfile", "File_Name",
                              "File to which the program log should be redirected",
                              CArgDescriptions::eOutputFile,
@@ -1078,11 +1090,14 @@ void CMakeBlastDBApp::x_BuildDatabase()
 
     bool parse_seqids = x_ShouldParseSeqIds();
     bool hash_index = args["hash_index"];
+    bool acc_lookup_index = args["acc_lookup_index"];
     bool use_gi_mask = args["gi_mask"];
 
     CWriteDB::TIndexType indexing = CWriteDB::eNoIndex;
     indexing |= (hash_index ? CWriteDB::eAddHash : 0);
     indexing |= (parse_seqids ? CWriteDB::eFullIndex : 0);
+    indexing |= ((parse_seqids && acc_lookup_index)
+                 ? CWriteDB::eAddAccLookup : 0);
 
     bool long_seqids = false;
     CNcbiApplication* app = CNcbiApplication::Instance();
@@ -1131,6 +1146,7 @@ void CMakeBlastDBApp::x_BuildDatabase()
                << Uint8ToString_DataSize(bytes) << endl;
 
     m_DB->SetMaxFileSize(bytes);
+    m_DB->SetNumThreads(args["num_threads"].AsInteger());
 
     if (args["taxid"].HasValue()) {
         _ASSERT( !args["taxid_map"].HasValue() );
@@ -104,6 +104,13 @@ void CLDS2IndexerApplication::Init(void)
         "Group standalone seq-aligns into blobs",
         CArgDescriptions::eInteger);
 
+    arg_desc->AddDefaultKey("threads", "count",
+        "Number of threads parsing the data files",
+        CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(1, kMax_Int));
+    arg_desc->AddFlag("wal",
+        "Write the database in WAL journal mode while indexing");
+
     arg_desc->AddOptionalKey("dump_table", "table_name",
         "Dump LDS2 table content",
         CArgDescriptions::eString);
@@ -153,6 +160,9 @@ int CLDS2IndexerApplication::Run(void)
         mgr.SetSeqAlignGroupSize(args["group_aligns"].AsInteger());
     }
 
+    mgr.SetIndexThreads(args["threads"].AsInteger());
+    mgr.SetWALUpdate(args["wal"].AsBoolean());
+
     if ( args["dump_table"] ) {
         mgr.GetDatabase()->Dump(args["dump_table"].AsString(), args["dump_file"].AsOutputFile());
     }
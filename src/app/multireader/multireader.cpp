@@ -505,6 +505,19 @@ void CMultiReaderApp::Init(void)
         "Prefix or starting tag for auto generated locus tags",
         CArgDescriptions::eString,
         "" );
+
+    arg_desc->AddDefaultKey(
+        "stream",
+        "STRING",
+        "GFF3 and GTF: read sorted input one seqid (or one gene locus, "
+        "GFF3 only) at a time to bound memory",
+        CArgDescriptions::eString,
+        "none" );
+
+    arg_desc->SetConstraint(
+        "stream",
+        &(*new CArgAllow_Strings,
+            "none", "seqid", "locus" ) );
         
     //
     //  wiggle reader specific arguments:
@@ -563,6 +576,31 @@ void CMultiReaderApp::Init(void)
         "generate gene->mrna and gene->cds xrefs",
         true );    
 
+    //
+    //  vcf reader specific arguments:
+    //
+
+    arg_desc->SetCurrentGroup("VCF READER SPECIFIC");
+
+    arg_desc->AddFlag(
+        "vcf-lazy",
+        "keep INFO and sample columns as raw text",
+        true );
+
+    arg_desc->AddDefaultKey(
+        "vcf-samples",
+        "STRING",
+        "comma separated names of the samples to keep (default: all)",
+        CArgDescriptions::eString,
+        "" );
+
+    arg_desc->AddDefaultKey(
+        "vcf-threads",
+        "INTEGER",
+        "number of threads parsing the data lines",
+        CArgDescriptions::eInteger,
+        "1" );
+
     //
     //  alignment reader specific arguments:
     //
@@ -907,6 +945,17 @@ void CMultiReaderApp::xProcessGtf(
     }
     //TestCanceler canceler;
     //reader.SetCanceler(&canceler);
+    if (m_iFlags & CGff2Reader::fStreamBySeqId) {
+        //  write out each annot as soon as it is complete
+        CStreamLineReader lr(istr);
+        CRef<CSeq_annot> pAnnot = reader.ReadSeqAnnot(lr, m_pErrors);
+        while (pAnnot) {
+            xPostProcessAnnot(args, *pAnnot);
+            xWriteObject(args, *pAnnot, ostr);
+            pAnnot = reader.ReadSeqAnnot(lr, m_pErrors);
+        }
+        return;
+    }
     reader.ReadSeqAnnots(annots, istr, m_pErrors);
     for (ANNOTS::iterator it = annots.begin(); it != annots.end(); ++it){
 		xPostProcessAnnot(args, **it);
@@ -933,6 +982,17 @@ void CMultiReaderApp::xProcessGff3(
     }
     //TestCanceler canceler;
     //reader.SetCanceler(&canceler);
+    if (m_iFlags & CGff2Reader::fStreamBySeqId) {
+        //  write out each annot as soon as it is complete
+        CStreamLineReader lr(istr);
+        CRef<CSeq_annot> pAnnot = reader.ReadSeqAnnot(lr, m_pErrors);
+        while (pAnnot) {
+            xPostProcessAnnot(args, *pAnnot);
+            xWriteObject(args, *pAnnot, ostr);
+            pAnnot = reader.ReadSeqAnnot(lr, m_pErrors);
+        }
+        return;
+    }
     reader.ReadSeqAnnots(annots, istr, m_pErrors);
     for (ANNOTS::iterator it = annots.begin(); it != annots.end(); ++it){
 		xPostProcessAnnot(args, **it);
@@ -1016,6 +1076,12 @@ void CMultiReaderApp::xProcessVcf(
     if (args["show-progress"]) {
         reader.SetProgressReportInterval(10);
     }
+    if (!args["vcf-samples"].AsString().empty()) {
+        vector<string> samples;
+        NStr::Split(args["vcf-samples"].AsString(), ",", samples);
+        reader.SetSamples(samples);
+    }
+    reader.SetParseThreads(max(args["vcf-threads"].AsInteger(), 1));
    //TestCanceler canceler;
    //reader.SetCanceler(&canceler);
     reader.ReadSeqAnnots(annots, istr, m_pErrors);
@@ -1249,6 +1315,9 @@ void CMultiReaderApp::xSetFlags(
         if ( args["child-links"] ) {
             m_iFlags |= CGtfReader::fGenerateChildXrefs;
         }
+        if ( args["stream"].AsString() != "none" ) {
+            m_iFlags |= CGtfReader::fStreamBySeqId;
+        }
         if (args["genbank"]) {
             m_iFlags |= CGtfReader::fGenbankMode;
             if (args["locus-tag"]) {
@@ -1257,10 +1326,23 @@ void CMultiReaderApp::xSetFlags(
         }
         break;
            
+    case CFormatGuess::eVcf:
+        if ( args["vcf-lazy"] ) {
+            m_iFlags |= CVcfReader::fLazyGenotypes;
+        }
+        break;
+
     case CFormatGuess::eGff3:
         if ( args["gene-xrefs"] ) {
             m_iFlags |= CGff3Reader::fGeneXrefs;
         }
+        if ( args["stream"].AsString() == "seqid" ) {
+            m_iFlags |= CGff3Reader::fStreamBySeqId;
+        }
+        if ( args["stream"].AsString() == "locus" ) {
+            m_iFlags |= CGff3Reader::fStreamBySeqId;
+            m_iFlags |= CGff3Reader::fStreamByLocus;
+        }
         if ( args["genbank"] ) {
             m_iFlags |= CGff3Reader::fGeneXrefs;
             m_iFlags |= CGff3Reader::fGenbankMode;
@@ -64,6 +64,14 @@ BEGIN_NCBI_SCOPE
 // NC fails much more often in CNCPeerControl::x_ReserveBGConn (too many connections)
 #define USE_ALWAYS_COPY_UPD  0
 
+/// Minimum size of blob data that is sent directly from database file;
+/// smaller pieces are better coalesced with response line in write buffer
+static const Uint4 kNCMinZeroCopySize = 16 * 1024;
+
+/// Maximum number of pipelined commands executed one after another without
+/// giving other tasks a chance to run
+static const Uint4 kNCMaxCmdsInBatch = 64;
+
 /// Definition of all NetCache commands
 /// 
 /// General format of a "NetCache" command is as follows:
@@ -1669,7 +1677,8 @@ CNCMessageHandler::CNCMessageHandler(void)
       m_write_event(NULL),
       m_ChunkLen(0),
       m_SrvsIndex(0),
-      m_ActiveHub(NULL)
+      m_ActiveHub(NULL),
+      m_CmdsInBatch(0)
 {
     LOG_CURRENT_FUNCTION
 #if __NC_TASKS_MONITOR
@@ -2449,6 +2458,7 @@ CNCMessageHandler::x_ReadCommand(void)
     if (x_IsHttpMode() && !m_PosponedCmd.empty()) {
         cmd_line = m_PosponedCmd;
     } else if (!ReadLine(&cmd_line)) {
+        m_CmdsInBatch = 0;
         if (!HasError()  &&  CanHaveMoreRead())
             return NULL;
         if (IsReadDataAvailable())
@@ -2953,7 +2963,18 @@ CNCMessageHandler::x_FinishCommand(void)
     if (x_IsFlagSet(fCursedPUT2Cmd))
         return &CNCMessageHandler::x_CloseCmdAndConn;
 
+    Uint1 prty = GetPriority();
     x_CleanCmdResources();
+    // Client may pipeline its commands.  Those that already came with the
+    // same read are executed within this slice, so a batch of commands costs
+    // one scheduler wake-up rather than one per command.
+    if (!x_IsHttpMode()  &&  IsReadDataAvailable()  &&  GetPriority() == prty
+        &&  ++m_CmdsInBatch < kNCMaxCmdsInBatch)
+    {
+        CNCStat::PipelinedCmd();
+        return &CNCMessageHandler::x_ReadCommand;
+    }
+    m_CmdsInBatch = 0;
     SetState(&CNCMessageHandler::x_ReadCommand);
     SetRunnable();
     return NULL;
@@ -3318,9 +3339,23 @@ CNCMessageHandler::x_WriteBlobData(void)
         if (m_Size != Uint8(-1)  &&  m_Size < want_read)
             want_read = Uint4(m_Size);
 
-        Uint4 n_written = Uint4(Write(m_BlobAccess->GetReadMemPtr(), want_read));
+        Uint4 n_written = 0;
+        bool zero_copy = false;
+        int file_fd;
+        Uint8 file_offset;
+        if (want_read >= kNCMinZeroCopySize  &&  CNCServer::IsZeroCopySend()
+            &&  m_BlobAccess->GetReadFileRange(file_fd, file_offset))
+        {
+            bool not_supported = false;
+            n_written = Uint4(SendFile(file_fd, file_offset, want_read,
+                                       not_supported));
+            zero_copy = !not_supported;
+        }
+        if (!zero_copy)
+            n_written = Uint4(Write(m_BlobAccess->GetReadMemPtr(), want_read));
         x_LogCmdEvent("Write");
         if (n_written != 0) {
+            CNCStat::BlobDataSent(n_written, zero_copy);
             if (m_Flags & fComesFromClient)
                 CNCStat::ClientDataRead(n_written);
             else
@@ -374,6 +374,8 @@ private:
     TServersList              m_CheckSrvs;
     TServersList              m_MirrorsDone;
     CNCActiveClientHub*       m_ActiveHub;
+    /// Number of commands executed in a row without returning to scheduler
+    Uint4                     m_CmdsInBatch;
     string                    m_LastPeerError;
     string                    m_StatType;
     Uint8                     m_AgeMax;
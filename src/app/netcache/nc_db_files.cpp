@@ -30,10 +30,16 @@
 
 #include <corelib/ncbimtx.hpp>
 #include <corelib/ncbifile.hpp>
+#include <util/checksum.hpp>
 
 #include "nc_db_files.hpp"
 #include "nc_utils.hpp"
 
+#ifdef NCBI_OS_LINUX
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
 
 
 BEGIN_NCBI_SCOPE
@@ -49,6 +55,459 @@ BEGIN_NCBI_SCOPE
 #define SETTINGS_VALUE      "v"
 
 
+/// Signatures at the beginning of index log and snapshot files.  Each is
+/// followed by Uint8 generation number.
+static const char kIndexLogSignature [8] = "NCIXLOG";
+static const char kIndexSnapSignature[8] = "NCIXSNP";
+static const size_t kIndexHeaderSize = 8 + sizeof(Uint8);
+/// Each record has Uint4 size of data, Uint4 CRC32 of type and data,
+/// Uint1 type and then data itself.
+static const size_t kIndexRecHeaderSize = 2 * sizeof(Uint4) + 1;
+/// Log is merged into snapshot when it becomes bigger than this and bigger
+/// than several snapshot sizes.
+static const Uint8 kIndexMinSnapLogSize = 64 * 1024;
+static const Uint8 kIndexSnapLogRatio = 4;
+
+enum EIndexRecType {
+    eIdxRecNewFile   = 1,   ///< Uint4 file_id, Int4 create_time, name
+    eIdxRecDelFile   = 2,   ///< Uint4 file_id
+    eIdxRecClearFiles = 3,  ///< no data
+    eIdxRecLogRecNo  = 4,   ///< Uint8 max sync log record number
+    eIdxRecPurge     = 5    ///< purge data string
+};
+
+
+template <typename NumType>
+static inline void
+s_PutNum(string& data, NumType num)
+{
+    data.append((const char*)&num, sizeof(num));
+}
+
+template <typename NumType>
+static inline NumType
+s_GetNum(const char* data)
+{
+    NumType num;
+    memcpy(&num, data, sizeof(num));
+    return num;
+}
+
+static Uint4
+s_CalcRecCRC(Uint1 type, const char* data, size_t size)
+{
+    CChecksum crc(CChecksum::eCRC32);
+    crc.AddChars((const char*)&type, 1);
+    crc.AddChars(data, size);
+    return crc.GetChecksum();
+}
+
+static void
+s_PutRecord(string& buf, Uint1 type, const string& data)
+{
+    s_PutNum(buf, Uint4(data.size()));
+    s_PutNum(buf, s_CalcRecCRC(type, data.data(), data.size()));
+    buf.append(1, char(type));
+    buf.append(data);
+}
+
+static string
+s_MakeHeader(const char* signature, Uint8 generation)
+{
+    string header(signature, 8);
+    s_PutNum(header, generation);
+    return header;
+}
+
+static string
+s_ReadWholeFile(const string& file_name)
+{
+    CFileIO file;
+    file.Open(file_name, CFileIO::eOpen, CFileIO::eRead);
+    string data;
+    data.resize(size_t(file.GetFileSize()));
+    size_t pos = 0;
+    while (pos < data.size()) {
+        size_t n_read = file.Read(&data[pos], data.size() - pos);
+        if (n_read == 0)
+            break;
+        pos += n_read;
+    }
+    data.resize(pos);
+    return data;
+}
+
+static void
+s_WriteAll(CFileIO& file, const string& data)
+{
+    size_t pos = 0;
+    while (pos < data.size()) {
+        pos += file.Write(data.data() + pos, data.size() - pos);
+    }
+}
+
+/// Make sure that file renaming in the directory is on disk
+static void
+s_SyncDir(const string& file_name)
+{
+#ifdef NCBI_OS_LINUX
+    string dir = CDirEntry::GetNearestExistingParentDir(file_name);
+    int fd = open(dir.c_str(), O_RDONLY);
+    if (fd == -1) {
+        NCBI_THROW(CFileErrnoException, eFile,
+                   "Cannot open directory " + dir);
+    }
+    int res = fsync(fd);
+    close(fd);
+    if (res != 0) {
+        NCBI_THROW(CFileErrnoException, eFileIO,
+                   "Cannot sync directory " + dir);
+    }
+#endif
+}
+
+
+CNCDBIndexLog::CNCDBIndexLog(const string& base_name)
+    : m_BaseName(base_name),
+      m_Generation(0),
+      m_LogSize(0),
+      m_SnapSize(0),
+      m_LogRecNo(0)
+{}
+
+CNCDBIndexLog::~CNCDBIndexLog(void)
+{}
+
+string
+CNCDBIndexLog::GetLogName(void) const
+{
+    return m_BaseName + ".log";
+}
+
+void
+CNCDBIndexLog::Remove(const string& base_name)
+{
+    CFile(base_name + ".log").Remove();
+    CFile(base_name + ".snap").Remove();
+    CFile(base_name + ".snap.tmp").Remove();
+}
+
+bool
+CNCDBIndexLog::Open(void)
+{
+    m_Files.clear();
+    m_LogRecNo = 0;
+    m_PurgeData.clear();
+    m_SnapSize = 0;
+
+    bool existed = false;
+    Uint8 snap_gen = 0;
+    string snap_name = m_BaseName + ".snap";
+    if (CFile(snap_name).Exists()) {
+        string data = s_ReadWholeFile(snap_name);
+        if (data.size() < kIndexHeaderSize
+            ||  memcmp(data.data(), kIndexSnapSignature, 8) != 0)
+        {
+            NCBI_THROW(CFileException, eFileIO,
+                       "Wrong header of index snapshot " + snap_name);
+        }
+        snap_gen = s_GetNum<Uint8>(data.data() + 8);
+        Uint4 cnt_recs = 0;
+        size_t body_size = data.size() - kIndexHeaderSize;
+        if (x_ReplayRecords(data.data() + kIndexHeaderSize, body_size,
+                            cnt_recs) != body_size)
+        {
+            NCBI_THROW(CFileException, eFileIO,
+                       "Index snapshot " + snap_name + " is corrupted");
+        }
+        m_SnapSize = data.size();
+        existed = true;
+    }
+
+    string log_name = GetLogName();
+    if (!CFile(log_name).Exists()) {
+        x_StartLog(snap_gen + 1);
+        return existed;
+    }
+    existed = true;
+
+    string data = s_ReadWholeFile(log_name);
+    if (data.size() < kIndexHeaderSize) {
+        // Crash right after creation of the log, nothing is in it
+        x_StartLog(snap_gen + 1);
+        return existed;
+    }
+    if (memcmp(data.data(), kIndexLogSignature, 8) != 0) {
+        NCBI_THROW(CFileException, eFileIO,
+                   "Wrong header of index log " + log_name);
+    }
+    Uint8 log_gen = s_GetNum<Uint8>(data.data() + 8);
+    if (log_gen <= snap_gen) {
+        // Crash after the log was merged into snapshot but before new log
+        // was started, everything in the log is in the snapshot already.
+        x_StartLog(snap_gen + 1);
+        return existed;
+    }
+
+    Uint4 cnt_recs = 0;
+    size_t body_size = data.size() - kIndexHeaderSize;
+    size_t valid_size = x_ReplayRecords(data.data() + kIndexHeaderSize,
+                                        body_size, cnt_recs);
+    m_Log.Open(log_name, CFileIO::eOpen, CFileIO::eReadWrite);
+    m_LogSize = kIndexHeaderSize + valid_size;
+    if (valid_size != body_size) {
+        SRV_LOG(Error, "Index log " << log_name << " has "
+                       << (body_size - valid_size)
+                       << " bytes of incomplete or corrupted records after "
+                       << cnt_recs << " good ones. Cutting them off.");
+        m_Log.SetFileSize(m_LogSize, CFileIO::eEnd);
+        m_Log.Flush();
+    }
+    else {
+        m_Log.SetFilePos(0, CFileIO::eEnd);
+    }
+    m_Generation = log_gen;
+    return existed;
+}
+
+bool
+CNCDBIndexLog::x_ApplyRecord(Uint1 type, const char* data, Uint4 size)
+{
+    switch (type) {
+    case eIdxRecNewFile:
+        if (size < sizeof(Uint4) + sizeof(Int4))
+            return false;
+        {
+            SFileRec& rec = m_Files[s_GetNum<Uint4>(data)];
+            rec.create_time = s_GetNum<Int4>(data + sizeof(Uint4));
+            rec.name.assign(data + sizeof(Uint4) + sizeof(Int4),
+                            size - sizeof(Uint4) - sizeof(Int4));
+        }
+        return true;
+    case eIdxRecDelFile:
+        if (size != sizeof(Uint4))
+            return false;
+        m_Files.erase(s_GetNum<Uint4>(data));
+        return true;
+    case eIdxRecClearFiles:
+        m_Files.clear();
+        return true;
+    case eIdxRecLogRecNo:
+        if (size != sizeof(Uint8))
+            return false;
+        m_LogRecNo = s_GetNum<Uint8>(data);
+        return true;
+    case eIdxRecPurge:
+        m_PurgeData.assign(data, size);
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t
+CNCDBIndexLog::x_ReplayRecords(const char* data, size_t size, Uint4& cnt_recs)
+{
+    size_t pos = 0;
+    while (size - pos >= kIndexRecHeaderSize) {
+        const char* rec = data + pos;
+        Uint4 rec_size = s_GetNum<Uint4>(rec);
+        Uint4 rec_crc  = s_GetNum<Uint4>(rec + sizeof(Uint4));
+        Uint1 rec_type = Uint1(rec[2 * sizeof(Uint4)]);
+        const char* rec_data = rec + kIndexRecHeaderSize;
+        if (rec_size > size - pos - kIndexRecHeaderSize
+            ||  s_CalcRecCRC(rec_type, rec_data, rec_size) != rec_crc
+            ||  !x_ApplyRecord(rec_type, rec_data, rec_size))
+        {
+            break;
+        }
+        pos += kIndexRecHeaderSize + rec_size;
+        ++cnt_recs;
+    }
+    return pos;
+}
+
+void
+CNCDBIndexLog::x_StartLog(Uint8 generation)
+{
+    m_Log.Close();
+    m_Log.Open(GetLogName(), CFileIO::eCreate, CFileIO::eReadWrite);
+    s_WriteAll(m_Log, s_MakeHeader(kIndexLogSignature, generation));
+    m_Log.Flush();
+    m_Generation = generation;
+    m_LogSize = kIndexHeaderSize;
+}
+
+void
+CNCDBIndexLog::x_WriteSnapshot(void)
+{
+    string data = s_MakeHeader(kIndexSnapSignature, m_Generation);
+    ITERATE(TFilesMap, it, m_Files) {
+        string rec;
+        s_PutNum(rec, it->first);
+        s_PutNum(rec, Int4(it->second.create_time));
+        rec.append(it->second.name);
+        s_PutRecord(data, eIdxRecNewFile, rec);
+    }
+    string rec_no;
+    s_PutNum(rec_no, m_LogRecNo);
+    s_PutRecord(data, eIdxRecLogRecNo, rec_no);
+    s_PutRecord(data, eIdxRecPurge, m_PurgeData);
+
+    string snap_name = m_BaseName + ".snap";
+    string tmp_name = snap_name + ".tmp";
+    {{
+        CFileIO file;
+        file.Open(tmp_name, CFileIO::eCreate, CFileIO::eWrite);
+        s_WriteAll(file, data);
+        file.Flush();
+    }}
+    if (!CFile(tmp_name).Rename(snap_name, CDirEntry::fRF_Overwrite)) {
+        NCBI_THROW(CFileErrnoException, eFile,
+                   "Cannot rename " + tmp_name + " to " + snap_name);
+    }
+    // Snapshot must be on disk before the log it replaces is dropped
+    s_SyncDir(snap_name);
+    m_SnapSize = data.size();
+    x_StartLog(m_Generation + 1);
+}
+
+void
+CNCDBIndexLog::x_AppendRecord(Uint1 type, const string& data)
+{
+    string rec;
+    s_PutRecord(rec, type, data);
+    try {
+        s_WriteAll(m_Log, rec);
+        m_Log.Flush();
+    }
+    catch (CFileException&) {
+        // Don't leave partial record that would hide all following ones
+        try {
+            m_Log.SetFileSize(m_LogSize, CFileIO::eEnd);
+        }
+        catch (CFileException&) {
+        }
+        throw;
+    }
+    m_LogSize += rec.size();
+    x_ApplyRecord(type, data.data(), Uint4(data.size()));
+
+    if (m_LogSize >= kIndexMinSnapLogSize
+        &&  m_LogSize >= m_SnapSize * kIndexSnapLogRatio)
+    {
+        x_WriteSnapshot();
+    }
+}
+
+void
+CNCDBIndexLog::NewDBFile(Uint4 file_id, const string& file_name)
+{
+    string data;
+    s_PutNum(data, file_id);
+    s_PutNum(data, Int4(CSrvTime::CurSecs()));
+    data.append(file_name);
+    x_AppendRecord(eIdxRecNewFile, data);
+}
+
+void
+CNCDBIndexLog::DeleteDBFile(Uint4 file_id)
+{
+    string data;
+    s_PutNum(data, file_id);
+    x_AppendRecord(eIdxRecDelFile, data);
+}
+
+void
+CNCDBIndexLog::GetAllDBFiles(TNCDBFilesMap* files_map)
+{
+    ITERATE(TFilesMap, it, m_Files) {
+        SNCDBFileInfo* info = new SNCDBFileInfo();
+        (*files_map)[it->first] = info;
+        info->file_id     = it->first;
+        info->file_name   = it->second.name;
+        info->create_time = it->second.create_time;
+    }
+}
+
+void
+CNCDBIndexLog::DeleteAllDBFiles(void)
+{
+    x_AppendRecord(eIdxRecClearFiles, kEmptyStr);
+}
+
+Uint8
+CNCDBIndexLog::GetMaxSyncLogRecNo(void)
+{
+    return m_LogRecNo;
+}
+
+void
+CNCDBIndexLog::SetMaxSyncLogRecNo(Uint8 rec_no)
+{
+    string data;
+    s_PutNum(data, rec_no);
+    x_AppendRecord(eIdxRecLogRecNo, data);
+}
+
+string
+CNCDBIndexLog::GetPurgeData(void)
+{
+    return m_PurgeData;
+}
+
+void
+CNCDBIndexLog::UpdatePurgeData(const string& data)
+{
+    x_AppendRecord(eIdxRecPurge, data);
+}
+
+void
+CNCDBIndexLog::Import(const TNCDBFilesMap& files_map,
+                      Uint8                log_rec_no,
+                      const string&        purge_data)
+{
+    m_Files.clear();
+    ITERATE(TNCDBFilesMap, it, files_map) {
+        SFileRec& rec = m_Files[it->first];
+        rec.name = it->second->file_name;
+        rec.create_time = it->second->create_time;
+    }
+    m_LogRecNo = log_rec_no;
+    m_PurgeData = purge_data;
+    x_WriteSnapshot();
+}
+
+bool
+CNCDBIndexLog::ImportSQLiteIndex(const string& file_name)
+{
+    if (!CFile(file_name).Exists())
+        return false;
+
+    TNCDBFilesMap files_map;
+    Uint8 log_rec_no = 0;
+    string purge_data;
+    try {
+        CNCDBIndexFile old_index(file_name);
+        old_index.GetAllDBFiles(&files_map);
+        log_rec_no = old_index.GetMaxSyncLogRecNo();
+        purge_data = old_index.GetPurgeData();
+    }
+    catch (CSQLITE_Exception& ex) {
+        SRV_LOG(Critical, "Error reading old index file, "
+                          "some of the storage can be lost: " << ex);
+    }
+    Import(files_map, log_rec_no, purge_data);
+    if (!CFile(file_name).Rename(file_name + ".migrated",
+                                 CDirEntry::fRF_Overwrite))
+    {
+        SRV_LOG(Critical, "Cannot rename old index file " << file_name
+                          << ", errno=" << errno);
+    }
+    return true;
+}
+
+
 
 CNCDBIndexFile::~CNCDBIndexFile(void)
 {}
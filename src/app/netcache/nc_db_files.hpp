@@ -29,6 +29,7 @@
  */
 
 #include <corelib/ncbithr.hpp>
+#include <corelib/ncbifile.hpp>
 #include <db/sqlite/sqlitewrapp.hpp>
 
 #include "nc_db_info.hpp"
@@ -41,8 +42,105 @@ BEGIN_NCBI_SCOPE
 class CNCDBStat;
 
 
-/// Connection to index database in NetCache storage. Database contains
-/// information about storage parts containing actual blobs data.
+/// Index of NetCache storage kept as an append-only log with periodic
+/// snapshots.  Index contains information about storage parts containing
+/// actual blobs data and a few storage-wide settings.
+///
+/// Every change is appended to the log file as a checksummed record and
+/// synced to disk.  When the log grows large enough compared to the last
+/// snapshot, full current state is written into a new snapshot file
+/// (through temporary file and rename) and log is started anew.  Opening
+/// the index loads the snapshot and replays the log written after it.
+/// Torn or corrupted tail of the log (e.g. after a crash in the middle of
+/// write) is cut off.
+///
+/// All methods throw CFileException on errors.
+class CNCDBIndexLog
+{
+public:
+    /// Create index object working with files base_name + ".log" and
+    /// base_name + ".snap".  Nothing is read or created until Open().
+    CNCDBIndexLog(const string& base_name);
+    ~CNCDBIndexLog(void);
+
+    /// Load the index from disk creating empty one if it doesn't exist.
+    ///
+    /// @return
+    ///   TRUE if index existed on disk, FALSE if it was just created
+    bool Open(void);
+    /// Remove all files of the index with given base name
+    static void Remove(const string& base_name);
+    /// Name of the log file of the index
+    string GetLogName(void) const;
+
+    /// Save information about new database part.
+    /// Creation time of the part is set to current time.
+    void NewDBFile(Uint4 file_id, const string& file_name);
+    /// Delete database part
+    void DeleteDBFile(Uint4 file_id);
+    /// Read information about all database parts in order of their creation
+    void GetAllDBFiles(TNCDBFilesMap* files_map);
+    /// Clean index removing information about all database parts.
+    void DeleteAllDBFiles(void);
+
+    Uint8 GetMaxSyncLogRecNo(void);
+    void SetMaxSyncLogRecNo(Uint8 rec_no);
+
+    string GetPurgeData(void);
+    void UpdatePurgeData(const string& data);
+
+    /// Replace contents of the index with the given one (used for migration
+    /// from the old SQLite-based index) and write it as a snapshot.
+    void Import(const TNCDBFilesMap& files_map,
+                Uint8                log_rec_no,
+                const string&        purge_data);
+    /// Import contents of the SQLite index file used by older versions of
+    /// NetCache (see CNCDBIndexFile) and rename that file to
+    /// file_name + ".migrated" so that it's not imported again.  If the
+    /// file can be read only partially, whatever was read is imported.
+    ///
+    /// @return
+    ///   FALSE if there's no such file
+    bool ImportSQLiteIndex(const string& file_name);
+
+private:
+    CNCDBIndexLog(const CNCDBIndexLog&);
+    CNCDBIndexLog& operator= (const CNCDBIndexLog&);
+
+    struct SFileRec
+    {
+        string name;
+        int    create_time;
+    };
+    typedef map<Uint4, SFileRec> TFilesMap;
+
+    /// Apply one record to the in-memory state
+    bool x_ApplyRecord(Uint1 type, const char* data, Uint4 size);
+    /// Apply all valid records in the buffer, return size of valid part
+    size_t x_ReplayRecords(const char* data, size_t size, Uint4& cnt_recs);
+    /// Append one record to the log and sync it to disk
+    void x_AppendRecord(Uint1 type, const string& data);
+    /// Write current state into a new snapshot and start new log
+    void x_WriteSnapshot(void);
+    void x_StartLog(Uint8 generation);
+
+    string    m_BaseName;
+    CFileIO   m_Log;
+    /// Generation of the current log; snapshot holds generation of the last
+    /// log merged into it.
+    Uint8     m_Generation;
+    Uint8     m_LogSize;
+    Uint8     m_SnapSize;
+    TFilesMap m_Files;
+    Uint8     m_LogRecNo;
+    string    m_PurgeData;
+};
+
+
+/// Connection to index database in NetCache storage used by older versions
+/// of NetCache.  Now it is used only to migrate its contents into
+/// CNCDBIndexLog.  Database contains information about storage parts
+/// containing actual blobs data.
 class CNCDBIndexFile : public CSQLITE_Connection
 {
 public:
@@ -0,0 +1,440 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   In-memory tier keeping whole copies of frequently read blobs.
+ */
+
+#include "nc_pch.hpp"
+
+#include "nc_hot_cache.hpp"
+#include "nc_db_info.hpp"
+#include "nc_stat.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// Number of independently locked parts of the cache
+static const Uint1 kHotCacheShards = 16;
+/// Number of rows (hash functions) in the frequency sketch
+static const Uint1 kSketchDepth = 4;
+/// Saturation value of sketch counters
+static const Uint1 kSketchMaxCount = 15;
+/// Assumed average size of cached blob, used to size the sketch
+static const Uint8 kSketchBlobSize = 4096;
+static const Uint4 kSketchMinWidth = 1024;
+static const Uint4 kSketchMaxWidth = 1 << 20;
+/// Maximum number of blobs admission can evict to make room for a new one
+static const Uint4 kMaxAdmitVictims = 64;
+
+
+struct SHotCacheShard
+{
+    CMiniMutex lock;
+    typedef map<string, SNCHotBlob*> TBlobsMap;
+    TBlobsMap   blobs;
+    /// Most and least recently used blobs
+    SNCHotBlob* lru_head;
+    SNCHotBlob* lru_tail;
+    Uint8       mem_size;
+    Uint4       cnt_blobs;
+    /// Count-min sketch: kSketchDepth rows of sketch_width counters
+    vector<Uint1> sketch;
+    Uint4       sketch_width;
+    Uint4       cnt_samples;
+
+    SHotCacheShard(void)
+        : lru_head(NULL), lru_tail(NULL),
+          mem_size(0), cnt_blobs(0),
+          sketch_width(0), cnt_samples(0)
+    {}
+};
+
+
+static SHotCacheShard s_Shards[kHotCacheShards];
+static Uint8 s_MemLimit = 0;
+static Uint8 s_MaxBlobSize = 0;
+
+
+SNCHotBlob::SNCHotBlob(void)
+    : key_hash(0),
+      create_time(0),
+      create_server(0),
+      create_id(0),
+      size(0),
+      data(NULL),
+      lru_prev(NULL),
+      lru_next(NULL)
+{}
+
+SNCHotBlob::~SNCHotBlob(void)
+{
+    free(data);
+}
+
+bool
+SNCHotBlob::IsSameVersion(const SNCBlobVerData* ver_data) const
+{
+    return create_time == ver_data->create_time
+           &&  create_server == ver_data->create_server
+           &&  create_id == ver_data->create_id
+           &&  size == ver_data->size;
+}
+
+
+static inline Uint8
+s_HashKey(const string& key)
+{
+    // FNV-1a
+    Uint8 hash = NCBI_CONST_UINT8(14695981039346656037);
+    for (size_t i = 0; i < key.size(); ++i) {
+        hash ^= Uint1(key[i]);
+        hash *= NCBI_CONST_UINT8(1099511628211);
+    }
+    return hash;
+}
+
+static inline SHotCacheShard&
+s_GetShard(Uint8 hash)
+{
+    return s_Shards[(hash >> 56) % kHotCacheShards];
+}
+
+static inline Uint8
+s_ShardLimit(void)
+{
+    return s_MemLimit / kHotCacheShards;
+}
+
+static inline Uint1*
+s_SketchCounter(SHotCacheShard& shard, Uint8 hash, Uint1 row)
+{
+    Uint4 h1 = Uint4(hash);
+    Uint4 h2 = Uint4(hash >> 32) | 1;
+    Uint4 idx = (h1 + row * h2) & (shard.sketch_width - 1);
+    return &shard.sketch[row * shard.sketch_width + idx];
+}
+
+static Uint1
+s_EstimateFreq(SHotCacheShard& shard, Uint8 hash)
+{
+    if (shard.sketch_width == 0)
+        return 0;
+    Uint1 freq = kSketchMaxCount;
+    for (Uint1 row = 0; row < kSketchDepth; ++row) {
+        freq = min(freq, *s_SketchCounter(shard, hash, row));
+    }
+    return freq;
+}
+
+static void
+s_CountAccess(SHotCacheShard& shard, Uint8 hash)
+{
+    if (shard.sketch_width == 0)
+        return;
+
+    // Conservative update: only the smallest counters grow
+    Uint1 freq = s_EstimateFreq(shard, hash);
+    if (freq < kSketchMaxCount) {
+        for (Uint1 row = 0; row < kSketchDepth; ++row) {
+            Uint1* counter = s_SketchCounter(shard, hash, row);
+            if (*counter == freq)
+                ++*counter;
+        }
+    }
+    // Age all counters so that frequencies reflect recent accesses
+    if (++shard.cnt_samples >= 10 * shard.sketch_width) {
+        NON_CONST_ITERATE(vector<Uint1>, it, shard.sketch) {
+            *it >>= 1;
+        }
+        shard.cnt_samples = 0;
+    }
+}
+
+static void
+s_LinkFront(SHotCacheShard& shard, SNCHotBlob* blob)
+{
+    blob->lru_prev = NULL;
+    blob->lru_next = shard.lru_head;
+    if (shard.lru_head)
+        shard.lru_head->lru_prev = blob;
+    else
+        shard.lru_tail = blob;
+    shard.lru_head = blob;
+}
+
+static void
+s_UnlinkLRU(SHotCacheShard& shard, SNCHotBlob* blob)
+{
+    if (blob->lru_prev)
+        blob->lru_prev->lru_next = blob->lru_next;
+    else
+        shard.lru_head = blob->lru_next;
+    if (blob->lru_next)
+        blob->lru_next->lru_prev = blob->lru_prev;
+    else
+        shard.lru_tail = blob->lru_prev;
+    blob->lru_prev = blob->lru_next = NULL;
+}
+
+/// Remove blob from the shard.  Cache's reference to it is added to
+/// to_release and should be removed after shard's lock is released.
+static void
+s_RemoveBlob(SHotCacheShard& shard,
+             SNCHotBlob* blob,
+             vector<SNCHotBlob*>& to_release)
+{
+    s_UnlinkLRU(shard, blob);
+    shard.blobs.erase(blob->key);
+    shard.mem_size -= blob->size;
+    --shard.cnt_blobs;
+    to_release.push_back(blob);
+}
+
+static void
+s_ReleaseBlobs(const vector<SNCHotBlob*>& to_release)
+{
+    ITERATE(vector<SNCHotBlob*>, it, to_release) {
+        (*it)->RemoveReference();
+    }
+}
+
+static void
+s_EvictToLimit(SHotCacheShard& shard,
+               Uint8 limit,
+               vector<SNCHotBlob*>& to_release)
+{
+    while (shard.lru_tail  &&  shard.mem_size > limit) {
+        SNCHotBlob* victim = shard.lru_tail;
+        CNCStat::HotBlobEvicted(victim->size);
+        s_RemoveBlob(shard, victim, to_release);
+    }
+}
+
+/// Check if the blob with given hash and size should replace the least
+/// recently used blobs which would have to be evicted to make room for it.
+static bool
+s_CanAdmit(SHotCacheShard& shard, Uint8 hash, Uint8 size)
+{
+    Uint8 limit = s_ShardLimit();
+    if (size > limit)
+        return false;
+    if (shard.mem_size + size <= limit)
+        return true;
+
+    Uint8 need_size = shard.mem_size + size - limit;
+    Uint8 freed = 0;
+    Uint4 cnt_victims = 0;
+    Uint1 freq = s_EstimateFreq(shard, hash);
+    for (SNCHotBlob* victim = shard.lru_tail;
+         victim  &&  freed < need_size;  victim = victim->lru_prev)
+    {
+        if (++cnt_victims > kMaxAdmitVictims
+            ||  s_EstimateFreq(shard, victim->key_hash) >= freq)
+        {
+            return false;
+        }
+        freed += victim->size;
+    }
+    return freed >= need_size;
+}
+
+static Uint4
+s_CalcSketchWidth(Uint8 mem_limit)
+{
+    Uint8 cnt_blobs = mem_limit / kHotCacheShards / kSketchBlobSize;
+    Uint4 width = kSketchMinWidth;
+    while (width < cnt_blobs  &&  width < kSketchMaxWidth)
+        width <<= 1;
+    return width;
+}
+
+
+void
+CNCHotBlobCache::SetLimits(Uint8 mem_limit, Uint8 max_blob_size)
+{
+    s_MaxBlobSize = max_blob_size;
+    s_MemLimit = mem_limit;
+    Uint4 width = mem_limit == 0? 0: s_CalcSketchWidth(mem_limit);
+
+    for (Uint1 i = 0; i < kHotCacheShards; ++i) {
+        SHotCacheShard& shard = s_Shards[i];
+        vector<SNCHotBlob*> to_release;
+
+        shard.lock.Lock();
+        if (shard.sketch_width != width) {
+            shard.sketch.clear();
+            shard.sketch.resize(size_t(width) * kSketchDepth, 0);
+            shard.sketch_width = width;
+            shard.cnt_samples = 0;
+        }
+        s_EvictToLimit(shard, s_ShardLimit(), to_release);
+        shard.lock.Unlock();
+
+        s_ReleaseBlobs(to_release);
+    }
+}
+
+Uint8
+CNCHotBlobCache::GetMemLimit(void)
+{
+    return s_MemLimit;
+}
+
+Uint8
+CNCHotBlobCache::GetMaxBlobSize(void)
+{
+    return s_MaxBlobSize;
+}
+
+bool
+CNCHotBlobCache::IsEnabled(void)
+{
+    return s_MemLimit != 0  &&  s_MaxBlobSize != 0;
+}
+
+CSrvRef<SNCHotBlob>
+CNCHotBlobCache::Find(const string& key,
+                      const SNCBlobVerData* ver_data,
+                      bool& need_admit)
+{
+    need_admit = false;
+    CSrvRef<SNCHotBlob> result;
+    if (!IsEnabled()  ||  ver_data->size == 0
+        ||  ver_data->size > s_MaxBlobSize)
+    {
+        return result;
+    }
+
+    Uint8 hash = s_HashKey(key);
+    SHotCacheShard& shard = s_GetShard(hash);
+    vector<SNCHotBlob*> to_release;
+
+    shard.lock.Lock();
+    s_CountAccess(shard, hash);
+    SHotCacheShard::TBlobsMap::iterator it = shard.blobs.find(key);
+    if (it != shard.blobs.end()) {
+        SNCHotBlob* blob = it->second;
+        if (blob->IsSameVersion(ver_data)) {
+            s_UnlinkLRU(shard, blob);
+            s_LinkFront(shard, blob);
+            result = blob;
+        }
+        else {
+            s_RemoveBlob(shard, blob, to_release);
+        }
+    }
+    if (!result)
+        need_admit = s_CanAdmit(shard, hash, ver_data->size);
+    shard.lock.Unlock();
+
+    s_ReleaseBlobs(to_release);
+    if (result)
+        CNCStat::HotBlobHit(result->size);
+    else
+        CNCStat::HotBlobMiss();
+    return result;
+}
+
+CSrvRef<SNCHotBlob>
+CNCHotBlobCache::Put(const string& key,
+                     const SNCBlobVerData* ver_data,
+                     char* data)
+{
+    CSrvRef<SNCHotBlob> result;
+    Uint8 hash = s_HashKey(key);
+    SHotCacheShard& shard = s_GetShard(hash);
+    vector<SNCHotBlob*> to_release;
+
+    shard.lock.Lock();
+    // Things could have changed since Find()
+    if (!IsEnabled()  ||  !s_CanAdmit(shard, hash, ver_data->size)) {
+        shard.lock.Unlock();
+        free(data);
+        return result;
+    }
+    SHotCacheShard::TBlobsMap::iterator it = shard.blobs.find(key);
+    if (it != shard.blobs.end())
+        s_RemoveBlob(shard, it->second, to_release);
+    s_EvictToLimit(shard, s_ShardLimit() - ver_data->size, to_release);
+
+    SNCHotBlob* blob = new SNCHotBlob();
+    blob->key = key;
+    blob->key_hash = hash;
+    blob->create_time = ver_data->create_time;
+    blob->create_server = ver_data->create_server;
+    blob->create_id = ver_data->create_id;
+    blob->size = ver_data->size;
+    blob->data = data;
+    // Reference owned by the cache
+    blob->AddReference();
+    shard.blobs[key] = blob;
+    s_LinkFront(shard, blob);
+    shard.mem_size += blob->size;
+    ++shard.cnt_blobs;
+    result = blob;
+    shard.lock.Unlock();
+
+    s_ReleaseBlobs(to_release);
+    CNCStat::HotBlobAdmitted(blob->size);
+    return result;
+}
+
+void
+CNCHotBlobCache::Invalidate(const string& key)
+{
+    if (s_MemLimit == 0)
+        return;
+
+    Uint8 hash = s_HashKey(key);
+    SHotCacheShard& shard = s_GetShard(hash);
+    vector<SNCHotBlob*> to_release;
+
+    shard.lock.Lock();
+    SHotCacheShard::TBlobsMap::iterator it = shard.blobs.find(key);
+    if (it != shard.blobs.end())
+        s_RemoveBlob(shard, it->second, to_release);
+    shard.lock.Unlock();
+
+    s_ReleaseBlobs(to_release);
+}
+
+void
+CNCHotBlobCache::ReadState(SNCStateStat& state)
+{
+    state.hot_size = 0;
+    state.hot_blobs = 0;
+    for (Uint1 i = 0; i < kHotCacheShards; ++i) {
+        SHotCacheShard& shard = s_Shards[i];
+        shard.lock.Lock();
+        state.hot_size += shard.mem_size;
+        state.hot_blobs += shard.cnt_blobs;
+        shard.lock.Unlock();
+    }
+}
+
+
+END_NCBI_SCOPE
@@ -0,0 +1,114 @@
+#ifndef NETCACHE__NC_HOT_CACHE__HPP
+#define NETCACHE__NC_HOT_CACHE__HPP
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   In-memory tier keeping whole copies of frequently read blobs.
+ *
+ * Blobs not larger than hot_cache_max_blob_size are copied into memory
+ * when they are read from the database files and the admission filter lets
+ * them in.  The filter is TinyLFU: access frequencies of all read blobs are
+ * estimated with a count-min sketch of 4-bit counters which are halved
+ * periodically, and a new blob is admitted only if it is accessed more
+ * often than every blob that would have to be evicted to make room for it.
+ * Eviction candidates are taken from the least recently used end, so large
+ * blobs have to be correspondingly popular to get in.
+ *
+ * Cached copies are bound to the version of the blob (create time, server
+ * and id, size) and are never served for any other version.  On top of
+ * that they are dropped as soon as a new version becomes current (client
+ * write or peer synchronization) or the blob is deleted.
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+struct SNCBlobVerData;
+struct SNCStateStat;
+
+
+/// Copy of the whole data of one version of a blob
+struct SNCHotBlob : public CObject
+{
+    string key;
+    Uint8  key_hash;
+    Uint8  create_time;
+    Uint8  create_server;
+    Uint4  create_id;
+    Uint8  size;
+    char*  data;
+    /// Neighbours in the shard's LRU list (under shard's lock)
+    SNCHotBlob* lru_prev;
+    SNCHotBlob* lru_next;
+
+    SNCHotBlob(void);
+    virtual ~SNCHotBlob(void);
+
+    bool IsSameVersion(const SNCBlobVerData* ver_data) const;
+
+private:
+    SNCHotBlob(const SNCHotBlob&);
+    SNCHotBlob& operator= (const SNCHotBlob&);
+};
+
+
+class CNCHotBlobCache
+{
+public:
+    /// Set memory limit of the cache (0 disables it) and the maximum size
+    /// of blobs it keeps.  Can be called at any time.
+    static void SetLimits(Uint8 mem_limit, Uint8 max_blob_size);
+    static Uint8 GetMemLimit(void);
+    static Uint8 GetMaxBlobSize(void);
+    static bool IsEnabled(void);
+
+    /// Look up data of the given blob version, counting the access in
+    /// the admission filter.  If blob is not in the cache then need_admit
+    /// is set to TRUE when it is worth reading the whole blob and giving
+    /// it to Put().
+    static CSrvRef<SNCHotBlob> Find(const string& key,
+                                    const SNCBlobVerData* ver_data,
+                                    bool& need_admit);
+    /// Add blob data read from the database.  Cache takes ownership of
+    /// data (allocated with malloc()).  Returns NULL (and frees data) if
+    /// blob wasn't admitted.
+    static CSrvRef<SNCHotBlob> Put(const string& key,
+                                   const SNCBlobVerData* ver_data,
+                                   char* data);
+    /// Drop any cached data of the blob
+    static void Invalidate(const string& key);
+
+    static void ReadState(SNCStateStat& state);
+
+private:
+    CNCHotBlobCache(void);
+};
+
+
+END_NCBI_SCOPE
+
+#endif /* NETCACHE__NC_HOT_CACHE__HPP */
@@ -228,12 +228,22 @@ void
 CNCStat::x_ClearStats(void)
 {
     m_StartedCmds = 0;
+    m_PipelinedCmds = 0;
     m_ClDataWrite = 0;
     m_ClDataRead = 0;
     m_PeerDataWrite = 0;
     m_PeerDataRead = 0;
     m_DiskDataWrite = 0;
     m_DiskDataRead = 0;
+    m_SentZeroCopy = 0;
+    m_SentBuffered = 0;
+    m_HotHits = 0;
+    m_HotHitSize = 0;
+    m_HotMisses = 0;
+    m_HotAdmitted = 0;
+    m_HotAdmitSize = 0;
+    m_HotEvicted = 0;
+    m_HotEvictSize = 0;
     m_MaxBlobSize = 0;
     m_ClWrBlobs = 0;
     m_ClWrBlobSize = 0;
@@ -274,6 +284,7 @@ CNCStat::x_ClearStats(void)
     m_WBMemSize.Initialize();
     m_WBReleasable.Initialize();
     m_WBReleasing.Initialize();
+    m_HotMemSize.Initialize();
 }
 
 void
@@ -323,6 +334,7 @@ void
 CNCStat::x_AddStats(CNCStat* src_stat)
 {
     m_StartedCmds += src_stat->m_StartedCmds;
+    m_PipelinedCmds += src_stat->m_PipelinedCmds;
     m_CmdLens.AddValues(src_stat->m_CmdLens);
     ITERATE(TCmdCountsMap, it, src_stat->m_CmdsByName) {
         m_CmdsByName[it->first] += it->second;
@@ -342,6 +354,15 @@ CNCStat::x_AddStats(CNCStat* src_stat)
     m_PeerDataRead += src_stat->m_PeerDataRead;
     m_DiskDataWrite += src_stat->m_DiskDataWrite;
     m_DiskDataRead += src_stat->m_DiskDataRead;
+    m_SentZeroCopy += src_stat->m_SentZeroCopy;
+    m_SentBuffered += src_stat->m_SentBuffered;
+    m_HotHits += src_stat->m_HotHits;
+    m_HotHitSize += src_stat->m_HotHitSize;
+    m_HotMisses += src_stat->m_HotMisses;
+    m_HotAdmitted += src_stat->m_HotAdmitted;
+    m_HotAdmitSize += src_stat->m_HotAdmitSize;
+    m_HotEvicted += src_stat->m_HotEvicted;
+    m_HotEvictSize += src_stat->m_HotEvictSize;
     m_MaxBlobSize = max(m_MaxBlobSize, src_stat->m_MaxBlobSize);
     m_ClWrBlobs += src_stat->m_ClWrBlobs;
     m_ClWrBlobSize += src_stat->m_ClWrBlobSize;
@@ -375,6 +396,7 @@ CNCStat::x_AddStats(CNCStat* src_stat)
     m_WBMemSize.AddValues(src_stat->m_WBMemSize);
     m_WBReleasable.AddValues(src_stat->m_WBReleasable);
     m_WBReleasing.AddValues(src_stat->m_WBReleasing);
+    m_HotMemSize.AddValues(src_stat->m_HotMemSize);
 }
 
 void
@@ -491,6 +513,12 @@ CNCStat::ConnClosing(Uint8 cnt_cmds)
     stat->m_StatLock.Unlock();
 }
 
+void
+CNCStat::PipelinedCmd(void)
+{
+    AtomicAdd(s_Stat()->m_PipelinedCmds, 1);
+}
+
 void
 CNCStat::ClientDataWrite(size_t data_size)
 {
@@ -578,6 +606,45 @@ CNCStat::DiskDataRead(size_t data_size)
     AtomicAdd(s_Stat()->m_DiskDataRead, data_size);
 }
 
+void
+CNCStat::BlobDataSent(size_t data_size, bool zero_copy)
+{
+    if (zero_copy)
+        AtomicAdd(s_Stat()->m_SentZeroCopy, data_size);
+    else
+        AtomicAdd(s_Stat()->m_SentBuffered, data_size);
+}
+
+void
+CNCStat::HotBlobHit(Uint8 blob_size)
+{
+    CNCStat* stat = s_Stat();
+    AtomicAdd(stat->m_HotHits, 1);
+    AtomicAdd(stat->m_HotHitSize, blob_size);
+}
+
+void
+CNCStat::HotBlobMiss(void)
+{
+    AtomicAdd(s_Stat()->m_HotMisses, 1);
+}
+
+void
+CNCStat::HotBlobAdmitted(Uint8 blob_size)
+{
+    CNCStat* stat = s_Stat();
+    AtomicAdd(stat->m_HotAdmitted, 1);
+    AtomicAdd(stat->m_HotAdmitSize, blob_size);
+}
+
+void
+CNCStat::HotBlobEvicted(Uint8 blob_size)
+{
+    CNCStat* stat = s_Stat();
+    AtomicAdd(stat->m_HotEvicted, 1);
+    AtomicAdd(stat->m_HotEvictSize, blob_size);
+}
+
 void
 CNCStat::DiskBlobWrite(Uint8 blob_size)
 {
@@ -623,6 +690,7 @@ CNCStat::SaveCurStateStat(const SNCStateStat& state)
     stat->m_WBMemSize.AddValue(state.wb_size);
     stat->m_WBReleasable.AddValue(state.wb_releasable);
     stat->m_WBReleasing.AddValue(state.wb_releasing);
+    stat->m_HotMemSize.AddValue(state.hot_size);
     stat->m_StatLock.Unlock();
 
     CSrvRef<CNCStat> stat_5s = GetStat(kStatPeriodName[0], false);
@@ -722,6 +790,7 @@ CNCStat::PrintToLogs(CTempString stat_name)
         .PrintParam("end_run_cmds", m_EndState.progress_cmds)
         .PrintParam("cmds_started", m_StartedCmds)
         .PrintParam("cmds_finished", m_CmdLens.GetCount())
+        .PrintParam("cmds_pipelined", m_PipelinedCmds)
         .PrintParam("avg_conn_cmds", m_ConnCmds.GetAverage())
         .PrintParam("max_conn_cmds", m_ConnCmds.GetMaximum());
     diag.PrintParam("start_db_size", m_StartState.db_size)
@@ -774,6 +843,20 @@ CNCStat::PrintToLogs(CTempString stat_name)
         .PrintParam("end_wb_releasing", m_EndState.wb_releasing)
         .PrintParam("avg_wb_releasing", m_WBReleasing.GetAverage())
         .PrintParam("max_wb_releasing", m_WBReleasing.GetMaximum());
+    diag.PrintParam("start_hot_size", m_StartState.hot_size)
+        .PrintParam("end_hot_size", m_EndState.hot_size)
+        .PrintParam("avg_hot_size", m_HotMemSize.GetAverage())
+        .PrintParam("max_hot_size", m_HotMemSize.GetMaximum())
+        .PrintParam("end_hot_blobs", m_EndState.hot_blobs)
+        .PrintParam("hot_hits", m_HotHits)
+        .PrintParam("hot_misses", m_HotMisses)
+        .PrintParam("hot_hit_pct", g_CalcStatPct(m_HotHits, m_HotHits + m_HotMisses))
+        .PrintParam("hot_read", m_HotHitSize)
+        .PrintParam("avg_hot_read", m_HotHitSize / time_secs)
+        .PrintParam("hot_admitted", m_HotAdmitted)
+        .PrintParam("hot_admit_size", m_HotAdmitSize)
+        .PrintParam("hot_evicted", m_HotEvicted)
+        .PrintParam("hot_evict_size", m_HotEvictSize);
     if (m_StartState.min_dead_time != 0) {
         t.Sec() = m_StartState.min_dead_time;
         t.Print(buf, CSrvTime::eFmtLogging);
@@ -795,7 +878,11 @@ CNCStat::PrintToLogs(CTempString stat_name)
         .PrintParam("disk_write", m_DiskDataWrite)
         .PrintParam("avg_disk_write", m_DiskDataWrite / time_secs)
         .PrintParam("disk_read", m_DiskDataRead)
-        .PrintParam("avg_disk_read", m_DiskDataRead / time_secs);
+        .PrintParam("avg_disk_read", m_DiskDataRead / time_secs)
+        .PrintParam("sent_zero_copy", m_SentZeroCopy)
+        .PrintParam("sent_buffered", m_SentBuffered)
+        .PrintParam("sent_zero_copy_pct",
+                    g_CalcStatPct(m_SentZeroCopy, m_SentZeroCopy + m_SentBuffered));
     diag.PrintParam("cl_wr_blobs", m_ClWrBlobs)
         .PrintParam("cl_wr_avg_blobs", m_ClWrBlobs / time_secs)
         .PrintParam("cl_wr_size", m_ClWrBlobSize)
@@ -854,6 +941,15 @@ void CNCStat::PrintState(CSrvSocketTask& task)
     task.WriteText(eol).WriteText("wb_releasing" ).WriteText(str).WriteText(iss)
                                       .WriteText(NStr::UInt8ToString_DataSize( m_EndState.wb_releasing)).WriteText("\"");
     task.WriteText(eol).WriteText("wb_releasing" ).WriteText(is ).WriteNumber( m_EndState.wb_releasing);
+    task.WriteText(eol).WriteText("hot_size"     ).WriteText(str).WriteText(iss)
+                                      .WriteText(NStr::UInt8ToString_DataSize( m_EndState.hot_size)).WriteText("\"");
+    task.WriteText(eol).WriteText("hot_size"     ).WriteText(is ).WriteNumber( m_EndState.hot_size);
+    task.WriteText(eol).WriteText("hot_blobs"    ).WriteText(is ).WriteNumber( m_EndState.hot_blobs);
+    task.WriteText(eol).WriteText("hot_hits"     ).WriteText(is ).WriteNumber( m_HotHits);
+    task.WriteText(eol).WriteText("hot_misses"   ).WriteText(is ).WriteNumber( m_HotMisses);
+    task.WriteText(eol).WriteText("hot_read"     ).WriteText(is ).WriteNumber( m_HotHitSize);
+    task.WriteText(eol).WriteText("sent_zero_copy").WriteText(is ).WriteNumber( m_SentZeroCopy);
+    task.WriteText(eol).WriteText("sent_buffered").WriteText(is ).WriteNumber( m_SentBuffered);
     
     task.WriteText(eol).WriteText("cnt_another_server_main" ).WriteText(is ).WriteNumber( m_EndState.cnt_another_server_main);
     task.WriteText(eol).WriteText("avg_tdiff_blobcopy" ).WriteText(is ).WriteNumber( m_EndState.avg_tdiff_blobcopy);
@@ -1005,6 +1101,22 @@ CNCStat::PrintToSocket(CSrvSocketTask* sock)
                     << g_ToSizeStr(m_WBMemSize.GetMaximum()) << ", releasable "
                     << g_ToSizeStr(m_WBReleasable.GetMaximum()) << ", releasing "
                     << g_ToSizeStr(m_WBReleasing.GetMaximum()) << endl;
+    proxy << "Hot blobs end - "
+                    << g_ToSizeStr(m_EndState.hot_size) << " in "
+                    << g_ToSmartStr(m_EndState.hot_blobs) << " blobs, avg "
+                    << g_ToSizeStr(m_HotMemSize.GetAverage()) << ", max "
+                    << g_ToSizeStr(m_HotMemSize.GetMaximum()) << endl;
+    proxy << "Hot blob reads - "
+                    << g_ToSmartStr(m_HotHits) << " hits, "
+                    << g_ToSmartStr(m_HotMisses) << " misses ("
+                    << g_CalcStatPct(m_HotHits, m_HotHits + m_HotMisses) << "% hits), "
+                    << g_ToSizeStr(m_HotHitSize) << ", "
+                    << g_ToSizeStr(m_HotHitSize / time_secs) << "/s" << endl;
+    proxy << "Hot blob churn - "
+                    << g_ToSmartStr(m_HotAdmitted) << " admitted ("
+                    << g_ToSizeStr(m_HotAdmitSize) << "), "
+                    << g_ToSmartStr(m_HotEvicted) << " evicted ("
+                    << g_ToSizeStr(m_HotEvictSize) << ")" << endl;
     proxy << "Blob storage start - "
                     << m_StartState.cnt_another_server_main << " requests for alien blobs, "
                     << "blob update delay: "
@@ -1051,6 +1163,7 @@ CNCStat::PrintToSocket(CSrvSocketTask* sock)
     proxy << "Cmds stat - "
                     << g_ToSmartStr(m_StartedCmds) << " (start), "
                     << g_ToSmartStr(m_CmdLens.GetCount()) << " (finish), "
+                    << g_ToSmartStr(m_PipelinedCmds) << " (pipelined), "
                     << g_ToSmartStr(m_ConnCmds.GetAverage()) << " (avg conn), "
                     << g_ToSmartStr(m_ConnCmds.GetMaximum()) << " (max conn)" << endl;
     proxy << "Client writes - "
@@ -1086,6 +1199,11 @@ CNCStat::PrintToSocket(CSrvSocketTask* sock)
     proxy << "Disk reads - "
                     << g_ToSizeStr(m_DiskDataRead) << ", "
                     << g_ToSizeStr(m_DiskDataRead / time_secs) << "/s" << endl;
+    proxy << "Blob data sent - "
+                    << g_ToSizeStr(m_SentZeroCopy) << " zero-copy, "
+                    << g_ToSizeStr(m_SentBuffered) << " buffered ("
+                    << g_CalcStatPct(m_SentZeroCopy, m_SentZeroCopy + m_SentBuffered)
+                    << "% zero-copy)" << endl;
     proxy << "Shrink check - "
                     << g_ToSmartStr(m_CntCleanedFiles) << " files ("
                     << g_ToSmartStr(m_CntFailedFiles) << " failed), "
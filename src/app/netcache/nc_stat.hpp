@@ -62,6 +62,8 @@ struct SNCStateStat
     size_t wb_size;
     size_t wb_releasable;
     size_t wb_releasing;
+    Uint8  hot_size;
+    Uint8  hot_blobs;
     Uint8  cnt_another_server_main;
     Uint8  avg_tdiff_blobcopy; // average time diff between blob creation time and the time it is sent to mirror
     Uint8  max_tdiff_blobcopy; // maximum time diff between blob creation time and the time it is sent to mirror
@@ -89,6 +91,8 @@ public:
     static void CmdStarted(const char* cmd);
     static void CmdFinished(const char* cmd, Uint8 len_usec, int status);
     static void ConnClosing(Uint8 cnt_cmds);
+    /// Pipelined command is started without returning to scheduler
+    static void PipelinedCmd(void);
 
     static void ClientDataWrite(size_t data_size);
     static void ClientDataRead(size_t data_size);
@@ -101,6 +105,13 @@ public:
     static void DiskDataWrite(size_t data_size);
     static void DiskDataRead(size_t data_size);
     static void DiskBlobWrite(Uint8 blob_size);
+    /// Blob data was sent to socket, directly from database file if
+    /// zero_copy is TRUE, or through user space buffers otherwise
+    static void BlobDataSent(size_t data_size, bool zero_copy);
+    static void HotBlobHit(Uint8 blob_size);
+    static void HotBlobMiss(void);
+    static void HotBlobAdmitted(Uint8 blob_size);
+    static void HotBlobEvicted(Uint8 blob_size);
     static void DBFileCleaned(bool success, Uint4 seen_recs,
                               Uint4 moved_recs, Uint4 moved_size);
     static void SaveCurStateStat(const SNCStateStat& state);
@@ -135,12 +146,22 @@ private:
     SNCStateStat m_StartState;
     SNCStateStat m_EndState;
     Uint8 m_StartedCmds;
+    Uint8 m_PipelinedCmds;
     Uint8 m_ClDataWrite;
     Uint8 m_ClDataRead;
     Uint8 m_PeerDataWrite;
     Uint8 m_PeerDataRead;
     Uint8 m_DiskDataWrite;
     Uint8 m_DiskDataRead;
+    Uint8 m_SentZeroCopy;
+    Uint8 m_SentBuffered;
+    Uint8 m_HotHits;
+    Uint8 m_HotHitSize;
+    Uint8 m_HotMisses;
+    Uint8 m_HotAdmitted;
+    Uint8 m_HotAdmitSize;
+    Uint8 m_HotEvicted;
+    Uint8 m_HotEvictSize;
     Uint8 m_MaxBlobSize;
     Uint8 m_ClWrBlobs;
     Uint8 m_ClWrBlobSize;
@@ -176,6 +197,7 @@ private:
     CSrvStatTerm<size_t> m_WBMemSize;
     CSrvStatTerm<size_t> m_WBReleasable;
     CSrvStatTerm<size_t> m_WBReleasing;
+    CSrvStatTerm<Uint8> m_HotMemSize;
     auto_ptr<CSrvStat> m_SrvStat;
 };
 
@@ -100,6 +100,8 @@ static const size_t kMemPageSize  = 4 * 1024;
 /// Mask that can move pointer address or memory size to the memory page
 /// boundary.
 static const size_t kMemPageAlignMask = ~(kMemPageSize - 1);
+/// Number of meta records CBlobCacher caches in one execution slice.
+static const Uint4 kCacheRecsPerSlice = 1000;
 
 
 enum EStopCause {
@@ -228,8 +230,8 @@ static auto_ptr<CFileLock> s_GuardLock;
 
 /// manages access to s_IndexDB
 static CMiniMutex s_IndexLock;
-/// Index database file
-static auto_ptr<CNCDBIndexFile> s_IndexDB;
+/// Index of database files
+static auto_ptr<CNCDBIndexLog> s_IndexDB;
 
 /// Read-write lock to work with s_DBFiles
 static CMiniMutex s_DBFilesLock;
@@ -577,6 +579,12 @@ s_ReadVariableParams(const CNcbiRegistry& reg)
     SetWBHardSizeLimit(NStr::StringToUInt8_DataSize(reg.GetString(
                        kNCStorage_RegSection, "write_back_hard_size_limit", "4 GB")));
 
+    CNCHotBlobCache::SetLimits(
+        NStr::StringToUInt8_DataSize(reg.GetString(
+            kNCStorage_RegSection, "hot_cache_size", "0")),
+        NStr::StringToUInt8_DataSize(reg.GetString(
+            kNCStorage_RegSection, "hot_cache_max_blob_size", "1 MB")));
+
     int to2 = reg.GetInt(kNCStorage_RegSection, "write_back_timeout", 1000);
     int to1 = reg.GetInt(kNCStorage_RegSection, "write_back_timeout_startup", to2);
     SetWBWriteTimeout( CNCServer::IsInitiallySynced() ? to2 : to1, to2);
@@ -621,7 +629,7 @@ s_ReadStorageParams(void)
     }
 }
 
-/// Make name of the index file in the storage
+/// Make name of the SQLite index file used by older versions of NetCache
 static string
 s_GetIndexFileName(void)
 {
@@ -631,6 +639,16 @@ s_GetIndexFileName(void)
     return CDirEntry::CreateAbsolutePath(file_name);
 }
 
+/// Make base name of the index log and snapshot files in the storage
+static string
+s_GetIndexLogName(void)
+{
+    string file_name(s_Prefix);
+    file_name += kNCStorage_IndexFileSuffix;
+    file_name = CDirEntry::MakePath(s_Path, file_name);
+    return CDirEntry::CreateAbsolutePath(file_name);
+}
+
 /// Make name of file with meta-information in given database part
 static string
 s_GetFileName(Uint4 file_id, ENCDBFileType file_type)
@@ -723,16 +741,34 @@ s_UnlockInstanceGuard(void)
     }
 }
 
+/// Move contents of the SQLite index file left by older version of
+/// NetCache into just created index log, and rename that file so that it's
+/// not used again.
+static void
+s_MigrateSQLiteIndex(void)
+{
+    string old_name = s_GetIndexFileName();
+    if (!CFile(old_name).Exists())
+        return;
+
+    INFO("Migrating storage index " << old_name << " to "
+         << s_IndexDB->GetLogName());
+    s_IndexDB->ImportSQLiteIndex(old_name);
+    s_IndexDB->GetAllDBFiles(s_DBFiles);
+}
+
 /// Open and read index database file
 static bool
 s_OpenIndexDB(void)
 {
-    string index_name = s_GetIndexFileName();
+    string index_name = s_GetIndexLogName();
     for (int i = 0; i < 2; ++i) {
         try {
-            s_IndexDB.reset(new CNCDBIndexFile(index_name));
-            s_IndexDB->CreateDatabase();
-            s_IndexDB->GetAllDBFiles(s_DBFiles);
+            s_IndexDB.reset(new CNCDBIndexLog(index_name));
+            if (s_IndexDB->Open())
+                s_IndexDB->GetAllDBFiles(s_DBFiles);
+            else
+                s_MigrateSQLiteIndex();
             ERASE_ITERATE(TNCDBFilesMap, it, (*s_DBFiles)) {
                 CSrvRef<SNCDBFileInfo> info = it->second;
                 Int8 file_size = -1;
@@ -744,7 +780,7 @@ delete_file:
                     try {
                         s_IndexDB->DeleteDBFile(info->file_id);
                     }
-                    catch (CSQLITE_Exception& ex) {
+                    catch (CFileException& ex) {
                         SRV_LOG(Critical, "Error cleaning index file: " << ex);
                     }
                     s_DBFiles->erase(it);
@@ -783,10 +819,10 @@ delete_file:
             }
             return true;
         }
-        catch (CSQLITE_Exception& ex) {
+        catch (CFileException& ex) {
             s_IndexDB.reset();
             SRV_LOG(Error, "Index file is broken, reinitializing storage. " << ex);
-            CFile(index_name).Remove();
+            CNCDBIndexLog::Remove(index_name);
         }
     }
     SRV_LOG(Critical, "Cannot open or create index file for the storage.");
@@ -815,10 +851,10 @@ s_ReinitializeStorage(void)
         s_CleanDatabase();
         return true;
     }
-    catch (CSQLITE_Exception& ex) {
+    catch (CFileException& ex) {
         SRV_LOG(Error, "Error in soft reinitialization, trying harder. " << ex);
         s_IndexDB.reset();
-        CFile(s_GetIndexFileName()).Remove();
+        CNCDBIndexLog::Remove(s_GetIndexLogName());
         return s_OpenIndexDB();
     }
 }
@@ -1171,7 +1207,7 @@ s_CreateNewFile(size_t type_idx, bool need_lock)
     try {
         s_IndexDB->NewDBFile(file_id, file_name);
     }
-    catch (CSQLITE_Exception& ex) {
+    catch (CFileException& ex) {
         s_IndexLock.Unlock();
         SRV_LOG(Critical, "Error while adding new storage file: " << ex);
         delete file_info;
@@ -1216,7 +1252,7 @@ s_DeleteDBFile(const CSrvRef<SNCDBFileInfo>& file_info, bool need_lock)
     try {
         s_IndexDB->DeleteDBFile(file_info->file_id);
     }
-    catch (CSQLITE_Exception& ex) {
+    catch (CFileException& ex) {
         SRV_LOG(Critical, "Index database does not delete rows: " << ex);
     }
     s_IndexLock.Unlock();
@@ -1376,6 +1412,12 @@ void CNCBlobStorage::WriteSetup(CSrvSocketTask& task)
     task.WriteText(eol).WriteText("write_back_hard_size_limit").WriteText(str).WriteText(iss)
                                                    .WriteText(NStr::UInt8ToString_DataSize( GetWBHardSizeLimit())).WriteText(eos);
     task.WriteText(eol).WriteText("write_back_hard_size_limit").WriteText(is ).WriteNumber( GetWBHardSizeLimit());
+    task.WriteText(eol).WriteText("hot_cache_size"            ).WriteText(str).WriteText(iss)
+                                                   .WriteText(NStr::UInt8ToString_DataSize( CNCHotBlobCache::GetMemLimit())).WriteText(eos);
+    task.WriteText(eol).WriteText("hot_cache_size"            ).WriteText(is ).WriteNumber( CNCHotBlobCache::GetMemLimit());
+    task.WriteText(eol).WriteText("hot_cache_max_blob_size"   ).WriteText(str).WriteText(iss)
+                                                   .WriteText(NStr::UInt8ToString_DataSize( CNCHotBlobCache::GetMaxBlobSize())).WriteText(eos);
+    task.WriteText(eol).WriteText("hot_cache_max_blob_size"   ).WriteText(is ).WriteNumber( CNCHotBlobCache::GetMaxBlobSize());
     task.WriteText(eol).WriteText("write_back_timeout"        ).WriteText(is ).WriteNumber( GetWBWriteTimeout());
     task.WriteText(eol).WriteText("write_back_failed_delay"   ).WriteText(is ).WriteNumber( GetWBFailedWriteDelay());
     task.WriteText(eol).WriteText(kNCStorage_FailedWriteSize  ).WriteText(is ).WriteNumber( CNCBlobAccessor::GetFailedWriteCount());
@@ -1386,7 +1428,7 @@ void CNCBlobStorage::WriteEnvInfo(CSrvSocketTask& task)
     string is("\": "),iss("\": \""), eol(",\n\""), str("_str"), eos("\"");
     task.WriteText(eol).WriteText("storagepath"  ).WriteText(iss).WriteText(   s_Path).WriteText(eos);
     task.WriteText(eol).WriteText(kNCStorage_GuardNameParam   ).WriteText(iss).WriteText(   s_GuardName).WriteText(eos);
-    task.WriteText(eol).WriteText("DBindex"  ).WriteText(iss).WriteText(   s_GetIndexFileName()).WriteText(eos);
+    task.WriteText(eol).WriteText("DBindex"  ).WriteText(iss).WriteText(   s_IndexDB->GetLogName()).WriteText(eos);
     task.WriteText(eol).WriteText("DBfiles_count").WriteText( is).WriteNumber( CNCBlobStorage::GetNDBFiles());
     task.WriteText(eol).WriteText("DBsize"       ).WriteText(iss).WriteText(NStr::UInt8ToString_DataSize(s_CurDBSize)).WriteText(eos);
     task.WriteText(eol).WriteText("DBgarbage"    ).WriteText(iss).WriteText(NStr::UInt8ToString_DataSize(s_GarbageSize)).WriteText(eos);
@@ -2439,7 +2481,8 @@ CNCBlobStorage::ReadChunkData(SNCBlobVerData* ver_data,
                               SNCChunkMaps* maps,
                               Uint8 chunk_num,
                               char*& buffer,
-                              Uint4& buf_size)
+                              Uint4& buf_size,
+                              CSrvRef<SNCDBFileInfo>* data_file_out)
 {
     Uint2 map_idx[kNCMaxBlobMapsDepth] = {0};
     Uint1 cur_index = 0;
@@ -2556,6 +2599,8 @@ CNCAlerts::Register(CNCAlerts::eDebugReadChunkData4, "ReadChunkData: data_inf");
 
     buf_size = s_CalcChunkDataSize(data_ind->rec_size);
     buffer = (char*)data_rec->chunk_data;
+    if (data_file_out)
+        *data_file_out = data_file;
 
     return true;
 }
@@ -2655,7 +2700,7 @@ CNCBlobStorage::GetMaxSyncLogRecNo(void)
     try {
         result = s_IndexDB->GetMaxSyncLogRecNo();
     }
-    catch (CSQLITE_Exception& ex) {
+    catch (CFileException& ex) {
         SRV_LOG(Critical, "Cannot read max_sync_log_rec_no: " << ex);
     }
     s_IndexLock.Unlock();
@@ -2676,7 +2721,7 @@ CNCBlobStorage::GetPurgeData(void)
     try {
         result = s_IndexDB->GetPurgeData();
     }
-    catch (CSQLITE_Exception&) {
+    catch (CFileException&) {
     }
     s_IndexLock.Unlock();
     return result;
@@ -2936,9 +2981,8 @@ CBlobCacher::x_CacheMapRecs(SNCDataCoord map_coord,
     }
 
     SNCDBFileInfo* file_info = it_file->second.GetNCPointerOrNull();
-    TRecNumsSet& recs_set = m_RecsMap[map_coord.file_id];
-    TRecNumsSet::iterator it_recs = recs_set.find(map_coord.rec_num);
-    if (it_recs == recs_set.end()) {
+    CNCRecNumsSet& recs_set = m_RecsMap[map_coord.file_id];
+    if (!recs_set.Contains(map_coord.rec_num)) {
         SRV_LOG(Critical, "Blob " << cache_data->key
                           << " references record with coord " << map_coord
                           << ", but its index wasn't in live chain. Deleting blob.");
@@ -3043,7 +3087,7 @@ CBlobCacher::x_CacheMapRecs(SNCDataCoord map_coord,
         }
     }
 
-    recs_set.erase(it_recs);
+    recs_set.Erase(map_coord.rec_num);
     return true;
 }
 
@@ -3321,7 +3365,7 @@ CBlobCacher::x_PreCacheRecNums(void)
         return &CBlobCacher::x_StartCreateFiles;
 
     SNCDBFileInfo* const file_info = m_CurFile->second.GetNCPointerOrNull();
-    TRecNumsSet& recs_set = m_RecsMap[file_info->file_id];
+    CNCRecNumsSet& recs_set = m_RecsMap[file_info->file_id];
 
     AtomicAdd(s_CurDBSize,  file_info->file_size);
     // Non-garbage is left the same as in x_CreateNewFile
@@ -3444,7 +3488,7 @@ bad_rec_type:
             goto ignore_rec_and_continue;
         }
 
-        recs_set.insert(rec_num);
+        recs_set.Insert(rec_num);
         min_ptr = next_rec_end;
         ind_rec = next_ind;
         prev_rec_num = rec_num;
@@ -3532,7 +3576,7 @@ try_next_file:
         goto try_next_file;
     }
     m_CurRecsSet = &m_RecsMap[file_info->file_id];
-    m_CurRecIt = m_CurRecsSet->begin();
+    m_CurRecNum = m_CurRecsSet->FindNext(1);
     return &CBlobCacher::x_CacheNextRecord;
 }
 
@@ -3541,22 +3585,25 @@ CBlobCacher::x_CacheNextRecord(void)
 {
     if (CTaskServer::IsInShutdown())
         return &CBlobCacher::x_CancelCaching;
-    if (m_CurRecIt == m_CurRecsSet->end()) {
-        m_CurRecsSet->clear();
+    if (m_CurRecNum == 0) {
+        m_CurRecsSet->Clear();
         ++m_CurFile;
         return &CBlobCacher::x_CacheNextFile;
     }
 
-    Uint4 rec_num = *m_CurRecIt;
     SNCDBFileInfo* file_info = m_CurFile->second.GetNCPointerOrNull();
-    SNCDataCoord coord;
-    coord.file_id = file_info->file_id;
-    coord.rec_num = rec_num;
-    SFileIndexRec* ind_rec = s_GetIndexRec(file_info, rec_num);
-    if (!x_CacheMetaRec(file_info, ind_rec, coord))
-        s_DeleteIndexRec(file_info, ind_rec);
+    for (Uint4 cnt = 0;
+         m_CurRecNum != 0  &&  cnt < kCacheRecsPerSlice;  ++cnt)
+    {
+        SNCDataCoord coord;
+        coord.file_id = file_info->file_id;
+        coord.rec_num = m_CurRecNum;
+        SFileIndexRec* ind_rec = s_GetIndexRec(file_info, m_CurRecNum);
+        if (!x_CacheMetaRec(file_info, ind_rec, coord))
+            s_DeleteIndexRec(file_info, ind_rec);
+        m_CurRecNum = m_CurRecsSet->FindNext(m_CurRecNum + 1);
+    }
 
-    ++m_CurRecIt;
     SetRunnable();
     return NULL;
 }
@@ -3564,18 +3611,18 @@ CBlobCacher::x_CacheNextRecord(void)
 CBlobCacher::State
 CBlobCacher::x_CleanOrphanRecs(void)
 {
-    ITERATE(TFileRecsMap, it_id, m_RecsMap) {
+    ITERATE(TFileRecNumsMap, it_id, m_RecsMap) {
         Uint4 file_id = it_id->first;
-        const TRecNumsSet& recs_set = it_id->second;
+        const CNCRecNumsSet& recs_set = it_id->second;
         TNCDBFilesMap::iterator it_file = s_DBFiles->find(file_id);
         if (it_file == s_DBFiles->end()) {
             // File could be deleted when we tried to create initial files.
             continue;
         }
         SNCDBFileInfo* file_info = it_file->second;
-        TRecNumsSet::iterator it_rec = recs_set.begin();
-        for (; it_rec != recs_set.end(); ++it_rec) {
-            SFileIndexRec* ind_rec = s_GetIndexRec(file_info, *it_rec);
+        Uint4 rec_num = recs_set.FindNext(1);
+        for (; rec_num != 0; rec_num = recs_set.FindNext(rec_num + 1)) {
+            SFileIndexRec* ind_rec = s_GetIndexRec(file_info, rec_num);
             s_DeleteIndexRec(file_info, ind_rec);
         }
     }
@@ -4562,7 +4609,7 @@ CRecNoSaver::ExecuteSlice(TSrvThreadNum /* thr_num */)
             INFO("Updated Purge data: " << forget);
             s_IndexDB->UpdatePurgeData(forget);
         }
-        catch (CSQLITE_Exception&) {
+        catch (CFileException&) {
         }
         s_IndexLock.Unlock();
     }
@@ -4587,7 +4634,7 @@ CRecNoSaver::ExecuteSlice(TSrvThreadNum /* thr_num */)
     try {
         s_IndexDB->SetMaxSyncLogRecNo(log_rec_no);
     }
-    catch (CSQLITE_Exception& ex) {
+    catch (CFileException& ex) {
         SRV_LOG(Critical, "Cannot save sync log record number: " << ex);
     }
     s_IndexLock.Unlock();
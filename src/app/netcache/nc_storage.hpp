@@ -162,11 +162,15 @@ public:
     static void DeleteBlobInfo(const SNCBlobVerData* ver_data,
                                SNCChunkMaps* maps);
 
+    /// Find data of the chunk in the database.  buffer is set to point into
+    /// the mapped database file which, if requested, is returned in
+    /// data_file.
     static bool ReadChunkData(SNCBlobVerData* ver_data,
                               SNCChunkMaps* maps,
                               Uint8 chunk_num,
                               char*& buffer,
-                              Uint4& buf_size);
+                              Uint4& buf_size,
+                              CSrvRef<SNCDBFileInfo>* data_file = NULL);
     static char* WriteChunkData(SNCBlobVerData* ver_data,
                                 SNCChunkMaps* maps,
                                 SNCCacheData* cache_data,
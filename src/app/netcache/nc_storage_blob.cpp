@@ -602,6 +602,7 @@ CWriteBackControl::ResetStatCounters(void)
 void
 CNCBlobVerManager::x_DeleteCurVersion(void)
 {
+    CNCHotBlobCache::Invalidate(m_Key);
     m_CacheData->coord.clear();
     m_CacheData->dead_time = 0;
     CNCBlobStorage::ChangeCacheDeadTime(m_CacheData);
@@ -923,6 +924,8 @@ CNCBlobVerManager::FinalizeWriting(SNCBlobVerData* ver_data)
     if (ver_data->dead_time > CSrvTime::CurSecs()
         &&  s_IsCurVerOlder(m_CurVersion, ver_data))
     {
+        // Data of the previous version must not be served anymore
+        CNCHotBlobCache::Invalidate(m_Key);
         old_ver.Swap(m_CurVersion);
         m_CacheData->coord = m_CurVersion->coord;
         m_CacheData->dead_time = m_CurVersion->dead_time;
@@ -1471,7 +1474,9 @@ CNCBlobAccessor::CNCBlobAccessor(void)
     : m_ChunkMaps(NULL),
       m_MetaInfoReady(false),
       m_WriteMemRequested(false),
-      m_Buffer(NULL)
+      m_Buffer(NULL),
+      m_HotChecked(false),
+      m_DataFileChunk(Uint8(-1))
 {
 #if __NC_TASKS_MONITOR
     m_TaskName = "CNCBlobAccessor";
@@ -1505,6 +1510,8 @@ CNCBlobAccessor::Prepare(const string& key,
     m_CurChunk      = 0;
     m_ChunkPos      = 0;
     m_SizeRead      = 0;
+    m_HotChecked    = false;
+    m_DataFileChunk = Uint8(-1);
 }
 
 void
@@ -1542,6 +1549,8 @@ CNCBlobAccessor::Deinitialize(void)
 
     m_NewData.Reset();
     m_CurData.Reset();
+    m_HotBlob.Reset();
+    m_DataFile.Reset();
     if (m_VerManager) {
         m_VerManager->Release();
         m_VerManager = NULL;
@@ -1611,6 +1620,19 @@ CNCBlobAccessor::GetReadMemSize(void)
     if (GetPosition() >= m_CurData->size) {
         SRV_FATAL("blob accessor broken");
     }
+    if (!m_HotChecked)
+        x_FindHotBlob();
+    if (m_HotBlob) {
+        if (m_Buffer  &&  m_ChunkPos >= m_ChunkSize) {
+            ++m_CurChunk;
+            m_ChunkPos = 0;
+        }
+        Uint8 chunk_start = m_CurChunk * m_CurData->chunk_size;
+        m_ChunkSize = Uint4(min(m_CurData->size - chunk_start,
+                                Uint8(m_CurData->chunk_size)));
+        m_Buffer = m_HotBlob->data + chunk_start;
+        return m_ChunkSize - m_ChunkPos;
+    }
     if (m_Buffer) {
         if (m_ChunkPos < m_ChunkSize) {
             m_Buffer = m_CurData->chunks[m_CurChunk];
@@ -1649,6 +1671,97 @@ CNCBlobAccessor::GetReadMemSize(void)
     return m_ChunkSize - m_ChunkPos;
 }
 
+void
+CNCBlobAccessor::x_FindHotBlob(void)
+{
+    m_HotChecked = true;
+    bool need_admit = false;
+    m_HotBlob = CNCHotBlobCache::Find(m_BlobKey, m_CurData, need_admit);
+    if (m_HotBlob  ||  !need_admit)
+        return;
+
+// read the whole blob and give it to the hot cache;
+// any problem with the data is left for the regular read path to report
+    Uint8 size = m_CurData->size;
+    Uint4 chunk_size = m_CurData->chunk_size;
+    char* data = (char*)malloc(size);
+    if (!data)
+        return;
+    if (!m_ChunkMaps) {
+        m_ChunkMaps = new SNCChunkMaps(m_CurData->map_size);
+        s_AddCurrentMem(s_CalcChunkMapsSize(m_CurData->map_size));
+    }
+    Uint8 disk_read = 0;
+    Uint8 chunk_num = 0;
+    for (Uint8 pos = 0; pos < size; pos += chunk_size, ++chunk_num) {
+        Uint4 need_size = Uint4(min(size - pos, Uint8(chunk_size)));
+        char* buffer = ACCESS_ONCE(m_CurData->chunks[chunk_num]);
+        Uint4 buf_size = need_size;
+        if (!buffer) {
+            if (!CNCBlobStorage::ReadChunkData(m_CurData, m_ChunkMaps,
+                                               chunk_num, buffer, buf_size)
+                ||  buf_size != need_size)
+            {
+                free(data);
+                return;
+            }
+            disk_read += buf_size;
+        }
+        memcpy(data + pos, buffer, need_size);
+    }
+    if (disk_read != 0)
+        CNCStat::DiskDataRead(disk_read);
+    m_HotBlob = CNCHotBlobCache::Put(m_BlobKey, m_CurData, data);
+}
+
+bool
+CNCBlobAccessor::GetReadFileRange(int& fd, Uint8& offset)
+{
+#ifdef NCBI_OS_LINUX
+    if (m_HotBlob  ||  !m_Buffer  ||  m_CurData->has_error)
+        return false;
+// chunk is in the database only when writing of it is finished,
+// otherwise m_Buffer is write-back memory
+    if (m_CurData->cur_chunk_num <= m_CurChunk
+        ||  m_Buffer != ACCESS_ONCE(m_CurData->chunks[m_CurChunk]))
+    {
+        return false;
+    }
+    if (m_DataFileChunk != m_CurChunk) {
+        m_DataFile.Reset();
+        m_DataFileChunk = m_CurChunk;
+        if (!m_ChunkMaps) {
+            m_ChunkMaps = new SNCChunkMaps(m_CurData->map_size);
+            s_AddCurrentMem(s_CalcChunkMapsSize(m_CurData->map_size));
+        }
+        char* buffer = NULL;
+        Uint4 buf_size = 0;
+        CSrvRef<SNCDBFileInfo> data_file;
+        if (!CNCBlobStorage::ReadChunkData(m_CurData, m_ChunkMaps, m_CurChunk,
+                                           buffer, buf_size, &data_file))
+        {
+            return false;
+        }
+// chunk could have been moved to another file since m_Buffer was found,
+// then the old copy is sent the usual way
+        if (buffer == m_Buffer)
+            m_DataFile = data_file;
+    }
+    if (!m_DataFile)
+        return false;
+    if (m_Buffer < m_DataFile->file_map
+        ||  m_Buffer + m_ChunkSize > m_DataFile->file_map + m_DataFile->file_size)
+    {
+        return false;
+    }
+    fd = m_DataFile->fd;
+    offset = Uint8(m_Buffer - m_DataFile->file_map) + m_ChunkPos;
+    return true;
+#else
+    return false;
+#endif
+}
+
 void
 CNCBlobAccessor::MoveReadPos(Uint4 move_size)
 {
@@ -30,6 +30,7 @@
 
 
 #include "nc_db_info.hpp"
+#include "nc_hot_cache.hpp"
 
 
 BEGIN_NCBI_SCOPE
@@ -134,6 +135,11 @@ public:
     Uint8 GetPosition(void);
     Uint4 GetReadMemSize(void);
     const void* GetReadMemPtr(void);
+    /// Find the database file and offset in it of the data returned by
+    /// GetReadMemPtr(), so that it can be sent to socket directly from
+    /// the file.  Returns FALSE if the data is not (or may not be) in
+    /// a database file, e.g. it is still in write-back memory.
+    bool GetReadFileRange(int& fd, Uint8& offset);
     void MoveReadPos(Uint4 move_size);
     unsigned int GetCurBlobTTL(void) const;
     unsigned int GetNewBlobTTL(void) const;
@@ -227,6 +233,7 @@ private:
 
     void x_CreateNewData(void);
     void x_DelCorruptedVersion(void);
+    void x_FindHotBlob(void);
 
 
     /// Type of access requested for the blob
@@ -249,6 +256,12 @@ private:
     Uint8       m_SizeRead;
     char*       m_Buffer;
     CSrvTask*   m_Owner;
+    /// Copy of the blob in the hot blob cache, if any
+    CSrvRef<SNCHotBlob> m_HotBlob;
+    bool        m_HotChecked;
+    /// Database file holding chunk number m_DataFileChunk
+    CSrvRef<SNCDBFileInfo> m_DataFile;
+    Uint8       m_DataFileChunk;
 };
 
 
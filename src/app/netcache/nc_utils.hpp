@@ -171,6 +171,89 @@ EHTTPStatus GetStatusByMessage(const string& msg, EHTTPStatus def);
 const string& GetMessageByStatus(EHTTPStatus sts);
 
 
+/////////////////////////////////////////////////////////////////////////////
+// record numbers
+
+/// Set of record numbers in one database file kept as a bit per number.
+/// Record numbers in a file go from 1 up to the number of index records
+/// without big holes, so this takes a bit per record where set<Uint4>
+/// takes a heap node per record.  CBlobCacher collects all records of the
+/// storage on start, with tens of millions of blobs that's what decides
+/// how fast the start is.
+class CNCRecNumsSet
+{
+public:
+    CNCRecNumsSet(void)
+        : m_Count(0)
+    {}
+
+    void Insert(Uint4 rec_num)
+    {
+        size_t word = rec_num / 64;
+        if (word >= m_Bits.size())
+            m_Bits.resize(max(word + 1, m_Bits.size() * 2), 0);
+        Uint8 bit = Uint8(1) << (rec_num % 64);
+        if ((m_Bits[word] & bit) == 0) {
+            m_Bits[word] |= bit;
+            ++m_Count;
+        }
+    }
+    /// Remove the number from the set.
+    ///
+    /// @return
+    ///   TRUE if the number was in the set
+    bool Erase(Uint4 rec_num)
+    {
+        size_t word = rec_num / 64;
+        Uint8 bit = Uint8(1) << (rec_num % 64);
+        if (word >= m_Bits.size()  ||  (m_Bits[word] & bit) == 0)
+            return false;
+        m_Bits[word] &= ~bit;
+        --m_Count;
+        return true;
+    }
+    bool Contains(Uint4 rec_num) const
+    {
+        size_t word = rec_num / 64;
+        return word < m_Bits.size()
+               &&  (m_Bits[word] & (Uint8(1) << (rec_num % 64))) != 0;
+    }
+    /// Smallest number in the set that is not less than rec_num, or 0 if
+    /// there's no such number (record number 0 is never used).
+    Uint4 FindNext(Uint4 rec_num) const
+    {
+        size_t word = rec_num / 64;
+        if (word >= m_Bits.size())
+            return 0;
+        Uint8 bits = m_Bits[word] & (~Uint8(0) << (rec_num % 64));
+        while (bits == 0) {
+            if (++word == m_Bits.size())
+                return 0;
+            bits = m_Bits[word];
+        }
+        Uint4 result = Uint4(word * 64);
+        while ((bits & 1) == 0) {
+            bits >>= 1;
+            ++result;
+        }
+        return result;
+    }
+    size_t Size(void) const
+    {
+        return m_Count;
+    }
+    void Clear(void)
+    {
+        vector<Uint8>().swap(m_Bits);
+        m_Count = 0;
+    }
+
+private:
+    vector<Uint8> m_Bits;
+    size_t        m_Count;
+};
+
+
 /////////////////////////////////////////////////////////////////////////////
 // alerts
 
@@ -118,6 +118,7 @@ static CSrvRef<SSpecParamsSet> s_SpecParams;
 //static unsigned int s_DefConnTimeout;
 static int s_DefBlobTTL;
 static bool s_DebugMode = false;
+static bool s_ZeroCopySend = false;
 static bool s_InitiallySynced = false;
 static bool s_CachingComplete = false;
 static CNCMsgHandler_Factory s_MsgHandlerFactory;
@@ -591,6 +592,7 @@ s_ReadServerParams(void)
         s_AdminClient = reg.GetString(kNCReg_ServerSection, kNCReg_AdminClient,
                                       kNCReg_DefAdminClient);
         s_DebugMode = reg.GetBool(kNCReg_ServerSection, "debug_mode", false);
+        s_ZeroCopySend = reg.GetBool(kNCReg_ServerSection, "zero_copy_send", false);
 
         s_ReadPerClientConfig(reg);
     }
@@ -954,6 +956,12 @@ CNCServer::IsDebugMode(void)
 {
     return s_DebugMode;
 }
+
+bool
+CNCServer::IsZeroCopySend(void)
+{
+    return s_ZeroCopySend;
+}
 /*
 unsigned int
 CNCServer::GetDefConnTimeout(void)
@@ -1012,6 +1020,7 @@ CNCServer::ReadCurState(SNCStateStat& state)
     CNCPeerControl::ReadCurState(state);
     state.sync_log_size = CNCSyncLog::GetLogSize();
     CWriteBackControl::ReadState(state);
+    CNCHotBlobCache::ReadState(state);
 }
 
 bool s_ReportPid(const string& pid_file)
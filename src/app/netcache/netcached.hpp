@@ -235,6 +235,9 @@ public:
     static void InitialSyncRequired(void);
     static bool IsCachingComplete(void);
     static bool IsDebugMode(void);
+    /// Whether blob data stored in database files should be sent to clients
+    /// directly from the files (without copying it through user space)
+    static bool IsZeroCopySend(void);
 
     static void ReadCurState(SNCStateStat& state);
 
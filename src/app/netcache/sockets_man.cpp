@@ -45,6 +45,7 @@
 # include <arpa/inet.h>
 # include <netdb.h>
 # include <sys/epoll.h>
+# include <sys/sendfile.h>
 # include <unistd.h>
 # include <fcntl.h>
 # include <errno.h>
@@ -1319,6 +1320,55 @@ CSrvSocketTask::Write(const void* buf, size_t size)
     }
 }
 
+size_t
+CSrvSocketTask::SendFile(int file_fd, Uint8 offset, size_t size,
+                         bool& not_supported)
+{
+    not_supported = false;
+    if (IsWriteDataPending()) {
+        // Data already in write buffer must go to the socket first.
+        s_FlushData(this);
+        if (IsWriteDataPending())
+            return 0;
+    }
+    s_CompactWrBuffer(this);
+
+    if (!m_SockCanWrite  &&  m_SeenWriteEvts == m_RegWriteEvts)
+        return 0;
+    if (size == 0)
+        return 0;
+
+    m_SeenWriteEvts = m_RegWriteEvts;
+    ssize_t n_written = 0;
+#ifdef NCBI_OS_LINUX
+    off_t off = off_t(offset);
+retry:
+    n_written = sendfile(m_Fd, file_fd, &off, size);
+    if (n_written == -1) {
+        int x_errno = errno;
+        if (x_errno == EINTR)
+            goto retry;
+        if (x_errno == EAGAIN  ||  x_errno == EWOULDBLOCK)
+            return 0;
+        if (x_errno == EINVAL  ||  x_errno == ENOSYS) {
+            // File or socket doesn't support sendfile(), caller should fall
+            // back to Write().
+            not_supported = true;
+            return 0;
+        }
+        LOG_WITH_ERRNO(Warning, "Error writing to socket", x_errno);
+        m_RegError = true;
+        n_written = 0;
+    }
+#else
+    not_supported = true;
+#endif
+    m_WrittenBytes += n_written;
+    m_SockCanWrite = size_t(n_written) == size;
+
+    return size_t(n_written);
+}
+
 void
 CSrvSocketTask::WriteData(const void* buf, size_t size)
 {
@@ -184,6 +184,15 @@ public:
     /// amount of data written which can be 0 if socket is not writable at the
     /// moment.
     size_t Write(const void* buf, size_t size);
+    /// Write into the socket as much as immediately possible of size bytes
+    /// of the file file_fd starting at offset, without copying them through
+    /// user space (sendfile() on Linux).  Data in internal write buffers is
+    /// flushed first and nothing is sent if that is not possible.  Method
+    /// returns amount of file data written.  If sending from this file is
+    /// not supported then not_supported is set to TRUE and data should be
+    /// written with Write() instead.
+    size_t SendFile(int file_fd, Uint8 offset, size_t size,
+                    bool& not_supported);
     /// Flush all data saved in internal write buffers to socket.
     /// Method must be called from inside of ExecuteSlice() of this task and
     /// no other writing methods should be called until FlushIsDone() returns
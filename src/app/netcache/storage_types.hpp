@@ -149,6 +149,7 @@ struct SNCTempBlobInfo
 
 typedef set<Uint4>              TRecNumsSet;
 typedef map<Uint4, TRecNumsSet> TFileRecsMap;
+typedef map<Uint4, CNCRecNumsSet> TFileRecNumsMap;
 
 
 /*
@@ -178,6 +179,7 @@ typedef map<Uint4, TRecNumsSet> TFileRecsMap;
         after that, goto x_CleanOrphanRecs
     -> x_CacheNextRecord
         for each record, check record validity, remember
+        (a batch of records in one slice)
         goto x_CacheNextFile
     -> x_CleanOrphanRecs
         when all files are processed, delete abandoned records
@@ -219,11 +221,11 @@ private:
     void x_DeleteIndexes(SNCDataCoord map_coord, Uint1 map_depth);
 
 
-    TFileRecsMap m_RecsMap;
+    TFileRecNumsMap m_RecsMap;
     TRecNumsSet m_NewFileIds;
     TNCDBFilesMap::const_iterator m_CurFile;
-    TRecNumsSet* m_CurRecsSet;
-    TRecNumsSet::iterator m_CurRecIt;
+    CNCRecNumsSet* m_CurRecsSet;
+    Uint4 m_CurRecNum;
     size_t m_CurCreatePass;
     size_t m_CurCreateFile;
 };
@@ -0,0 +1,672 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Tests of the storage index log (CNCDBIndexLog): replay of the log,
+ *   cutting off of a torn tail, snapshot generations and migration from
+ *   the old SQLite index.  With "-bench [blobs [set_blobs [files]]]" it
+ *   times the two parts of netcached start that depend on the storage
+ *   size:  loading of the index of a storage of the given number of files
+ *   (10000 by default, 1 TB in files of 100 MB) with the longest log it
+ *   can have, against the SQLite index used before;  and the bookkeeping
+ *   of record numbers that CBlobCacher does for the given number of blobs
+ *   (50M by default), against the set of numbers used before (5M blobs by
+ *   default, it takes ~100 bytes per blob).
+ *
+ *   Like netcached, it is linked with task_server and not with corelib.
+ *
+ */
+
+#include "nc_pch.hpp"
+
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
+
+#include "nc_db_files.hpp"
+#include "nc_utils.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+// Storage itself is not linked in, index needs only these two
+SNCDBFileInfo::SNCDBFileInfo(void)
+    : file_map(NULL),
+      file_id(0),
+      file_size(0),
+      garb_size(0),
+      used_size(0),
+      index_head(NULL),
+      is_releasing(false),
+      fd(0),
+      create_time(0),
+      next_shrink_time(0)
+{
+    cnt_unfinished.Set(0);
+}
+
+SNCDBFileInfo::~SNCDBFileInfo(void)
+{}
+
+
+static int s_CntFailed = 0;
+
+#define NC_CHECK(expr)                                                   \
+    do {                                                                 \
+        if ( !(expr) ) {                                                 \
+            NcbiCerr << __FILE__ << "(" << __LINE__ << "): check failed: " \
+                     << #expr << NcbiEndl;                               \
+            ++s_CntFailed;                                               \
+        }                                                                \
+    } while (0)
+
+
+/// Contents of the index as seen through its interface
+struct SIndexState
+{
+    map<Uint4, string> files;
+    Uint8              log_rec_no;
+    string             purge_data;
+
+    SIndexState(void) : log_rec_no(0) {}
+
+    bool operator== (const SIndexState& other) const
+    {
+        return files == other.files  &&  log_rec_no == other.log_rec_no
+               &&  purge_data == other.purge_data;
+    }
+};
+
+static SIndexState
+s_GetState(CNCDBIndexLog& index)
+{
+    SIndexState state;
+    TNCDBFilesMap files_map;
+    index.GetAllDBFiles(&files_map);
+    ITERATE(TNCDBFilesMap, it, files_map) {
+        state.files[it->first] = it->second->file_name;
+    }
+    state.log_rec_no = index.GetMaxSyncLogRecNo();
+    state.purge_data = index.GetPurgeData();
+    return state;
+}
+
+static SIndexState
+s_ReopenState(const string& base_name, bool* existed = NULL)
+{
+    CNCDBIndexLog index(base_name);
+    bool res = index.Open();
+    if (existed)
+        *existed = res;
+    return s_GetState(index);
+}
+
+static string
+s_FileName(Uint4 file_id)
+{
+    return "/storage/nc_db." + NStr::UIntToString(file_id) + ".db";
+}
+
+static string
+s_ReadFile(const string& file_name)
+{
+    CNcbiIfstream in(file_name.c_str(), IOS_BASE::in | IOS_BASE::binary);
+    return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+}
+
+static void
+s_WriteFile(const string& file_name, const string& data)
+{
+    CNcbiOfstream out(file_name.c_str(), IOS_BASE::out | IOS_BASE::binary
+                                         | IOS_BASE::trunc);
+    out.write(data.data(), data.size());
+}
+
+/// Generation number written in the header of the log or snapshot file
+static Uint8
+s_GetGeneration(const string& file_name)
+{
+    CNcbiIfstream in(file_name.c_str(), IOS_BASE::in | IOS_BASE::binary);
+    Uint8 generation = 0;
+    in.seekg(8);
+    in.read((char*)&generation, sizeof(generation));
+    return in ? generation : 0;
+}
+
+/// Make the log big enough to be merged into a new snapshot
+static void
+s_ForceSnapshot(CNCDBIndexLog& index, const string& base_name)
+{
+    Uint8 generation = s_GetGeneration(base_name + ".log");
+    Uint8 rec_no = index.GetMaxSyncLogRecNo();
+    while (s_GetGeneration(base_name + ".log") == generation)
+        index.SetMaxSyncLogRecNo(++rec_no);
+}
+
+
+static void
+s_TestReplay(const string& base_name)
+{
+    SIndexState expected;
+    {{
+        CNCDBIndexLog index(base_name);
+        NC_CHECK( !index.Open() );
+        for (Uint4 id = 1; id <= 10; ++id) {
+            index.NewDBFile(id, s_FileName(id));
+            expected.files[id] = s_FileName(id);
+        }
+        index.DeleteDBFile(3);
+        index.DeleteDBFile(7);
+        expected.files.erase(3);
+        expected.files.erase(7);
+        index.SetMaxSyncLogRecNo(12345);
+        index.UpdatePurgeData("purge 1");
+        index.UpdatePurgeData("purge 2");
+        expected.log_rec_no = 12345;
+        expected.purge_data = "purge 2";
+        NC_CHECK( s_GetState(index) == expected );
+    }}
+    NC_CHECK( !CFile(base_name + ".snap").Exists() );
+
+    bool existed = false;
+    NC_CHECK( s_ReopenState(base_name, &existed) == expected );
+    NC_CHECK( existed );
+
+    // Changes made after reopening go after the replayed ones
+    {{
+        CNCDBIndexLog index(base_name);
+        index.Open();
+        index.DeleteAllDBFiles();
+        index.NewDBFile(20, s_FileName(20));
+    }}
+    expected.files.clear();
+    expected.files[20] = s_FileName(20);
+    NC_CHECK( s_ReopenState(base_name) == expected );
+}
+
+static void
+s_TestTornTail(const string& base_name)
+{
+    SIndexState expected;
+    {{
+        CNCDBIndexLog index(base_name);
+        index.Open();
+        index.NewDBFile(1, s_FileName(1));
+        index.NewDBFile(2, s_FileName(2));
+        expected = s_GetState(index);
+        index.NewDBFile(3, s_FileName(3));
+    }}
+    string log_name = base_name + ".log";
+    string full_log = s_ReadFile(log_name);
+    string good_log = full_log.substr(
+                        0, full_log.size() - 9 - 8 - s_FileName(3).size());
+
+    // Crash in the middle of writing the last record
+    for (size_t cut = 1; cut < full_log.size() - good_log.size(); cut += 7) {
+        s_WriteFile(log_name, full_log.substr(0, full_log.size() - cut));
+        NC_CHECK( s_ReopenState(base_name) == expected );
+        // Torn part is cut off the file
+        NC_CHECK( s_ReadFile(log_name) == good_log );
+    }
+
+    // Garbage in the last record
+    string bad_log = full_log;
+    bad_log[bad_log.size() - 2] ^= 0x5a;
+    s_WriteFile(log_name, bad_log);
+    NC_CHECK( s_ReopenState(base_name) == expected );
+    NC_CHECK( s_ReadFile(log_name) == good_log );
+
+    // New records are written after the good ones and can be read back
+    {{
+        CNCDBIndexLog index(base_name);
+        index.Open();
+        index.NewDBFile(4, s_FileName(4));
+    }}
+    expected.files[4] = s_FileName(4);
+    NC_CHECK( s_ReopenState(base_name) == expected );
+
+    // Crash right after the log file was created
+    s_WriteFile(log_name, string());
+    bool existed = false;
+    s_ReopenState(base_name, &existed);
+    NC_CHECK( existed );
+}
+
+static void
+s_TestGenerations(const string& base_name)
+{
+    string log_name = base_name + ".log";
+    string snap_name = base_name + ".snap";
+    string old_log;
+    SIndexState expected;
+    {{
+        CNCDBIndexLog index(base_name);
+        index.Open();
+        index.NewDBFile(1, s_FileName(1));
+        s_ForceSnapshot(index, base_name);
+        NC_CHECK( CFile(snap_name).Exists() );
+        NC_CHECK( s_GetGeneration(log_name) == s_GetGeneration(snap_name) + 1 );
+        NC_CHECK( s_ReopenState(base_name) == s_GetState(index) );
+
+        // Log that creates file 2, the file is deleted before the log is
+        // merged into the next snapshot
+        index.NewDBFile(2, s_FileName(2));
+        old_log = s_ReadFile(log_name);
+        index.DeleteDBFile(2);
+        s_ForceSnapshot(index, base_name);
+        index.NewDBFile(4, s_FileName(4));
+        expected = s_GetState(index);
+    }}
+    NC_CHECK( expected.files.count(2) == 0 );
+    NC_CHECK( s_ReopenState(base_name) == expected );
+
+    // Crash after the snapshot was written but before the new log was
+    // started: log of the generation already in the snapshot is ignored,
+    // replaying it would bring file 2 back.
+    s_WriteFile(log_name, old_log);
+    expected.files.erase(4);
+    NC_CHECK( s_GetGeneration(log_name) <= s_GetGeneration(snap_name) );
+    NC_CHECK( s_ReopenState(base_name) == expected );
+    NC_CHECK( s_GetGeneration(log_name) == s_GetGeneration(snap_name) + 1 );
+
+    // Leftover of the unfinished snapshot doesn't matter
+    s_WriteFile(snap_name + ".tmp", "garbage");
+    NC_CHECK( s_ReopenState(base_name) == expected );
+
+    CNCDBIndexLog::Remove(base_name);
+    NC_CHECK( !CFile(log_name).Exists() );
+    NC_CHECK( !CFile(snap_name).Exists() );
+    NC_CHECK( !CFile(snap_name + ".tmp").Exists() );
+}
+
+static void
+s_TestMigration(const string& base_name)
+{
+    string old_name = base_name + ".sqlite";
+    {{
+        CNCDBIndexFile old_index(old_name);
+        old_index.CreateDatabase();
+        old_index.NewDBFile(5, s_FileName(5));
+        old_index.NewDBFile(6, s_FileName(6));
+        old_index.NewDBFile(8, s_FileName(8));
+        old_index.DeleteDBFile(6);
+        old_index.SetMaxSyncLogRecNo(777);
+        old_index.UpdatePurgeData("old purge");
+    }}
+    SIndexState expected;
+    expected.files[5] = s_FileName(5);
+    expected.files[8] = s_FileName(8);
+    expected.log_rec_no = 777;
+    expected.purge_data = "old purge";
+
+    {{
+        CNCDBIndexLog index(base_name);
+        NC_CHECK( !index.Open() );
+        NC_CHECK( index.ImportSQLiteIndex(old_name) );
+        NC_CHECK( s_GetState(index) == expected );
+    }}
+    NC_CHECK( !CFile(old_name).Exists() );
+    NC_CHECK( CFile(old_name + ".migrated").Exists() );
+    NC_CHECK( CFile(base_name + ".snap").Exists() );
+
+    bool existed = false;
+    NC_CHECK( s_ReopenState(base_name, &existed) == expected );
+    NC_CHECK( existed );
+
+    // Index that is already migrated doesn't import anything again
+    CNCDBIndexLog index(base_name);
+    index.Open();
+    NC_CHECK( !index.ImportSQLiteIndex(old_name) );
+    NC_CHECK( s_GetState(index) == expected );
+}
+
+static void
+s_TestRecNumsSet(void)
+{
+    CNCRecNumsSet recs;
+    NC_CHECK( recs.FindNext(1) == 0 );
+    set<Uint4> expected;
+    for (Uint4 rec_num = 1; rec_num < 5000; rec_num += 1 + rec_num % 7) {
+        recs.Insert(rec_num);
+        expected.insert(rec_num);
+    }
+    recs.Insert(100000);
+    expected.insert(100000);
+    for (Uint4 rec_num = 3; rec_num < 5000; rec_num += 5) {
+        NC_CHECK( recs.Erase(rec_num) == (expected.erase(rec_num) != 0) );
+    }
+    NC_CHECK( !recs.Erase(200000) );
+    NC_CHECK( recs.Size() == expected.size() );
+
+    vector<Uint4> found;
+    for (Uint4 rec_num = recs.FindNext(1); rec_num != 0;
+         rec_num = recs.FindNext(rec_num + 1))
+    {
+        NC_CHECK( recs.Contains(rec_num) );
+        found.push_back(rec_num);
+    }
+    NC_CHECK( found == vector<Uint4>(expected.begin(), expected.end()) );
+
+    recs.Clear();
+    NC_CHECK( recs.Size() == 0 );
+    NC_CHECK( recs.FindNext(1) == 0 );
+}
+
+
+/// Record numbers of a storage in files of kRecsPerFile meta records and
+/// as many data records, as CBlobCacher goes through them on start: all
+/// good records are collected, blobs are cached from meta records with
+/// their data records checked off, and whatever is left is orphaned.
+static const Uint4 kRecsPerFile = 1000000;
+
+/// What CBlobCacher used before
+typedef set<Uint4> TNumsSet;
+
+struct SSetOps
+{
+    static void Insert(TNumsSet& recs, Uint4 rec_num)
+        { recs.insert(recs.end(), rec_num); }
+    static bool Erase(TNumsSet& recs, Uint4 rec_num)
+        { return recs.erase(rec_num) != 0; }
+    template <class TFunc>
+    static void ForEach(const TNumsSet& recs, TFunc& func)
+    {
+        ITERATE(TNumsSet, it, recs) {
+            func(*it);
+        }
+    }
+};
+
+struct SBitsOps
+{
+    static void Insert(CNCRecNumsSet& recs, Uint4 rec_num)
+        { recs.Insert(rec_num); }
+    static bool Erase(CNCRecNumsSet& recs, Uint4 rec_num)
+        { return recs.Erase(rec_num); }
+    template <class TFunc>
+    static void ForEach(const CNCRecNumsSet& recs, TFunc& func)
+    {
+        for (Uint4 rec_num = recs.FindNext(1); rec_num != 0;
+             rec_num = recs.FindNext(rec_num + 1))
+        {
+            func(rec_num);
+        }
+    }
+};
+
+template <class TRecs, class TOps>
+struct SCacheMetaRecs
+{
+    map<Uint4, TRecs>& files;
+    Uint4              data_file_id;
+    Uint8              cnt_cached;
+
+    SCacheMetaRecs(map<Uint4, TRecs>& f) : files(f), cnt_cached(0) {}
+    void operator() (Uint4 rec_num)
+    {
+        // Every 10th blob lost its data
+        if (rec_num % 10 != 0  &&  TOps::Erase(files[data_file_id], rec_num))
+            ++cnt_cached;
+    }
+};
+
+struct SCountRecs
+{
+    Uint8 cnt;
+
+    SCountRecs(void) : cnt(0) {}
+    void operator() (Uint4) { ++cnt; }
+};
+
+template <class TRecs, class TOps>
+static double
+s_BenchCaching(const char* name, Uint8 cnt_blobs)
+{
+    typedef map<Uint4, TRecs> TFiles;
+    TFiles files;
+    CStopWatch sw(CStopWatch::eStart);
+
+    // Meta files have odd ids, data file with the same blobs goes next
+    for (Uint8 first = 0; first < cnt_blobs; first += kRecsPerFile) {
+        Uint4 file_id = Uint4(first / kRecsPerFile) * 2 + 1;
+        Uint4 cnt_recs = Uint4(min(Uint8(kRecsPerFile), cnt_blobs - first));
+        for (Uint4 id = file_id; id <= file_id + 1; ++id) {
+            TRecs& recs = files[id];
+            for (Uint4 rec_num = 1; rec_num <= cnt_recs; ++rec_num)
+                TOps::Insert(recs, rec_num);
+        }
+    }
+    double collect_time = sw.Elapsed();
+
+    SCacheMetaRecs<TRecs, TOps> cacher(files);
+    for (Uint4 file_id = 1; files.find(file_id) != files.end(); file_id += 2) {
+        cacher.data_file_id = file_id + 1;
+        TOps::ForEach(files[file_id], cacher);
+        files[file_id] = TRecs();
+    }
+    double cache_time = sw.Elapsed();
+
+    SCountRecs orphans;
+    ITERATE(typename TFiles, it, files) {
+        TOps::ForEach(it->second, orphans);
+    }
+    double total_time = sw.Elapsed();
+
+    NC_CHECK( cacher.cnt_cached + orphans.cnt == cnt_blobs );
+    NcbiCout << name << ": " << cnt_blobs << " blobs, collected in "
+             << collect_time << " s, cached in "
+             << cache_time - collect_time << " s, orphans found in "
+             << total_time - cache_time << " s, total "
+             << total_time * 1e9 / double(cnt_blobs) << " ns per blob"
+             << NcbiEndl;
+    return total_time;
+}
+
+/// Loading of the index as netcached does it on start
+struct SLoadIndexLog
+{
+    static void Load(const string& base_name, TNCDBFilesMap* files_map)
+    {
+        CNCDBIndexLog index(base_name);
+        index.Open();
+        index.GetAllDBFiles(files_map);
+        index.GetMaxSyncLogRecNo();
+        index.GetPurgeData();
+    }
+};
+
+/// Same with the SQLite index of older versions
+struct SLoadIndexFile
+{
+    static void Load(const string& file_name, TNCDBFilesMap* files_map)
+    {
+        CNCDBIndexFile index(file_name);
+        index.CreateDatabase();
+        index.GetAllDBFiles(files_map);
+        index.GetMaxSyncLogRecNo();
+        index.GetPurgeData();
+    }
+};
+
+/// Best of several loads (the files are in the OS cache after the first)
+template <class TLoader>
+static double
+s_TimeIndexLoad(const string& name, size_t cnt_files)
+{
+    double best = 0;
+    for (int i = 0; i < 5; ++i) {
+        TNCDBFilesMap files_map;
+        CStopWatch sw(CStopWatch::eStart);
+        TLoader::Load(name, &files_map);
+        double t = sw.Elapsed();
+        NC_CHECK( files_map.size() == cnt_files );
+        if (i == 0  ||  t < best)
+            best = t;
+    }
+    return best;
+}
+
+/// Index of a running storage of cnt_files files, left right before its log
+/// gets merged into a new snapshot, i.e. with the longest log to replay:
+/// max sync log record number is saved after every sync, every 20th sync a
+/// file is filled, so a new one is created and the oldest one is deleted,
+/// purge data change now and then.
+static double
+s_BenchIndexLoad(const string& dir_name, Uint4 cnt_files)
+{
+    string base_name = CDirEntry::MakePath(dir_name, "bench.index");
+    string log_name = base_name + ".log";
+    string snap_name = base_name + ".snap";
+    Uint8 cnt_log_recs = 0;
+    Uint4 first_id = 1, next_id = 1;
+    {{
+        CStopWatch sw(CStopWatch::eStart);
+        CNCDBIndexLog index(base_name);
+        index.Open();
+        for (; next_id <= cnt_files; ++next_id)
+            index.NewDBFile(next_id, s_FileName(next_id));
+        Uint8 rec_no = 0;
+        Int8 snap_size = CFile(snap_name).GetLength();
+        for (;;) {
+            Int8 log_size = CFile(log_name).GetLength();
+            Int8 new_snap_size = CFile(snap_name).GetLength();
+            if (new_snap_size != snap_size) {
+                snap_size = new_snap_size;
+                cnt_log_recs = 0;
+            }
+            // Next file rotation could trigger the merge
+            if (log_size + 200 >= snap_size * 4  &&  log_size >= 64 * 1024)
+                break;
+            index.SetMaxSyncLogRecNo(++rec_no);
+            ++cnt_log_recs;
+            if (rec_no % 20 == 0) {
+                index.DeleteDBFile(first_id++);
+                index.NewDBFile(next_id, s_FileName(next_id));
+                ++next_id;
+                cnt_log_recs += 2;
+            }
+            if (rec_no % 1000 == 0) {
+                index.UpdatePurgeData("purge " + NStr::UInt8ToString(rec_no));
+                ++cnt_log_recs;
+            }
+        }
+        NcbiCout << "Index of " << cnt_files << " files built in "
+                 << sw.Elapsed() << " s, " << next_id - 1
+                 << " files created in total" << NcbiEndl;
+    }}
+    double log_time = s_TimeIndexLoad<SLoadIndexLog>(base_name, cnt_files);
+    NcbiCout << "CNCDBIndexLog:  snapshot of "
+             << CFile(snap_name).GetLength() << " bytes, log of "
+             << CFile(log_name).GetLength() << " bytes (" << cnt_log_recs
+             << " records), loaded in " << log_time * 1000 << " ms"
+             << NcbiEndl;
+
+    string old_name = base_name + ".sqlite";
+    {{
+        CNCDBIndexFile old_index(old_name);
+        old_index.CreateDatabase();
+        for (Uint4 id = first_id; id < next_id; ++id)
+            old_index.NewDBFile(id, s_FileName(id));
+        old_index.SetMaxSyncLogRecNo(12345);
+        old_index.UpdatePurgeData("purge");
+    }}
+    double old_time = s_TimeIndexLoad<SLoadIndexFile>(old_name, cnt_files);
+    NcbiCout << "CNCDBIndexFile: " << CFile(old_name).GetLength()
+             << " bytes, loaded in " << old_time * 1000 << " ms" << NcbiEndl;
+    return log_time;
+}
+
+static void
+s_Benchmark(Uint8 cnt_blobs, Uint8 cnt_set_blobs, Uint4 cnt_files)
+{
+    CDir dir(CDirEntry::CreateAbsolutePath("test_nc_db_index.bench"));
+    dir.Remove();
+    dir.CreatePath();
+    CSQLITE_Global::Initialize();
+    double index_time = s_BenchIndexLoad(dir.GetPath(), cnt_files);
+    CSQLITE_Global::Finalize();
+    dir.Remove();
+
+    double caching_time =
+        s_BenchCaching<CNCRecNumsSet, SBitsOps>("CNCRecNumsSet", cnt_blobs);
+    if (cnt_set_blobs != 0)
+        s_BenchCaching<TNumsSet, SSetOps>("set<Uint4>   ", cnt_set_blobs);
+    NcbiCout << "Start of a storage of " << cnt_files << " files and "
+             << cnt_blobs << " blobs: " << index_time + caching_time
+             << " s (besides reading of the files themselves)" << NcbiEndl;
+}
+
+
+END_NCBI_SCOPE
+
+
+USING_NCBI_SCOPE;
+
+
+int main(int argc, const char* argv[])
+{
+    if (argc > 1  &&  NStr::Equal(argv[1], "-bench")) {
+        Uint8 cnt_blobs = 50000000;
+        Uint8 cnt_set_blobs = 5000000;
+        Uint4 cnt_files = 10000;
+        if (argc > 2)
+            cnt_blobs = NStr::StringToUInt8(argv[2]);
+        if (argc > 3)
+            cnt_set_blobs = NStr::StringToUInt8(argv[3]);
+        if (argc > 4)
+            cnt_files = NStr::StringToUInt(argv[4]);
+        s_Benchmark(cnt_blobs, cnt_set_blobs, cnt_files);
+        return s_CntFailed == 0 ? 0 : 1;
+    }
+
+    CDir dir(CDirEntry::CreateAbsolutePath("test_nc_db_index.tmp"));
+    dir.Remove();
+    if (!dir.CreatePath()) {
+        NcbiCerr << "Cannot create directory " << dir.GetPath() << NcbiEndl;
+        return 1;
+    }
+    CSQLITE_Global::Initialize();
+    try {
+        s_TestReplay(CDirEntry::MakePath(dir.GetPath(), "replay.index"));
+        s_TestTornTail(CDirEntry::MakePath(dir.GetPath(), "torn.index"));
+        s_TestGenerations(CDirEntry::MakePath(dir.GetPath(), "gen.index"));
+        s_TestMigration(CDirEntry::MakePath(dir.GetPath(), "old.index"));
+        s_TestRecNumsSet();
+    }
+    catch (CException& ex) {
+        NcbiCerr << "Unexpected exception: " << ex.what() << NcbiEndl;
+        ++s_CntFailed;
+    }
+    CSQLITE_Global::Finalize();
+    dir.Remove();
+
+    if (s_CntFailed != 0) {
+        NcbiCerr << s_CntFailed << " check(s) failed" << NcbiEndl;
+        return 1;
+    }
+    NcbiCout << "All checks passed" << NcbiEndl;
+    return 0;
+}
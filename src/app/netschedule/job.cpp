@@ -43,6 +43,7 @@
 #include "ns_affinity.hpp"
 #include "ns_group.hpp"
 #include "ns_db_dump.hpp"
+#include "ns_job_store.hpp"
 
 
 BEGIN_NCBI_SCOPE
@@ -410,6 +411,9 @@ CJob::EJobFetchResult CJob::x_Fetch(CQueue* queue)
 
 CJob::EJobFetchResult  CJob::Fetch(CQueue *  queue, unsigned  id)
 {
+    if (queue->m_QueueDbBlock->job_store)
+        return x_FetchFromStore(queue, id);
+
     SJobDB &        job_db = queue->m_QueueDbBlock->job_db;
 
     job_db.id = id;
@@ -437,6 +441,13 @@ bool CJob::Flush(CQueue* queue)
     if (m_Dirty == 0 && m_New == false)
         return true;
 
+    if (queue->m_QueueDbBlock->job_store) {
+        x_FlushToStore(queue);
+        m_New = false;
+        m_Dirty = 0;
+        return true;
+    }
+
     SJobDB &        job_db      = queue->m_QueueDbBlock->job_db;
     SJobInfoDB &    job_info_db = queue->m_QueueDbBlock->job_info_db;
     SEventsDB &     events_db   = queue->m_QueueDbBlock->events_db;
@@ -541,6 +552,267 @@ bool CJob::Flush(CQueue* queue)
 }
 
 
+// Job records of the in-memory job store. Numbers are stored in the native
+// byte order, strings are prefixed with their Uint4 size.
+template <typename TNum>
+static inline void s_PutNum(string &  rec, TNum  num)
+{
+    rec.append((const char *)&num, sizeof(num));
+}
+
+
+static inline void s_PutStr(string &  rec, const string &  str)
+{
+    s_PutNum(rec, Uint4(str.size()));
+    rec.append(str);
+}
+
+
+class CJobRecordReader
+{
+public:
+    CJobRecordReader(const string &  rec)
+        : m_Ptr(rec.data()), m_End(rec.data() + rec.size()), m_Error(false)
+    {}
+
+    template <typename TNum>
+    TNum GetNum(void)
+    {
+        TNum    num = 0;
+        if (size_t(m_End - m_Ptr) < sizeof(num)) {
+            m_Error = true;
+            return num;
+        }
+        memcpy(&num, m_Ptr, sizeof(num));
+        m_Ptr += sizeof(num);
+        return num;
+    }
+
+    CNSPreciseTime GetTime(void)
+    {
+        return CNSPreciseTime(GetNum<double>());
+    }
+
+    string GetStr(void)
+    {
+        Uint4   size = GetNum<Uint4>();
+        if (m_Error || size_t(m_End - m_Ptr) < size) {
+            m_Error = true;
+            return kEmptyStr;
+        }
+        string  str(m_Ptr, size);
+        m_Ptr += size;
+        return str;
+    }
+
+    bool HasError(void) const
+    {
+        return m_Error;
+    }
+
+    // The record has been read completely and without errors
+    bool IsOK(void) const
+    {
+        return !m_Error && m_Ptr == m_End;
+    }
+
+private:
+    const char *    m_Ptr;
+    const char *    m_End;
+    bool            m_Error;
+};
+
+
+// The job record holds what SJobDB and SEventsDB hold
+void CJob::x_SaveJobRecord(string &  rec) const
+{
+    bool    input_overflow = m_Input.size() > kNetScheduleSplitSize;
+    bool    output_overflow = m_Output.size() > kNetScheduleSplitSize;
+
+    rec.reserve(256);
+    s_PutNum(rec, Uint4(m_Passport));
+    s_PutNum(rec, Int4(m_Status));
+    s_PutNum(rec, (double)m_Timeout);
+    s_PutNum(rec, (double)m_RunTimeout);
+    s_PutNum(rec, (double)m_ReadTimeout);
+    s_PutNum(rec, Uint2(m_SubmNotifPort));
+    s_PutNum(rec, (double)m_SubmNotifTimeout);
+    s_PutNum(rec, Uint4(m_ListenerNotifAddress));
+    s_PutNum(rec, Uint2(m_ListenerNotifPort));
+    s_PutNum(rec, (double)m_ListenerNotifAbsTime);
+    s_PutNum(rec, Uint4(m_RunCount));
+    s_PutNum(rec, Uint4(m_ReadCount));
+    s_PutNum(rec, Uint4(m_AffinityId));
+    s_PutNum(rec, Uint4(m_Mask));
+    s_PutNum(rec, Uint4(m_GroupId));
+    s_PutNum(rec, (double)m_LastTouch);
+    s_PutStr(rec, m_ClientIP);
+    s_PutStr(rec, m_ClientSID);
+    s_PutStr(rec, m_NCBIPHID);
+    s_PutStr(rec, m_ProgressMsg);
+
+    // Short input/output are in the job record, long ones are in the job
+    // info record
+    s_PutStr(rec, input_overflow ? kEmptyStr : m_Input);
+    s_PutStr(rec, output_overflow ? kEmptyStr : m_Output);
+
+    s_PutNum(rec, Uint4(m_Events.size()));
+    for (vector<CJobEvent>::const_iterator  it = m_Events.begin();
+         it != m_Events.end(); ++it) {
+        s_PutNum(rec, Uint4(it->m_Event));
+        s_PutNum(rec, Int4(it->m_Status));
+        s_PutNum(rec, (double)it->m_Timestamp);
+        s_PutNum(rec, Uint4(it->m_NodeAddr));
+        s_PutNum(rec, Int4(it->m_RetCode));
+        s_PutStr(rec, it->m_ClientNode);
+        s_PutStr(rec, it->m_ClientSession);
+        s_PutStr(rec, it->m_ErrorMsg);
+    }
+}
+
+
+// The job info record holds what SJobInfoDB holds. It is empty if neither
+// input nor output is long.
+void CJob::x_SaveInfoRecord(string &  rec) const
+{
+    bool    input_overflow = m_Input.size() > kNetScheduleSplitSize;
+    bool    output_overflow = m_Output.size() > kNetScheduleSplitSize;
+
+    if (!input_overflow && !output_overflow)
+        return;
+
+    rec.reserve((input_overflow ? m_Input.size() : 0) +
+                (output_overflow ? m_Output.size() : 0) + 2 * sizeof(Uint4));
+    s_PutStr(rec, input_overflow ? m_Input : kEmptyStr);
+    s_PutStr(rec, output_overflow ? m_Output : kEmptyStr);
+}
+
+
+bool CJob::x_LoadRecords(const string &  job_rec, const string &  info_rec)
+{
+    CJobRecordReader    reader(job_rec);
+
+    m_Passport              = reader.GetNum<Uint4>();
+    m_Status                = TJobStatus(reader.GetNum<Int4>());
+    m_Timeout               = reader.GetTime();
+    m_RunTimeout            = reader.GetTime();
+    m_ReadTimeout           = reader.GetTime();
+    m_SubmNotifPort         = reader.GetNum<Uint2>();
+    m_SubmNotifTimeout      = reader.GetTime();
+    m_ListenerNotifAddress  = reader.GetNum<Uint4>();
+    m_ListenerNotifPort     = reader.GetNum<Uint2>();
+    m_ListenerNotifAbsTime  = reader.GetTime();
+    m_RunCount              = reader.GetNum<Uint4>();
+    m_ReadCount             = reader.GetNum<Uint4>();
+    m_AffinityId            = reader.GetNum<Uint4>();
+    m_Mask                  = reader.GetNum<Uint4>();
+    m_GroupId               = reader.GetNum<Uint4>();
+    m_LastTouch             = reader.GetTime();
+    m_ClientIP              = reader.GetStr();
+    m_ClientSID             = reader.GetStr();
+    m_NCBIPHID              = reader.GetStr();
+    m_ProgressMsg           = reader.GetStr();
+    m_Input                 = reader.GetStr();
+    m_Output                = reader.GetStr();
+
+    Uint4       event_count = reader.GetNum<Uint4>();
+    m_Events.clear();
+    for (Uint4  n = 0; n < event_count && !reader.HasError(); ++n) {
+        CJobEvent       event;
+
+        event.m_Event         = CJobEvent::EJobEvent(reader.GetNum<Uint4>());
+        event.m_Status        = TJobStatus(reader.GetNum<Int4>());
+        event.m_Timestamp     = reader.GetTime();
+        event.m_NodeAddr      = reader.GetNum<Uint4>();
+        event.m_RetCode       = reader.GetNum<Int4>();
+        event.m_ClientNode    = reader.GetStr();
+        event.m_ClientSession = reader.GetStr();
+        event.m_ErrorMsg      = reader.GetStr();
+        event.m_Dirty         = false;
+        m_Events.push_back(event);
+    }
+    if (!reader.IsOK() || m_Events.size() != event_count)
+        return false;
+
+    if (info_rec.empty())
+        return true;
+
+    CJobRecordReader    info_reader(info_rec);
+    string              input = info_reader.GetStr();
+    string              output = info_reader.GetStr();
+
+    if (!info_reader.IsOK())
+        return false;
+    if (input.size() > kNetScheduleSplitSize)
+        m_Input.swap(input);
+    if (output.size() > kNetScheduleSplitSize)
+        m_Output.swap(output);
+    return true;
+}
+
+
+CJob::EJobFetchResult  CJob::x_FetchFromStore(CQueue *  queue, unsigned  id)
+{
+    string      job_rec;
+    string      info_rec;
+
+    if (!queue->m_QueueDbBlock->job_store->Get(id, job_rec, info_rec))
+        return eJF_NotFound;
+
+    m_Id = id;
+    if (!x_LoadRecords(job_rec, info_rec)) {
+        ERR_POST("Error decoding the job record, job_key " <<
+                 queue->MakeJobKey(id));
+        return eJF_DBErr;
+    }
+
+    m_New   = false;
+    m_Dirty = 0;
+    return eJF_Ok;
+}
+
+
+void CJob::x_FlushToStore(CQueue *  queue)
+{
+    CNSJobStore *   job_store = queue->m_QueueDbBlock->job_store;
+    bool            flush_job = (m_Dirty & fJobPart) || m_New;
+
+    // The events are a part of the job record
+    NON_CONST_ITERATE(vector<CJobEvent>, it, m_Events) {
+        if (it->m_Dirty) {
+            flush_job = true;
+            it->m_Dirty = false;
+        }
+    }
+
+    if (flush_job) {
+        string      job_rec;
+        string      group_token;
+
+        x_SaveJobRecord(job_rec);
+
+        // The tokens make the log records independent of the affinity and
+        // group IDs which are not preserved if the server crashes
+        if (m_GroupId != 0) {
+            try {
+                group_token = queue->m_GroupRegistry.ResolveGroup(m_GroupId);
+            } catch (...) {
+                // The group has already gone
+            }
+        }
+        job_store->PutJob(m_Id, m_AffinityId, m_GroupId, job_rec,
+                          queue->m_AffinityRegistry.GetTokenByID(m_AffinityId),
+                          group_token);
+    }
+
+    if (m_Dirty & fJobInfoPart) {
+        string      info_rec;
+        x_SaveInfoRecord(info_rec);
+        job_store->PutInfo(m_Id, info_rec);
+    }
+}
+
+
 bool CJob::ShouldNotifySubmitter(const CNSPreciseTime &  current_time) const
 {
     // The very first event is always a submit
@@ -431,6 +431,13 @@ public:
 private:
     EJobFetchResult x_Fetch(CQueue* queue);
 
+    // In-memory job store support (see ns_job_store.hpp)
+    EJobFetchResult x_FetchFromStore(CQueue* queue, unsigned id);
+    void x_FlushToStore(CQueue* queue);
+    void x_SaveJobRecord(string &  rec) const;
+    void x_SaveInfoRecord(string &  rec) const;
+    bool x_LoadRecords(const string &  job_rec, const string &  info_rec);
+
 private:
     // Service flags
     bool                m_New;     // Object should be inserted, not updated
@@ -347,6 +347,32 @@ CJobStatusTracker::GetJobs(CNetScheduleAPI::EJobStatus  status,
 }
 
 
+// Leaves in the given jobs only those which are in the given state(s).
+// Used instead of GetJobs() when the candidates are known to be few: it
+// does not copy the whole status vector.
+void
+CJobStatusTracker::RestrictByStatus(TJobStatus  status,
+                                    TNSBitVector &  jobs) const
+{
+    CReadLockGuard      guard(m_Lock);
+    jobs &= *m_StatusStor[(int)status];
+}
+
+
+void
+CJobStatusTracker::RestrictByStatus(const vector<TJobStatus> &  statuses,
+                                    TNSBitVector &  jobs) const
+{
+    TNSBitVector        in_statuses;
+    CReadLockGuard      guard(m_Lock);
+
+    for (vector<TJobStatus>::const_iterator  k = statuses.begin();
+         k != statuses.end(); ++k)
+        in_statuses |= jobs & *m_StatusStor[(int)(*k)];
+    jobs.swap(in_statuses);
+}
+
+
 TNSBitVector
 CJobStatusTracker::GetOutdatedPendingJobs(CNSPreciseTime          timeout,
                                           const CJobGCRegistry &  gc_registry) const
@@ -96,6 +96,9 @@ public:
     void  GetJobs(const vector<TJobStatus> &  statuses,
                   TNSBitVector & jobs) const;
     void  GetJobs(TJobStatus  status, TNSBitVector &  jobs) const;
+    void  RestrictByStatus(TJobStatus  status, TNSBitVector &  jobs) const;
+    void  RestrictByStatus(const vector<TJobStatus> &  statuses,
+                           TNSBitVector &  jobs) const;
     TNSBitVector  GetOutdatedPendingJobs(
                             CNSPreciseTime          timeout,
                             const CJobGCRegistry &  gc_registry) const;
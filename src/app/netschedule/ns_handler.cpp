@@ -39,6 +39,7 @@
 #include "ns_server_misc.hpp"
 #include "ns_rollback.hpp"
 #include "queue_database.hpp"
+#include "ns_job_store.hpp"
 #include "ns_application.hpp"
 
 #include <sys/types.h>
@@ -933,6 +934,17 @@ CNetScheduleHandler::x_PrepareWriteBuffer(const string &  msg,
 
 EIO_Status CNetScheduleHandler::x_WriteMessage(const string &  msg)
 {
+    // The reply must not overtake the job store log records of the
+    // changes it reports (no-op unless the 'memory' storage engine
+    // uses synchronous commits). If the records could not be written the
+    // changes are not durable and the client gets an error instead.
+    if (!CNSJobStore::WaitForCommits()) {
+        x_SetCmdRequestStatus(eStatus_ServerError);
+        return x_WriteMessage("ERR:eInternalError:" +
+                              NStr::PrintableString("Job changes could not "
+                              "be written to the disk") + kEndOfResponse);
+    }
+
     size_t  msg_size = msg.size();
     bool    has_eom = false;
 
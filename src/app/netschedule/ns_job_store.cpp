@@ -0,0 +1,1051 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   NetSchedule in-memory job tables with a write-ahead log
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbistd.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
+#include <util/checksum.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include "ns_job_store.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+// Log and snapshot files start with a signature followed by Uint8
+// generation number. A snapshot generation is the generation of the first
+// log which has to be replayed over it.
+static const char       kWALSignature[8] = "NSJWAL1";
+static const char       kSnapshotSignature[8] = "NSJSNP1";
+static const size_t     kFileHeaderSize = 8 + sizeof(Uint8);
+
+// Each record has Uint4 size of data, Uint4 CRC32 of the rest, Uint1 type,
+// Uint4 job id and then data itself.
+static const size_t     kRecHeaderSize = 3 * sizeof(Uint4) + 1;
+
+// Number of jobs copied to a snapshot under one lock
+static const size_t     kSnapshotChunkSize = 1000;
+
+enum ERecordType {
+    eRecJob         = 1,    // Uint4 aff_id, Uint4 group_id,
+                            // Uint4 size + affinity token,
+                            // Uint4 size + group token, job record
+    eRecInfo        = 2,    // job info record (empty - no info)
+    eRecErase       = 3,    // no data
+    eRecSnapshotEnd = 4     // Uint8 number of jobs
+};
+
+
+// The transaction which the current thread has committed and which has to
+// be on the disk before the response is sent
+static NCBI_TLS_VAR CNSJobStore *   s_CommitStore = NULL;
+static NCBI_TLS_VAR Uint8           s_CommitLSN = 0;
+
+// The transaction which collects the current thread modifications
+static NCBI_TLS_VAR CNSJobStoreTransaction *    s_Transaction = NULL;
+
+
+template <typename TNum>
+static inline void s_PutNum(string &  buf, TNum  num)
+{
+    buf.append((const char *)&num, sizeof(num));
+}
+
+
+template <typename TNum>
+static inline TNum s_GetNum(const char *  data)
+{
+    TNum    num;
+    memcpy(&num, data, sizeof(num));
+    return num;
+}
+
+
+static void s_PutRecord(string &         buf,
+                        unsigned char    type,
+                        unsigned int     job_id,
+                        const string &   data)
+{
+    CChecksum   crc(CChecksum::eCRC32);
+    Uint4       id = job_id;
+
+    crc.AddChars((const char *)&type, 1);
+    crc.AddChars((const char *)&id, sizeof(id));
+    crc.AddChars(data.data(), data.size());
+
+    s_PutNum(buf, Uint4(data.size()));
+    s_PutNum(buf, Uint4(crc.GetChecksum()));
+    buf.append(1, char(type));
+    s_PutNum(buf, id);
+    buf.append(data);
+}
+
+
+static string s_MakeJobData(unsigned int    aff_id,
+                            unsigned int    group_id,
+                            const string &  job_rec,
+                            const string &  aff_token,
+                            const string &  group_token)
+{
+    string      data;
+
+    data.reserve(4 * sizeof(Uint4) + aff_token.size() + group_token.size() +
+                 job_rec.size());
+    s_PutNum(data, Uint4(aff_id));
+    s_PutNum(data, Uint4(group_id));
+    s_PutNum(data, Uint4(aff_token.size()));
+    data.append(aff_token);
+    s_PutNum(data, Uint4(group_token.size()));
+    data.append(group_token);
+    data.append(job_rec);
+    return data;
+}
+
+
+static void s_WriteAll(int  fd, const string &  data,
+                       const string &  file_name)
+{
+    const char *    ptr = data.data();
+    size_t          left = data.size();
+
+    while (left > 0) {
+        ssize_t     n = write(fd, ptr, left);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            NCBI_THROW(CFileErrnoException, eFileIO,
+                       "Cannot write to " + file_name);
+        }
+        ptr += n;
+        left -= size_t(n);
+    }
+}
+
+
+static void s_Sync(int  fd, const string &  file_name)
+{
+    if (fdatasync(fd) != 0)
+        NCBI_THROW(CFileErrnoException, eFileIO,
+                   "Cannot sync " + file_name);
+}
+
+
+// Makes sure that a file creation or renaming is on the disk
+static void s_SyncDir(const string &  dir_name)
+{
+    int     fd = open(dir_name.c_str(), O_RDONLY);
+    if (fd == -1)
+        NCBI_THROW(CFileErrnoException, eFile,
+                   "Cannot open directory " + dir_name);
+    int     res = fsync(fd);
+    close(fd);
+    if (res != 0)
+        NCBI_THROW(CFileErrnoException, eFileIO,
+                   "Cannot sync directory " + dir_name);
+}
+
+
+static string s_ReadWholeFile(const string &  file_name)
+{
+    CFileIO     f;
+    string      data;
+    size_t      pos = 0;
+
+    f.Open(file_name, CFileIO_Base::eOpen, CFileIO_Base::eRead);
+    data.resize(size_t(f.GetFileSize()));
+    while (pos < data.size()) {
+        size_t  n_read = f.Read(&data[pos], data.size() - pos);
+        if (n_read == 0)
+            break;
+        pos += n_read;
+    }
+    data.resize(pos);
+    return data;
+}
+
+
+// Writes the log data as soon as it appears
+class CNSJobStoreWriter : public CThread
+{
+public:
+    CNSJobStoreWriter(CNSJobStore &  store)
+        : m_Store(store)
+    {}
+
+protected:
+    virtual void *  Main(void)
+    {
+        SetCurrentThreadName("netscheduled_wal");
+        while (m_Store.x_WriteBuffer())
+            ;
+        return NULL;
+    }
+
+private:
+    CNSJobStore &   m_Store;
+};
+
+
+
+CNSJobStore::CNSJobStore(const string &  wal_dir_name,
+                         bool            sync_commits,
+                         Uint8           snapshot_size)
+    : m_WALDirName(CDirEntry::AddTrailingPathSeparator(wal_dir_name)),
+      m_SyncCommits(sync_commits),
+      m_SnapshotSize(snapshot_size),
+      m_AppendedLSN(0),
+      m_SyncedLSN(0),
+      m_WriteFailed(false),
+      m_StopWriter(false),
+      m_LogFD(-1),
+      m_Generation(0),
+      m_LogSize(0),
+      m_LastSnapshotSize(0),
+      m_ForceSnapshot(false)
+{}
+
+
+CNSJobStore::~CNSJobStore()
+{
+    try {
+        Close(false);
+    } catch (...) {}
+}
+
+
+void CNSJobStore::Open(const string &  qname)
+{
+    Close(false);
+
+    string      upper_qname = qname;
+    NStr::ToUpper(upper_qname);
+    m_BaseName = m_WALDirName + upper_qname;
+    m_Generation = 0;
+    m_LastSnapshotSize = 0;
+    m_WriteFailed = false;
+    m_ForceSnapshot = false;
+}
+
+
+void CNSJobStore::Close(bool  remove_files)
+{
+    x_StopWriter();
+
+    {{
+        CFastMutexGuard     log_guard(m_LogLock);
+        if (m_LogFD != -1) {
+            close(m_LogFD);
+            m_LogFD = -1;
+        }
+        m_LogSize = 0;
+    }}
+
+    {{
+        CFastMutexGuard     guard(m_Lock);
+        m_Jobs.clear();
+        m_Pending.clear();
+        m_SyncedLSN = m_AppendedLSN;
+    }}
+
+    if (remove_files && !m_BaseName.empty()) {
+        x_RemoveLogs(kMax_UI8);
+        CFile(x_GetSnapshotName()).Remove();
+        CFile(x_GetSnapshotName() + ".tmp").Remove();
+        m_Generation = 0;
+        m_LastSnapshotSize = 0;
+    }
+}
+
+
+size_t CNSJobStore::Restore(TNSRestoredJobs &  jobs)
+{
+    // There is no concurrent access at the time of restoring
+    jobs.clear();
+    m_Jobs.clear();
+
+    Uint8       first_generation = 0;
+    string      snapshot_name = x_GetSnapshotName();
+    if (CFile(snapshot_name).Exists()) {
+        x_ReplayFile(snapshot_name, true, first_generation, jobs);
+        m_LastSnapshotSize = Uint8(CFile(snapshot_name).GetLength());
+    }
+
+    map<Uint8, string>      logs;
+    x_ListLogs(logs);
+
+    size_t      replayed = 0;
+    for (map<Uint8, string>::const_iterator  k = logs.begin();
+            k != logs.end(); ++k) {
+        if (k->first < first_generation)
+            continue;   // Already in the snapshot
+
+        Uint8   generation = 0;
+        replayed += x_ReplayFile(k->second, false, generation, jobs);
+    }
+
+    m_Generation = first_generation;
+    if (!logs.empty() && logs.rbegin()->first > m_Generation)
+        m_Generation = logs.rbegin()->first;
+
+    // The replayed logs are merged into a new snapshot at the first
+    // opportunity so that they are not replayed again
+    m_ForceSnapshot = replayed > 0;
+    x_RemoveLogs(first_generation);
+    return m_Jobs.size();
+}
+
+
+bool CNSJobStore::Get(unsigned int  job_id,
+                      string &      job_rec,
+                      string &      info_rec) const
+{
+    if (s_Transaction != NULL && s_Transaction->m_Store == this) {
+        TJobChanges::const_iterator     changed =
+                                    s_Transaction->m_Changes.find(job_id);
+        if (changed != s_Transaction->m_Changes.end()) {
+            if (!changed->second.exists)
+                return false;
+            job_rec = changed->second.records.job;
+            info_rec = changed->second.records.info;
+            return true;
+        }
+    }
+
+    CFastMutexGuard                 guard(m_Lock);
+    TJobRecords::const_iterator     found = m_Jobs.find(job_id);
+
+    if (found == m_Jobs.end())
+        return false;
+    job_rec = found->second.job;
+    info_rec = found->second.info;
+    return true;
+}
+
+
+void CNSJobStore::PutJob(unsigned int    job_id,
+                         unsigned int    aff_id,
+                         unsigned int    group_id,
+                         const string &  job_rec,
+                         const string &  aff_token,
+                         const string &  group_token)
+{
+    string          data = s_MakeJobData(aff_id, group_id, job_rec,
+                                         aff_token, group_token);
+
+    if (s_Transaction != NULL && s_Transaction->m_Store == this) {
+        SJobChange &    change = x_GetChange(*s_Transaction, job_id);
+
+        change.exists = true;
+        change.job_dirty = true;
+        change.records.aff_id = aff_id;
+        change.records.group_id = group_id;
+        change.records.job = job_rec;
+        change.job_data.swap(data);
+        return;
+    }
+
+    CFastMutexGuard guard(m_Lock);
+    x_CheckWritable();
+
+    SJobRecords &   records = m_Jobs[job_id];
+
+    records.aff_id = aff_id;
+    records.group_id = group_id;
+    records.job = job_rec;
+    x_Append(eRecJob, job_id, data);
+}
+
+
+void CNSJobStore::PutInfo(unsigned int  job_id, const string &  info_rec)
+{
+    if (s_Transaction != NULL && s_Transaction->m_Store == this) {
+        SJobChange &    change = x_GetChange(*s_Transaction, job_id);
+
+        if (!change.exists) {
+            if (info_rec.empty())
+                return;
+            change.exists = true;
+        }
+        change.info_dirty = true;
+        change.records.info = info_rec;
+        return;
+    }
+
+    CFastMutexGuard         guard(m_Lock);
+    x_CheckWritable();
+
+    TJobRecords::iterator   found = m_Jobs.find(job_id);
+
+    if (found == m_Jobs.end()) {
+        if (info_rec.empty())
+            return;
+        found = m_Jobs.insert(TJobRecords::value_type(job_id,
+                                                      SJobRecords())).first;
+        found->second.aff_id = 0;
+        found->second.group_id = 0;
+    }
+    if (info_rec.empty())
+        string().swap(found->second.info);
+    else
+        found->second.info = info_rec;
+    x_Append(eRecInfo, job_id, info_rec);
+}
+
+
+void CNSJobStore::Erase(unsigned int  job_id)
+{
+    if (s_Transaction != NULL && s_Transaction->m_Store == this) {
+        SJobChange &    change = x_GetChange(*s_Transaction, job_id);
+
+        if (change.exists) {
+            change = SJobChange();
+            change.erased = true;
+        }
+        return;
+    }
+
+    CFastMutexGuard     guard(m_Lock);
+    x_CheckWritable();
+
+    if (m_Jobs.erase(job_id) > 0)
+        x_Append(eRecErase, job_id, kEmptyStr);
+}
+
+
+size_t CNSJobStore::GetJobCount(void) const
+{
+    CFastMutexGuard     guard(m_Lock);
+    return m_Jobs.size();
+}
+
+
+// Provides the job as the transaction sees it; the first access copies it
+// from the tables
+CNSJobStore::SJobChange &
+CNSJobStore::x_GetChange(CNSJobStoreTransaction &  trans,
+                         unsigned int              job_id)
+{
+    TJobChanges::iterator   changed = trans.m_Changes.find(job_id);
+    if (changed != trans.m_Changes.end())
+        return changed->second;
+
+    SJobChange &            change = trans.m_Changes[job_id];
+    CFastMutexGuard         guard(m_Lock);
+    TJobRecords::const_iterator     found = m_Jobs.find(job_id);
+
+    if (found != m_Jobs.end()) {
+        change.exists = true;
+        change.records = found->second;
+    }
+    return change;
+}
+
+
+void CNSJobStore::x_Commit(CNSJobStoreTransaction &  trans)
+{
+    Uint8       lsn;
+    {{
+        CFastMutexGuard     guard(m_Lock);
+        x_CheckWritable();
+
+        ITERATE(TJobChanges, k, trans.m_Changes) {
+            unsigned int        job_id = k->first;
+            const SJobChange &  change = k->second;
+
+            if (change.erased && m_Jobs.erase(job_id) > 0)
+                x_Append(eRecErase, job_id, kEmptyStr);
+            if (!change.exists ||
+                (!change.job_dirty && !change.info_dirty))
+                continue;
+
+            m_Jobs[job_id] = change.records;
+            if (change.job_dirty)
+                x_Append(eRecJob, job_id, change.job_data);
+            if (change.info_dirty)
+                x_Append(eRecInfo, job_id, change.records.info);
+        }
+        lsn = m_AppendedLSN;
+    }}
+    trans.m_Changes.clear();
+
+    if (!m_SyncCommits)
+        return;
+
+    if (s_CommitStore != NULL && s_CommitStore != this &&
+        !WaitForCommits()) {
+        NCBI_THROW(CFileException, eFileIO,
+                   "Jobs write-ahead log of another queue is not written");
+    }
+    s_CommitStore = this;
+    s_CommitLSN = lsn;
+}
+
+
+bool CNSJobStore::WaitForCommits(void)
+{
+    CNSJobStore *   store = s_CommitStore;
+    if (store == NULL)
+        return true;
+
+    s_CommitStore = NULL;
+    return store->x_WaitSynced(s_CommitLSN);
+}
+
+
+void CNSJobStore::CheckPoint(const CNSJobTokenResolver &  tokens)
+{
+    if (m_BaseName.empty())
+        return;
+
+    {{
+        CFastMutexGuard     log_guard(m_LogLock);
+        if (!m_ForceSnapshot) {
+            if (m_LogFD == -1)
+                return;     // Nothing has been logged
+            if (m_LogSize < m_SnapshotSize || m_LogSize < m_LastSnapshotSize)
+                return;
+        }
+    }}
+
+    x_WriteSnapshot(tokens);
+}
+
+
+// Must be called under m_Lock
+void CNSJobStore::x_CheckWritable(void) const
+{
+    if (m_WriteFailed)
+        NCBI_THROW(CFileException, eFileIO,
+                   "Jobs write-ahead log " + m_BaseName + " cannot be "
+                   "written. Job changes are refused.");
+}
+
+
+// Must be called under m_Lock
+void CNSJobStore::x_Append(unsigned char   type,
+                           unsigned int    job_id,
+                           const string &  data)
+{
+    if (m_Writer.IsNull())
+        x_StartWriter();
+
+    s_PutRecord(m_Pending, type, job_id, data);
+    ++m_AppendedLSN;
+    m_WriteCond.SignalSome();
+}
+
+
+// Must be called under m_LogLock
+void CNSJobStore::x_StartLog(void)
+{
+    map<Uint8, string>      logs;
+    x_ListLogs(logs);
+    if (!logs.empty() && logs.rbegin()->first > m_Generation)
+        m_Generation = logs.rbegin()->first;
+    ++m_Generation;
+
+    string      file_name = x_GetLogName(m_Generation);
+    int         fd = open(file_name.c_str(),
+                          O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    if (fd == -1)
+        NCBI_THROW(CFileErrnoException, eFile,
+                   "Cannot create " + file_name);
+
+    try {
+        string  header(kWALSignature, 8);
+        s_PutNum(header, m_Generation);
+        s_WriteAll(fd, header, file_name);
+        s_Sync(fd, file_name);
+        s_SyncDir(m_WALDirName);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+
+    m_LogFD = fd;
+    m_LogSize += kFileHeaderSize;
+}
+
+
+// Must be called under m_Lock
+void CNSJobStore::x_StartWriter(void)
+{
+    m_StopWriter = false;
+    m_Writer.Reset(new CNSJobStoreWriter(*this));
+    m_Writer->Run();
+}
+
+
+void CNSJobStore::x_StopWriter(void)
+{
+    CRef<CNSJobStoreWriter>     writer;
+
+    {{
+        CFastMutexGuard     guard(m_Lock);
+        if (m_Writer.IsNull())
+            return;
+        m_StopWriter = true;
+        writer = m_Writer;
+    }}
+
+    m_WriteCond.SignalAll();
+    writer->Join();
+
+    {{
+        CFastMutexGuard     guard(m_Lock);
+        m_Writer.Reset();
+        m_StopWriter = false;
+    }}
+    m_SyncedCond.SignalAll();
+}
+
+
+// One iteration of the writer thread. Returns false when the thread
+// should exit.
+bool CNSJobStore::x_WriteBuffer(void)
+{
+    {{
+        CFastMutexGuard     guard(m_Lock);
+        while (m_Pending.empty() && !m_StopWriter)
+            m_WriteCond.WaitForSignal(m_Lock);
+        if (m_Pending.empty())
+            return false;
+    }}
+
+    CFastMutexGuard     log_guard(m_LogLock);
+    Uint8               lsn;
+
+    {{
+        // Everything appended so far goes to the disk with one sync
+        CFastMutexGuard     guard(m_Lock);
+        m_WriteBuffer.clear();
+        m_WriteBuffer.swap(m_Pending);
+        lsn = m_AppendedLSN;
+    }}
+
+    // The buffer may have been written by a snapshot log switch
+    bool                written = m_WriteBuffer.empty() ||
+                                  x_WriteLog(m_WriteBuffer);
+
+    {{
+        CFastMutexGuard     guard(m_Lock);
+        if (written && lsn > m_SyncedLSN)
+            m_SyncedLSN = lsn;
+    }}
+    m_SyncedCond.SignalAll();
+    return true;
+}
+
+
+// Must be called under m_LogLock. Returns false if the data could not be
+// written.
+bool CNSJobStore::x_WriteLog(const string &  data)
+{
+    if (m_WriteFailed)
+        return false;
+
+    try {
+        if (m_LogFD == -1)
+            x_StartLog();
+
+        s_WriteAll(m_LogFD, data, x_GetLogName(m_Generation));
+        s_Sync(m_LogFD, x_GetLogName(m_Generation));
+        m_LogSize += data.size();
+        return true;
+    } catch (const exception &  ex) {
+        // A part of the data may be in the log, so nothing can be appended
+        // after it. The jobs are still served from memory but cannot be
+        // changed anymore: the changes would not survive a restart.
+        {{
+            CFastMutexGuard     guard(m_Lock);
+            m_WriteFailed = true;
+        }}
+        ERR_POST(Critical << "Error writing jobs write-ahead log "
+                          << m_BaseName << ": " << ex.what()
+                          << ". Job changes are refused from now on.");
+    }
+    return false;
+}
+
+
+// Returns false if the records could not be written
+bool CNSJobStore::x_WaitSynced(Uint8  lsn)
+{
+    CFastMutexGuard     guard(m_Lock);
+    while (m_SyncedLSN < lsn && m_Writer.NotNull() && !m_WriteFailed)
+        m_SyncedCond.WaitForSignal(m_Lock);
+    return m_SyncedLSN >= lsn;
+}
+
+
+void CNSJobStore::x_WriteSnapshot(const CNSJobTokenResolver &  tokens)
+{
+    CStopWatch      sw(CStopWatch::eStart);
+    Uint8           generation;
+
+    {{
+        // Flush what is pending to the current log and start a new one.
+        // Everything logged before the new log is in the snapshot.
+        CFastMutexGuard     log_guard(m_LogLock);
+        Uint8               lsn;
+
+        {{
+            CFastMutexGuard     guard(m_Lock);
+            m_WriteBuffer.clear();
+            m_WriteBuffer.swap(m_Pending);
+            lsn = m_AppendedLSN;
+        }}
+        bool                written = m_WriteBuffer.empty() ||
+                                      x_WriteLog(m_WriteBuffer);
+        {{
+            CFastMutexGuard     guard(m_Lock);
+            if (written && lsn > m_SyncedLSN)
+                m_SyncedLSN = lsn;
+        }}
+        m_SyncedCond.SignalAll();
+
+        if (m_WriteFailed)
+            return;
+
+        if (m_LogFD != -1) {
+            close(m_LogFD);
+            m_LogFD = -1;
+        }
+        m_LogSize = 0;
+        x_StartLog();
+        generation = m_Generation;
+        m_ForceSnapshot = false;
+    }}
+
+    string      snapshot_name = x_GetSnapshotName();
+    string      tmp_name = snapshot_name + ".tmp";
+    int         fd = open(tmp_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                          0644);
+    if (fd == -1)
+        NCBI_THROW(CFileErrnoException, eFile, "Cannot create " + tmp_name);
+
+    size_t      count = 0;
+    Uint8       snapshot_size = 0;
+    try {
+        string      buf(kSnapshotSignature, 8);
+        s_PutNum(buf, generation);
+
+        vector< pair<unsigned int, SJobRecords> >   chunk;
+        chunk.reserve(kSnapshotChunkSize);
+        for (unsigned int  last_id = 0; ; ) {
+            chunk.clear();
+            {{
+                CFastMutexGuard                 guard(m_Lock);
+                TJobRecords::const_iterator     k = count == 0 ?
+                                                m_Jobs.begin() :
+                                                m_Jobs.upper_bound(last_id);
+                for ( ; k != m_Jobs.end() &&
+                        chunk.size() < kSnapshotChunkSize; ++k)
+                    chunk.push_back(*k);
+            }}
+            if (chunk.empty())
+                break;
+
+            for (size_t  n = 0; n < chunk.size(); ++n) {
+                const SJobRecords &     records = chunk[n].second;
+                string                  group_token;
+
+                // The group may have gone if the job has been deleted
+                // after it was copied
+                if (records.group_id != 0)
+                    group_token = tokens.GetGroupToken(records.group_id);
+
+                s_PutRecord(buf, eRecJob, chunk[n].first,
+                            s_MakeJobData(records.aff_id, records.group_id,
+                                records.job,
+                                tokens.GetAffinityToken(records.aff_id),
+                                group_token));
+                if (!records.info.empty())
+                    s_PutRecord(buf, eRecInfo, chunk[n].first, records.info);
+                ++count;
+            }
+            last_id = chunk.back().first;
+
+            s_WriteAll(fd, buf, tmp_name);
+            snapshot_size += buf.size();
+            buf.clear();
+        }
+
+        string      count_data;
+        s_PutNum(count_data, Uint8(count));
+        s_PutRecord(buf, eRecSnapshotEnd, 0, count_data);
+        s_WriteAll(fd, buf, tmp_name);
+        snapshot_size += buf.size();
+        s_Sync(fd, tmp_name);
+    } catch (...) {
+        close(fd);
+        CFile(tmp_name).Remove();
+        throw;
+    }
+    close(fd);
+
+    if (rename(tmp_name.c_str(), snapshot_name.c_str()) != 0)
+        NCBI_THROW(CFileErrnoException, eFile,
+                   "Cannot rename " + tmp_name + " to " + snapshot_name);
+    s_SyncDir(m_WALDirName);
+
+    {{
+        CFastMutexGuard     log_guard(m_LogLock);
+        m_LastSnapshotSize = snapshot_size;
+    }}
+
+    x_RemoveLogs(generation);
+
+    LOG_POST(Note << "Jobs snapshot " << snapshot_name << " is written. Jobs: "
+                  << count << ", size: " << snapshot_size << ", time: "
+                  << sw.Elapsed() << " sec");
+}
+
+
+void CNSJobStore::x_RemoveLogs(Uint8  below_generation)
+{
+    map<Uint8, string>      logs;
+    x_ListLogs(logs);
+
+    for (map<Uint8, string>::const_iterator  k = logs.begin();
+            k != logs.end() && k->first < below_generation; ++k) {
+        try {
+            CFile(k->second).Remove();
+        } catch (const exception &  ex) {
+            ERR_POST("Error removing jobs write-ahead log " << k->second <<
+                     ": " << ex.what());
+        }
+    }
+}
+
+
+void CNSJobStore::x_ReplayRecord(unsigned char       type,
+                                 unsigned int        job_id,
+                                 const char *        data,
+                                 size_t              size,
+                                 TNSRestoredJobs &   jobs)
+{
+    switch (type) {
+    case eRecJob:
+        {
+            const char *    end = data + size;
+            if (size < 3 * sizeof(Uint4))
+                throw runtime_error("Malformed job record");
+
+            SJobRecords &       records = m_Jobs[job_id];
+            records.aff_id = s_GetNum<Uint4>(data);
+            records.group_id = s_GetNum<Uint4>(data + sizeof(Uint4));
+            data += 2 * sizeof(Uint4);
+
+            string      tokens[2];
+            for (size_t  n = 0; n < 2; ++n) {
+                if (size_t(end - data) < sizeof(Uint4))
+                    throw runtime_error("Malformed job record");
+                Uint4   token_size = s_GetNum<Uint4>(data);
+                data += sizeof(Uint4);
+                if (size_t(end - data) < token_size)
+                    throw runtime_error("Malformed job record");
+                tokens[n].assign(data, token_size);
+                data += token_size;
+            }
+            records.job.assign(data, end - data);
+
+            SNSRestoredJobTokens &  job_tokens = jobs[job_id];
+            job_tokens.affinity = tokens[0];
+            job_tokens.group = tokens[1];
+        }
+        break;
+    case eRecInfo:
+        {
+            TJobRecords::iterator   found = m_Jobs.find(job_id);
+            if (found != m_Jobs.end())
+                found->second.info.assign(data, size);
+        }
+        break;
+    case eRecErase:
+        m_Jobs.erase(job_id);
+        jobs.erase(job_id);
+        break;
+    default:
+        throw runtime_error("Unknown record type " +
+                            NStr::NumericToString(int(type)));
+    }
+}
+
+
+// Provides the number of replayed records
+size_t CNSJobStore::x_ReplayFile(const string &     file_name,
+                                 bool               is_snapshot,
+                                 Uint8 &            generation,
+                                 TNSRestoredJobs &  jobs)
+{
+    string          data = s_ReadWholeFile(file_name);
+    const char *    signature = is_snapshot ? kSnapshotSignature :
+                                              kWALSignature;
+
+    if (data.size() < kFileHeaderSize ||
+        memcmp(data.data(), signature, 8) != 0) {
+        if (is_snapshot)
+            throw runtime_error("Invalid jobs snapshot file " + file_name);
+        // The log creation has been interrupted
+        ERR_POST(Warning << "Invalid jobs write-ahead log header in " <<
+                 file_name << ". Ignore and continue.");
+        return 0;
+    }
+    generation = s_GetNum<Uint8>(data.data() + 8);
+
+    size_t      pos = kFileHeaderSize;
+    size_t      records = 0;
+    bool        complete = false;
+    try {
+        while (data.size() - pos >= kRecHeaderSize) {
+            const char *    header = data.data() + pos;
+            Uint4           size = s_GetNum<Uint4>(header);
+            Uint4           crc_value = s_GetNum<Uint4>(header + 4);
+            unsigned char   type = (unsigned char)header[8];
+            Uint4           job_id = s_GetNum<Uint4>(header + 9);
+
+            if (data.size() - pos - kRecHeaderSize < size)
+                break;
+
+            CChecksum       crc(CChecksum::eCRC32);
+            crc.AddChars(header + 8, 1 + sizeof(Uint4));
+            crc.AddChars(header + kRecHeaderSize, size);
+            if (crc.GetChecksum() != crc_value)
+                break;
+
+            if (type == eRecSnapshotEnd) {
+                complete = true;
+                pos += kRecHeaderSize + size;
+                break;
+            }
+            x_ReplayRecord(type, job_id, header + kRecHeaderSize, size, jobs);
+            pos += kRecHeaderSize + size;
+            ++records;
+        }
+    } catch (const exception &  ex) {
+        throw runtime_error("Error replaying " + file_name + ": " +
+                            ex.what());
+    }
+
+    if (is_snapshot) {
+        if (!complete)
+            throw runtime_error("Incomplete jobs snapshot file " + file_name);
+    } else if (pos != data.size()) {
+        // Torn write at the moment of a crash
+        ERR_POST(Warning << "Jobs write-ahead log " << file_name <<
+                 " is cut at offset " << pos << " of " << data.size() <<
+                 ". The rest is ignored.");
+    }
+    return records;
+}
+
+
+void CNSJobStore::x_ListLogs(map<Uint8, string> &  logs) const
+{
+    CDir        wal_dir(m_WALDirName);
+    if (!wal_dir.Exists())
+        return;
+
+    string      prefix = CFile(m_BaseName).GetName() + ".wal.";
+    CDir::TEntries      entries = wal_dir.GetEntries(prefix + "*",
+                                                     CDir::fIgnoreRecursive);
+    for (CDir::TEntries::const_iterator  k = entries.begin();
+            k != entries.end(); ++k) {
+        string  name = (*k)->GetName();
+        Uint8   generation = NStr::StringToUInt8(name.substr(prefix.size()),
+                                                 NStr::fConvErr_NoThrow);
+        if (generation != 0)
+            logs[generation] = (*k)->GetPath();
+    }
+}
+
+
+string CNSJobStore::x_GetLogName(Uint8  generation) const
+{
+    return m_BaseName + ".wal." + NStr::NumericToString(generation);
+}
+
+
+string CNSJobStore::x_GetSnapshotName(void) const
+{
+    return m_BaseName + ".snapshot";
+}
+
+
+
+CNSJobStoreTransaction::CNSJobStoreTransaction(CNSJobStore *  store)
+    : m_Store(NULL)
+{
+    if (store != NULL && s_Transaction == NULL) {
+        m_Store = store;
+        s_Transaction = this;
+    }
+}
+
+
+CNSJobStoreTransaction::~CNSJobStoreTransaction()
+{
+    Rollback();
+}
+
+
+void CNSJobStoreTransaction::Commit(void)
+{
+    if (m_Store == NULL)
+        return;
+
+    // The modifications are not collected anymore even if the commit
+    // fails
+    CNSJobStore *   store = m_Store;
+    m_Store = NULL;
+    s_Transaction = NULL;
+    store->x_Commit(*this);
+}
+
+
+void CNSJobStoreTransaction::Rollback(void)
+{
+    if (m_Store == NULL)
+        return;
+
+    m_Store = NULL;
+    s_Transaction = NULL;
+    m_Changes.clear();
+}
+
+
+END_NCBI_SCOPE
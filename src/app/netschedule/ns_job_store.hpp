@@ -0,0 +1,260 @@
+#ifndef NETSCHEDULE_JOB_STORE__HPP
+#define NETSCHEDULE_JOB_STORE__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   NetSchedule in-memory job tables with a write-ahead log
+ *
+ * Used instead of the Berkeley DB job tables when [bdb]/storage_engine is
+ * "memory". Each job is kept as two compact serialized records: the job
+ * record (what SJobDB and SEventsDB hold) and the job info record (long
+ * input/output, what SJobInfoDB holds). Every change is appended to the
+ * queue write-ahead log <WAL dir>/<QUEUE>.wal.<generation>. The log is
+ * written and fdatasync()'ed by a writer thread which takes everything
+ * accumulated since its previous write, so concurrent commits share one
+ * disk sync (group commit).
+ *
+ * When the log grows over the configured size a snapshot is written in the
+ * background: a new log generation is started and then the tables are
+ * copied to <QUEUE>.snapshot chunk by chunk without blocking the queue for
+ * long. Since the log records are full record images, replaying the new
+ * generation over such a fuzzy snapshot gives the exact state. Then the
+ * older generations are removed.
+ *
+ * If the log cannot be written the store refuses any further modification
+ * (an exception is thrown) till it is reopened, and the commits waiting for
+ * the disk are reported as failed.
+ */
+
+
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbithr.hpp>
+#include <string>
+#include <map>
+
+
+BEGIN_NCBI_SCOPE
+
+using namespace std;
+
+
+class CNSJobStoreWriter;
+class CNSJobStoreTransaction;
+
+
+// Affinity and group tokens of a job restored from the disk. The IDs in
+// the restored job records are not valid in the new server instance; the
+// tokens are used to register the jobs with the new IDs.
+struct SNSRestoredJobTokens
+{
+    string      affinity;
+    string      group;
+};
+typedef map<unsigned int, SNSRestoredJobTokens>     TNSRestoredJobs;
+
+
+// Provides the current affinity and group tokens of the jobs written to a
+// snapshot
+class CNSJobTokenResolver
+{
+    public:
+        virtual ~CNSJobTokenResolver() {}
+        virtual string GetAffinityToken(unsigned int  aff_id) const = 0;
+        // An empty string if the group has gone
+        virtual string GetGroupToken(unsigned int  group_id) const = 0;
+};
+
+
+class CNSJobStore
+{
+    public:
+        CNSJobStore(const string &  wal_dir_name,
+                    bool            sync_commits,
+                    Uint8           snapshot_size);
+        ~CNSJobStore();
+
+        // Binds the store to the queue files. Drops whatever is in memory;
+        // the disk files are not touched.
+        void Open(const string &  qname);
+
+        // Loads the queue snapshot and replays the log. The tokens of all
+        // the loaded jobs are provided. Must be called before any
+        // modification. Throws an exception if the files are unreadable.
+        size_t Restore(TNSRestoredJobs &  jobs);
+
+        // Stops the writer and clears the tables; the files are removed if
+        // required
+        void Close(bool  remove_files);
+
+        // The modifications made by a thread which has a transaction
+        // started (see CNSJobStoreTransaction) are visible to that thread
+        // only till the transaction is committed. Otherwise they are
+        // committed immediately. The modifications throw an exception if
+        // the log could not be written earlier.
+        bool Get(unsigned int  job_id,
+                 string &      job_rec,
+                 string &      info_rec) const;
+        void PutJob(unsigned int    job_id,
+                    unsigned int    aff_id,
+                    unsigned int    group_id,
+                    const string &  job_rec,
+                    const string &  aff_token,
+                    const string &  group_token);
+        // An empty info record removes it
+        void PutInfo(unsigned int  job_id, const string &  info_rec);
+        void Erase(unsigned int  job_id);
+        size_t GetJobCount(void) const;
+
+        // Waits till the records committed by the current thread are on
+        // the disk. It is called before sending a response to a client,
+        // i.e. out of any queue locks. Returns false if the records could
+        // not be written, i.e. the changes are not durable.
+        static bool WaitForCommits(void);
+
+        // Writes a snapshot if the log has grown enough since the last one
+        void CheckPoint(const CNSJobTokenResolver &  tokens);
+
+    private:
+        friend class CNSJobStoreWriter;
+        friend class CNSJobStoreTransaction;
+
+        struct SJobRecords
+        {
+            unsigned int    aff_id;
+            unsigned int    group_id;
+            string          job;
+            string          info;
+
+            SJobRecords() : aff_id(0), group_id(0)
+            {}
+        };
+        typedef map<unsigned int, SJobRecords>  TJobRecords;
+
+        // A job as a transaction sees it
+        struct SJobChange
+        {
+            bool            exists;
+            bool            erased;     // Erased before it was (re)put
+            bool            job_dirty;
+            bool            info_dirty;
+            SJobRecords     records;
+            string          job_data;   // eRecJob log record data
+
+            SJobChange() :
+                exists(false), erased(false),
+                job_dirty(false), info_dirty(false)
+            {}
+        };
+        typedef map<unsigned int, SJobChange>   TJobChanges;
+
+        SJobChange & x_GetChange(CNSJobStoreTransaction &  trans,
+                                 unsigned int  job_id);
+        void x_Commit(CNSJobStoreTransaction &  trans);
+        void x_CheckWritable(void) const;
+        void x_Append(unsigned char  type, unsigned int  job_id,
+                      const string &  data);
+        void x_StartLog(void);
+        void x_StartWriter(void);
+        void x_StopWriter(void);
+        bool x_WriteBuffer(void);
+        bool x_WriteLog(const string &  data);
+        bool x_WaitSynced(Uint8  lsn);
+        void x_WriteSnapshot(const CNSJobTokenResolver &  tokens);
+        void x_RemoveLogs(Uint8  below_generation);
+        void x_ReplayRecord(unsigned char  type, unsigned int  job_id,
+                            const char *  data, size_t  size,
+                            TNSRestoredJobs &  jobs);
+        size_t x_ReplayFile(const string &  file_name, bool  is_snapshot,
+                            Uint8 &  generation, TNSRestoredJobs &  jobs);
+        void x_ListLogs(map<Uint8, string> &  logs) const;
+        string x_GetLogName(Uint8  generation) const;
+        string x_GetSnapshotName(void) const;
+
+    private:
+        string                  m_WALDirName;
+        bool                    m_SyncCommits;
+        Uint8                   m_SnapshotSize;
+        string                  m_BaseName;     // <WAL dir>/<QUEUE>
+
+        // The tables and the not yet written log data
+        mutable CFastMutex      m_Lock;
+        TJobRecords             m_Jobs;
+        string                  m_Pending;
+        Uint8                   m_AppendedLSN;  // Records appended so far
+        Uint8                   m_SyncedLSN;    // Records on the disk
+        bool                    m_WriteFailed;  // Also under m_LogLock
+        CConditionVariable      m_WriteCond;    // New data to write
+        CConditionVariable      m_SyncedCond;   // m_SyncedLSN advanced
+        bool                    m_StopWriter;
+        CRef<CNSJobStoreWriter> m_Writer;
+
+        // Held while the log file is written or switched
+        CFastMutex              m_LogLock;
+        int                     m_LogFD;
+        string                  m_WriteBuffer;
+        Uint8                   m_Generation;
+        Uint8                   m_LogSize;      // Since the last snapshot
+        Uint8                   m_LastSnapshotSize;
+        bool                    m_ForceSnapshot;
+};
+
+
+// Collects the job store modifications made by the current thread. They
+// are applied to the tables and logged at once when the transaction is
+// committed and dropped otherwise. The transactions are not isolated from
+// each other: the callers serialize the access to a job, as they do for
+// Berkeley DB.
+class CNSJobStoreTransaction
+{
+    public:
+        // Nothing is collected if the store is NULL. A transaction started
+        // while another one is active on the same thread joins it.
+        CNSJobStoreTransaction(CNSJobStore *  store);
+        // Rolls back if not committed
+        ~CNSJobStoreTransaction();
+
+        // In the sync mode the current thread response is postponed till
+        // the transaction records are on the disk (see
+        // CNSJobStore::WaitForCommits()). Throws an exception and drops the
+        // changes if the log could not be written earlier.
+        void Commit(void);
+        void Rollback(void);
+
+    private:
+        CNSJobStoreTransaction(const CNSJobStoreTransaction &);
+        CNSJobStoreTransaction & operator=(const CNSJobStoreTransaction &);
+
+        friend class CNSJobStore;
+
+        CNSJobStore *               m_Store;    // NULL if not active
+        CNSJobStore::TJobChanges    m_Changes;
+};
+
+
+END_NCBI_SCOPE
+
+#endif /* NETSCHEDULE_JOB_STORE__HPP */
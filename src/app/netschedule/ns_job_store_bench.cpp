@@ -0,0 +1,307 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Commit throughput of the NetSchedule job tables: the in-memory job
+ *   store with its write-ahead log against a transactional Berkeley DB
+ *   table (when the toolkit is configured with Berkeley DB). Each thread
+ *   writes new job records, one per transaction, and waits for every
+ *   commit to be durable if -sync is given, as a server reply does.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbitime.hpp>
+
+#ifdef HAVE_BERKELEY_DB
+#  include <db/bdb/bdb_env.hpp>
+#  include <db/bdb/bdb_file.hpp>
+#  include <db/bdb/bdb_trans.hpp>
+#endif
+
+#include "ns_job_store.hpp"
+
+
+USING_NCBI_SCOPE;
+
+
+// Writes the records of its own range of job IDs
+class CBenchThread : public CThread
+{
+public:
+    CBenchThread(unsigned int  first_id, unsigned int  count,
+                 const string &  record)
+        : m_FirstId(first_id), m_Count(count), m_Record(record)
+    {}
+
+protected:
+    unsigned int    m_FirstId;
+    unsigned int    m_Count;
+    const string &  m_Record;
+};
+
+
+class CStoreBenchThread : public CBenchThread
+{
+public:
+    CStoreBenchThread(CNSJobStore &  store, unsigned int  first_id,
+                      unsigned int  count, const string &  record)
+        : CBenchThread(first_id, count, record), m_Store(store)
+    {}
+
+protected:
+    virtual void *  Main(void)
+    {
+        for (unsigned int  id = m_FirstId; id < m_FirstId + m_Count; ++id) {
+            CNSJobStoreTransaction  transaction(&m_Store);
+            m_Store.PutJob(id, 0, 0, m_Record, kEmptyStr, kEmptyStr);
+            transaction.Commit();
+            CNSJobStore::WaitForCommits();
+        }
+        return NULL;
+    }
+
+private:
+    CNSJobStore &   m_Store;
+};
+
+
+#ifdef HAVE_BERKELEY_DB
+struct SBenchDB : public CBDB_File
+{
+    CBDB_FieldUint4     id;
+    CBDB_FieldLString   data;
+
+    SBenchDB()
+    {
+        BindKey("id", &id);
+        BindData("data", &data, 64 * 1024);
+    }
+};
+
+
+class CBDBBenchThread : public CBenchThread
+{
+public:
+    CBDBBenchThread(CBDB_Env &  env, const string &  file_name,
+                    unsigned int  first_id, unsigned int  count,
+                    const string &  record)
+        : CBenchThread(first_id, count, record),
+          m_Env(env), m_FileName(file_name)
+    {}
+
+protected:
+    virtual void *  Main(void)
+    {
+        SBenchDB    db;
+        db.SetEnv(m_Env);
+        db.Open(m_FileName, CBDB_RawFile::eReadWrite);
+
+        for (unsigned int  id = m_FirstId; id < m_FirstId + m_Count; ++id) {
+            CBDB_Transaction    transaction(m_Env,
+                                            CBDB_Transaction::eEnvDefault,
+                                            CBDB_Transaction::eNoAssociation);
+            db.SetTransaction(&transaction);
+            db.id = id;
+            db.data = m_Record;
+            db.UpdateInsert();
+            transaction.Commit();
+        }
+        db.SetTransaction(NULL);
+        return NULL;
+    }
+
+private:
+    CBDB_Env &      m_Env;
+    string          m_FileName;
+};
+#endif
+
+
+class CJobStoreBenchApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run(void);
+
+private:
+    double x_RunStore(const string &  dir, unsigned int  threads,
+                      unsigned int  count, const string &  record);
+#ifdef HAVE_BERKELEY_DB
+    double x_RunBDB(const string &  dir, unsigned int  threads,
+                    unsigned int  count, const string &  record);
+#endif
+};
+
+
+void CJobStoreBenchApp::Init(void)
+{
+    auto_ptr<CArgDescriptions>  arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "NetSchedule job tables commit throughput");
+    arg_desc->AddDefaultKey("dir", "path",
+                            "Directory for the database files",
+                            CArgDescriptions::eString, ".");
+    arg_desc->AddDefaultKey("engine", "name",
+                            "Storage engine to measure",
+                            CArgDescriptions::eString, "all");
+    arg_desc->SetConstraint("engine",
+                            &(*new CArgAllow_Strings, "all", "memory", "bdb"));
+    arg_desc->AddDefaultKey("threads", "number",
+                            "Number of writing threads",
+                            CArgDescriptions::eInteger, "8");
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(1, 1000));
+    arg_desc->AddDefaultKey("jobs", "number",
+                            "Number of jobs written by each thread",
+                            CArgDescriptions::eInteger, "2000");
+    arg_desc->SetConstraint("jobs", new CArgAllow_Integers(1, 10000000));
+    arg_desc->AddDefaultKey("size", "bytes",
+                            "Job record size",
+                            CArgDescriptions::eInteger, "256");
+    arg_desc->SetConstraint("size", new CArgAllow_Integers(1, 64 * 1024));
+    arg_desc->AddFlag("sync", "Wait for each commit to be on the disk");
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+int CJobStoreBenchApp::Run(void)
+{
+    const CArgs &   args = GetArgs();
+    string          engine = args["engine"].AsString();
+    unsigned int    threads = args["threads"].AsInteger();
+    unsigned int    count = args["jobs"].AsInteger();
+    string          record(args["size"].AsInteger(), 'j');
+    string          dir = CDirEntry::ConcatPath(args["dir"].AsString(),
+                                                "ns_job_store_bench");
+    double          total = double(threads) * count;
+
+    if (engine == "all" || engine == "memory") {
+        double  elapsed = x_RunStore(dir, threads, count, record);
+        NcbiCout << "memory: " << total / elapsed << " commits/sec ("
+                 << elapsed << " sec)" << NcbiEndl;
+    }
+#ifdef HAVE_BERKELEY_DB
+    if (engine == "all" || engine == "bdb") {
+        double  elapsed = x_RunBDB(dir, threads, count, record);
+        NcbiCout << "bdb: " << total / elapsed << " commits/sec ("
+                 << elapsed << " sec)" << NcbiEndl;
+    }
+#else
+    if (engine == "bdb") {
+        ERR_POST("The toolkit is configured without Berkeley DB");
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+
+double CJobStoreBenchApp::x_RunStore(const string &  dir,
+                                     unsigned int    threads,
+                                     unsigned int    count,
+                                     const string &  record)
+{
+    CDir(dir).Remove();
+    CDir(dir).CreatePath();
+
+    CNSJobStore         store(dir, GetArgs()["sync"], kMax_UI8);
+    TNSRestoredJobs     jobs;
+    store.Open("bench");
+    store.Restore(jobs);
+
+    vector< CRef<CThread> >     workers;
+    CStopWatch                  sw(CStopWatch::eStart);
+    for (unsigned int  n = 0; n < threads; ++n) {
+        workers.push_back(CRef<CThread>(
+                new CStoreBenchThread(store, n * count + 1, count, record)));
+        workers.back()->Run();
+    }
+    NON_CONST_ITERATE(vector< CRef<CThread> >, k, workers) {
+        (*k)->Join();
+    }
+    double      elapsed = sw.Elapsed();
+
+    store.Close(true);
+    CDir(dir).Remove();
+    return elapsed;
+}
+
+
+#ifdef HAVE_BERKELEY_DB
+double CJobStoreBenchApp::x_RunBDB(const string &  dir,
+                                   unsigned int    threads,
+                                   unsigned int    count,
+                                   const string &  record)
+{
+    CDir(dir).Remove();
+    CDir(dir).CreatePath();
+
+    double      elapsed;
+    {{
+        CBDB_Env    env;
+        env.SetLogFileMax(200 * 1024 * 1024);
+        env.SetLogAutoRemove(true);
+        env.SetTransactionSync(GetArgs()["sync"] ?
+                                    CBDB_Transaction::eTransSync :
+                                    CBDB_Transaction::eTransASync);
+        env.OpenWithTrans(CDirEntry::AddTrailingPathSeparator(dir),
+                          CBDB_Env::eThreaded);
+
+        string      file_name = "bench.db";
+        {{
+            SBenchDB    db;
+            db.SetEnv(env);
+            db.Open(file_name, CBDB_RawFile::eReadWriteCreate);
+        }}
+
+        vector< CRef<CThread> >     workers;
+        CStopWatch                  sw(CStopWatch::eStart);
+        for (unsigned int  n = 0; n < threads; ++n) {
+            workers.push_back(CRef<CThread>(
+                    new CBDBBenchThread(env, file_name,
+                                        n * count + 1, count, record)));
+            workers.back()->Run();
+        }
+        NON_CONST_ITERATE(vector< CRef<CThread> >, k, workers) {
+            (*k)->Join();
+        }
+        elapsed = sw.Elapsed();
+    }}
+
+    CDir(dir).Remove();
+    return elapsed;
+}
+#endif
+
+
+int main(int argc, const char *  argv[])
+{
+    return CJobStoreBenchApp().AppMain(argc, argv);
+}
@@ -124,6 +124,8 @@ CQueue::CQueue(CRequestExecutor&     executor,
     m_NotifHifreqInterval(default_notif_hifreq_interval), // 0.1 sec
     m_NotifHifreqPeriod(default_notif_hifreq_period),
     m_NotifLofreqMult(default_notif_lofreq_mult),
+    m_DeferredNotifNoAffJobs(false),
+    m_DeferredNotifInProgress(false),
     m_DumpBufferSize(default_dump_buffer_size),
     m_DumpClientBufferSize(default_dump_client_buffer_size),
     m_DumpAffBufferSize(default_dump_aff_buffer_size),
@@ -166,6 +168,8 @@ void CQueue::Attach(SQueueDbBlock* block)
 {
     x_Detach();
     m_QueueDbBlock = block;
+    if (m_QueueDbBlock->job_store)
+        m_QueueDbBlock->job_store->Open(m_QueueName);
 
     // Here we have a db, so we can read the counter value we should start from
     m_LastId = m_Server->GetJobsStartID(m_QueueName);
@@ -511,8 +515,9 @@ unsigned int  CQueue::Submit(const CNSClientId &        client,
 
     // Take the queue lock and start the operation
     {{
-        string              scope = client.GetScope();
-        CFastMutexGuard     guard(m_OperationLock);
+        x_SDeferredGetNotifier  notifier(*this);
+        string                  scope = client.GetScope();
+        CFastMutexGuard         guard(m_OperationLock);
 
 
         if (!scope.empty()) {
@@ -566,14 +571,14 @@ unsigned int  CQueue::Submit(const CNSClientId &        client,
         m_ClientsRegistry.AddToSubmitted(client, 1);
 
         // Make the decision whether to send or not a notification
-        if (m_PauseStatus == eNoPause)
-            m_NotificationsList.Notify(job_id, aff_id,
-                                       m_ClientsRegistry,
-                                       m_AffinityRegistry,
-                                       m_GroupRegistry,
-                                       m_NotifHifreqPeriod,
-                                       m_HandicapTimeout,
-                                       eGet);
+        if (m_PauseStatus == eNoPause) {
+            TNSBitVector    jobs;
+            TNSBitVector    affinities;
+            jobs.set_bit(job_id);
+            if (aff_id != 0)
+                affinities.set_bit(aff_id);
+            x_DeferGetNotification(jobs, affinities, aff_id == 0);
+        }
 
         m_GCRegistry.RegisterJob(job_id, op_begin_time,
                                  aff_id, group_id,
@@ -614,10 +619,11 @@ CQueue::SubmitBatch(const CNSClientId &             client,
     CNSPreciseTime  curr_time = CNSPreciseTime::Current();
 
     {{
-        unsigned int        job_id_cnt = job_id;
-        unsigned int        group_id = 0;
-        vector<string>      aff_tokens;
-        string              scope = client.GetScope();
+        x_SDeferredGetNotifier  notifier(*this);
+        unsigned int            job_id_cnt = job_id;
+        unsigned int            group_id = 0;
+        vector<string>          aff_tokens;
+        string                  scope = client.GetScope();
 
         // Count the number of affinities
         for (size_t  k = 0; k < batch_size; ++k) {
@@ -706,14 +712,8 @@ CQueue::SubmitBatch(const CNSClientId &             client,
         jobs.set_range(job_id, job_id + batch_size - 1);
 
         if (m_PauseStatus == eNoPause)
-            m_NotificationsList.Notify(jobs, affinities,
-                                       batch_size != aff_tokens.size(),
-                                       m_ClientsRegistry,
-                                       m_AffinityRegistry,
-                                       m_GroupRegistry,
-                                       m_NotifHifreqPeriod,
-                                       m_HandicapTimeout,
-                                       eGet);
+            x_DeferGetNotification(jobs, affinities,
+                                   batch_size != aff_tokens.size());
 
         for (size_t  k = 0; k < batch_size; ++k) {
             m_GCRegistry.RegisterJob(
@@ -2772,6 +2772,64 @@ void CQueue::OptimizeMem()
 }
 
 
+// Must be called under the operation lock
+void CQueue::x_DeferGetNotification(const TNSBitVector &  jobs,
+                                    const TNSBitVector &  affinities,
+                                    bool                  no_aff_jobs)
+{
+    CFastMutexGuard     guard(m_DeferredNotifLock);
+
+    m_DeferredNotifJobs |= jobs;
+    m_DeferredNotifAffs |= affinities;
+    m_DeferredNotifNoAffJobs = m_DeferredNotifNoAffJobs || no_aff_jobs;
+}
+
+
+// Must be called out of the operation lock. If another thread is sending
+// the notifications at the moment then it will also send what has been
+// collected by this one.
+void CQueue::x_SendDeferredGetNotifications(void)
+{
+    for (;;) {
+        TNSBitVector    jobs;
+        TNSBitVector    affinities;
+        bool            no_aff_jobs;
+
+        {{
+            CFastMutexGuard     guard(m_DeferredNotifLock);
+
+            if (m_DeferredNotifInProgress || !m_DeferredNotifJobs.any())
+                return;
+
+            m_DeferredNotifInProgress = true;
+            jobs.swap(m_DeferredNotifJobs);
+            affinities.swap(m_DeferredNotifAffs);
+            no_aff_jobs = m_DeferredNotifNoAffJobs;
+            m_DeferredNotifNoAffJobs = false;
+        }}
+
+        try {
+            m_NotificationsList.Notify(jobs, affinities, no_aff_jobs,
+                                       m_ClientsRegistry,
+                                       m_AffinityRegistry,
+                                       m_GroupRegistry,
+                                       m_NotifHifreqPeriod,
+                                       m_HandicapTimeout,
+                                       eGet);
+        } catch (const exception &  ex) {
+            ERR_POST("Error sending vacant job notifications: " << ex.what());
+        } catch (...) {
+            ERR_POST("Unknown error sending vacant job notifications");
+        }
+
+        {{
+            CFastMutexGuard     guard(m_DeferredNotifLock);
+            m_DeferredNotifInProgress = false;
+        }}
+    }
+}
+
+
 CQueue::x_SJobPick
 CQueue::x_FindVacantJob(const CNSClientId  &          client,
                         const TNSBitVector &          explicit_affs,
@@ -2786,108 +2844,83 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
 {
     bool            explicit_aff = !aff_ids.empty();
     bool            effective_use_pref_affinity = use_pref_affinity;
-    unsigned int    pref_aff_candidate_job_id = 0;
-    unsigned int    exclusive_aff_candidate = 0;
-    string          scope = client.GetScope();
 
     TNSBitVector    pref_aff = m_ClientsRegistry.GetPreferredAffinities(
                                                     client, cmd_group);
     if (use_pref_affinity)
         effective_use_pref_affinity = use_pref_affinity && pref_aff.any();
 
-    if (explicit_aff || effective_use_pref_affinity || exclusive_new_affinity) {
-        // Check all vacant jobs: pending jobs for eGet,
-        //                        done/failed/cancel jobs for eRead
-        TNSBitVector    vacant_jobs;
-        if (cmd_group == eGet)
-            m_StatusTracker.GetJobs(CNetScheduleAPI::ePending, vacant_jobs);
-        else
-            m_StatusTracker.GetJobs(m_StatesForRead, vacant_jobs);
-
-        if (scope.empty() || scope == kNoScopeOnly) {
-            // Both these cases should consider only the non-scope jobs
-            vacant_jobs -= m_ScopeRegistry.GetAllJobsInScopes();
-        } else {
-            // Consider only the jobs in the particular scope
-            vacant_jobs &= m_ScopeRegistry.GetJobs(scope);
-        }
-
-        // Exclude blacklisted jobs
-        m_ClientsRegistry.SubtractBlacklistedJobs(client, cmd_group,
-                                                  vacant_jobs);
-        // Keep only the group jobs if the groups are provided
-        if (has_groups)
-            m_GroupRegistry.RestrictByGroup(group_ids, vacant_jobs);
-
-        // Exclude jobs which have been read or in a process of reading
-        if (cmd_group == eRead)
-            vacant_jobs -= m_ReadJobs;
-
-        if (prioritized_aff) {
-            // The criteria here is a list of explicit affinities
-            // (respecting their order) which may be followed by any affinity
-            for (vector<unsigned int>::const_iterator  k = aff_ids.begin();
-                    k != aff_ids.end(); ++k) {
-                TNSBitVector    aff_jobs = m_AffinityRegistry.
+    // The affinity registry keeps the jobs of each affinity so the
+    // candidates are taken from there and only then checked against the
+    // vacant jobs. This way the cost does not depend on the number of
+    // vacant jobs in the queue.
+    if (prioritized_aff &&
+        (explicit_aff || effective_use_pref_affinity ||
+         exclusive_new_affinity)) {
+        // The criteria here is a list of explicit affinities
+        // (respecting their order) which may be followed by any affinity
+        for (vector<unsigned int>::const_iterator  k = aff_ids.begin();
+                k != aff_ids.end(); ++k) {
+            TNSBitVector    candidates = m_AffinityRegistry.
                                                     GetJobsWithAffinity(*k);
-                TNSBitVector    candidates = vacant_jobs & aff_jobs;
-                if (candidates.any())
-                    return x_SJobPick(*(candidates.first()), false, *k);
-            }
-            if (any_affinity) {
-                if (vacant_jobs.any()) {
-                    unsigned int    job_id = *(vacant_jobs.first());
-                    return x_SJobPick(job_id, false,
-                                      m_GCRegistry.GetAffinityID(job_id));
-                }
-            }
-            return x_SJobPick();
+            x_RestrictToVacantJobs(client, group_ids, has_groups, cmd_group,
+                                   candidates);
+            if (candidates.any())
+                return x_SJobPick(*(candidates.first()), false, *k);
         }
+        if (any_affinity) {
+            TNSBitVector    no_unwanted_jobs;
+            unsigned int    job_id = x_GetFirstVacantJob(client, group_ids,
+                                                         has_groups, cmd_group,
+                                                         no_unwanted_jobs);
+            if (job_id != 0)
+                return x_SJobPick(job_id, false,
+                                  m_GCRegistry.GetAffinityID(job_id));
+        }
+        return x_SJobPick();
+    }
 
-        // HERE: no prioritized affinities
-        TNSBitVector    all_pref_aff;
-        if (exclusive_new_affinity)
-            all_pref_aff = m_ClientsRegistry.GetAllPreferredAffinities(
-                                                                    cmd_group);
-
-        TNSBitVector::enumerator    en(vacant_jobs.first());
-        for (; en.valid(); ++en) {
-            unsigned int    job_id = *en;
-
-            unsigned int    aff_id = m_GCRegistry.GetAffinityID(job_id);
-            if (aff_id != 0 && explicit_aff) {
-                if (explicit_affs.get_bit(aff_id))
-                    return x_SJobPick(job_id, false, aff_id);
-            }
-
-            if (aff_id != 0 && effective_use_pref_affinity) {
-                if (pref_aff.get_bit(aff_id)) {
-                    if (explicit_aff == false)
-                        return x_SJobPick(job_id, false, aff_id);
-                    if (pref_aff_candidate_job_id == 0)
-                        pref_aff_candidate_job_id = job_id;
-                    continue;
-                }
-            }
-
-            if (exclusive_new_affinity) {
-                if (aff_id == 0 || all_pref_aff.get_bit(aff_id) == false) {
-                    if (explicit_aff == false &&
-                        effective_use_pref_affinity == false)
-                        return x_SJobPick(job_id, true, aff_id);
-                    if (exclusive_aff_candidate == 0)
-                        exclusive_aff_candidate = job_id;
-                }
-            }
-        } // end for
+    // HERE: no prioritized affinities.
+    // A job with an explicit affinity goes first, then a job with a
+    // preferred affinity and then (for an exclusive new affinity) a job
+    // with an affinity nobody has as preferred or without affinity at all.
+    if (explicit_aff) {
+        TNSBitVector    candidates = m_AffinityRegistry.
+                                        GetJobsWithAffinities(explicit_affs);
+        x_RestrictToVacantJobs(client, group_ids, has_groups, cmd_group,
+                               candidates);
+        if (candidates.any()) {
+            unsigned int    job_id = *(candidates.first());
+            return x_SJobPick(job_id, false,
+                              m_GCRegistry.GetAffinityID(job_id));
+        }
+    }
 
-        if (pref_aff_candidate_job_id != 0)
-            return x_SJobPick(pref_aff_candidate_job_id, false, 0);
+    if (effective_use_pref_affinity) {
+        TNSBitVector    candidates = m_AffinityRegistry.
+                                        GetJobsWithAffinities(pref_aff);
+        x_RestrictToVacantJobs(client, group_ids, has_groups, cmd_group,
+                               candidates);
+        if (candidates.any()) {
+            unsigned int    job_id = *(candidates.first());
+            if (explicit_aff)
+                return x_SJobPick(job_id, false, 0);
+            return x_SJobPick(job_id, false,
+                              m_GCRegistry.GetAffinityID(job_id));
+        }
+    }
 
-        if (exclusive_aff_candidate != 0)
-            return x_SJobPick(exclusive_aff_candidate, true,
-                              m_GCRegistry.GetAffinityID(
-                                                    exclusive_aff_candidate));
+    if (exclusive_new_affinity) {
+        TNSBitVector    all_pref_aff = m_ClientsRegistry.
+                                        GetAllPreferredAffinities(cmd_group);
+        TNSBitVector    unwanted_jobs = m_AffinityRegistry.
+                                        GetJobsWithAffinities(all_pref_aff);
+        unsigned int    job_id = x_GetFirstVacantJob(client, group_ids,
+                                                     has_groups, cmd_group,
+                                                     unwanted_jobs);
+        if (job_id != 0)
+            return x_SJobPick(job_id, true,
+                              m_GCRegistry.GetAffinityID(job_id));
     }
 
     // The second condition looks strange and it covers a very specific
@@ -2900,86 +2933,117 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
          use_pref_affinity && !effective_use_pref_affinity &&
          !exclusive_new_affinity &&
          cmd_group == eGet)) {
+        TNSBitVector    no_unwanted_jobs;
+        return x_SJobPick(x_GetFirstVacantJob(client, group_ids, has_groups,
+                                              cmd_group, no_unwanted_jobs),
+                          false, 0);
+    }
 
-        TNSBitVector    jobs_in_scope;
-        TNSBitVector    restricted_jobs;
-        bool            no_scope_only = scope.empty() ||
-                                        scope == kNoScopeOnly;
-        unsigned int    job_id = 0;
-
-        if (no_scope_only)
-            jobs_in_scope = m_ScopeRegistry.GetAllJobsInScopes();
-        else {
-            restricted_jobs = m_ScopeRegistry.GetJobs(scope);
-            if (has_groups)
-                m_GroupRegistry.RestrictByGroup(group_ids, restricted_jobs);
-        }
+    return x_SJobPick();
+}
 
-        if (cmd_group == eGet) {
-            if (no_scope_only) {
-                // only the jobs which are not in the scope
-
-                // NOTE: this only to avoid an expensive temporary bvector
-                m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
-                                                     jobs_in_scope);
-                if (has_groups)
-                    job_id = m_StatusTracker.GetJobByStatus(
-                                                CNetScheduleAPI::ePending,
-                                                jobs_in_scope,
-                                                m_GroupRegistry.GetJobs(group_ids),
-                                                has_groups);
-                else
-                    job_id = m_StatusTracker.GetJobByStatus(
-                                                CNetScheduleAPI::ePending,
-                                                jobs_in_scope,
-                                                kEmptyBitVector,
-                                                false);
-            } else {
-                // only the specific scope jobs
-                m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
-                                                     jobs_in_scope);
-                job_id = m_StatusTracker.GetJobByStatus(
-                                            CNetScheduleAPI::ePending,
-                                            jobs_in_scope,
-                                            restricted_jobs, true);
-            }
-        } else {
-            if (no_scope_only) {
-                // only the jobs which are not in the scope
-
-                // NOTE: this only to avoid an expensive temporary bvector
-                jobs_in_scope |= m_ReadJobs;
-                m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
-                                                     jobs_in_scope);
-                if (has_groups)
-                    job_id = m_StatusTracker.GetJobByStatus(
+
+// Leaves only the jobs which the client may get (or read) right now:
+// pending jobs for eGet, done/failed/cancel jobs for eRead; the scope,
+// the blacklist, the groups and the jobs being read are respected.
+void CQueue::x_RestrictToVacantJobs(const CNSClientId &   client,
+                                    const TNSBitVector &  group_ids,
+                                    bool                  has_groups,
+                                    ECommandGroup         cmd_group,
+                                    TNSBitVector &        jobs)
+{
+    if (!jobs.any())
+        return;
+
+    if (cmd_group == eGet)
+        m_StatusTracker.RestrictByStatus(CNetScheduleAPI::ePending, jobs);
+    else
+        m_StatusTracker.RestrictByStatus(m_StatesForRead, jobs);
+    if (!jobs.any())
+        return;
+
+    string      scope = client.GetScope();
+    if (scope.empty() || scope == kNoScopeOnly) {
+        // Both these cases should consider only the non-scope jobs
+        jobs -= m_ScopeRegistry.GetAllJobsInScopes();
+    } else {
+        // Consider only the jobs in the particular scope
+        jobs &= m_ScopeRegistry.GetJobs(scope);
+    }
+
+    // Exclude blacklisted jobs
+    m_ClientsRegistry.SubtractBlacklistedJobs(client, cmd_group, jobs);
+
+    // Keep only the group jobs if the groups are provided
+    if (has_groups)
+        m_GroupRegistry.RestrictByGroup(group_ids, jobs);
+
+    // Exclude jobs which have been read or in a process of reading
+    if (cmd_group == eRead)
+        jobs -= m_ReadJobs;
+}
+
+
+// Provides the first job (or 0) the client may get (or read) right now
+// which is not in the unwanted jobs. The vacant jobs are walked in the
+// status tracker so that they are not copied.
+unsigned int
+CQueue::x_GetFirstVacantJob(const CNSClientId &   client,
+                            const TNSBitVector &  group_ids,
+                            bool                  has_groups,
+                            ECommandGroup         cmd_group,
+                            TNSBitVector &        unwanted_jobs)
+{
+    TNSBitVector    restricted_jobs;
+    string          scope = client.GetScope();
+    bool            no_scope_only = scope.empty() ||
+                                    scope == kNoScopeOnly;
+
+    if (no_scope_only)
+        unwanted_jobs |= m_ScopeRegistry.GetAllJobsInScopes();
+    else {
+        restricted_jobs = m_ScopeRegistry.GetJobs(scope);
+        if (has_groups)
+            m_GroupRegistry.RestrictByGroup(group_ids, restricted_jobs);
+    }
+
+    // NOTE: the blacklisted jobs are added to the unwanted ones only to
+    //       avoid an expensive temporary bvector
+    if (cmd_group == eRead)
+        unwanted_jobs |= m_ReadJobs;
+    m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group, unwanted_jobs);
+
+    if (cmd_group == eGet) {
+        if (!no_scope_only)
+            // only the specific scope jobs
+            return m_StatusTracker.GetJobByStatus(CNetScheduleAPI::ePending,
+                                                  unwanted_jobs,
+                                                  restricted_jobs, true);
+        // only the jobs which are not in the scope
+        if (has_groups)
+            return m_StatusTracker.GetJobByStatus(
+                                        CNetScheduleAPI::ePending,
+                                        unwanted_jobs,
+                                        m_GroupRegistry.GetJobs(group_ids),
+                                        has_groups);
+        return m_StatusTracker.GetJobByStatus(CNetScheduleAPI::ePending,
+                                              unwanted_jobs,
+                                              kEmptyBitVector, false);
+    }
+
+    if (!no_scope_only)
+        return m_StatusTracker.GetJobByStatus(m_StatesForRead,
+                                              unwanted_jobs,
+                                              restricted_jobs, true);
+    if (has_groups)
+        return m_StatusTracker.GetJobByStatus(
                                     m_StatesForRead,
-                                    jobs_in_scope,
+                                    unwanted_jobs,
                                     m_GroupRegistry.GetJobs(group_ids),
                                     has_groups);
-                else
-                    job_id = m_StatusTracker.GetJobByStatus(
-                                    m_StatesForRead,
-                                    jobs_in_scope,
-                                    kEmptyBitVector,
-                                    false);
-            } else {
-                // only the specific scope jobs
-
-                // NOTE: this only to avoid an expensive temporary bvector
-                jobs_in_scope = m_ReadJobs;
-                m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
-                                                     jobs_in_scope);
-                job_id = m_StatusTracker.GetJobByStatus(
-                                            m_StatesForRead,
-                                            jobs_in_scope,
-                                            restricted_jobs, true);
-            }
-        }
-        return x_SJobPick(job_id, false, 0);
-    }
-
-    return x_SJobPick();
+    return m_StatusTracker.GetJobByStatus(m_StatesForRead,
+                                          unwanted_jobs,
+                                          kEmptyBitVector, false);
 }
 
 
@@ -3799,23 +3863,29 @@ unsigned int  CQueue::DeleteBatch(unsigned int  max_deleted)
                  ++en, ++n) {
                 unsigned int    job_id = *en;
 
-                try {
-                    m_QueueDbBlock->job_db.id = job_id;
-                    m_QueueDbBlock->job_db.Delete();
+                if (m_QueueDbBlock->job_store) {
+                    m_QueueDbBlock->job_store->Erase(job_id);
                     ++del_rec;
                     deleted_jobs.set_bit(job_id);
-                } catch (CBDB_ErrnoException& ex) {
-                    ERR_POST("BDB error " << ex.what());
-                }
+                } else {
+                    try {
+                        m_QueueDbBlock->job_db.id = job_id;
+                        m_QueueDbBlock->job_db.Delete();
+                        ++del_rec;
+                        deleted_jobs.set_bit(job_id);
+                    } catch (CBDB_ErrnoException& ex) {
+                        ERR_POST("BDB error " << ex.what());
+                    }
 
-                try {
-                    m_QueueDbBlock->job_info_db.id = job_id;
-                    m_QueueDbBlock->job_info_db.Delete();
-                } catch (CBDB_ErrnoException& ex) {
-                    ERR_POST("BDB error " << ex.what());
-                }
+                    try {
+                        m_QueueDbBlock->job_info_db.id = job_id;
+                        m_QueueDbBlock->job_info_db.Delete();
+                    } catch (CBDB_ErrnoException& ex) {
+                        ERR_POST("BDB error " << ex.what());
+                    }
 
-                x_DeleteJobEvents(job_id);
+                    x_DeleteJobEvents(job_id);
+                }
 
                 // The job might be the one which was given for reading
                 // so the garbage should be collected
@@ -4911,11 +4981,19 @@ unsigned int  CQueue::LoadFromDump(const string &  dump_dname)
     unsigned int    recs = 0;
     string          jobs_file_name = x_GetJobsDumpFileName(dump_dname);
     FILE *          jobs_file = NULL;
+    CNSJobStore *   job_store = m_QueueDbBlock->job_store;
 
-    if (!CDir(dump_dname).Exists())
-        return 0;
-    if (!CFile(jobs_file_name).Exists())
+    if (!CDir(dump_dname).Exists() || !CFile(jobs_file_name).Exists()) {
+        // The in-memory job store might have the logs of the previous
+        // instance which did not stop gracefully
+        if (job_store)
+            return x_RestoreFromJobStore();
         return 0;
+    }
+
+    // The dump is never older than the job store logs
+    if (job_store)
+        job_store->Close(true);
 
     try {
         m_AffinityRegistry.LoadFromDump(dump_dname, m_QueueName);
@@ -4930,50 +5008,13 @@ unsigned int  CQueue::LoadFromDump(const string &  dump_dname)
         AutoArray<char>     input_buf(new char[kNetScheduleMaxOverflowSize]);
         AutoArray<char>     output_buf(new char[kNetScheduleMaxOverflowSize]);
         while (job.LoadFromDump(jobs_file, input_buf.get(), output_buf.get())) {
-            unsigned int    job_id = job.GetId();
-            unsigned int    group_id = job.GetGroupId();
-            unsigned int    aff_id = job.GetAffinityId();
-            TJobStatus      status = job.GetStatus();
-
             {
                 CNSTransaction      transaction(this);
                 job.Flush(this);
                 transaction.Commit();
             }
 
-            m_StatusTracker.SetExactStatusNoLock(job_id, status, true);
-
-            if ((status == CNetScheduleAPI::eRunning ||
-                 status == CNetScheduleAPI::eReading) &&
-                m_RunTimeLine) {
-                // Add object to the first available slot;
-                // it is going to be rescheduled or dropped
-                // in the background control thread
-                // We can use time line without lock here because
-                // the queue is still in single-use mode while
-                // being loaded.
-                m_RunTimeLine->AddObject(m_RunTimeLine->GetHead(), job_id);
-            }
-
-            // Register the job for the affinity if so
-            if (aff_id != 0)
-                m_AffinityRegistry.AddJobToAffinity(job_id, aff_id);
-
-            // Register the job in the group registry
-            if (group_id != 0)
-                m_GroupRegistry.AddJobToGroup(group_id, job_id);
-
-            // Register the loaded job with the garbage collector
-            CNSPreciseTime  submit_time = job.GetSubmitTime();
-            CNSPreciseTime  expiration =
-                    GetJobExpirationTime(job.GetLastTouch(), status,
-                                         submit_time, job.GetTimeout(),
-                                         job.GetRunTimeout(),
-                                         job.GetReadTimeout(),
-                                         m_Timeout, m_RunTimeout, m_ReadTimeout,
-                                         m_PendingTimeout, kTimeZero);
-            m_GCRegistry.RegisterJob(job_id, job.GetSubmitTime(),
-                                     aff_id, group_id, expiration);
+            x_RegisterLoadedJob(job);
             ++recs;
         }
 
@@ -5005,6 +5046,173 @@ unsigned int  CQueue::LoadFromDump(const string &  dump_dname)
 }
 
 
+// Registers a job loaded from the dump or restored from the job store logs.
+// There is no concurrent access at the time of loading.
+void CQueue::x_RegisterLoadedJob(const CJob &  job)
+{
+    unsigned int    job_id = job.GetId();
+    unsigned int    group_id = job.GetGroupId();
+    unsigned int    aff_id = job.GetAffinityId();
+    TJobStatus      status = job.GetStatus();
+
+    m_StatusTracker.SetExactStatusNoLock(job_id, status, true);
+
+    if ((status == CNetScheduleAPI::eRunning ||
+         status == CNetScheduleAPI::eReading) &&
+        m_RunTimeLine) {
+        // Add object to the first available slot;
+        // it is going to be rescheduled or dropped
+        // in the background control thread
+        // We can use time line without lock here because
+        // the queue is still in single-use mode while
+        // being loaded.
+        m_RunTimeLine->AddObject(m_RunTimeLine->GetHead(), job_id);
+    }
+
+    // Register the job for the affinity if so
+    if (aff_id != 0)
+        m_AffinityRegistry.AddJobToAffinity(job_id, aff_id);
+
+    // Register the job in the group registry
+    if (group_id != 0)
+        m_GroupRegistry.AddJobToGroup(group_id, job_id);
+
+    // Register the loaded job with the garbage collector
+    CNSPreciseTime  submit_time = job.GetSubmitTime();
+    CNSPreciseTime  expiration =
+            GetJobExpirationTime(job.GetLastTouch(), status,
+                                 submit_time, job.GetTimeout(),
+                                 job.GetRunTimeout(),
+                                 job.GetReadTimeout(),
+                                 m_Timeout, m_RunTimeout, m_ReadTimeout,
+                                 m_PendingTimeout, kTimeZero);
+    m_GCRegistry.RegisterJob(job_id, job.GetSubmitTime(),
+                             aff_id, group_id, expiration);
+}
+
+
+// Loads the jobs from the in-memory job store snapshot and logs. The
+// affinity and group IDs are not preserved between the server instances so
+// the jobs are registered with the new IDs resolved from the tokens.
+unsigned int  CQueue::x_RestoreFromJobStore(void)
+{
+    CNSJobStore *       job_store = m_QueueDbBlock->job_store;
+    TNSRestoredJobs     restored;
+    unsigned int        recs = 0;
+
+    try {
+        job_store->Restore(restored);
+        if (restored.empty())
+            return 0;
+
+        CJob    job;
+        for (TNSRestoredJobs::const_iterator  k = restored.begin();
+                k != restored.end(); ++k) {
+            unsigned int    job_id = k->first;
+
+            if (job.Fetch(this, job_id) != CJob::eJF_Ok)
+                throw runtime_error("Cannot read the restored job " +
+                                    MakeJobKey(job_id));
+
+            unsigned int    aff_id = 0;
+            unsigned int    group_id = 0;
+            if (!k->second.affinity.empty())
+                aff_id = m_AffinityRegistry.ResolveAffinity(
+                                                    k->second.affinity);
+            if (!k->second.group.empty())
+                group_id = m_GroupRegistry.ResolveGroup(k->second.group);
+
+            if (aff_id != job.GetAffinityId() ||
+                group_id != job.GetGroupId()) {
+                job.SetAffinityId(aff_id);
+                job.SetGroupId(group_id);
+
+                CNSTransaction      transaction(this);
+                job.Flush(this);
+                transaction.Commit();
+            }
+
+            x_RegisterLoadedJob(job);
+            ++recs;
+        }
+
+        m_AffinityRegistry.FinalizeAffinityDictionaryLoading();
+        m_GroupRegistry.FinalizeGroupDictionaryLoading();
+
+        // The IDs of the restored jobs must not be given to new jobs
+        unsigned int    max_job_id = restored.rbegin()->first;
+        CFastMutexGuard guard(m_LastIdLock);
+        if (max_job_id > m_LastId) {
+            m_LastId = max_job_id;
+            if (m_SavedId <= m_LastId) {
+                m_SavedId = m_LastId + s_ReserveDelta;
+                m_Server->SetJobsStartID(m_QueueName, m_SavedId);
+            }
+        }
+    } catch (const exception &  ex) {
+        x_ClearQueue();
+        job_store->Close(true);
+        throw runtime_error("Error restoring queue " + m_QueueName +
+                            " from its job store logs: " + string(ex.what()));
+    } catch (...) {
+        x_ClearQueue();
+        job_store->Close(true);
+        throw runtime_error("Unknown error restoring queue " + m_QueueName +
+                            " from its job store logs");
+    }
+
+    return recs;
+}
+
+
+// The job store snapshot tokens are taken from the queue registries
+class CNSQueueJobTokens : public CNSJobTokenResolver
+{
+public:
+    CNSQueueJobTokens(const CNSAffinityRegistry &  aff_registry,
+                      const CNSGroupsRegistry &    group_registry)
+        : m_AffRegistry(aff_registry), m_GroupRegistry(group_registry)
+    {}
+
+    virtual string GetAffinityToken(unsigned int  aff_id) const
+    {
+        return m_AffRegistry.GetTokenByID(aff_id);
+    }
+
+    virtual string GetGroupToken(unsigned int  group_id) const
+    {
+        try {
+            return m_GroupRegistry.ResolveGroup(group_id);
+        } catch (...) {
+            return kEmptyStr;
+        }
+    }
+
+private:
+    const CNSAffinityRegistry &     m_AffRegistry;
+    const CNSGroupsRegistry &       m_GroupRegistry;
+};
+
+
+void CQueue::JobStoreCheckPoint(void)
+{
+    CNSJobStore *   job_store = m_QueueDbBlock->job_store;
+    if (job_store == NULL)
+        return;
+
+    try {
+        job_store->CheckPoint(CNSQueueJobTokens(m_AffinityRegistry,
+                                                m_GroupRegistry));
+    } catch (const exception &  ex) {
+        ERR_POST("Error making the job store snapshot of queue " <<
+                 m_QueueName << ": " << ex.what());
+    } catch (...) {
+        ERR_POST("Unknown error making the job store snapshot of queue " <<
+                 m_QueueName);
+    }
+}
+
+
 // The member does not grab the operational lock.
 // The member is used at the time of loading jobs from dump and at that time
 // there is no concurrent access.
@@ -5030,6 +5238,12 @@ void CQueue::x_ClearQueue(void)
         try {
             CNSTransaction      transaction(this);
 
+            if (m_QueueDbBlock->job_store) {
+                m_QueueDbBlock->job_store->Erase(job_id);
+                transaction.Commit();
+                continue;
+            }
+
             m_QueueDbBlock->job_db.id = job_id;
             m_QueueDbBlock->job_db.Delete();
 
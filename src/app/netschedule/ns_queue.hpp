@@ -62,6 +62,7 @@
 #include "ns_job_info_cache.hpp"
 #include "ns_scope.hpp"
 #include "ns_server_params.hpp"
+#include "ns_job_store.hpp"
 
 #include <deque>
 #include <map>
@@ -479,6 +480,7 @@ public:
     void Dump(const string &  dump_dir_name);
     void RemoveDump(const string &  dump_dir_name);
     unsigned int LoadFromDump(const string &  dump_dir_name);
+    void JobStoreCheckPoint(void);
     bool ShouldPerfLogTransitions(void) const
     { return m_ShouldPerfLogTransitions; }
     void UpdatePerfLoggingSettings(const string &  qclass);
@@ -524,6 +526,37 @@ private:
                     const TNSBitVector &          group_ids,
                     bool                          has_groups,
                     ECommandGroup                 cmd_group);
+    void x_DeferGetNotification(const TNSBitVector &  jobs,
+                                const TNSBitVector &  affinities,
+                                bool                  no_aff_jobs);
+    void x_SendDeferredGetNotifications(void);
+
+    // Sends the deferred GET notifications when it goes out of scope, so
+    // they are not left behind if an exception is thrown after they have
+    // been deferred. It must be created before the operation lock is taken.
+    struct x_SDeferredGetNotifier
+    {
+        CQueue &    queue;
+
+        x_SDeferredGetNotifier(CQueue &  q) :
+            queue(q)
+        {}
+        ~x_SDeferredGetNotifier()
+        {
+            queue.x_SendDeferredGetNotifications();
+        }
+    };
+
+    void x_RestrictToVacantJobs(const CNSClientId &   client,
+                                const TNSBitVector &  group_ids,
+                                bool                  has_groups,
+                                ECommandGroup         cmd_group,
+                                TNSBitVector &        jobs);
+    unsigned int x_GetFirstVacantJob(const CNSClientId &   client,
+                                     const TNSBitVector &  group_ids,
+                                     bool                  has_groups,
+                                     ECommandGroup         cmd_group,
+                                     TNSBitVector &        unwanted_jobs);
     x_SJobPick
     x_FindOutdatedPendingJob(const CNSClientId &  client,
                              unsigned int         picked_earlier,
@@ -612,6 +645,8 @@ private:
 
     string x_GetJobsDumpFileName(const string &  dump_dname) const;
     void x_ClearQueue(void);
+    void x_RegisterLoadedJob(const CJob &  job);
+    unsigned int x_RestoreFromJobStore(void);
 
 private:
     friend class CJob;
@@ -711,6 +746,15 @@ private:
     unsigned int                m_NotifLofreqMult;
     CNSPreciseTime              m_HandicapTimeout;
 
+    // Vacant job notifications of submits. They are collected under the
+    // operation lock and sent out of it; concurrent submitters share one
+    // pass over the listeners.
+    CFastMutex                  m_DeferredNotifLock;
+    TNSBitVector                m_DeferredNotifJobs;
+    TNSBitVector                m_DeferredNotifAffs;
+    bool                        m_DeferredNotifNoAffJobs;
+    bool                        m_DeferredNotifInProgress;
+
     unsigned int                m_DumpBufferSize;
     unsigned int                m_DumpClientBufferSize;
     unsigned int                m_DumpAffBufferSize;
@@ -826,7 +870,8 @@ public:
                    int                   what_tables = eAllTables,
                    ETransSync            tsync = eEnvDefault,
                    EKeepFileAssociation  assoc = eNoAssociation)
-        : CBDB_Transaction(queue->GetEnv(), tsync, assoc)
+        : CBDB_Transaction(queue->GetEnv(), tsync, assoc),
+          m_JobStoreTransaction(queue->m_QueueDbBlock->job_store)
     {
         if (what_tables & eJobTable)
             queue->m_QueueDbBlock->job_db.SetTransaction(this);
@@ -837,6 +882,24 @@ public:
         if (what_tables & eJobEventsTable)
             queue->m_QueueDbBlock->events_db.SetTransaction(this);
     }
+
+    // The in-memory job store changes are applied and logged at commit;
+    // they are dropped if the transaction is rolled back or destroyed
+    // without a commit
+    virtual void Commit()
+    {
+        m_JobStoreTransaction.Commit();
+        CBDB_Transaction::Commit();
+    }
+
+    virtual void Rollback()
+    {
+        m_JobStoreTransaction.Rollback();
+        CBDB_Transaction::Rollback();
+    }
+
+private:
+    CNSJobStoreTransaction      m_JobStoreTransaction;
 };
 
 
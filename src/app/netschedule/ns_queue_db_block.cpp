@@ -33,6 +33,7 @@
 
 #include "ns_types.hpp"
 #include "ns_queue_db_block.hpp"
+#include "ns_job_store.hpp"
 
 
 BEGIN_NCBI_SCOPE
@@ -81,6 +82,9 @@ void SQueueDbBlock::Open(CBDB_Env& env, const string& path, int pos_,
 
 void SQueueDbBlock::Close()
 {
+    delete job_store;
+    job_store = NULL;
+
     events_db.Close();
     job_info_db.Close();
     job_db.Close();
@@ -89,6 +93,9 @@ void SQueueDbBlock::Close()
 
 void SQueueDbBlock::Truncate()
 {
+    if (job_store)
+        job_store->Close(true);
+
     events_db.SafeTruncate();
     job_info_db.SafeTruncate();
     job_db.SafeTruncate();
@@ -136,6 +143,27 @@ void CQueueDbBlockArray::Close()
 }
 
 
+void CQueueDbBlockArray::CreateJobStores(const string &  wal_path,
+                                         bool  sync_commits,
+                                         Uint8  snapshot_size)
+{
+    for (unsigned n = 0; n < m_Count; ++n) {
+        if (m_Array[n].job_store == NULL)
+            m_Array[n].job_store = new CNSJobStore(wal_path, sync_commits,
+                                                   snapshot_size);
+    }
+}
+
+
+void CQueueDbBlockArray::CloseJobStores(bool  remove_files)
+{
+    for (unsigned n = 0; n < m_Count; ++n) {
+        if (m_Array[n].job_store != NULL)
+            m_Array[n].job_store->Close(remove_files);
+    }
+}
+
+
 int CQueueDbBlockArray::Allocate()
 {
     for (unsigned n = 0; n < m_Count; ++n) {
@@ -42,12 +42,18 @@
 BEGIN_NCBI_SCOPE
 
 
+class CNSJobStore;
+
+
 /// Queue databases
 // BerkeleyDB does not like to mix DB open/close with regular operations,
 // so we open a set of db files on startup to be used as actual databases.
 // This block represent a set of db files to serve one queue.
 struct SQueueDbBlock
 {
+    SQueueDbBlock() : allocated(false), pos(-1), job_store(NULL)
+    {}
+
     void Open(CBDB_Env& env, const std::string& path, int pos, bool in_ram);
     void Close();
     void Truncate();
@@ -57,6 +63,9 @@ struct SQueueDbBlock
     SJobDB                  job_db;
     SJobInfoDB              job_info_db;
     SEventsDB               events_db;
+    // Holds the jobs instead of the DB tables if the storage engine is
+    // 'memory'; NULL otherwise
+    CNSJobStore *           job_store;
 };
 
 
@@ -71,6 +80,12 @@ public:
 
     void Close();
 
+    // Creates the in-memory job stores for the 'memory' storage engine
+    void CreateJobStores(const string &  wal_path, bool  sync_commits,
+                         Uint8  snapshot_size);
+    // Stops the job stores writers; the WAL files are removed if required
+    void CloseJobStores(bool  remove_files);
+
     // Allocate a block from array.
     // Returns position of an allocated block, negative if no more free blocks
     int  Allocate(void);
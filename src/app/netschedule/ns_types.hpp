@@ -68,6 +68,7 @@ typedef map<string, SQueueParameters, PNocase>  TQueueParams;
 
 
 const string    kDumpSubdirName("dump");
+const string    kWALSubdirName("wal");
 const string    kDumpReservedSpaceFileName("space_keeper.dat");
 const string    kQClassDescriptionFileName("qclass_descr.dump");
 const string    kLinkedSectionsFileName("linked_sections.dump");
@@ -477,12 +477,45 @@ void NS_ValidateBDBSection(const IRegistry &  reg,
         return;
 
     CConfig bdb_conf((CConfig::TParamTree*)bdb_tree, eNoOwnership);
+    string  storage_engine = bdb_conf.GetString("netschedule",
+                                                "storage_engine",
+                                                CConfig::eErr_NoThrow, "bdb");
+    if (NStr::CompareNocase(storage_engine, "bdb") != 0 &&
+        NStr::CompareNocase(storage_engine, "memory") != 0)
+        warnings.push_back(
+            g_ValidPrefix + NS_RegValName("bdb", "storage_engine") +
+            " must be 'bdb' or 'memory'. Received: '" + storage_engine +
+            "'. The bdb engine is used.");
+
+    bool    memory_storage = NStr::CompareNocase(storage_engine,
+                                                 "memory") == 0;
+    if (memory_storage) {
+        Uint8   wal_snapshot_size = bdb_conf.GetDataSize(
+                                                "netschedule",
+                                                "wal_snapshot_size",
+                                                CConfig::eErr_NoThrow,
+                                                kWALSnapshotSizeDefault);
+        if (wal_snapshot_size == 0)
+            warnings.push_back(
+                g_ValidPrefix + NS_RegValName("bdb", "wal_snapshot_size") +
+                " is zero. Job store snapshots will be made whenever "
+                "the log outgrows the previous snapshot.");
+    }
+
     bool    database_in_ram = bdb_conf.GetBool("netschedule",
                                                "database_in_ram",
                                                CConfig::eErr_NoThrow, false);
     if (!database_in_ram)
         return;
 
+    if (memory_storage) {
+        warnings.push_back(
+            g_ValidPrefix + NS_RegValName("bdb", "database_in_ram") +
+            " is ignored because " +
+            NS_RegValName("bdb", "storage_engine") + " is memory.");
+        return;
+    }
+
     Uint8   cache_ram_size = bdb_conf.GetDataSize("netschedule",
                                                   "mem_size",
                                                   CConfig::eErr_NoThrow, 0);
@@ -102,6 +102,23 @@ bool SNSDBEnvironmentParams::Read(const IRegistry& reg, const string& sname)
     direct_db         = GetBoolNoErr("direct_db", false);
     direct_log        = GetBoolNoErr("direct_log", false);
     database_in_ram   = GetBoolNoErr("database_in_ram", false);
+    storage_engine    = bdb_conf.GetString("netschedule", "storage_engine",
+                                           CConfig::eErr_NoThrow, "bdb");
+    wal_snapshot_size = GetSizeNoErr("wal_snapshot_size",
+                                     kWALSnapshotSizeDefault);
+
+    if (IsMemoryStorage()) {
+        // The BDB environment holds no jobs in this mode so its memory
+        // settings are not relevant
+        if (database_in_ram)
+            ERR_POST(Warning << "[bdb]/database_in_ram is ignored "
+                                "because [bdb]/storage_engine is memory.");
+        database_in_ram = false;
+    } else if (NStr::CompareNocase(storage_engine, "bdb") != 0) {
+        ERR_POST(Warning << "[bdb]/storage_engine has unknown value '"
+                         << storage_engine << "'. The bdb engine is used.");
+        storage_engine = "bdb";
+    }
 
     // CXX-9245
     if (database_in_ram) {
@@ -132,6 +149,7 @@ CQueueDataBase::CQueueDataBase(CNetScheduleServer *            server,
 : m_Host(server->GetBackgroundHost()),
   m_Executor(server->GetRequestExecutor()),
   m_Env(NULL),
+  m_MemoryStorage(params.IsMemoryStorage()),
   m_StopPurge(false),
   m_FreeStatusMemCnt(0),
   m_LastFreeMem(time(0)),
@@ -143,6 +161,8 @@ CQueueDataBase::CQueueDataBase(CNetScheduleServer *            server,
     m_DataPath = CDirEntry::AddTrailingPathSeparator(params.db_path);
     m_DumpPath = CDirEntry::AddTrailingPathSeparator(m_DataPath +
                                                      kDumpSubdirName);
+    m_WALPath = CDirEntry::AddTrailingPathSeparator(m_DataPath +
+                                                    kWALSubdirName);
 
     // First, load the previous session start job IDs if file existed
     m_Server->LoadJobsStartIDs();
@@ -222,7 +242,15 @@ void  CQueueDataBase::x_Open(const SNSDBEnvironmentParams &  params,
 
     // Allocate SQueueDbBlock's here, open/create corresponding databases
     m_QueueDbBlockArray.Init(*m_Env, m_DataPath, queues_limit,
-                             params.database_in_ram);
+                             params.database_in_ram || m_MemoryStorage);
+    if (m_MemoryStorage) {
+        CDir    wal_dir(m_WALPath);
+        if (!wal_dir.Exists())
+            wal_dir.Create();
+        m_QueueDbBlockArray.CreateJobStores(m_WALPath,
+                                            params.sync_transactions,
+                                            params.wal_snapshot_size);
+    }
 
     try {
         // Here: we can start restoring what was saved. The first step is
@@ -312,6 +340,9 @@ void  CQueueDataBase::x_Open(const SNSDBEnvironmentParams &  params,
         ++queue_load_error_count;
     }
 
+    if (m_MemoryStorage)
+        x_RemoveOrphanJobStoreFiles();
+
     x_CreateCrashFlagFile();
     x_CreateDumpErrorFlagFile();
     x_CreateStorageVersionFile();
@@ -1260,6 +1291,7 @@ void CQueueDataBase::Close(void)
         // need to dump anything
         LOG_POST("Drained shutdown: the DB has been successfully drained");
         x_RemoveDumpErrorFlagFile();
+        m_QueueDbBlockArray.CloseJobStores(true);
     } else {
         // That was either:
         // - hard shutdown
@@ -1273,6 +1305,10 @@ void CQueueDataBase::Close(void)
         // Dump all the queues/queue classes/queue parameters to flat files
         x_Dump();
 
+        // The job store logs are kept if some queues were not dumped so
+        // that the next instance could restore them
+        m_QueueDbBlockArray.CloseJobStores(!x_DoesDumpErrorFlagFileExist());
+
         // A Dump is created, so we may avoid calling
         // - m_Env->ForceTransactionCheckpoint();
         // - m_Env->CleanLog();
@@ -1310,6 +1346,22 @@ void CQueueDataBase::TransactionCheckPoint(bool clean_log)
     m_Env->TransactionCheckpoint();
     if (clean_log)
         m_Env->CleanLog();
+
+    if (!m_MemoryStorage)
+        return;
+
+    // Job store snapshots are made out of the configure lock
+    vector< CRef<CQueue> >      queues;
+    {{
+        CFastMutexGuard     guard(m_ConfigureLock);
+        for (TQueueInfo::iterator  k = m_Queues.begin();
+                k != m_Queues.end(); ++k)
+            queues.push_back(k->second.second);
+    }}
+
+    for (vector< CRef<CQueue> >::iterator  k = queues.begin();
+            k != queues.end(); ++k)
+        (*k)->JobStoreCheckPoint();
 }
 
 
@@ -2493,10 +2545,58 @@ void CQueueDataBase::x_RemoveBDBFiles(void)
 }
 
 
+// Removes the job store logs and snapshots of the queues which do not exist
+// anymore
+void CQueueDataBase::x_RemoveOrphanJobStoreFiles(void)
+{
+    CDir        wal_dir(m_WALPath);
+    if (!wal_dir.Exists())
+        return;
+
+    set<string>     upper_queue_names;
+    for (TQueueInfo::const_iterator  k = m_Queues.begin();
+            k != m_Queues.end(); ++k) {
+        string      upper_queue_name = k->first;
+        NStr::ToUpper(upper_queue_name);
+        upper_queue_names.insert(upper_queue_name);
+    }
+
+    CDir::TEntries      entries = wal_dir.GetEntries(
+                                    kEmptyStr, CDir::fIgnoreRecursive);
+    for (CDir::TEntries::const_iterator  k = entries.begin();
+            k != entries.end(); ++k) {
+        if ((*k)->IsDir())
+            continue;
+        string      entry_name = (*k)->GetName();
+        string      queue_name = entry_name.substr(0, entry_name.find('.'));
+        if (upper_queue_names.find(queue_name) != upper_queue_names.end())
+            continue;
+
+        LOG_POST(Note << "Removing job store file " << entry_name
+                      << " of a non-existing queue");
+        CFile   f(m_WALPath + entry_name);
+        try {
+            f.Remove();
+        } catch (...) {}
+    }
+}
+
+
 // Logs the corresponding message if needed and provides the overall reinit
 // status.
 bool CQueueDataBase::x_CheckOpenPreconditions(bool  reinit)
 {
+    if (x_DoesCrashFlagFileExist() && m_MemoryStorage && !reinit &&
+        CDir(m_WALPath).Exists()) {
+        string  msg = "The server did not stop gracefully last time. "
+                      "The jobs are restored from the job store logs. "
+                      "Dynamic queues created after the previous start "
+                      "are lost.";
+        ERR_POST(msg);
+        m_Server->RegisterAlert(eStartAfterCrash, msg);
+        return false;
+    }
+
     if (x_DoesCrashFlagFileExist()) {
         ERR_POST("Reinitialization due to the server "
                  "did not stop gracefully last time. "
@@ -2588,7 +2688,12 @@ CQueueDataBase::x_CreateBDBEnvironment(const SNSDBEnvironmentParams &  params)
     env->OpenErrFile(err_file.c_str());
 
     env->SetLogRegionMax(512 * 1024);
-    if (params.log_mem_size) {
+    if (m_MemoryStorage) {
+        // The BDB tables are never written in this mode; the environment
+        // only keeps them open
+        env->SetLogInMemory(true);
+        env->SetLogBSize(1024 * 1024);
+    } else if (params.log_mem_size) {
         env->SetLogInMemory(true);
         env->SetLogBSize(params.log_mem_size);
     } else {
@@ -2597,10 +2702,10 @@ CQueueDataBase::x_CreateBDBEnvironment(const SNSDBEnvironmentParams &  params)
     }
 
     CBDB_Env::TEnvOpenFlags opt = CBDB_Env::eThreaded;
-    if (params.database_in_ram)
+    if (params.database_in_ram || m_MemoryStorage)
         opt |= CBDB_Env::ePrivate;
 
-    if (params.cache_ram_size)
+    if (params.cache_ram_size && !m_MemoryStorage)
         env->SetCacheSize(params.cache_ram_size);
     if (params.mutex_max)
         env->MutexSetMax(params.mutex_max);
@@ -2616,7 +2721,7 @@ CQueueDataBase::x_CreateBDBEnvironment(const SNSDBEnvironmentParams &  params)
                                   CBDB_Transaction::eTransSync :
                                   CBDB_Transaction::eTransASync);
 
-    if (params.database_in_ram)
+    if (params.database_in_ram || m_MemoryStorage)
         env->OpenWithTrans("", opt);
     else
         env->OpenWithTrans(m_DataPath, opt);
@@ -2625,6 +2730,7 @@ CQueueDataBase::x_CreateBDBEnvironment(const SNSDBEnvironmentParams &  params)
         .Print("_type", "startup")
         .Print("info", "opened BDB environment")
         .Print("database_in_ram", params.database_in_ram ? "true" : "false")
+        .Print("storage_engine", params.storage_engine)
         .Print("max_locks", env->GetMaxLocks())
         .Print("transactions",
                env->GetTransactionSync() == CBDB_Transaction::eTransSync ?
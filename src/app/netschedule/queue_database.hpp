@@ -58,6 +58,9 @@ BEGIN_NCBI_SCOPE
 const Uint8 kBDBMemSizeInMemDefault = 2 * 1000 * 1000 * 1000;   // 2 GB
 const Uint8 kBDBMemSizeInMemLowLimit = 100 * 1000 * 1000;       // 100 MB
 
+// 'memory' storage engine: the job store log size which triggers a snapshot
+const Uint8 kWALSnapshotSizeDefault = 256 * 1024 * 1024;        // 256 MB
+
 class CNetScheduleServer;
 
 
@@ -89,8 +92,12 @@ struct SNSDBEnvironmentParams
     bool      direct_db;
     bool      direct_log;
     bool      database_in_ram;
+    string    storage_engine;      // "bdb" or "memory"
+    Uint8     wal_snapshot_size;   // Log size to make a job store snapshot
 
     bool Read(const IRegistry& reg, const string& sname);
+    bool IsMemoryStorage(void) const
+    { return NStr::CompareNocase(storage_engine, "memory") == 0; }
 };
 
 
@@ -218,6 +225,8 @@ private:
     CBDB_Env *           m_Env;
     string               m_DataPath;
     string               m_DumpPath;
+    string               m_WALPath;         // Job store logs and snapshots
+    bool                 m_MemoryStorage;   // 'memory' storage engine
 
     mutable CFastMutex   m_ConfigureLock;
 
@@ -315,6 +324,7 @@ private:
                              const map<string, string> &  values);
     void x_RemoveDump(void);
     void x_RemoveBDBFiles(void);
+    void x_RemoveOrphanJobStoreFiles(void);
     void x_CreateStorageVersionFile(void);
 
     bool x_CheckOpenPreconditions(bool  reinit);
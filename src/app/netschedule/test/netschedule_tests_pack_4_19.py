@@ -9,7 +9,7 @@ Netschedule server tests pack for the features appeared in NS-4.23.0 and up
 """
 
 from netschedule_tests_pack import TestBase
-from netschedule_tests_pack_4_10 import execAny
+from netschedule_tests_pack_4_10 import execAny, changeAffinity
 
 from cgi import parse_qs
 import socket
@@ -1103,3 +1103,59 @@ class Scenario1904( TestBase ):
         return True
 
 
+
+class Scenario1905( TestBase ):
+    " Scenario 1905 "
+
+    def __init__( self, netschedule ):
+        TestBase.__init__( self, netschedule )
+
+    @staticmethod
+    def getScenario():
+        " Provides the scenario "
+        return "SUBMIT jobs with affinities a0, a1, a2 and groups g1, g2, " \
+               "CHAFF add=a2, GET2 aff=a1 wnode_aff=1 any_aff=1 group=g1 " \
+               "=> explicit, preferred, any affinity job of g1, nothing; " \
+               "GET2 wnode_aff=0 any_aff=1 group=g2 => the oldest g2 job"
+
+    def execute( self ):
+        " Should return True if the execution completed successfully "
+        self.fromScratch()
+
+        jobID1 = self.ns.submitJob( 'TEST', 'bla', 'a0', 'g1' )
+        jobID2 = self.ns.submitJob( 'TEST', 'bla', 'a1', 'g2' )
+        jobID3 = self.ns.submitJob( 'TEST', 'bla', 'a2', 'g1' )
+        jobID4 = self.ns.submitJob( 'TEST', 'bla', '', 'g2' )   # analysis:ignore
+        jobID5 = self.ns.submitJob( 'TEST', 'bla', 'a1', 'g1' )
+
+        ns_client = self.getNetScheduleService( 'TEST', 'scenario1905' )
+        ns_client.set_client_identification( 'node', 'session' )
+
+        changeAffinity( ns_client, [ 'a2' ], [] )
+
+        # The explicit affinity job of the group goes first although an
+        # older job with that affinity is in another group; then the
+        # preferred affinity and then any job of the group
+        cmd = 'GET2 aff=a1 wnode_aff=1 any_aff=1 group=g1'
+        for expected in [ jobID5, jobID3, jobID1 ]:
+            output = execAny( ns_client, cmd )
+            if output == "":
+                raise Exception( "Expected " + expected + ", got nothing" )
+            values = parse_qs( output, True, True )
+            receivedJobID = values[ 'job_key' ][ 0 ]
+            if receivedJobID != expected:
+                raise Exception( "Expected: " + expected + ", got: " + output )
+
+        output = execAny( ns_client, cmd )
+        if output != "":
+            raise Exception( "Expected no job, received some: " + output )
+
+        output = execAny( ns_client, 'GET2 wnode_aff=0 any_aff=1 group=g2' )
+        if output == "":
+            raise Exception( "Expected " + jobID2 + ", got nothing" )
+        values = parse_qs( output, True, True )
+        receivedJobID = values[ 'job_key' ][ 0 ]
+        if receivedJobID != jobID2:
+            raise Exception( "Expected: " + jobID2 + ", got: " + output )
+
+        return True
@@ -778,6 +778,7 @@ def main():
               pack_4_19.Scenario1902( netschedule ),
               pack_4_19.Scenario1903( netschedule ),
               pack_4_19.Scenario1904( netschedule ),
+              pack_4_19.Scenario1905( netschedule ),
             ]
 
     # Calculate the start test index
@@ -0,0 +1,463 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Tests of the NetSchedule in-memory job store: write-ahead log replay,
+ *   snapshots and log generations, a torn log tail, transaction
+ *   rollback and a log write failure.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbifile.hpp>
+
+#include <unistd.h>
+
+#include "ns_job_store.hpp"
+
+
+USING_NCBI_SCOPE;
+
+
+static const char *     kQueueName = "test_queue";
+
+
+class CTestTokens : public CNSJobTokenResolver
+{
+public:
+    virtual string GetAffinityToken(unsigned int  aff_id) const
+    {
+        return aff_id == 0 ? kEmptyStr : "aff" + NStr::NumericToString(aff_id);
+    }
+    virtual string GetGroupToken(unsigned int  group_id) const
+    {
+        return group_id == 0 ? kEmptyStr :
+                               "group" + NStr::NumericToString(group_id);
+    }
+};
+
+
+#define CHECK(expr)                                                     \
+    do {                                                                \
+        if (!(expr))                                                    \
+            NCBI_THROW(CException, eUnknown,                            \
+                       "Check failed at line " +                        \
+                       NStr::NumericToString(__LINE__) + ": " #expr);   \
+    } while (0)
+
+
+class CTestJobStoreApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run(void);
+
+private:
+    void x_TestReplay(void);
+    void x_TestRollback(void);
+    void x_TestSnapshot(void);
+    void x_TestTornTail(void);
+    void x_TestWriteFailure(void);
+
+    // Commits a job with the info record in its own transaction
+    void x_PutJob(CNSJobStore &  store, unsigned int  job_id,
+                  const string &  info = kEmptyStr);
+    void x_CheckJob(const CNSJobStore &  store, unsigned int  job_id,
+                    const string &  info = kEmptyStr);
+    // Drops the memory contents and loads the files again
+    size_t x_Reload(CNSJobStore &  store, TNSRestoredJobs &  jobs);
+    vector<string> x_GetLogs(void) const;
+    void x_Clean(void);
+
+private:
+    string          m_Dir;
+};
+
+
+void CTestJobStoreApp::Init(void)
+{
+    auto_ptr<CArgDescriptions>  arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "NetSchedule job store test");
+    arg_desc->AddDefaultKey("dir", "path",
+                            "Directory for the test files",
+                            CArgDescriptions::eString, ".");
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+int CTestJobStoreApp::Run(void)
+{
+    m_Dir = CDirEntry::ConcatPath(GetArgs()["dir"].AsString(),
+                                  "test_ns_job_store." +
+                                  NStr::NumericToString(getpid()));
+    CDir(m_Dir).CreatePath();
+
+    int     ret = 0;
+    try {
+        x_TestReplay();
+        x_TestRollback();
+        x_TestSnapshot();
+        x_TestTornTail();
+        x_TestWriteFailure();
+        LOG_POST("All tests passed");
+    } catch (const exception &  ex) {
+        ERR_POST("Test failed: " << ex.what());
+        ret = 1;
+    }
+
+    CDir(m_Dir).Remove();
+    return ret;
+}
+
+
+void CTestJobStoreApp::x_PutJob(CNSJobStore &   store,
+                                unsigned int    job_id,
+                                const string &  info)
+{
+    CTestTokens             tokens;
+    CNSJobStoreTransaction  transaction(&store);
+
+    store.PutJob(job_id, job_id % 3, job_id % 5,
+                 "job" + NStr::NumericToString(job_id),
+                 tokens.GetAffinityToken(job_id % 3),
+                 tokens.GetGroupToken(job_id % 5));
+    if (!info.empty())
+        store.PutInfo(job_id, info);
+    transaction.Commit();
+}
+
+
+void CTestJobStoreApp::x_CheckJob(const CNSJobStore &  store,
+                                  unsigned int         job_id,
+                                  const string &       info)
+{
+    string      job_rec;
+    string      info_rec;
+
+    CHECK(store.Get(job_id, job_rec, info_rec));
+    CHECK(job_rec == "job" + NStr::NumericToString(job_id));
+    CHECK(info_rec == info);
+}
+
+
+size_t CTestJobStoreApp::x_Reload(CNSJobStore &  store,
+                                  TNSRestoredJobs &  jobs)
+{
+    store.Close(false);
+    store.Open(kQueueName);
+    return store.Restore(jobs);
+}
+
+
+vector<string> CTestJobStoreApp::x_GetLogs(void) const
+{
+    vector<string>      logs;
+    CDir::TEntries      entries = CDir(m_Dir).GetEntries(
+                                        string("*.wal.*"),
+                                        CDir::fIgnoreRecursive);
+    ITERATE(CDir::TEntries, k, entries) {
+        logs.push_back((*k)->GetPath());
+    }
+    sort(logs.begin(), logs.end());
+    return logs;
+}
+
+
+void CTestJobStoreApp::x_Clean(void)
+{
+    CDir(m_Dir).Remove();
+    CDir(m_Dir).CreatePath();
+}
+
+
+void CTestJobStoreApp::x_TestReplay(void)
+{
+    x_Clean();
+
+    CNSJobStore         store(m_Dir, false, 1024 * 1024);
+    TNSRestoredJobs     jobs;
+
+    store.Open(kQueueName);
+    CHECK(store.Restore(jobs) == 0);
+
+    for (unsigned int  id = 1; id <= 100; ++id)
+        x_PutJob(store, id, id % 2 ? "info" : kEmptyStr);
+
+    // Overwrite, erase and remove the info
+    x_PutJob(store, 10, "new info");
+    {{
+        CNSJobStoreTransaction  transaction(&store);
+        store.Erase(20);
+        store.PutInfo(31, kEmptyStr);
+        transaction.Commit();
+    }}
+    // Not in a transaction: committed immediately
+    store.Erase(30);
+
+    CHECK(x_Reload(store, jobs) == 98);
+    CHECK(jobs.size() == 98);
+    CHECK(jobs[7].affinity == "aff1");
+    CHECK(jobs[7].group == "group2");
+    CHECK(jobs[9].affinity.empty());
+
+    for (unsigned int  id = 1; id <= 100; ++id) {
+        string      job_rec, info_rec;
+        if (id == 20 || id == 30) {
+            CHECK(!store.Get(id, job_rec, info_rec));
+            continue;
+        }
+        if (id == 10)
+            x_CheckJob(store, id, "new info");
+        else if (id == 31)
+            x_CheckJob(store, id);
+        else
+            x_CheckJob(store, id, id % 2 ? "info" : kEmptyStr);
+    }
+    store.Close(true);
+    CHECK(x_GetLogs().empty());
+}
+
+
+void CTestJobStoreApp::x_TestRollback(void)
+{
+    x_Clean();
+
+    CNSJobStore         store(m_Dir, false, 1024 * 1024);
+    TNSRestoredJobs     jobs;
+
+    store.Open(kQueueName);
+    store.Restore(jobs);
+    x_PutJob(store, 1, "info");
+    x_PutJob(store, 2);
+
+    {{
+        CNSJobStoreTransaction  transaction(&store);
+
+        store.PutInfo(1, "changed");
+        store.Erase(2);
+        store.PutJob(3, 0, 0, "job3", kEmptyStr, kEmptyStr);
+
+        // The transaction sees its own changes
+        x_CheckJob(store, 1, "changed");
+        x_CheckJob(store, 3);
+        string      job_rec, info_rec;
+        CHECK(!store.Get(2, job_rec, info_rec));
+
+        // The nested one joins the outer transaction
+        CNSJobStoreTransaction  nested(&store);
+        store.PutJob(4, 0, 0, "job4", kEmptyStr, kEmptyStr);
+        nested.Commit();
+        x_CheckJob(store, 4);
+
+        transaction.Rollback();
+    }}
+
+    string      job_rec, info_rec;
+    x_CheckJob(store, 1, "info");
+    x_CheckJob(store, 2);
+    CHECK(!store.Get(3, job_rec, info_rec));
+    CHECK(!store.Get(4, job_rec, info_rec));
+    CHECK(store.GetJobCount() == 2);
+
+    // Destroyed without a commit
+    {{
+        CNSJobStoreTransaction  transaction(&store);
+        store.Erase(1);
+    }}
+    x_CheckJob(store, 1, "info");
+
+    // Nothing of the rolled back is in the log
+    CHECK(x_Reload(store, jobs) == 2);
+    x_CheckJob(store, 1, "info");
+    x_CheckJob(store, 2);
+    store.Close(true);
+}
+
+
+void CTestJobStoreApp::x_TestSnapshot(void)
+{
+    x_Clean();
+
+    CTestTokens         tokens;
+    CNSJobStore         store(m_Dir, false, 4096);
+    TNSRestoredJobs     jobs;
+
+    store.Open(kQueueName);
+    store.Restore(jobs);
+
+    // Too small a log does not make a snapshot
+    x_PutJob(store, 1);
+    store.CheckPoint(tokens);
+    CHECK(!CFile(CDirEntry::ConcatPath(m_Dir, "TEST_QUEUE.snapshot")).Exists());
+
+    for (unsigned int  id = 2; id <= 500; ++id)
+        x_PutJob(store, id, "info" + NStr::NumericToString(id));
+    // Close() lets the writer thread write everything appended
+    store.Close(false);
+    store.Open(kQueueName);
+    CHECK(store.Restore(jobs) == 500);
+    CHECK(x_GetLogs().size() == 1);
+
+    // The replayed log is merged into a snapshot, a new generation starts
+    store.CheckPoint(tokens);
+    CHECK(CFile(CDirEntry::ConcatPath(m_Dir, "TEST_QUEUE.snapshot")).Exists());
+    vector<string>      logs = x_GetLogs();
+    CHECK(logs.size() == 1);
+    CHECK(NStr::EndsWith(logs[0], ".wal.2"));
+
+    // Changes after the snapshot go to the new generation
+    {{
+        CNSJobStoreTransaction  transaction(&store);
+        store.Erase(5);
+        transaction.Commit();
+    }}
+    x_PutJob(store, 6, "new info");
+    x_PutJob(store, 501);
+
+    CHECK(x_Reload(store, jobs) == 500);
+    CHECK(jobs.size() == 500);
+    CHECK(jobs[7].affinity == "aff1" && jobs[7].group == "group2");
+    string      job_rec, info_rec;
+    CHECK(!store.Get(5, job_rec, info_rec));
+    x_CheckJob(store, 6, "new info");
+    x_CheckJob(store, 7, "info7");
+    x_CheckJob(store, 501);
+
+    // A snapshot which has not been renamed is ignored
+    {{
+        CNcbiOfstream   tmp(CDirEntry::ConcatPath(
+                                m_Dir, "TEST_QUEUE.snapshot.tmp").c_str());
+        tmp << "xx";
+    }}
+    x_PutJob(store, 502);
+    CHECK(x_Reload(store, jobs) == 501);
+    x_CheckJob(store, 502);
+    store.Close(true);
+}
+
+
+void CTestJobStoreApp::x_TestTornTail(void)
+{
+    x_Clean();
+
+    CNSJobStore         store(m_Dir, false, 1024 * 1024);
+    TNSRestoredJobs     jobs;
+
+    store.Open(kQueueName);
+    store.Restore(jobs);
+    for (unsigned int  id = 1; id <= 10; ++id)
+        x_PutJob(store, id, "info");
+    store.Close(false);
+
+    // Cut the last record in the middle
+    vector<string>      logs = x_GetLogs();
+    CHECK(logs.size() == 1);
+    Int8                size = CFile(logs[0]).GetLength();
+    CHECK(truncate(logs[0].c_str(), size - 3) == 0);
+
+    store.Open(kQueueName);
+    CHECK(store.Restore(jobs) == 10);
+    x_CheckJob(store, 9, "info");
+    x_CheckJob(store, 10);      // The info record is lost
+
+    // A corrupted record stops the replay too
+    x_PutJob(store, 11);
+    x_PutJob(store, 12);
+    store.Close(false);
+    logs = x_GetLogs();
+    CHECK(logs.size() == 2);
+    {{
+        CFileIO     f;
+        f.Open(logs[1], CFileIO_Base::eOpen, CFileIO_Base::eReadWrite);
+        f.SetFilePos(-2, CFileIO_Base::eEnd);
+        f.Write("~~", 2);
+    }}
+
+    store.Open(kQueueName);
+    CHECK(store.Restore(jobs) == 11);
+    x_CheckJob(store, 11);
+    string      job_rec, info_rec;
+    CHECK(!store.Get(12, job_rec, info_rec));
+    store.Close(true);
+}
+
+
+void CTestJobStoreApp::x_TestWriteFailure(void)
+{
+    x_Clean();
+
+    // The log cannot be created in a directory which does not exist
+    CNSJobStore         store(CDirEntry::ConcatPath(m_Dir, "missing"),
+                              true, 1024 * 1024);
+    TNSRestoredJobs     jobs;
+
+    store.Open(kQueueName);
+    store.Restore(jobs);
+
+    // The commit is applied in memory but is not reported as durable
+    x_PutJob(store, 1);
+    CHECK(!CNSJobStore::WaitForCommits());
+    x_CheckJob(store, 1);
+
+    // Further changes are refused, in a transaction or not
+    bool        refused = false;
+    try {
+        x_PutJob(store, 2);
+    } catch (const CFileException &) {
+        refused = true;
+    }
+    CHECK(refused);
+    string      job_rec, info_rec;
+    CHECK(!store.Get(2, job_rec, info_rec));
+    CHECK(CNSJobStore::WaitForCommits());
+
+    refused = false;
+    try {
+        store.Erase(1);
+    } catch (const CFileException &) {
+        refused = true;
+    }
+    CHECK(refused);
+    x_CheckJob(store, 1);
+    store.Close(false);
+
+    // Reopening makes the store writable again
+    store.Open(kQueueName);
+    store.Restore(jobs);
+    CDir(CDirEntry::ConcatPath(m_Dir, "missing")).Create();
+    x_PutJob(store, 3);
+    CHECK(CNSJobStore::WaitForCommits());
+    store.Close(true);
+}
+
+
+int main(int argc, const char *  argv[])
+{
+    return CTestJobStoreApp().AppMain(argc, argv);
+}
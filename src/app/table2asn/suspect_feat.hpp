@@ -19,6 +19,7 @@ namespace objects
         ~CFixSuspectProductName();
 
         void SetFilename(const string& filename);
+        const string& GetFilename() const { return m_rules_filename; }
         void FixSuspectProductNames(objects::CSeq_entry& entry);
         bool FixSuspectProductNames(objects::CSeq_feat& feature);
         bool FixSuspectProductName(string& product_name);
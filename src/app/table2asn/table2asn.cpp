@@ -38,6 +38,8 @@
 #include <corelib/ncbienv.hpp>
 #include <corelib/ncbiargs.hpp>
 #include <corelib/ncbi_mask.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbimtx.hpp>
 
 #include <connect/ncbi_core_cxx.hpp>
 #include <connect/ncbi_util.h>
@@ -80,6 +82,9 @@
 
 #include <misc/data_loaders_util/data_loaders_util.hpp>
 
+#include <deque>
+#include <exception>
+
 #include <common/test_assert.h>  /* This header must go last */
 
 using namespace ncbi;
@@ -103,6 +108,124 @@ protected:
     }
 };
 
+class CTbl2AsnThread;
+
+
+// Messages of a file read ahead with -threads, passed on to the log when
+// the files before it are finished
+class CTbl2AsnFileLog : public CMessageListenerLenient
+{
+public:
+    CTbl2AsnFileLog(ILineErrorListener& log) : m_Log(log) {}
+
+    void Flush(void)
+    {
+        for (size_t i = 0; i < Count(); ++i)
+            m_Log.PutError(GetError(i));
+        ClearAll();
+    }
+
+protected:
+    virtual void PutProgress(
+        const string & sMessage,
+        const Uint8 iNumDone = 0,
+        const Uint8 iNumTotal = 0)
+    {
+        m_Log.PutProgress(sMessage, iNumDone, iNumTotal);
+    }
+
+private:
+    ILineErrorListener& m_Log;
+};
+
+
+// A file finished on a worker thread with -threads.  The main thread reads
+// and annotates the files in the input order, the workers clean them up,
+// validate them and write the results.  The results are written under
+// temporary names and renamed in the input order, so that nothing after
+// a failed file is left, as with one thread.
+class CTbl2AsnFile : public CObject
+{
+public:
+    CTbl2AsnFile(size_t index, ILineErrorListener& log) :
+        m_Index(index), m_Log(log), m_Done(false) {}
+
+    string PendingName(const string& name);
+    void Commit(bool with_result);
+    void Discard(void);
+
+    size_t                 m_Index;     // in the input order
+    string                 m_InputFile;
+    CRef<CScope>           m_Scope;
+    CRef<CSeq_entry>       m_Entry;
+    CRef<CSeq_submit>      m_Submit;
+    CRef<CSerialObject>    m_Result;
+    CSeq_entry_EditHandle  m_EditHandle;
+    // the per-file reports
+    CFixSuspectProductName m_SuspectRules;
+    auto_ptr<CNcbiOfstream> m_ECNumbers;
+    string                 m_ECNumbersFile;
+    string                 m_ValidationFile;
+    string                 m_OutputFile;
+    CTbl2AsnFileLog        m_Log;
+    // (temporary, final) names of the per-file outputs
+    typedef vector< pair<string, string> > TPending;
+    TPending               m_Pending;
+
+    bool                   m_Done;
+    exception_ptr          m_Exception;
+};
+
+
+string CTbl2AsnFile::PendingName(const string& name)
+{
+    m_Pending.push_back(make_pair(name + ".tbl2asn-pending", name));
+    return m_Pending.back().first;
+}
+
+// Renames the outputs written, but the .sqn file if the file was not
+// finished: with one thread it is written last
+void CTbl2AsnFile::Commit(bool with_result)
+{
+    ITERATE(TPending, it, m_Pending)
+    {
+        CFile pending(it->first);
+        if (!pending.Exists())
+            continue;
+        if (!with_result && it->second == m_OutputFile)
+            pending.Remove();
+        else
+            pending.Rename(it->second, CDirEntry::fRF_Overwrite);
+    }
+    m_Pending.clear();
+}
+
+void CTbl2AsnFile::Discard(void)
+{
+    ITERATE(TPending, it, m_Pending)
+    {
+        CFile(it->first).Remove();
+    }
+    m_Pending.clear();
+}
+
+
+// Files read so far and not finished yet
+struct STbl2AsnQueue
+{
+    STbl2AsnQueue(void) : m_First(0), m_Next(0), m_Failed(kMax_Int), m_Stop(false) {}
+
+    deque< CRef<CTbl2AsnFile> > m_Files;
+    size_t             m_First;     // Number of the files finished
+    size_t             m_Next;      // Next file to pass to a worker
+    size_t             m_Failed;    // First file failed, the later ones are skipped
+    bool               m_Stop;
+    CFastMutex         m_Lock;
+    CConditionVariable m_FileAdded;
+    CConditionVariable m_FileDone;
+};
+
+
 class CTbl2AsnApp : public CNcbiApplication
 {
 public:
@@ -116,6 +239,7 @@ public:
     }
 
 private:
+    friend class CTbl2AsnThread;
 
     static const CDataLoadersUtil::TLoaders default_loaders = CDataLoadersUtil::fGenbank | CDataLoadersUtil::fVDB | CDataLoadersUtil::fGenbankOffByDefault;
     void Setup(const CArgs& args);
@@ -123,6 +247,20 @@ private:
     string GenerateOutputFilename(const CTempString& ext) const;
     void ProcessOneFile();
     void ProcessOneFile(CRef<CSerialObject>& result);
+    bool x_PrepareFile(CRef<CSerialObject>& result, CRef<CSeq_entry>& entry,
+        CRef<CSeq_submit>& submit, CSeq_entry_EditHandle& entry_edit_handle);
+    void x_CleanupAndValidate(CTable2AsnValidator& validator, CFixSuspectProductName& suspect_rules,
+        CSeq_entry_EditHandle& entry_edit_handle, CRef<CSeq_entry> entry, CRef<CSeq_submit> submit,
+        const string& ecn_file, auto_ptr<CNcbiOfstream>& ecn_stream, const string& val_file);
+    void x_WriteResult(const CSerialObject& obj, const string& local_file);
+
+    // With -threads the files of the input directory are processed
+    // concurrently, see CTbl2AsnFile
+    void x_SubmitFile();
+    void FinishFile(CTable2AsnValidator& validator, CTbl2AsnFile& file);
+    void x_FinishFirstFile();
+    void x_FinishFiles();
+    void x_StopThreads();
     bool ProcessOneDirectory(const CDir& directory, const CMask& mask, bool recurse);
     void ProcessSecretFiles(CSeq_entry& result);
     void ProcessSRCFileAndQualifiers(const string& pathname, CSeq_entry& result, const string& opt_map_xml);
@@ -144,6 +282,10 @@ private:
     auto_ptr<CForeignContaminationScreenReportReader> m_fcs_reader;
     CTable2AsnContext    m_context;
 
+    unsigned int m_NThreads;
+    STbl2AsnQueue m_Queue;
+    vector< CRef<CTbl2AsnThread> > m_Threads;
+
     //bool m_Continue;
     //bool m_OnlyAnnots;
 
@@ -151,7 +293,25 @@ private:
     //EDiagSev m_HighCutoff;
 };
 
-CTbl2AsnApp::CTbl2AsnApp(void)
+class CTbl2AsnThread : public CThread
+{
+public:
+    CTbl2AsnThread(CTbl2AsnApp& app) :
+        m_Validator(new CTable2AsnValidator(app.m_context)), m_App(app)
+    {}
+
+    // Each thread collects its own validation statistics
+    CRef<CTable2AsnValidator> m_Validator;
+
+protected:
+    virtual void* Main(void);
+
+private:
+    CTbl2AsnApp& m_App;
+};
+
+
+CTbl2AsnApp::CTbl2AsnApp(void) : m_NThreads(1)
 {
     SetVersionByBuild(1);
 }
@@ -351,6 +511,12 @@ void CTbl2AsnApp::Init(void)
     arg_desc->AddOptionalKey("logfile", "LogFile", "Error Log File", CArgDescriptions::eOutputFile);
     arg_desc->AddFlag("split-logs", "Create unique log file for each output file");
 
+    arg_desc->AddDefaultKey("threads", "Integer",
+        "Number of threads processing the files of the input directory concurrently "
+        "(not used with -o and -split-logs, the results are the same as with one thread)",
+        CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(1, kMax_Int));
+
     CDataLoadersUtil::AddArgumentDescriptions(*arg_desc, default_loaders);
 
     // Program description
@@ -687,6 +853,11 @@ int CTbl2AsnApp::Run(void)
     if (args["suspect-rules"])
         m_context.m_suspect_rules.SetFilename(args["suspect-rules"].AsString());
 
+    // the per-file logs and a common output file are written in the input order
+    m_NThreads = args["threads"].AsInteger();
+    if (m_NThreads > 1 && (IsDryRun() || m_context.m_output != 0 || m_context.m_split_log_files))
+        m_NThreads = 1;
+
     try
     {
         if (args["t"])
@@ -735,7 +906,17 @@ int CTbl2AsnApp::Run(void)
                 CMaskFileName masks;
                 masks.Add("*" + args["x"].AsString());
 
-                ProcessOneDirectory(directory, masks, args["E"].AsBoolean());
+                try
+                {
+                    ProcessOneDirectory(directory, masks, args["E"].AsBoolean());
+                    x_FinishFiles();
+                }
+                catch (...)
+                {
+                    x_StopThreads();
+                    throw;
+                }
+                x_StopThreads();
             }
         }
         if (m_validator->TotalErrors() > 0)
@@ -808,7 +989,24 @@ void CTbl2AsnApp::ProcessOneFile(CRef<CSerialObject>& result)
 {
     CRef<CSeq_entry> entry;
     CRef<CSeq_submit> submit;
+    CSeq_entry_EditHandle entry_edit_handle;
+
+    if (!x_PrepareFile(result, entry, submit, entry_edit_handle))
+        return;
+
+    x_CleanupAndValidate(*m_validator, m_context.m_suspect_rules, entry_edit_handle, entry, submit,
+        GenerateOutputFilename(".ecn"), m_context.m_ecn_numbers_ostream, GenerateOutputFilename(".val"));
+
+    if (!IsDryRun() && !m_context.m_discrepancy_file.empty())
+    {
+        m_validator->ReportDiscrepancies(submit.Empty() ? (CSerialObject&)*entry : (CSerialObject&)*submit, *m_context.m_scope, m_context.m_disc_eucariote, m_context.m_disc_lineage);
+    }
+}
 
+// Reads and annotates the current file
+bool CTbl2AsnApp::x_PrepareFile(CRef<CSerialObject>& result, CRef<CSeq_entry>& entry,
+    CRef<CSeq_submit>& submit, CSeq_entry_EditHandle& entry_edit_handle)
+{
     m_context.m_avoid_orf_lookup = false;
     bool avoid_submit_block = false;
     bool do_dates = false;
@@ -819,7 +1017,7 @@ void CTbl2AsnApp::ProcessOneFile(CRef<CSerialObject>& result)
         COpticalxml2asnOperator op;
         entry = op.LoadXML(m_context.m_current_file, m_context);
         if (entry.IsNull())
-            return;
+            return false;
     }
     else
     {
@@ -914,7 +1112,7 @@ void CTbl2AsnApp::ProcessOneFile(CRef<CSerialObject>& result)
 
     //m_context.MakeGenomeCenterId(*entry);
 
-    CSeq_entry_EditHandle entry_edit_handle = m_context.m_scope->AddTopLevelSeqEntry(*entry).GetEditHandle();
+    entry_edit_handle = m_context.m_scope->AddTopLevelSeqEntry(*entry).GetEditHandle();
 
     fr.MakeGapsFromFeatures(entry_edit_handle);
 
@@ -945,9 +1143,17 @@ void CTbl2AsnApp::ProcessOneFile(CRef<CSerialObject>& result)
     // make asn.1 look nicier
     edit::SortSeqDescr(*entry);
 
+    return true;
+}
+
+// Does not use the state of the current file, called on the worker threads
+void CTbl2AsnApp::x_CleanupAndValidate(CTable2AsnValidator& validator, CFixSuspectProductName& suspect_rules,
+    CSeq_entry_EditHandle& entry_edit_handle, CRef<CSeq_entry> entry, CRef<CSeq_submit> submit,
+    const string& ecn_file, auto_ptr<CNcbiOfstream>& ecn_stream, const string& val_file)
+{
     if (m_context.m_cleanup.find('-') == string::npos)
     {
-       m_validator->Cleanup(entry_edit_handle, m_context.m_cleanup);
+       validator.Cleanup(entry_edit_handle, m_context.m_cleanup, &suspect_rules);
     }
 
     CFeatureTableReader ftr(m_context);
@@ -955,16 +1161,11 @@ void CTbl2AsnApp::ProcessOneFile(CRef<CSerialObject>& result)
 
     if (!IsDryRun())
     {
-        m_validator->UpdateECNumbers(entry_edit_handle, GenerateOutputFilename(".ecn"), m_context.m_ecn_numbers_ostream);
+        validator.UpdateECNumbers(entry_edit_handle, ecn_file, ecn_stream);
 
         if (!m_context.m_validate.empty())
         {
-            m_validator->Validate(submit, entry, m_context.m_validate, GenerateOutputFilename(".val"));
-        }
-
-        if (!m_context.m_discrepancy_file.empty())
-        {
-            m_validator->ReportDiscrepancies(submit.Empty() ? (CSerialObject&)*entry : (CSerialObject&)*submit, *m_context.m_scope, m_context.m_disc_eucariote, m_context.m_disc_lineage);
+            validator.Validate(submit, entry, m_context.m_validate, val_file);
         }
     }
 }
@@ -1029,64 +1230,292 @@ void CTbl2AsnApp::ProcessOneFile()
 
         if (!IsDryRun() && obj.NotEmpty())
         {
-            const CSerialObject* to_write = obj;
-            if (m_context.m_save_bioseq_set)
-            {
-                if (obj->GetThisTypeInfo()->IsType(CSeq_entry::GetTypeInfo()))
-                {
-                    const CSeq_entry* se = (const CSeq_entry*)obj.GetPointer();
-                    if (se->IsSet())
-                        to_write = &se->GetSet();
-                }
-            }
-
-            CFile local_file;
-            CNcbiOstream* output(0);
-
             if (m_context.m_output == 0)
-            {
-                local_file = GenerateOutputFilename(m_context.m_asn1_suffix);
-                output = new CNcbiOfstream(local_file.GetPath().c_str());
                 m_context.m_ecn_numbers_ostream.release();
-            }
-            else
+
+            x_WriteResult(*obj, GenerateOutputFilename(m_context.m_asn1_suffix));
+        }
+
+        if (!log_name.GetPath().empty())
+        {
+            m_logger->SetProgressOstream(&NcbiCout);
+        }
+    }
+    catch (...)
+    {
+        if (!log_name.GetPath().empty())
+        {
+            m_logger->SetProgressOstream(&NcbiCout);
+        }
+
+        throw;
+    }
+}
+
+// Writes to local_file unless a single output file is given
+void CTbl2AsnApp::x_WriteResult(const CSerialObject& obj, const string& local_file_name)
+{
+    const CSerialObject* to_write = &obj;
+    if (m_context.m_save_bioseq_set)
+    {
+        if (obj.GetThisTypeInfo()->IsType(CSeq_entry::GetTypeInfo()))
+        {
+            const CSeq_entry* se = (const CSeq_entry*)&obj;
+            if (se->IsSet())
+                to_write = &se->GetSet();
+        }
+    }
+
+    CFile local_file;
+    CNcbiOstream* output(0);
+
+    if (m_context.m_output == 0)
+    {
+        local_file = local_file_name;
+        output = new CNcbiOfstream(local_file.GetPath().c_str());
+    }
+    else
+    {
+        output = m_context.m_output;
+    }
+
+    try
+    {
+        m_reader->WriteObject(*to_write, *output);
+        if (m_context.m_output == 0)
+            delete output;
+        output = 0;
+    }
+    catch (...)
+    {
+        // if something goes wrong - remove the partial output to avoid confuse
+        if (m_context.m_output == 0)
+        {
+            local_file.Remove();
+            delete output;
+        }
+        throw;
+    }
+}
+
+void CTbl2AsnApp::x_SubmitFile()
+{
+    CFile file(m_context.m_current_file);
+    if (!file.Exists())
+    {
+        // logged after the messages of the files before it
+        x_FinishFiles();
+        m_logger->PutError(*auto_ptr<CLineError>(
+            CLineError::Create(ILineError::eProblem_GeneralParsingError, eDiag_Error, "", 0,
+                "File " + m_context.m_current_file + " does not exists")));
+        return;
+    }
+
+    if (m_Threads.empty())
+    {
+        for (unsigned int i = 0; i < m_NThreads; ++i)
+        {
+            CRef<CTbl2AsnThread> thread(new CTbl2AsnThread(*this));
+            thread->Run();
+            m_Threads.push_back(thread);
+        }
+    }
+
+    // Limit the number of files held in memory. Only this thread adds
+    // and removes the files, so the size can be read without the lock.
+    while (m_Queue.m_Files.size() >= 2 * m_NThreads)
+        x_FinishFirstFile();
+
+    // each file gets its own scope, the workers use them concurrently
+    CRef<CTbl2AsnFile> next(new CTbl2AsnFile(m_Queue.m_First + m_Queue.m_Files.size(), *m_logger));
+    next->m_InputFile = m_context.m_current_file;
+    m_context.m_scope.Reset(new CScope(*m_context.m_ObjMgr));
+    m_context.m_scope->AddDefaults();
+    next->m_Scope = m_context.m_scope;
+
+    // the messages are logged when the files before this one are finished
+    m_context.m_logger = &next->m_Log;
+    try
+    {
+        bool prepared = x_PrepareFile(next->m_Result, next->m_Entry, next->m_Submit, next->m_EditHandle);
+        m_context.m_logger = m_logger;
+        if (!prepared)
+        {
+            x_FinishFiles();
+            next->m_Log.Flush();
+            return;
+        }
+    }
+    catch (...)
+    {
+        // the files before this one are finished first, as with one thread
+        m_context.m_logger = m_logger;
+        exception_ptr e = current_exception();
+        x_FinishFiles();
+        next->m_Log.Flush();
+        rethrow_exception(e);
+    }
+
+    next->m_ECNumbersFile = next->PendingName(GenerateOutputFilename(".ecn"));
+    next->m_ValidationFile = next->PendingName(GenerateOutputFilename(".val"));
+    next->m_OutputFile = next->PendingName(GenerateOutputFilename(m_context.m_asn1_suffix));
+
+    // the report of the fixed product names is continued on the worker
+    CFixSuspectProductName& rules = m_context.m_suspect_rules;
+    next->m_SuspectRules.SetFilename(rules.GetFilename());
+    if (!rules.m_fixed_product_report_filename.empty())
+    {
+        if (rules.m_report_ostream.get() == 0)
+            next->m_SuspectRules.m_fixed_product_report_filename =
+                next->PendingName(rules.m_fixed_product_report_filename);
+        else
+            next->m_SuspectRules.m_fixed_product_report_filename = rules.m_fixed_product_report_filename;
+    }
+    next->m_SuspectRules.m_report_ostream.reset(rules.m_report_ostream.release());
+
+    CFastMutexGuard guard(m_Queue.m_Lock);
+    m_Queue.m_Files.push_back(next);
+    m_Queue.m_FileAdded.SignalSome();
+}
+
+void* CTbl2AsnThread::Main(void)
+{
+    STbl2AsnQueue& queue = m_App.m_Queue;
+    for (;;)
+    {
+        CRef<CTbl2AsnFile> file;
+        bool skip = false;
+        {{
+            CFastMutexGuard guard(queue.m_Lock);
+            while (!queue.m_Stop &&
+                   queue.m_Next >= queue.m_First + queue.m_Files.size())
             {
-                output = m_context.m_output;
+                queue.m_FileAdded.WaitForSignal(queue.m_Lock);
             }
+            if (queue.m_Stop)
+                break;
+            file = queue.m_Files[queue.m_Next++ - queue.m_First];
+            // nothing after a failed file is processed, as with one thread
+            skip = file->m_Index > queue.m_Failed;
+        }}
 
+        if (!skip)
+        {
             try
             {
-                m_reader->WriteObject(*to_write, *output);
-                if (m_context.m_output == 0)
-                    delete output;
-                output = 0;
+                m_App.FinishFile(*m_Validator, *file);
             }
             catch (...)
             {
-                // if something goes wrong - remove the partial output to avoid confuse
-                if (m_context.m_output == 0)
-                {
-                    local_file.Remove();
-                    delete output;
-                }
-                throw;
+                file->m_Exception = current_exception();
             }
         }
 
-        if (!log_name.GetPath().empty())
-        {
-            m_logger->SetProgressOstream(&NcbiCout);
-        }
+        CFastMutexGuard guard(queue.m_Lock);
+        if (file->m_Exception && file->m_Index < queue.m_Failed)
+            queue.m_Failed = file->m_Index;
+        file->m_Done = true;
+        queue.m_FileDone.SignalAll();
+    }
+    return 0;
+}
+
+// Called on a worker thread
+void CTbl2AsnApp::FinishFile(CTable2AsnValidator& validator, CTbl2AsnFile& file)
+{
+    try
+    {
+        x_CleanupAndValidate(validator, file.m_SuspectRules, file.m_EditHandle, file.m_Entry, file.m_Submit,
+            file.m_ECNumbersFile, file.m_ECNumbers, file.m_ValidationFile);
+
+        if (file.m_Result.NotEmpty())
+            x_WriteResult(*file.m_Result, file.m_OutputFile);
     }
     catch (...)
     {
-        if (!log_name.GetPath().empty())
+        // close the reports, they are kept as with one thread
+        file.m_ECNumbers.reset();
+        file.m_SuspectRules.m_report_ostream.reset();
+        throw;
+    }
+
+    file.m_ECNumbers.reset();
+    file.m_SuspectRules.m_report_ostream.reset();
+}
+
+void CTbl2AsnApp::x_FinishFirstFile()
+{
+    {{
+        CFastMutexGuard guard(m_Queue.m_Lock);
+        while (!m_Queue.m_Files.front()->m_Done)
+            m_Queue.m_FileDone.WaitForSignal(m_Queue.m_Lock);
+    }}
+
+    CTbl2AsnFile& file = *m_Queue.m_Files.front();
+    file.m_Log.Flush();
+    if (file.m_Exception)
+    {
+        // Same as with one thread: stop at the first failure, keeping what
+        // was written for the failed file
+        file.Commit(false);
+        exception_ptr e = file.m_Exception;
+        x_StopThreads();
+        rethrow_exception(e);
+    }
+
+    // The discrepancy report is written in the input order, and before
+    // the .sqn file
+    if (!m_context.m_discrepancy_file.empty())
+    {
+        CSerialObject& obj = file.m_Submit.Empty() ? (CSerialObject&)*file.m_Entry : (CSerialObject&)*file.m_Submit;
+        try
         {
-            m_logger->SetProgressOstream(&NcbiCout);
+            m_validator->ReportDiscrepancies(obj, *file.m_Scope, file.m_InputFile, m_context.m_disc_lineage);
+        }
+        catch (...)
+        {
+            file.Commit(false);
+            throw;
         }
+    }
+    file.Commit(true);
 
-        throw;
+    CFastMutexGuard guard(m_Queue.m_Lock);
+    m_Queue.m_Files.pop_front();
+    m_Queue.m_First++;
+}
+
+void CTbl2AsnApp::x_FinishFiles()
+{
+    while (!m_Queue.m_Files.empty())
+        x_FinishFirstFile();
+}
+
+// Stops the worker threads, the files not finished yet are dropped with
+// their outputs
+void CTbl2AsnApp::x_StopThreads()
+{
+    {{
+        CFastMutexGuard guard(m_Queue.m_Lock);
+        m_Queue.m_Stop = true;
+        m_Queue.m_FileAdded.SignalAll();
+    }}
+    NON_CONST_ITERATE(vector< CRef<CTbl2AsnThread> >, it, m_Threads)
+    {
+        (*it)->Join();
+        m_validator->MergeErrorStats(*(*it)->m_Validator);
+    }
+    m_Threads.clear();
+
+    NON_CONST_ITERATE(deque< CRef<CTbl2AsnFile> >, it, m_Queue.m_Files)
+    {
+        (*it)->Discard();
     }
+    m_Queue.m_Files.clear();
+    m_Queue.m_First = 0;
+    m_Queue.m_Next = 0;
+    m_Queue.m_Failed = kMax_Int;
+    m_Queue.m_Stop = false;
 }
 
 bool CTbl2AsnApp::ProcessOneDirectory(const CDir& directory, const CMask& mask, bool recurse)
@@ -1102,7 +1531,10 @@ bool CTbl2AsnApp::ProcessOneDirectory(const CDir& directory, const CMask& mask,
             if (mask.Match((*it)->GetPath()))
             {
                 m_context.m_current_file = (*it)->GetPath();
-                ProcessOneFile();
+                if (m_NThreads > 1)
+                    x_SubmitFile();
+                else
+                    ProcessOneFile();
             }
         }
         else
@@ -1121,7 +1553,8 @@ void CTbl2AsnApp::Setup(const CArgs& args)
     CORE_SetLOG(LOG_cxx2c());
     CORE_SetREG(REG_cxx2c(&GetConfig(), false));
     // Setup MT-safety for CONNECT library
-    // CORE_SetLOCK(MT_LOCK_cxx2c());
+    if (args["threads"].AsInteger() > 1)
+        CORE_SetLOCK(MT_LOCK_cxx2c());
 
     // Create object manager and scope
 
@@ -1205,7 +1638,7 @@ void CTbl2AsnApp::ProcessCMTFile(const string& pathname, CSeq_entry& result, boo
 
     CRef<ILineReader> reader(ILineReader::New(pathname));
 
-    CTable2AsnStructuredCommentsReader cmt_reader(m_logger);
+    CTable2AsnStructuredCommentsReader cmt_reader(m_context.m_logger);
 
     if (byrows)
         cmt_reader.ProcessCommentsFileByRows(*reader, result);
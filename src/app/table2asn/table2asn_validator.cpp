@@ -55,7 +55,7 @@ CTable2AsnValidator::CTable2AsnValidator(CTable2AsnContext& ctx) : m_stats(CVali
 {
 }
 
-void CTable2AsnValidator::Cleanup(CSeq_entry_Handle& h_entry, const string& flags)
+void CTable2AsnValidator::Cleanup(CSeq_entry_Handle& h_entry, const string& flags, CFixSuspectProductName* suspect_rules)
 {
     CRef<CSeq_entry> entry((CSeq_entry*)(h_entry.GetEditHandle().GetCompleteSeq_entry().GetPointer()));
     bool need_recalculate_index = false;
@@ -87,7 +87,9 @@ void CTable2AsnValidator::Cleanup(CSeq_entry_Handle& h_entry, const string& flag
 
     if (flags.find('f') != string::npos)
     {        
-        m_context->m_suspect_rules.FixSuspectProductNames((*(CSeq_entry*)h_entry.GetCompleteSeq_entry().GetPointer()));
+        if (suspect_rules == 0)
+            suspect_rules = &m_context->m_suspect_rules;
+        suspect_rules->FixSuspectProductNames((*(CSeq_entry*)h_entry.GetCompleteSeq_entry().GetPointer()));
     }
 
     if (flags.find('s') != string::npos)
@@ -150,6 +152,18 @@ size_t CTable2AsnValidator::TotalErrors() const
     return result;
 }
 
+void CTable2AsnValidator::MergeErrorStats(const CTable2AsnValidator& other)
+{
+    for (size_t sev = 0; sev < other.m_stats.size() && sev < m_stats.size(); sev++)
+    {
+        m_stats[sev].m_total += other.m_stats[sev].m_total;
+        ITERATE(TErrorStatMap, it, other.m_stats[sev].m_individual)
+        {
+            m_stats[sev].m_individual[it->first] += it->second;
+        }
+    }
+}
+
 void CTable2AsnValidator::ReportErrorStats(CNcbiOstream& out)
 {
     out << "Total messages:\t\t" << NStr::NumericToString(TotalErrors()) << endl << endl << big_separator << endl;
@@ -174,11 +188,16 @@ void CTable2AsnValidator::ReportErrorStats(CNcbiOstream& out)
 }
 
 void CTable2AsnValidator::ReportDiscrepancies(CSerialObject& obj, CScope& scope, bool eucariote, const string& lineage)
+{
+    ReportDiscrepancies(obj, scope, m_context->m_current_file, lineage);
+}
+
+void CTable2AsnValidator::ReportDiscrepancies(CSerialObject& obj, CScope& scope, const string& filename, const string& lineage)
 {
     CRef<NDiscrepancy::CDiscrepancySet> tests = NDiscrepancy::CDiscrepancySet::New(scope);
     vector<string> names = NDiscrepancy::GetDiscrepancyNames(NDiscrepancy::eSubmitter);
     tests->AddTests(names);
-    tests->SetFile(m_context->m_current_file);
+    tests->SetFile(filename);
     tests->SetLineage(lineage);
     tests->Parse(obj);
     tests->Summarize();
@@ -11,6 +11,7 @@ namespace objects
     class CValidError;
     class CSeq_submit;
     class CScope;
+    class CFixSuspectProductName;
 };
 
 class CTable2AsnContext;
@@ -19,12 +20,16 @@ class CTable2AsnValidator: public CObject
 public:
     CTable2AsnValidator(CTable2AsnContext& ctx);
     void Validate(CRef<objects::CSeq_submit> submit, CRef<objects::CSeq_entry> entry, const string& flags, const string& report_name);
-    void Cleanup(objects::CSeq_entry_Handle& entry, const string& flags);
+    // suspect_rules defaults to the ones of the context
+    void Cleanup(objects::CSeq_entry_Handle& entry, const string& flags, objects::CFixSuspectProductName* suspect_rules = 0);
     void UpdateECNumbers(objects::CSeq_entry_Handle seh, const string& fname, auto_ptr<CNcbiOfstream>& ostream);
     void ReportErrors(CConstRef<objects::CValidError> errors, CNcbiOstream& out);
     void ReportErrorStats(CNcbiOstream& out);
     size_t TotalErrors() const; 
+    // add the error statistics of a validator used on another thread
+    void MergeErrorStats(const CTable2AsnValidator& other);
     void ReportDiscrepancies(CSerialObject& obj, objects::CScope& scope, bool eucariote, const string& lineage);
+    void ReportDiscrepancies(CSerialObject& obj, objects::CScope& scope, const string& filename, const string& lineage);
 
 protected:
     typedef map<int, size_t> TErrorStatMap;
@@ -0,0 +1,76 @@
+#! /bin/sh
+# $Id$
+#
+# The results of an input directory are the same with several threads
+# as with one: the .sqn, .val and .ecn files, the discrepancy report,
+# and nothing is written after a file that fails.
+
+TMP_DIR=`mktemp -d -t test_table2asn_threads.XXXXXXXX`
+trap 'rm -rf "$TMP_DIR"' 0 1 2 15
+
+RETVAL=0
+
+make_inputs()
+{
+    mkdir -p "$1"
+    i=1
+    while [ $i -le 16 ] ; do
+        name=`printf "seq%02d" $i`
+        {
+            echo ">$name [organism=Escherichia coli] [moltype=genomic DNA]"
+            echo "ATGAAACGCATTAGCACCACCATTACCACCACCATCACCATTACCACAGGTAACGGTGCGGGCTGA"
+            echo "ATGCAAAGCTTTGAGCGTTTTGCAGCTGATGCCGCGGTCTTCAACGACAAAGCTGTTTTAATAA"
+        } > "$1/$name.fsa"
+        {
+            echo ">Feature lcl|$name"
+            echo "1	66	gene"
+            echo "			gene	thrL$i"
+            echo "1	66	CDS"
+            echo "			product	thr operon leader peptide"
+            echo "			EC_number	1.1.1.$i"
+            echo "67	131	misc_feature"
+            echo "			note	feature $i"
+        } > "$1/$name.tbl"
+        i=`expr $i + 1`
+    done
+}
+
+run_table2asn()
+{
+    # $1 - input directory, $2 - output directory, $3 - threads
+    mkdir -p "$2"
+    ./table2asn -indir "$1" -outdir "$2" -threads $3 -V v -Z "$2/disc.txt" \
+        -logfile "$2/log.txt" > /dev/null 2>&1
+    echo $? > "$2/exit_code"
+    # the log and the discrepancy report name the output directory
+    for f in "$2/log.txt" "$2/disc.txt" ; do
+        if [ -f "$f" ] ; then
+            sed -e "s:$2::g" "$f" > "$f.tmp" && mv "$f.tmp" "$f"
+        fi
+    done
+}
+
+compare_runs()
+{
+    # $1 - input directory, $2 - test name
+    run_table2asn "$1" "$TMP_DIR/$2.1" 1
+    for threads in 2 4 7 ; do
+        run_table2asn "$1" "$TMP_DIR/$2.$threads" $threads
+        if diff -r "$TMP_DIR/$2.1" "$TMP_DIR/$2.$threads" ; then
+            echo "$2, $threads threads: OK"
+        else
+            echo "$2, $threads threads: the results differ from one thread"
+            RETVAL=1
+        fi
+    done
+}
+
+make_inputs "$TMP_DIR/in"
+compare_runs "$TMP_DIR/in" good
+
+# a file that can't be read in the middle of the input directory
+make_inputs "$TMP_DIR/in_bad"
+printf ">seq05\n\001\002\003\n" > "$TMP_DIR/in_bad/seq05.fsa"
+compare_runs "$TMP_DIR/in_bad" bad
+
+exit $RETVAL
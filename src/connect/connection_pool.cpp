@@ -34,6 +34,7 @@
 #include <ncbi_pch.hpp>
 #include <connect/error_codes.hpp>
 #include "connection_pool.hpp"
+#include "server_reactor.hpp"
 
 
 #define NCBI_USE_ERRCODE_X   Connect_ThrServer
@@ -57,7 +58,8 @@ std::string g_ServerConnTypeToString(enum EServerConnType  conn_type)
 
 
 CServer_ConnectionPool::CServer_ConnectionPool(unsigned max_connections) :
-    m_MaxConnections(max_connections), m_ListeningStarted(false)
+    m_MaxConnections(max_connections), m_ListeningStarted(false),
+    m_NumReactors(0), m_NextReactor(0)
 {}
 
 CServer_ConnectionPool::~CServer_ConnectionPool()
@@ -78,6 +80,8 @@ void CServer_ConnectionPool::Erase(void)
         delete *it;
     }
     m_Data.clear();
+    // Reactors own the sibling listeners, so they go after the pool
+    m_Reactors.clear();
 }
 
 void CServer_ConnectionPool::x_UpdateExpiration(TConnBase* conn)
@@ -104,6 +108,7 @@ bool CServer_ConnectionPool::Add(TConnBase* conn, EServerConnType type)
     conn->type = type;
     conn->type_lock.Unlock();
 
+    CServer_Reactor* reactor = NULL;
     {{
         CMutexGuard guard(m_Mutex);
         if (m_Data.size() >= m_MaxConnections)
@@ -112,20 +117,47 @@ bool CServer_ConnectionPool::Add(TConnBase* conn, EServerConnType type)
         if (m_Data.find(conn) != m_Data.end())
             abort();
         m_Data.insert(conn);
+
+        if ( !m_Reactors.empty() ) {
+            // Accepted connections stay with the reactor of the listener
+            // that accepted them, the rest are spread round-robin.
+            reactor = conn->reactor;
+            if (type == eListener)
+                reactor = m_Reactors[0].GetPointer();
+            else if (reactor == NULL)
+                reactor = x_NextReactor();
+        }
     }}
 
-    if (type == eListener)
+    if (type == eListener) {
+        if (m_NumReactors > 0) {
+            CServer_Listener* listener = dynamic_cast<CServer_Listener*>(conn);
+            if (listener)
+                listener->SetReusePort();
+        }
         if (m_ListeningStarted)
             // That's a new listener which should be activated right away
             // because the StartListening() had already been called earlier
             // (e.g. in CServer::Run())
             conn->Activate();
+    }
 
-    PingControlConnection();
+    if (reactor != NULL)
+        x_Register(conn, reactor);
+    else
+        PingControlConnection();
     return true;
 }
 
 void CServer_ConnectionPool::Remove(TConnBase* conn)
+{
+    CServer_Reactor* reactor = conn->reactor;
+    if (reactor != NULL)
+        reactor->Unregister(conn);
+    Forget(conn);
+}
+
+void CServer_ConnectionPool::Forget(TConnBase* conn)
 {
     CMutexGuard guard(m_Mutex);
     m_Data.erase(conn);
@@ -168,8 +200,12 @@ bool CServer_ConnectionPool::RemoveListener(unsigned short  port)
         }
     }}
 
-    if (found)
+    if (found) {
         PingControlConnection();
+        NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+            (*it)->StopListener(port);
+        }
+    }
     else
         ERR_POST(Warning << "No listener on port " << port << " found");
     return found;
@@ -178,9 +214,9 @@ bool CServer_ConnectionPool::RemoveListener(unsigned short  port)
 
 void CServer_ConnectionPool::SetConnType(TConnBase* conn, EServerConnType type)
 {
+    EServerConnType new_type = type;
     conn->type_lock.Lock();
     if (conn->type != eClosedSocket) {
-        EServerConnType new_type = type;
         if (type == eInactiveSocket) {
             if (conn->type == ePreDeferredSocket)
                 new_type = eDeferredSocket;
@@ -190,13 +226,22 @@ void CServer_ConnectionPool::SetConnType(TConnBase* conn, EServerConnType type)
                 x_UpdateExpiration(conn);
         }
         conn->type = new_type;
+    } else {
+        new_type = eClosedSocket;
     }
+    CServer_Reactor* reactor = conn->reactor;
     conn->type_lock.Unlock();
 
-    // Signal poll cycle to re-read poll vector by sending
-    // byte to control socket
-    if (type == eInactiveSocket)
+    if (type != eInactiveSocket)
+        return;
+    if (reactor != NULL) {
+        // Re-arm the connection in its reactor's poll set
+        reactor->Rearm(conn, new_type);
+    } else {
+        // Signal poll cycle to re-read poll vector by sending
+        // byte to control socket
         PingControlConnection();
+    }
 }
 
 void CServer_ConnectionPool::PingControlConnection(void)
@@ -207,6 +252,9 @@ void CServer_ConnectionPool::PingControlConnection(void)
                    << "PingControlConnection: failed to set control trigger: "
                    << IO_StatusStr(status));
     }
+    NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+        (*it)->WakeUp();
+    }
 }
 
 
@@ -397,6 +445,11 @@ void CServer_ConnectionPool::StartListening(void)
 {
     CMutexGuard guard(m_Mutex);
     ITERATE (TData, it, m_Data) {
+        if (m_NumReactors > 0  &&  (*it)->type == eListener) {
+            CServer_Listener* listener = dynamic_cast<CServer_Listener*>(*it);
+            if (listener)
+                listener->SetReusePort();
+        }
         (*it)->Activate();
     }
     m_ListeningStarted = true;
@@ -405,10 +458,97 @@ void CServer_ConnectionPool::StartListening(void)
 
 void CServer_ConnectionPool::StopListening(void)
 {
+    {{
+        CMutexGuard guard(m_Mutex);
+        ITERATE (TData, it, m_Data) {
+            (*it)->Passivate();
+        }
+    }}
+    NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+        (*it)->StopListening();
+    }
+}
+
+
+void CServer_ConnectionPool::x_Register(TConnBase*       conn,
+                                        CServer_Reactor* reactor)
+{
+    reactor->Register(conn);
+    if (conn->type != eListener)
+        return;
+
+    // Every other reactor gets a listening socket of its own on the
+    // same port, so that accepts are spread by the kernel.
+    CServer_Listener* listener = dynamic_cast<CServer_Listener*>(conn);
+    if (listener == NULL)
+        return;
+    NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+        if (it->GetPointer() != reactor)
+            (*it)->AddListener(*listener);
+    }
+}
+
+
+void CServer_ConnectionPool::StartReactors(
+                                    CPoolOfThreads_ForServer& thread_pool,
+                                    const STimeout*           idle_timeout)
+{
+    if (m_NumReactors == 0  ||  !m_Reactors.empty())
+        return;
+
+    // The reactors are picked under m_Mutex: Add() may already be
+    // spreading new connections over them with x_NextReactor().
+    vector< pair<TConnBase*, CServer_Reactor*> > conns;
+    {{
+        CMutexGuard guard(m_Mutex);
+        for (unsigned int i = 0;  i < m_NumReactors;  ++i) {
+            m_Reactors.push_back(CRef<CServer_Reactor>(
+                new CServer_Reactor(*this, thread_pool, idle_timeout, i)));
+        }
+        ITERATE(TData, it, m_Data) {
+            TConnBase* conn = *it;
+            CServer_Reactor* reactor = m_Reactors[0].GetPointer();
+            if (conn->type != eListener)
+                reactor = x_NextReactor();
+            conns.push_back(make_pair(conn, reactor));
+        }
+    }}
+
+    for (size_t i = 0;  i < conns.size();  ++i) {
+        x_Register(conns[i].first, conns[i].second);
+    }
+
+    NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+        (*it)->Run();
+    }
+}
+
+
+void CServer_ConnectionPool::StopReactors(void)
+{
+    NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+        (*it)->RequestStop();
+    }
+    NON_CONST_ITERATE(TReactors, it, m_Reactors) {
+        (*it)->Join();
+    }
+}
+
+
+void CServer_ConnectionPool::ListenerRemoved(TConnBase* listener)
+{
+    CServer_Listener* srv_listener = dynamic_cast<CServer_Listener*>(listener);
+
     CMutexGuard guard(m_Mutex);
-    ITERATE (TData, it, m_Data) {
-        (*it)->Passivate();
+    if (srv_listener) {
+        vector<unsigned short>::iterator port_it =
+                std::find(m_ListenerPortsToStop.begin(),
+                          m_ListenerPortsToStop.end(),
+                          srv_listener->GetPort());
+        if (port_it != m_ListenerPortsToStop.end())
+            m_ListenerPortsToStop.erase(port_it);
     }
+    m_Data.erase(listener);
 }
 
 
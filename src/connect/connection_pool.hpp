@@ -35,6 +35,7 @@
 
 
 #include <connect/impl/server_connection.hpp>
+#include <corelib/ncbicntr.hpp>
 
 
 /** @addtogroup ThreadedServer
@@ -46,6 +47,10 @@
 BEGIN_NCBI_SCOPE
 
 
+class CServer_Reactor;
+class CPoolOfThreads_ForServer;
+
+
 class CServer_ConnectionPool
 {
 public:
@@ -62,6 +67,9 @@ public:
 
     bool Add(TConnBase* conn, EServerConnType type);
     void Remove(TConnBase* conn);
+    /// Take the connection out of the pool without touching its reactor
+    /// (used by the reactor which has already stopped polling it)
+    void Forget(TConnBase* conn);
     bool RemoveListener(unsigned short  port);
     void PingControlConnection(void);
 
@@ -93,8 +101,40 @@ public:
     ///  currently listened ports
     vector<unsigned short>  GetListenerPorts(void);
 
+    /// Use the given number of epoll reactor threads instead of the
+    /// poll() loop of CServer::Run().  Must be called before
+    /// StartListening().
+    void SetReactorThreads(unsigned int num_reactors) {
+        m_NumReactors = num_reactors;
+    }
+    bool IsReactorMode(void) const { return !m_Reactors.empty(); }
+
+    /// Create the reactor threads and distribute the listeners and
+    /// the connections already in the pool among them
+    void StartReactors(CPoolOfThreads_ForServer& thread_pool,
+                       const STimeout*           idle_timeout);
+    /// Stop the reactor threads and wait for them to exit
+    void StopReactors(void);
+
+    /// Called by the reactor which has stopped and is about to delete
+    /// a listener from the pool
+    void ListenerRemoved(TConnBase* listener);
+
+    /// The trigger set by PingControlConnection()
+    CTrigger& GetControlTrigger(void) { return m_ControlTrigger; }
+
+    /// Count a socket event handled by a reactor.  CServer compares the
+    /// counts to tell when no connection was active for accept_timeout.
+    void NoteActivity(void) { m_Activity.Add(1); }
+    CAtomicCounter::TValue GetActivity(void) const { return m_Activity.Get(); }
+
 private:
     void x_UpdateExpiration(TConnBase* conn);
+    void x_Register(TConnBase* conn, CServer_Reactor* reactor);
+    // Must be called with m_Mutex held
+    CServer_Reactor* x_NextReactor(void) {
+        return m_Reactors[m_NextReactor++ % m_Reactors.size()].GetPointer();
+    }
 
 
     typedef set<TConnBase*> TData;
@@ -112,6 +152,18 @@ private:
     // The access to the container is protected with m_Mutex
     vector<unsigned short>  m_ListenerPortsToStop;
     bool                    m_ListeningStarted;
+
+    // Reactor threads (empty in the poll() loop mode).  The vector is
+    // filled once by StartReactors() and cleared by Erase(), so that
+    // pool threads still finishing their requests after StopReactors()
+    // can safely return connections to the (stopped) reactors.
+    // Lock order: a reactor's own lock may be held while m_Mutex is
+    // taken, but not the other way round.
+    typedef vector< CRef<CServer_Reactor> > TReactors;
+    TReactors               m_Reactors;
+    unsigned int            m_NumReactors;
+    unsigned int            m_NextReactor;
+    CAtomicCounter_WithAutoInit m_Activity;
 };
 
 
@@ -0,0 +1,1313 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Persistent HTTP/1.1 connections for CHttpSession: the connection pool,
+ *   pooled request execution and pipelined CHttpSession::ExecuteAll().
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbi_url.hpp>
+#include <connect/ncbi_connector.h>
+#include <connect/ncbi_http_session.hpp>
+#include <connect/ncbi_socket.hpp>
+#include <connect/ncbi_util.h>
+#include <stdlib.h>
+#include <deque>
+#include <list>
+
+
+BEGIN_NCBI_SCOPE
+
+
+// Maximum number of redirects followed by a pooled request
+static const unsigned kMaxPooledRedirects = 10;
+
+
+static bool s_IsSecure(const CUrl& url)
+{
+    return NStr::EqualNocase(url.GetScheme(), "https");
+}
+
+
+static unsigned short s_GetPort(const CUrl& url)
+{
+    if ( url.GetPort().empty() ) {
+        return s_IsSecure(url) ? 443 : 80;
+    }
+    return NStr::StringToNumeric<unsigned short>(url.GetPort(),
+                                                 NStr::fConvErr_NoThrow);
+}
+
+
+// Connections can be shared by requests having the same key.
+static string s_GetHostKey(const CUrl& url)
+{
+    string host = url.GetHost();
+    return (s_IsSecure(url) ? "https://" : "http://") +
+        NStr::ToLower(host) + ':' +
+        NStr::NumericToString(s_GetPort(url));
+}
+
+
+///////////////////////////////////////////////////////
+//  CHttpConnectionPool::
+//
+
+
+struct CHttpConnectionPool::SConnection
+{
+    // How the body of the response being read ends
+    enum EBody {
+        eBody_None,     // No (more) body
+        eBody_Length,   // After Content-Length bytes
+        eBody_Chunked,  // After the last chunk
+        eBody_Close     // With the connection
+    };
+
+    SConnection(SImpl* pool, const string& key)
+        : m_Pool(pool), m_Key(key), m_Expiration(CTimeout::eInfinite),
+          m_Requests(0), m_InFlight(0),
+          m_Body(eBody_None), m_BodyLeft(0), m_ChunkEnd(false),
+          m_KeepAlive(false)
+    {}
+
+    SImpl*              m_Pool;
+    string              m_Key;
+    unique_ptr<CSocket> m_Socket;
+    CDeadline           m_Expiration; // When idle
+    Uint8               m_Requests;   // Sent over the connection
+    unsigned            m_InFlight;   // Sent and not answered yet
+
+    EBody               m_Body;
+    Uint8               m_BodyLeft;   // In the body or the current chunk
+    bool                m_ChunkEnd;   // Chunk data read, CRLF is not
+    bool                m_KeepAlive;
+};
+
+
+struct CHttpConnectionPool::SImpl
+{
+    struct SHost
+    {
+        SHost(void) : in_use(0) {}
+
+        // Most recently released connections are at the back
+        deque<SConnection*> idle;
+        unsigned            in_use;
+    };
+    typedef map<string, SHost> THosts;
+
+    SImpl(void)
+        : max_idle(8), max_per_host(0), idle_timeout(30, 0),
+          max_pipeline_depth(1)
+    {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+    // Close idle connections not used for the idle timeout.
+    void CloseExpired(SHost& host)
+    {
+        while ( !host.idle.empty()  &&
+                host.idle.front()->m_Expiration.IsExpired() ) {
+            delete host.idle.front();
+            host.idle.pop_front();
+            ++stats.closed;
+            ++stats.expired;
+        }
+    }
+
+    mutable CFastMutex lock;
+    CConditionVariable released;
+    THosts             hosts;
+
+    unsigned           max_idle;
+    unsigned           max_per_host;
+    CTimeout           idle_timeout;
+    unsigned           max_pipeline_depth;
+
+    SStats             stats;
+};
+
+
+CHttpConnectionPool::CHttpConnectionPool(void)
+    : m_Impl(new SImpl)
+{
+}
+
+
+CHttpConnectionPool::~CHttpConnectionPool(void)
+{
+    // Connections in use hold no reference to the pool, but the requests
+    // using them hold their sessions which hold the pool.
+    Purge();
+}
+
+
+void CHttpConnectionPool::SetMaxIdlePerHost(unsigned max_idle)
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    m_Impl->max_idle = max_idle;
+}
+
+
+unsigned CHttpConnectionPool::GetMaxIdlePerHost(void) const
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    return m_Impl->max_idle;
+}
+
+
+void CHttpConnectionPool::SetMaxPerHost(unsigned max_connections)
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    m_Impl->max_per_host = max_connections;
+    m_Impl->released.SignalAll();
+}
+
+
+unsigned CHttpConnectionPool::GetMaxPerHost(void) const
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    return m_Impl->max_per_host;
+}
+
+
+void CHttpConnectionPool::SetIdleTimeout(const CTimeout& timeout)
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    m_Impl->idle_timeout = timeout;
+}
+
+
+CTimeout CHttpConnectionPool::GetIdleTimeout(void) const
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    return m_Impl->idle_timeout;
+}
+
+
+void CHttpConnectionPool::SetMaxPipelineDepth(unsigned depth)
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    m_Impl->max_pipeline_depth = depth ? depth : 1;
+}
+
+
+unsigned CHttpConnectionPool::GetMaxPipelineDepth(void) const
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    return m_Impl->max_pipeline_depth;
+}
+
+
+CHttpConnectionPool::SStats CHttpConnectionPool::GetStats(void) const
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    SStats stats = m_Impl->stats;
+    stats.idle = stats.in_use = stats.hosts = 0;
+    ITERATE(SImpl::THosts, it, m_Impl->hosts) {
+        stats.idle += it->second.idle.size();
+        stats.in_use += it->second.in_use;
+        if ( !it->second.idle.empty()  ||  it->second.in_use ) {
+            ++stats.hosts;
+        }
+    }
+    return stats;
+}
+
+
+void CHttpConnectionPool::Purge(void)
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    SImpl::THosts::iterator it = m_Impl->hosts.begin();
+    while (it != m_Impl->hosts.end()) {
+        m_Impl->stats.closed += it->second.idle.size();
+        ITERATE(deque<SConnection*>, conn, it->second.idle) {
+            delete *conn;
+        }
+        it->second.idle.clear();
+        if ( it->second.in_use ) {
+            ++it;
+        }
+        else {
+            m_Impl->hosts.erase(it++);
+        }
+    }
+}
+
+
+CHttpConnectionPool::SConnection*
+CHttpConnectionPool::x_Acquire(const CUrl&     url,
+                               const STimeout* timeout,
+                               bool            wait)
+{
+    string key = s_GetHostKey(url);
+    {{
+        CFastMutexGuard guard(m_Impl->lock);
+        for (;;) {
+            // Look the host up each time, Purge() may remove it while waiting.
+            SImpl::SHost& host = m_Impl->hosts[key];
+            m_Impl->CloseExpired(host);
+            if ( !host.idle.empty() ) {
+                SConnection* conn = host.idle.back();
+                host.idle.pop_back();
+                ++host.in_use;
+                conn->m_Socket->SetTimeout(eIO_ReadWrite, timeout);
+                return conn;
+            }
+            if (m_Impl->max_per_host == 0  ||
+                host.in_use < m_Impl->max_per_host) {
+                // Reserve a place for the new connection
+                ++host.in_use;
+                ++m_Impl->stats.opened;
+                break;
+            }
+            if ( !wait ) {
+                return NULL;
+            }
+            ++m_Impl->stats.waits;
+            m_Impl->released.WaitForSignal(m_Impl->lock);
+        }
+    }}
+
+    // Connect out of the lock. If it fails, the first x_Send() fails too.
+    unique_ptr<SConnection> conn(new SConnection(m_Impl.get(), key));
+    TSOCK_Flags flags = fSOCK_LogDefault;
+    if ( s_IsSecure(url) ) {
+        flags |= fSOCK_Secure;
+    }
+    conn->m_Socket.reset(new CSocket(url.GetHost(), s_GetPort(url),
+                                     timeout, flags));
+    conn->m_Socket->SetTimeout(eIO_ReadWrite, timeout);
+    conn->m_Socket->DisableOSSendDelay();
+    return conn.release();
+}
+
+
+void CHttpConnectionPool::x_Release(SConnection* conn, bool reusable)
+{
+    CFastMutexGuard guard(m_Impl->lock);
+    SImpl::SHost& host = m_Impl->hosts[conn->m_Key];
+    _ASSERT(host.in_use > 0);
+    --host.in_use;
+    if (reusable  &&  conn->m_InFlight == 0  &&
+        host.idle.size() < m_Impl->max_idle  &&
+        conn->m_Socket->GetStatus(eIO_Open) == eIO_Success) {
+        conn->m_Expiration = CDeadline(m_Impl->idle_timeout);
+        host.idle.push_back(conn);
+    }
+    else {
+        delete conn;
+        ++m_Impl->stats.closed;
+    }
+    m_Impl->released.SignalSome();
+}
+
+
+bool CHttpConnectionPool::x_Send(SConnection* conn, const string& request)
+{
+    {{
+        CFastMutexGuard guard(conn->m_Pool->lock);
+        SStats& stats = conn->m_Pool->stats;
+        ++stats.requests;
+        if ( conn->m_Requests ) {
+            ++stats.reused;
+        }
+        if ( conn->m_InFlight ) {
+            ++stats.pipelined;
+        }
+    }}
+    ++conn->m_Requests;
+    ++conn->m_InFlight;
+    return conn->m_Socket->Write(request.data(), request.size(),
+                                 0, eIO_WritePersist) == eIO_Success;
+}
+
+
+// Longest response header line and whole header accepted
+static const size_t kMaxPooledLine   = 8 * 1024;
+static const size_t kMaxPooledHeader = 64 * 1024;
+
+// Size of the blocks the buffered response bodies are read in
+static const size_t kPooledBodyBlock = 64 * 1024;
+
+
+// Read a line of the response header or the chunked body framing.
+static bool s_ReadLine(CSocket& sock, string& line)
+{
+    char buf[kMaxPooledLine];
+    size_t n_read = 0;
+    if (SOCK_ReadLine(sock.GetSOCK(), buf, sizeof(buf), &n_read)
+        != eIO_Success  ||  n_read == sizeof(buf)) {
+        return false;
+    }
+    line.assign(buf, n_read);
+    return true;
+}
+
+
+bool CHttpConnectionPool::x_ReceiveHeader(SConnection* conn,
+                                          bool         head,
+                                          string&      header)
+{
+    CSocket& sock = *conn->m_Socket;
+    string line;
+    int status = 0;
+    conn->m_Body = SConnection::eBody_None;
+    conn->m_BodyLeft = 0;
+    conn->m_ChunkEnd = false;
+    conn->m_KeepAlive = false;
+
+    // Skip interim (1xx) responses.
+    do {
+        header.clear();
+        for (;;) {
+            if ( !s_ReadLine(sock, line) ) {
+                return false;
+            }
+            if ( line.empty() ) {
+                break;
+            }
+            header += line;
+            header += HTTP_EOL;
+            if (header.size() > kMaxPooledHeader) {
+                return false;
+            }
+        }
+        if (!NStr::StartsWith(header, "HTTP/")  ||
+            sscanf(header.c_str(), "%*s %d", &status) != 1  ||
+            status < 100  ||  status > 999) {
+            return false;
+        }
+    } while (100 <= status  &&  status < 200);
+    _ASSERT(conn->m_InFlight > 0);
+    --conn->m_InFlight;
+
+    bool keep_alive = !NStr::StartsWith(header, "HTTP/1.0");
+    bool chunked = false;
+    bool have_length = false;
+    Uint8 length = 0;
+    vector<CTempString> lines;
+    NStr::Split(header, HTTP_EOL, lines,
+                NStr::fSplit_MergeDelimiters | NStr::fSplit_ByPattern);
+    for (size_t i = 1;  i < lines.size();  ++i) {
+        CTempString name, value;
+        if ( !NStr::SplitInTwo(lines[i], ":", name, value) ) {
+            continue;
+        }
+        name = NStr::TruncateSpaces_Unsafe(name);
+        value = NStr::TruncateSpaces_Unsafe(value);
+        if (NStr::EqualNocase(name, "Content-Length")) {
+            Uint8 value_length = NStr::StringToNumeric<Uint8>(value,
+                                                NStr::fConvErr_NoThrow);
+            // The body cannot be delimited by an invalid or ambiguous length.
+            if (errno != 0  ||  (have_length  &&  value_length != length)) {
+                return false;
+            }
+            length = value_length;
+            have_length = true;
+        }
+        else if (NStr::EqualNocase(name, "Transfer-Encoding")) {
+            chunked = NStr::FindNoCase(value, "chunked") != NPOS;
+        }
+        else if (NStr::EqualNocase(name, "Connection")) {
+            if (NStr::FindNoCase(value, "close") != NPOS) {
+                keep_alive = false;
+            }
+            else if (NStr::FindNoCase(value, "keep-alive") != NPOS) {
+                keep_alive = true;
+            }
+        }
+    }
+
+    if (head  ||  status == 204  ||  status == 304) {
+        conn->m_Body = SConnection::eBody_None;
+    }
+    else if ( chunked ) {
+        conn->m_Body = SConnection::eBody_Chunked;
+    }
+    else if ( have_length ) {
+        conn->m_Body = length ? SConnection::eBody_Length
+            : SConnection::eBody_None;
+        conn->m_BodyLeft = length;
+    }
+    else {
+        conn->m_Body = SConnection::eBody_Close;
+        keep_alive = false;
+    }
+    conn->m_KeepAlive = keep_alive;
+    return true;
+}
+
+
+EIO_Status CHttpConnectionPool::x_ReadBody(SConnection* conn,
+                                           void*        buf,
+                                           size_t       size,
+                                           size_t*      n_read)
+{
+    CSocket& sock = *conn->m_Socket;
+    *n_read = 0;
+    switch (conn->m_Body) {
+    case SConnection::eBody_None:
+        return eIO_Closed;
+
+    case SConnection::eBody_Close:
+        {{
+            EIO_Status status = sock.Read(buf, size, n_read);
+            if (status == eIO_Closed) {
+                if ( *n_read ) {
+                    return eIO_Success;
+                }
+                conn->m_Body = SConnection::eBody_None;
+            }
+            return status;
+        }}
+
+    case SConnection::eBody_Chunked:
+        if ( !conn->m_BodyLeft ) {
+            string line;
+            if (conn->m_ChunkEnd  &&
+                (!s_ReadLine(sock, line)  ||  !line.empty())) {
+                break;
+            }
+            conn->m_ChunkEnd = false;
+            if ( !s_ReadLine(sock, line) ) {
+                break;
+            }
+            // Skip chunk extensions
+            Uint8 chunk = NStr::StringToNumeric<Uint8>(
+                NStr::TruncateSpaces(line.substr(0, line.find(';'))),
+                NStr::fConvErr_NoThrow, 16);
+            if (errno != 0) {
+                break;
+            }
+            if (chunk == 0) {
+                // Trailer
+                do {
+                    if ( !s_ReadLine(sock, line) ) {
+                        conn->m_KeepAlive = false;
+                        return eIO_Unknown;
+                    }
+                } while ( !line.empty() );
+                conn->m_Body = SConnection::eBody_None;
+                return eIO_Closed;
+            }
+            conn->m_BodyLeft = chunk;
+        }
+        /*FALLTHRU*/
+
+    case SConnection::eBody_Length:
+        {{
+            if (size > conn->m_BodyLeft) {
+                size = (size_t) conn->m_BodyLeft;
+            }
+            EIO_Status status = sock.Read(buf, size, n_read);
+            if ( !*n_read ) {
+                // The body is cut short.
+                conn->m_KeepAlive = false;
+                return status == eIO_Timeout ? status : eIO_Unknown;
+            }
+            conn->m_BodyLeft -= *n_read;
+            if ( !conn->m_BodyLeft ) {
+                if (conn->m_Body == SConnection::eBody_Chunked) {
+                    conn->m_ChunkEnd = true;
+                }
+                else {
+                    conn->m_Body = SConnection::eBody_None;
+                }
+            }
+            return eIO_Success;
+        }}
+    }
+    // Malformed chunked body
+    conn->m_KeepAlive = false;
+    return eIO_Unknown;
+}
+
+
+bool CHttpConnectionPool::x_ReceiveBody(SConnection* conn, string* body)
+{
+    // Grow the body as the data arrive rather than by the announced size.
+    char skip[4096];
+    for (;;) {
+        size_t pos = body ? body->size() : 0;
+        if ( body ) {
+            body->resize(pos + kPooledBodyBlock);
+        }
+        size_t n_read;
+        EIO_Status status = body
+            ? x_ReadBody(conn, &(*body)[pos], kPooledBodyBlock, &n_read)
+            : x_ReadBody(conn, skip, sizeof(skip), &n_read);
+        if ( body ) {
+            body->resize(pos + n_read);
+        }
+        if (status == eIO_Closed) {
+            return true;
+        }
+        if (status != eIO_Success) {
+            return false;
+        }
+    }
+}
+
+
+bool CHttpConnectionPool::x_Receive(SConnection* conn,
+                                    bool         head,
+                                    string&      header,
+                                    string&      body)
+{
+    body.clear();
+    return x_ReceiveHeader(conn, head, header)  &&  x_ReceiveBody(conn, &body);
+}
+
+
+bool CHttpConnectionPool::x_IsReusable(const SConnection* conn)
+{
+    return conn->m_KeepAlive  &&  conn->m_Body == SConnection::eBody_None;
+}
+
+
+bool CHttpConnectionPool::x_WasUsed(const SConnection* conn)
+{
+    return conn->m_Requests > 0;
+}
+
+
+///////////////////////////////////////////////////////
+//  Response body streams
+//
+
+
+// Data source of the response body connector
+class IPooledBody
+{
+public:
+    virtual ~IPooledBody(void) {}
+    virtual EIO_Status Read(void*           buf,
+                            size_t          size,
+                            size_t*         n_read,
+                            const STimeout* timeout) = 0;
+    virtual EIO_Status Status(void) const = 0;
+};
+
+
+extern "C" {
+
+
+static const char* s_VT_GetType
+(CONNECTOR /*connector*/)
+{
+    return "HTTP_POOL";
+}
+
+
+static EIO_Status s_VT_Open
+(CONNECTOR       /*connector*/,
+ const STimeout* /*timeout*/)
+{
+    return eIO_Success;
+}
+
+
+static EIO_Status s_VT_Read
+(CONNECTOR       connector,
+ void*           buf,
+ size_t          size,
+ size_t*         n_read,
+ const STimeout* timeout)
+{
+    IPooledBody* body = (IPooledBody*) connector->handle;
+    return body->Read(buf, size, n_read, timeout);
+}
+
+
+static EIO_Status s_VT_Status
+(CONNECTOR connector,
+ EIO_Event dir)
+{
+    IPooledBody* body = (IPooledBody*) connector->handle;
+    return dir == eIO_Read ? body->Status() : eIO_Success;
+}
+
+
+static EIO_Status s_VT_Close
+(CONNECTOR       /*connector*/,
+ const STimeout* /*timeout*/)
+{
+    return eIO_Success;
+}
+
+
+static void s_Setup
+(CONNECTOR connector)
+{
+    SMetaConnector* meta = connector->meta;
+
+    // Initialize virtual table
+    CONN_SET_METHOD(meta, get_type, s_VT_GetType, connector);
+    CONN_SET_METHOD(meta, descr,    0,            0);
+    CONN_SET_METHOD(meta, open,     s_VT_Open,    connector);
+    CONN_SET_METHOD(meta, wait,     0,            0);
+    CONN_SET_METHOD(meta, write,    0,            0);
+    CONN_SET_METHOD(meta, flush,    0,            0);
+    CONN_SET_METHOD(meta, read,     s_VT_Read,    connector);
+    CONN_SET_METHOD(meta, status,   s_VT_Status,  connector);
+    CONN_SET_METHOD(meta, close,    s_VT_Close,   connector);
+    meta->default_timeout = kInfiniteTimeout;
+}
+
+
+static void s_Destroy
+(CONNECTOR connector)
+{
+    IPooledBody* body = (IPooledBody*) connector->handle;
+    connector->handle = 0;
+    delete body;
+    free(connector);
+}
+
+
+} /* extern "C" */
+
+
+// Read-only connector taking the ownership of "body".
+static CONNECTOR s_CreateBodyConnector(IPooledBody* body)
+{
+    CONNECTOR ccc = (SConnector*) malloc(sizeof(SConnector));
+    if ( !ccc ) {
+        delete body;
+        return 0;
+    }
+    ccc->handle  = body;
+    ccc->next    = 0;
+    ccc->meta    = 0;
+    ccc->setup   = s_Setup;
+    ccc->destroy = s_Destroy;
+    return ccc;
+}
+
+
+// Reads the body of one response from a pooled connection and returns
+// the connection to the pool as soon as the body ends.
+struct CHttpConnectionPool::SBodyReader : public IPooledBody
+{
+    SBodyReader(CHttpConnectionPool* pool, SConnection* conn)
+        : m_Pool(pool), m_Conn(conn), m_Status(eIO_Success)
+    {}
+
+    virtual ~SBodyReader(void)
+    {
+        // The rest of the body cannot be skipped in time, the connection
+        // is closed if it is still held.
+        x_Release();
+    }
+
+    virtual EIO_Status Read(void*           buf,
+                            size_t          size,
+                            size_t*         n_read,
+                            const STimeout* timeout)
+    {
+        if ( !m_Conn ) {
+            *n_read = 0;
+            return m_Status;
+        }
+        m_Conn->m_Socket->SetTimeout(eIO_Read, timeout);
+        m_Status = x_ReadBody(m_Conn, buf, size, n_read);
+        if (m_Status == eIO_Success  &&
+            m_Conn->m_Body == SConnection::eBody_None) {
+            // Read to the end, the next read reports it.
+            x_Release();
+            m_Status = eIO_Closed;
+            return eIO_Success;
+        }
+        if (m_Status != eIO_Success) {
+            x_Release();
+        }
+        return m_Status;
+    }
+
+    virtual EIO_Status Status(void) const
+    {
+        return m_Status;
+    }
+
+private:
+    void x_Release(void)
+    {
+        if ( m_Conn ) {
+            m_Pool->x_Release(m_Conn, x_IsReusable(m_Conn));
+            m_Conn = NULL;
+        }
+    }
+
+    CRef<CHttpConnectionPool> m_Pool;
+    SConnection*              m_Conn;   // NULL after the body ends
+    EIO_Status                m_Status;
+};
+
+
+CConn_IOStream* CHttpConnectionPool::x_GetBodyStream(SConnection* conn)
+{
+    STimeout tmo;
+    const STimeout* timeout = conn->m_Socket->GetTimeout(eIO_Read);
+    if ( timeout ) {
+        tmo = *timeout;
+        timeout = &tmo;
+    }
+    if (conn->m_Body == SConnection::eBody_None) {
+        // Nothing to stream
+        x_Release(conn, x_IsReusable(conn));
+        return new CConn_MemoryStream;
+    }
+    CONNECTOR connector = s_CreateBodyConnector(new SBodyReader(this, conn));
+    CONN body_conn;
+    if ( !connector ) {
+        return NULL;
+    }
+    if (CONN_Create(connector, &body_conn) != eIO_Success) {
+        s_Destroy(connector);
+        return NULL;
+    }
+    return new CConn_IOStream(body_conn, true/*close*/, timeout,
+                              kConn_DefaultBufSize,
+                              CConn_IOStream::fConn_ReadBuffered);
+}
+
+
+///////////////////////////////////////////////////////
+//  CHttpRequest:: pooled requests
+//
+
+
+bool CHttpRequest::x_IsPooled(void) const
+{
+    if (!m_Session->GetConnectionPool()  ||  m_Url.IsService()  ||
+        m_Url.GetHost().empty()) {
+        return false;
+    }
+    const string& scheme = m_Url.GetScheme();
+    return NStr::EqualNocase(scheme, "http")  ||
+        NStr::EqualNocase(scheme, "https");
+}
+
+
+const STimeout* CHttpRequest::x_GetPooledLimits(STimeout& tmo,
+                                                unsigned& max_try) const
+{
+    SConnNetInfo* net_info = ConnNetInfo_Create(0);
+    const STimeout* timeout;
+    if ( m_Timeout.IsDefault() ) {
+        timeout = net_info->timeout ? &(tmo = *net_info->timeout)
+            : kInfiniteTimeout;
+    }
+    else {
+        timeout = g_CTimeoutToSTimeout(m_Timeout, tmo);
+    }
+    max_try = m_Retries.IsNull() ? net_info->max_try
+        : (unsigned) m_Retries + 1;
+    ConnNetInfo_Destroy(net_info);
+    if ( !max_try ) {
+        max_try = 1;
+    }
+    return timeout;
+}
+
+
+string CHttpRequest::x_GetPooledBody(void)
+{
+    _ASSERT(m_Stream  &&  m_Stream->IsInitialized());
+    string body;
+    dynamic_cast<CConn_MemoryStream&>(m_Stream->GetConnStream())
+        .ToString(&body);
+    return body;
+}
+
+
+string CHttpRequest::x_ComposePooledRequest(EReqMethod    method,
+                                            const CUrl&   url,
+                                            const string& body)
+{
+    const char* method_name;
+    switch (method) {
+    case eReqMethod_Head:    method_name = "HEAD";    break;
+    case eReqMethod_Get:     method_name = "GET";     break;
+    case eReqMethod_Post:    method_name = "POST";    break;
+    case eReqMethod_Put:     method_name = "PUT";     break;
+    case eReqMethod_Delete:  method_name = "DELETE";  break;
+    default:
+        NCBI_THROW(CHttpSessionException, eBadRequest,
+            "Request method not supported by pooled connections");
+    }
+
+    string target = url.GetPath();
+    if (target.empty()  ||  target[0] != '/') {
+        target.insert(0, 1, '/');
+    }
+    if ( url.HaveArgs() ) {
+        target += '?';
+        target += url.GetArgs().GetQueryString(CUrlArgs::eAmp_Char);
+    }
+
+    // Cookies may differ for each location.
+    x_AddCookieHeader(url);
+
+    string request = string(method_name) + ' ' + target +
+        " HTTP/1.1" HTTP_EOL "Host: " + url.GetHost();
+    if ( !url.GetPort().empty() ) {
+        request += ':' + url.GetPort();
+    }
+    request += HTTP_EOL;
+    request += m_Headers->GetHttpHeader();
+    if ( !m_Headers->HasValue(CHttpHeaders::eUserAgent) ) {
+        request += "User-Agent: NCBIHttpSession (CXX Toolkit)" HTTP_EOL;
+    }
+    if ( !(m_Session->GetHttpFlags() & fHTTP_NoAutomagicSID) ) {
+        static const struct {
+            ENcbiRequestID id;
+            const char*    name;
+        } kIDs[] = {
+            { eNcbiRequestID_SID,   "NCBI-SID: "  },
+            { eNcbiRequestID_HitID, "NCBI-PHID: " }
+        };
+        for (size_t i = 0;  i < sizeof(kIDs) / sizeof(kIDs[0]);  ++i) {
+            char* id = CORE_GetNcbiRequestID(kIDs[i].id);
+            if ( id ) {
+                if ( *id ) {
+                    request += kIDs[i].name;
+                    request += id;
+                    request += HTTP_EOL;
+                }
+                free(id);
+            }
+        }
+    }
+    if (!body.empty()  ||  method == eReqMethod_Post  ||
+        method == eReqMethod_Put) {
+        request += "Content-Length: " +
+            NStr::NumericToString(body.size()) + HTTP_EOL;
+    }
+    request += HTTP_EOL;
+    request += body;
+    return request;
+}
+
+
+void CHttpRequest::x_ExecutePooled(EReqMethod method, CUrl url, string body)
+{
+    CHttpConnectionPool& pool = *m_Session->GetConnectionPool();
+    STimeout tmo;
+    unsigned max_try;
+    const STimeout* timeout = x_GetPooledLimits(tmo, max_try);
+
+    unsigned attempt = 0;
+    bool stale = false;
+    for (;;) {
+        string request = x_ComposePooledRequest(method, url, body);
+        CHttpConnectionPool::SConnection* conn = pool.x_Acquire(url, timeout);
+        bool reused = CHttpConnectionPool::x_WasUsed(conn);
+        string header;
+        if (!CHttpConnectionPool::x_Send(conn, request)  ||
+            !CHttpConnectionPool::x_ReceiveHeader(conn,
+                                                  method == eReqMethod_Head,
+                                                  header)) {
+            pool.x_Release(conn, false);
+            // The server may have closed the kept-alive connection while
+            // it was idle, that allows one more attempt.
+            if (reused  &&  !stale) {
+                stale = true;
+                ++max_try;
+            }
+            if (++attempt < max_try) {
+                continue;
+            }
+            x_SetPooledFailure("Cannot execute request to " +
+                               url.ComposeUrl(CUrlArgs::eAmp_Char));
+            return;
+        }
+        if ( !x_SetPooledResponse(header, method, body) ) {
+            // The body is read from the connection as the response stream
+            // is read, the connection returns to the pool after the body.
+            CConn_IOStream* stream = pool.x_GetBodyStream(conn);
+            if ( !stream ) {
+                x_SetPooledFailure("Cannot read response from " +
+                                   url.ComposeUrl(CUrlArgs::eAmp_Char));
+                return;
+            }
+            x_SetPooledBody(stream);
+            return;
+        }
+        // Skip the body of the redirect.
+        bool skipped = CHttpConnectionPool::x_ReceiveBody(conn, NULL);
+        pool.x_Release(conn, skipped  &&
+                       CHttpConnectionPool::x_IsReusable(conn));
+        url = m_Response->m_Location;
+        attempt = 0;
+    }
+}
+
+
+bool CHttpRequest::x_SetPooledResponse(const string& header,
+                                       EReqMethod&   method,
+                                       string&       body)
+{
+    _ASSERT(m_Response);
+    m_Response->x_ParseHeader(header.c_str());
+    int status = m_Response->m_StatusCode;
+    const string& location =
+        m_Response->m_Headers->GetValue(CHttpHeaders::eLocation);
+
+    bool redirect = !location.empty()  &&
+        m_Redirects < kMaxPooledRedirects  &&
+        (status == 301  ||  status == 302  ||  status == 303  ||
+         status == 307  ||  status == 308);
+    if (redirect  &&  status != 303  &&
+        method != eReqMethod_Get  &&  method != eReqMethod_Head  &&
+        !(m_Session->GetHttpFlags() & fHTTP_UnsafeRedirects)) {
+        redirect = false;
+    }
+    if ( redirect ) {
+        CUrl new_url(location);
+        if ( new_url.GetHost().empty() ) {
+            // Relative location
+            const CUrl& base = m_Response->m_Location;
+            new_url.SetScheme(base.GetScheme());
+            new_url.SetHost(base.GetHost());
+            new_url.SetPort(base.GetPort());
+            if (new_url.GetPath().empty()  ||  new_url.GetPath()[0] != '/') {
+                string path = base.GetPath();
+                new_url.SetPath(path.substr(0, path.rfind('/') + 1) +
+                                new_url.GetPath());
+            }
+        }
+        if (!NStr::EqualNocase(new_url.GetScheme(), "http")  &&
+            !NStr::EqualNocase(new_url.GetScheme(), "https")) {
+            redirect = false;
+        }
+        else {
+            if (status == 303  &&  method != eReqMethod_Head) {
+                method = eReqMethod_Get;
+                body.clear();
+            }
+            m_Response->m_Location = new_url;
+            ++m_Redirects;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void CHttpRequest::x_SetPooledBody(CConn_IOStream* stream)
+{
+    _ASSERT(m_Response);
+    m_Response->m_Stream->SetConnStream(stream);
+}
+
+
+void CHttpRequest::x_SetPooledFailure(const string& error)
+{
+    _ASSERT(m_Response);
+    m_Response->m_StatusCode = 0;
+    m_Response->m_StatusText = error;
+    CConn_MemoryStream* stream = new CConn_MemoryStream;
+    stream->setstate(IOS_BASE::badbit);
+    m_Response->m_Stream->SetConnStream(stream);
+}
+
+
+bool CHttpRequest::x_IsIdempotent(void) const
+{
+    return m_Method == eReqMethod_Get  ||  m_Method == eReqMethod_Head;
+}
+
+
+///////////////////////////////////////////////////////
+//  CHttpSession::ExecuteAll
+//
+
+
+CHttpSession::TResponses CHttpSession::ExecuteAll(
+    vector<CHttpRequest>& requests)
+{
+    // Pooled request being executed
+    struct SBatchRequest
+    {
+        CHttpRequest* req;
+        EReqMethod    method;   // Changes on redirects
+        string        body;
+        string        request;
+        bool          idempotent;
+        bool          head;
+        bool          stale;    // Failed on a reused connection
+        unsigned      failures;
+        unsigned      max_try;
+    };
+
+    // Connection in use
+    struct SBatchChannel
+    {
+        CHttpConnectionPool::SConnection* conn;
+        bool                              reused;
+        deque<size_t>                     in_flight;
+    };
+
+    // Requests to one host
+    struct SBatchHost
+    {
+        CUrl                 url;
+        const STimeout*      timeout;
+        STimeout             tmo;
+        deque<size_t>        queue;
+        list<SBatchChannel>  channels;
+    };
+    typedef map<string, SBatchHost> TBatchHosts;
+
+    TResponses responses;
+    responses.reserve(requests.size());
+    if ( !m_Pool ) {
+        NON_CONST_ITERATE(vector<CHttpRequest>, it, requests) {
+            responses.push_back(it->Execute());
+        }
+        return responses;
+    }
+
+    vector< CRef<CHttpResponse> > results(requests.size());
+    vector<SBatchRequest> batch(requests.size());
+    TBatchHosts hosts;
+
+    for (size_t i = 0;  i < requests.size();  ++i) {
+        CHttpRequest& req = requests[i];
+        if (!req.x_IsPooled()  ||  req.m_RetryProcessing == eOn) {
+            // Executed by the ordinary Execute() after the rest
+            continue;
+        }
+        bool have_data = req.m_FormData  &&  !req.m_FormData.Empty();
+        if ( !req.m_Response ) {
+            req.x_InitConnection(have_data);
+        }
+        if ( have_data ) {
+            req.m_FormData->WriteFormData(req.m_Stream->GetConnStream());
+        }
+        if ( !req.m_Pooled ) {
+            // Proxy is used, the request is already being sent.
+            continue;
+        }
+        SBatchRequest& item = batch[i];
+        item.req = &req;
+        item.method = req.m_Method;
+        item.body = req.x_GetPooledBody();
+        item.request = req.x_ComposePooledRequest(item.method, req.m_Url,
+                                                  item.body);
+        item.idempotent = req.x_IsIdempotent();
+        item.head = req.m_Method == eReqMethod_Head;
+        item.stale = false;
+        item.failures = 0;
+
+        string key = s_GetHostKey(req.m_Url);
+        TBatchHosts::iterator host = hosts.find(key);
+        if (host == hosts.end()) {
+            host = hosts.insert(make_pair(key, SBatchHost())).first;
+            host->second.url = req.m_Url;
+            host->second.timeout =
+                req.x_GetPooledLimits(host->second.tmo, item.max_try);
+        }
+        else {
+            STimeout tmo;
+            req.x_GetPooledLimits(tmo, item.max_try);
+        }
+        host->second.queue.push_back(i);
+    }
+
+    unsigned depth = m_Pool->GetMaxPipelineDepth();
+    unsigned width = max(m_Pool->GetMaxIdlePerHost(), 1u);
+    if (m_Pool->GetMaxPerHost()  &&  m_Pool->GetMaxPerHost() < width) {
+        width = m_Pool->GetMaxPerHost();
+    }
+    // Requests to be repeated for new locations
+    vector<size_t> redirected;
+
+    for (bool busy = true;  busy; ) {
+        busy = false;
+        // Wait for a connection only if holding none, so that concurrent
+        // callers cannot block each other at the per host limit.
+        size_t channels = 0;
+        ITERATE(TBatchHosts, h, hosts) {
+            channels += h->second.channels.size();
+        }
+        NON_CONST_ITERATE(TBatchHosts, h, hosts) {
+            SBatchHost& host = h->second;
+
+            // Put requests back to the queue if the connection failed.
+            auto fail_channel = [&](list<SBatchChannel>::iterator ch) {
+                bool reused = ch->reused;
+                while ( !ch->in_flight.empty() ) {
+                    size_t i = ch->in_flight.back();
+                    ch->in_flight.pop_back();
+                    SBatchRequest& item = batch[i];
+                    // The server may have closed the kept-alive connection
+                    // while it was idle, that allows one more attempt.
+                    if (reused  &&  !item.stale) {
+                        item.stale = true;
+                        ++item.max_try;
+                    }
+                    if (++item.failures >= item.max_try) {
+                        item.req->x_SetPooledFailure(
+                            "Cannot execute request to " +
+                            item.req->m_Url.ComposeUrl(CUrlArgs::eAmp_Char));
+                        results[i] = item.req->m_Response;
+                    }
+                    else {
+                        host.queue.push_front(i);
+                    }
+                }
+                m_Pool->x_Release(ch->conn, false);
+                return host.channels.erase(ch);
+            };
+
+            // Open more connections while there are requests for them.
+            size_t in_flight = 0;
+            ITERATE(list<SBatchChannel>, ch, host.channels) {
+                in_flight += ch->in_flight.size();
+            }
+            while (!host.queue.empty()  &&  host.channels.size() < width  &&
+                   host.channels.size() * depth <
+                   host.queue.size() + in_flight) {
+                CHttpConnectionPool::SConnection* conn =
+                    m_Pool->x_Acquire(host.url, host.timeout, channels == 0);
+                if ( !conn ) {
+                    break;
+                }
+                ++channels;
+                SBatchChannel channel;
+                channel.conn = conn;
+                channel.reused = CHttpConnectionPool::x_WasUsed(conn);
+                host.channels.push_back(channel);
+            }
+
+            // Send requests: idempotent ones are pipelined, others are sent
+            // only over connections having nothing in flight.
+            for (list<SBatchChannel>::iterator ch = host.channels.begin();
+                 ch != host.channels.end(); ) {
+                bool failed = false;
+                while (!host.queue.empty()  &&  ch->in_flight.size() < depth) {
+                    size_t i = host.queue.front();
+                    if (!ch->in_flight.empty()  &&  (!batch[i].idempotent  ||
+                        !batch[ch->in_flight.back()].idempotent)) {
+                        break;
+                    }
+                    host.queue.pop_front();
+                    ch->in_flight.push_back(i);
+                    if ( !CHttpConnectionPool::x_Send(ch->conn,
+                                                      batch[i].request) ) {
+                        failed = true;
+                        break;
+                    }
+                }
+                ch = failed ? fail_channel(ch) : ++ch;
+            }
+
+            // Read one response from each connection.
+            for (list<SBatchChannel>::iterator ch = host.channels.begin();
+                 ch != host.channels.end(); ) {
+                if ( ch->in_flight.empty() ) {
+                    m_Pool->x_Release(ch->conn, true);
+                    ch = host.channels.erase(ch);
+                    continue;
+                }
+                size_t i = ch->in_flight.front();
+                // Pipelined responses are read in order, so each body is
+                // read whole before the next response.
+                string header, data;
+                if ( !CHttpConnectionPool::x_Receive(ch->conn, batch[i].head,
+                                                     header, data) ) {
+                    ch = fail_channel(ch);
+                    continue;
+                }
+                bool reusable = CHttpConnectionPool::x_IsReusable(ch->conn);
+                ch->in_flight.pop_front();
+                ch->reused = true;
+                SBatchRequest& item = batch[i];
+                if ( item.req->x_SetPooledResponse(header,
+                                                   item.method, item.body) ) {
+                    redirected.push_back(i);
+                }
+                else {
+                    CConn_MemoryStream* stream = new CConn_MemoryStream;
+                    stream->write(data.data(), data.size());
+                    item.req->x_SetPooledBody(stream);
+                    results[i] = item.req->m_Response;
+                }
+                if ( !reusable ) {
+                    // The rest will not be answered, send them again.
+                    while ( !ch->in_flight.empty() ) {
+                        host.queue.push_front(ch->in_flight.back());
+                        ch->in_flight.pop_back();
+                    }
+                    m_Pool->x_Release(ch->conn, false);
+                    ch = host.channels.erase(ch);
+                    continue;
+                }
+                ++ch;
+            }
+            if (!host.queue.empty()  ||  !host.channels.empty()) {
+                busy = true;
+            }
+        }
+    }
+
+    // Follow redirects one by one.
+    ITERATE(vector<size_t>, it, redirected) {
+        SBatchRequest& item = batch[*it];
+        item.req->x_ExecutePooled(item.method,
+                                  item.req->m_Response->GetLocation(),
+                                  item.body);
+        results[*it] = item.req->m_Response;
+    }
+
+    for (size_t i = 0;  i < requests.size();  ++i) {
+        CHttpRequest& req = requests[i];
+        if ( !results[i] ) {
+            if ( req.m_Response ) {
+                // Started by x_InitConnection() but not pooled
+                req.m_Stream->GetConnStream().peek();
+                results[i] = req.m_Response;
+            }
+            else {
+                responses.push_back(req.Execute());
+                continue;
+            }
+        }
+        req.m_Stream.Reset();
+        req.m_Response.Reset();
+        responses.push_back(*results[i]);
+    }
+    return responses;
+}
+
+
+END_NCBI_SCOPE
@@ -555,7 +555,9 @@ CHttpRequest::CHttpRequest(CHttpSession& session,
       m_Timeout(CTimeout::eDefault),
       m_Deadline(CTimeout::eDefault),
       m_RetryProcessing(ESwitch::eDefault),
-      m_AdjustUrl(0)
+      m_AdjustUrl(0),
+      m_Pooled(false),
+      m_Redirects(0)
 {
 }
 
@@ -698,8 +700,13 @@ CHttpResponse CHttpRequest::Execute(void)
         if ( have_data ) {
             m_FormData->WriteFormData(out);
         }
-        // Send data to the server and close output stream.
-        out.peek();
+        if ( m_Pooled ) {
+            x_ExecutePooled(m_Method, m_Url, x_GetPooledBody());
+        }
+        else {
+            // Send data to the server and close output stream.
+            out.peek();
+        }
         m_Stream.Reset();
         ret = m_Response;
         m_Response.Reset();
@@ -778,7 +785,14 @@ void CHttpRequest::x_InitConnection(bool use_form_data)
 
     m_Stream.Reset(new TStreamRef);
     m_Response.Reset(new CHttpResponse(*m_Session, m_Url, *m_Stream));
-    if ( !m_Url.IsService() ) {
+    m_Pooled = x_IsPooled()  &&  !net_info->http_proxy_host[0];
+    m_Redirects = 0;
+    if ( m_Pooled ) {
+        // Buffer the request body, it is sent by x_ExecutePooled().
+        m_IsService = false;
+        m_Stream->SetConnStream(new CConn_MemoryStream);
+    }
+    else if ( !m_Url.IsService() ) {
         // Connect using HTTP.
         m_IsService = false;
         m_Stream->SetConnStream(new CConn_HttpStream(
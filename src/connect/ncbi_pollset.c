@@ -0,0 +1,747 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Persistent poll set of POLLABLEs (see POLLSET_*() in "ncbi_socket.h").
+ *
+ *   On Linux the handles are kept in an epoll(7) set, so each wait costs
+ *   only in proportion to the number of handles that got ready.  Whatever
+ *   the kernel reports is then re-examined with SOCK_Poll() (with zero
+ *   timeout), so the readiness semantics are exactly those of SOCK_Poll().
+ *   Elsewhere, each wait is just a SOCK_Poll() over all handles in the set.
+ *
+ */
+
+#include "ncbi_ansi_ext.h"
+#include "ncbi_assert.h"
+#include "ncbi_priv.h"
+#include "ncbi_socketp.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(NCBI_OS_LINUX)
+#  include <sys/epoll.h>
+#  include <unistd.h>
+#  define NCBI_POLLSET_EPOLL 1
+#  define SOCK_INVALID       (-1)
+#endif /*NCBI_OS_LINUX*/
+
+#ifdef NCBI_OS_MSWIN
+#  include <windows.h>
+#else
+#  include <sys/time.h>
+#  include <time.h>
+#endif /*NCBI_OS_MSWIN*/
+
+#define NCBI_USE_ERRCODE_X   Connect_Socket
+
+
+/***********************************************************************
+ *  INTERNAL -- Auxiliary types and static functions
+ ***********************************************************************/
+
+typedef struct SPollSetEntry {
+    SOCK                  sock;     /* SOCK, LSOCK, or TRIGGER (see POLLABLE)*/
+    void*                 data;     /* user data                             */
+    EIO_Event             event;    /* events to wait for                    */
+    struct SPollSetEntry* next;     /* hash chain                            */
+    struct SPollSetEntry* check;    /* next on the re-check list             */
+    int/*bool*/           checking; /* whether on the re-check list          */
+    size_t                timer;    /* 1-based position in the timer heap    */
+    double                due;      /* timer expiration time                 */
+#ifdef NCBI_POLLSET_EPOLL
+    int                   fd;       /* handle registered with epoll, or -1   */
+    unsigned int          armed;    /* epoll events currently registered     */
+#endif /*NCBI_POLLSET_EPOLL*/
+} SPollSetEntry;
+
+
+struct SPOLLSET_tag {
+    SPollSetEntry** hash;           /* entries hashed by the POLLABLE        */
+    size_t          hash_size;      /* power of 2                            */
+    size_t          count;          /* number of entries                     */
+    SPollSetEntry*  check;          /* entries to re-examine in next wait    */
+    SPollSetEntry** timers;         /* min-heap of entries by timer "due"    */
+    size_t          n_timers;
+    size_t          a_timers;
+#ifdef NCBI_POLLSET_EPOLL
+    int                 epfd;
+    struct epoll_event* events;     /* as many as there are entries      */
+    size_t              n_events;
+#else
+    SSOCK_Poll*         polls;      /* scratch array for SOCK_Poll()         */
+    SPollSetEntry**     polled;
+    size_t              n_polls;
+#endif /*NCBI_POLLSET_EPOLL*/
+};
+
+
+/* Current time in seconds, for timeouts and timers only:  any epoch will
+ * do, but the clock must not step when the system time gets adjusted */
+static double s_Now(void)
+{
+#if   defined(NCBI_OS_MSWIN)
+    LARGE_INTEGER freq, count;
+    if (QueryPerformanceFrequency(&freq)  &&  QueryPerformanceCounter(&count))
+        return (double) count.QuadPart / (double) freq.QuadPart;
+    return GetTickCount() / 1000.0;
+#else
+    struct timeval tv;
+#  ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+#  endif /*CLOCK_MONOTONIC*/
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+#endif /*NCBI_OS_MSWIN*/
+}
+
+
+static size_t s_Hash(POLLSET pset, const void* ptr)
+{
+    size_t h = (size_t) ptr;
+    h ^= h >> 4;
+    h *= 2654435761U;
+    return (h ^ (h >> 16)) & (pset->hash_size - 1);
+}
+
+
+static SPollSetEntry* s_Find(POLLSET pset, POLLABLE poll)
+{
+    SPollSetEntry* e = pset->hash[s_Hash(pset, poll)];
+    while (e  &&  e->sock != (SOCK) poll)
+        e = e->next;
+    return e;
+}
+
+
+static int/*bool*/ s_Rehash(POLLSET pset, size_t size)
+{
+    SPollSetEntry** hash = (SPollSetEntry**) calloc(size, sizeof(*hash));
+    SPollSetEntry** old  = pset->hash;
+    size_t          n    = pset->hash_size;
+    size_t          i;
+
+    if (!hash)
+        return 0/*false*/;
+    pset->hash      = hash;
+    pset->hash_size = size;
+    for (i = 0;  i < n;  ++i) {
+        SPollSetEntry* e = old[i];
+        while (e) {
+            SPollSetEntry* next = e->next;
+            size_t h = s_Hash(pset, e->sock);
+            e->next = hash[h];
+            hash[h] = e;
+            e = next;
+        }
+    }
+    free(old);
+    return 1/*true*/;
+}
+
+
+static void s_AddToCheck(POLLSET pset, SPollSetEntry* e)
+{
+    if (!e->checking) {
+        e->checking = 1/*true*/;
+        e->check    = pset->check;
+        pset->check = e;
+    }
+}
+
+
+static void s_RemoveFromCheck(POLLSET pset, SPollSetEntry* e)
+{
+    SPollSetEntry** p;
+    if (!e->checking)
+        return;
+    for (p = &pset->check;  *p;  p = &(*p)->check) {
+        if (*p == e) {
+            *p = e->check;
+            break;
+        }
+    }
+    e->checking = 0/*false*/;
+}
+
+
+/* Timer heap */
+
+static void s_HeapSet(POLLSET pset, size_t i, SPollSetEntry* e)
+{
+    pset->timers[i - 1] = e;
+    e->timer = i;
+}
+
+
+static void s_HeapUp(POLLSET pset, size_t i)
+{
+    SPollSetEntry* e = pset->timers[i - 1];
+    while (i > 1) {
+        SPollSetEntry* parent = pset->timers[i / 2 - 1];
+        if (parent->due <= e->due)
+            break;
+        s_HeapSet(pset, i, parent);
+        i /= 2;
+    }
+    s_HeapSet(pset, i, e);
+}
+
+
+static void s_HeapDown(POLLSET pset, size_t i)
+{
+    SPollSetEntry* e = pset->timers[i - 1];
+    for (;;) {
+        size_t child = i * 2;
+        if (child > pset->n_timers)
+            break;
+        if (child < pset->n_timers
+            &&  pset->timers[child]->due < pset->timers[child - 1]->due) {
+            ++child;
+        }
+        if (e->due <= pset->timers[child - 1]->due)
+            break;
+        s_HeapSet(pset, i, pset->timers[child - 1]);
+        i = child;
+    }
+    s_HeapSet(pset, i, e);
+}
+
+
+static void s_HeapRemove(POLLSET pset, SPollSetEntry* e)
+{
+    size_t i = e->timer;
+    if (!i)
+        return;
+    e->timer = 0;
+    if (i < pset->n_timers) {
+        SPollSetEntry* last = pset->timers[--pset->n_timers];
+        s_HeapSet(pset, i, last);
+        if (i > 1  &&  last->due < pset->timers[i / 2 - 1]->due)
+            s_HeapUp(pset, i);
+        else
+            s_HeapDown(pset, i);
+    } else
+        --pset->n_timers;
+}
+
+
+static int/*bool*/ s_HeapInsert(POLLSET pset, SPollSetEntry* e)
+{
+    if (pset->n_timers == pset->a_timers) {
+        size_t a = pset->a_timers ? pset->a_timers << 1 : 16;
+        SPollSetEntry** timers = (SPollSetEntry**)
+            realloc(pset->timers, a * sizeof(*timers));
+        if (!timers)
+            return 0/*false*/;
+        pset->timers   = timers;
+        pset->a_timers = a;
+    }
+    s_HeapSet(pset, ++pset->n_timers, e);
+    s_HeapUp(pset, pset->n_timers);
+    return 1/*true*/;
+}
+
+
+#ifdef NCBI_POLLSET_EPOLL
+
+/* The events epoll should watch for the entry */
+static unsigned int s_EpollMask(SPollSetEntry* e)
+{
+    unsigned int mask = 0;
+    SOCK sock = e->sock;
+    if (e->event & eIO_Read)
+        mask |= EPOLLIN;
+    if (e->event & eIO_Write)
+        mask |= EPOLLOUT;
+    /* SOCK_Poll() for reading also pushes pending output (connection
+     * establishment, or data left to write), so have to wait for that too */
+    if ((e->event & eIO_Read)  &&  sock->type == eSocket
+        &&  sock->sock != SOCK_INVALID  &&  (sock->pending  ||  sock->w_len)) {
+        mask |= EPOLLOUT;
+    }
+    return mask;
+}
+
+
+/* Bring the epoll registration in line with the entry's interest */
+static EIO_Status s_Arm(POLLSET pset, SPollSetEntry* e)
+{
+    struct epoll_event ev;
+    unsigned int mask;
+    int fd = e->sock->sock == SOCK_INVALID ? -1 : (int) e->sock->sock;
+
+    if (e->fd >= 0  &&  e->fd != fd) {
+        /* the handle got closed, and epoll forgot it on its own */
+        e->fd = -1;
+    }
+    /* Entries not waited for are out of the epoll set altogether, or
+     * epoll would keep reporting EPOLLERR/EPOLLHUP for them. */
+    mask = e->event  &&  fd >= 0 ? s_EpollMask(e) : 0;
+    if (!mask) {
+        if (e->fd >= 0) {
+            memset(&ev, 0, sizeof(ev));
+            epoll_ctl(pset->epfd, EPOLL_CTL_DEL, e->fd, &ev);
+            e->fd = -1;
+        }
+        e->armed = 0;
+        return eIO_Success;
+    }
+    if (e->fd >= 0  &&  e->armed == mask)
+        return eIO_Success;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events   = mask;
+    ev.data.ptr = e;
+    if (epoll_ctl(pset->epfd, e->fd >= 0 ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+                  fd, &ev) != 0) {
+        int x_error = errno;
+        CORE_LOGF_ERRNO_X(164, eLOG_Error, x_error,
+                          ("POLLSET: Cannot register handle %d with epoll",
+                           fd));
+        return eIO_Unknown;
+    }
+    e->fd    = fd;
+    e->armed = mask;
+    return eIO_Success;
+}
+
+#endif /*NCBI_POLLSET_EPOLL*/
+
+
+/* Examine the given entries with SOCK_Poll(), zero timeout */
+static EIO_Status s_Examine(size_t          n,
+                            SPollSetEntry*  entries[],
+                            SSOCK_Poll      polls[],
+                            const STimeout* timeout)
+{
+    size_t i;
+    for (i = 0;  i < n;  ++i) {
+        polls[i].sock   = entries[i]->sock;
+        polls[i].event  = entries[i]->event;
+        polls[i].revent = eIO_Open;
+    }
+    return SOCK_Poll(n, polls, timeout, 0);
+}
+
+
+
+/***********************************************************************
+ *  EXTERNAL
+ ***********************************************************************/
+
+extern EIO_Status POLLSET_Create(POLLSET* pollset)
+{
+    POLLSET pset;
+
+    if (!pollset)
+        return eIO_InvalidArg;
+    *pollset = 0;
+    if (!(pset = (POLLSET) calloc(1, sizeof(*pset))))
+        return eIO_Unknown;
+    if (!(pset->hash = (SPollSetEntry**) calloc(64, sizeof(*pset->hash)))) {
+        free(pset);
+        return eIO_Unknown;
+    }
+    pset->hash_size = 64;
+#ifdef NCBI_POLLSET_EPOLL
+    if ((pset->epfd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        int x_error = errno;
+        CORE_LOG_ERRNO_X(165, eLOG_Error, x_error,
+                         "POLLSET: Cannot create epoll set");
+        free(pset->hash);
+        free(pset);
+        return eIO_Unknown;
+    }
+#endif /*NCBI_POLLSET_EPOLL*/
+    *pollset = pset;
+    return eIO_Success;
+}
+
+
+extern EIO_Status POLLSET_Add(POLLSET   pset,
+                              POLLABLE  poll,
+                              EIO_Event event,
+                              void*     data)
+{
+    SPollSetEntry* e;
+    size_t         h;
+
+    if (!pset  ||  !poll  ||  (event | eIO_ReadWrite) != eIO_ReadWrite)
+        return eIO_InvalidArg;
+    if (s_Find(pset, poll))
+        return eIO_InvalidArg;
+    if (pset->count >= pset->hash_size
+        &&  !s_Rehash(pset, pset->hash_size << 1)) {
+        return eIO_Unknown;
+    }
+    if (!(e = (SPollSetEntry*) calloc(1, sizeof(*e))))
+        return eIO_Unknown;
+    e->sock  = (SOCK) poll;
+    e->data  = data;
+    e->event = event;
+#ifdef NCBI_POLLSET_EPOLL
+    e->fd    = -1;
+    {{
+        EIO_Status status = s_Arm(pset, e);
+        if (status != eIO_Success) {
+            free(e);
+            return status;
+        }
+    }}
+#endif /*NCBI_POLLSET_EPOLL*/
+    h = s_Hash(pset, poll);
+    e->next = pset->hash[h];
+    pset->hash[h] = e;
+    pset->count++;
+    /* might have something buffered already */
+    s_AddToCheck(pset, e);
+    return eIO_Success;
+}
+
+
+extern EIO_Status POLLSET_Modify(POLLSET   pset,
+                                 POLLABLE  poll,
+                                 EIO_Event event,
+                                 void*     data)
+{
+    SPollSetEntry* e;
+
+    if (!pset  ||  (event | eIO_ReadWrite) != eIO_ReadWrite)
+        return eIO_InvalidArg;
+    if (!(e = s_Find(pset, poll)))
+        return eIO_InvalidArg;
+    e->event = event;
+    e->data  = data;
+#ifdef NCBI_POLLSET_EPOLL
+    {{
+        EIO_Status status = s_Arm(pset, e);
+        if (status != eIO_Success)
+            return status;
+    }}
+#endif /*NCBI_POLLSET_EPOLL*/
+    s_AddToCheck(pset, e);
+    return eIO_Success;
+}
+
+
+extern EIO_Status POLLSET_Remove(POLLSET pset, POLLABLE poll)
+{
+    SPollSetEntry** p;
+    SPollSetEntry*  e;
+
+    if (!pset  ||  !poll)
+        return eIO_InvalidArg;
+    for (p = &pset->hash[s_Hash(pset, poll)];  *p;  p = &(*p)->next) {
+        if ((*p)->sock == (SOCK) poll)
+            break;
+    }
+    if (!(e = *p))
+        return eIO_InvalidArg;
+    *p = e->next;
+    pset->count--;
+    s_RemoveFromCheck(pset, e);
+    s_HeapRemove(pset, e);
+#ifdef NCBI_POLLSET_EPOLL
+    e->event = eIO_Open;
+    s_Arm(pset, e);
+#endif /*NCBI_POLLSET_EPOLL*/
+    free(e);
+    return eIO_Success;
+}
+
+
+extern EIO_Status POLLSET_SetTimer(POLLSET         pset,
+                                   POLLABLE        poll,
+                                   const STimeout* timeout)
+{
+    SPollSetEntry* e;
+
+    if (!pset  ||  timeout == kDefaultTimeout)
+        return eIO_InvalidArg;
+    if (!(e = s_Find(pset, poll)))
+        return eIO_InvalidArg;
+    s_HeapRemove(pset, e);
+    if (!timeout)
+        return eIO_Success;
+    e->due = s_Now() + timeout->sec + timeout->usec / 1000000.0;
+    return s_HeapInsert(pset, e) ? eIO_Success : eIO_Unknown;
+}
+
+
+extern EIO_Status POLLSET_Wait(POLLSET         pset,
+                               const STimeout* timeout,
+                               SPOLLSET_Event  events[],
+                               size_t          n,
+                               size_t*         n_ready)
+{
+    double     deadline = 0.0;
+    size_t     k = 0;
+    EIO_Status status = eIO_Success;
+
+    if (n_ready)
+        *n_ready = 0;
+    if (!pset  ||  !events  ||  !n  ||  timeout == kDefaultTimeout)
+        return eIO_InvalidArg;
+    if (timeout)
+        deadline = s_Now() + timeout->sec + timeout->usec / 1000000.0;
+
+    for (;;) {
+        double now;
+
+#ifdef NCBI_POLLSET_EPOLL
+        static const STimeout kZero = { 0, 0 };
+        SPollSetEntry* list;
+        size_t         n_check = 0;
+        SPollSetEntry* e;
+        double         wait;
+
+        /* Ask the kernel first, so that handles staying ready (and thus
+         * re-examined in every wait) do not hide the others;  there is no
+         * waiting if something is to be re-examined anyway */
+        now = s_Now();
+        if (pset->check) {
+            wait = 0.0;
+        } else {
+            wait = -1.0/*infinite*/;
+            if (pset->n_timers)
+                wait = pset->timers[0]->due - now;
+            if (timeout  &&  (!pset->n_timers  ||  deadline - now < wait))
+                wait = deadline - now;
+            if (wait < 0.0  &&  (timeout  ||  pset->n_timers))
+                wait = 0.0;
+        }
+        /* Room for every handle, so that one call gets all that is ready */
+        if (pset->n_events < pset->count  ||  !pset->events) {
+            size_t a = pset->count < 16 ? 16 : pset->count + pset->count / 2;
+            struct epoll_event* ev = (struct epoll_event*)
+                malloc(a * sizeof(*ev));
+            if (!ev)
+                return eIO_Unknown;
+            if (pset->events)
+                free(pset->events);
+            pset->events   = ev;
+            pset->n_events = a;
+        }
+        {{
+            int i, m;
+            m = epoll_wait(pset->epfd, pset->events, (int) pset->n_events,
+                           wait < 0.0 ? -1 : (int)(wait * 1000.0 + 0.999));
+            if (m < 0) {
+                int x_error = errno;
+                if (x_error == EINTR)
+                    continue;
+                CORE_LOG_ERRNO_X(166, eLOG_Error, x_error,
+                                 "POLLSET: epoll_wait() failed");
+                return eIO_Unknown;
+            }
+            for (i = 0;  i < m;  ++i) {
+                s_AddToCheck(pset,
+                             (SPollSetEntry*) pset->events[i].data.ptr);
+            }
+        }}
+
+        /* Re-examine the entries which were reported last time, modified,
+         * or woken up by epoll, and report those that are ready */
+        list = pset->check;
+        pset->check = 0;
+        for (e = list;  e;  e = e->check)
+            ++n_check;
+        if (n_check) {
+            SSOCK_Poll*     polls;
+            SPollSetEntry** entries;
+            size_t          i;
+
+            polls   = (SSOCK_Poll*)     malloc(n_check * sizeof(*polls));
+            entries = (SPollSetEntry**) malloc(n_check * sizeof(*entries));
+            if (!polls  ||  !entries) {
+                if (polls)
+                    free(polls);
+                if (entries)
+                    free(entries);
+                pset->check = list;
+                return eIO_Unknown;
+            }
+            for (i = 0, e = list;  e;  e = e->check) {
+                e->checking = 0/*false*/;
+                if (e->event)
+                    entries[i++] = e;
+            }
+            n_check = i;
+            status = s_Examine(n_check, entries, polls, &kZero);
+            if (status != eIO_Success  &&  status != eIO_Timeout) {
+                /* try again next time */
+                for (i = 0;  i < n_check;  ++i)
+                    s_AddToCheck(pset, entries[i]);
+                free(polls);
+                free(entries);
+                return status;
+            }
+            for (i = 0;  i < n_check;  ++i) {
+                e = entries[i];
+                if (polls[i].revent  &&  k < n) {
+                    events[k].poll    = (POLLABLE) e->sock;
+                    events[k].revent  = polls[i].revent;
+                    events[k].expired = 0/*false*/;
+                    events[k].data    = e->data;
+                    ++k;
+                    /* level-triggered: look at it again next time */
+                    s_AddToCheck(pset, e);
+                } else if (polls[i].revent) {
+                    /* did not fit, report next time */
+                    s_AddToCheck(pset, e);
+                }
+                /* pending output may have been flushed, or appeared */
+                s_Arm(pset, e);
+            }
+            free(polls);
+            free(entries);
+        }
+#else
+        /* Poll all the entries */
+        double      tnow     = s_Now();
+        double      twait    = 0.0;
+        int/*bool*/ infinite = !timeout  &&  !pset->n_timers;
+        size_t      i, j, n_polls = 0;
+        STimeout    tmo;
+
+        if (pset->n_polls < pset->count) {
+            size_t a = pset->count + 16;
+            SSOCK_Poll*     polls  = (SSOCK_Poll*)
+                realloc(pset->polls,  a * sizeof(*polls));
+            SPollSetEntry** polled;
+            if (polls)
+                pset->polls = polls;
+            polled = (SPollSetEntry**)
+                realloc(pset->polled, a * sizeof(*polled));
+            if (polled)
+                pset->polled = polled;
+            if (!polls  ||  !polled)
+                return eIO_Unknown;
+            pset->n_polls = a;
+        }
+        for (i = 0;  i < pset->hash_size;  ++i) {
+            SPollSetEntry* e;
+            for (e = pset->hash[i];  e;  e = e->next) {
+                e->checking = 0/*false*/;
+                if (e->event)
+                    pset->polled[n_polls++] = e;
+            }
+        }
+        pset->check = 0;
+        if (!infinite) {
+            twait = timeout ? deadline - tnow : pset->timers[0]->due - tnow;
+            if (pset->n_timers  &&  pset->timers[0]->due - tnow < twait)
+                twait = pset->timers[0]->due - tnow;
+            if (twait < 0.0)
+                twait = 0.0;
+            tmo.sec  = (unsigned int) twait;
+            tmo.usec = (unsigned int)((twait - tmo.sec) * 1000000.0);
+        }
+        status = s_Examine(n_polls, pset->polled, pset->polls,
+                           infinite ? kInfiniteTimeout : &tmo);
+        if (status != eIO_Success  &&  status != eIO_Timeout)
+            return status;
+        for (j = 0;  j < n_polls  &&  k < n;  ++j) {
+            if (!pset->polls[j].revent)
+                continue;
+            events[k].poll    = (POLLABLE) pset->polled[j]->sock;
+            events[k].revent  = pset->polls[j].revent;
+            events[k].expired = 0/*false*/;
+            events[k].data    = pset->polled[j]->data;
+            ++k;
+        }
+#endif /*NCBI_POLLSET_EPOLL*/
+
+        /* Timers that went off */
+        now = s_Now();
+        while (pset->n_timers  &&  k < n  &&  pset->timers[0]->due <= now) {
+            SPollSetEntry* t = pset->timers[0];
+            size_t         i;
+            s_HeapRemove(pset, t);
+            for (i = 0;  i < k;  ++i) {
+                if (events[i].poll == (POLLABLE) t->sock)
+                    break;
+            }
+            if (i == k) {
+                events[k].poll    = (POLLABLE) t->sock;
+                events[k].revent  = eIO_Open;
+                events[k].data    = t->data;
+                ++k;
+            }
+            events[i].expired = 1/*true*/;
+        }
+        if (k)
+            break;
+
+        if (timeout  &&  deadline <= now) {
+            status = eIO_Timeout;
+            break;
+        }
+    }
+
+    if (n_ready)
+        *n_ready = k;
+    return k ? eIO_Success : status;
+}
+
+
+extern size_t POLLSET_GetCount(POLLSET pset)
+{
+    return pset ? pset->count : 0;
+}
+
+
+extern void POLLSET_Destroy(POLLSET pset)
+{
+    size_t i;
+
+    if (!pset)
+        return;
+    for (i = 0;  i < pset->hash_size;  ++i) {
+        SPollSetEntry* e = pset->hash[i];
+        while (e) {
+            SPollSetEntry* next = e->next;
+            free(e);
+            e = next;
+        }
+    }
+#ifdef NCBI_POLLSET_EPOLL
+    close(pset->epfd);
+    if (pset->events)
+        free(pset->events);
+#else
+    if (pset->polls)
+        free(pset->polls);
+    if (pset->polled)
+        free(pset->polled);
+#endif /*NCBI_POLLSET_EPOLL*/
+    if (pset->timers)
+        free(pset->timers);
+    free(pset->hash);
+    free(pset);
+}
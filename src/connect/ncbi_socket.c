@@ -4839,6 +4839,18 @@ static EIO_Status s_CreateListening(const char*    path,
          */
         if (!s_SetReuseAddress(x_lsock, 1/*true*/))
             failed = "REUSEADDR";
+#  ifdef SO_REUSEPORT
+        else if (flags & fSOCK_ReusePort) {
+            /* Let each of several listeners in this process own a separate
+             * accept queue on the same port (the kernel balances between
+             * them).  Only sockets of the same effective UID can share. */
+            int reuse_port = 1;
+            if (setsockopt(x_lsock, SOL_SOCKET, SO_REUSEPORT,
+                           (char*) &reuse_port, sizeof(reuse_port)) != 0) {
+                failed = "REUSEPORT";
+            }
+        }
+#  endif /*SO_REUSEPORT*/
 #endif /*NCBI_OS_MSWIN...*/
         if (failed) {
             const char* strerr = SOCK_STRERROR(error = SOCK_ERRNO);
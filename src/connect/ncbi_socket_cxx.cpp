@@ -568,6 +568,109 @@ EIO_Status CSocketAPI::Poll(vector<SPoll>&  polls,
 }
 
 
+
+/////////////////////////////////////////////////////////////////////////////
+//  CSocketPollSet::
+//
+
+CSocketPollSet::CSocketPollSet(void)
+    : m_PollSet(0)
+{
+    POLLSET_Create(&m_PollSet);
+}
+
+
+CSocketPollSet::~CSocketPollSet()
+{
+    POLLSET_Destroy(m_PollSet);
+}
+
+
+EIO_Status CSocketPollSet::GetStatus(void) const
+{
+    return m_PollSet ? eIO_Success : eIO_Closed;
+}
+
+
+EIO_Status CSocketPollSet::Add(CPollable& pollable,
+                               EIO_Event  event,
+                               void*      data)
+{
+    if ( !m_PollSet )
+        return eIO_Closed;
+    POLLABLE handle = pollable.GetPOLLABLE();
+    if (!handle  ||  m_Entries.find(&pollable) != m_Entries.end())
+        return eIO_InvalidArg;
+    SEntry& entry = m_Entries[&pollable];
+    entry.m_Pollable = &pollable;
+    entry.m_Handle   = handle;
+    entry.m_Data     = data;
+    EIO_Status status = POLLSET_Add(m_PollSet, handle, event, &entry);
+    if (status != eIO_Success)
+        m_Entries.erase(&pollable);
+    return status;
+}
+
+
+EIO_Status CSocketPollSet::Modify(CPollable& pollable,
+                                  EIO_Event  event,
+                                  void*      data)
+{
+    TEntries::iterator it = m_Entries.find(&pollable);
+    if (it == m_Entries.end())
+        return eIO_InvalidArg;
+    it->second.m_Data = data;
+    return POLLSET_Modify(m_PollSet, it->second.m_Handle, event, &it->second);
+}
+
+
+EIO_Status CSocketPollSet::Remove(CPollable& pollable)
+{
+    TEntries::iterator it = m_Entries.find(&pollable);
+    if (it == m_Entries.end())
+        return eIO_InvalidArg;
+    EIO_Status status = POLLSET_Remove(m_PollSet, it->second.m_Handle);
+    m_Entries.erase(it);
+    return status;
+}
+
+
+EIO_Status CSocketPollSet::SetTimer(CPollable&      pollable,
+                                    const STimeout* timeout)
+{
+    TEntries::iterator it = m_Entries.find(&pollable);
+    if (it == m_Entries.end())
+        return eIO_InvalidArg;
+    return POLLSET_SetTimer(m_PollSet, it->second.m_Handle, timeout);
+}
+
+
+EIO_Status CSocketPollSet::Wait(vector<SEvent>& events,
+                                const STimeout* timeout,
+                                size_t          max_events)
+{
+    events.clear();
+    if ( !m_PollSet )
+        return eIO_Closed;
+    if ( !max_events )
+        return eIO_InvalidArg;
+    m_Events.resize(max_events);
+
+    size_t     n_ready = 0;
+    EIO_Status status  = POLLSET_Wait(m_PollSet, timeout,
+                                      &m_Events[0], max_events, &n_ready);
+    events.resize(n_ready);
+    for (size_t i = 0;  i < n_ready;  ++i) {
+        const SEntry* entry = static_cast<const SEntry*>(m_Events[i].data);
+        events[i].m_Pollable = entry->m_Pollable;
+        events[i].m_REvent   = m_Events[i].revent;
+        events[i].m_Expired  = m_Events[i].expired ? true : false;
+        events[i].m_Data     = entry->m_Data;
+    }
+    return status;
+}
+
+
 string CSocketAPI::ntoa(unsigned int host)
 {
     char addr[40];
@@ -33,6 +33,7 @@
 #include <ncbi_pch.hpp>
 #include <corelib/ncbi_param.hpp>
 #include "connection_pool.hpp"
+#include "server_reactor.hpp"
 #include <connect/ncbi_buffer.h>
 #include <connect/error_codes.hpp>
 
@@ -626,6 +627,8 @@ void CServer::SetParameters(const SServer_Parameters& new_params)
     }
     *m_Parameters = new_params;
     m_ConnectionPool->SetMaxConnections(m_Parameters->max_connections);
+
+    m_ConnectionPool->SetReactorThreads(m_Parameters->reactor_threads);
 }
 
 
@@ -654,12 +657,83 @@ static inline bool operator <(const STimeout& to1, const STimeout& to2)
 }
 
 
+void CServer::x_DoRunReactors(void)
+{
+    // All socket events are handled by the reactor threads; this loop
+    // only checks for shutdown and calls ProcessTimeout().  As in the
+    // poll() loop, ProcessTimeout() is called when no connection was
+    // active for accept_timeout, which is measured here across the
+    // (at most one second long) waits for the control trigger.
+    m_ConnectionPool->StartReactors(*m_ThreadPool,
+                                    m_Parameters->idle_timeout);
+
+    static const STimeout kMaxCheckInterval = { 1, 0 };
+    const STimeout* accept_timeout = m_Parameters->accept_timeout;
+    bool has_accept_timeout = accept_timeout != kDefaultTimeout  &&
+                              accept_timeout != kInfiniteTimeout;
+    double idle_limit = has_accept_timeout
+        ? accept_timeout->sec + accept_timeout->usec / 1000000.0 : 0;
+
+    try {
+        CTrigger& trigger = m_ConnectionPool->GetControlTrigger();
+        vector<CSocketAPI::SPoll> polls;
+        polls.push_back(CSocketAPI::SPoll(&trigger, eIO_Read));
+        size_t count;
+        CStopWatch idle_clock(CStopWatch::eStart);
+        CAtomicCounter::TValue activity = m_ConnectionPool->GetActivity();
+        while (!ShutdownRequested()) {
+            STimeout slice = kMaxCheckInterval;
+            if (has_accept_timeout) {
+                double left = idle_limit - idle_clock.Elapsed();
+                if (left < 0)
+                    left = 0;
+                if (left < slice.sec) {
+                    slice.sec  = (unsigned int) left;
+                    slice.usec = (unsigned int)
+                        ((left - slice.sec) * 1000000);
+                }
+            }
+            EIO_Status status = CSocketAPI::Poll(polls, &slice, &count);
+            if (status != eIO_Success  &&  status != eIO_Timeout) {
+                ERR_POST_X(8, Critical << "Poll failed with status "
+                           << IO_StatusStr(status));
+                continue;
+            }
+            if (count != 0) {
+                trigger.Reset();
+            }
+            if ( !has_accept_timeout )
+                continue;
+
+            CAtomicCounter::TValue new_activity =
+                m_ConnectionPool->GetActivity();
+            if (count != 0  ||  new_activity != activity) {
+                activity = new_activity;
+                idle_clock.Restart();
+            } else if (idle_clock.Elapsed() >= idle_limit) {
+                ProcessTimeout();
+                idle_clock.Restart();
+            }
+        }
+    } catch (...) {
+        m_ConnectionPool->StopReactors();
+        throw;
+    }
+    m_ConnectionPool->StopReactors();
+}
+
+
 void CServer::x_DoRun(void)
 {
     m_ThreadPool->Spawn(m_Parameters->max_threads);
 
     Init();
 
+    if (m_Parameters->reactor_threads > 0) {
+        x_DoRunReactors();
+        return;
+    }
+
     vector<CSocketAPI::SPoll> polls;
     size_t     count;
     typedef vector<IServer_ConnectionBase*> TConnsList;
@@ -857,7 +931,8 @@ SServer_Parameters::SServer_Parameters() :
     idle_timeout(&k_DefaultIdleTimeout),
     init_threads(5),
     max_threads(10),
-    spawn_threshold(1)
+    spawn_threshold(1),
+    reactor_threads(0)
 {
 }
 
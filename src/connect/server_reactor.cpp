@@ -0,0 +1,492 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Reactor threads of the threaded server
+ *
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <connect/error_codes.hpp>
+#include "connection_pool.hpp"
+#include "server_reactor.hpp"
+
+
+#define NCBI_USE_ERRCODE_X   Connect_ThrServer
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// Longest time between two sweeps of a reactor's connections
+static const STimeout kSweepInterval = { 1, 0 };
+
+/// Most events handled per wake-up
+static const size_t kMaxEvents = 256;
+
+
+static CPollable* s_GetPollable(IServer_ConnectionBase* conn)
+{
+    CPollable* pollable = dynamic_cast<CPollable*>(conn);
+    _ASSERT(pollable);
+    return pollable;
+}
+
+
+CServer_Reactor::CServer_Reactor(CServer_ConnectionPool&   conn_pool,
+                                 CPoolOfThreads_ForServer& thread_pool,
+                                 const STimeout*           idle_timeout,
+                                 unsigned int              index)
+    : m_ConnPool(conn_pool),
+      m_ThreadPool(thread_pool),
+      m_IdleTimeout(idle_timeout),
+      m_Index(index),
+      m_Running(false),
+      m_Notified(false),
+      m_SweepRequested(false),
+      m_Stop(false)
+{
+    if (m_PollSet.GetStatus() != eIO_Success  ||
+        m_WakeTrigger.GetStatus() != eIO_Success  ||
+        m_PollSet.Add(m_WakeTrigger, eIO_Read) != eIO_Success) {
+        NCBI_THROW(CServer_Exception, eBadParameters,
+                   "Cannot create poll set for reactor thread");
+    }
+}
+
+
+CServer_Reactor::~CServer_Reactor()
+{
+    ITERATE(vector<CServer_Listener*>, it, m_OwnListeners) {
+        delete *it;
+    }
+}
+
+
+void CServer_Reactor::x_Notify(void)
+{
+    // m_Lock is held
+    if ( !m_Notified ) {
+        m_Notified = true;
+        m_WakeTrigger.Set();
+    }
+}
+
+
+void CServer_Reactor::Register(TConnBase* conn)
+{
+    CFastMutexGuard guard(m_Lock);
+    conn->reactor = this;
+    m_ToAdd.push_back(conn);
+    x_Notify();
+}
+
+
+void CServer_Reactor::Unregister(TConnBase* conn)
+{
+    CFastMutexGuard guard(m_Lock);
+    if (!m_Running  ||  CThread::GetCurrentThread() == this) {
+        // Nobody else is using the poll set
+        TConnsList::iterator it = find(m_ToAdd.begin(), m_ToAdd.end(), conn);
+        if (it != m_ToAdd.end())
+            m_ToAdd.erase(it);
+        x_Remove(conn);
+        return;
+    }
+    m_ToRemove.push_back(conn);
+    x_Notify();
+    while (m_Running  &&
+           find(m_ToRemove.begin(), m_ToRemove.end(), conn)
+                                                    != m_ToRemove.end()) {
+        m_RemovedCond.WaitForSignal(m_Lock);
+    }
+    if ( !m_Running ) {
+        TConnsList::iterator it =
+            find(m_ToRemove.begin(), m_ToRemove.end(), conn);
+        if (it != m_ToRemove.end()) {
+            m_ToRemove.erase(it);
+            x_Remove(conn);
+        }
+    }
+}
+
+
+void CServer_Reactor::Rearm(TConnBase* conn, EServerConnType /*type*/)
+{
+    CFastMutexGuard guard(m_Lock);
+    m_ToArm.push_back(conn);
+    x_Notify();
+}
+
+
+void CServer_Reactor::AddListener(const CServer_Listener& primary)
+{
+    auto_ptr<CServer_Listener> listener(new CServer_Listener(primary));
+    if (listener->ListenAlongside(primary) != eIO_Success) {
+        ERR_POST_X(13, Warning << "Reactor " << m_Index
+                   << ": cannot listen on port " << primary.GetPort()
+                   << ", other reactors will accept its connections");
+        return;
+    }
+    listener->type = eListener;
+    {{
+        CFastMutexGuard guard(m_Lock);
+        m_OwnListeners.push_back(listener.get());
+    }}
+    Register(listener.release());
+}
+
+
+void CServer_Reactor::StopListener(unsigned short port)
+{
+    CFastMutexGuard guard(m_Lock);
+    m_PortsToStop.push_back(port);
+    x_Notify();
+}
+
+
+void CServer_Reactor::StopListening(void)
+{
+    CFastMutexGuard guard(m_Lock);
+    ITERATE(vector<CServer_Listener*>, it, m_OwnListeners) {
+        (*it)->Passivate();
+    }
+}
+
+
+void CServer_Reactor::WakeUp(void)
+{
+    CFastMutexGuard guard(m_Lock);
+    m_SweepRequested = true;
+    x_Notify();
+}
+
+
+void CServer_Reactor::RequestStop(void)
+{
+    CFastMutexGuard guard(m_Lock);
+    m_Stop = true;
+    x_Notify();
+}
+
+
+void CServer_Reactor::x_Add(TConnBase* conn)
+{
+    if ( !m_Conns.insert(conn).second )
+        return;
+    CPollable* pollable = s_GetPollable(conn);
+    if (m_PollSet.Add(*pollable, eIO_Open, conn) != eIO_Success) {
+        ERR_POST_X(11, Error << "Reactor " << m_Index
+                   << ": cannot add connection to poll set");
+    }
+    if (conn->type == eListener)
+        m_PollSet.Modify(*pollable, eIO_Read, conn);
+    else
+        x_Arm(conn);
+}
+
+
+void CServer_Reactor::x_Remove(TConnBase* conn)
+{
+    if (m_Conns.erase(conn))
+        m_PollSet.Remove(*s_GetPollable(conn));
+    conn->reactor = NULL;
+}
+
+
+void CServer_Reactor::x_Arm(TConnBase* conn)
+{
+    if (m_Conns.find(conn) == m_Conns.end())
+        return;
+
+    conn->type_lock.Lock();
+    EServerConnType type = conn->type;
+    conn->type_lock.Unlock();
+
+    if (type == eClosedSocket  ||
+        (type == eInactiveSocket  &&  !conn->IsOpen())) {
+        x_Dispose(conn, eServIO_Delete);
+        return;
+    }
+    if (type != eInactiveSocket) {
+        // Being processed, or deferred (the sweep revives those)
+        return;
+    }
+
+    CPollable*   pollable   = s_GetPollable(conn);
+    const CTime* alarm_time = NULL;
+    EIO_Event    events     = conn->GetEventsToPollFor(&alarm_time);
+    if (m_PollSet.Modify(*pollable, events, conn) != eIO_Success) {
+        ERR_POST_X(12, Warning << "Reactor " << m_Index
+                   << ": cannot wait on connection");
+    }
+    if (alarm_time != NULL) {
+        CTimeSpan span(alarm_time->DiffTimeSpan(GetFastLocalTime()));
+        STimeout  timeout = { 0, 0 };
+        if (span.GetCompleteSeconds() >= 0  &&
+            span.GetNanoSecondsAfterSecond() >= 0) {
+            timeout.sec  = (unsigned int) span.GetCompleteSeconds();
+            timeout.usec = span.GetNanoSecondsAfterSecond() / 1000;
+        }
+        m_PollSet.SetTimer(*pollable, &timeout);
+    } else {
+        m_PollSet.SetTimer(*pollable, kInfiniteTimeout);
+    }
+}
+
+
+void CServer_Reactor::x_Dispose(TConnBase* conn, EServIO_Event event)
+{
+    x_Remove(conn);
+    m_ConnPool.Forget(conn);
+    x_Submit(conn, event);
+}
+
+
+void CServer_Reactor::x_Submit(TConnBase* conn, EServIO_Event event)
+{
+    CRef<CStdRequest> req(conn->CreateRequest(event, m_ConnPool,
+                                              m_IdleTimeout));
+    m_ThreadPool.AcceptRequest(req);
+}
+
+
+void CServer_Reactor::x_Dispatch(TConnBase* conn,
+                                 EIO_Event  revent,
+                                 bool       expired)
+{
+    conn->type_lock.Lock();
+    EServerConnType type = conn->type;
+    if (type == eListener) {
+        conn->type_lock.Unlock();
+        // The request accepts the connection right here
+        x_Submit(conn, eServIO_Read);
+        return;
+    }
+    if (type != eInactiveSocket) {
+        conn->type_lock.Unlock();
+        return;
+    }
+    conn->type = eActiveSocket;
+    conn->type_lock.Unlock();
+
+    // Not to be waited on until the pool thread is done with it
+    CPollable* pollable = s_GetPollable(conn);
+    m_PollSet.Modify(*pollable, eIO_Open, conn);
+    m_PollSet.SetTimer(*pollable, kInfiniteTimeout);
+
+    if (revent != eIO_Open) {
+        // I/O goes first;  an expired timer goes off again on re-arm
+        x_Submit(conn, IOEventToServIOEvent(revent));
+    } else if (expired) {
+        x_Submit(conn, (EServIO_Event) -1);
+    }
+}
+
+
+void CServer_Reactor::x_RemoveListeners(const vector<unsigned short>& ports)
+{
+    TConnsList to_remove;
+    ITERATE(set<TConnBase*>, it, m_Conns) {
+        if ((*it)->type != eListener)
+            continue;
+        CServer_Listener* listener = dynamic_cast<CServer_Listener*>(*it);
+        if (listener  &&
+            find(ports.begin(), ports.end(), listener->GetPort())
+                                                            != ports.end()) {
+            to_remove.push_back(listener);
+        }
+    }
+    ITERATE(TConnsList, it, to_remove) {
+        CServer_Listener* listener = static_cast<CServer_Listener*>(*it);
+        x_Remove(listener);
+        bool own;
+        {{
+            CFastMutexGuard guard(m_Lock);
+            vector<CServer_Listener*>::iterator own_it =
+                find(m_OwnListeners.begin(), m_OwnListeners.end(), listener);
+            own = own_it != m_OwnListeners.end();
+            if (own)
+                m_OwnListeners.erase(own_it);
+        }}
+        if ( !own ) {
+            // The primary listener lives in the connection pool
+            m_ConnPool.ListenerRemoved(listener);
+        }
+        delete listener;
+    }
+}
+
+
+void CServer_Reactor::x_ProcessRequests(TConnsList& removed)
+{
+    TConnsList             to_add;
+    TConnsList             to_arm;
+    vector<unsigned short> ports;
+    {{
+        CFastMutexGuard guard(m_Lock);
+        m_Notified = false;
+        to_add.swap(m_ToAdd);
+        to_arm.swap(m_ToArm);
+        ports.swap(m_PortsToStop);
+        removed.insert(removed.end(), m_ToRemove.begin(), m_ToRemove.end());
+        ITERATE(TConnsList, it, m_ToRemove) {
+            TConnsList::iterator add_it =
+                find(to_add.begin(), to_add.end(), *it);
+            if (add_it != to_add.end())
+                to_add.erase(add_it);
+            x_Remove(*it);
+        }
+        if ( !m_ToRemove.empty() ) {
+            m_ToRemove.clear();
+            m_RemovedCond.SignalAll();
+        }
+    }}
+
+    ITERATE(TConnsList, it, to_add) {
+        x_Add(*it);
+    }
+    ITERATE(TConnsList, it, to_arm) {
+        x_Arm(*it);
+    }
+    if ( !ports.empty() )
+        x_RemoveListeners(ports);
+}
+
+
+void CServer_Reactor::x_Sweep(void)
+{
+    TConnsList revived_conns;
+    TConnsList to_close_conns;
+    TConnsList to_delete_conns;
+    CTime      now = GetFastLocalTime();
+
+    ITERATE(set<TConnBase*>, it, m_Conns) {
+        TConnBase* conn_base = *it;
+        conn_base->type_lock.Lock();
+        EServerConnType conn_type = conn_base->type;
+
+        if (conn_type == eClosedSocket
+            ||  (conn_type == eInactiveSocket  &&  !conn_base->IsOpen()))
+        {
+            to_delete_conns.push_back(conn_base);
+        }
+        else if (conn_type == eInactiveSocket  &&
+                 conn_base->expiration <= now)
+        {
+            to_close_conns.push_back(conn_base);
+        }
+        else if (conn_type == eDeferredSocket  &&
+                 conn_base->IsReadyToProcess())
+        {
+            conn_base->type = eActiveSocket;
+            revived_conns.push_back(conn_base);
+        }
+        conn_base->type_lock.Unlock();
+    }
+
+    ITERATE(TConnsList, it, to_delete_conns) {
+        x_Dispose(*it, eServIO_Delete);
+    }
+    ITERATE(TConnsList, it, to_close_conns) {
+        x_Dispose(*it, eServIO_Inactivity);
+    }
+    ITERATE(TConnsList, it, revived_conns) {
+        x_Submit(*it, IOEventToServIOEvent((*it)->GetEventsToPollFor(NULL)));
+    }
+}
+
+
+void* CServer_Reactor::Main(void)
+{
+    {{
+        CFastMutexGuard guard(m_Lock);
+        m_Running = true;
+    }}
+
+    vector<CSocketPollSet::SEvent> events;
+    TConnsList                     removed;
+    CStopWatch                     sweep_clock(CStopWatch::eStart);
+
+    x_ProcessRequests(removed);
+    while (!m_Stop) {
+        double   left = kSweepInterval.sec - sweep_clock.Elapsed();
+        STimeout timeout = { 0, 0 };
+        if (left > 0) {
+            timeout.sec  = (unsigned int) left;
+            timeout.usec = (unsigned int) ((left - timeout.sec) * 1000000);
+        }
+
+        EIO_Status status = m_PollSet.Wait(events, &timeout, kMaxEvents);
+        if (status != eIO_Success  &&  status != eIO_Timeout) {
+            ERR_POST_X(14, Critical << "Reactor " << m_Index
+                       << ": poll failed with status "
+                       << IO_StatusStr(status));
+        }
+
+        // Requests first:  removed connections may be gone already
+        bool woken = false;
+        ITERATE(vector<CSocketPollSet::SEvent>, it, events) {
+            if (it->m_Pollable == &m_WakeTrigger) {
+                m_WakeTrigger.Reset();
+                woken = true;
+            }
+        }
+        removed.clear();
+        x_ProcessRequests(removed);
+        if (m_Stop)
+            break;
+
+        ITERATE(vector<CSocketPollSet::SEvent>, it, events) {
+            if (it->m_Pollable == &m_WakeTrigger)
+                continue;
+            TConnBase* conn = static_cast<TConnBase*>(it->m_Data);
+            if (find(removed.begin(), removed.end(), conn) != removed.end())
+                continue;
+            m_ConnPool.NoteActivity();
+            x_Dispatch(conn, it->m_REvent, it->m_Expired);
+        }
+
+        bool sweep = false;
+        if (woken) {
+            CFastMutexGuard guard(m_Lock);
+            sweep = m_SweepRequested;
+            m_SweepRequested = false;
+        }
+        if (sweep  ||  sweep_clock.Elapsed() >= kSweepInterval.sec) {
+            x_Sweep();
+            sweep_clock.Restart();
+        }
+    }
+
+    CFastMutexGuard guard(m_Lock);
+    m_Running = false;
+    m_RemovedCond.SignalAll();
+    return NULL;
+}
+
+
+END_NCBI_SCOPE
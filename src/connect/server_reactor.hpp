@@ -0,0 +1,164 @@
+#ifndef CONNECT___SERVER_REACTOR__HPP
+#define CONNECT___SERVER_REACTOR__HPP
+
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Internal header for the epoll-based reactor threads of CServer.
+ *
+ */
+
+/// @file server_reactor.hpp
+/// Internal header for the reactor threads of CServer.
+///
+/// In reactor mode every connection is owned by exactly one reactor
+/// thread, which waits for it in a CSocketPollSet of its own (epoll on
+/// Linux) instead of rebuilding a poll vector of all connections on every
+/// iteration.  Once an event is reported the connection is disarmed and
+/// handed to the thread pool, and it is not waited for again until
+/// CServer_ConnectionPool::SetConnType() makes it inactive and asks the
+/// reactor to re-arm it.  This preserves the guarantee of the poll() loop
+/// that a connection is never processed by two pool threads at a time.
+/// Handler timers (see IServer_ConnectionHandler::GetEventsToPollFor())
+/// become poll set timers.  Each reactor listens on its own socket for
+/// every listening port (SO_REUSEPORT where available), and owns the
+/// connections it accepts.  Idle expiration and deferred connections are
+/// handled by a sweep of the reactor's own connections which runs when
+/// the reactor is woken up, and at least once a second.
+///
+/// The poll set is used by the reactor thread only; other threads queue
+/// their requests and wake the reactor up with a trigger.
+
+
+#include <connect/impl/server_connection.hpp>
+#include <connect/impl/thread_pool_for_server.hpp>
+
+
+/** @addtogroup ThreadedServer
+ *
+ * @{
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+class CServer_Reactor : public CThread
+{
+public:
+    typedef IServer_ConnectionBase TConnBase;
+
+    CServer_Reactor(CServer_ConnectionPool&   conn_pool,
+                    CPoolOfThreads_ForServer& thread_pool,
+                    const STimeout*           idle_timeout,
+                    unsigned int              index);
+
+    /// Register a connection or listener with this reactor.
+    /// Connections which are not inactive are registered disarmed.
+    void Register(TConnBase* conn);
+
+    /// Stop waiting on the connection (before it is deleted);  returns
+    /// only when the reactor thread is done with it
+    void Unregister(TConnBase* conn);
+
+    /// The connection has been processed: wait on it again if it became
+    /// inactive, or dispose of it if it got closed
+    void Rearm(TConnBase* conn, EServerConnType type);
+
+    /// Create and register this reactor's own listening socket on the
+    /// port of the given (already listening) listener
+    void AddListener(const CServer_Listener& primary);
+
+    /// Stop and delete the listeners on the given port owned by this
+    /// reactor (done asynchronously by the reactor thread)
+    void StopListener(unsigned short port);
+
+    /// Make the reactor run its sweep as soon as possible
+    void WakeUp(void);
+
+    /// Ask the reactor thread to exit (use Join() to wait for it)
+    void RequestStop(void);
+
+    /// Close the listening sockets owned by this reactor
+    void StopListening(void);
+
+    unsigned int GetIndex(void) const { return m_Index; }
+
+protected:
+    virtual ~CServer_Reactor();
+    virtual void* Main(void);
+
+private:
+    typedef vector<TConnBase*> TConnsList;
+
+    void x_Notify(void);
+    void x_ProcessRequests(TConnsList& removed);
+    void x_Add(TConnBase* conn);
+    void x_Remove(TConnBase* conn);
+    void x_Arm(TConnBase* conn);
+    void x_Dispose(TConnBase* conn, EServIO_Event event);
+    void x_Dispatch(TConnBase* conn, EIO_Event revent, bool expired);
+    void x_Submit(TConnBase* conn, EServIO_Event event);
+    void x_RemoveListeners(const vector<unsigned short>& ports);
+    void x_Sweep(void);
+
+    CServer_ConnectionPool&   m_ConnPool;
+    CPoolOfThreads_ForServer& m_ThreadPool;
+    const STimeout*           m_IdleTimeout;
+    unsigned int              m_Index;
+
+    /// Used by the reactor thread only (or by anybody while it is not
+    /// running)
+    CSocketPollSet            m_PollSet;
+    set<TConnBase*>           m_Conns;
+
+    /// Wakes the reactor up from CSocketPollSet::Wait()
+    CTrigger                  m_WakeTrigger;
+
+    /// Requests from other threads, protected by m_Lock
+    CFastMutex                m_Lock;
+    CConditionVariable        m_RemovedCond;
+    bool                      m_Running;
+    bool                      m_Notified;
+    bool                      m_SweepRequested;
+    volatile bool             m_Stop;
+    TConnsList                m_ToAdd;
+    TConnsList                m_ToArm;
+    TConnsList                m_ToRemove;
+    vector<unsigned short>    m_PortsToStop;
+
+    /// Listeners created for this reactor (in addition to the ones in
+    /// the connection pool, which belong to the first reactor)
+    vector<CServer_Listener*> m_OwnListeners;
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+#endif  /* CONNECT___SERVER_REACTOR__HPP */
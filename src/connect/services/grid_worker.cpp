@@ -315,6 +315,85 @@ private:
 };
 
 
+/////////////////////////////////////////////////////////////////////////////
+//
+CJobBatchControl::CJobBatchControl() :
+    m_MaxThreads(1),
+    m_MaxPrefetch(0),
+    m_MaxCommitBatch(1),
+    m_Adaptive(false),
+    m_JobRunTime(0.0),
+    m_GetRoundTrip(0.0),
+    m_CommitRoundTrip(0.0)
+{
+}
+
+void CJobBatchControl::Init(unsigned max_threads, unsigned max_prefetch,
+        unsigned max_commit_batch, bool adaptive)
+{
+    CFastMutexGuard guard(m_Mutex);
+
+    m_MaxThreads = max_threads > 0 ? max_threads : 1;
+    m_MaxPrefetch = max_prefetch;
+    m_MaxCommitBatch = max_commit_batch > 0 ? max_commit_batch : 1;
+    m_Adaptive = adaptive;
+}
+
+void CJobBatchControl::x_Average(double& average, double value)
+{
+    if (average <= 0.0)
+        average = value;
+    else
+        average += (value - average) / 8;
+}
+
+void CJobBatchControl::OnJobDone(double run_time)
+{
+    CFastMutexGuard guard(m_Mutex);
+    x_Average(m_JobRunTime, run_time);
+}
+
+void CJobBatchControl::OnGetJob(double round_trip)
+{
+    CFastMutexGuard guard(m_Mutex);
+    x_Average(m_GetRoundTrip, round_trip);
+}
+
+void CJobBatchControl::OnCommit(double round_trip)
+{
+    CFastMutexGuard guard(m_Mutex);
+    x_Average(m_CommitRoundTrip, round_trip);
+}
+
+unsigned CJobBatchControl::GetPrefetchDepth() const
+{
+    CFastMutexGuard guard(m_Mutex);
+
+    if (!m_Adaptive || m_MaxPrefetch == 0)
+        return m_MaxPrefetch;
+
+    // Start with one job in reserve until there are measurements
+    if (m_JobRunTime <= 0.0 || m_GetRoundTrip <= 0.0)
+        return 1;
+
+    double depth = m_MaxThreads * m_GetRoundTrip / m_JobRunTime + 0.5;
+
+    return depth < m_MaxPrefetch ? (unsigned) depth : m_MaxPrefetch;
+}
+
+unsigned CJobBatchControl::GetCommitBatchSize() const
+{
+    CFastMutexGuard guard(m_Mutex);
+
+    if (!m_Adaptive || m_JobRunTime <= 0.0 || m_CommitRoundTrip <= 0.0)
+        return m_MaxCommitBatch;
+
+    double size = 2 * m_MaxThreads * m_CommitRoundTrip / m_JobRunTime + 1;
+
+    return size < m_MaxCommitBatch ? (unsigned) size : m_MaxCommitBatch;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 //
 CGridWorkerNode::CGridWorkerNode(CNcbiApplication& app,
@@ -336,6 +415,9 @@ SGridWorkerNodeImpl::SGridWorkerNodeImpl(CNcbiApplication& app,
     m_TotalMemoryLimit(0),
     m_TotalTimeLimit(0),
     m_StartupTime(0),
+    m_QueueTimeout(0),
+    m_QueueRunTimeout(0),
+    m_JobPrefetchTimeout(0),
     m_CleanupEventSource(new CWorkerNodeCleanup()),
     m_SuspendResumeEvent(NO_EVENT),
     m_TimelineIsSuspended(false),
@@ -734,6 +816,8 @@ int SGridWorkerNodeImpl::Run(
             m_NetScheduleAPI.GetAdmin().GetQueueInfo(queue_info);
 
             m_QueueTimeout = NStr::StringToUInt(queue_info["timeout"]);
+            m_QueueRunTimeout = (unsigned) NStr::StringToDouble(
+                    queue_info["run_timeout"], NStr::fConvErr_NoThrow);
 
             m_QueueEmbeddedOutputSize = m_NetScheduleAPI->m_UseEmbeddedStorage ?
                     m_NetScheduleAPI.GetServerParams().max_output_size : 0;
@@ -756,6 +840,21 @@ int SGridWorkerNodeImpl::Run(
     m_JobsPerSessionID.ResetJobCounter((unsigned) reg.GetInt(kServerSec,
             "max_jobs_per_session_id", 0, 0, IRegistry::eErrPost));
 
+    // Prefetched jobs are already running as far as the server is
+    // concerned, so they are not kept longer than a half of the run timeout
+    m_JobPrefetchTimeout = reg.GetInt(kServerSec,
+            "job_prefetch_timeout", 10, 0, IRegistry::eErrPost);
+    if (m_QueueRunTimeout > 0 && m_JobPrefetchTimeout > m_QueueRunTimeout / 2)
+        m_JobPrefetchTimeout = m_QueueRunTimeout / 2;
+
+    m_JobBatchControl.Init(m_MaxThreads,
+            reg.GetInt(kServerSec, "max_job_prefetch",
+                    0, 0, IRegistry::eErrPost),
+            reg.GetInt(kServerSec, "max_commit_batch",
+                    1, 0, IRegistry::eErrPost),
+            reg.GetBool(kServerSec, "adaptive_job_batching",
+                    true, 0, IRegistry::eErrPost));
+
     CWNJobWatcher& watcher(CGridGlobals::GetInstance().GetJobWatcher());
     watcher.SetMaxJobsAllowed(reg.GetInt(kServerSec,
             "max_total_jobs", 0, 0, IRegistry::eErrPost));
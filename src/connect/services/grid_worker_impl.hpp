@@ -38,6 +38,7 @@
 #include "netschedule_api_impl.hpp"
 
 #include <unordered_map>
+#include <deque>
 
 BEGIN_NCBI_SCOPE
 
@@ -149,6 +150,80 @@ private:
     bool m_RunRegistered;
 };
 
+/// Sizes job prefetching and result commit batches.
+///
+/// Both are fixed at the configured maxima unless the adaptive mode is on.
+/// In that mode they are derived from the moving averages of the job run
+/// time and of the server round trip times: the node keeps as many jobs in
+/// reserve as its threads complete during one GET round trip (none for jobs
+/// much longer than that) and commits at most as many results at once as
+/// complete during two commit round trips.
+///@internal
+class NCBI_XCONNECT_EXPORT CJobBatchControl
+{
+public:
+    CJobBatchControl();
+
+    void Init(unsigned max_threads, unsigned max_prefetch,
+            unsigned max_commit_batch, bool adaptive);
+
+    void OnJobDone(double run_time);
+    void OnGetJob(double round_trip);
+    void OnCommit(double round_trip);
+
+    unsigned GetPrefetchDepth() const;
+    unsigned GetCommitBatchSize() const;
+
+private:
+    static void x_Average(double& average, double value);
+
+    mutable CFastMutex m_Mutex;
+    unsigned m_MaxThreads;
+    unsigned m_MaxPrefetch;
+    unsigned m_MaxCommitBatch;
+    bool m_Adaptive;
+    double m_JobRunTime;
+    double m_GetRoundTrip;
+    double m_CommitRoundTrip;
+};
+
+/// Jobs taken from the servers ahead of time.
+///
+/// A job that has not been started before its deadline, as well as all
+/// the jobs left when the node suspends or shuts down, are handed back
+/// by x_ReturnPrefetchedJob().
+///@internal
+class NCBI_XCONNECT_EXPORT CJobPrefetchQueue
+{
+public:
+    virtual ~CJobPrefetchQueue() {}
+
+    void AddPrefetchedJob(const CNetScheduleJob& job, unsigned timeout);
+
+    /// Take the first prefetched job that is still fresh enough to
+    /// be started; stale ones are returned to the queue.
+    bool PopPrefetchedJob(CNetScheduleJob& job);
+    void ReturnPrefetchedJobs();
+
+    size_t GetPrefetchedCount() const { return m_PrefetchedJobs.size(); }
+
+protected:
+    virtual void x_ReturnPrefetchedJob(CNetScheduleJob& job) = 0;
+
+private:
+    struct SPrefetchedJob
+    {
+        SPrefetchedJob(const CNetScheduleJob& j, unsigned timeout) :
+            job(j), deadline(timeout, 0)
+        {
+        }
+
+        CNetScheduleJob job;
+        CDeadline deadline;
+    };
+    deque<SPrefetchedJob> m_PrefetchedJobs;
+};
+
 ///@internal
 struct SGridWorkerNodeImpl : public CObject
 {
@@ -213,6 +288,9 @@ struct SGridWorkerNodeImpl : public CObject
     unsigned                     m_TotalTimeLimit;
     time_t                       m_StartupTime;
     unsigned                     m_QueueTimeout;
+    unsigned                     m_QueueRunTimeout;
+    unsigned                     m_JobPrefetchTimeout;
+    CJobBatchControl             m_JobBatchControl;
 
     typedef map<IWorkerNodeJobWatcher*,
             AutoPtr<IWorkerNodeJobWatcher> > TJobWatchers;
@@ -344,7 +422,7 @@ public:
     virtual void* Main();
 
 private:
-    class CImpl : public CNetScheduleGetJob
+    class CImpl : public CNetScheduleGetJob, public CJobPrefetchQueue
     {
     public:
         CImpl(SGridWorkerNodeImpl* worker_node) :
@@ -371,6 +449,9 @@ private:
         CNetScheduleAPI m_API;
         const unsigned m_Timeout;
 
+    protected:
+        void x_ReturnPrefetchedJob(CNetScheduleJob& job) override;
+
     private:
         SGridWorkerNodeImpl* m_WorkerNode;
 
@@ -378,6 +459,7 @@ private:
     };
 
     bool x_GetNextJob(CNetScheduleJob& job);
+    void x_PrefetchJobs();
 
     SGridWorkerNodeImpl* m_WorkerNode;
     CImpl m_Impl;
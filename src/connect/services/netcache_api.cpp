@@ -584,38 +584,43 @@ CNetServerConnection SNetCacheAPIImpl::InitiateWriteCmd(
                 " in response to PUT3 \"" << stripped_blob_id << "\"");
         }
     } else {
-        if (m_Service.IsLoadBalanced()) {
-            CNetCacheKey::TNCKeyFlags key_flags = 0;
+        CompleteNewBlobKey(exec_result.response,
+                exec_result.conn->m_Server, parameters);
 
-            switch (parameters->GetMirroringMode()) {
-            case CNetCacheAPI::eMirroringDisabled:
-                key_flags |= CNetCacheKey::fNCKey_SingleServer;
-                break;
-            case CNetCacheAPI::eMirroringEnabled:
-                break;
-            default:
-                if (!CNetCacheServerListener::x_GetServerProperties(
-                        exec_result.conn->m_Server)->mirrored)
-                    key_flags |= CNetCacheKey::fNCKey_SingleServer;
-            }
+        nc_writer->SetBlobID(exec_result.response);
+    }
+
+    return exec_result.conn;
+}
 
-            bool server_check_hint = true;
-            parameters->GetServerCheckHint(&server_check_hint);
-            if (!server_check_hint)
-                key_flags |= CNetCacheKey::fNCKey_NoServerCheck;
+void SNetCacheAPIImpl::CompleteNewBlobKey(string& key, SNetServerImpl* server,
+        const CNetCacheAPIParameters* parameters)
+{
+    if (m_Service.IsLoadBalanced()) {
+        CNetCacheKey::TNCKeyFlags key_flags = 0;
 
-            CNetCacheKey::AddExtensions(exec_result.response,
-                    m_Service.GetServiceName(), key_flags);
+        switch (parameters->GetMirroringMode()) {
+        case CNetCacheAPI::eMirroringDisabled:
+            key_flags |= CNetCacheKey::fNCKey_SingleServer;
+            break;
+        case CNetCacheAPI::eMirroringEnabled:
+            break;
+        default:
+            if (!CNetCacheServerListener::x_GetServerProperties(
+                    server)->mirrored)
+                key_flags |= CNetCacheKey::fNCKey_SingleServer;
         }
 
-        if (parameters->GetUseCompoundID())
-            exec_result.response = CNetCacheKey::KeyToCompoundID(
-                    exec_result.response, m_CompoundIDPool);
+        bool server_check_hint = true;
+        parameters->GetServerCheckHint(&server_check_hint);
+        if (!server_check_hint)
+            key_flags |= CNetCacheKey::fNCKey_NoServerCheck;
 
-        nc_writer->SetBlobID(exec_result.response);
+        CNetCacheKey::AddExtensions(key, m_Service.GetServiceName(), key_flags);
     }
 
-    return exec_result.conn;
+    if (parameters->GetUseCompoundID())
+        key = CNetCacheKey::KeyToCompoundID(key, m_CompoundIDPool);
 }
 
 
@@ -668,10 +673,10 @@ bool CNetCacheAPI::HasBlob(const string& blob_id,
     parameters.LoadNamedParameters(optional);
 
     try {
-        return m_Impl->ExecMirrorAware(key,
+        return IsBlobPresent(m_Impl->ExecMirrorAware(key,
                 m_Impl->MakeCmd("HASB ", key, &parameters),
                 false,
-                &parameters).response[0] == '1';
+                &parameters).response);
     }
     // Workaround for a bug in NC v6.6.1 (CXX-4095)
     // TODO: Throw away after all NC servers are upgraded to v6.6.2+
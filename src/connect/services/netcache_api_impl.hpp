@@ -103,6 +103,10 @@ struct NCBI_XCONNECT_EXPORT SNetCacheAPIImpl : public CObject
     string MakeCmd(const char* cmd_base, const CNetCacheKey& key,
             const CNetCacheAPIParameters* parameters);
 
+    // Turn the key returned by the server for a new blob into a client key
+    void CompleteNewBlobKey(string& key, SNetServerImpl* server,
+            const CNetCacheAPIParameters* parameters);
+
     unsigned x_ExtractBlobAge(const CNetServer::SExecResult& exec_result,
             const char* cmd_name);
 
@@ -148,6 +152,105 @@ inline SNetCacheAdminImpl::SNetCacheAdminImpl(SNetCacheAPIImpl* nc_api_impl) :
 {
 }
 
+// Whether the reply to HASB means that the blob exists: "1", or, from
+// ICache servers, "0, VER=<version>" (the blob exists with another version)
+inline bool IsBlobPresent(const string& hasb_response)
+{
+    return hasb_response[0] == '1' ||
+        NStr::StartsWith(hasb_response, "0, VER=");
+}
+
+// Engine of CNetCacheBatch and CNetICacheBatch.
+// Every server gets its own queue of operations and (at most) one connection.
+// Commands are written without waiting for replies, as long as the number
+// of commands and the amount of data sent and not replied to yet stay within
+// a window (replies are not read while commands are written, and if the
+// server cannot write a reply, it stops reading commands).  Replies are read
+// from whichever connection has them first.
+struct NCBI_XCONNECT_EXPORT SNetCachePipeline : public CObject
+{
+    typedef SNetCacheBatchResult::EOperation EOperation;
+
+    struct SItem
+    {
+        SItem(EOperation op) : operation(op), version(0), ttl(0),
+            retried(false) {}
+
+        EOperation operation;
+        // Server to pipeline the command to;  if NULL, the operation
+        // is executed by ExecDirectly()
+        CNetServer server;
+        string cmd;
+        string key;
+        int version;
+        string subkey;
+        // For ePut: blob data and its life span
+        string data;
+        unsigned ttl;
+        bool retried;
+    };
+
+    SNetCachePipeline(CNetService::TInstance service);
+
+    size_t Add(const SItem& item);
+
+    bool Next(SNetCacheBatchResult& result);
+
+protected:
+    // Execute the operation with the regular (not pipelined) API
+    virtual void ExecDirectly(SItem& item, SNetCacheBatchResult& result) = 0;
+
+    // Check the reply to the command of an ePut operation
+    // (it is received before the blob data is confirmed)
+    virtual void OnPutReply(SItem& item, const string& response,
+            CNetServer& server, SNetCacheBatchResult& result);
+
+private:
+    struct SChannel
+    {
+        SChannel() : bytes_in_flight(0) {}
+
+        CNetServer server;
+        CNetServerConnection conn;
+        deque<size_t> pending;
+        deque<size_t> in_flight;
+        size_t bytes_in_flight;
+    };
+
+    typedef map<SNetServerInPool*, SChannel> TChannels;
+
+    void x_SendCommands(SChannel& channel);
+    void x_ReadReply(SChannel& channel);
+    void x_ResetChannel(SChannel& channel);
+    void x_Execute(size_t index);
+    void x_Complete(size_t index, SNetCacheBatchResult& result);
+    void x_Fail(size_t index, const string& error);
+
+    CNetService m_Service;
+    vector<SItem> m_Items;
+    TChannels m_Channels;
+    // Operations not pipelined
+    deque<size_t> m_Direct;
+    deque<SNetCacheBatchResult> m_Results;
+};
+
+struct SNetCacheBatchImpl : public SNetCachePipeline
+{
+    SNetCacheBatchImpl(SNetCacheAPIImpl* api_impl,
+            const CNamedParameterList* optional);
+
+    size_t AddCmd(EOperation operation, const char* cmd_base,
+            const string& blob_id);
+    CNetServer GetServer(const CNetCacheKey& key);
+
+    void ExecDirectly(SItem& item, SNetCacheBatchResult& result) override;
+    void OnPutReply(SItem& item, const string& response,
+            CNetServer& server, SNetCacheBatchResult& result) override;
+
+    CNetCacheAPI m_API;
+    CNetCacheAPIParameters m_Parameters;
+};
+
 class NCBI_XCONNECT_EXPORT SNetCacheMirrorTraversal : public IServiceTraversal
 {
 public:
@@ -0,0 +1,572 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Pipelined execution of NetCache blob operations (CNetCacheBatch).
+ *
+ */
+
+#include <ncbi_pch.hpp>
+
+#include "netcache_api_impl.hpp"
+
+#include <connect/services/netcache_api_expt.hpp>
+
+#include <util/buffer_writer.hpp>
+#include <util/transmissionrw.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+
+// Pipelining window of one connection
+static const size_t kMaxCmdsInFlight = 100;
+static const size_t kMaxBytesInFlight = 64 * 1024;
+
+// Takes a connection to the server (from the pool, if there is one there)
+class CNetCacheBatchConnector : public INetServerExecHandler
+{
+public:
+    virtual void Exec(CNetServerConnection::TInstance conn_impl,
+            STimeout* /*timeout*/)
+    {
+        m_Conn = conn_impl;
+    }
+
+    CNetServerConnection m_Conn;
+};
+
+static size_t s_BytesToSend(const SNetCachePipeline::SItem& item)
+{
+    // Command line, blob data and overhead of the transmission protocol
+    return item.cmd.size() + 2 +
+        (item.operation == SNetCacheBatchResult::ePut ?
+            item.data.size() + 16 : 0);
+}
+
+SNetCachePipeline::SNetCachePipeline(CNetService::TInstance service) :
+    m_Service(service)
+{
+}
+
+size_t SNetCachePipeline::Add(const SItem& item)
+{
+    size_t index = m_Items.size();
+
+    m_Items.push_back(item);
+
+    CNetServer& server(m_Items.back().server);
+
+    if (!server)
+        m_Direct.push_back(index);
+    else {
+        SChannel& channel = m_Channels[server->m_ServerInPool.GetPointer()];
+
+        if (!channel.server)
+            channel.server = server;
+        channel.pending.push_back(index);
+    }
+
+    return index;
+}
+
+bool SNetCachePipeline::Next(SNetCacheBatchResult& result)
+{
+    for (;;) {
+        if (!m_Results.empty()) {
+            result = move(m_Results.front());
+            m_Results.pop_front();
+            return true;
+        }
+
+        vector<CSocketAPI::SPoll> polls;
+        vector<SChannel*> waiting;
+        bool pending = false;
+
+        NON_CONST_ITERATE(TChannels, it, m_Channels) {
+            SChannel& channel = it->second;
+
+            x_SendCommands(channel);
+
+            if (!channel.in_flight.empty()) {
+                polls.push_back(CSocketAPI::SPoll(
+                        &channel.conn->m_Socket, eIO_Read));
+                waiting.push_back(&channel);
+            } else if (!channel.pending.empty())
+                pending = true;
+        }
+
+        // Servers keep processing pipelined commands meanwhile
+        if (!m_Direct.empty()) {
+            size_t index = m_Direct.front();
+            m_Direct.pop_front();
+            x_Execute(index);
+            continue;
+        }
+
+        if (waiting.empty()) {
+            if (pending || !m_Results.empty())
+                continue;
+            return false;
+        }
+
+        if (waiting.size() == 1) {
+            x_ReadReply(*waiting.front());
+            continue;
+        }
+
+        const STimeout& timeout =
+            m_Service->m_ServerPool.GetCommunicationTimeout();
+        EIO_Status status = CSocketAPI::Poll(polls, &timeout);
+
+        if (status == eIO_Interrupt)
+            continue;
+
+        if (status != eIO_Success) {
+            ITERATE(vector<SChannel*>, it, waiting) {
+                x_ResetChannel(**it);
+            }
+            continue;
+        }
+
+        for (size_t i = 0; i < polls.size(); ++i)
+            if (polls[i].m_REvent != eIO_Open)
+                x_ReadReply(*waiting[i]);
+    }
+}
+
+void SNetCachePipeline::OnPutReply(SItem& /*item*/,
+        const string& /*response*/, CNetServer& /*server*/,
+        SNetCacheBatchResult& /*result*/)
+{
+}
+
+void SNetCachePipeline::x_SendCommands(SChannel& channel)
+{
+    if (channel.pending.empty()) {
+        // Return the connection to the pool as soon as possible
+        if (channel.in_flight.empty())
+            channel.conn = NULL;
+        return;
+    }
+
+    if (!channel.conn) {
+        CNetCacheBatchConnector connector;
+
+        try {
+            channel.server->TryExec(connector, NULL, m_Service->m_Listener);
+        }
+        catch (CException&) {
+            // The regular API will try mirrors or other servers, if any
+            while (!channel.pending.empty()) {
+                m_Direct.push_back(channel.pending.front());
+                channel.pending.pop_front();
+            }
+            return;
+        }
+
+        channel.conn = connector.m_Conn;
+
+        const STimeout& timeout =
+            m_Service->m_ServerPool.GetCommunicationTimeout();
+        channel.conn->m_Socket.SetTimeout(eIO_ReadWrite, &timeout);
+    }
+
+    string output;
+
+    while (!channel.pending.empty()) {
+        SItem& item = m_Items[channel.pending.front()];
+        size_t item_bytes = s_BytesToSend(item);
+
+        // A command that does not fit the window alone is sent
+        // only when there are no other replies to wait for
+        if (!channel.in_flight.empty() &&
+                (channel.in_flight.size() >= kMaxCmdsInFlight ||
+                channel.bytes_in_flight + item_bytes > kMaxBytesInFlight))
+            break;
+
+        // TODO change to "\n" when no old NS/NC servers remain.
+        output.append(item.cmd).append("\r\n", 2);
+
+        if (item.operation == SNetCacheBatchResult::ePut) {
+            CBufferWriter<string> buffer_writer(output, eCreateMode_Add);
+            CTransmissionWriter writer(&buffer_writer, eNoOwnership,
+                    CTransmissionWriter::eSendEofPacket);
+
+            const char* data = item.data.data();
+            size_t size = item.data.size();
+
+            while (size > 0) {
+                size_t written = 0;
+                writer.Write(data, size, &written);
+                data += written;
+                size -= written;
+            }
+
+            writer.Close();
+        }
+
+        channel.bytes_in_flight += item_bytes;
+        channel.in_flight.push_back(channel.pending.front());
+        channel.pending.pop_front();
+    }
+
+    if (output.empty())
+        return;
+
+    EIO_Status status = channel.conn->m_Socket.Write(output.data(),
+            output.size(), NULL, eIO_WritePersist);
+
+    if (status != eIO_Success)
+        x_ResetChannel(channel);
+}
+
+void SNetCachePipeline::x_ReadReply(SChannel& channel)
+{
+    size_t index = channel.in_flight.front();
+    SItem& item = m_Items[index];
+    SNetCacheBatchResult result;
+
+    try {
+        string response;
+
+        channel.conn->ReadCmdOutputLine(response, false);
+
+        switch (item.operation) {
+        case SNetCacheBatchResult::eGet:
+            {
+                string::size_type pos = response.find("SIZE=");
+
+                if (pos == string::npos) {
+                    CONNSERV_THROW_FMT(CNetServiceException,
+                            eCommunicationError, channel.server,
+                            "No SIZE field in reply to the blob "
+                            "reading command");
+                }
+
+                result.data.resize(CheckBlobSize(NStr::StringToUInt8(
+                        response.c_str() + pos + sizeof("SIZE=") - 1,
+                        NStr::fAllowTrailingSymbols)));
+
+                if (!result.data.empty()) {
+                    EIO_Status status = channel.conn->m_Socket.Read(
+                            &result.data[0], result.data.size(),
+                            NULL, eIO_ReadPersist);
+
+                    if (status != eIO_Success) {
+                        CONNSERV_THROW_FMT(CNetServiceException,
+                                eCommunicationError, channel.server,
+                                "Error while reading blob: " <<
+                                IO_StatusStr(status));
+                    }
+                }
+
+                result.exists = true;
+            }
+            break;
+
+        case SNetCacheBatchResult::eHasBlob:
+            result.exists = IsBlobPresent(response);
+            break;
+
+        case SNetCacheBatchResult::ePut:
+            OnPutReply(item, response, channel.server, result);
+            // Confirmation of the blob data
+            channel.conn->ReadCmdOutputLine(response, false);
+            break;
+        }
+
+        result.success = true;
+    }
+    catch (CNetCacheException& e) {
+        // The connection is usable unless the server did not read
+        // the blob data that followed the command
+        if (item.operation == SNetCacheBatchResult::ePut) {
+            channel.in_flight.pop_front();
+            x_Fail(index, e.GetMsg());
+            x_ResetChannel(channel);
+            return;
+        }
+
+        if (dynamic_cast<CNetCacheBlobTooOldException*>(&e) != NULL ||
+                e.GetErrCode() == CNetCacheException::eBlobNotFound)
+            result.success = true;
+        else
+            result.error = e.GetMsg();
+    }
+    catch (CException&) {
+        x_ResetChannel(channel);
+        return;
+    }
+
+    channel.in_flight.pop_front();
+    channel.bytes_in_flight -= s_BytesToSend(item);
+    x_Complete(index, result);
+}
+
+void SNetCachePipeline::x_ResetChannel(SChannel& channel)
+{
+    channel.conn->Abort();
+    channel.conn = NULL;
+    channel.bytes_in_flight = 0;
+
+    // Commands are sent once more over a new connection (the old one
+    // could have been closed by the server while it was in the pool),
+    // and then left to the regular API
+    while (!channel.in_flight.empty()) {
+        size_t index = channel.in_flight.back();
+        SItem& item = m_Items[index];
+
+        channel.in_flight.pop_back();
+
+        if (item.retried)
+            m_Direct.push_back(index);
+        else {
+            item.retried = true;
+            channel.pending.push_front(index);
+        }
+    }
+}
+
+void SNetCachePipeline::x_Execute(size_t index)
+{
+    SNetCacheBatchResult result;
+
+    try {
+        ExecDirectly(m_Items[index], result);
+        result.success = true;
+    }
+    catch (CException& e) {
+        result.error = e.GetMsg();
+    }
+
+    x_Complete(index, result);
+}
+
+void SNetCachePipeline::x_Complete(size_t index, SNetCacheBatchResult& result)
+{
+    SItem& item = m_Items[index];
+
+    result.index = index;
+    result.operation = item.operation;
+    if (result.key.empty())
+        result.key = item.key;
+
+    // Only the results are kept from now on
+    string().swap(item.cmd);
+    string().swap(item.data);
+
+    m_Results.push_back(move(result));
+}
+
+void SNetCachePipeline::x_Fail(size_t index, const string& error)
+{
+    SNetCacheBatchResult result;
+
+    result.error = error;
+    x_Complete(index, result);
+}
+
+SNetCacheBatchImpl::SNetCacheBatchImpl(SNetCacheAPIImpl* api_impl,
+        const CNamedParameterList* optional) :
+    SNetCachePipeline(api_impl->m_Service),
+    m_API(api_impl),
+    m_Parameters(&api_impl->m_DefaultParameters)
+{
+    m_Parameters.LoadNamedParameters(optional);
+    m_Parameters.SetCachingMode(CNetCacheAPI::eCaching_Disable);
+}
+
+size_t SNetCacheBatchImpl::AddCmd(EOperation operation, const char* cmd_base,
+        const string& blob_id)
+{
+    SItem item(operation);
+
+    item.key = blob_id;
+
+    try {
+        CNetCacheKey key(blob_id, m_API->m_CompoundIDPool);
+
+        item.cmd = m_API->MakeCmd(cmd_base, key, &m_Parameters);
+        item.server = GetServer(key);
+    }
+    catch (CException&) {
+        // The regular API will report the problem
+        item.server = NULL;
+    }
+
+    return Add(item);
+}
+
+CNetServer SNetCacheBatchImpl::GetServer(const CNetCacheKey& key)
+{
+    CNetService service(m_API->m_Service);
+
+    // Keys of version 3 and keys from other services require
+    // the server to be looked up, see ExecMirrorAware()
+    if (key.GetVersion() == 3 || (!key.GetServiceName().empty() &&
+            key.GetServiceName() != service.GetServiceName()))
+        return CNetServer();
+
+    CNetServer server(service.GetServer(key.GetHost(), key.GetPort()));
+
+    ESwitch server_check = eDefault;
+    m_Parameters.GetServerCheck(&server_check);
+    if (server_check == eDefault)
+        server_check = key.GetFlag(CNetCacheKey::fNCKey_NoServerCheck) ?
+                eOff : eOn;
+
+    if (server_check != eOff && !service->IsInService(server))
+        return CNetServer();
+
+    return server;
+}
+
+void SNetCacheBatchImpl::ExecDirectly(SItem& item,
+        SNetCacheBatchResult& result)
+{
+    if (item.operation == SNetCacheBatchResult::ePut) {
+        string key(item.key);
+        CNetCacheWriter writer(m_API, &key, kEmptyStr,
+                eNetCache_Wait, &m_Parameters);
+
+        writer.WriteBufferAndClose(item.data.data(), item.data.size());
+        result.key = key;
+        return;
+    }
+
+    CNetCacheKey key(item.key, m_API->m_CompoundIDPool);
+
+    try {
+        if (item.operation == SNetCacheBatchResult::eHasBlob) {
+            result.exists = IsBlobPresent(m_API->ExecMirrorAware(key,
+                    m_API->MakeCmd("HASB ", key, &m_Parameters),
+                    false, &m_Parameters).response);
+            return;
+        }
+
+        CNetServer::SExecResult exec_result(m_API->ExecMirrorAware(key,
+                m_API->MakeCmd("GET2 ", key, &m_Parameters),
+                false, &m_Parameters));
+
+        size_t blob_size;
+        CNetCacheReader reader(m_API, item.key, exec_result,
+                &blob_size, &m_Parameters);
+
+        result.data.resize(blob_size);
+        SNetCacheAPIImpl::ReadBuffer(reader,
+                const_cast<char*>(result.data.data()),
+                blob_size, NULL, blob_size);
+        result.exists = true;
+    }
+    catch (CNetCacheBlobTooOldException&) {
+    }
+    catch (CNetCacheException& e) {
+        if (e.GetErrCode() != CNetCacheException::eBlobNotFound)
+            throw;
+    }
+}
+
+void SNetCacheBatchImpl::OnPutReply(SItem& item, const string& response,
+        CNetServer& server, SNetCacheBatchResult& result)
+{
+    if (NStr::FindCase(response, "ID:") != 0 || response.length() <= 3) {
+        CONNSERV_THROW_FMT(CNetServiceException, eCommunicationError,
+            server, "Unexpected server response: " << response);
+    }
+
+    string key(response, 3);
+
+    if (item.key.empty()) {
+        m_API->CompleteNewBlobKey(key, server, &m_Parameters);
+        result.key = key;
+    } else if (key != CNetCacheKey(item.key,
+            m_API->m_CompoundIDPool).StripKeyExtensions()) {
+        CONNSERV_THROW_FMT(CNetCacheException, eInvalidServerResponse,
+            server, "Server created " << key <<
+            " in response to PUT3 \"" << item.key << "\"");
+    }
+}
+
+size_t CNetCacheBatch::AddGet(const string& key)
+{
+    return m_Impl->AddCmd(SNetCacheBatchResult::eGet, "GET2 ", key);
+}
+
+size_t CNetCacheBatch::AddHasBlob(const string& key)
+{
+    return m_Impl->AddCmd(SNetCacheBatchResult::eHasBlob, "HASB ", key);
+}
+
+size_t CNetCacheBatch::AddPut(const string& key, const string& data)
+{
+    SNetCachePipeline::SItem item(SNetCacheBatchResult::ePut);
+    SNetCacheAPIImpl* api_impl = m_Impl->m_API;
+
+    item.key = key;
+    item.data = data;
+
+    try {
+        string cmd("PUT3 ");
+        cmd.append(NStr::IntToString(m_Impl->m_Parameters.GetTTL()));
+
+        if (key.empty()) {
+            // A random server, like FindServerAndExec() does
+            item.server = *api_impl->m_Service.Iterate(
+                    CNetService::eRandomize);
+        } else {
+            CNetCacheKey key_obj(key, api_impl->m_CompoundIDPool);
+            item.server = m_Impl->GetServer(key_obj);
+            cmd.push_back(' ');
+            cmd.append(key_obj.StripKeyExtensions());
+        }
+
+        api_impl->m_UseNextSubHitID.ProperCommand();
+        api_impl->AppendClientIPSessionIDPasswordAgeHitID(&cmd,
+                &m_Impl->m_Parameters);
+        if (api_impl->m_FlagsOnWrite)
+            cmd.append(" flags=").append(to_string(api_impl->m_FlagsOnWrite));
+
+        item.cmd = cmd;
+    }
+    catch (CException&) {
+        item.server = NULL;
+    }
+
+    return m_Impl->Add(item);
+}
+
+bool CNetCacheBatch::Next(SNetCacheBatchResult& result)
+{
+    return m_Impl->Next(result);
+}
+
+CNetCacheBatch CNetCacheAPI::NewBatch(const CNamedParameterList* optional)
+{
+    return new SNetCacheBatchImpl(m_Impl, optional);
+}
+
+
+END_NCBI_SCOPE
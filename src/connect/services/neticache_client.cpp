@@ -670,7 +670,7 @@ bool CNetICacheClient::HasBlob(const string& key, const string& subkey,
         parameters.LoadNamedParameters(optional);
 
         string response(m_Impl->ExecStdCmd("HASB", key, 0, subkey, &parameters));
-        return (response[0] == '1'|| NStr::StartsWith(response, "0, VER="));
+        return IsBlobPresent(response);
     }
     // Workaround for a bug in NC v6.6.1 (CXX-4095)
     // TODO: Throw away after all NC servers are upgraded to v6.6.2+
@@ -681,6 +681,182 @@ bool CNetICacheClient::HasBlob(const string& key, const string& subkey,
     }
 }
 
+struct SNetICacheBatchImpl : public SNetCachePipeline
+{
+    SNetICacheBatchImpl(SNetICacheClientImpl* icache_impl,
+            const CNamedParameterList* optional) :
+        SNetCachePipeline(icache_impl->m_Service),
+        m_ICache(icache_impl),
+        m_Parameters(&icache_impl->m_DefaultParameters)
+    {
+        m_Parameters.LoadNamedParameters(optional);
+        m_Parameters.SetCachingMode(CNetCacheAPI::eCaching_Disable);
+    }
+
+    size_t AddCmd(SItem& item);
+    CNetServer GetServer(const string& key);
+
+    void ExecDirectly(SItem& item, SNetCacheBatchResult& result) override;
+
+    CNetICacheClient m_ICache;
+    CNetCacheAPIParameters m_Parameters;
+};
+
+size_t SNetICacheBatchImpl::AddCmd(SItem& item)
+{
+    try {
+        string blob_id(s_KeyVersionSubkeyToBlobID(item.key,
+                    item.version, item.subkey));
+
+        switch (item.operation) {
+        case SNetCacheBatchResult::eGet:
+            item.cmd = m_ICache->MakeStdCmd("READ", blob_id, &m_Parameters);
+            break;
+
+        case SNetCacheBatchResult::eHasBlob:
+            item.cmd = m_ICache->MakeStdCmd("HASB", blob_id, &m_Parameters);
+            break;
+
+        case SNetCacheBatchResult::ePut:
+            item.cmd = "IC(" +
+                NStr::PrintableString(m_Parameters.GetCacheName());
+            item.cmd.append(") STOR ");
+            item.cmd.append(NStr::UIntToString(item.ttl));
+            item.cmd.push_back(' ');
+            item.cmd.append(blob_id);
+            // The reply is needed to keep the pipeline in sync
+            item.cmd.append(" confirm=1");
+            m_ICache->m_UseNextSubHitID.ProperCommand();
+            m_ICache->AppendClientIPSessionIDPasswordAgeHitID(&item.cmd,
+                    &m_Parameters);
+            if (m_ICache->m_FlagsOnWrite) {
+                item.cmd.append(" flags=").append(
+                        to_string(m_ICache->m_FlagsOnWrite));
+            }
+            break;
+        }
+
+        item.server = GetServer(item.key);
+    }
+    catch (CException&) {
+        // The regular API will report the problem
+        item.server = NULL;
+    }
+
+    return Add(item);
+}
+
+CNetServer SNetICacheBatchImpl::GetServer(const string& key)
+{
+    // Trying all servers is left to the regular API
+    if (m_Parameters.GetTryAllServers())
+        return CNetServer();
+
+    // Same as ChooseServerAndExec() does
+    CNetServer selected_server(m_Parameters.GetServerToUse());
+
+    if (selected_server)
+        return selected_server;
+
+    return *m_ICache->m_Service.IterateByWeight(key);
+}
+
+void SNetICacheBatchImpl::ExecDirectly(SItem& item,
+        SNetCacheBatchResult& result)
+{
+    string blob_id(s_KeyVersionSubkeyToBlobID(item.key,
+                item.version, item.subkey));
+
+    if (item.operation == SNetCacheBatchResult::ePut) {
+        CNetCacheAPIParameters parameters(&m_Parameters);
+
+        parameters.SetTTL(item.ttl);
+
+        CNetCacheWriter writer(m_ICache, &blob_id, item.key,
+                eNetCache_Wait, &parameters);
+
+        writer.WriteBufferAndClose(item.data.data(), item.data.size());
+        return;
+    }
+
+    try {
+        if (item.operation == SNetCacheBatchResult::eHasBlob) {
+            string response(m_ICache->ChooseServerAndExec(
+                        m_ICache->MakeStdCmd("HASB", blob_id, &m_Parameters),
+                        item.key, false, &m_Parameters).response);
+
+            result.exists = IsBlobPresent(response);
+            return;
+        }
+
+        CNetServer::SExecResult exec_result(m_ICache->ChooseServerAndExec(
+                    m_ICache->MakeStdCmd("READ", blob_id, &m_Parameters),
+                    item.key, false, &m_Parameters));
+
+        size_t blob_size;
+        CNetCacheReader reader(m_ICache, blob_id, exec_result,
+                &blob_size, &m_Parameters);
+
+        result.data.resize(blob_size);
+        SNetCacheAPIImpl::ReadBuffer(reader,
+                const_cast<char*>(result.data.data()),
+                blob_size, NULL, blob_size);
+        result.exists = true;
+    }
+    catch (CNetCacheBlobTooOldException&) {
+    }
+    catch (CNetCacheException& e) {
+        if (e.GetErrCode() != CNetCacheException::eBlobNotFound)
+            throw;
+    }
+}
+
+size_t CNetICacheBatch::AddRead(const string& key, int version,
+        const string& subkey)
+{
+    SNetCachePipeline::SItem item(SNetCacheBatchResult::eGet);
+
+    item.key = key;
+    item.version = version;
+    item.subkey = subkey;
+
+    return m_Impl->AddCmd(item);
+}
+
+size_t CNetICacheBatch::AddHasBlob(const string& key, const string& subkey)
+{
+    SNetCachePipeline::SItem item(SNetCacheBatchResult::eHasBlob);
+
+    item.key = key;
+    item.subkey = subkey;
+
+    return m_Impl->AddCmd(item);
+}
+
+size_t CNetICacheBatch::AddStore(const string& key, int version,
+        const string& subkey, const string& data, unsigned int time_to_live)
+{
+    SNetCachePipeline::SItem item(SNetCacheBatchResult::ePut);
+
+    item.key = key;
+    item.version = version;
+    item.subkey = subkey;
+    item.data = data;
+    item.ttl = time_to_live;
+
+    return m_Impl->AddCmd(item);
+}
+
+bool CNetICacheBatch::Next(SNetCacheBatchResult& result)
+{
+    return m_Impl->Next(result);
+}
+
+CNetICacheBatch CNetICacheClient::NewBatch(const CNamedParameterList* optional)
+{
+    return new SNetICacheBatchImpl(m_Impl, optional);
+}
+
 void CNetICacheClient::Purge(time_t access_timeout, EKeepVersions keep_last_version)
 {
     Purge(kEmptyStr, kEmptyStr, access_timeout, keep_last_version);
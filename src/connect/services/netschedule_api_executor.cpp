@@ -571,10 +571,81 @@ void SNetScheduleExecutorImpl::ExecWithOrWithoutRetry(
     }
 }
 
-void CNetScheduleExecutor::PutResult(const CNetScheduleJob& job)
+class CNetScheduleCommitConnector : public INetServerExecHandler
+{
+public:
+    virtual void Exec(CNetServerConnection::TInstance conn_impl,
+            STimeout* /*timeout*/)
+    {
+        m_Conn = conn_impl;
+    }
+
+    CNetServerConnection m_Conn;
+};
+
+void SNetScheduleExecutorImpl::ExecPipelined(TPipelinedCmds& cmds)
+{
+    typedef map<SNetServerImpl*, vector<SPipelinedCmd*> > TCmdsByServer;
+    TCmdsByServer cmds_by_server;
+    vector<CNetServer> servers;
+
+    NON_CONST_ITERATE(TPipelinedCmds, it, cmds) {
+        CNetServer server(m_API->GetServer(*it->job));
+        servers.push_back(server);
+        cmds_by_server[server].push_back(&*it);
+    }
+
+    INetServerConnectionListener* conn_listener =
+            m_API->m_Service->m_Listener;
+
+    NON_CONST_ITERATE(TCmdsByServer, it, cmds_by_server) {
+        vector<SPipelinedCmd*>& server_cmds(it->second);
+        vector<SPipelinedCmd*>::iterator cmd = server_cmds.begin();
+
+        try {
+            CNetScheduleCommitConnector connector;
+
+            it->first->TryExec(connector, NULL, conn_listener);
+
+            // All commands go out in one write; the server
+            // processes them in order, one reply line each.
+            string output;
+            ITERATE(vector<SPipelinedCmd*>, c, server_cmds) {
+                if (!output.empty())
+                    output.append("\r\n");
+                output.append((*c)->cmd);
+            }
+            connector.m_Conn->WriteLine(output);
+            connector.m_Conn->m_Socket.SetCork(false);
+
+            for (; cmd != server_cmds.end(); ++cmd) {
+                try {
+                    string response;
+                    connector.m_Conn->ReadCmdOutputLine(response, false,
+                            conn_listener);
+                }
+                catch (CNetSrvConnException&) {
+                    throw;
+                }
+                catch (...) {
+                    // An error reply; the connection is still in sync.
+                    (*cmd)->error = current_exception();
+                }
+            }
+        }
+        catch (...) {
+            // The connection has been aborted; none of the
+            // remaining commands is known to have been executed.
+            exception_ptr error(current_exception());
+            for (; cmd != server_cmds.end(); ++cmd)
+                (*cmd)->error = error;
+        }
+    }
+}
+
+string SNetScheduleExecutorImpl::MkPUT2Cmd(const CNetScheduleJob& job)
 {
-    s_CheckOutputSize(job.output,
-        m_Impl->m_API->GetServerParams().max_output_size);
+    s_CheckOutputSize(job.output, m_API->GetServerParams().max_output_size);
 
     string cmd("PUT2 job_key=" + job.job_id);
 
@@ -591,7 +662,12 @@ void CNetScheduleExecutor::PutResult(const CNetScheduleJob& job)
 
     g_AppendClientIPSessionIDHitID(cmd);
 
-    m_Impl->ExecWithOrWithoutRetry(job, cmd);
+    return cmd;
+}
+
+void CNetScheduleExecutor::PutResult(const CNetScheduleJob& job)
+{
+    m_Impl->ExecWithOrWithoutRetry(job, m_Impl->MkPUT2Cmd(job));
 }
 
 void CNetScheduleExecutor::PutProgressMsg(const CNetScheduleJob& job)
@@ -614,11 +690,10 @@ void CNetScheduleExecutor::GetProgressMsg(CNetScheduleJob& job)
     m_Impl->m_API.GetProgressMsg(job);
 }
 
-void CNetScheduleExecutor::PutFailure(const CNetScheduleJob& job,
+string SNetScheduleExecutorImpl::MkFPUT2Cmd(const CNetScheduleJob& job,
         bool no_retries)
 {
-    s_CheckOutputSize(job.output,
-        m_Impl->m_API->GetServerParams().max_output_size);
+    s_CheckOutputSize(job.output, m_API->GetServerParams().max_output_size);
 
     if (job.error_msg.length() >= kNetScheduleMaxDBErrSize) {
         NCBI_THROW(CNetScheduleException, eDataTooLong,
@@ -645,10 +720,16 @@ void CNetScheduleExecutor::PutFailure(const CNetScheduleJob& job,
     if (no_retries)
         cmd.append(" no_retries=1");
 
-    m_Impl->ExecWithOrWithoutRetry(job, cmd);
+    return cmd;
+}
+
+void CNetScheduleExecutor::PutFailure(const CNetScheduleJob& job,
+        bool no_retries)
+{
+    m_Impl->ExecWithOrWithoutRetry(job, m_Impl->MkFPUT2Cmd(job, no_retries));
 }
 
-void CNetScheduleExecutor::Reschedule(const CNetScheduleJob& job)
+string SNetScheduleExecutorImpl::MkRESCHEDULECmd(const CNetScheduleJob& job)
 {
     string cmd("RESCHEDULE job_key=" + job.job_id);
 
@@ -672,7 +753,12 @@ void CNetScheduleExecutor::Reschedule(const CNetScheduleJob& job)
 
     g_AppendClientIPSessionIDHitID(cmd);
 
-    m_Impl->ExecWithOrWithoutRetry(job, cmd);
+    return cmd;
+}
+
+void CNetScheduleExecutor::Reschedule(const CNetScheduleJob& job)
+{
+    m_Impl->ExecWithOrWithoutRetry(job, m_Impl->MkRESCHEDULECmd(job));
 }
 
 CNetScheduleAPI::EJobStatus CNetScheduleExecutor::GetJobStatus(
@@ -682,7 +768,7 @@ CNetScheduleAPI::EJobStatus CNetScheduleExecutor::GetJobStatus(
     return m_Impl->m_API->GetJobStatus("WST2", job, job_exptime, pause_mode);
 }
 
-void SNetScheduleExecutorImpl::ReturnJob(const CNetScheduleJob& job,
+string SNetScheduleExecutorImpl::MkRETURN2Cmd(const CNetScheduleJob& job,
         bool blacklist)
 {
     string cmd("RETURN2 job_key=" + job.job_id);
@@ -697,7 +783,13 @@ void SNetScheduleExecutorImpl::ReturnJob(const CNetScheduleJob& job,
 
     g_AppendClientIPSessionIDHitID(cmd);
 
-    ExecWithOrWithoutRetry(job, cmd);
+    return cmd;
+}
+
+void SNetScheduleExecutorImpl::ReturnJob(const CNetScheduleJob& job,
+        bool blacklist)
+{
+    ExecWithOrWithoutRetry(job, MkRETURN2Cmd(job, blacklist));
 }
 
 void CNetScheduleExecutor::ReturnJob(const CNetScheduleJob& job)
@@ -45,6 +45,7 @@
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <exception>
 
 
 BEGIN_NCBI_SCOPE
@@ -503,6 +504,26 @@ struct SNetScheduleExecutorImpl : public CObject
     void ExecWithOrWithoutRetry(const CNetScheduleJob& job, const string& cmd);
     void ReturnJob(const CNetScheduleJob& job, bool blacklist = true);
 
+    string MkPUT2Cmd(const CNetScheduleJob& job);
+    string MkFPUT2Cmd(const CNetScheduleJob& job, bool no_retries);
+    string MkRESCHEDULECmd(const CNetScheduleJob& job);
+    string MkRETURN2Cmd(const CNetScheduleJob& job, bool blacklist);
+
+    /// A job commit command to be executed as a part of a batch.
+    struct SPipelinedCmd
+    {
+        const CNetScheduleJob* job;
+        string cmd;
+        /// Set if the command has failed or could not be sent
+        exception_ptr error;
+    };
+    typedef vector<SPipelinedCmd> TPipelinedCmds;
+
+    /// Execute commands of several jobs (one attempt each).  Commands
+    /// addressed to the same server are pipelined on one connection:
+    /// all of them are sent at once and then the replies are read.
+    void ExecPipelined(TPipelinedCmds& cmds);
+
     enum EChangeAffAction {
         eAddAffs,
         eDeleteAffs
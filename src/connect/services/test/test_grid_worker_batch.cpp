@@ -0,0 +1,203 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:  Worker node job prefetching and commit batching tests
+ *
+ */
+
+#include <ncbi_pch.hpp>
+
+#include <corelib/test_boost.hpp>
+
+#include "../grid_worker_impl.hpp"
+
+USING_NCBI_SCOPE;
+
+
+// Feeds the same measurements many times so the moving averages settle
+static void s_Measure(CJobBatchControl& control,
+        double run_time, double get_round_trip, double commit_round_trip)
+{
+    for (int i = 0; i < 100; ++i) {
+        control.OnJobDone(run_time);
+        control.OnGetJob(get_round_trip);
+        control.OnCommit(commit_round_trip);
+    }
+}
+
+// Records the jobs handed back instead of returning them to a server
+class CTestPrefetchQueue : public CJobPrefetchQueue
+{
+public:
+    vector<string> returned;
+
+protected:
+    void x_ReturnPrefetchedJob(CNetScheduleJob& job) override
+    {
+        returned.push_back(job.job_id);
+    }
+};
+
+static CNetScheduleJob s_Job(const string& job_id)
+{
+    CNetScheduleJob job;
+    job.job_id = job_id;
+    return job;
+}
+
+
+BOOST_AUTO_TEST_SUITE(GridWorkerBatch)
+
+BOOST_AUTO_TEST_CASE(FixedSizes)
+{
+    CJobBatchControl control;
+
+    control.Init(4, 10, 20, false);
+    s_Measure(control, 0.01, 1.0, 1.0);
+
+    BOOST_CHECK_EQUAL(control.GetPrefetchDepth(), 10u);
+    BOOST_CHECK_EQUAL(control.GetCommitBatchSize(), 20u);
+
+    // Prefetching is off, results are committed one by one
+    control.Init(4, 0, 0, true);
+    BOOST_CHECK_EQUAL(control.GetPrefetchDepth(), 0u);
+    BOOST_CHECK_EQUAL(control.GetCommitBatchSize(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(AdaptiveGrowAndShrink)
+{
+    CJobBatchControl control;
+
+    control.Init(4, 10, 20, true);
+
+    // One job in reserve and full commit batches until measured
+    BOOST_CHECK_EQUAL(control.GetPrefetchDepth(), 1u);
+    BOOST_CHECK_EQUAL(control.GetCommitBatchSize(), 20u);
+
+    // Jobs as long as a round trip: 4 * 0.1 / 0.1 + 0.5 and 2 * 4 + 1
+    s_Measure(control, 0.1, 0.1, 0.1);
+    BOOST_CHECK_EQUAL(control.GetPrefetchDepth(), 4u);
+    BOOST_CHECK_EQUAL(control.GetCommitBatchSize(), 9u);
+
+    // Jobs get shorter: both grow up to the configured maxima
+    unsigned prev_depth = control.GetPrefetchDepth();
+    unsigned prev_batch = control.GetCommitBatchSize();
+
+    for (int i = 0; i < 100; ++i) {
+        control.OnJobDone(0.001);
+
+        unsigned depth = control.GetPrefetchDepth();
+        unsigned batch = control.GetCommitBatchSize();
+
+        BOOST_CHECK_GE(depth, prev_depth);
+        BOOST_CHECK_GE(batch, prev_batch);
+        prev_depth = depth;
+        prev_batch = batch;
+    }
+
+    BOOST_CHECK_EQUAL(prev_depth, 10u);
+    BOOST_CHECK_EQUAL(prev_batch, 20u);
+
+    // Jobs get much longer than a round trip: nothing is kept in reserve
+    // and each result is committed at once
+    for (int i = 0; i < 200; ++i) {
+        control.OnJobDone(100.0);
+
+        unsigned depth = control.GetPrefetchDepth();
+        unsigned batch = control.GetCommitBatchSize();
+
+        BOOST_CHECK_LE(depth, prev_depth);
+        BOOST_CHECK_LE(batch, prev_batch);
+        prev_depth = depth;
+        prev_batch = batch;
+    }
+
+    BOOST_CHECK_EQUAL(prev_depth, 0u);
+    BOOST_CHECK_EQUAL(prev_batch, 1u);
+
+    // Shorter jobs and slower servers make both grow again:
+    // 4 * 0.2 / 0.125 + 0.5 and 2 * 4 * 0.2 / 0.125 + 1
+    s_Measure(control, 0.125, 0.2, 0.2);
+    BOOST_CHECK_EQUAL(control.GetPrefetchDepth(), 6u);
+    BOOST_CHECK_EQUAL(control.GetCommitBatchSize(), 13u);
+}
+
+BOOST_AUTO_TEST_CASE(PopPrefetchedJobs)
+{
+    CTestPrefetchQueue queue;
+    CNetScheduleJob job;
+
+    BOOST_CHECK(!queue.PopPrefetchedJob(job));
+
+    queue.AddPrefetchedJob(s_Job("JSID_01_1"), 60);
+    queue.AddPrefetchedJob(s_Job("JSID_01_2"), 60);
+    BOOST_CHECK_EQUAL(queue.GetPrefetchedCount(), 2u);
+
+    // Jobs are started in the order they were prefetched
+    BOOST_REQUIRE(queue.PopPrefetchedJob(job));
+    BOOST_CHECK_EQUAL(job.job_id, "JSID_01_1");
+    BOOST_REQUIRE(queue.PopPrefetchedJob(job));
+    BOOST_CHECK_EQUAL(job.job_id, "JSID_01_2");
+    BOOST_CHECK(!queue.PopPrefetchedJob(job));
+    BOOST_CHECK(queue.returned.empty());
+
+    // Expired jobs are returned and skipped
+    queue.AddPrefetchedJob(s_Job("JSID_01_3"), 0);
+    queue.AddPrefetchedJob(s_Job("JSID_01_4"), 0);
+    queue.AddPrefetchedJob(s_Job("JSID_01_5"), 60);
+
+    BOOST_REQUIRE(queue.PopPrefetchedJob(job));
+    BOOST_CHECK_EQUAL(job.job_id, "JSID_01_5");
+    BOOST_REQUIRE_EQUAL(queue.returned.size(), 2u);
+    BOOST_CHECK_EQUAL(queue.returned[0], "JSID_01_3");
+    BOOST_CHECK_EQUAL(queue.returned[1], "JSID_01_4");
+    BOOST_CHECK_EQUAL(queue.GetPrefetchedCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ReturnPrefetchedJobsOnShutdown)
+{
+    CTestPrefetchQueue queue;
+    CNetScheduleJob job;
+
+    queue.AddPrefetchedJob(s_Job("JSID_01_1"), 60);
+    queue.AddPrefetchedJob(s_Job("JSID_01_2"), 60);
+    queue.AddPrefetchedJob(s_Job("JSID_01_3"), 60);
+    BOOST_REQUIRE(queue.PopPrefetchedJob(job));
+
+    // The main loop returns what is left when it exits
+    queue.ReturnPrefetchedJobs();
+
+    BOOST_REQUIRE_EQUAL(queue.returned.size(), 2u);
+    BOOST_CHECK_EQUAL(queue.returned[0], "JSID_01_2");
+    BOOST_CHECK_EQUAL(queue.returned[1], "JSID_01_3");
+    BOOST_CHECK_EQUAL(queue.GetPrefetchedCount(), 0u);
+    BOOST_CHECK(!queue.PopPrefetchedJob(job));
+
+    // Nothing is returned twice
+    queue.ReturnPrefetchedJobs();
+    BOOST_CHECK_EQUAL(queue.returned.size(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -417,6 +417,82 @@ static void s_SimpleTest()
     api.RemoveBlob(purge_ctx.key, purge_ctx.version, purge_ctx.subkey);
 }
 
+static void s_BatchTest(bool try_all_servers)
+{
+    const string service  = TNetCache_ServiceName::GetDefault();
+    const string cache_name  = TNetCache_CacheName::GetDefault();
+
+    CNetICacheClient api(service, cache_name, s_ClientName);
+    api.SetFlags(ICache::fBestReliability);
+
+    const size_t kBlobs = 500;
+    const string key = to_string(time(NULL)) + "b" + to_string(try_all_servers);
+    vector<string> subkeys(kBlobs);
+    vector<string> sources(kBlobs);
+    SNetCacheBatchResult result;
+
+    for (size_t i = 0; i < kBlobs; ++i) {
+        subkeys[i] = "s" + to_string(i);
+        sources[i] = "Batch blob " + to_string(i) + string(i % 100, 'x');
+    }
+
+    // Creating blobs (only even ones, odd ones must not exist)
+    CNetICacheBatch store_batch(api.NewBatch(
+                nc_try_all_servers = try_all_servers));
+
+    for (size_t i = 0; i < kBlobs; i += 2)
+        store_batch.AddStore(key, int(i), subkeys[i], sources[i]);
+
+    size_t results = 0;
+
+    while (store_batch.Next(result)) {
+        BOOST_REQUIRE_MESSAGE(result.success, "Failed to store blob (" <<
+                result.index << "): " << result.error);
+        BOOST_REQUIRE(result.operation == SNetCacheBatchResult::ePut);
+        ++results;
+    }
+
+    BOOST_REQUIRE(results == kBlobs / 2);
+
+    // Checking blobs, the batch must agree with the regular API
+    CNetICacheBatch check_batch(api.NewBatch(
+                nc_try_all_servers = try_all_servers));
+
+    for (size_t i = 0; i < kBlobs; ++i) {
+        check_batch.AddRead(key, int(i), subkeys[i]);
+        check_batch.AddHasBlob(key, subkeys[i]);
+    }
+
+    results = 0;
+
+    while (check_batch.Next(result)) {
+        size_t i = result.index / 2;
+        bool expected = i % 2 == 0;
+
+        BOOST_REQUIRE_MESSAGE(result.success, "Batch operation failed (" <<
+                result.index << "): " << result.error);
+        BOOST_REQUIRE_MESSAGE(result.exists == expected,
+                "Unexpected blob existence (" << i << ")");
+
+        if (result.index % 2 == 0) {
+            BOOST_REQUIRE(result.operation == SNetCacheBatchResult::eGet);
+            BOOST_REQUIRE_MESSAGE(!expected || result.data == sources[i],
+                    "Blob content does not match the source (" << i << ")");
+        } else {
+            BOOST_REQUIRE(result.operation == SNetCacheBatchResult::eHasBlob);
+            BOOST_REQUIRE_MESSAGE(
+                    result.exists == api.HasBlob(key, subkeys[i]),
+                    "Batch and HasBlob() disagree (" << i << ")");
+        }
+
+        ++results;
+    }
+
+    BOOST_REQUIRE(results == kBlobs * 2);
+
+    api.Purge(key, kEmptyStr, 0);
+}
+
 BOOST_AUTO_TEST_SUITE(NetICacheClient)
 
 NCBITEST_AUTO_INIT()
@@ -441,4 +517,15 @@ BOOST_AUTO_TEST_CASE(SimpleTest)
     s_SimpleTest();
 }
 
+BOOST_AUTO_TEST_CASE(BatchTest)
+{
+    s_BatchTest(false);
+}
+
+BOOST_AUTO_TEST_CASE(BatchTestDirect)
+{
+    // Every operation goes through the regular (not pipelined) API
+    s_BatchTest(true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -868,6 +868,84 @@ static void s_SimpleTest(const CNamedParameterList* nc_params)
     }
 }
 
+static void s_BatchTest(const CNamedParameterList* nc_params)
+{
+    CNetCacheAPI api(TNetCache_ServiceName::GetDefault(), s_ClientName);
+    api.SetDefaultParameters(nc_params);
+
+    const size_t kBlobs = 1000;
+    vector<string> sources(kBlobs);
+    vector<string> keys(kBlobs);
+    SNetCacheBatchResult result;
+
+    for (size_t i = 0; i < kBlobs; ++i)
+        sources[i] = "Batch blob " + NStr::NumericToString(i) +
+                string(i % 100, 'x');
+
+    // Creating blobs
+    CNetCacheBatch put_batch(api.NewBatch());
+
+    for (size_t i = 0; i < kBlobs; ++i)
+        BOOST_REQUIRE(put_batch.AddPut(kEmptyStr, sources[i]) == i);
+
+    size_t results = 0;
+
+    while (put_batch.Next(result)) {
+        BOOST_REQUIRE_MESSAGE(result.success, "Failed to write blob (" <<
+                result.index << "): " << result.error);
+        BOOST_REQUIRE(result.operation == SNetCacheBatchResult::ePut);
+        BOOST_REQUIRE(keys[result.index].empty());
+        keys[result.index] = result.key;
+        ++results;
+    }
+
+    BOOST_REQUIRE(results == kBlobs);
+
+    // Checking blobs
+    CNetCacheBatch get_batch(api.NewBatch());
+
+    for (size_t i = 0; i < kBlobs; ++i) {
+        get_batch.AddGet(keys[i]);
+        get_batch.AddHasBlob(keys[i]);
+    }
+
+    results = 0;
+
+    while (get_batch.Next(result)) {
+        size_t i = result.index / 2;
+
+        BOOST_REQUIRE_MESSAGE(result.success, "Batch operation failed (" <<
+                result.index << "): " << result.error);
+        BOOST_REQUIRE_MESSAGE(result.exists,
+                "Blob does not exist (" << i << ")");
+        BOOST_REQUIRE(result.key == keys[i]);
+
+        if (result.index % 2 == 0) {
+            BOOST_REQUIRE(result.operation == SNetCacheBatchResult::eGet);
+            BOOST_REQUIRE_MESSAGE(result.data == sources[i],
+                    "Blob content does not match the source (" << i << ")");
+        } else
+            BOOST_REQUIRE(result.operation == SNetCacheBatchResult::eHasBlob);
+
+        ++results;
+    }
+
+    BOOST_REQUIRE(results == kBlobs * 2);
+
+    // Checking removed blob
+    api.Remove(keys[0]);
+
+    CNetCacheBatch removed_batch(api.NewBatch());
+    removed_batch.AddGet(keys[0]);
+
+    BOOST_REQUIRE(removed_batch.Next(result));
+    BOOST_REQUIRE(result.success && !result.exists);
+    BOOST_REQUIRE(!removed_batch.Next(result));
+
+    for (size_t i = 1; i < kBlobs; ++i)
+        api.Remove(keys[i]);
+}
+
 #define OUTPUT_CTX(ctx) ctx << '[' << __LINE__ << "]: "
 
 #define BOOST_ERROR_CTX(message, ctx) \
@@ -1028,6 +1106,11 @@ BOOST_AUTO_TEST_CASE(SimpleTestMirroring)
     s_SimpleTest(nc_mirroring_mode = CNetCacheAPI::eMirroringEnabled);
 }
 
+BOOST_AUTO_TEST_CASE(BatchTest)
+{
+    s_BatchTest(nc_mirroring_mode = CNetCacheAPI::eMirroringDisabled);
+}
+
 BOOST_AUTO_TEST_CASE(AllowedServices)
 {
     s_AllowedServicesTest();
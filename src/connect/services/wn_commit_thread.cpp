@@ -136,87 +136,149 @@ void* CJobCommitterThread::Main()
         }
 
         while (!m_ImmediateActions.empty()) {
-            TEntry& entry = m_ImmediateActions.front();
+            size_t batch_size =
+                    m_WorkerNode->m_JobBatchControl.GetCommitBatchSize();
 
-            // Do not remove the job context from m_ImmediateActions
-            // prior to calling x_CommitJob() to avoid race conditions
+            if (batch_size > m_ImmediateActions.size())
+                batch_size = m_ImmediateActions.size();
+
+            // Do not remove the job contexts from m_ImmediateActions
+            // prior to calling x_CommitJobs() to avoid race conditions
             // (otherwise, the semaphore can be Post()'ed multiple times
-            // by the worker threads while this thread is in x_CommitJob()).
-            if (x_CommitJob(entry)) {
-                m_JobContextPool.push_back(entry);
-            } else {
-                m_Timeline.push_back(entry);
-            }
+            // by the worker threads while this thread is in x_CommitJobs()).
+            TCommitJobTimeline batch(m_ImmediateActions.begin(),
+                    m_ImmediateActions.begin() + batch_size);
+            vector<bool> recycle;
+
+            x_CommitJobs(batch, recycle);
 
-            m_ImmediateActions.pop_front();
+            for (size_t i = 0; i < batch_size; ++i) {
+                if (recycle[i]) {
+                    m_JobContextPool.push_back(batch[i]);
+                } else {
+                    m_Timeline.push_back(batch[i]);
+                }
+
+                m_ImmediateActions.pop_front();
+            }
         }
     } while (!CGridGlobals::GetInstance().IsShuttingDown());
 
     return NULL;
 }
 
-bool CJobCommitterThread::x_CommitJob(SWorkerNodeJobContextImpl* job_context)
+string CJobCommitterThread::x_GetCommitCmd(
+        SWorkerNodeJobContextImpl* job_context)
 {
-    TFastMutexUnlockGuard mutext_unlock(m_TimelineMutex);
+    SNetScheduleExecutorImpl* executor = m_WorkerNode->m_NSExecutor;
+    const CNetScheduleJob& job = job_context->m_Job;
 
-    CRequestContextSwitcher request_state_guard(job_context->m_RequestContext);
+    switch (job_context->m_JobCommitStatus) {
+    case CWorkerNodeJobContext::eCS_Done:
+        return executor->MkPUT2Cmd(job);
 
-    bool recycle_job_context = false;
-    m_WorkerNode->m_JobsInProgress.Update(job_context->m_Job);
+    case CWorkerNodeJobContext::eCS_Failure:
+        return executor->MkFPUT2Cmd(job, job_context->m_DisableRetries);
 
-    try {
-        switch (job_context->m_JobCommitStatus) {
-        case CWorkerNodeJobContext::eCS_Done:
-            m_WorkerNode->m_NSExecutor.PutResult(job_context->m_Job);
-            break;
+    default: /* eCS_NotCommitted */
+        // In the unlikely event of eCS_NotCommitted, return the job.
+        /* FALL THROUGH */
 
-        case CWorkerNodeJobContext::eCS_Failure:
-            m_WorkerNode->m_NSExecutor.PutFailure(job_context->m_Job,
-                    job_context->m_DisableRetries);
-            break;
+    case CWorkerNodeJobContext::eCS_Return:
+        return executor->MkRETURN2Cmd(job, true);
 
-        default: /* eCS_NotCommitted */
-            // In the unlikely event of eCS_NotCommitted, return the job.
-            /* FALL THROUGH */
+    case CWorkerNodeJobContext::eCS_Reschedule:
+        return executor->MkRESCHEDULECmd(job);
 
-        case CWorkerNodeJobContext::eCS_Return:
-            m_WorkerNode->m_NSExecutor.ReturnJob(job_context->m_Job);
-            break;
+    case CWorkerNodeJobContext::eCS_JobIsLost:
+        // Job is cancelled or otherwise taken away from the worker
+        // node. Whatever the cause is, it has been reported already.
+        return kEmptyStr;
+    }
+}
 
-        case CWorkerNodeJobContext::eCS_Reschedule:
-            m_WorkerNode->m_NSExecutor.Reschedule(job_context->m_Job);
-            break;
+void CJobCommitterThread::x_CommitJobs(const TCommitJobTimeline& batch,
+        vector<bool>& recycle)
+{
+    TFastMutexUnlockGuard mutext_unlock(m_TimelineMutex);
+
+    SNetScheduleExecutorImpl::TPipelinedCmds cmds;
+    vector<size_t> cmd_owners;
+    vector<exception_ptr> errors(batch.size());
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        SWorkerNodeJobContextImpl* job_context = batch[i].GetNCPointer();
+        CRequestContextSwitcher request_state_guard(
+                job_context->m_RequestContext);
 
-        case CWorkerNodeJobContext::eCS_JobIsLost:
-            // Job is cancelled or otherwise taken away from the worker
-            // node. Whatever the cause is, it has been reported already.
-            break;
+        m_WorkerNode->m_JobsInProgress.Update(job_context->m_Job);
+
+        SNetScheduleExecutorImpl::SPipelinedCmd cmd;
+
+        try {
+            cmd.cmd = x_GetCommitCmd(job_context);
+        }
+        catch (...) {
+            errors[i] = current_exception();
+            continue;
         }
 
-        recycle_job_context = true;
+        if (!cmd.cmd.empty()) {
+            cmd.job = &job_context->m_Job;
+            cmds.push_back(cmd);
+            cmd_owners.push_back(i);
+        }
     }
-    catch (CNetScheduleException& e) {
-        ERR_POST_X(65, "Could not commit " <<
-                job_context->m_Job.job_id << ": " << e.what());
-        recycle_job_context = true;
+
+    if (!cmds.empty()) {
+        CStopWatch round_trip(CStopWatch::eStart);
+        m_WorkerNode->m_NSExecutor->ExecPipelined(cmds);
+        m_WorkerNode->m_JobBatchControl.OnCommit(round_trip.Elapsed());
+
+        for (size_t i = 0; i < cmds.size(); ++i)
+            errors[cmd_owners[i]] = cmds[i].error;
     }
-    catch (exception& e) {
-        unsigned commit_interval = m_WorkerNode->m_CommitJobInterval;
-        job_context->ResetTimeout(commit_interval);
-        if (job_context->m_FirstCommitAttempt) {
-            job_context->m_FirstCommitAttempt = false;
-            job_context->m_CommitExpiration =
-                    CDeadline(m_WorkerNode->m_QueueTimeout, 0);
-        } else if (job_context->m_CommitExpiration <
-                job_context->GetTimeout()) {
-            ERR_POST_X(64, "Could not commit " <<
+
+    recycle.resize(batch.size());
+
+    for (size_t i = 0; i < batch.size(); ++i)
+        recycle[i] = x_OnJobCommitted(batch[i].GetNCPointer(), errors[i]);
+}
+
+bool CJobCommitterThread::x_OnJobCommitted(
+        SWorkerNodeJobContextImpl* job_context, exception_ptr error)
+{
+    CRequestContextSwitcher request_state_guard(job_context->m_RequestContext);
+
+    bool recycle_job_context = true;
+
+    if (error) {
+        try {
+            rethrow_exception(error);
+        }
+        catch (CNetScheduleException& e) {
+            ERR_POST_X(65, "Could not commit " <<
                     job_context->m_Job.job_id << ": " << e.what());
-            recycle_job_context = true;
         }
-        if (!recycle_job_context) {
-            ERR_POST_X(63, "Error while committing " <<
-                    job_context->m_Job.job_id << ": " << e.what() <<
-                    "; will retry in " << commit_interval << " seconds.");
+        catch (exception& e) {
+            recycle_job_context = false;
+            unsigned commit_interval = m_WorkerNode->m_CommitJobInterval;
+            job_context->ResetTimeout(commit_interval);
+            if (job_context->m_FirstCommitAttempt) {
+                job_context->m_FirstCommitAttempt = false;
+                job_context->m_CommitExpiration =
+                        CDeadline(m_WorkerNode->m_QueueTimeout, 0);
+            } else if (job_context->m_CommitExpiration <
+                    job_context->GetTimeout()) {
+                ERR_POST_X(64, "Could not commit " <<
+                        job_context->m_Job.job_id << ": " << e.what());
+                recycle_job_context = true;
+            }
+            if (!recycle_job_context) {
+                ERR_POST_X(63, "Error while committing " <<
+                        job_context->m_Job.job_id << ": " << e.what() <<
+                        "; will retry in " << commit_interval << " seconds.");
+            }
         }
     }
 
@@ -36,6 +36,7 @@
 #include <connect/services/grid_worker.hpp>
 
 #include <deque>
+#include <exception>
 
 BEGIN_NCBI_SCOPE
 
@@ -92,7 +93,10 @@ private:
     virtual void* Main();
 
     bool WaitForTimeout();
-    bool x_CommitJob(SWorkerNodeJobContextImpl* job_context);
+    string x_GetCommitCmd(SWorkerNodeJobContextImpl* job_context);
+    void x_CommitJobs(const TCommitJobTimeline& batch, vector<bool>& recycle);
+    bool x_OnJobCommitted(SWorkerNodeJobContextImpl* job_context,
+            exception_ptr error);
 
     void WakeUp()
     {
@@ -405,6 +405,7 @@ void SWorkerNodeJobContextImpl::x_PrintRequestStop()
 void SWorkerNodeJobContextImpl::x_RunJob()
 {
     CWorkerNodeJobContext this_job_context(this);
+    CStopWatch run_time(CStopWatch::eStart);
 
     m_RequestContext->SetRequestID((int) this_job_context.GetJobNumber());
 
@@ -546,6 +547,8 @@ void SWorkerNodeJobContextImpl::x_RunJob()
     if (!CGridGlobals::GetInstance().IsShuttingDown())
         m_CleanupEventSource->CallEventHandlers();
 
+    m_WorkerNode->m_JobBatchControl.OnJobDone(run_time.Elapsed());
+
     m_WorkerNode->m_JobCommitterThread->RecycleJobContextAndCommitJob(this,
             request_state_guard);
 }
@@ -563,6 +566,10 @@ void* CMainLoopThread::Main()
     unsigned try_count = 0;
     while (!CGridGlobals::GetInstance().IsShuttingDown()) {
         try {
+            // While all threads are busy, get jobs for them in advance
+            if (!m_WorkerNode->m_ThreadPool->HasImmediateRoom())
+                x_PrefetchJobs();
+
             try {
                 m_WorkerNode->m_ThreadPool->WaitForRoom(
                         m_WorkerNode->m_ThreadPoolTimeout);
@@ -624,6 +631,8 @@ void* CMainLoopThread::Main()
         try_count = 0;
     }
 
+    m_Impl.ReturnPrefetchedJobs();
+
     return NULL;
 }
 
@@ -645,6 +654,7 @@ CNetScheduleGetJob::EState CMainLoopThread::CImpl::CheckState()
                     // Stop the timeline.
                     m_WorkerNode->m_TimelineIsSuspended = true;
                     ret = eRestarted;
+                    ReturnPrefetchedJobs();
                 }
             } else { /* event == RESUME_EVENT */
                 if (m_WorkerNode->m_TimelineIsSuspended) {
@@ -707,8 +717,11 @@ bool CMainLoopThread::CImpl::CheckEntry(
         CNetScheduleAPI::EJobStatus* /*job_status*/)
 {
     CNetServer server(m_API.GetService()->GetServer(entry.server_address));
-    return m_WorkerNode->m_NSExecutor->x_GetJobWithAffinityLadder(server,
-            m_Timeout, prio_aff_list, any_affinity, job);
+    CStopWatch round_trip(CStopWatch::eStart);
+    bool got_job = m_WorkerNode->m_NSExecutor->x_GetJobWithAffinityLadder(
+            server, m_Timeout, prio_aff_list, any_affinity, job);
+    m_WorkerNode->m_JobBatchControl.OnGetJob(round_trip.Elapsed());
+    return got_job;
 }
 
 void CMainLoopThread::CImpl::ReturnJob(CNetScheduleJob& job)
@@ -716,9 +729,55 @@ void CMainLoopThread::CImpl::ReturnJob(CNetScheduleJob& job)
     m_WorkerNode->m_NSExecutor->ReturnJob(job, false);
 }
 
+void CJobPrefetchQueue::AddPrefetchedJob(const CNetScheduleJob& job,
+        unsigned timeout)
+{
+    m_PrefetchedJobs.push_back(SPrefetchedJob(job, timeout));
+}
+
+bool CJobPrefetchQueue::PopPrefetchedJob(CNetScheduleJob& job)
+{
+    while (!m_PrefetchedJobs.empty()) {
+        SPrefetchedJob prefetched(m_PrefetchedJobs.front());
+        m_PrefetchedJobs.pop_front();
+
+        if (!prefetched.deadline.IsExpired()) {
+            job = prefetched.job;
+            return true;
+        }
+
+        LOG_POST(Warning << "Prefetched job " << prefetched.job.job_id <<
+                " has not been started in time and will be returned.");
+        x_ReturnPrefetchedJob(prefetched.job);
+    }
+
+    return false;
+}
+
+void CJobPrefetchQueue::ReturnPrefetchedJobs()
+{
+    while (!m_PrefetchedJobs.empty()) {
+        x_ReturnPrefetchedJob(m_PrefetchedJobs.front().job);
+        m_PrefetchedJobs.pop_front();
+    }
+}
+
+void CMainLoopThread::CImpl::x_ReturnPrefetchedJob(CNetScheduleJob& job)
+{
+    try {
+        ReturnJob(job);
+    }
+    catch (exception& ex) {
+        ERR_POST_X(67, "Could not return prefetched job " <<
+                job.job_id << ": " << ex.what());
+    }
+    m_WorkerNode->m_JobsInProgress.Remove(job);
+}
+
 bool CMainLoopThread::x_GetNextJob(CNetScheduleJob& job)
 {
     if (!m_WorkerNode->x_AreMastersBusy()) {
+        m_Impl.ReturnPrefetchedJobs();
         SleepSec(m_WorkerNode->m_NSTimeout);
         return false;
     }
@@ -726,15 +785,18 @@ bool CMainLoopThread::x_GetNextJob(CNetScheduleJob& job)
     if (!m_WorkerNode->WaitForExclusiveJobToFinish())
         return false;
 
-    if (m_Timeline.GetJob(CTimeout::eInfinite, job, NULL) != CNetScheduleGetJob::eJob) {
-        return false;
-    }
+    if (!m_Impl.PopPrefetchedJob(job)) {
+        if (m_Timeline.GetJob(CTimeout::eInfinite, job, NULL) !=
+                CNetScheduleGetJob::eJob) {
+            return false;
+        }
 
-    // Already executing this job, so do nothing
-    // (and rely on that execution to report its result later)
-    if (!m_WorkerNode->m_JobsInProgress.Add(job)) {
-        LOG_POST(Warning << "Got already processing job " << job.job_id);
-        return false;
+        // Already executing this job, so do nothing
+        // (and rely on that execution to report its result later)
+        if (!m_WorkerNode->m_JobsInProgress.Add(job)) {
+            LOG_POST(Warning << "Got already processing job " << job.job_id);
+            return false;
+        }
     }
 
     if (job.mask & CNetScheduleAPI::eExclusiveJob) {
@@ -753,6 +815,29 @@ bool CMainLoopThread::x_GetNextJob(CNetScheduleJob& job)
     return true;
 }
 
+void CMainLoopThread::x_PrefetchJobs()
+{
+    unsigned depth = m_WorkerNode->m_JobBatchControl.GetPrefetchDepth();
+
+    if (m_Impl.GetPrefetchedCount() >= depth ||
+            m_WorkerNode->IsExclusiveMode() ||
+            !m_WorkerNode->x_AreMastersBusy())
+        return;
+
+    CNetScheduleJob job;
+
+    // Only ask the servers that are known to have jobs, do not wait
+    while (m_Impl.GetPrefetchedCount() < depth &&
+            m_Timeline.GetJob(CDeadline(0, 0), job, NULL) ==
+                    CNetScheduleGetJob::eJob) {
+        if (!m_WorkerNode->m_JobsInProgress.Add(job))
+            LOG_POST(Warning << "Got already processing job " << job.job_id);
+        else
+            m_Impl.AddPrefetchedJob(job, m_WorkerNode->m_JobPrefetchTimeout);
+        job.Reset();
+    }
+}
+
 size_t CGridWorkerNode::GetServerOutputSize()
 {
     return m_Impl->m_QueueEmbeddedOutputSize;
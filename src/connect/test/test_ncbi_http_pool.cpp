@@ -0,0 +1,487 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Test CHttpConnectionPool against a local scripted HTTP/1.1 server:
+ *   keep-alive reuse, streamed and chunked bodies, retries of failed and
+ *   stale connections, malformed responses and pipelined ExecuteAll().
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbithr.hpp>
+#include <connect/ncbi_core_cxx.hpp>
+#include <connect/ncbi_http_session.hpp>
+#include <connect/ncbi_socket.hpp>
+
+#include "test_assert.h"  // This header must go last
+
+
+USING_NCBI_SCOPE;
+
+
+static const STimeout kServerTimeout = { 5, 0 };
+
+
+/////////////////////////////////
+// Scripted server
+//
+
+// Requests received per path
+static CFastMutex         s_HitsMutex;
+static map<string, int>   s_Hits;
+
+
+static int s_CountHit(const string& path)
+{
+    CFastMutexGuard guard(s_HitsMutex);
+    return ++s_Hits[path];
+}
+
+
+static int s_GetHits(const string& path)
+{
+    CFastMutexGuard guard(s_HitsMutex);
+    return s_Hits[path];
+}
+
+
+static bool s_Write(CSocket& sock, const string& data)
+{
+    return sock.Write(data.data(), data.size(), 0, eIO_WritePersist)
+        == eIO_Success;
+}
+
+
+// Serves requests of one connection until the script closes it.
+class CConnectionThread : public CThread
+{
+public:
+    CConnectionThread(CSocket* sock) : m_Socket(sock) {}
+
+protected:
+    virtual void* Main(void);
+
+private:
+    // Answer one request, return false to close the connection.
+    bool x_Reply(const string& path);
+
+    unique_ptr<CSocket> m_Socket;
+};
+
+
+void* CConnectionThread::Main(void)
+{
+    CSocket& sock = *m_Socket;
+    sock.SetTimeout(eIO_ReadWrite, &kServerTimeout);
+    for (;;) {
+        string line, request_line;
+        size_t length = 0;
+        do {
+            if (sock.ReadLine(line) != eIO_Success) {
+                return 0;
+            }
+            if ( request_line.empty() ) {
+                request_line = line;
+            }
+            else if (NStr::StartsWith(line, "Content-Length:",
+                                      NStr::eNocase)) {
+                length = NStr::StringToNumeric<size_t>(
+                    NStr::TruncateSpaces(line.substr(15)));
+            }
+        } while ( !line.empty() );
+        if ( length ) {
+            string body(length, '\0');
+            if (sock.Read(&body[0], length, 0, eIO_ReadPersist)
+                != eIO_Success) {
+                return 0;
+            }
+        }
+        vector<string> words;
+        NStr::Split(request_line, " ", words);
+        _ASSERT(words.size() == 3);
+        if ( !x_Reply(words[1]) ) {
+            return 0;
+        }
+    }
+}
+
+
+bool CConnectionThread::x_Reply(const string& path)
+{
+    static const char kHello[] =
+        "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+
+    CSocket& sock = *m_Socket;
+    int hits = s_CountHit(path);
+    if (path == "/hello") {
+        return s_Write(sock, kHello);
+    }
+    if (path == "/chunked") {
+        return s_Write(sock, "HTTP/1.1 200 OK\r\n"
+                       "Transfer-Encoding: chunked\r\n\r\n"
+                       "5;name=value\r\nhello\r\n"
+                       "6\r\n world\r\n"
+                       "0\r\nX-Trailer: yes\r\n\r\n");
+    }
+    if (path == "/big") {
+        if ( !s_Write(sock, "HTTP/1.1 200 OK\r\n"
+                      "Content-Length: 1048576\r\n\r\n") ) {
+            return false;
+        }
+        string block(4096, 'x');
+        for (int i = 0;  i < 256;  ++i) {
+            if ( !s_Write(sock, block) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (path == "/redirect") {
+        return s_Write(sock, "HTTP/1.1 302 Found\r\nLocation: /hello\r\n"
+                       "Content-Length: 5\r\n\r\nmoved");
+    }
+    if (path == "/close") {
+        // The body ends with the connection.
+        s_Write(sock, "HTTP/1.1 200 OK\r\nConnection: close\r\n\r\nbye");
+        return false;
+    }
+    if (path == "/stale") {
+        // Answered as kept alive, but closed at once.
+        s_Write(sock, kHello);
+        return false;
+    }
+    if (path == "/flaky") {
+        return hits > 1  &&  s_Write(sock, kHello);
+    }
+    if (path == "/garbage") {
+        s_Write(sock, "NOT HTTP AT ALL\r\n\r\n");
+        return false;
+    }
+    if (path == "/badlength") {
+        s_Write(sock, "HTTP/1.1 200 OK\r\nContent-Length: 5x\r\n\r\nhello");
+        return false;
+    }
+    if (path == "/hugelength") {
+        s_Write(sock, "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 18446744073709551000\r\n\r\nhello");
+        return false;
+    }
+    // "/drop" and anything else: close without a reply
+    return false;
+}
+
+
+class CServerThread : public CThread
+{
+public:
+    CServerThread(void) : m_Stop(false)
+    {
+        _VERIFY(m_Listener.Listen(0) == eIO_Success);
+    }
+
+    unsigned short GetPort(void) const
+    {
+        return m_Listener.GetPort(eNH_HostByteOrder);
+    }
+
+    void Stop(void) { m_Stop = true; }
+
+protected:
+    virtual void* Main(void)
+    {
+        static const STimeout kAcceptTimeout = { 0, 100000 };
+        while ( !m_Stop ) {
+            CSocket* sock;
+            if (m_Listener.Accept(sock, &kAcceptTimeout) == eIO_Success) {
+                (new CConnectionThread(sock))->Run(fRunDetached);
+            }
+        }
+        return 0;
+    }
+
+private:
+    CListeningSocket m_Listener;
+    volatile bool    m_Stop;
+};
+
+
+/////////////////////////////////
+// Test application
+//
+
+class CTest : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+
+private:
+    CRef<CHttpSession> x_NewSession(void);
+    CHttpRequest x_NewRequest(const string& path, int retries = 0);
+    string x_Read(const CHttpResponse& response);
+
+    void x_TestKeepAlive(void);
+    void x_TestStreaming(void);
+    void x_TestBodies(void);
+    void x_TestRetries(void);
+    void x_TestMalformed(void);
+    void x_TestPipelining(void);
+
+    string                    m_Url;
+    CRef<CHttpConnectionPool> m_Pool;
+    CRef<CHttpSession>        m_Session;
+};
+
+
+void CTest::Init(void)
+{
+    // Init the library explicitly (this sets up the log)
+    {
+        class CInPlaceConnIniter : protected CConnIniter
+        {
+        } conn_initer;  /*NCBI_FAKE_WARNING*/
+    }
+
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Test CHttpConnectionPool");
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+CRef<CHttpSession> CTest::x_NewSession(void)
+{
+    m_Pool.Reset(new CHttpConnectionPool);
+    m_Session.Reset(new CHttpSession);
+    m_Session->SetConnectionPool(m_Pool);
+    return m_Session;
+}
+
+
+CHttpRequest CTest::x_NewRequest(const string& path, int retries)
+{
+    CHttpRequest req = m_Session->NewRequest(CUrl(m_Url + path));
+    req.SetTimeout(5);
+    req.SetRetries(retries);
+    return req;
+}
+
+
+string CTest::x_Read(const CHttpResponse& response)
+{
+    string data;
+    NcbiStreamToString(&data, response.ContentStream());
+    return data;
+}
+
+
+// Consecutive requests go over one connection.
+void CTest::x_TestKeepAlive(void)
+{
+    x_NewSession();
+    for (int i = 0;  i < 3;  ++i) {
+        CHttpResponse response = x_NewRequest("/hello").Execute();
+        _ASSERT(response.GetStatusCode() == 200);
+        _ASSERT(x_Read(response) == "hello");
+    }
+    CHttpConnectionPool::SStats stats = m_Pool->GetStats();
+    _ASSERT(stats.opened == 1);
+    _ASSERT(stats.reused == 2);
+    _ASSERT(stats.in_use == 0);
+    _ASSERT(stats.idle == 1);
+}
+
+
+// The body is read from the connection as the response stream is read.
+void CTest::x_TestStreaming(void)
+{
+    x_NewSession();
+    {{
+        CHttpResponse response = x_NewRequest("/big").Execute();
+        _ASSERT(response.GetStatusCode() == 200);
+        _ASSERT(m_Pool->GetStats().in_use == 1);
+        _ASSERT(x_Read(response).size() == 1048576);
+        // Released at the end of the body, before the response is gone
+        _ASSERT(m_Pool->GetStats().in_use == 0);
+        _ASSERT(m_Pool->GetStats().idle == 1);
+    }}
+    _ASSERT(x_Read(x_NewRequest("/hello").Execute()) == "hello");
+    _ASSERT(m_Pool->GetStats().opened == 1);
+
+    // A body not read to the end makes the connection unusable.
+    {{
+        CHttpResponse response = x_NewRequest("/big").Execute();
+        char buf[100];
+        response.ContentStream().read(buf, sizeof(buf));
+    }}
+    CHttpConnectionPool::SStats stats = m_Pool->GetStats();
+    _ASSERT(stats.in_use == 0);
+    _ASSERT(stats.idle == 0);
+    _ASSERT(stats.closed == 1);
+}
+
+
+void CTest::x_TestBodies(void)
+{
+    x_NewSession();
+
+    // Chunk extensions and trailer
+    _ASSERT(x_Read(x_NewRequest("/chunked").Execute()) == "hello world");
+    _ASSERT(m_Pool->GetStats().idle == 1);
+
+    // The redirect body is skipped and the connection reused.
+    CHttpResponse response = x_NewRequest("/redirect").Execute();
+    _ASSERT(response.GetStatusCode() == 200);
+    _ASSERT(x_Read(response) == "hello");
+    _ASSERT(m_Pool->GetStats().opened == 1);
+
+    // The body ends with the connection.
+    _ASSERT(x_Read(x_NewRequest("/close").Execute()) == "bye");
+    _ASSERT(m_Pool->GetStats().idle == 0);
+}
+
+
+void CTest::x_TestRetries(void)
+{
+    x_NewSession();
+
+    // The first connection is dropped.
+    CHttpResponse response = x_NewRequest("/flaky", 2).Execute();
+    _ASSERT(response.GetStatusCode() == 200);
+    _ASSERT(x_Read(response) == "hello");
+    _ASSERT(s_GetHits("/flaky") == 2);
+
+    // Every attempt fails (no connection is reused).
+    x_NewSession();
+    _ASSERT(x_NewRequest("/drop", 2).Execute().GetStatusCode() == 0);
+    _ASSERT(s_GetHits("/drop") == 3);
+
+    vector<CHttpRequest> requests;
+    requests.push_back(x_NewRequest("/drop", 2));
+    CHttpSession::TResponses responses = m_Session->ExecuteAll(requests);
+    _ASSERT(responses[0].GetStatusCode() == 0);
+    _ASSERT(s_GetHits("/drop") == 6);
+
+    // A kept-alive connection closed by the server is replaced once even
+    // when no retries are allowed.
+    x_NewSession();
+    _ASSERT(x_Read(x_NewRequest("/stale").Execute()) == "hello");
+    response = x_NewRequest("/hello").Execute();
+    _ASSERT(response.GetStatusCode() == 200);
+    _ASSERT(x_Read(response) == "hello");
+    _ASSERT(m_Pool->GetStats().opened == 2);
+
+    // Failures of a reused connection count toward the attempts.
+    x_NewSession();
+    m_Pool->SetMaxIdlePerHost(1);
+    requests.clear();
+    requests.push_back(x_NewRequest("/hello", 2));
+    requests.push_back(x_NewRequest("/drop", 2));
+    int drops = s_GetHits("/drop");
+    responses = m_Session->ExecuteAll(requests);
+    _ASSERT(responses[0].GetStatusCode() == 200);
+    _ASSERT(x_Read(responses[0]) == "hello");
+    _ASSERT(responses[1].GetStatusCode() == 0);
+    _ASSERT(s_GetHits("/drop") - drops <= 4);
+}
+
+
+void CTest::x_TestMalformed(void)
+{
+    x_NewSession();
+
+    _ASSERT(x_NewRequest("/garbage").Execute().GetStatusCode() == 0);
+    _ASSERT(x_NewRequest("/badlength").Execute().GetStatusCode() == 0);
+
+    // The announced length is not allocated, the body fails when cut short.
+    CHttpResponse response = x_NewRequest("/hugelength").Execute();
+    _ASSERT(response.GetStatusCode() == 200);
+    CConn_IOStream& stream =
+        dynamic_cast<CConn_IOStream&>(response.ContentStream());
+    _ASSERT(x_Read(response) == "hello");
+    _ASSERT(stream.Status(eIO_Read) != eIO_Closed);
+    _ASSERT(m_Pool->GetStats().in_use == 0);
+
+    vector<CHttpRequest> requests;
+    requests.push_back(x_NewRequest("/hugelength"));
+    requests.push_back(x_NewRequest("/garbage"));
+    CHttpSession::TResponses responses = m_Session->ExecuteAll(requests);
+    _ASSERT(responses[0].GetStatusCode() == 0);
+    _ASSERT(responses[1].GetStatusCode() == 0);
+    _ASSERT(m_Pool->GetStats().idle == 0);
+}
+
+
+// Pipelined responses come back in the order of the requests.
+void CTest::x_TestPipelining(void)
+{
+    x_NewSession();
+    m_Pool->SetMaxPipelineDepth(4);
+    vector<CHttpRequest> requests;
+    for (int i = 0;  i < 4;  ++i) {
+        requests.push_back(x_NewRequest(i % 2 ? "/chunked" : "/hello"));
+    }
+    CHttpSession::TResponses responses = m_Session->ExecuteAll(requests);
+    _ASSERT(responses.size() == 4);
+    for (int i = 0;  i < 4;  ++i) {
+        _ASSERT(responses[i].GetStatusCode() == 200);
+        _ASSERT(x_Read(responses[i]) == (i % 2 ? "hello world" : "hello"));
+    }
+    CHttpConnectionPool::SStats stats = m_Pool->GetStats();
+    _ASSERT(stats.opened == 1);
+    _ASSERT(stats.pipelined == 3);
+    _ASSERT(stats.idle == 1);
+}
+
+
+int CTest::Run(void)
+{
+    CRef<CServerThread> server(new CServerThread);
+    server->Run();
+    m_Url = "http://127.0.0.1:" + NStr::NumericToString(server->GetPort());
+
+    x_TestKeepAlive();
+    x_TestStreaming();
+    x_TestBodies();
+    x_TestRetries();
+    x_TestMalformed();
+    x_TestPipelining();
+
+    m_Session.Reset();
+    m_Pool.Reset();
+    server->Stop();
+    server->Join();
+    NcbiCout << "All tests passed" << NcbiEndl;
+    return 0;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTest().AppMain(argc, argv);
+}
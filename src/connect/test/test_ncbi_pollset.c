@@ -0,0 +1,477 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Test suite for the poll set API (POLLSET_*() in "ncbi_socket.h"):
+ *   registration, readiness of triggers, listening and connected sockets
+ *   (including data buffered inside a SOCK), handles kept in the set but
+ *   not waited for, one-shot timers, events which do not fit into the
+ *   caller's array, and service connections to a stateful server (mapped
+ *   locally), all over the loopback interface.
+ *
+ */
+
+#include <connect/ncbi_connection.h>
+#include <connect/ncbi_service_connector.h>
+#include <connect/ncbi_socket.h>
+#include "../ncbi_priv.h"               /* CORE logging facilities */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_assert.h"  /* This header must go last */
+
+
+#define N_TRIGGERS  300
+#define N_CONNS     4
+
+#ifdef _MSC_VER
+#  define setenv(n,v,w)  _putenv_s(n,v)
+#endif /*_MSC_VER*/
+
+
+static const STimeout kZero   = { 0, 0 };
+static const STimeout kWait   = { 5, 0 };
+static const STimeout kShort  = { 0, 100000 };
+
+
+/* Wait on the set, and return the number of events (0 on timeout) */
+static size_t s_Wait(POLLSET pset, const STimeout* timeout,
+                     SPOLLSET_Event events[], size_t n)
+{
+    size_t     n_ready = (size_t)(-1);
+    EIO_Status status  = POLLSET_Wait(pset, timeout, events, n, &n_ready);
+    assert(status == eIO_Success  ||  status == eIO_Timeout);
+    assert((status == eIO_Success) == (n_ready != 0));
+    assert(n_ready <= n);
+    return n_ready;
+}
+
+
+/* Find the handle among the events */
+static const SPOLLSET_Event* s_Find(POLLABLE poll,
+                                    const SPOLLSET_Event events[], size_t n)
+{
+    size_t i;
+    for (i = 0;  i < n;  ++i) {
+        if (events[i].poll == poll)
+            return &events[i];
+    }
+    return 0;
+}
+
+
+static void s_TestRegistration(void)
+{
+    POLLSET  pset;
+    TRIGGER  trigger;
+    POLLABLE poll;
+    SPOLLSET_Event events[4];
+    size_t   n_ready;
+
+    CORE_LOG(eLOG_Note, "Registration");
+    assert(POLLSET_Create(0) == eIO_InvalidArg);
+    assert(POLLSET_Create(&pset) == eIO_Success  &&  pset);
+    assert(POLLSET_GetCount(pset) == 0);
+    assert(TRIGGER_Create(&trigger, eDefault) == eIO_Success);
+    poll = POLLABLE_FromTRIGGER(trigger);
+
+    /* Nothing in the set is ever ready */
+    assert(POLLSET_Wait(pset, &kZero, events, 4, &n_ready) == eIO_Timeout);
+    assert(n_ready == 0);
+
+    assert(POLLSET_Add(pset, 0, eIO_Read, 0) == eIO_InvalidArg);
+    assert(POLLSET_Add(pset, poll, eIO_Close, 0) == eIO_InvalidArg);
+    assert(POLLSET_Modify(pset, poll, eIO_Read, 0) == eIO_InvalidArg);
+    assert(POLLSET_Remove(pset, poll) == eIO_InvalidArg);
+    assert(POLLSET_SetTimer(pset, poll, &kZero) == eIO_InvalidArg);
+
+    assert(POLLSET_Add(pset, poll, eIO_Read, &trigger) == eIO_Success);
+    assert(POLLSET_Add(pset, poll, eIO_Read, 0) == eIO_InvalidArg);
+    assert(POLLSET_GetCount(pset) == 1);
+    assert(POLLSET_Modify(pset, poll, eIO_Close, 0) == eIO_InvalidArg);
+    assert(POLLSET_Wait(pset, &kZero, events, 0, &n_ready)
+           == eIO_InvalidArg);
+    assert(POLLSET_Wait(pset, kDefaultTimeout, events, 4, &n_ready)
+           == eIO_InvalidArg);
+    assert(POLLSET_SetTimer(pset, poll, kDefaultTimeout) == eIO_InvalidArg);
+
+    assert(POLLSET_Remove(pset, poll) == eIO_Success);
+    assert(POLLSET_Remove(pset, poll) == eIO_InvalidArg);
+    assert(POLLSET_GetCount(pset) == 0);
+
+    POLLSET_Destroy(pset);
+    TRIGGER_Close(trigger);
+}
+
+
+/* Only the triggers which are set get reported, whatever the set size */
+static void s_TestTriggers(void)
+{
+    static TRIGGER triggers[N_TRIGGERS];
+    SPOLLSET_Event events[N_TRIGGERS];
+    POLLSET pset;
+    size_t  i, n, total;
+
+    CORE_LOG(eLOG_Note, "Triggers");
+    assert(POLLSET_Create(&pset) == eIO_Success);
+    for (i = 0;  i < N_TRIGGERS;  ++i) {
+        assert(TRIGGER_Create(&triggers[i], eDefault) == eIO_Success);
+        assert(POLLSET_Add(pset, POLLABLE_FromTRIGGER(triggers[i]),
+                           eIO_Read, &triggers[i]) == eIO_Success);
+    }
+    assert(POLLSET_GetCount(pset) == N_TRIGGERS);
+    assert(s_Wait(pset, &kZero, events, N_TRIGGERS) == 0);
+
+    assert(TRIGGER_Set(triggers[N_TRIGGERS / 2]) == eIO_Success);
+    n = s_Wait(pset, &kWait, events, N_TRIGGERS);
+    assert(n == 1);
+    assert(events[0].poll == POLLABLE_FromTRIGGER(triggers[N_TRIGGERS / 2]));
+    assert(events[0].revent == eIO_Read);
+    assert(events[0].data == &triggers[N_TRIGGERS / 2]);
+    assert(!events[0].expired);
+
+    /* Level-triggered: reported until reset */
+    n = s_Wait(pset, &kZero, events, N_TRIGGERS);
+    assert(n == 1);
+    assert(TRIGGER_Reset(triggers[N_TRIGGERS / 2]) == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, N_TRIGGERS) == 0);
+
+    /* Events which do not fit are reported by the next wait */
+    for (i = 0;  i < N_TRIGGERS;  i += 10)
+        assert(TRIGGER_Set(triggers[i]) == eIO_Success);
+    total = 0;
+    while ((n = s_Wait(pset, &kZero, events, 3)) != 0) {
+        for (i = 0;  i < n;  ++i) {
+            TRIGGER trigger = *((TRIGGER*) events[i].data);
+            assert(events[i].poll == POLLABLE_FromTRIGGER(trigger));
+            assert(TRIGGER_Reset(trigger) == eIO_Success);
+            ++total;
+        }
+        assert(total <= N_TRIGGERS / 10);
+    }
+    assert(total == N_TRIGGERS / 10);
+
+    /* All that is ready comes in one wait, however many there are */
+    for (i = 0;  i < N_TRIGGERS;  ++i)
+        assert(TRIGGER_Set(triggers[i]) == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, N_TRIGGERS) == N_TRIGGERS);
+    for (i = 0;  i < N_TRIGGERS;  ++i)
+        assert(TRIGGER_Reset(triggers[i]) == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, N_TRIGGERS) == 0);
+
+    /* A handle kept in the set, but not waited for */
+    assert(TRIGGER_Set(triggers[1]) == eIO_Success);
+    assert(POLLSET_Modify(pset, POLLABLE_FromTRIGGER(triggers[1]),
+                          eIO_Open, 0) == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, N_TRIGGERS) == 0);
+    assert(POLLSET_Modify(pset, POLLABLE_FromTRIGGER(triggers[1]),
+                          eIO_Read, 0) == eIO_Success);
+    n = s_Wait(pset, &kZero, events, N_TRIGGERS);
+    assert(n == 1  &&  events[0].data == 0);
+
+    /* A removed handle is not reported any more */
+    assert(POLLSET_Remove(pset, POLLABLE_FromTRIGGER(triggers[1]))
+           == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, N_TRIGGERS) == 0);
+
+    for (i = 0;  i < N_TRIGGERS;  ++i) {
+        if (i != 1) {
+            assert(POLLSET_Remove(pset, POLLABLE_FromTRIGGER(triggers[i]))
+                   == eIO_Success);
+        }
+        TRIGGER_Close(triggers[i]);
+    }
+    assert(POLLSET_GetCount(pset) == 0);
+    POLLSET_Destroy(pset);
+}
+
+
+static void s_TestTimers(void)
+{
+    SPOLLSET_Event events[4];
+    POLLSET pset;
+    TRIGGER trigger, other;
+    POLLABLE poll, other_poll;
+    size_t  n;
+
+    CORE_LOG(eLOG_Note, "Timers");
+    assert(POLLSET_Create(&pset) == eIO_Success);
+    assert(TRIGGER_Create(&trigger, eDefault) == eIO_Success);
+    assert(TRIGGER_Create(&other,   eDefault) == eIO_Success);
+    poll       = POLLABLE_FromTRIGGER(trigger);
+    other_poll = POLLABLE_FromTRIGGER(other);
+    assert(POLLSET_Add(pset, poll,       eIO_Read, &trigger) == eIO_Success);
+    assert(POLLSET_Add(pset, other_poll, eIO_Open, &other)   == eIO_Success);
+
+    /* Not yet */
+    assert(POLLSET_SetTimer(pset, other_poll, &kShort) == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, 4) == 0);
+
+    /* Goes off once, even for a handle not waited for */
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1);
+    assert(events[0].poll == other_poll);
+    assert(events[0].revent == eIO_Open);
+    assert(events[0].expired);
+    assert(events[0].data == &other);
+    assert(s_Wait(pset, &kShort, events, 4) == 0);
+
+    /* Disarmed */
+    assert(POLLSET_SetTimer(pset, other_poll, &kShort) == eIO_Success);
+    assert(POLLSET_SetTimer(pset, other_poll, kInfiniteTimeout)
+           == eIO_Success);
+    assert(s_Wait(pset, &kShort, events, 4) == 0);
+
+    /* Re-armed: only the latest expiration counts */
+    assert(POLLSET_SetTimer(pset, other_poll, &kWait) == eIO_Success);
+    assert(POLLSET_SetTimer(pset, other_poll, &kShort) == eIO_Success);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1  &&  events[0].poll == other_poll  &&  events[0].expired);
+
+    /* Going off with the handle ready is one event */
+    assert(TRIGGER_Set(trigger) == eIO_Success);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1  &&  events[0].poll == poll  &&  !events[0].expired);
+    assert(POLLSET_SetTimer(pset, poll, &kZero) == eIO_Success);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1);
+    assert(events[0].poll == poll);
+    assert(events[0].revent == eIO_Read);
+    assert(events[0].expired);
+    assert(TRIGGER_Reset(trigger) == eIO_Success);
+
+    /* Goes away with the handle */
+    assert(POLLSET_SetTimer(pset, other_poll, &kShort) == eIO_Success);
+    assert(POLLSET_Remove(pset, other_poll) == eIO_Success);
+    assert(s_Wait(pset, &kShort, events, 4) == 0);
+
+    assert(POLLSET_Remove(pset, poll) == eIO_Success);
+    POLLSET_Destroy(pset);
+    TRIGGER_Close(trigger);
+    TRIGGER_Close(other);
+}
+
+
+static void s_TestSockets(void)
+{
+    SPOLLSET_Event events[4];
+    const SPOLLSET_Event* ev;
+    POLLSET        pset;
+    LSOCK          lsock;
+    SOCK           client, server;
+    unsigned short port;
+    char           buf[16];
+    size_t         n, n_io;
+
+    CORE_LOG(eLOG_Note, "Sockets");
+    assert(POLLSET_Create(&pset) == eIO_Success);
+    assert(LSOCK_Create(0, 5, &lsock) == eIO_Success);
+    port = LSOCK_GetPort(lsock, eNH_HostByteOrder);
+    assert(port);
+    assert(POLLSET_Add(pset, POLLABLE_FromLSOCK(lsock), eIO_Read, &lsock)
+           == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, 4) == 0);
+
+    /* A pending connection makes the listening socket readable */
+    assert(SOCK_Create("127.0.0.1", port, &kWait, &client) == eIO_Success);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1);
+    assert(events[0].poll == POLLABLE_FromLSOCK(lsock));
+    assert(events[0].revent == eIO_Read);
+    assert(events[0].data == &lsock);
+    assert(LSOCK_Accept(lsock, &kWait, &server) == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, 4) == 0);
+
+    /* A connected socket is writable, and not readable until data come */
+    assert(POLLSET_Add(pset, POLLABLE_FromSOCK(server), eIO_Read, &server)
+           == eIO_Success);
+    assert(POLLSET_Add(pset, POLLABLE_FromSOCK(client), eIO_Write, &client)
+           == eIO_Success);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1);
+    assert(events[0].poll == POLLABLE_FromSOCK(client));
+    assert(events[0].revent == eIO_Write);
+    assert(POLLSET_Modify(pset, POLLABLE_FromSOCK(client), eIO_Read, &client)
+           == eIO_Success);
+    assert(s_Wait(pset, &kZero, events, 4) == 0);
+
+    assert(SOCK_Write(client, "0123456789", 10, &n_io, eIO_WritePersist)
+           == eIO_Success  &&  n_io == 10);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1);
+    assert(events[0].poll == POLLABLE_FromSOCK(server));
+    assert(events[0].revent == eIO_Read);
+    assert(events[0].data == &server);
+
+    /* SOCK_Read() takes in all that has come, and hands out a part:  the
+     * rest is only in the SOCK's buffer, and must still be reported */
+    assert(SOCK_Read(server, buf, 4, &n_io, eIO_ReadPlain) == eIO_Success);
+    assert(n_io == 4  &&  memcmp(buf, "0123", 4) == 0);
+    n = s_Wait(pset, &kZero, events, 4);
+    assert(n == 1  &&  events[0].poll == POLLABLE_FromSOCK(server));
+    assert(SOCK_Read(server, buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Success);
+    assert(n_io == 6  &&  memcmp(buf, "456789", 6) == 0);
+    assert(s_Wait(pset, &kZero, events, 4) == 0);
+
+    /* Data pushed back into a SOCK which has not been reported ready are
+     * only seen after POLLSET_Modify() */
+    assert(SOCK_Pushback(server, "ab", 2) == eIO_Success);
+    assert(POLLSET_Modify(pset, POLLABLE_FromSOCK(server), eIO_Read, &server)
+           == eIO_Success);
+    n = s_Wait(pset, &kZero, events, 4);
+    assert(n == 1  &&  events[0].poll == POLLABLE_FromSOCK(server));
+    assert(SOCK_Read(server, buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Success  &&  n_io == 2);
+
+    /* Both ends at once */
+    assert(SOCK_Write(client, "x", 1, &n_io, eIO_WritePersist)
+           == eIO_Success);
+    assert(SOCK_Write(server, "y", 1, &n_io, eIO_WritePersist)
+           == eIO_Success);
+    do {
+        n = s_Wait(pset, &kWait, events, 4);
+        assert(n == 1  ||  n == 2);
+    } while (n < 2);
+    assert((ev = s_Find(POLLABLE_FromSOCK(client), events, n)) != 0);
+    assert(ev->revent == eIO_Read  &&  ev->data == &client);
+    assert((ev = s_Find(POLLABLE_FromSOCK(server), events, n)) != 0);
+    assert(ev->revent == eIO_Read  &&  ev->data == &server);
+    assert(SOCK_Read(client, buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Success  &&  n_io == 1  &&  buf[0] == 'y');
+    assert(SOCK_Read(server, buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Success  &&  n_io == 1  &&  buf[0] == 'x');
+    assert(s_Wait(pset, &kZero, events, 4) == 0);
+
+    /* The peer closing the connection makes the socket readable (EOF) */
+    assert(POLLSET_Remove(pset, POLLABLE_FromSOCK(client)) == eIO_Success);
+    assert(SOCK_Close(client) == eIO_Success);
+    n = s_Wait(pset, &kWait, events, 4);
+    assert(n == 1  &&  events[0].poll == POLLABLE_FromSOCK(server));
+    assert(SOCK_Read(server, buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Closed  &&  n_io == 0);
+
+    assert(POLLSET_Remove(pset, POLLABLE_FromSOCK(server)) == eIO_Success);
+    assert(SOCK_Close(server) == eIO_Success);
+    assert(POLLSET_Remove(pset, POLLABLE_FromLSOCK(lsock)) == eIO_Success);
+    assert(LSOCK_Close(lsock) == eIO_Success);
+    assert(POLLSET_GetCount(pset) == 0);
+    POLLSET_Destroy(pset);
+}
+
+
+/* Service connections to a stateful server are waited on via their SOCKs;
+ * HTTP ones have none to offer */
+static void s_TestServiceConnections(void)
+{
+    static const char kService[] = "TEST_NCBI_POLLSET";
+    SPOLLSET_Event events[N_CONNS];
+    CONN           conns  [N_CONNS];
+    SOCK           servers[N_CONNS];
+    SOCK           sock;
+    POLLSET        pset;
+    LSOCK          lsock;
+    CONN           http;
+    char           buf[80];
+    size_t         i, n, n_io, seen;
+
+    CORE_LOG(eLOG_Note, "Service connections");
+    assert(LSOCK_Create(0, N_CONNS, &lsock) == eIO_Success);
+    sprintf(buf, "STANDALONE :%hu",
+            LSOCK_GetPort(lsock, eNH_HostByteOrder));
+    setenv("CONN_LOCAL_ENABLE",                   "1", 1);
+    setenv("TEST_NCBI_POLLSET_CONN_LOCAL_SERVER_1", buf, 1);
+    setenv("TEST_NCBI_POLLSET_HTTP_CONN_LOCAL_SERVER_1",
+           "HTTP 127.0.0.1:1 /", 1);
+
+    assert(POLLSET_Create(&pset) == eIO_Success);
+    for (i = 0;  i < N_CONNS;  ++i) {
+        assert(CONN_Create(SERVICE_CreateConnector(kService), &conns[i])
+               == eIO_Success);
+        assert(CONN_GetSOCK(conns[i], &sock) == eIO_Success  &&  sock);
+        assert(LSOCK_Accept(lsock, &kWait, &servers[i]) == eIO_Success);
+        assert(POLLSET_Add(pset, POLLABLE_FromSOCK(sock), eIO_Read,
+                           &conns[i]) == eIO_Success);
+    }
+    assert(s_Wait(pset, &kZero, events, N_CONNS) == 0);
+
+    /* Only the connections that got a reply are reported */
+    assert(SOCK_Write(servers[1], "one", 3, &n_io, eIO_WritePersist)
+           == eIO_Success);
+    assert(SOCK_Write(servers[3], "three", 5, &n_io, eIO_WritePersist)
+           == eIO_Success);
+    seen = 0;
+    while (seen != ((1 << 1) | (1 << 3))) {
+        assert((n = s_Wait(pset, &kWait, events, N_CONNS)) != 0);
+        for (i = 0;  i < n;  ++i) {
+            size_t k = (size_t)((CONN*) events[i].data - conns);
+            assert(k == 1  ||  k == 3);
+            assert(events[i].revent == eIO_Read);
+            seen |= 1 << k;
+        }
+    }
+    assert(CONN_Read(conns[1], buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Success  &&  n_io == 3  &&  memcmp(buf, "one", 3) == 0);
+    assert(CONN_Read(conns[3], buf, sizeof(buf), &n_io, eIO_ReadPlain)
+           == eIO_Success  &&  n_io == 5  &&  memcmp(buf, "three", 5) == 0);
+    assert(s_Wait(pset, &kZero, events, N_CONNS) == 0);
+
+    for (i = 0;  i < N_CONNS;  ++i) {
+        assert(CONN_GetSOCK(conns[i], &sock) == eIO_Success);
+        assert(POLLSET_Remove(pset, POLLABLE_FromSOCK(sock)) == eIO_Success);
+        assert(CONN_Close(conns[i]) == eIO_Success);
+        SOCK_Close(servers[i]);
+    }
+
+    /* No socket to wait on behind an HTTP service connection */
+    assert(CONN_Create(SERVICE_CreateConnector("TEST_NCBI_POLLSET_HTTP"),
+                       &http) == eIO_Success);
+    sock = (SOCK) buf;
+    assert(CONN_GetSOCK(http, &sock) != eIO_Success  &&  !sock);
+    CONN_Close(http);
+
+    assert(POLLSET_GetCount(pset) == 0);
+    POLLSET_Destroy(pset);
+    LSOCK_Close(lsock);
+}
+
+
+int main(void)
+{
+    CORE_SetLOGFormatFlags(fLOG_None          | fLOG_Level   |
+                           fLOG_OmitNoteLevel | fLOG_DateTime);
+    CORE_SetLOGFILE(stderr, 0/*false*/);
+
+    s_TestRegistration();
+    s_TestTriggers();
+    s_TestTimers();
+    s_TestSockets();
+    s_TestServiceConnections();
+
+    CORE_LOG(eLOG_Note, "TEST completed successfully");
+    CORE_SetLOG(0);
+    return 0;
+}
@@ -0,0 +1,343 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   CServer connection scaling benchmark: round-trip latency and
+ *   throughput of a few active clients while many idle connections are
+ *   kept open, with the poll() loop or with reactor threads.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbicntr.hpp>
+#include <corelib/ncbi_system.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbitime.hpp>
+#include <connect/ncbi_util.h>
+#include <connect/server.hpp>
+#ifdef NCBI_OS_UNIX
+#  include <sys/resource.h>
+#endif
+
+#include "test_assert.h"  // This header must go last
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// Server which echoes every line back to the client
+class CScalingServer : public CServer
+{
+public:
+    CScalingServer(void) : m_ShutdownRequested(false), m_Timeouts(0) {}
+
+    virtual bool ShutdownRequested(void) { return m_ShutdownRequested; }
+    void RequestShutdown(void)
+    {
+        m_ShutdownRequested = true;
+        WakeUpPollCycle();
+    }
+
+    virtual void ProcessTimeout(void) { ++m_Timeouts; }
+    int GetTimeouts(void) const { return m_Timeouts; }
+
+private:
+    volatile bool m_ShutdownRequested;
+    volatile int  m_Timeouts;
+};
+
+
+class CEchoConnectionHandler : public IServer_LineMessageHandler
+{
+public:
+    virtual void OnOpen(void) {}
+    virtual void OnWrite(void) {}
+
+    virtual void OnMessage(BUF buf)
+    {
+        char   data[1024];
+        size_t size = BUF_Read(buf, data, sizeof(data) - 1);
+        data[size++] = '\n';
+        GetSocket().Write(data, size);
+    }
+};
+
+
+class CEchoConnectionFactory : public IServer_ConnectionFactory
+{
+public:
+    IServer_ConnectionHandler* Create(void)
+    {
+        return new CEchoConnectionHandler;
+    }
+};
+
+
+/// Runs the server until it is asked to shut down
+class CServerThread : public CThread
+{
+public:
+    CServerThread(CScalingServer& server) : m_Server(server) {}
+
+protected:
+    virtual void* Main(void)
+    {
+        m_Server.Run();
+        return NULL;
+    }
+
+private:
+    CScalingServer& m_Server;
+};
+
+
+/// Active client: sends lines and waits for the echo
+class CClientThread : public CThread
+{
+public:
+    CClientThread(unsigned short port, int requests)
+        : m_Port(port), m_Requests(requests), m_Done(0), m_MaxLatency(0.0)
+    {}
+
+    int    GetDone(void)       const { return m_Done; }
+    double GetMaxLatency(void) const { return m_MaxLatency; }
+
+protected:
+    virtual void* Main(void)
+    {
+        CSocket sock("127.0.0.1", m_Port);
+        static const char kLine[] = "ping\n";
+        for (int i = 0;  i < m_Requests;  ++i) {
+            CStopWatch sw(CStopWatch::eStart);
+            if (sock.Write(kLine, sizeof(kLine) - 1) != eIO_Success)
+                break;
+            string reply;
+            if (sock.ReadLine(reply) != eIO_Success)
+                break;
+            double latency = sw.Elapsed();
+            if (latency > m_MaxLatency)
+                m_MaxLatency = latency;
+            ++m_Done;
+        }
+        return NULL;
+    }
+
+private:
+    unsigned short m_Port;
+    int            m_Requests;
+    int            m_Done;
+    double         m_MaxLatency;
+};
+
+
+class CServerScalingApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+    virtual void Exit(void);
+};
+
+
+void CServerScalingApp::Init(void)
+{
+    CORE_SetLOCK(MT_LOCK_cxx2c());
+    CORE_SetLOG(LOG_cxx2c());
+
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "CServer connection scaling benchmark");
+
+    arg_desc->AddDefaultKey("idle", "N",
+                            "Number of idle connections to keep open",
+                            CArgDescriptions::eInteger, "10000");
+    arg_desc->AddDefaultKey("clients", "N",
+                            "Number of active clients",
+                            CArgDescriptions::eInteger, "4");
+    arg_desc->AddDefaultKey("requests", "N",
+                            "Number of round trips per active client",
+                            CArgDescriptions::eInteger, "10000");
+    arg_desc->AddDefaultKey("reactors", "N",
+                            "Number of reactor threads "
+                            "(0 = poll() loop)",
+                            CArgDescriptions::eInteger, "0");
+    arg_desc->AddDefaultKey("threads", "N",
+                            "Number of server threads",
+                            CArgDescriptions::eInteger, "8");
+
+    arg_desc->SetConstraint("idle", new CArgAllow_Integers(0, 1000000));
+    arg_desc->SetConstraint("clients", new CArgAllow_Integers(1, 256));
+    arg_desc->SetConstraint("requests", new CArgAllow_Integers(1, 10000000));
+    arg_desc->SetConstraint("reactors", new CArgAllow_Integers(0, 64));
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(1, 999));
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+void CServerScalingApp::Exit(void)
+{
+    CORE_SetLOG(0);
+    CORE_SetLOCK(0);
+}
+
+
+int CServerScalingApp::Run(void)
+{
+    const CArgs& args = GetArgs();
+    int idle     = args["idle"].AsInteger();
+    int clients  = args["clients"].AsInteger();
+    int requests = args["requests"].AsInteger();
+
+#ifdef NCBI_OS_UNIX
+    // Both ends of every connection live in this process
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0) {
+        rlim_t need = rlim_t(idle + clients) * 2 + 256;
+        if (rl.rlim_cur < need) {
+            rl.rlim_cur = need < rl.rlim_max ? need : rl.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &rl);
+        }
+        if (rl.rlim_cur < need) {
+            idle = int((rl.rlim_cur - 256) / 2) - clients;
+            ERR_POST(Warning << "Open file limit is too low, using "
+                     << idle << " idle connections");
+        }
+    }
+#endif
+
+    unsigned short port = 4096;
+    {
+        CListeningSocket listener;
+        while (++port & 0xFFFF) {
+            if (listener.Listen(port, 5, fSOCK_BindAny | fSOCK_LogOff)
+                == eIO_Success)
+                break;
+        }
+        if (port == 0) {
+            ERR_POST("Unable to find a free port to listen on");
+            return 2;
+        }
+    }
+
+    static const STimeout kIdleTimeout = { 3600, 0 };
+    // Longer than a second, the longest wait of the reactor mode loop
+    static const STimeout kAcceptTimeout = { 1, 500000 };
+    SServer_Parameters params;
+    params.max_connections = idle + clients + 16;
+    params.idle_timeout    = &kIdleTimeout;
+    params.accept_timeout  = &kAcceptTimeout;
+    params.init_threads    = args["threads"].AsInteger();
+    params.max_threads     = args["threads"].AsInteger();
+    params.reactor_threads = args["reactors"].AsInteger();
+
+    CScalingServer server;
+    server.SetParameters(params);
+    server.AddListener(new CEchoConnectionFactory, port);
+    server.StartListening();
+
+    CRef<CServerThread> server_thread(new CServerThread(server));
+    server_thread->Run();
+
+    // Open the idle connections
+    CStopWatch sw(CStopWatch::eStart);
+    vector<CSocket*> idle_socks;
+    idle_socks.reserve(idle);
+    for (int i = 0;  i < idle;  ++i) {
+        CSocket* sock = new CSocket("127.0.0.1", port);
+        if (sock->GetStatus(eIO_Open) != eIO_Success) {
+            delete sock;
+            ERR_POST(Warning << "Could only open " << i
+                     << " idle connections");
+            break;
+        }
+        idle_socks.push_back(sock);
+    }
+    NcbiCout << "Opened " << idle_socks.size() << " idle connections in "
+             << sw.Elapsed() << " s" << NcbiEndl;
+
+    // Let the server accept them all before timing the active clients
+    SleepMilliSec(1000);
+
+    sw.Restart();
+    vector< CRef<CClientThread> > client_threads;
+    for (int i = 0;  i < clients;  ++i) {
+        client_threads.push_back(CRef<CClientThread>(
+                                     new CClientThread(port, requests)));
+        client_threads.back()->Run();
+    }
+    int    done        = 0;
+    double max_latency = 0.0;
+    NON_CONST_ITERATE(vector< CRef<CClientThread> >, it, client_threads) {
+        (*it)->Join();
+        done += (*it)->GetDone();
+        max_latency = max(max_latency, (*it)->GetMaxLatency());
+    }
+    double elapsed = sw.Elapsed();
+
+    NcbiCout << (params.reactor_threads
+                 ? NStr::UIntToString(params.reactor_threads) +
+                   " reactor thread(s)"
+                 : string("poll() loop"))
+             << ", " << idle_socks.size() << " idle connections: "
+             << done << " round trips in " << elapsed << " s ("
+             << (elapsed > 0 ? done / elapsed : 0.0) << "/s, average "
+             << (done ? elapsed * 1e6 * clients / done : 0.0)
+             << " us, max " << max_latency * 1e6 << " us)" << NcbiEndl;
+
+    // ProcessTimeout() must be called once nothing happened for
+    // accept_timeout
+    int timeouts = server.GetTimeouts();
+    SleepMilliSec(4000);
+    timeouts = server.GetTimeouts() - timeouts;
+    NcbiCout << timeouts << " timeout(s) while idle for 4 s" << NcbiEndl;
+
+    server.RequestShutdown();
+    server_thread->Join();
+
+    ITERATE(vector<CSocket*>, it, idle_socks) {
+        delete *it;
+    }
+
+    if (timeouts < 1) {
+        ERR_POST("ProcessTimeout() was not called");
+        return 1;
+    }
+    return done == clients * requests ? 0 : 1;
+}
+
+
+END_NCBI_SCOPE
+
+
+USING_NCBI_SCOPE;
+
+
+int main(int argc, const char* argv[])
+{
+    return CServerScalingApp().AppMain(argc, argv);
+}
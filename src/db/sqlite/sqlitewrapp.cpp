@@ -543,6 +543,17 @@ CSQLITE_Connection::SetupNewConnection(sqlite3* handle)
     case fJournalDelete:
         x_ExecuteSql(handle, "PRAGMA journal_mode = DELETE");
         break;
+    case fJournalWAL:
+#if SQLITE_VERSION_NUMBER >= 3007000
+        // The mode is persistent in the database file, a read-only
+        // connection can not (and need not) set it.
+        if ( !(m_Flags & fReadOnly) ) {
+            x_ExecuteSql(handle, "PRAGMA journal_mode = WAL");
+        }
+#else
+        x_ExecuteSql(handle, "PRAGMA journal_mode = DELETE");
+#endif
+        break;
     default:
         // Evidently this will throw an exception
         x_CheckFlagsValidity(m_Flags, eAllJournal);
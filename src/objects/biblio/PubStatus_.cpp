@@ -0,0 +1,73 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'biblio.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/biblio/PubStatus.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("PubStatus", EPubStatus, true)
+{
+    SET_ENUM_MODULE("NCBI-Biblio");
+    ADD_ENUM_VALUE("received", ePubStatus_received);
+    ADD_ENUM_VALUE("accepted", ePubStatus_accepted);
+    ADD_ENUM_VALUE("epublish", ePubStatus_epublish);
+    ADD_ENUM_VALUE("ppublish", ePubStatus_ppublish);
+    ADD_ENUM_VALUE("revised", ePubStatus_revised);
+    ADD_ENUM_VALUE("pmc", ePubStatus_pmc);
+    ADD_ENUM_VALUE("pmcr", ePubStatus_pmcr);
+    ADD_ENUM_VALUE("pubmed", ePubStatus_pubmed);
+    ADD_ENUM_VALUE("pubmedr", ePubStatus_pubmedr);
+    ADD_ENUM_VALUE("aheadofprint", ePubStatus_aheadofprint);
+    ADD_ENUM_VALUE("premedline", ePubStatus_premedline);
+    ADD_ENUM_VALUE("medline", ePubStatus_medline);
+    ADD_ENUM_VALUE("other", ePubStatus_other);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,68 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'biotree.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/biotree/NCBI_BioTree_module.hpp>
+#include <objects/biotree/BioTreeContainer.hpp>
+#include <objects/biotree/DistanceMatrix.hpp>
+#include <objects/biotree/FeatureDescr.hpp>
+#include <objects/biotree/FeatureDictSet.hpp>
+#include <objects/biotree/Node.hpp>
+#include <objects/biotree/NodeFeature.hpp>
+#include <objects/biotree/NodeFeatureSet.hpp>
+#include <objects/biotree/NodeSet.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_BioTree_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBioTreeContainer::GetTypeInfo();
+    ncbi::objects::CDistanceMatrix::GetTypeInfo();
+    ncbi::objects::CFeatureDescr::GetTypeInfo();
+    ncbi::objects::CFeatureDictSet::GetTypeInfo();
+    ncbi::objects::CNode::GetTypeInfo();
+    ncbi::objects::CNodeFeature::GetTypeInfo();
+    ncbi::objects::CNodeFeatureSet::GetTypeInfo();
+    ncbi::objects::CNodeSet::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,68 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'blast.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/blast/Blast4_result_types.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Blast4-result-types", EBlast4_result_types, false)
+{
+    SET_ENUM_MODULE("NCBI-Blast4");
+    ADD_ENUM_VALUE("default", eBlast4_result_types_default);
+    ADD_ENUM_VALUE("alignments", eBlast4_result_types_alignments);
+    ADD_ENUM_VALUE("phi-alignments", eBlast4_result_types_phi_alignments);
+    ADD_ENUM_VALUE("masks", eBlast4_result_types_masks);
+    ADD_ENUM_VALUE("ka-blocks", eBlast4_result_types_ka_blocks);
+    ADD_ENUM_VALUE("search-stats", eBlast4_result_types_search_stats);
+    ADD_ENUM_VALUE("pssm", eBlast4_result_types_pssm);
+    ADD_ENUM_VALUE("simple-results", eBlast4_result_types_simple_results);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
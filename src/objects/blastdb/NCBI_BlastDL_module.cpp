@@ -0,0 +1,60 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'blastdb.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/blastdb/NCBI_BlastDL_module.hpp>
+#include <objects/blastdb/Blast_db_mask_info.hpp>
+#include <objects/blastdb/Blast_def_line.hpp>
+#include <objects/blastdb/Blast_def_line_set.hpp>
+#include <objects/blastdb/Blast_mask_list.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_BlastDL_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBlast_db_mask_info::GetTypeInfo();
+    ncbi::objects::CBlast_def_line::GetTypeInfo();
+    ncbi::objects::CBlast_def_line_set::GetTypeInfo();
+    ncbi::objects::CBlast_mask_list::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
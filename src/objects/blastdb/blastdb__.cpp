@@ -0,0 +1,6 @@
+#include <ncbi_pch.hpp>
+#include "Blast_db_mask_info.cpp"
+#include "Blast_def_line.cpp"
+#include "Blast_def_line_set.cpp"
+#include "Blast_filter_program.cpp"
+#include "Blast_mask_list.cpp"
@@ -0,0 +1,7 @@
+#include <ncbi_pch.hpp>
+#include "BlastOutput.cpp"
+#include "Hit.cpp"
+#include "Hsp.cpp"
+#include "Iteration.cpp"
+#include "Parameters.cpp"
+#include "Statistics.cpp"
@@ -0,0 +1,15 @@
+#include <ncbi_pch.hpp>
+#include "BlastOutput2.cpp"
+#include "BlastXML2.cpp"
+#include "Err.cpp"
+#include "Hit.cpp"
+#include "HitDescr.cpp"
+#include "Hsp.cpp"
+#include "Iteration.cpp"
+#include "Parameters.cpp"
+#include "Range.cpp"
+#include "Report.cpp"
+#include "Results.cpp"
+#include "Search.cpp"
+#include "Statistics.cpp"
+#include "Target.cpp"
@@ -0,0 +1,16 @@
+#include <ncbi_pch.hpp>
+#include "BlastOutput2_.cpp"
+#include "BlastXML2_.cpp"
+#include "Err_.cpp"
+#include "Hit_.cpp"
+#include "HitDescr_.cpp"
+#include "Hsp_.cpp"
+#include "Iteration_.cpp"
+#include "Parameters_.cpp"
+#include "Range_.cpp"
+#include "Report_.cpp"
+#include "Results_.cpp"
+#include "Search_.cpp"
+#include "Statistics_.cpp"
+#include "Target_.cpp"
+#include "NCBI_BlastOutput2_module.cpp"
@@ -0,0 +1,151 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'docsum.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/docsum/BaseURL.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CBaseURL_Base::C_Attlist::ResetResourceName(void)
+{
+    m_ResourceName.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CBaseURL_Base::C_Attlist::ResetResourceId(void)
+{
+    m_ResourceId.erase();
+    m_set_State[0] &= ~0x30;
+}
+
+void CBaseURL_Base::C_Attlist::Reset(void)
+{
+    ResetUrlId();
+    ResetResourceName();
+    ResetResourceId();
+}
+
+BEGIN_NAMED_CLASS_INFO("", CBaseURL_Base::C_Attlist)
+{
+    SET_INTERNAL_NAME("BaseURL", "attlist");
+    SET_CLASS_MODULE("Docsum-3-4");
+    ADD_NAMED_STD_MEMBER("urlId", m_UrlId)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("resourceName", m_ResourceName)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("resourceId", m_ResourceId)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->SetRandomOrder(true);
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CBaseURL_Base::C_Attlist::C_Attlist(void)
+    : m_UrlId(0)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CBaseURL_Base::C_Attlist::~C_Attlist(void)
+{
+}
+
+
+void CBaseURL_Base::ResetAttlist(void)
+{
+    if ( !m_Attlist ) {
+        m_Attlist.Reset(new TAttlist());
+        return;
+    }
+    (*m_Attlist).Reset();
+}
+
+void CBaseURL_Base::SetAttlist(CBaseURL_Base::TAttlist& value)
+{
+    m_Attlist.Reset(&value);
+}
+
+void CBaseURL_Base::ResetBaseURL(void)
+{
+    m_BaseURL.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CBaseURL_Base::Reset(void)
+{
+    ResetAttlist();
+    ResetBaseURL();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("BaseURL", CBaseURL)
+{
+    SET_CLASS_MODULE("Docsum-3-4");
+    ADD_NAMED_REF_MEMBER("attlist", m_Attlist, C_Attlist);
+    ADD_NAMED_STD_MEMBER("baseURL", m_BaseURL)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CBaseURL_Base::CBaseURL_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetAttlist();
+    }
+}
+
+// destructor
+CBaseURL_Base::~CBaseURL_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
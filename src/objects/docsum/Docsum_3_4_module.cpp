@@ -0,0 +1,76 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'docsum.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/docsum/Docsum_3_4_module.hpp>
+#include <objects/docsum/Assay.hpp>
+#include <objects/docsum/Assembly.hpp>
+#include <objects/docsum/BaseURL.hpp>
+#include <objects/docsum/Component.hpp>
+#include <objects/docsum/ExchangeSet.hpp>
+#include <objects/docsum/FxnSet.hpp>
+#include <objects/docsum/MapLoc.hpp>
+#include <objects/docsum/PrimarySequence.hpp>
+#include <objects/docsum/Rs.hpp>
+#include <objects/docsum/RsLinkout.hpp>
+#include <objects/docsum/RsStruct.hpp>
+#include <objects/docsum/Ss.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void Docsum_3_4_RegisterModuleClasses(void)
+{
+    ncbi::objects::CAssay::GetTypeInfo();
+    ncbi::objects::CAssembly::GetTypeInfo();
+    ncbi::objects::CBaseURL::GetTypeInfo();
+    ncbi::objects::CComponent::GetTypeInfo();
+    ncbi::objects::CExchangeSet::GetTypeInfo();
+    ncbi::objects::CFxnSet::GetTypeInfo();
+    ncbi::objects::CMapLoc::GetTypeInfo();
+    ncbi::objects::CPrimarySequence::GetTypeInfo();
+    ncbi::objects::CRs::GetTypeInfo();
+    ncbi::objects::CRsLinkout::GetTypeInfo();
+    ncbi::objects::CRsStruct::GetTypeInfo();
+    ncbi::objects::CSs::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,14 @@
+#include <ncbi_pch.hpp>
+#include "Assay_.cpp"
+#include "Assembly_.cpp"
+#include "BaseURL_.cpp"
+#include "Component_.cpp"
+#include "ExchangeSet_.cpp"
+#include "FxnSet_.cpp"
+#include "MapLoc_.cpp"
+#include "PrimarySequence_.cpp"
+#include "Rs_.cpp"
+#include "RsLinkout_.cpp"
+#include "RsStruct_.cpp"
+#include "Ss_.cpp"
+#include "Docsum_3_4_module.cpp"
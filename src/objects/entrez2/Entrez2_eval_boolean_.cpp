@@ -0,0 +1,104 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'entrez2.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/entrez2/Entrez2_eval_boolean.hpp>
+#include <objects/entrez2/Entrez2_boolean_exp.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CEntrez2_eval_boolean_Base::ResetQuery(void)
+{
+    if ( !m_Query ) {
+        m_Query.Reset(new TQuery());
+        return;
+    }
+    (*m_Query).Reset();
+}
+
+void CEntrez2_eval_boolean_Base::SetQuery(CEntrez2_eval_boolean_Base::TQuery& value)
+{
+    m_Query.Reset(&value);
+}
+
+void CEntrez2_eval_boolean_Base::Reset(void)
+{
+    ResetReturn_UIDs();
+    ResetReturn_parse();
+    ResetQuery();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Entrez2-eval-boolean", CEntrez2_eval_boolean)
+{
+    SET_CLASS_MODULE("NCBI-Entrez2");
+    ADD_NAMED_STD_MEMBER("return-UIDs", m_Return_UIDs)->SetDefault(new TReturn_UIDs(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("return-parse", m_Return_parse)->SetDefault(new TReturn_parse(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_REF_MEMBER("query", m_Query, CEntrez2_boolean_exp);
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CEntrez2_eval_boolean_Base::CEntrez2_eval_boolean_Base(void)
+    : m_Return_UIDs(false), m_Return_parse(false)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetQuery();
+    }
+}
+
+// destructor
+CEntrez2_eval_boolean_Base::~CEntrez2_eval_boolean_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
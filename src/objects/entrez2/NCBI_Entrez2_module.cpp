@@ -0,0 +1,114 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'entrez2.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/entrez2/NCBI_Entrez2_module.hpp>
+#include <objects/entrez2/E2Reply.hpp>
+#include <objects/entrez2/E2Request.hpp>
+#include <objects/entrez2/Entrez2_boolean_element.hpp>
+#include <objects/entrez2/Entrez2_boolean_exp.hpp>
+#include <objects/entrez2/Entrez2_boolean_reply.hpp>
+#include <objects/entrez2/Entrez2_boolean_term.hpp>
+#include <objects/entrez2/Entrez2_db_info.hpp>
+#include <objects/entrez2/Entrez2_docsum.hpp>
+#include <objects/entrez2/Entrez2_docsum_data.hpp>
+#include <objects/entrez2/Entrez2_docsum_field_info.hpp>
+#include <objects/entrez2/Entrez2_docsum_list.hpp>
+#include <objects/entrez2/Entrez2_dt_filter.hpp>
+#include <objects/entrez2/Entrez2_eval_boolean.hpp>
+#include <objects/entrez2/Entrez2_field_info.hpp>
+#include <objects/entrez2/Entrez2_get_links.hpp>
+#include <objects/entrez2/Entrez2_hier_node.hpp>
+#include <objects/entrez2/Entrez2_hier_query.hpp>
+#include <objects/entrez2/Entrez2_id.hpp>
+#include <objects/entrez2/Entrez2_id_list.hpp>
+#include <objects/entrez2/Entrez2_info.hpp>
+#include <objects/entrez2/Entrez2_limits.hpp>
+#include <objects/entrez2/Entrez2_link_count.hpp>
+#include <objects/entrez2/Entrez2_link_count_list.hpp>
+#include <objects/entrez2/Entrez2_link_info.hpp>
+#include <objects/entrez2/Entrez2_link_set.hpp>
+#include <objects/entrez2/Entrez2_reply.hpp>
+#include <objects/entrez2/Entrez2_request.hpp>
+#include <objects/entrez2/Entrez2_term.hpp>
+#include <objects/entrez2/Entrez2_term_list.hpp>
+#include <objects/entrez2/Entrez2_term_pos.hpp>
+#include <objects/entrez2/Entrez2_term_query.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Entrez2_RegisterModuleClasses(void)
+{
+    ncbi::objects::CE2Reply::GetTypeInfo();
+    ncbi::objects::CE2Request::GetTypeInfo();
+    ncbi::objects::CEntrez2_boolean_element::GetTypeInfo();
+    ncbi::objects::CEntrez2_boolean_exp::GetTypeInfo();
+    ncbi::objects::CEntrez2_boolean_reply::GetTypeInfo();
+    ncbi::objects::CEntrez2_boolean_term::GetTypeInfo();
+    ncbi::objects::CEntrez2_db_info::GetTypeInfo();
+    ncbi::objects::CEntrez2_docsum::GetTypeInfo();
+    ncbi::objects::CEntrez2_docsum_data::GetTypeInfo();
+    ncbi::objects::CEntrez2_docsum_field_info::GetTypeInfo();
+    ncbi::objects::CEntrez2_docsum_list::GetTypeInfo();
+    ncbi::objects::CEntrez2_dt_filter::GetTypeInfo();
+    ncbi::objects::CEntrez2_eval_boolean::GetTypeInfo();
+    ncbi::objects::CEntrez2_field_info::GetTypeInfo();
+    ncbi::objects::CEntrez2_get_links::GetTypeInfo();
+    ncbi::objects::CEntrez2_hier_node::GetTypeInfo();
+    ncbi::objects::CEntrez2_hier_query::GetTypeInfo();
+    ncbi::objects::CEntrez2_id::GetTypeInfo();
+    ncbi::objects::CEntrez2_id_list::GetTypeInfo();
+    ncbi::objects::CEntrez2_info::GetTypeInfo();
+    ncbi::objects::CEntrez2_limits::GetTypeInfo();
+    ncbi::objects::CEntrez2_link_count::GetTypeInfo();
+    ncbi::objects::CEntrez2_link_count_list::GetTypeInfo();
+    ncbi::objects::CEntrez2_link_info::GetTypeInfo();
+    ncbi::objects::CEntrez2_link_set::GetTypeInfo();
+    ncbi::objects::CEntrez2_reply::GetTypeInfo();
+    ncbi::objects::CEntrez2_request::GetTypeInfo();
+    ncbi::objects::CEntrez2_term::GetTypeInfo();
+    ncbi::objects::CEntrez2_term_list::GetTypeInfo();
+    ncbi::objects::CEntrez2_term_pos::GetTypeInfo();
+    ncbi::objects::CEntrez2_term_query::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
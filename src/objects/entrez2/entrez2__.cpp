@@ -0,0 +1,38 @@
+#include <ncbi_pch.hpp>
+#include "E2Reply.cpp"
+#include "E2Request.cpp"
+#include "Entrez2_boolean_element.cpp"
+#include "Entrez2_boolean_exp.cpp"
+#include "Entrez2_boolean_reply.cpp"
+#include "Entrez2_boolean_term.cpp"
+#include "Entrez2_db_id.cpp"
+#include "Entrez2_db_info.cpp"
+#include "Entrez2_docsum.cpp"
+#include "Entrez2_docsum_data.cpp"
+#include "Entrez2_docsum_field_info.cpp"
+#include "Entrez2_docsum_field_type.cpp"
+#include "Entrez2_docsum_list.cpp"
+#include "Entrez2_dt.cpp"
+#include "Entrez2_dt_filter.cpp"
+#include "Entrez2_eval_boolean.cpp"
+#include "Entrez2_field_id.cpp"
+#include "Entrez2_field_info.cpp"
+#include "Entrez2_get_links.cpp"
+#include "Entrez2_hier_node.cpp"
+#include "Entrez2_hier_query.cpp"
+#include "Entrez2_id.cpp"
+#include "Entrez2_id_list.cpp"
+#include "Entrez2_info.cpp"
+#include "Entrez2_limits.cpp"
+#include "Entrez2_link_count.cpp"
+#include "Entrez2_link_count_list.cpp"
+#include "Entrez2_link_id.cpp"
+#include "Entrez2_link_info.cpp"
+#include "Entrez2_link_set.cpp"
+#include "Entrez2_operator.cpp"
+#include "Entrez2_reply.cpp"
+#include "Entrez2_request.cpp"
+#include "Entrez2_term.cpp"
+#include "Entrez2_term_list.cpp"
+#include "Entrez2_term_pos.cpp"
+#include "Entrez2_term_query.cpp"
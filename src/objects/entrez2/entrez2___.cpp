@@ -0,0 +1,39 @@
+#include <ncbi_pch.hpp>
+#include "E2Reply_.cpp"
+#include "E2Request_.cpp"
+#include "Entrez2_boolean_element_.cpp"
+#include "Entrez2_boolean_exp_.cpp"
+#include "Entrez2_boolean_reply_.cpp"
+#include "Entrez2_boolean_term_.cpp"
+#include "Entrez2_db_id_.cpp"
+#include "Entrez2_db_info_.cpp"
+#include "Entrez2_docsum_.cpp"
+#include "Entrez2_docsum_data_.cpp"
+#include "Entrez2_docsum_field_info_.cpp"
+#include "Entrez2_docsum_field_type_.cpp"
+#include "Entrez2_docsum_list_.cpp"
+#include "Entrez2_dt_.cpp"
+#include "Entrez2_dt_filter_.cpp"
+#include "Entrez2_eval_boolean_.cpp"
+#include "Entrez2_field_id_.cpp"
+#include "Entrez2_field_info_.cpp"
+#include "Entrez2_get_links_.cpp"
+#include "Entrez2_hier_node_.cpp"
+#include "Entrez2_hier_query_.cpp"
+#include "Entrez2_id_.cpp"
+#include "Entrez2_id_list_.cpp"
+#include "Entrez2_info_.cpp"
+#include "Entrez2_limits_.cpp"
+#include "Entrez2_link_count_.cpp"
+#include "Entrez2_link_count_list_.cpp"
+#include "Entrez2_link_id_.cpp"
+#include "Entrez2_link_info_.cpp"
+#include "Entrez2_link_set_.cpp"
+#include "Entrez2_operator_.cpp"
+#include "Entrez2_reply_.cpp"
+#include "Entrez2_request_.cpp"
+#include "Entrez2_term_.cpp"
+#include "Entrez2_term_list_.cpp"
+#include "Entrez2_term_pos_.cpp"
+#include "Entrez2_term_query_.cpp"
+#include "NCBI_Entrez2_module.cpp"
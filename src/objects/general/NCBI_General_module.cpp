@@ -0,0 +1,70 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'general.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/general/NCBI_General_module.hpp>
+#include <objects/general/Date.hpp>
+#include <objects/general/Date_std.hpp>
+#include <objects/general/Dbtag.hpp>
+#include <objects/general/Int_fuzz.hpp>
+#include <objects/general/Name_std.hpp>
+#include <objects/general/Object_id.hpp>
+#include <objects/general/Person_id.hpp>
+#include <objects/general/User_field.hpp>
+#include <objects/general/User_object.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_General_RegisterModuleClasses(void)
+{
+    ncbi::objects::CDate::GetTypeInfo();
+    ncbi::objects::CDate_std::GetTypeInfo();
+    ncbi::objects::CDbtag::GetTypeInfo();
+    ncbi::objects::CInt_fuzz::GetTypeInfo();
+    ncbi::objects::CName_std::GetTypeInfo();
+    ncbi::objects::CObject_id::GetTypeInfo();
+    ncbi::objects::CPerson_id::GetTypeInfo();
+    ncbi::objects::CUser_field::GetTypeInfo();
+    ncbi::objects::CUser_object::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,135 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'general.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/general/Name_std.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CName_std_Base::ResetLast(void)
+{
+    m_Last.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CName_std_Base::ResetFirst(void)
+{
+    m_First.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CName_std_Base::ResetMiddle(void)
+{
+    m_Middle.erase();
+    m_set_State[0] &= ~0x30;
+}
+
+void CName_std_Base::ResetFull(void)
+{
+    m_Full.erase();
+    m_set_State[0] &= ~0xc0;
+}
+
+void CName_std_Base::ResetInitials(void)
+{
+    m_Initials.erase();
+    m_set_State[0] &= ~0x300;
+}
+
+void CName_std_Base::ResetSuffix(void)
+{
+    m_Suffix.erase();
+    m_set_State[0] &= ~0xc00;
+}
+
+void CName_std_Base::ResetTitle(void)
+{
+    m_Title.erase();
+    m_set_State[0] &= ~0x3000;
+}
+
+void CName_std_Base::Reset(void)
+{
+    ResetLast();
+    ResetFirst();
+    ResetMiddle();
+    ResetFull();
+    ResetInitials();
+    ResetSuffix();
+    ResetTitle();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Name-std", CName_std)
+{
+    SET_CLASS_MODULE("NCBI-General");
+    ADD_NAMED_STD_MEMBER("last", m_Last)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("first", m_First)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("middle", m_Middle)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("full", m_Full)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("initials", m_Initials)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("suffix", m_Suffix)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("title", m_Title)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CName_std_Base::CName_std_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CName_std_Base::~CName_std_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
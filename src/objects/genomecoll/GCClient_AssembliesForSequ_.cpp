@@ -0,0 +1,96 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'gencoll_client.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/genomecoll/GCClient_AssembliesForSequ.hpp>
+#include <objects/genomecoll/GCClient_AssemblySequenceI.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CGCClient_AssembliesForSequences_Base::ResetAssemblies(void)
+{
+    m_Assemblies.clear();
+    m_set_State[0] &= ~0x3;
+}
+
+void CGCClient_AssembliesForSequences_Base::ResetNot_found_sequences(void)
+{
+    m_Not_found_sequences.clear();
+    m_set_State[0] &= ~0xc;
+}
+
+void CGCClient_AssembliesForSequences_Base::Reset(void)
+{
+    ResetAssemblies();
+    ResetNot_found_sequences();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("GCClient-AssembliesForSequences", CGCClient_AssembliesForSequences)
+{
+    SET_CLASS_MODULE("NCBI-GencollClient");
+    ADD_NAMED_MEMBER("assemblies", m_Assemblies, STL_list_set, (STL_CRef, (CLASS, (CGCClient_AssemblySequenceInfo))))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_MEMBER("not-found-sequences", m_Not_found_sequences, STL_list_set, (STD, (string)))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CGCClient_AssembliesForSequences_Base::CGCClient_AssembliesForSequences_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CGCClient_AssembliesForSequences_Base::~CGCClient_AssembliesForSequences_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,72 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'gencoll_client.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/genomecoll/GCClient_AttributeFlags.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("GCClient-AttributeFlags", EGCClient_AttributeFlags, true)
+{
+    SET_ENUM_MODULE("NCBI-GencollClient");
+    ADD_ENUM_VALUE("none", eGCClient_AttributeFlags_none);
+    ADD_ENUM_VALUE("biosource", eGCClient_AttributeFlags_biosource);
+    ADD_ENUM_VALUE("molinfo", eGCClient_AttributeFlags_molinfo);
+    ADD_ENUM_VALUE("all", eGCClient_AttributeFlags_all);
+    ADD_ENUM_VALUE("publications", eGCClient_AttributeFlags_publications);
+    ADD_ENUM_VALUE("only-stats", eGCClient_AttributeFlags_only_stats);
+    ADD_ENUM_VALUE("exclude-stats", eGCClient_AttributeFlags_exclude_stats);
+    ADD_ENUM_VALUE("include-unordered-scaffolds", eGCClient_AttributeFlags_include_unordered_scaffolds);
+    ADD_ENUM_VALUE("include-UCSC-pseudo-scaffolds", eGCClient_AttributeFlags_include_UCSC_pseudo_scaffolds);
+    ADD_ENUM_VALUE("exclude-aligndb", eGCClient_AttributeFlags_exclude_aligndb);
+    ADD_ENUM_VALUE("only-gui-data", eGCClient_AttributeFlags_only_gui_data);
+    ADD_ENUM_VALUE("get-wgs-contigs", eGCClient_AttributeFlags_get_wgs_contigs);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,17 @@
+#include <ncbi_pch.hpp>
+#include "GCClientRequest.cpp"
+#include "GCClientResponse.cpp"
+#include "GCClient_AssembliesForSequ.cpp"
+#include "GCClient_AssemblyInfo.cpp"
+#include "GCClient_AssemblySequenceI.cpp"
+#include "GCClient_AttributeFlags.cpp"
+#include "GCClient_EquivalentAssembl.cpp"
+#include "GCClient_Error.cpp"
+#include "GCClient_FindBestAssemblyF.cpp"
+#include "GCClient_FindBestAssemblyR.cpp"
+#include "GCClient_FindBestAssemblyS.cpp"
+#include "GCClient_GetAssemblyBlobRe.cpp"
+#include "GCClient_GetAssemblyBySequ.cpp"
+#include "GCClient_GetAssemblyReques.cpp"
+#include "GCClient_GetEquivalentAsse.cpp"
+#include "GCClient_ValidateChrTypeLo.cpp"
@@ -0,0 +1,18 @@
+#include <ncbi_pch.hpp>
+#include "GCClientRequest_.cpp"
+#include "GCClientResponse_.cpp"
+#include "GCClient_AssembliesForSequ_.cpp"
+#include "GCClient_AssemblyInfo_.cpp"
+#include "GCClient_AssemblySequenceI_.cpp"
+#include "GCClient_AttributeFlags_.cpp"
+#include "GCClient_EquivalentAssembl_.cpp"
+#include "GCClient_Error_.cpp"
+#include "GCClient_FindBestAssemblyF_.cpp"
+#include "GCClient_FindBestAssemblyR_.cpp"
+#include "GCClient_FindBestAssemblyS_.cpp"
+#include "GCClient_GetAssemblyBlobRe_.cpp"
+#include "GCClient_GetAssemblyBySequ_.cpp"
+#include "GCClient_GetAssemblyReques_.cpp"
+#include "GCClient_GetEquivalentAsse_.cpp"
+#include "GCClient_ValidateChrTypeLo_.cpp"
+#include "NCBI_GencollClient_module.cpp"
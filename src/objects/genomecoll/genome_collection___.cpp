@@ -0,0 +1,21 @@
+#include <ncbi_pch.hpp>
+#include "GC_Assemblies_.cpp"
+#include "GC_Assembly_.cpp"
+#include "GC_AssemblyDesc_.cpp"
+#include "GC_AssemblySet_.cpp"
+#include "GC_AssemblyUnit_.cpp"
+#include "GC_DbTagAlias_.cpp"
+#include "GC_External_Seqid_.cpp"
+#include "GC_Genome_.cpp"
+#include "GC_GenomicPart_.cpp"
+#include "GC_Project_.cpp"
+#include "GC_Query_.cpp"
+#include "GC_Replicon_.cpp"
+#include "GC_Scaf_stats_.cpp"
+#include "GC_SeqIdAlias_.cpp"
+#include "GC_Sequence_.cpp"
+#include "GC_SequenceRole_.cpp"
+#include "GC_SequenceStats_.cpp"
+#include "GC_TaggedSequences_.cpp"
+#include "GC_TypedSeqId_.cpp"
+#include "NCBI_GenomeCollection_module.cpp"
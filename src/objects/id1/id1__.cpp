@@ -0,0 +1,9 @@
+#include <ncbi_pch.hpp>
+#include "Entry_complexities.cpp"
+#include "ID1SeqEntry_info.cpp"
+#include "ID1Seq_hist.cpp"
+#include "ID1blob_info.cpp"
+#include "ID1server_back.cpp"
+#include "ID1server_debug.cpp"
+#include "ID1server_maxcomplex.cpp"
+#include "ID1server_request.cpp"
@@ -0,0 +1,109 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'id2.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/id2/ID2_Param.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_IN_INFO("", CID2_Param_Base::, EType, false)
+{
+    SET_ENUM_INTERNAL_NAME("ID2-Param", "type");
+    SET_ENUM_MODULE("NCBI-ID2Access");
+    ADD_ENUM_VALUE("set-value", eType_set_value);
+    ADD_ENUM_VALUE("get-value", eType_get_value);
+    ADD_ENUM_VALUE("force-value", eType_force_value);
+    ADD_ENUM_VALUE("use-package", eType_use_package);
+}
+END_ENUM_INFO
+
+void CID2_Param_Base::ResetName(void)
+{
+    m_Name.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CID2_Param_Base::ResetValue(void)
+{
+    m_Value.clear();
+    m_set_State[0] &= ~0xc;
+}
+
+void CID2_Param_Base::Reset(void)
+{
+    ResetName();
+    ResetValue();
+    ResetType();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("ID2-Param", CID2_Param)
+{
+    SET_CLASS_MODULE("NCBI-ID2Access");
+    ADD_NAMED_STD_MEMBER("name", m_Name)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_MEMBER("value", m_Value, STL_list, (STD, (string)))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_ENUM_MEMBER("type", m_Type, EType)->SetDefault(new TType(eType_set_value))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CID2_Param_Base::CID2_Param_Base(void)
+    : m_Type(eType_set_value)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CID2_Param_Base::~CID2_Param_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,107 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'id2.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/id2/ID2_Reply_Get_Package.hpp>
+#include <objects/id2/ID2_Params.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CID2_Reply_Get_Package_Base::ResetName(void)
+{
+    m_Name.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CID2_Reply_Get_Package_Base::ResetParams(void)
+{
+    m_Params.Reset();
+}
+
+void CID2_Reply_Get_Package_Base::SetParams(CID2_Reply_Get_Package_Base::TParams& value)
+{
+    m_Params.Reset(&value);
+}
+
+CID2_Reply_Get_Package_Base::TParams& CID2_Reply_Get_Package_Base::SetParams(void)
+{
+    if ( !m_Params )
+        m_Params.Reset(new ncbi::objects::CID2_Params());
+    return (*m_Params);
+}
+
+void CID2_Reply_Get_Package_Base::Reset(void)
+{
+    ResetName();
+    ResetParams();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("ID2-Reply-Get-Package", CID2_Reply_Get_Package)
+{
+    SET_CLASS_MODULE("NCBI-ID2Access");
+    ADD_NAMED_STD_MEMBER("name", m_Name)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("params", m_Params, CID2_Params)->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CID2_Reply_Get_Package_Base::CID2_Reply_Get_Package_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CID2_Reply_Get_Package_Base::~CID2_Reply_Get_Package_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,104 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'id2.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/id2/NCBI_ID2Access_module.hpp>
+#include <objects/id2/ID2S_Reply_Get_Chunk.hpp>
+#include <objects/id2/ID2S_Reply_Get_Split_Info.hpp>
+#include <objects/id2/ID2S_Request_Get_Chunks.hpp>
+#include <objects/id2/ID2_Blob_Id.hpp>
+#include <objects/id2/ID2_Blob_Seq_id.hpp>
+#include <objects/id2/ID2_Blob_Seq_ids.hpp>
+#include <objects/id2/ID2_Error.hpp>
+#include <objects/id2/ID2_Get_Blob_Details.hpp>
+#include <objects/id2/ID2_Param.hpp>
+#include <objects/id2/ID2_Params.hpp>
+#include <objects/id2/ID2_Reply.hpp>
+#include <objects/id2/ID2_Reply_Data.hpp>
+#include <objects/id2/ID2_Reply_Get_Blob.hpp>
+#include <objects/id2/ID2_Reply_Get_Blob_Id.hpp>
+#include <objects/id2/ID2_Reply_Get_Blob_Seq_ids.hpp>
+#include <objects/id2/ID2_Reply_Get_Package.hpp>
+#include <objects/id2/ID2_Reply_Get_Seq_id.hpp>
+#include <objects/id2/ID2_Reply_ReGet_Blob.hpp>
+#include <objects/id2/ID2_Request.hpp>
+#include <objects/id2/ID2_Request_Get_Blob_Id.hpp>
+#include <objects/id2/ID2_Request_Get_Blob_Info.hpp>
+#include <objects/id2/ID2_Request_Get_Packages.hpp>
+#include <objects/id2/ID2_Request_Get_Seq_id.hpp>
+#include <objects/id2/ID2_Request_Packet.hpp>
+#include <objects/id2/ID2_Request_ReGet_Blob.hpp>
+#include <objects/id2/ID2_Seq_id.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_ID2Access_RegisterModuleClasses(void)
+{
+    ncbi::objects::CID2S_Reply_Get_Chunk::GetTypeInfo();
+    ncbi::objects::CID2S_Reply_Get_Split_Info::GetTypeInfo();
+    ncbi::objects::CID2S_Request_Get_Chunks::GetTypeInfo();
+    ncbi::objects::CID2_Blob_Id::GetTypeInfo();
+    ncbi::objects::CID2_Blob_Seq_id::GetTypeInfo();
+    ncbi::objects::CID2_Blob_Seq_ids::GetTypeInfo();
+    ncbi::objects::CID2_Error::GetTypeInfo();
+    ncbi::objects::CID2_Get_Blob_Details::GetTypeInfo();
+    ncbi::objects::CID2_Param::GetTypeInfo();
+    ncbi::objects::CID2_Params::GetTypeInfo();
+    ncbi::objects::CID2_Reply::GetTypeInfo();
+    ncbi::objects::CID2_Reply_Data::GetTypeInfo();
+    ncbi::objects::CID2_Reply_Get_Blob::GetTypeInfo();
+    ncbi::objects::CID2_Reply_Get_Blob_Id::GetTypeInfo();
+    ncbi::objects::CID2_Reply_Get_Blob_Seq_ids::GetTypeInfo();
+    ncbi::objects::CID2_Reply_Get_Package::GetTypeInfo();
+    ncbi::objects::CID2_Reply_Get_Seq_id::GetTypeInfo();
+    ncbi::objects::CID2_Reply_ReGet_Blob::GetTypeInfo();
+    ncbi::objects::CID2_Request::GetTypeInfo();
+    ncbi::objects::CID2_Request_Get_Blob_Id::GetTypeInfo();
+    ncbi::objects::CID2_Request_Get_Blob_Info::GetTypeInfo();
+    ncbi::objects::CID2_Request_Get_Packages::GetTypeInfo();
+    ncbi::objects::CID2_Request_Get_Seq_id::GetTypeInfo();
+    ncbi::objects::CID2_Request_Packet::GetTypeInfo();
+    ncbi::objects::CID2_Request_ReGet_Blob::GetTypeInfo();
+    ncbi::objects::CID2_Seq_id::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
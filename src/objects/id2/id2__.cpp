@@ -0,0 +1,28 @@
+#include <ncbi_pch.hpp>
+#include "ID2S_Reply_Get_Chunk.cpp"
+#include "ID2S_Reply_Get_Split_Info.cpp"
+#include "ID2S_Request_Get_Chunks.cpp"
+#include "ID2_Blob_Id.cpp"
+#include "ID2_Blob_Seq_id.cpp"
+#include "ID2_Blob_Seq_ids.cpp"
+#include "ID2_Blob_State.cpp"
+#include "ID2_Error.cpp"
+#include "ID2_Get_Blob_Details.cpp"
+#include "ID2_Param.cpp"
+#include "ID2_Params.cpp"
+#include "ID2_Reply.cpp"
+#include "ID2_Reply_Data.cpp"
+#include "ID2_Reply_Get_Blob.cpp"
+#include "ID2_Reply_Get_Blob_Id.cpp"
+#include "ID2_Reply_Get_Blob_Seq_ids.cpp"
+#include "ID2_Reply_Get_Package.cpp"
+#include "ID2_Reply_Get_Seq_id.cpp"
+#include "ID2_Reply_ReGet_Blob.cpp"
+#include "ID2_Request.cpp"
+#include "ID2_Request_Get_Blob_Id.cpp"
+#include "ID2_Request_Get_Blob_Info.cpp"
+#include "ID2_Request_Get_Packages.cpp"
+#include "ID2_Request_Get_Seq_id.cpp"
+#include "ID2_Request_Packet.cpp"
+#include "ID2_Request_ReGet_Blob.cpp"
+#include "ID2_Seq_id.cpp"
@@ -0,0 +1,29 @@
+#include <ncbi_pch.hpp>
+#include "ID2S_Reply_Get_Chunk_.cpp"
+#include "ID2S_Reply_Get_Split_Info_.cpp"
+#include "ID2S_Request_Get_Chunks_.cpp"
+#include "ID2_Blob_Id_.cpp"
+#include "ID2_Blob_Seq_id_.cpp"
+#include "ID2_Blob_Seq_ids_.cpp"
+#include "ID2_Blob_State_.cpp"
+#include "ID2_Error_.cpp"
+#include "ID2_Get_Blob_Details_.cpp"
+#include "ID2_Param_.cpp"
+#include "ID2_Params_.cpp"
+#include "ID2_Reply_.cpp"
+#include "ID2_Reply_Data_.cpp"
+#include "ID2_Reply_Get_Blob_.cpp"
+#include "ID2_Reply_Get_Blob_Id_.cpp"
+#include "ID2_Reply_Get_Blob_Seq_ids_.cpp"
+#include "ID2_Reply_Get_Package_.cpp"
+#include "ID2_Reply_Get_Seq_id_.cpp"
+#include "ID2_Reply_ReGet_Blob_.cpp"
+#include "ID2_Request_.cpp"
+#include "ID2_Request_Get_Blob_Id_.cpp"
+#include "ID2_Request_Get_Blob_Info_.cpp"
+#include "ID2_Request_Get_Packages_.cpp"
+#include "ID2_Request_Get_Seq_id_.cpp"
+#include "ID2_Request_Packet_.cpp"
+#include "ID2_Request_ReGet_Blob_.cpp"
+#include "ID2_Seq_id_.cpp"
+#include "NCBI_ID2Access_module.cpp"
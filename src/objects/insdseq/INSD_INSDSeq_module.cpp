@@ -0,0 +1,78 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'insdseq.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/insdseq/INSD_INSDSeq_module.hpp>
+#include <objects/insdseq/INSDAltSeqData.hpp>
+#include <objects/insdseq/INSDAltSeqItem.hpp>
+#include <objects/insdseq/INSDComment.hpp>
+#include <objects/insdseq/INSDFeature.hpp>
+#include <objects/insdseq/INSDFeatureSet.hpp>
+#include <objects/insdseq/INSDInterval.hpp>
+#include <objects/insdseq/INSDQualifier.hpp>
+#include <objects/insdseq/INSDReference.hpp>
+#include <objects/insdseq/INSDSeq.hpp>
+#include <objects/insdseq/INSDSet.hpp>
+#include <objects/insdseq/INSDStrucComment.hpp>
+#include <objects/insdseq/INSDStrucCommentItem.hpp>
+#include <objects/insdseq/INSDXref.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void INSD_INSDSeq_RegisterModuleClasses(void)
+{
+    ncbi::objects::CINSDAltSeqData::GetTypeInfo();
+    ncbi::objects::CINSDAltSeqItem::GetTypeInfo();
+    ncbi::objects::CINSDComment::GetTypeInfo();
+    ncbi::objects::CINSDFeature::GetTypeInfo();
+    ncbi::objects::CINSDFeatureSet::GetTypeInfo();
+    ncbi::objects::CINSDInterval::GetTypeInfo();
+    ncbi::objects::CINSDQualifier::GetTypeInfo();
+    ncbi::objects::CINSDReference::GetTypeInfo();
+    ncbi::objects::CINSDSeq::GetTypeInfo();
+    ncbi::objects::CINSDSet::GetTypeInfo();
+    ncbi::objects::CINSDStrucComment::GetTypeInfo();
+    ncbi::objects::CINSDStrucCommentItem::GetTypeInfo();
+    ncbi::objects::CINSDXref::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,19 @@
+#include <ncbi_pch.hpp>
+#include "INSDAltSeqData.cpp"
+#include "INSDAltSeqItem.cpp"
+#include "INSDAuthor.cpp"
+#include "INSDComment.cpp"
+#include "INSDCommentParagraph.cpp"
+#include "INSDFeature.cpp"
+#include "INSDFeatureSet.cpp"
+#include "INSDInterval.cpp"
+#include "INSDKeyword.cpp"
+#include "INSDQualifier.cpp"
+#include "INSDReference.cpp"
+#include "INSDSecondary_accn.cpp"
+#include "INSDSeq.cpp"
+#include "INSDSeqid.cpp"
+#include "INSDSet.cpp"
+#include "INSDStrucComment.cpp"
+#include "INSDStrucCommentItem.cpp"
+#include "INSDXref.cpp"
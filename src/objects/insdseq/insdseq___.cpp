@@ -0,0 +1,20 @@
+#include <ncbi_pch.hpp>
+#include "INSDAltSeqData_.cpp"
+#include "INSDAltSeqItem_.cpp"
+#include "INSDAuthor_.cpp"
+#include "INSDComment_.cpp"
+#include "INSDCommentParagraph_.cpp"
+#include "INSDFeature_.cpp"
+#include "INSDFeatureSet_.cpp"
+#include "INSDInterval_.cpp"
+#include "INSDKeyword_.cpp"
+#include "INSDQualifier_.cpp"
+#include "INSDReference_.cpp"
+#include "INSDSecondary_accn_.cpp"
+#include "INSDSeq_.cpp"
+#include "INSDSeqid_.cpp"
+#include "INSDSet_.cpp"
+#include "INSDStrucComment_.cpp"
+#include "INSDStrucCommentItem_.cpp"
+#include "INSDXref_.cpp"
+#include "INSD_INSDSeq_module.cpp"
@@ -0,0 +1,92 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Autodef_action.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CAutodef_action_Base::ResetModifiers(void)
+{
+    m_Modifiers.clear();
+    m_set_State[0] &= ~0x3;
+}
+
+void CAutodef_action_Base::Reset(void)
+{
+    ResetModifiers();
+    ResetClause_list_type();
+    ResetMisc_feat_parse_rule();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Autodef-action", CAutodef_action)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_MEMBER("modifiers", m_Modifiers, STL_list_set, (ENUM, (ESource_qual, ESource_qual)))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_ENUM_MEMBER("clause-list-type", m_Clause_list_type, EAutodef_list_type)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_ENUM_MEMBER("misc-feat-parse-rule", m_Misc_feat_parse_rule, EAutodef_misc_feat_parse_rule)->SetDefault(new TMisc_feat_parse_rule(eAutodef_misc_feat_parse_rule_look_for_noncoding_products))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CAutodef_action_Base::CAutodef_action_Base(void)
+    : m_Clause_list_type((ncbi::objects::EAutodef_list_type)(0)), m_Misc_feat_parse_rule(eAutodef_misc_feat_parse_rule_look_for_noncoding_products)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CAutodef_action_Base::~CAutodef_action_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,66 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/CDSGen_featur_type_constra.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("CDSGeneProt-feature-type-constraint", ECDSGeneProt_feature_type_constraint, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("gene", eCDSGeneProt_feature_type_constraint_gene);
+    ADD_ENUM_VALUE("mRNA", eCDSGeneProt_feature_type_constraint_mRNA);
+    ADD_ENUM_VALUE("cds", eCDSGeneProt_feature_type_constraint_cds);
+    ADD_ENUM_VALUE("prot", eCDSGeneProt_feature_type_constraint_prot);
+    ADD_ENUM_VALUE("exon", eCDSGeneProt_feature_type_constraint_exon);
+    ADD_ENUM_VALUE("mat-peptide", eCDSGeneProt_feature_type_constraint_mat_peptide);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
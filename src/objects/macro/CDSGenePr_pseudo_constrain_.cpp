@@ -0,0 +1,84 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/CDSGenePr_pseudo_constrain.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CCDSGeneProt_pseudo_constraint_Base::Reset(void)
+{
+    ResetFeature();
+    ResetIs_pseudo();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("CDSGeneProt-pseudo-constraint", CCDSGeneProt_pseudo_constraint)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_ENUM_MEMBER("feature", m_Feature, ECDSGeneProt_feature_type_constraint)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("is-pseudo", m_Is_pseudo)->SetDefault(new TIs_pseudo(true))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CCDSGeneProt_pseudo_constraint_Base::CCDSGeneProt_pseudo_constraint_Base(void)
+    : m_Feature((ncbi::objects::ECDSGeneProt_feature_type_constraint)(0)), m_Is_pseudo(true)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CCDSGeneProt_pseudo_constraint_Base::~CCDSGeneProt_pseudo_constraint_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,84 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/CDSGeneProt_field.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("CDSGeneProt-field", ECDSGeneProt_field, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("cds-comment", eCDSGeneProt_field_cds_comment);
+    ADD_ENUM_VALUE("gene-locus", eCDSGeneProt_field_gene_locus);
+    ADD_ENUM_VALUE("gene-description", eCDSGeneProt_field_gene_description);
+    ADD_ENUM_VALUE("gene-comment", eCDSGeneProt_field_gene_comment);
+    ADD_ENUM_VALUE("gene-allele", eCDSGeneProt_field_gene_allele);
+    ADD_ENUM_VALUE("gene-maploc", eCDSGeneProt_field_gene_maploc);
+    ADD_ENUM_VALUE("gene-locus-tag", eCDSGeneProt_field_gene_locus_tag);
+    ADD_ENUM_VALUE("gene-synonym", eCDSGeneProt_field_gene_synonym);
+    ADD_ENUM_VALUE("gene-old-locus-tag", eCDSGeneProt_field_gene_old_locus_tag);
+    ADD_ENUM_VALUE("mrna-product", eCDSGeneProt_field_mrna_product);
+    ADD_ENUM_VALUE("mrna-comment", eCDSGeneProt_field_mrna_comment);
+    ADD_ENUM_VALUE("prot-name", eCDSGeneProt_field_prot_name);
+    ADD_ENUM_VALUE("prot-description", eCDSGeneProt_field_prot_description);
+    ADD_ENUM_VALUE("prot-ec-number", eCDSGeneProt_field_prot_ec_number);
+    ADD_ENUM_VALUE("prot-activity", eCDSGeneProt_field_prot_activity);
+    ADD_ENUM_VALUE("prot-comment", eCDSGeneProt_field_prot_comment);
+    ADD_ENUM_VALUE("mat-peptide-name", eCDSGeneProt_field_mat_peptide_name);
+    ADD_ENUM_VALUE("mat-peptide-description", eCDSGeneProt_field_mat_peptide_description);
+    ADD_ENUM_VALUE("mat-peptide-ec-number", eCDSGeneProt_field_mat_peptide_ec_number);
+    ADD_ENUM_VALUE("mat-peptide-activity", eCDSGeneProt_field_mat_peptide_activity);
+    ADD_ENUM_VALUE("mat-peptide-comment", eCDSGeneProt_field_mat_peptide_comment);
+    ADD_ENUM_VALUE("cds-inference", eCDSGeneProt_field_cds_inference);
+    ADD_ENUM_VALUE("gene-inference", eCDSGeneProt_field_gene_inference);
+    ADD_ENUM_VALUE("codon-start", eCDSGeneProt_field_codon_start);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,108 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Convert_action.hpp>
+#include <objects/macro/Field_pair_type.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CConvert_action_Base::ResetFields(void)
+{
+    if ( !m_Fields ) {
+        m_Fields.Reset(new TFields());
+        return;
+    }
+    (*m_Fields).Reset();
+}
+
+void CConvert_action_Base::SetFields(CConvert_action_Base::TFields& value)
+{
+    m_Fields.Reset(&value);
+}
+
+void CConvert_action_Base::Reset(void)
+{
+    ResetFields();
+    ResetStrip_name();
+    ResetKeep_original();
+    ResetCapitalization();
+    ResetExisting_text();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Convert-action", CConvert_action)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_MEMBER("fields", m_Fields, CField_pair_type);
+    ADD_NAMED_STD_MEMBER("strip-name", m_Strip_name)->SetDefault(new TStrip_name(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("keep-original", m_Keep_original)->SetDefault(new TKeep_original(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_ENUM_MEMBER("capitalization", m_Capitalization, ECap_change)->SetDefault(new TCapitalization(eCap_change_none))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_ENUM_MEMBER("existing-text", m_Existing_text, EExistingTextOption)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CConvert_action_Base::CConvert_action_Base(void)
+    : m_Strip_name(false), m_Keep_original(false), m_Capitalization(eCap_change_none), m_Existing_text((ncbi::objects::EExistingTextOption)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetFields();
+    }
+}
+
+// destructor
+CConvert_action_Base::~CConvert_action_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
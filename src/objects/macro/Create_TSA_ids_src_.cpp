@@ -0,0 +1,149 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Create_TSA_ids_src.hpp>
+#include <objects/macro/Text_portion.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CCreate_TSA_ids_src_Base::Reset(void)
+{
+    if ( m_choice != e_not_set )
+        ResetSelection();
+}
+
+void CCreate_TSA_ids_src_Base::ResetSelection(void)
+{
+    switch ( m_choice ) {
+    case e_Defline:
+        m_object->RemoveReference();
+        break;
+    default:
+        break;
+    }
+    m_choice = e_not_set;
+}
+
+void CCreate_TSA_ids_src_Base::DoSelect(E_Choice index, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    switch ( index ) {
+    case e_Defline:
+        (m_object = new(pool) ncbi::objects::CText_portion())->AddReference();
+        break;
+    default:
+        break;
+    }
+    m_choice = index;
+}
+
+const char* const CCreate_TSA_ids_src_Base::sm_SelectionNames[] = {
+    "not set",
+    "local-id",
+    "defline"
+};
+
+NCBI_NS_STD::string CCreate_TSA_ids_src_Base::SelectionName(E_Choice index)
+{
+    return NCBI_NS_NCBI::CInvalidChoiceSelection::GetName(index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+void CCreate_TSA_ids_src_Base::ThrowInvalidSelection(E_Choice index) const
+{
+    throw NCBI_NS_NCBI::CInvalidChoiceSelection(DIAG_COMPILE_INFO, this, m_choice, index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+const CCreate_TSA_ids_src_Base::TDefline& CCreate_TSA_ids_src_Base::GetDefline(void) const
+{
+    CheckSelected(e_Defline);
+    return *static_cast<const TDefline*>(m_object);
+}
+
+CCreate_TSA_ids_src_Base::TDefline& CCreate_TSA_ids_src_Base::SetDefline(void)
+{
+    Select(e_Defline, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *static_cast<TDefline*>(m_object);
+}
+
+void CCreate_TSA_ids_src_Base::SetDefline(CCreate_TSA_ids_src_Base::TDefline& value)
+{
+    TDefline* ptr = &value;
+    if ( m_choice != e_Defline || m_object != ptr ) {
+        ResetSelection();
+        (m_object = ptr)->AddReference();
+        m_choice = e_Defline;
+    }
+}
+
+// helper methods
+
+// type info
+BEGIN_NAMED_BASE_CHOICE_INFO("Create-TSA-ids-src", CCreate_TSA_ids_src)
+{
+    SET_CHOICE_MODULE("NCBI-Macro");
+    ADD_NAMED_NULL_CHOICE_VARIANT("local-id", null, ());
+    ADD_NAMED_REF_CHOICE_VARIANT("defline", m_object, CText_portion);
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CHOICE_INFO
+
+// constructor
+CCreate_TSA_ids_src_Base::CCreate_TSA_ids_src_Base(void)
+    : m_choice(e_not_set)
+{
+}
+
+// destructor
+CCreate_TSA_ids_src_Base::~CCreate_TSA_ids_src_Base(void)
+{
+    Reset();
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
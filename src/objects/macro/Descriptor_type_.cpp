@@ -0,0 +1,72 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Descriptor_type.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Descriptor-type", EDescriptor_type, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("all", eDescriptor_type_all);
+    ADD_ENUM_VALUE("title", eDescriptor_type_title);
+    ADD_ENUM_VALUE("source", eDescriptor_type_source);
+    ADD_ENUM_VALUE("publication", eDescriptor_type_publication);
+    ADD_ENUM_VALUE("comment", eDescriptor_type_comment);
+    ADD_ENUM_VALUE("genbank", eDescriptor_type_genbank);
+    ADD_ENUM_VALUE("user", eDescriptor_type_user);
+    ADD_ENUM_VALUE("create-date", eDescriptor_type_create_date);
+    ADD_ENUM_VALUE("update-date", eDescriptor_type_update_date);
+    ADD_ENUM_VALUE("mol-info", eDescriptor_type_mol_info);
+    ADD_ENUM_VALUE("structured-comment", eDescriptor_type_structured_comment);
+    ADD_ENUM_VALUE("genome-project-id", eDescriptor_type_genome_project_id);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
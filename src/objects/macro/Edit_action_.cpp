@@ -0,0 +1,117 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Edit_action.hpp>
+#include <objects/macro/Field_edit.hpp>
+#include <objects/macro/Field_type.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CEdit_action_Base::ResetEdit(void)
+{
+    if ( !m_Edit ) {
+        m_Edit.Reset(new TEdit());
+        return;
+    }
+    (*m_Edit).Reset();
+}
+
+void CEdit_action_Base::SetEdit(CEdit_action_Base::TEdit& value)
+{
+    m_Edit.Reset(&value);
+}
+
+void CEdit_action_Base::ResetField(void)
+{
+    if ( !m_Field ) {
+        m_Field.Reset(new TField());
+        return;
+    }
+    (*m_Field).Reset();
+}
+
+void CEdit_action_Base::SetField(CEdit_action_Base::TField& value)
+{
+    m_Field.Reset(&value);
+}
+
+void CEdit_action_Base::Reset(void)
+{
+    ResetEdit();
+    ResetField();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Edit-action", CEdit_action)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_MEMBER("edit", m_Edit, CField_edit);
+    ADD_NAMED_REF_MEMBER("field", m_Field, CField_type);
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CEdit_action_Base::CEdit_action_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetEdit();
+        ResetField();
+    }
+}
+
+// destructor
+CEdit_action_Base::~CEdit_action_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,73 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/ExistingTextOption.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("ExistingTextOption", EExistingTextOption, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("replace-old", eExistingTextOption_replace_old);
+    ADD_ENUM_VALUE("append-semi", eExistingTextOption_append_semi);
+    ADD_ENUM_VALUE("append-space", eExistingTextOption_append_space);
+    ADD_ENUM_VALUE("append-colon", eExistingTextOption_append_colon);
+    ADD_ENUM_VALUE("append-comma", eExistingTextOption_append_comma);
+    ADD_ENUM_VALUE("append-none", eExistingTextOption_append_none);
+    ADD_ENUM_VALUE("prefix-semi", eExistingTextOption_prefix_semi);
+    ADD_ENUM_VALUE("prefix-space", eExistingTextOption_prefix_space);
+    ADD_ENUM_VALUE("prefix-colon", eExistingTextOption_prefix_colon);
+    ADD_ENUM_VALUE("prefix-comma", eExistingTextOption_prefix_comma);
+    ADD_ENUM_VALUE("prefix-none", eExistingTextOption_prefix_none);
+    ADD_ENUM_VALUE("leave-old", eExistingTextOption_leave_old);
+    ADD_ENUM_VALUE("add-qual", eExistingTextOption_add_qual);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,104 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Extend_to_feature.hpp>
+#include <objects/macro/Quantity_constraint.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CExtend_to_feature_Base::ResetDistance(void)
+{
+    m_Distance.Reset();
+}
+
+void CExtend_to_feature_Base::SetDistance(CExtend_to_feature_Base::TDistance& value)
+{
+    m_Distance.Reset(&value);
+}
+
+CExtend_to_feature_Base::TDistance& CExtend_to_feature_Base::SetDistance(void)
+{
+    if ( !m_Distance )
+        m_Distance.Reset(new ncbi::objects::CQuantity_constraint());
+    return (*m_Distance);
+}
+
+void CExtend_to_feature_Base::Reset(void)
+{
+    ResetType();
+    ResetInclude_feat();
+    ResetDistance();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Extend-to-feature", CExtend_to_feature)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_ENUM_MEMBER("type", m_Type, EMacro_feature_type)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("include-feat", m_Include_feat)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("distance", m_Distance, CQuantity_constraint)->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CExtend_to_feature_Base::CExtend_to_feature_Base(void)
+    : m_Type((ncbi::objects::EMacro_feature_type)(0)), m_Include_feat(0)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CExtend_to_feature_Base::~CExtend_to_feature_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
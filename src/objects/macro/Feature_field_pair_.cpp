@@ -0,0 +1,119 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Feature_field_pair.hpp>
+#include <objects/macro/Feat_qual_choice.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CFeature_field_pair_Base::ResetField_from(void)
+{
+    if ( !m_Field_from ) {
+        m_Field_from.Reset(new TField_from());
+        return;
+    }
+    (*m_Field_from).Reset();
+}
+
+void CFeature_field_pair_Base::SetField_from(CFeature_field_pair_Base::TField_from& value)
+{
+    m_Field_from.Reset(&value);
+}
+
+void CFeature_field_pair_Base::ResetField_to(void)
+{
+    if ( !m_Field_to ) {
+        m_Field_to.Reset(new TField_to());
+        return;
+    }
+    (*m_Field_to).Reset();
+}
+
+void CFeature_field_pair_Base::SetField_to(CFeature_field_pair_Base::TField_to& value)
+{
+    m_Field_to.Reset(&value);
+}
+
+void CFeature_field_pair_Base::Reset(void)
+{
+    ResetType();
+    ResetField_from();
+    ResetField_to();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Feature-field-pair", CFeature_field_pair)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_ENUM_MEMBER("type", m_Type, EMacro_feature_type)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("field-from", m_Field_from, CFeat_qual_choice);
+    ADD_NAMED_REF_MEMBER("field-to", m_Field_to, CFeat_qual_choice);
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CFeature_field_pair_Base::CFeature_field_pair_Base(void)
+    : m_Type((ncbi::objects::EMacro_feature_type)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetField_from();
+        ResetField_to();
+    }
+}
+
+// destructor
+CFeature_field_pair_Base::~CFeature_field_pair_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
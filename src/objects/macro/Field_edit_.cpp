@@ -0,0 +1,100 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Field_edit.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CField_edit_Base::ResetFind_txt(void)
+{
+    m_Find_txt.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CField_edit_Base::ResetRepl_txt(void)
+{
+    m_Repl_txt.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CField_edit_Base::Reset(void)
+{
+    ResetFind_txt();
+    ResetRepl_txt();
+    ResetLocation();
+    ResetCase_insensitive();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Field-edit", CField_edit)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_STD_MEMBER("find-txt", m_Find_txt)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("repl-txt", m_Repl_txt)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_ENUM_MEMBER("location", m_Location, EField_edit_location)->SetDefault(new TLocation(eField_edit_location_anywhere))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("case-insensitive", m_Case_insensitive)->SetDefault(new TCase_insensitive(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CField_edit_Base::CField_edit_Base(void)
+    : m_Location(eField_edit_location_anywhere), m_Case_insensitive(false)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CField_edit_Base::~CField_edit_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
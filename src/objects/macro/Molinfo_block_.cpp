@@ -0,0 +1,138 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Molinfo_block.hpp>
+#include <objects/macro/Constraint_choice_set.hpp>
+#include <objects/macro/Molinfo_field_list.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CMolinfo_block_Base::ResetTo_list(void)
+{
+    if ( !m_To_list ) {
+        m_To_list.Reset(new TTo_list());
+        return;
+    }
+    (*m_To_list).Reset();
+}
+
+void CMolinfo_block_Base::SetTo_list(CMolinfo_block_Base::TTo_list& value)
+{
+    m_To_list.Reset(&value);
+}
+
+void CMolinfo_block_Base::ResetFrom_list(void)
+{
+    m_From_list.Reset();
+}
+
+void CMolinfo_block_Base::SetFrom_list(CMolinfo_block_Base::TFrom_list& value)
+{
+    m_From_list.Reset(&value);
+}
+
+CMolinfo_block_Base::TFrom_list& CMolinfo_block_Base::SetFrom_list(void)
+{
+    if ( !m_From_list )
+        m_From_list.Reset(new ncbi::objects::CMolinfo_field_list());
+    return (*m_From_list);
+}
+
+void CMolinfo_block_Base::ResetConstraint(void)
+{
+    m_Constraint.Reset();
+}
+
+void CMolinfo_block_Base::SetConstraint(CMolinfo_block_Base::TConstraint& value)
+{
+    m_Constraint.Reset(&value);
+}
+
+CMolinfo_block_Base::TConstraint& CMolinfo_block_Base::SetConstraint(void)
+{
+    if ( !m_Constraint )
+        m_Constraint.Reset(new ncbi::objects::CConstraint_choice_set());
+    return (*m_Constraint);
+}
+
+void CMolinfo_block_Base::Reset(void)
+{
+    ResetTo_list();
+    ResetFrom_list();
+    ResetConstraint();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Molinfo-block", CMolinfo_block)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_MEMBER("to-list", m_To_list, CMolinfo_field_list);
+    ADD_NAMED_REF_MEMBER("from-list", m_From_list, CMolinfo_field_list)->SetOptional();
+    ADD_NAMED_REF_MEMBER("constraint", m_Constraint, CConstraint_choice_set)->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CMolinfo_block_Base::CMolinfo_block_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetTo_list();
+    }
+}
+
+// destructor
+CMolinfo_block_Base::~CMolinfo_block_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,102 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Molinfo_field_constraint.hpp>
+#include <objects/macro/Molinfo_field.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CMolinfo_field_constraint_Base::ResetField(void)
+{
+    if ( !m_Field ) {
+        m_Field.Reset(new TField());
+        return;
+    }
+    (*m_Field).Reset();
+}
+
+void CMolinfo_field_constraint_Base::SetField(CMolinfo_field_constraint_Base::TField& value)
+{
+    m_Field.Reset(&value);
+}
+
+void CMolinfo_field_constraint_Base::Reset(void)
+{
+    ResetField();
+    ResetIs_not();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Molinfo-field-constraint", CMolinfo_field_constraint)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_MEMBER("field", m_Field, CMolinfo_field);
+    ADD_NAMED_STD_MEMBER("is-not", m_Is_not)->SetDefault(new TIs_not(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CMolinfo_field_constraint_Base::CMolinfo_field_constraint_Base(void)
+    : m_Is_not(false)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetField();
+    }
+}
+
+// destructor
+CMolinfo_field_constraint_Base::~CMolinfo_field_constraint_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
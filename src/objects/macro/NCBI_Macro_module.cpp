@@ -0,0 +1,310 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/macro/NCBI_Macro_module.hpp>
+#include <objects/macro/AECRParse_action.hpp>
+#include <objects/macro/AECR_action.hpp>
+#include <objects/macro/Action_choice.hpp>
+#include <objects/macro/Add_descriptor_list_action.hpp>
+#include <objects/macro/Add_file_action.hpp>
+#include <objects/macro/Adjus_featu_for_gaps_actio.hpp>
+#include <objects/macro/Apply_action.hpp>
+#include <objects/macro/Apply_feature_action.hpp>
+#include <objects/macro/Apply_table_action.hpp>
+#include <objects/macro/Apply_table_extra_data.hpp>
+#include <objects/macro/Author_fix_action.hpp>
+#include <objects/macro/Autodef_action.hpp>
+#include <objects/macro/Autofix_action.hpp>
+#include <objects/macro/CDSGenePr_constraint_field.hpp>
+#include <objects/macro/CDSGenePr_pseudo_constrain.hpp>
+#include <objects/macro/CDSGenePro_qual_constraint.hpp>
+#include <objects/macro/CDSGeneProt_field_pair.hpp>
+#include <objects/macro/Constraint_choice.hpp>
+#include <objects/macro/Constraint_choice_set.hpp>
+#include <objects/macro/Conver_feature_dst_options.hpp>
+#include <objects/macro/Conver_feature_src_options.hpp>
+#include <objects/macro/Convert_action.hpp>
+#include <objects/macro/Convert_feature_action.hpp>
+#include <objects/macro/Convert_from_CDS_options.hpp>
+#include <objects/macro/Copy_action.hpp>
+#include <objects/macro/Create_TSA_ids_action.hpp>
+#include <objects/macro/Create_TSA_ids_src.hpp>
+#include <objects/macro/DBLink_field_pair.hpp>
+#include <objects/macro/Edit_action.hpp>
+#include <objects/macro/Edit_featur_locatio_action.hpp>
+#include <objects/macro/Edit_location_strand.hpp>
+#include <objects/macro/Extend_to_feature.hpp>
+#include <objects/macro/Feat_qual_choice.hpp>
+#include <objects/macro/Feat_qual_legal_set.hpp>
+#include <objects/macro/Feat_qual_legal_val.hpp>
+#include <objects/macro/Feat_qual_legal_val_choice.hpp>
+#include <objects/macro/Feature_field.hpp>
+#include <objects/macro/Feature_field_legal.hpp>
+#include <objects/macro/Feature_field_pair.hpp>
+#include <objects/macro/Field_constraint.hpp>
+#include <objects/macro/Field_edit.hpp>
+#include <objects/macro/Field_pair_type.hpp>
+#include <objects/macro/Field_type.hpp>
+#include <objects/macro/Fix_author_caps.hpp>
+#include <objects/macro/Fix_caps_action.hpp>
+#include <objects/macro/Fix_format_action.hpp>
+#include <objects/macro/Fix_pub_caps_action.hpp>
+#include <objects/macro/Fix_sets_action.hpp>
+#include <objects/macro/Gene_xref_type.hpp>
+#include <objects/macro/Location_choice.hpp>
+#include <objects/macro/Location_constraint.hpp>
+#include <objects/macro/Location_edit_type.hpp>
+#include <objects/macro/Location_interval.hpp>
+#include <objects/macro/Location_pos_constraint.hpp>
+#include <objects/macro/Macro_action_choice.hpp>
+#include <objects/macro/Macro_action_list.hpp>
+#include <objects/macro/Make_gene_xref_action.hpp>
+#include <objects/macro/Molinfo_block.hpp>
+#include <objects/macro/Molinfo_completedness_pair.hpp>
+#include <objects/macro/Molinfo_field.hpp>
+#include <objects/macro/Molinfo_field_constraint.hpp>
+#include <objects/macro/Molinfo_field_list.hpp>
+#include <objects/macro/Molinfo_field_pair.hpp>
+#include <objects/macro/Molinfo_mol_class_pair.hpp>
+#include <objects/macro/Molinfo_molecule_pair.hpp>
+#include <objects/macro/Molinfo_strand_pair.hpp>
+#include <objects/macro/Molinfo_technique_pair.hpp>
+#include <objects/macro/Molinfo_topology_pair.hpp>
+#include <objects/macro/Parse_action.hpp>
+#include <objects/macro/Parse_dest.hpp>
+#include <objects/macro/Parse_dst_org.hpp>
+#include <objects/macro/Parse_src.hpp>
+#include <objects/macro/Parse_src_general_id.hpp>
+#include <objects/macro/Parse_src_org.hpp>
+#include <objects/macro/Parse_src_org_choice.hpp>
+#include <objects/macro/Partial_3_set_action.hpp>
+#include <objects/macro/Partial_5_set_action.hpp>
+#include <objects/macro/Partial_both_set_action.hpp>
+#include <objects/macro/Pub_field_constraint.hpp>
+#include <objects/macro/Pub_field_speci_const_type.hpp>
+#include <objects/macro/Pub_field_special_constrai.hpp>
+#include <objects/macro/Publication_constraint.hpp>
+#include <objects/macro/Quantity_constraint.hpp>
+#include <objects/macro/Region_type.hpp>
+#include <objects/macro/Remov_duplic_featur_action.hpp>
+#include <objects/macro/Remove_action.hpp>
+#include <objects/macro/Remove_descriptor_action.hpp>
+#include <objects/macro/Remove_feature_action.hpp>
+#include <objects/macro/Remove_outside_action.hpp>
+#include <objects/macro/Remove_sequences_action.hpp>
+#include <objects/macro/Remove_xrefs_action.hpp>
+#include <objects/macro/Replace_func.hpp>
+#include <objects/macro/Replace_rule.hpp>
+#include <objects/macro/Retranslate_cds_action.hpp>
+#include <objects/macro/Rna_feat_type.hpp>
+#include <objects/macro/Rna_qual.hpp>
+#include <objects/macro/Rna_qual_pair.hpp>
+#include <objects/macro/Search_func.hpp>
+#include <objects/macro/Seque_const_mol_type_const.hpp>
+#include <objects/macro/Sequence_constraint.hpp>
+#include <objects/macro/Sequence_list.hpp>
+#include <objects/macro/Sequence_list_choice.hpp>
+#include <objects/macro/Simple_replace.hpp>
+#include <objects/macro/Sort_fields_action.hpp>
+#include <objects/macro/Source_constraint.hpp>
+#include <objects/macro/Source_qual_choice.hpp>
+#include <objects/macro/Source_qual_pair.hpp>
+#include <objects/macro/Source_qual_text_val.hpp>
+#include <objects/macro/Source_qual_val_choice.hpp>
+#include <objects/macro/Source_qual_val_set.hpp>
+#include <objects/macro/String_constraint.hpp>
+#include <objects/macro/String_constraint_set.hpp>
+#include <objects/macro/Structu_comment_field_pair.hpp>
+#include <objects/macro/Structured_comment_field.hpp>
+#include <objects/macro/Suspect_rule.hpp>
+#include <objects/macro/Suspect_rule_set.hpp>
+#include <objects/macro/Swap_action.hpp>
+#include <objects/macro/Table_match.hpp>
+#include <objects/macro/Table_match_type.hpp>
+#include <objects/macro/Text_marker.hpp>
+#include <objects/macro/Text_portion.hpp>
+#include <objects/macro/Text_transform.hpp>
+#include <objects/macro/Text_transform_set.hpp>
+#include <objects/macro/Translation_constraint.hpp>
+#include <objects/macro/Updat_repla_ec_numbe_actio.hpp>
+#include <objects/macro/Update_sequences_action.hpp>
+#include <objects/macro/Word_substitution.hpp>
+#include <objects/macro/Word_substitution_set.hpp>
+#include <objects/macro/Xref_type.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Macro_RegisterModuleClasses(void)
+{
+    ncbi::objects::CAECRParse_action::GetTypeInfo();
+    ncbi::objects::CAECR_action::GetTypeInfo();
+    ncbi::objects::CAction_choice::GetTypeInfo();
+    ncbi::objects::CAdd_descriptor_list_action::GetTypeInfo();
+    ncbi::objects::CAdd_file_action::GetTypeInfo();
+    ncbi::objects::CAdjust_features_for_gaps_action::GetTypeInfo();
+    ncbi::objects::CApply_action::GetTypeInfo();
+    ncbi::objects::CApply_feature_action::GetTypeInfo();
+    ncbi::objects::CApply_table_action::GetTypeInfo();
+    ncbi::objects::CApply_table_extra_data::GetTypeInfo();
+    ncbi::objects::CAuthor_fix_action::GetTypeInfo();
+    ncbi::objects::CAutodef_action::GetTypeInfo();
+    ncbi::objects::CAutofix_action::GetTypeInfo();
+    ncbi::objects::CCDSGeneProt_constraint_field::GetTypeInfo();
+    ncbi::objects::CCDSGeneProt_pseudo_constraint::GetTypeInfo();
+    ncbi::objects::CCDSGeneProt_qual_constraint::GetTypeInfo();
+    ncbi::objects::CCDSGeneProt_field_pair::GetTypeInfo();
+    ncbi::objects::CConstraint_choice::GetTypeInfo();
+    ncbi::objects::CConstraint_choice_set::GetTypeInfo();
+    ncbi::objects::CConvert_feature_dst_options::GetTypeInfo();
+    ncbi::objects::CConvert_feature_src_options::GetTypeInfo();
+    ncbi::objects::CConvert_action::GetTypeInfo();
+    ncbi::objects::CConvert_feature_action::GetTypeInfo();
+    ncbi::objects::CConvert_from_CDS_options::GetTypeInfo();
+    ncbi::objects::CCopy_action::GetTypeInfo();
+    ncbi::objects::CCreate_TSA_ids_action::GetTypeInfo();
+    ncbi::objects::CCreate_TSA_ids_src::GetTypeInfo();
+    ncbi::objects::CDBLink_field_pair::GetTypeInfo();
+    ncbi::objects::CEdit_action::GetTypeInfo();
+    ncbi::objects::CEdit_feature_location_action::GetTypeInfo();
+    ncbi::objects::CEdit_location_strand::GetTypeInfo();
+    ncbi::objects::CExtend_to_feature::GetTypeInfo();
+    ncbi::objects::CFeat_qual_choice::GetTypeInfo();
+    ncbi::objects::CFeat_qual_legal_set::GetTypeInfo();
+    ncbi::objects::CFeat_qual_legal_val::GetTypeInfo();
+    ncbi::objects::CFeat_qual_legal_val_choice::GetTypeInfo();
+    ncbi::objects::CFeature_field::GetTypeInfo();
+    ncbi::objects::CFeature_field_legal::GetTypeInfo();
+    ncbi::objects::CFeature_field_pair::GetTypeInfo();
+    ncbi::objects::CField_constraint::GetTypeInfo();
+    ncbi::objects::CField_edit::GetTypeInfo();
+    ncbi::objects::CField_pair_type::GetTypeInfo();
+    ncbi::objects::CField_type::GetTypeInfo();
+    ncbi::objects::CFix_author_caps::GetTypeInfo();
+    ncbi::objects::CFix_caps_action::GetTypeInfo();
+    ncbi::objects::CFix_format_action::GetTypeInfo();
+    ncbi::objects::CFix_pub_caps_action::GetTypeInfo();
+    ncbi::objects::CFix_sets_action::GetTypeInfo();
+    ncbi::objects::CGene_xref_type::GetTypeInfo();
+    ncbi::objects::CLocation_choice::GetTypeInfo();
+    ncbi::objects::CLocation_constraint::GetTypeInfo();
+    ncbi::objects::CLocation_edit_type::GetTypeInfo();
+    ncbi::objects::CLocation_interval::GetTypeInfo();
+    ncbi::objects::CLocation_pos_constraint::GetTypeInfo();
+    ncbi::objects::CMacro_action_choice::GetTypeInfo();
+    ncbi::objects::CMacro_action_list::GetTypeInfo();
+    ncbi::objects::CMake_gene_xref_action::GetTypeInfo();
+    ncbi::objects::CMolinfo_block::GetTypeInfo();
+    ncbi::objects::CMolinfo_completedness_pair::GetTypeInfo();
+    ncbi::objects::CMolinfo_field::GetTypeInfo();
+    ncbi::objects::CMolinfo_field_constraint::GetTypeInfo();
+    ncbi::objects::CMolinfo_field_list::GetTypeInfo();
+    ncbi::objects::CMolinfo_field_pair::GetTypeInfo();
+    ncbi::objects::CMolinfo_mol_class_pair::GetTypeInfo();
+    ncbi::objects::CMolinfo_molecule_pair::GetTypeInfo();
+    ncbi::objects::CMolinfo_strand_pair::GetTypeInfo();
+    ncbi::objects::CMolinfo_technique_pair::GetTypeInfo();
+    ncbi::objects::CMolinfo_topology_pair::GetTypeInfo();
+    ncbi::objects::CParse_action::GetTypeInfo();
+    ncbi::objects::CParse_dest::GetTypeInfo();
+    ncbi::objects::CParse_dst_org::GetTypeInfo();
+    ncbi::objects::CParse_src::GetTypeInfo();
+    ncbi::objects::CParse_src_general_id::GetTypeInfo();
+    ncbi::objects::CParse_src_org::GetTypeInfo();
+    ncbi::objects::CParse_src_org_choice::GetTypeInfo();
+    ncbi::objects::CPartial_3_set_action::GetTypeInfo();
+    ncbi::objects::CPartial_5_set_action::GetTypeInfo();
+    ncbi::objects::CPartial_both_set_action::GetTypeInfo();
+    ncbi::objects::CPub_field_constraint::GetTypeInfo();
+    ncbi::objects::CPub_field_special_constraint_type::GetTypeInfo();
+    ncbi::objects::CPub_field_special_constraint::GetTypeInfo();
+    ncbi::objects::CPublication_constraint::GetTypeInfo();
+    ncbi::objects::CQuantity_constraint::GetTypeInfo();
+    ncbi::objects::CRegion_type::GetTypeInfo();
+    ncbi::objects::CRemove_duplicate_feature_action::GetTypeInfo();
+    ncbi::objects::CRemove_action::GetTypeInfo();
+    ncbi::objects::CRemove_descriptor_action::GetTypeInfo();
+    ncbi::objects::CRemove_feature_action::GetTypeInfo();
+    ncbi::objects::CRemove_outside_action::GetTypeInfo();
+    ncbi::objects::CRemove_sequences_action::GetTypeInfo();
+    ncbi::objects::CRemove_xrefs_action::GetTypeInfo();
+    ncbi::objects::CReplace_func::GetTypeInfo();
+    ncbi::objects::CReplace_rule::GetTypeInfo();
+    ncbi::objects::CRetranslate_cds_action::GetTypeInfo();
+    ncbi::objects::CRna_feat_type::GetTypeInfo();
+    ncbi::objects::CRna_qual::GetTypeInfo();
+    ncbi::objects::CRna_qual_pair::GetTypeInfo();
+    ncbi::objects::CSearch_func::GetTypeInfo();
+    ncbi::objects::CSequence_constraint_mol_type_constraint::GetTypeInfo();
+    ncbi::objects::CSequence_constraint::GetTypeInfo();
+    ncbi::objects::CSequence_list::GetTypeInfo();
+    ncbi::objects::CSequence_list_choice::GetTypeInfo();
+    ncbi::objects::CSimple_replace::GetTypeInfo();
+    ncbi::objects::CSort_fields_action::GetTypeInfo();
+    ncbi::objects::CSource_constraint::GetTypeInfo();
+    ncbi::objects::CSource_qual_choice::GetTypeInfo();
+    ncbi::objects::CSource_qual_pair::GetTypeInfo();
+    ncbi::objects::CSource_qual_text_val::GetTypeInfo();
+    ncbi::objects::CSource_qual_val_choice::GetTypeInfo();
+    ncbi::objects::CSource_qual_val_set::GetTypeInfo();
+    ncbi::objects::CString_constraint::GetTypeInfo();
+    ncbi::objects::CString_constraint_set::GetTypeInfo();
+    ncbi::objects::CStructured_comment_field_pair::GetTypeInfo();
+    ncbi::objects::CStructured_comment_field::GetTypeInfo();
+    ncbi::objects::CSuspect_rule::GetTypeInfo();
+    ncbi::objects::CSuspect_rule_set::GetTypeInfo();
+    ncbi::objects::CSwap_action::GetTypeInfo();
+    ncbi::objects::CTable_match::GetTypeInfo();
+    ncbi::objects::CTable_match_type::GetTypeInfo();
+    ncbi::objects::CText_marker::GetTypeInfo();
+    ncbi::objects::CText_portion::GetTypeInfo();
+    ncbi::objects::CText_transform::GetTypeInfo();
+    ncbi::objects::CText_transform_set::GetTypeInfo();
+    ncbi::objects::CTranslation_constraint::GetTypeInfo();
+    ncbi::objects::CUpdate_replaced_ec_numbers_action::GetTypeInfo();
+    ncbi::objects::CUpdate_sequences_action::GetTypeInfo();
+    ncbi::objects::CWord_substitution::GetTypeInfo();
+    ncbi::objects::CWord_substitution_set::GetTypeInfo();
+    ncbi::objects::CXref_type::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,122 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Publication_constraint.hpp>
+#include <objects/macro/Pub_field_constraint.hpp>
+#include <objects/macro/Pub_field_special_constrai.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CPublication_constraint_Base::ResetField(void)
+{
+    m_Field.Reset();
+}
+
+void CPublication_constraint_Base::SetField(CPublication_constraint_Base::TField& value)
+{
+    m_Field.Reset(&value);
+}
+
+CPublication_constraint_Base::TField& CPublication_constraint_Base::SetField(void)
+{
+    if ( !m_Field )
+        m_Field.Reset(new ncbi::objects::CPub_field_constraint());
+    return (*m_Field);
+}
+
+void CPublication_constraint_Base::ResetSpecial_field(void)
+{
+    m_Special_field.Reset();
+}
+
+void CPublication_constraint_Base::SetSpecial_field(CPublication_constraint_Base::TSpecial_field& value)
+{
+    m_Special_field.Reset(&value);
+}
+
+CPublication_constraint_Base::TSpecial_field& CPublication_constraint_Base::SetSpecial_field(void)
+{
+    if ( !m_Special_field )
+        m_Special_field.Reset(new ncbi::objects::CPub_field_special_constraint());
+    return (*m_Special_field);
+}
+
+void CPublication_constraint_Base::Reset(void)
+{
+    ResetType();
+    ResetField();
+    ResetSpecial_field();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Publication-constraint", CPublication_constraint)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_ENUM_MEMBER("type", m_Type, EPub_type)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("field", m_Field, CPub_field_constraint)->SetOptional();
+    ADD_NAMED_REF_MEMBER("special-field", m_Special_field, CPub_field_special_constraint)->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CPublication_constraint_Base::CPublication_constraint_Base(void)
+    : m_Type((ncbi::objects::EPub_type)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CPublication_constraint_Base::~CPublication_constraint_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
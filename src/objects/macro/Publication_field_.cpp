@@ -0,0 +1,82 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Publication_field.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Publication-field", EPublication_field, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("cit", ePublication_field_cit);
+    ADD_ENUM_VALUE("authors", ePublication_field_authors);
+    ADD_ENUM_VALUE("journal", ePublication_field_journal);
+    ADD_ENUM_VALUE("volume", ePublication_field_volume);
+    ADD_ENUM_VALUE("issue", ePublication_field_issue);
+    ADD_ENUM_VALUE("pages", ePublication_field_pages);
+    ADD_ENUM_VALUE("date", ePublication_field_date);
+    ADD_ENUM_VALUE("serial-number", ePublication_field_serial_number);
+    ADD_ENUM_VALUE("title", ePublication_field_title);
+    ADD_ENUM_VALUE("affiliation", ePublication_field_affiliation);
+    ADD_ENUM_VALUE("affil-div", ePublication_field_affil_div);
+    ADD_ENUM_VALUE("affil-city", ePublication_field_affil_city);
+    ADD_ENUM_VALUE("affil-sub", ePublication_field_affil_sub);
+    ADD_ENUM_VALUE("affil-country", ePublication_field_affil_country);
+    ADD_ENUM_VALUE("affil-street", ePublication_field_affil_street);
+    ADD_ENUM_VALUE("affil-email", ePublication_field_affil_email);
+    ADD_ENUM_VALUE("affil-fax", ePublication_field_affil_fax);
+    ADD_ENUM_VALUE("affil-phone", ePublication_field_affil_phone);
+    ADD_ENUM_VALUE("affil-zipcode", ePublication_field_affil_zipcode);
+    ADD_ENUM_VALUE("authors-initials", ePublication_field_authors_initials);
+    ADD_ENUM_VALUE("pmid", ePublication_field_pmid);
+    ADD_ENUM_VALUE("pub-class", ePublication_field_pub_class);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,161 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Replace_func.hpp>
+#include <objects/macro/Simple_replace.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CReplace_func_Base::Reset(void)
+{
+    if ( m_choice != e_not_set )
+        ResetSelection();
+}
+
+void CReplace_func_Base::ResetSelection(void)
+{
+    switch ( m_choice ) {
+    case e_Haem_replace:
+        m_string.Destruct();
+        break;
+    case e_Simple_replace:
+        m_object->RemoveReference();
+        break;
+    default:
+        break;
+    }
+    m_choice = e_not_set;
+}
+
+void CReplace_func_Base::DoSelect(E_Choice index, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    switch ( index ) {
+    case e_Simple_replace:
+        (m_object = new(pool) ncbi::objects::CSimple_replace())->AddReference();
+        break;
+    case e_Haem_replace:
+        m_string.Construct();
+        break;
+    default:
+        break;
+    }
+    m_choice = index;
+}
+
+const char* const CReplace_func_Base::sm_SelectionNames[] = {
+    "not set",
+    "simple-replace",
+    "haem-replace"
+};
+
+NCBI_NS_STD::string CReplace_func_Base::SelectionName(E_Choice index)
+{
+    return NCBI_NS_NCBI::CInvalidChoiceSelection::GetName(index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+void CReplace_func_Base::ThrowInvalidSelection(E_Choice index) const
+{
+    throw NCBI_NS_NCBI::CInvalidChoiceSelection(DIAG_COMPILE_INFO, this, m_choice, index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+const CReplace_func_Base::TSimple_replace& CReplace_func_Base::GetSimple_replace(void) const
+{
+    CheckSelected(e_Simple_replace);
+    return *static_cast<const TSimple_replace*>(m_object);
+}
+
+CReplace_func_Base::TSimple_replace& CReplace_func_Base::SetSimple_replace(void)
+{
+    Select(e_Simple_replace, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *static_cast<TSimple_replace*>(m_object);
+}
+
+void CReplace_func_Base::SetSimple_replace(CReplace_func_Base::TSimple_replace& value)
+{
+    TSimple_replace* ptr = &value;
+    if ( m_choice != e_Simple_replace || m_object != ptr ) {
+        ResetSelection();
+        (m_object = ptr)->AddReference();
+        m_choice = e_Simple_replace;
+    }
+}
+
+void CReplace_func_Base::SetHaem_replace(const CReplace_func_Base::THaem_replace& value)
+{
+    Select(e_Haem_replace, NCBI_NS_NCBI::eDoNotResetVariant);
+    *m_string = value;
+}
+
+// helper methods
+
+// type info
+BEGIN_NAMED_BASE_CHOICE_INFO("Replace-func", CReplace_func)
+{
+    SET_CHOICE_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_CHOICE_VARIANT("simple-replace", m_object, CSimple_replace);
+    ADD_NAMED_BUF_CHOICE_VARIANT("haem-replace", m_string, STD, (string));
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CHOICE_INFO
+
+// constructor
+CReplace_func_Base::CReplace_func_Base(void)
+    : m_choice(e_not_set)
+{
+}
+
+// destructor
+CReplace_func_Base::~CReplace_func_Base(void)
+{
+    Reset();
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,102 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Replace_rule.hpp>
+#include <objects/macro/Replace_func.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CReplace_rule_Base::ResetReplace_func(void)
+{
+    if ( !m_Replace_func ) {
+        m_Replace_func.Reset(new TReplace_func());
+        return;
+    }
+    (*m_Replace_func).Reset();
+}
+
+void CReplace_rule_Base::SetReplace_func(CReplace_rule_Base::TReplace_func& value)
+{
+    m_Replace_func.Reset(&value);
+}
+
+void CReplace_rule_Base::Reset(void)
+{
+    ResetReplace_func();
+    ResetMove_to_note();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Replace-rule", CReplace_rule)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_MEMBER("replace-func", m_Replace_func, CReplace_func);
+    ADD_NAMED_STD_MEMBER("move-to-note", m_Move_to_note)->SetDefault(new TMove_to_note(false))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CReplace_rule_Base::CReplace_rule_Base(void)
+    : m_Move_to_note(false)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetReplace_func();
+    }
+}
+
+// destructor
+CReplace_rule_Base::~CReplace_rule_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,73 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Rna_field.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Rna-field", ERna_field, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("product", eRna_field_product);
+    ADD_ENUM_VALUE("comment", eRna_field_comment);
+    ADD_ENUM_VALUE("codons-recognized", eRna_field_codons_recognized);
+    ADD_ENUM_VALUE("ncrna-class", eRna_field_ncrna_class);
+    ADD_ENUM_VALUE("anticodon", eRna_field_anticodon);
+    ADD_ENUM_VALUE("transcript-id", eRna_field_transcript_id);
+    ADD_ENUM_VALUE("gene-locus", eRna_field_gene_locus);
+    ADD_ENUM_VALUE("gene-description", eRna_field_gene_description);
+    ADD_ENUM_VALUE("gene-maploc", eRna_field_gene_maploc);
+    ADD_ENUM_VALUE("gene-locus-tag", eRna_field_gene_locus_tag);
+    ADD_ENUM_VALUE("gene-synonym", eRna_field_gene_synonym);
+    ADD_ENUM_VALUE("gene-comment", eRna_field_gene_comment);
+    ADD_ENUM_VALUE("tag-peptide", eRna_field_tag_peptide);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
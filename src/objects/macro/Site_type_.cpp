@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Site_type.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Site-type", ESite_type, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("active", eSite_type_active);
+    ADD_ENUM_VALUE("binding", eSite_type_binding);
+    ADD_ENUM_VALUE("cleavage", eSite_type_cleavage);
+    ADD_ENUM_VALUE("inhibit", eSite_type_inhibit);
+    ADD_ENUM_VALUE("modified", eSite_type_modified);
+    ADD_ENUM_VALUE("glycosylation", eSite_type_glycosylation);
+    ADD_ENUM_VALUE("myristoylation", eSite_type_myristoylation);
+    ADD_ENUM_VALUE("mutagenized", eSite_type_mutagenized);
+    ADD_ENUM_VALUE("metal-binding", eSite_type_metal_binding);
+    ADD_ENUM_VALUE("phosphorylation", eSite_type_phosphorylation);
+    ADD_ENUM_VALUE("acetylation", eSite_type_acetylation);
+    ADD_ENUM_VALUE("amidation", eSite_type_amidation);
+    ADD_ENUM_VALUE("methylation", eSite_type_methylation);
+    ADD_ENUM_VALUE("hydroxylation", eSite_type_hydroxylation);
+    ADD_ENUM_VALUE("sulfatation", eSite_type_sulfatation);
+    ADD_ENUM_VALUE("oxidative-deamination", eSite_type_oxidative_deamination);
+    ADD_ENUM_VALUE("pyrrolidone-carboxylic-acid", eSite_type_pyrrolidone_carboxylic_acid);
+    ADD_ENUM_VALUE("gamma-carboxyglutamic-acid", eSite_type_gamma_carboxyglutamic_acid);
+    ADD_ENUM_VALUE("blocked", eSite_type_blocked);
+    ADD_ENUM_VALUE("lipid-binding", eSite_type_lipid_binding);
+    ADD_ENUM_VALUE("np-binding", eSite_type_np_binding);
+    ADD_ENUM_VALUE("dna-binding", eSite_type_dna_binding);
+    ADD_ENUM_VALUE("signal-peptide", eSite_type_signal_peptide);
+    ADD_ENUM_VALUE("transit-peptide", eSite_type_transit_peptide);
+    ADD_ENUM_VALUE("transmembrane-region", eSite_type_transmembrane_region);
+    ADD_ENUM_VALUE("nitrosylation", eSite_type_nitrosylation);
+    ADD_ENUM_VALUE("other", eSite_type_other);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,141 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Source_constraint.hpp>
+#include <objects/macro/Source_qual_choice.hpp>
+#include <objects/macro/String_constraint.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CSource_constraint_Base::ResetField1(void)
+{
+    m_Field1.Reset();
+}
+
+void CSource_constraint_Base::SetField1(CSource_constraint_Base::TField1& value)
+{
+    m_Field1.Reset(&value);
+}
+
+CSource_constraint_Base::TField1& CSource_constraint_Base::SetField1(void)
+{
+    if ( !m_Field1 )
+        m_Field1.Reset(new ncbi::objects::CSource_qual_choice());
+    return (*m_Field1);
+}
+
+void CSource_constraint_Base::ResetField2(void)
+{
+    m_Field2.Reset();
+}
+
+void CSource_constraint_Base::SetField2(CSource_constraint_Base::TField2& value)
+{
+    m_Field2.Reset(&value);
+}
+
+CSource_constraint_Base::TField2& CSource_constraint_Base::SetField2(void)
+{
+    if ( !m_Field2 )
+        m_Field2.Reset(new ncbi::objects::CSource_qual_choice());
+    return (*m_Field2);
+}
+
+void CSource_constraint_Base::ResetConstraint(void)
+{
+    m_Constraint.Reset();
+}
+
+void CSource_constraint_Base::SetConstraint(CSource_constraint_Base::TConstraint& value)
+{
+    m_Constraint.Reset(&value);
+}
+
+CSource_constraint_Base::TConstraint& CSource_constraint_Base::SetConstraint(void)
+{
+    if ( !m_Constraint )
+        m_Constraint.Reset(new ncbi::objects::CString_constraint());
+    return (*m_Constraint);
+}
+
+void CSource_constraint_Base::Reset(void)
+{
+    ResetField1();
+    ResetField2();
+    ResetConstraint();
+    ResetType_constraint();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Source-constraint", CSource_constraint)
+{
+    SET_CLASS_MODULE("NCBI-Macro");
+    ADD_NAMED_REF_MEMBER("field1", m_Field1, CSource_qual_choice)->SetOptional();
+    ADD_NAMED_REF_MEMBER("field2", m_Field2, CSource_qual_choice)->SetOptional();
+    ADD_NAMED_REF_MEMBER("constraint", m_Constraint, CString_constraint)->SetOptional();
+    ADD_NAMED_ENUM_MEMBER("type-constraint", m_Type_constraint, EObject_type_constraint)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CSource_constraint_Base::CSource_constraint_Base(void)
+    : m_Type_constraint((ncbi::objects::EObject_type_constraint)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CSource_constraint_Base::~CSource_constraint_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,86 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'macro.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/macro/Technique_type.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Technique-type", ETechnique_type, false)
+{
+    SET_ENUM_MODULE("NCBI-Macro");
+    ADD_ENUM_VALUE("unknown", eTechnique_type_unknown);
+    ADD_ENUM_VALUE("standard", eTechnique_type_standard);
+    ADD_ENUM_VALUE("est", eTechnique_type_est);
+    ADD_ENUM_VALUE("sts", eTechnique_type_sts);
+    ADD_ENUM_VALUE("survey", eTechnique_type_survey);
+    ADD_ENUM_VALUE("genetic-map", eTechnique_type_genetic_map);
+    ADD_ENUM_VALUE("physical-map", eTechnique_type_physical_map);
+    ADD_ENUM_VALUE("derived", eTechnique_type_derived);
+    ADD_ENUM_VALUE("concept-trans", eTechnique_type_concept_trans);
+    ADD_ENUM_VALUE("seq-pept", eTechnique_type_seq_pept);
+    ADD_ENUM_VALUE("both", eTechnique_type_both);
+    ADD_ENUM_VALUE("seq-pept-overlap", eTechnique_type_seq_pept_overlap);
+    ADD_ENUM_VALUE("seq-pept-homol", eTechnique_type_seq_pept_homol);
+    ADD_ENUM_VALUE("concept-trans-a", eTechnique_type_concept_trans_a);
+    ADD_ENUM_VALUE("htgs-1", eTechnique_type_htgs_1);
+    ADD_ENUM_VALUE("htgs-2", eTechnique_type_htgs_2);
+    ADD_ENUM_VALUE("htgs-3", eTechnique_type_htgs_3);
+    ADD_ENUM_VALUE("fli-cDNA", eTechnique_type_fli_cDNA);
+    ADD_ENUM_VALUE("htgs-0", eTechnique_type_htgs_0);
+    ADD_ENUM_VALUE("htc", eTechnique_type_htc);
+    ADD_ENUM_VALUE("wgs", eTechnique_type_wgs);
+    ADD_ENUM_VALUE("barcode", eTechnique_type_barcode);
+    ADD_ENUM_VALUE("composite-wgs-htgs", eTechnique_type_composite_wgs_htgs);
+    ADD_ENUM_VALUE("tsa", eTechnique_type_tsa);
+    ADD_ENUM_VALUE("targeted", eTechnique_type_targeted);
+    ADD_ENUM_VALUE("other", eTechnique_type_other);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,181 @@
+#include <ncbi_pch.hpp>
+#include "AECRParse_action_.cpp"
+#include "AECR_action_.cpp"
+#include "Action_choice_.cpp"
+#include "Add_descriptor_list_action_.cpp"
+#include "Add_file_action_.cpp"
+#include "Adjus_featu_for_gaps_actio_.cpp"
+#include "Apply_action_.cpp"
+#include "Apply_feature_action_.cpp"
+#include "Apply_table_action_.cpp"
+#include "Apply_table_extra_data_.cpp"
+#include "Author_fix_action_.cpp"
+#include "Author_fix_type_.cpp"
+#include "Autod_misc_feat_parse_rule_.cpp"
+#include "Autodef_action_.cpp"
+#include "Autodef_list_type_.cpp"
+#include "Autofix_action_.cpp"
+#include "Bond_type_.cpp"
+#include "CDSGen_featur_type_constra_.cpp"
+#include "CDSGenePr_constraint_field_.cpp"
+#include "CDSGenePr_pseudo_constrain_.cpp"
+#include "CDSGenePro_qual_constraint_.cpp"
+#include "CDSGeneProt_field_.cpp"
+#include "CDSGeneProt_field_pair_.cpp"
+#include "Cap_change_.cpp"
+#include "Completedness_type_.cpp"
+#include "Constraint_choice_.cpp"
+#include "Constraint_choice_set_.cpp"
+#include "Conver_feature_dst_options_.cpp"
+#include "Conver_feature_src_options_.cpp"
+#include "Convert_action_.cpp"
+#include "Convert_feature_action_.cpp"
+#include "Convert_from_CDS_options_.cpp"
+#include "Convert_location_type_.cpp"
+#include "Copy_action_.cpp"
+#include "Create_TSA_ids_action_.cpp"
+#include "Create_TSA_ids_src_.cpp"
+#include "DBLink_field_pair_.cpp"
+#include "DBLink_field_type_.cpp"
+#include "Descriptor_type_.cpp"
+#include "Edit_action_.cpp"
+#include "Edit_featur_locatio_action_.cpp"
+#include "Edit_location_strand_.cpp"
+#include "ExistingTextOption_.cpp"
+#include "Extend_to_feature_.cpp"
+#include "Feat_qual_choice_.cpp"
+#include "Feat_qual_legal_.cpp"
+#include "Feat_qual_legal_set_.cpp"
+#include "Feat_qual_legal_val_.cpp"
+#include "Feat_qual_legal_val_choice_.cpp"
+#include "Featur_locatio_strand_from_.cpp"
+#include "Feature_field_.cpp"
+#include "Feature_field_legal_.cpp"
+#include "Feature_field_pair_.cpp"
+#include "Feature_location_strand_to_.cpp"
+#include "Feature_stranded_constrain_.cpp"
+#include "Field_constraint_.cpp"
+#include "Field_edit_.cpp"
+#include "Field_edit_location_.cpp"
+#include "Field_pair_type_.cpp"
+#include "Field_type_.cpp"
+#include "Fix_author_caps_.cpp"
+#include "Fix_caps_action_.cpp"
+#include "Fix_format_action_.cpp"
+#include "Fix_pub_caps_action_.cpp"
+#include "Fix_sets_action_.cpp"
+#include "Fix_type_.cpp"
+#include "Gene_xref_necessary_type_.cpp"
+#include "Gene_xref_suppression_type_.cpp"
+#include "Gene_xref_type_.cpp"
+#include "Location_choice_.cpp"
+#include "Location_constraint_.cpp"
+#include "Location_edit_type_.cpp"
+#include "Location_interval_.cpp"
+#include "Location_pos_constraint_.cpp"
+#include "Location_type_constraint_.cpp"
+#include "Macro_action_choice_.cpp"
+#include "Macro_action_list_.cpp"
+#include "Macro_feature_type_.cpp"
+#include "Make_gene_xref_action_.cpp"
+#include "Match_type_constraint_.cpp"
+#include "Misc_field_.cpp"
+#include "Molecule_class_type_.cpp"
+#include "Molecule_type_.cpp"
+#include "Molinfo_block_.cpp"
+#include "Molinfo_completedness_pair_.cpp"
+#include "Molinfo_field_.cpp"
+#include "Molinfo_field_constraint_.cpp"
+#include "Molinfo_field_list_.cpp"
+#include "Molinfo_field_pair_.cpp"
+#include "Molinfo_mol_class_pair_.cpp"
+#include "Molinfo_molecule_pair_.cpp"
+#include "Molinfo_strand_pair_.cpp"
+#include "Molinfo_technique_pair_.cpp"
+#include "Molinfo_topology_pair_.cpp"
+#include "Object_type_constraint_.cpp"
+#include "Parse_action_.cpp"
+#include "Parse_dest_.cpp"
+#include "Parse_dst_org_.cpp"
+#include "Parse_src_.cpp"
+#include "Parse_src_general_id_.cpp"
+#include "Parse_src_org_.cpp"
+#include "Parse_src_org_choice_.cpp"
+#include "Partial_3_clear_constraint_.cpp"
+#include "Partial_3_set_action_.cpp"
+#include "Partial_3_set_constraint_.cpp"
+#include "Partial_5_clear_constraint_.cpp"
+#include "Partial_5_set_action_.cpp"
+#include "Partial_5_set_constraint_.cpp"
+#include "Partial_both_clear_constra_.cpp"
+#include "Partial_both_set_action_.cpp"
+#include "Partial_both_set_constrain_.cpp"
+#include "Partial_constraint_.cpp"
+#include "Pub_field_constraint_.cpp"
+#include "Pub_field_speci_const_type_.cpp"
+#include "Pub_field_special_constrai_.cpp"
+#include "Pub_type_.cpp"
+#include "Publication_constraint_.cpp"
+#include "Publication_field_.cpp"
+#include "Quantity_constraint_.cpp"
+#include "Region_type_.cpp"
+#include "Remov_duplic_featur_action_.cpp"
+#include "Remove_action_.cpp"
+#include "Remove_descriptor_action_.cpp"
+#include "Remove_feature_action_.cpp"
+#include "Remove_outside_action_.cpp"
+#include "Remove_sequences_action_.cpp"
+#include "Remove_xrefs_action_.cpp"
+#include "Replace_func_.cpp"
+#include "Replace_rule_.cpp"
+#include "Retranslate_cds_action_.cpp"
+#include "Rna_feat_type_.cpp"
+#include "Rna_field_.cpp"
+#include "Rna_qual_.cpp"
+#include "Rna_qual_pair_.cpp"
+#include "Search_func_.cpp"
+#include "Seqtype_constraint_.cpp"
+#include "Seque_const_mol_type_const_.cpp"
+#include "Sequence_constraint_.cpp"
+#include "Sequence_constraint_rnamol_.cpp"
+#include "Sequence_list_.cpp"
+#include "Sequence_list_choice_.cpp"
+#include "Simple_replace_.cpp"
+#include "Site_type_.cpp"
+#include "Sort_fields_action_.cpp"
+#include "Sort_order_.cpp"
+#include "Source_constraint_.cpp"
+#include "Source_location_.cpp"
+#include "Source_origin_.cpp"
+#include "Source_qual_.cpp"
+#include "Source_qual_choice_.cpp"
+#include "Source_qual_pair_.cpp"
+#include "Source_qual_text_val_.cpp"
+#include "Source_qual_val_choice_.cpp"
+#include "Source_qual_val_set_.cpp"
+#include "Strand_constraint_.cpp"
+#include "Strand_type_.cpp"
+#include "String_constraint_.cpp"
+#include "String_constraint_set_.cpp"
+#include "String_location_.cpp"
+#include "Structu_comment_field_pair_.cpp"
+#include "Structured_comment_field_.cpp"
+#include "Suspect_rule_.cpp"
+#include "Suspect_rule_set_.cpp"
+#include "Swap_action_.cpp"
+#include "Table_match_.cpp"
+#include "Table_match_type_.cpp"
+#include "Technique_type_.cpp"
+#include "Text_marker_.cpp"
+#include "Text_portion_.cpp"
+#include "Text_transform_.cpp"
+#include "Text_transform_set_.cpp"
+#include "Topology_type_.cpp"
+#include "Translation_constraint_.cpp"
+#include "Truncate_ends_partial_type_.cpp"
+#include "Updat_repla_ec_numbe_actio_.cpp"
+#include "Update_sequences_action_.cpp"
+#include "Word_substitution_.cpp"
+#include "Word_substitution_set_.cpp"
+#include "Xref_type_.cpp"
+#include "NCBI_Macro_module.cpp"
@@ -0,0 +1,8 @@
+#include <ncbi_pch.hpp>
+#include "DocRef.cpp"
+#include "Medline_entry.cpp"
+#include "Medline_field.cpp"
+#include "Medline_mesh.cpp"
+#include "Medline_qual.cpp"
+#include "Medline_rn.cpp"
+#include "Medline_si.cpp"
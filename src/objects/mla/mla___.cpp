@@ -0,0 +1,8 @@
+#include <ncbi_pch.hpp>
+#include "Error_val_.cpp"
+#include "Mla_back_.cpp"
+#include "Mla_request_.cpp"
+#include "Title_msg_.cpp"
+#include "Title_msg_list_.cpp"
+#include "Title_type_.cpp"
+#include "NCBI_MedArchive_module.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "Pub.cpp"
+#include "Pub_equiv.cpp"
+#include "Pub_set.cpp"
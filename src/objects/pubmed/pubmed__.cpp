@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "Pubmed_entry.cpp"
+#include "Pubmed_url.cpp"
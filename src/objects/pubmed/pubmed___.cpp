@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "Pubmed_entry_.cpp"
+#include "Pubmed_url_.cpp"
+#include "NCBI_PubMed_module.cpp"
@@ -0,0 +1,14 @@
+#include <ncbi_pch.hpp>
+#include "BlockProperty_.cpp"
+#include "CoreBlock_.cpp"
+#include "CoreDef_.cpp"
+#include "FormatRpsDbParameters_.cpp"
+#include "LoopConstraint_.cpp"
+#include "Pssm_.cpp"
+#include "PssmFinalData_.cpp"
+#include "PssmIntermediateData_.cpp"
+#include "PssmParameters_.cpp"
+#include "PssmWithParameters_.cpp"
+#include "Site_annot_.cpp"
+#include "Site_annot_set_.cpp"
+#include "NCBI_ScoreMat_module.cpp"
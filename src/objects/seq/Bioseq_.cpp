@@ -0,0 +1,137 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seq.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seq/Bioseq.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seq/Seq_descr.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seqloc/Seq_id.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CBioseq_Base::ResetId(void)
+{
+    m_Id.clear();
+    m_set_State[0] &= ~0x3;
+}
+
+void CBioseq_Base::ResetDescr(void)
+{
+    m_Descr.Reset();
+}
+
+void CBioseq_Base::SetDescr(CBioseq_Base::TDescr& value)
+{
+    m_Descr.Reset(&value);
+}
+
+CBioseq_Base::TDescr& CBioseq_Base::SetDescr(void)
+{
+    if ( !m_Descr )
+        m_Descr.Reset(new ncbi::objects::CSeq_descr());
+    return (*m_Descr);
+}
+
+void CBioseq_Base::ResetInst(void)
+{
+    if ( !m_Inst ) {
+        m_Inst.Reset(new TInst());
+        return;
+    }
+    (*m_Inst).Reset();
+}
+
+void CBioseq_Base::SetInst(CBioseq_Base::TInst& value)
+{
+    m_Inst.Reset(&value);
+}
+
+void CBioseq_Base::ResetAnnot(void)
+{
+    m_Annot.clear();
+    m_set_State[0] &= ~0xc0;
+}
+
+void CBioseq_Base::Reset(void)
+{
+    ResetId();
+    ResetDescr();
+    ResetInst();
+    ResetAnnot();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Bioseq", CBioseq)
+{
+    SET_CLASS_MODULE("NCBI-Sequence");
+    ADD_NAMED_MEMBER("id", m_Id, STL_list_set, (STL_CRef, (CLASS, (CSeq_id))))->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("descr", m_Descr, CSeq_descr)->SetOptional();
+    ADD_NAMED_REF_MEMBER("inst", m_Inst, CSeq_inst);
+    ADD_NAMED_MEMBER("annot", m_Annot, STL_list_set, (STL_CRef, (CLASS, (CSeq_annot))))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CBioseq_Base::CBioseq_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetInst();
+    }
+}
+
+// destructor
+CBioseq_Base::~CBioseq_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,45 @@
+#include <ncbi_pch.hpp>
+#include "Align_def_.cpp"
+#include "Annot_descr_.cpp"
+#include "Annot_id_.cpp"
+#include "Annotdesc_.cpp"
+#include "Bioseq_.cpp"
+#include "Delta_ext_.cpp"
+#include "Delta_seq_.cpp"
+#include "GIBB_method_.cpp"
+#include "GIBB_mod_.cpp"
+#include "GIBB_mol_.cpp"
+#include "Heterogen_.cpp"
+#include "IUPACaa_.cpp"
+#include "IUPACna_.cpp"
+#include "Linkage_evidence_.cpp"
+#include "Map_ext_.cpp"
+#include "MolInfo_.cpp"
+#include "NCBI2na_.cpp"
+#include "NCBI4na_.cpp"
+#include "NCBI8aa_.cpp"
+#include "NCBI8na_.cpp"
+#include "NCBIeaa_.cpp"
+#include "NCBIpaa_.cpp"
+#include "NCBIpna_.cpp"
+#include "NCBIstdaa_.cpp"
+#include "Num_cont_.cpp"
+#include "Num_enum_.cpp"
+#include "Num_real_.cpp"
+#include "Num_ref_.cpp"
+#include "Numbering_.cpp"
+#include "Pubdesc_.cpp"
+#include "Ref_ext_.cpp"
+#include "Seg_ext_.cpp"
+#include "Seq_annot_.cpp"
+#include "Seq_data_.cpp"
+#include "Seq_descr_.cpp"
+#include "Seq_ext_.cpp"
+#include "Seq_gap_.cpp"
+#include "Seq_hist_.cpp"
+#include "Seq_hist_rec_.cpp"
+#include "Seq_inst_.cpp"
+#include "Seq_literal_.cpp"
+#include "Seqdesc_.cpp"
+#include "Textannot_id_.cpp"
+#include "NCBI_Sequence_module.cpp"
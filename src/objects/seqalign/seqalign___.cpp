@@ -0,0 +1,20 @@
+#include <ncbi_pch.hpp>
+#include "Dense_diag_.cpp"
+#include "Dense_seg_.cpp"
+#include "Packed_seg_.cpp"
+#include "Product_pos_.cpp"
+#include "Prot_pos_.cpp"
+#include "Score_.cpp"
+#include "Score_set_.cpp"
+#include "Seq_align_.cpp"
+#include "Seq_align_set_.cpp"
+#include "Sparse_align_.cpp"
+#include "Sparse_seg_.cpp"
+#include "Sparse_seg_ext_.cpp"
+#include "Splice_site_.cpp"
+#include "Spliced_exon_.cpp"
+#include "Spliced_exon_chunk_.cpp"
+#include "Spliced_seg_.cpp"
+#include "Spliced_seg_modifier_.cpp"
+#include "Std_seg_.cpp"
+#include "NCBI_Seqalign_module.cpp"
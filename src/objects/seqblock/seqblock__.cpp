@@ -0,0 +1,11 @@
+#include <ncbi_pch.hpp>
+#include "EMBL_block.cpp"
+#include "EMBL_dbname.cpp"
+#include "EMBL_xref.cpp"
+#include "GB_block.cpp"
+#include "PDB_block.cpp"
+#include "PDB_replace.cpp"
+#include "PIR_block.cpp"
+#include "PRF_ExtraSrc.cpp"
+#include "PRF_block.cpp"
+#include "SP_block.cpp"
@@ -0,0 +1,17 @@
+#include <ncbi_pch.hpp>
+#include "EMBL_block_.cpp"
+#include "EMBL_dbname_.cpp"
+#include "EMBL_xref_.cpp"
+#include "GB_block_.cpp"
+#include "PDB_block_.cpp"
+#include "PDB_replace_.cpp"
+#include "PIR_block_.cpp"
+#include "PRF_ExtraSrc_.cpp"
+#include "PRF_block_.cpp"
+#include "SP_block_.cpp"
+#include "EMBL_General_module.cpp"
+#include "GenBank_General_module.cpp"
+#include "PDB_General_module.cpp"
+#include "PIR_General_module.cpp"
+#include "PRF_General_module.cpp"
+#include "SP_General_module.cpp"
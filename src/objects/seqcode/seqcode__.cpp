@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "Seq_code_set.cpp"
+#include "Seq_code_table.cpp"
+#include "Seq_code_type.cpp"
+#include "Seq_map_table.cpp"
@@ -0,0 +1,6 @@
+#include <ncbi_pch.hpp>
+#include "Seq_code_set_.cpp"
+#include "Seq_code_table_.cpp"
+#include "Seq_code_type_.cpp"
+#include "Seq_map_table_.cpp"
+#include "NCBI_SeqCode_module.cpp"
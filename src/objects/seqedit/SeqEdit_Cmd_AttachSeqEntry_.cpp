@@ -0,0 +1,122 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqedit.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqedit/SeqEdit_Cmd_AttachSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Id.hpp>
+#include <objects/seqset/Seq_entry.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CSeqEdit_Cmd_AttachSeqEntry_Base::ResetId(void)
+{
+    if ( !m_Id ) {
+        m_Id.Reset(new TId());
+        return;
+    }
+    (*m_Id).Reset();
+}
+
+void CSeqEdit_Cmd_AttachSeqEntry_Base::SetId(CSeqEdit_Cmd_AttachSeqEntry_Base::TId& value)
+{
+    m_Id.Reset(&value);
+}
+
+void CSeqEdit_Cmd_AttachSeqEntry_Base::ResetSeq_entry(void)
+{
+    m_Seq_entry.Reset();
+}
+
+void CSeqEdit_Cmd_AttachSeqEntry_Base::SetSeq_entry(CSeqEdit_Cmd_AttachSeqEntry_Base::TSeq_entry& value)
+{
+    m_Seq_entry.Reset(&value);
+}
+
+CSeqEdit_Cmd_AttachSeqEntry_Base::TSeq_entry& CSeqEdit_Cmd_AttachSeqEntry_Base::SetSeq_entry(void)
+{
+    if ( !m_Seq_entry )
+        m_Seq_entry.Reset(new ncbi::objects::CSeq_entry());
+    return (*m_Seq_entry);
+}
+
+void CSeqEdit_Cmd_AttachSeqEntry_Base::Reset(void)
+{
+    ResetId();
+    ResetSeq_entry();
+    ResetIndex();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("SeqEdit-Cmd-AttachSeqEntry", CSeqEdit_Cmd_AttachSeqEntry)
+{
+    SET_CLASS_MODULE("NCBI-SeqEdit");
+    ADD_NAMED_REF_MEMBER("id", m_Id, CSeqEdit_Id);
+    ADD_NAMED_REF_MEMBER("seq-entry", m_Seq_entry, CSeq_entry)->SetOptional();
+    ADD_NAMED_STD_MEMBER("index", m_Index)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CSeqEdit_Cmd_AttachSeqEntry_Base::CSeqEdit_Cmd_AttachSeqEntry_Base(void)
+    : m_Index(0)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetId();
+    }
+}
+
+// destructor
+CSeqEdit_Cmd_AttachSeqEntry_Base::~CSeqEdit_Cmd_AttachSeqEntry_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,24 @@
+#include <ncbi_pch.hpp>
+#include "SeqEdit_Cmd.cpp"
+#include "SeqEdit_Cmd_AddAnnot.cpp"
+#include "SeqEdit_Cmd_AddDesc.cpp"
+#include "SeqEdit_Cmd_AddDescr.cpp"
+#include "SeqEdit_Cmd_AddId.cpp"
+#include "SeqEdit_Cmd_AttachAnnot.cpp"
+#include "SeqEdit_Cmd_AttachSeq.cpp"
+#include "SeqEdit_Cmd_AttachSeqEntry.cpp"
+#include "SeqEdit_Cmd_AttachSet.cpp"
+#include "SeqEdit_Cmd_ChangeSeqAttr.cpp"
+#include "SeqEdit_Cmd_ChangeSetAttr.cpp"
+#include "SeqEdit_Cmd_RemoveAnnot.cpp"
+#include "SeqEdit_Cmd_RemoveDesc.cpp"
+#include "SeqEdit_Cmd_RemoveId.cpp"
+#include "SeqEdit_Cmd_RemoveSeqEntry.cpp"
+#include "SeqEdit_Cmd_ReplaceAnnot.cpp"
+#include "SeqEdit_Cmd_ResetDescr.cpp"
+#include "SeqEdit_Cmd_ResetIds.cpp"
+#include "SeqEdit_Cmd_ResetSeqAttr.cpp"
+#include "SeqEdit_Cmd_ResetSeqEntry.cpp"
+#include "SeqEdit_Cmd_ResetSetAttr.cpp"
+#include "SeqEdit_Cmd_SetDescr.cpp"
+#include "SeqEdit_Id.cpp"
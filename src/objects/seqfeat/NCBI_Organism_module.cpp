@@ -0,0 +1,66 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqfeat.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/seqfeat/NCBI_Organism_module.hpp>
+#include <objects/seqfeat/BinomialOrgName.hpp>
+#include <objects/seqfeat/MultiOrgName.hpp>
+#include <objects/seqfeat/OrgMod.hpp>
+#include <objects/seqfeat/OrgName.hpp>
+#include <objects/seqfeat/Org_ref.hpp>
+#include <objects/seqfeat/PartialOrgName.hpp>
+#include <objects/seqfeat/TaxElement.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Organism_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBinomialOrgName::GetTypeInfo();
+    ncbi::objects::CMultiOrgName::GetTypeInfo();
+    ncbi::objects::COrgMod::GetTypeInfo();
+    ncbi::objects::COrgName::GetTypeInfo();
+    ncbi::objects::COrg_ref::GetTypeInfo();
+    ncbi::objects::CPartialOrgName::GetTypeInfo();
+    ncbi::objects::CTaxElement::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
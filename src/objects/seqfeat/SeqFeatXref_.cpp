@@ -0,0 +1,119 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqfeat.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqfeat/SeqFeatXref.hpp>
+#include <objects/seqfeat/Feat_id.hpp>
+#include <objects/seqfeat/SeqFeatData.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CSeqFeatXref_Base::ResetId(void)
+{
+    m_Id.Reset();
+}
+
+void CSeqFeatXref_Base::SetId(CSeqFeatXref_Base::TId& value)
+{
+    m_Id.Reset(&value);
+}
+
+CSeqFeatXref_Base::TId& CSeqFeatXref_Base::SetId(void)
+{
+    if ( !m_Id )
+        m_Id.Reset(new ncbi::objects::CFeat_id());
+    return (*m_Id);
+}
+
+void CSeqFeatXref_Base::ResetData(void)
+{
+    m_Data.Reset();
+}
+
+void CSeqFeatXref_Base::SetData(CSeqFeatXref_Base::TData& value)
+{
+    m_Data.Reset(&value);
+}
+
+CSeqFeatXref_Base::TData& CSeqFeatXref_Base::SetData(void)
+{
+    if ( !m_Data )
+        m_Data.Reset(new ncbi::objects::CSeqFeatData());
+    return (*m_Data);
+}
+
+void CSeqFeatXref_Base::Reset(void)
+{
+    ResetId();
+    ResetData();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("SeqFeatXref", CSeqFeatXref)
+{
+    SET_CLASS_MODULE("NCBI-Seqfeat");
+    ADD_NAMED_REF_MEMBER("id", m_Id, CFeat_id)->SetOptional();
+    ADD_NAMED_REF_MEMBER("data", m_Data, CSeqFeatData)->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CSeqFeatXref_Base::CSeqFeatXref_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CSeqFeatXref_Base::~CSeqFeatXref_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
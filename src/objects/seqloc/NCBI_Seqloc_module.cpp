@@ -0,0 +1,80 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqloc.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/seqloc/NCBI_Seqloc_module.hpp>
+#include <objects/seqloc/Giimport_id.hpp>
+#include <objects/seqloc/PDB_seq_id.hpp>
+#include <objects/seqloc/Packed_seqint.hpp>
+#include <objects/seqloc/Packed_seqpnt.hpp>
+#include <objects/seqloc/Patent_seq_id.hpp>
+#include <objects/seqloc/Seq_bond.hpp>
+#include <objects/seqloc/Seq_id.hpp>
+#include <objects/seqloc/Seq_id_set.hpp>
+#include <objects/seqloc/Seq_interval.hpp>
+#include <objects/seqloc/Seq_loc.hpp>
+#include <objects/seqloc/Seq_loc_equiv.hpp>
+#include <objects/seqloc/Seq_loc_mix.hpp>
+#include <objects/seqloc/Seq_point.hpp>
+#include <objects/seqloc/Textseq_id.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Seqloc_RegisterModuleClasses(void)
+{
+    ncbi::objects::CGiimport_id::GetTypeInfo();
+    ncbi::objects::CPDB_seq_id::GetTypeInfo();
+    ncbi::objects::CPacked_seqint::GetTypeInfo();
+    ncbi::objects::CPacked_seqpnt::GetTypeInfo();
+    ncbi::objects::CPatent_seq_id::GetTypeInfo();
+    ncbi::objects::CSeq_bond::GetTypeInfo();
+    ncbi::objects::CSeq_id::GetTypeInfo();
+    ncbi::objects::CSeq_id_set::GetTypeInfo();
+    ncbi::objects::CSeq_interval::GetTypeInfo();
+    ncbi::objects::CSeq_loc::GetTypeInfo();
+    ncbi::objects::CSeq_loc_equiv::GetTypeInfo();
+    ncbi::objects::CSeq_loc_mix::GetTypeInfo();
+    ncbi::objects::CSeq_point::GetTypeInfo();
+    ncbi::objects::CTextseq_id::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,130 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqloc.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqloc/Packed_seqpnt.hpp>
+#include <objects/general/Int_fuzz.hpp>
+#include <objects/seqloc/Seq_id.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CPacked_seqpnt_Base::ResetId(void)
+{
+    if ( !m_Id ) {
+        m_Id.Reset(new TId());
+        return;
+    }
+    (*m_Id).Reset();
+}
+
+void CPacked_seqpnt_Base::SetId(CPacked_seqpnt_Base::TId& value)
+{
+    m_Id.Reset(&value);
+}
+
+void CPacked_seqpnt_Base::ResetFuzz(void)
+{
+    m_Fuzz.Reset();
+}
+
+void CPacked_seqpnt_Base::SetFuzz(CPacked_seqpnt_Base::TFuzz& value)
+{
+    m_Fuzz.Reset(&value);
+}
+
+CPacked_seqpnt_Base::TFuzz& CPacked_seqpnt_Base::SetFuzz(void)
+{
+    if ( !m_Fuzz )
+        m_Fuzz.Reset(new ncbi::objects::CInt_fuzz());
+    return (*m_Fuzz);
+}
+
+void CPacked_seqpnt_Base::ResetPoints(void)
+{
+    m_Points.clear();
+    m_set_State[0] &= ~0xc0;
+}
+
+void CPacked_seqpnt_Base::Reset(void)
+{
+    ResetStrand();
+    ResetId();
+    ResetFuzz();
+    ResetPoints();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Packed-seqpnt", CPacked_seqpnt)
+{
+    SET_CLASS_MODULE("NCBI-Seqloc");
+    ADD_NAMED_ENUM_MEMBER("strand", m_Strand, ENa_strand)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_REF_MEMBER("id", m_Id, CSeq_id);
+    ADD_NAMED_REF_MEMBER("fuzz", m_Fuzz, CInt_fuzz)->SetOptional();
+    ADD_NAMED_MEMBER("points", m_Points, STL_vector, (STD, (TSeqPos)))->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CPacked_seqpnt_Base::CPacked_seqpnt_Base(void)
+    : m_Strand((ncbi::objects::ENa_strand)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetId();
+    }
+}
+
+// destructor
+CPacked_seqpnt_Base::~CPacked_seqpnt_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,17 @@
+#include <ncbi_pch.hpp>
+#include "Giimport_id.cpp"
+#include "Na_strand.cpp"
+#include "PDB_mol_id.cpp"
+#include "PDB_seq_id.cpp"
+#include "Packed_seqint.cpp"
+#include "Packed_seqpnt.cpp"
+#include "Patent_seq_id.cpp"
+#include "Seq_bond.cpp"
+#include "Seq_id.cpp"
+#include "Seq_id_set.cpp"
+#include "Seq_interval.cpp"
+#include "Seq_loc.cpp"
+#include "Seq_loc_equiv.cpp"
+#include "Seq_loc_mix.cpp"
+#include "Seq_point.cpp"
+#include "Textseq_id.cpp"
@@ -0,0 +1,18 @@
+#include <ncbi_pch.hpp>
+#include "Giimport_id_.cpp"
+#include "Na_strand_.cpp"
+#include "PDB_mol_id_.cpp"
+#include "PDB_seq_id_.cpp"
+#include "Packed_seqint_.cpp"
+#include "Packed_seqpnt_.cpp"
+#include "Patent_seq_id_.cpp"
+#include "Seq_bond_.cpp"
+#include "Seq_id_.cpp"
+#include "Seq_id_set_.cpp"
+#include "Seq_interval_.cpp"
+#include "Seq_loc_.cpp"
+#include "Seq_loc_equiv_.cpp"
+#include "Seq_loc_mix_.cpp"
+#include "Seq_point_.cpp"
+#include "Textseq_id_.cpp"
+#include "NCBI_Seqloc_module.cpp"
@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "Byte_graph.cpp"
+#include "Int_graph.cpp"
+#include "Real_graph.cpp"
+#include "Seq_graph.cpp"
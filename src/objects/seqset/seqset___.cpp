@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "Bioseq_set_.cpp"
+#include "Seq_entry_.cpp"
+#include "NCBI_Seqset_module.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "SeqTestResults.cpp"
+#include "Seq_test_result.cpp"
+#include "Seq_test_result_set.cpp"
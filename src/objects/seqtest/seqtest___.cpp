@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "SeqTestResults_.cpp"
+#include "Seq_test_result_.cpp"
+#include "Seq_test_result_set_.cpp"
+#include "NCBI_SeqTest_module.cpp"
@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "Contact_info_.cpp"
+#include "Seq_submit_.cpp"
+#include "Submit_block_.cpp"
+#include "NCBI_Submit_module.cpp"
@@ -0,0 +1,8 @@
+#include <ncbi_pch.hpp>
+#include "Taxon1_data.cpp"
+#include "Taxon1_error.cpp"
+#include "Taxon1_info.cpp"
+#include "Taxon1_name.cpp"
+#include "Taxon1_req.cpp"
+#include "Taxon1_resp.cpp"
+#include "Taxon2_data.cpp"
@@ -0,0 +1,195 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'taxon3.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/taxon3/T3Request.hpp>
+#include <objects/seqfeat/Org_ref.hpp>
+#include <objects/taxon3/SequenceOfInt.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CT3Request_Base::Reset(void)
+{
+    if ( m_choice != e_not_set )
+        ResetSelection();
+}
+
+void CT3Request_Base::ResetSelection(void)
+{
+    switch ( m_choice ) {
+    case e_Name:
+        m_string.Destruct();
+        break;
+    case e_Org:
+    case e_Join:
+        m_object->RemoveReference();
+        break;
+    default:
+        break;
+    }
+    m_choice = e_not_set;
+}
+
+void CT3Request_Base::DoSelect(E_Choice index, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    switch ( index ) {
+    case e_Taxid:
+        m_Taxid = 0;
+        break;
+    case e_Org:
+        (m_object = new(pool) ncbi::objects::COrg_ref())->AddReference();
+        break;
+    case e_Join:
+        (m_object = new(pool) ncbi::objects::CSequenceOfInt())->AddReference();
+        break;
+    case e_Name:
+        m_string.Construct();
+        break;
+    default:
+        break;
+    }
+    m_choice = index;
+}
+
+const char* const CT3Request_Base::sm_SelectionNames[] = {
+    "not set",
+    "taxid",
+    "name",
+    "org",
+    "join"
+};
+
+NCBI_NS_STD::string CT3Request_Base::SelectionName(E_Choice index)
+{
+    return NCBI_NS_NCBI::CInvalidChoiceSelection::GetName(index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+void CT3Request_Base::ThrowInvalidSelection(E_Choice index) const
+{
+    throw NCBI_NS_NCBI::CInvalidChoiceSelection(DIAG_COMPILE_INFO, this, m_choice, index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+void CT3Request_Base::SetName(const CT3Request_Base::TName& value)
+{
+    Select(e_Name, NCBI_NS_NCBI::eDoNotResetVariant);
+    *m_string = value;
+}
+
+const CT3Request_Base::TOrg& CT3Request_Base::GetOrg(void) const
+{
+    CheckSelected(e_Org);
+    return *static_cast<const TOrg*>(m_object);
+}
+
+CT3Request_Base::TOrg& CT3Request_Base::SetOrg(void)
+{
+    Select(e_Org, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *static_cast<TOrg*>(m_object);
+}
+
+void CT3Request_Base::SetOrg(CT3Request_Base::TOrg& value)
+{
+    TOrg* ptr = &value;
+    if ( m_choice != e_Org || m_object != ptr ) {
+        ResetSelection();
+        (m_object = ptr)->AddReference();
+        m_choice = e_Org;
+    }
+}
+
+const CT3Request_Base::TJoin& CT3Request_Base::GetJoin(void) const
+{
+    CheckSelected(e_Join);
+    return *static_cast<const TJoin*>(m_object);
+}
+
+CT3Request_Base::TJoin& CT3Request_Base::SetJoin(void)
+{
+    Select(e_Join, NCBI_NS_NCBI::eDoNotResetVariant);
+    return *static_cast<TJoin*>(m_object);
+}
+
+void CT3Request_Base::SetJoin(CT3Request_Base::TJoin& value)
+{
+    TJoin* ptr = &value;
+    if ( m_choice != e_Join || m_object != ptr ) {
+        ResetSelection();
+        (m_object = ptr)->AddReference();
+        m_choice = e_Join;
+    }
+}
+
+// helper methods
+
+// type info
+BEGIN_NAMED_BASE_CHOICE_INFO("T3Request", CT3Request)
+{
+    SET_CHOICE_MODULE("NCBI-Taxon3");
+    ADD_NAMED_STD_CHOICE_VARIANT("taxid", m_Taxid);
+    ADD_NAMED_BUF_CHOICE_VARIANT("name", m_string, STD, (string));
+    ADD_NAMED_REF_CHOICE_VARIANT("org", m_object, COrg_ref);
+    ADD_NAMED_REF_CHOICE_VARIANT("join", m_object, CSequenceOfInt);
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CHOICE_INFO
+
+// constructor
+CT3Request_Base::CT3Request_Base(void)
+    : m_choice(e_not_set)
+{
+}
+
+// destructor
+CT3Request_Base::~CT3Request_Base(void)
+{
+    Reset();
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
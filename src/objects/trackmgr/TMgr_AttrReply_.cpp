@@ -0,0 +1,133 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'trackmgr.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/trackmgr/TMgr_AttrReply.hpp>
+#include <objects/trackmgr/TMgr_TrackAttributes.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CTMgr_AttrReply_Base::Reset(void)
+{
+    if ( m_choice != e_not_set )
+        ResetSelection();
+}
+
+void CTMgr_AttrReply_Base::ResetSelection(void)
+{
+    switch ( m_choice ) {
+    case e_All_attrs:
+        m_All_attrs.Destruct();
+        break;
+    case e_Track_attr_list:
+        m_Track_attr_list.Destruct();
+        break;
+    default:
+        break;
+    }
+    m_choice = e_not_set;
+}
+
+void CTMgr_AttrReply_Base::DoSelect(E_Choice index, NCBI_NS_NCBI::CObjectMemoryPool* )
+{
+    switch ( index ) {
+    case e_All_attrs:
+        m_All_attrs.Construct();
+        break;
+    case e_Track_attr_list:
+        m_Track_attr_list.Construct();
+        break;
+    default:
+        break;
+    }
+    m_choice = index;
+}
+
+const char* const CTMgr_AttrReply_Base::sm_SelectionNames[] = {
+    "not set",
+    "all-attrs",
+    "track-attr-list"
+};
+
+NCBI_NS_STD::string CTMgr_AttrReply_Base::SelectionName(E_Choice index)
+{
+    return NCBI_NS_NCBI::CInvalidChoiceSelection::GetName(index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+void CTMgr_AttrReply_Base::ThrowInvalidSelection(E_Choice index) const
+{
+    throw NCBI_NS_NCBI::CInvalidChoiceSelection(DIAG_COMPILE_INFO, this, m_choice, index, sm_SelectionNames, sizeof(sm_SelectionNames)/sizeof(sm_SelectionNames[0]));
+}
+
+// helper methods
+
+// type info
+BEGIN_NAMED_BASE_CHOICE_INFO("TMgr-AttrReply", CTMgr_AttrReply)
+{
+    SET_CHOICE_MODULE("NCBI-TrackManager");
+    ADD_NAMED_BUF_CHOICE_VARIANT("all-attrs", m_All_attrs, STL_list_set, (STD, (string)));
+    ADD_NAMED_BUF_CHOICE_VARIANT("track-attr-list", m_Track_attr_list, STL_list_set, (STL_CRef, (CLASS, (CTMgr_TrackAttributes))));
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CHOICE_INFO
+
+// constructor
+CTMgr_AttrReply_Base::CTMgr_AttrReply_Base(void)
+    : m_choice(e_not_set)
+{
+}
+
+// destructor
+CTMgr_AttrReply_Base::~CTMgr_AttrReply_Base(void)
+{
+    Reset();
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,123 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'trackmgr.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/trackmgr/TMgr_BlastRIDDetail.hpp>
+#include <objects/trackmgr/TMgr_BlastQuerySeq.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CTMgr_BlastRIDDetail_Base::ResetRid(void)
+{
+    m_Rid.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CTMgr_BlastRIDDetail_Base::ResetTitle(void)
+{
+    m_Title.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CTMgr_BlastRIDDetail_Base::ResetQuery_sequences(void)
+{
+    m_Query_sequences.clear();
+    m_set_State[0] &= ~0x30;
+}
+
+void CTMgr_BlastRIDDetail_Base::ResetDatabase(void)
+{
+    m_Database.erase();
+    m_set_State[0] &= ~0x300;
+}
+
+void CTMgr_BlastRIDDetail_Base::ResetProgram(void)
+{
+    m_Program.erase();
+    m_set_State[0] &= ~0xc00;
+}
+
+void CTMgr_BlastRIDDetail_Base::Reset(void)
+{
+    ResetRid();
+    ResetTitle();
+    ResetQuery_sequences();
+    ResetCreated();
+    ResetDatabase();
+    ResetProgram();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("TMgr-BlastRIDDetail", CTMgr_BlastRIDDetail)
+{
+    SET_CLASS_MODULE("NCBI-TrackManager");
+    ADD_NAMED_STD_MEMBER("rid", m_Rid)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("title", m_Title)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_MEMBER("query-sequences", m_Query_sequences, STL_list, (STL_CRef, (CLASS, (CTMgr_BlastQuerySeq))))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("created", m_Created)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("database", m_Database)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("program", m_Program)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CTMgr_BlastRIDDetail_Base::CTMgr_BlastRIDDetail_Base(void)
+    : m_Created(0)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CTMgr_BlastRIDDetail_Base::~CTMgr_BlastRIDDetail_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
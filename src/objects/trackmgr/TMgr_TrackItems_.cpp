@@ -0,0 +1,108 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'trackmgr.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/trackmgr/TMgr_TrackItems.hpp>
+#include <objects/trackmgr/TMgr_DTrackId.hpp>
+#include <objects/trackmgr/TMgr_DatasetItem.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CTMgr_TrackItems_Base::ResetDtrack_id(void)
+{
+    if ( !m_Dtrack_id ) {
+        m_Dtrack_id.Reset(new TDtrack_id());
+        return;
+    }
+    (*m_Dtrack_id).Reset();
+}
+
+void CTMgr_TrackItems_Base::SetDtrack_id(CTMgr_TrackItems_Base::TDtrack_id& value)
+{
+    m_Dtrack_id.Reset(&value);
+}
+
+void CTMgr_TrackItems_Base::ResetData(void)
+{
+    m_Data.clear();
+    m_set_State[0] &= ~0xc;
+}
+
+void CTMgr_TrackItems_Base::Reset(void)
+{
+    ResetDtrack_id();
+    ResetData();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("TMgr-TrackItems", CTMgr_TrackItems)
+{
+    SET_CLASS_MODULE("NCBI-TrackManager");
+    ADD_NAMED_REF_MEMBER("dtrack-id", m_Dtrack_id, CTMgr_DTrackId);
+    ADD_NAMED_MEMBER("data", m_Data, STL_list_set, (STL_CRef, (CLASS, (CTMgr_DatasetItem))))->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CTMgr_TrackItems_Base::CTMgr_TrackItems_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetDtrack_id();
+    }
+}
+
+// destructor
+CTMgr_TrackItems_Base::~CTMgr_TrackItems_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
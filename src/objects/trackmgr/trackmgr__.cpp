@@ -0,0 +1,63 @@
+#include <ncbi_pch.hpp>
+#include "TMgr_ACL_AccessLevel.cpp"
+#include "TMgr_AnnotCounts.cpp"
+#include "TMgr_AnnotType.cpp"
+#include "TMgr_Assembly.cpp"
+#include "TMgr_AssemblySpec.cpp"
+#include "TMgr_AttrReply.cpp"
+#include "TMgr_AttrRequest.cpp"
+#include "TMgr_AttrSpec.cpp"
+#include "TMgr_AttrValueReply.cpp"
+#include "TMgr_Attribute.cpp"
+#include "TMgr_BlastQuerySeq.cpp"
+#include "TMgr_BlastRIDDetail.cpp"
+#include "TMgr_BlastRIDReply.cpp"
+#include "TMgr_BlastRIDRequest.cpp"
+#include "TMgr_ClientInfo.cpp"
+#include "TMgr_CreateTracksetReply.cpp"
+#include "TMgr_CreateTracksetRequest.cpp"
+#include "TMgr_CreateUserDataItem.cpp"
+#include "TMgr_CreateUserTrackReply.cpp"
+#include "TMgr_CreateUserTrackReques.cpp"
+#include "TMgr_DTrackId.cpp"
+#include "TMgr_DatasetItem.cpp"
+#include "TMgr_DatasetItemSeq.cpp"
+#include "TMgr_DisplayTrack.cpp"
+#include "TMgr_DisplayTrackChoice.cpp"
+#include "TMgr_DisplayTrackReply.cpp"
+#include "TMgr_DisplayTrackRequest.cpp"
+#include "TMgr_GenomeContext.cpp"
+#include "TMgr_Identity.cpp"
+#include "TMgr_IdentityId.cpp"
+#include "TMgr_IdentityIdType.cpp"
+#include "TMgr_ItemResolverReply.cpp"
+#include "TMgr_ItemResolverRequest.cpp"
+#include "TMgr_LengthStats.cpp"
+#include "TMgr_Message.cpp"
+#include "TMgr_MessageLevel.cpp"
+#include "TMgr_PositionStats.cpp"
+#include "TMgr_RemoveUserTrackReply.cpp"
+#include "TMgr_RemoveUserTrackReques.cpp"
+#include "TMgr_RenameMyNCBICollectio.cpp"
+#include "TMgr_Reply.cpp"
+#include "TMgr_Request.cpp"
+#include "TMgr_RetrieveTracksetReply.cpp"
+#include "TMgr_RetrieveTracksetReque.cpp"
+#include "TMgr_SeqTrackIdReply.cpp"
+#include "TMgr_SeqTrackIdRequest.cpp"
+#include "TMgr_Status.cpp"
+#include "TMgr_SupportedAssembliesRe.cpp"
+#include "TMgr_SwitchTrackContextRep.cpp"
+#include "TMgr_SwitchTrackContextReq.cpp"
+#include "TMgr_SwitchTrackException.cpp"
+#include "TMgr_SwitchTrackExceptionC.cpp"
+#include "TMgr_TrackACL_Authorizatio.cpp"
+#include "TMgr_TrackACL_Permission.cpp"
+#include "TMgr_TrackAttrValueReply.cpp"
+#include "TMgr_TrackAttrValueRequest.cpp"
+#include "TMgr_TrackAttributes.cpp"
+#include "TMgr_TrackItems.cpp"
+#include "TMgr_TrackSet.cpp"
+#include "TMgr_TrackSetType.cpp"
+#include "TMgr_TypeStat.cpp"
+#include "TMgr_ValueRequest.cpp"
@@ -0,0 +1,64 @@
+#include <ncbi_pch.hpp>
+#include "TMgr_ACL_AccessLevel_.cpp"
+#include "TMgr_AnnotCounts_.cpp"
+#include "TMgr_AnnotType_.cpp"
+#include "TMgr_Assembly_.cpp"
+#include "TMgr_AssemblySpec_.cpp"
+#include "TMgr_AttrReply_.cpp"
+#include "TMgr_AttrRequest_.cpp"
+#include "TMgr_AttrSpec_.cpp"
+#include "TMgr_AttrValueReply_.cpp"
+#include "TMgr_Attribute_.cpp"
+#include "TMgr_BlastQuerySeq_.cpp"
+#include "TMgr_BlastRIDDetail_.cpp"
+#include "TMgr_BlastRIDReply_.cpp"
+#include "TMgr_BlastRIDRequest_.cpp"
+#include "TMgr_ClientInfo_.cpp"
+#include "TMgr_CreateTracksetReply_.cpp"
+#include "TMgr_CreateTracksetRequest_.cpp"
+#include "TMgr_CreateUserDataItem_.cpp"
+#include "TMgr_CreateUserTrackReply_.cpp"
+#include "TMgr_CreateUserTrackReques_.cpp"
+#include "TMgr_DTrackId_.cpp"
+#include "TMgr_DatasetItem_.cpp"
+#include "TMgr_DatasetItemSeq_.cpp"
+#include "TMgr_DisplayTrack_.cpp"
+#include "TMgr_DisplayTrackChoice_.cpp"
+#include "TMgr_DisplayTrackReply_.cpp"
+#include "TMgr_DisplayTrackRequest_.cpp"
+#include "TMgr_GenomeContext_.cpp"
+#include "TMgr_Identity_.cpp"
+#include "TMgr_IdentityId_.cpp"
+#include "TMgr_IdentityIdType_.cpp"
+#include "TMgr_ItemResolverReply_.cpp"
+#include "TMgr_ItemResolverRequest_.cpp"
+#include "TMgr_LengthStats_.cpp"
+#include "TMgr_Message_.cpp"
+#include "TMgr_MessageLevel_.cpp"
+#include "TMgr_PositionStats_.cpp"
+#include "TMgr_RemoveUserTrackReply_.cpp"
+#include "TMgr_RemoveUserTrackReques_.cpp"
+#include "TMgr_RenameMyNCBICollectio_.cpp"
+#include "TMgr_Reply_.cpp"
+#include "TMgr_Request_.cpp"
+#include "TMgr_RetrieveTracksetReply_.cpp"
+#include "TMgr_RetrieveTracksetReque_.cpp"
+#include "TMgr_SeqTrackIdReply_.cpp"
+#include "TMgr_SeqTrackIdRequest_.cpp"
+#include "TMgr_Status_.cpp"
+#include "TMgr_SupportedAssembliesRe_.cpp"
+#include "TMgr_SwitchTrackContextRep_.cpp"
+#include "TMgr_SwitchTrackContextReq_.cpp"
+#include "TMgr_SwitchTrackException_.cpp"
+#include "TMgr_SwitchTrackExceptionC_.cpp"
+#include "TMgr_TrackACL_Authorizatio_.cpp"
+#include "TMgr_TrackACL_Permission_.cpp"
+#include "TMgr_TrackAttrValueReply_.cpp"
+#include "TMgr_TrackAttrValueRequest_.cpp"
+#include "TMgr_TrackAttributes_.cpp"
+#include "TMgr_TrackItems_.cpp"
+#include "TMgr_TrackSet_.cpp"
+#include "TMgr_TrackSetType_.cpp"
+#include "TMgr_TypeStat_.cpp"
+#include "TMgr_ValueRequest_.cpp"
+#include "NCBI_TrackManager_module.cpp"
@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "ValidErrItem.cpp"
+#include "ValidError.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "ValidErrItem_.cpp"
+#include "ValidError_.cpp"
+#include "NCBI_ValErrors_module.cpp"
@@ -0,0 +1,9 @@
+#include <ncbi_pch.hpp>
+#include "Comment_rule.cpp"
+#include "Comment_set.cpp"
+#include "Dependent_field_rule.cpp"
+#include "Dependent_field_set.cpp"
+#include "Field_rule.cpp"
+#include "Field_set.cpp"
+#include "Phrase_list.cpp"
+#include "Severity_level.cpp"
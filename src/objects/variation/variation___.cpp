@@ -0,0 +1,6 @@
+#include <ncbi_pch.hpp>
+#include "VariantPlacement_.cpp"
+#include "Variation_.cpp"
+#include "VariationException_.cpp"
+#include "VariationMethod_.cpp"
+#include "NCBI_VariationPackage_module.cpp"
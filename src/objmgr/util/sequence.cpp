@@ -89,9 +89,11 @@
 #include <objmgr/util/sequence.hpp>
 #include <objmgr/error_codes.hpp>
 #include <util/strsearch.hpp>
+#include <corelib/ncbithr.hpp>
 
 #include <list>
 #include <algorithm>
+#include <exception>
 
 
 #define NCBI_USE_ERRCODE_X   ObjMgr_SeqUtil
@@ -2585,10 +2587,67 @@ END_SCOPE(sequence)
 
 
 
+// Formats the sequences of a range of the records collected by
+// CFastaOstream::x_WriteParallel
+class CFastaFormatThread : public CThread
+{
+public:
+    struct SRecord
+    {
+        CBioseq_Handle m_Handle;
+        string         m_Text;
+    };
+    typedef vector<SRecord> TRecords;
+
+    CFastaFormatThread(CFastaOstream& stream, const CSeq_loc* location,
+                       TRecords& records, size_t from, size_t to)
+        : m_Stream(stream), m_Location(location),
+          m_Records(records), m_From(from), m_To(to)
+    {}
+
+    virtual void* Main(void)
+    {
+        try {
+            for (size_t i = m_From;  i < m_To;  ++i) {
+                SRecord&              record = m_Records[i];
+                CSeqVector            vec;
+                CFastaOstream::TMSMap masking_state;
+                if (m_Stream.x_GetSequence(record.m_Handle, m_Location,
+                                           CSeq_loc::fMerge_All,
+                                           vec, masking_state)) {
+                    m_Stream.x_FormatSequence(vec, masking_state,
+                                              record.m_Text, 0);
+                }
+            }
+        } catch (...) {
+            m_Exception = current_exception();
+        }
+        return 0;
+    }
+
+    CFastaOstream&   m_Stream;
+    const CSeq_loc*  m_Location;
+    TRecords&        m_Records;
+    size_t           m_From;
+    size_t           m_To;
+    exception_ptr    m_Exception;
+};
+
+
+// residues fetched and formatted at a time
+static const TSeqPos kFastaBlockSize       = 64 * 1024;
+// formatted text collected before it is written to the output stream
+static const size_t  kFastaWriteBufferSize = 256 * 1024;
+// limits of the records formatted by x_WriteParallel at a time
+static const size_t  kFastaBatchRecords    = 64;   // per thread
+static const Uint8   kFastaBatchResidues   = 256 * 1024 * 1024;
+
+
 CFastaOstream::CFastaOstream(CNcbiOstream& out)
     : m_Out(out),
       m_Flags(fInstantiateGaps | fAssembleParts | fEnableGI),
-      m_GapMode(eGM_letters)
+      m_GapMode(eGM_letters),
+      m_Threads(1)
 {
     m_Gen.reset(new sequence::CDeflineGenerator);
     SetWidth(70);
@@ -2602,6 +2661,10 @@ CFastaOstream::~CFastaOstream()
 void CFastaOstream::Write(const CSeq_entry_Handle& handle,
                           const CSeq_loc* location)
 {
+    if (m_Threads > 1) {
+        x_WriteParallel(handle, location);
+        return;
+    }
     for (CBioseq_CI it(handle);  it;  ++it) {
         if ( !SkipBioseq(*it) ) {
             if (location) {
@@ -2629,6 +2692,68 @@ void CFastaOstream::Write(const CBioseq_Handle& handle,
 }
 
 
+void CFastaOstream::x_WriteParallel(const CSeq_entry_Handle& handle,
+                                    const CSeq_loc* location)
+{
+    vector<CBioseq_Handle> handles;
+    for (CBioseq_CI it(handle);  it;  ++it) {
+        if ( !SkipBioseq(*it) ) {
+            if (location) {
+                CSeq_loc loc2;
+                loc2.SetWhole().Assign(*it->GetSeqId());
+                int d = sequence::TestForOverlap
+                    (*location, loc2, sequence::eOverlap_Interval,
+                     kInvalidSeqPos, &handle.GetScope());
+                if (d < 0) {
+                    continue;
+                }
+            }
+            handles.push_back(*it);
+        }
+    }
+
+    typedef vector<CRef<CFastaFormatThread> > TThreads;
+    size_t first = 0;
+    while (first < handles.size()) {
+        // the formatted text of a batch is held in memory till written
+        CFastaFormatThread::TRecords records;
+        Uint8 residues = 0;
+        while (first < handles.size()
+               &&  records.size() < kFastaBatchRecords * m_Threads
+               &&  residues < kFastaBatchResidues) {
+            records.push_back(CFastaFormatThread::SRecord());
+            records.back().m_Handle = handles[first++];
+            residues += records.back().m_Handle.GetBioseqLength();
+        }
+
+        TThreads threads;
+        size_t thread_count = min<size_t>(m_Threads, records.size());
+        size_t from = 0;
+        for (size_t i = 0;  i < thread_count;  ++i) {
+            size_t to = from + (records.size() - from) / (thread_count - i);
+            CRef<CFastaFormatThread> thread
+                (new CFastaFormatThread(*this, location, records, from, to));
+            thread->Run();
+            threads.push_back(thread);
+            from = to;
+        }
+        NON_CONST_ITERATE (TThreads, it, threads) {
+            (*it)->Join();
+        }
+        ITERATE (TThreads, it, threads) {
+            if ((*it)->m_Exception) {
+                rethrow_exception((*it)->m_Exception);
+            }
+        }
+
+        ITERATE (CFastaFormatThread::TRecords, it, records) {
+            WriteTitle(it->m_Handle, location);
+            m_Out.write(it->m_Text.data(), it->m_Text.size());
+        }
+    }
+}
+
+
 static string s_FastaGetOriginalID (const CBioseq& seq)
 
 {
@@ -2986,8 +3111,68 @@ void CFastaOstream::x_GetMaskingStates(TMSMap& masking_state,
 }
 
 
+// Lowercases ASCII letters a word at a time; no carries cross the byte
+// boundaries, so compilers turn the loop into vector code easily.
+static void s_ToLowerAscii(char* ptr, size_t count)
+{
+    const Uint8 kOnes = NCBI_CONST_UINT8(0x0101010101010101);
+    const Uint8 kHigh = NCBI_CONST_UINT8(0x8080808080808080);
+
+    for ( ;  count >= sizeof(Uint8);
+          ptr += sizeof(Uint8), count -= sizeof(Uint8)) {
+        Uint8 word;
+        memcpy(&word, ptr, sizeof(word));
+        Uint8 low7  = word & ~kHigh;
+        Uint8 ge_A  = low7 + (0x80 - 'A') * kOnes; // high bit set if >= 'A'
+        Uint8 gt_Z  = low7 + (0x7f - 'Z') * kOnes; // high bit set if >  'Z'
+        Uint8 upper = (ge_A ^ gt_Z) & ~word & kHigh;
+        word |= upper >> 2; // 0x80 >> 2 == 'a' - 'A'
+        memcpy(ptr, &word, sizeof(word));
+    }
+    for ( ;  count > 0;  ++ptr, --count) {
+        if (*ptr >= 'A'  &&  *ptr <= 'Z') {
+            *ptr += 'a' - 'A';
+        }
+    }
+}
+
+
+// Appends count characters to the buffer breaking the lines every width
+// characters; rem_line is the room left on the current line.  Without
+// advance, ptr points to at least width copies of a single character.
+static void s_AppendWrapped(string& buffer, const char* ptr, TSeqPos count,
+                            bool advance, TSeqPos width, TSeqPos& rem_line)
+{
+    while ( count >= rem_line ) {
+        buffer.append(ptr, rem_line);
+        buffer += '\n';
+        if ( advance ) {
+            ptr += rem_line;
+        }
+        count -= rem_line;
+        rem_line = width;
+    }
+    if ( count > 0 ) {
+        buffer.append(ptr, count);
+        rem_line -= count;
+    }
+}
+
+
 void CFastaOstream::x_WriteSequence(const CSeqVector& vec,
                                     const TMSMap& masking_state)
+{
+    string buffer;
+    x_FormatSequence(vec, masking_state, buffer, &m_Out);
+    m_Out.write(buffer.data(), buffer.size());
+    // m_Out << NcbiFlush;
+}
+
+
+void CFastaOstream::x_FormatSequence(const CSeqVector& vec,
+                                     const TMSMap& masking_state,
+                                     string& buffer,
+                                     CNcbiOstream* out)
 {
     TSeqPos                 rem_line      = m_Width;
     CSeqVector_CI           it(vec);
@@ -3003,6 +3188,12 @@ void CFastaOstream::x_WriteSequence(const CSeqVector& vec,
     EGapMode                native_gap_mode
         = ((vec.GetGapChar() == '-') ? eGM_dashes : eGM_letters);
     CTempString             alt_gap_str;
+    // gaps written other than as the vector's own gap characters
+    bool                    separate_gaps
+        = (m_GapMode != native_gap_mode  ||  (m_Flags & fInstantiateGaps) == 0);
+    bool                    zero_gaps
+        = (m_Flags & fShowGapsOfSizeZero) != 0;
+    string                  block;
 
     if (native_gap_mode == eGM_dashes) {
         alt_gap_str = uc_hard_mask_str;
@@ -3014,6 +3205,9 @@ void CFastaOstream::x_WriteSequence(const CSeqVector& vec,
         it.SetStrand(Reverse(it.GetStrand()));
     }
 
+    buffer.reserve(buffer.size()
+                   + min(size_t(vec.size()) + vec.size() / m_Width + 1,
+                         2 * kFastaWriteBufferSize));
     while ( it ) {
         if (rem_state == 0) {
             _ASSERT(ms_it->first == it.GetPos());
@@ -3024,35 +3218,35 @@ void CFastaOstream::x_WriteSequence(const CSeqVector& vec,
                 rem_state = ms_it->first - it.GetPos();
             }
         }
-        if( (m_Flags & fShowGapsOfSizeZero) != 0 &&
-            it.HasZeroGapBefore() ) 
+        if( zero_gaps  &&  it.HasZeroGapBefore() )
         {
-            m_Out << "-\n";
+            buffer += "-\n";
             rem_line = m_Width;
         }
-        if ((m_GapMode != native_gap_mode || (m_Flags & fInstantiateGaps) == 0)
-            &&  it.GetGapSizeForward()) 
+        if (separate_gaps  &&  it.GetGapSizeForward())
         {
             TSeqPos gap_size = it.GetGapSizeForward();
             if (m_GapMode == eGM_one_dash
                 ||  (m_Flags & fInstantiateGaps) == 0) {
-                m_Out << "-\n";
+                buffer += "-\n";
                 rem_line = m_Width;
             } else if (m_GapMode == eGM_count) {
                 if (rem_line < m_Width) {
-                    m_Out << '\n';
+                    buffer += '\n';
                 }
                 _ASSERT(it.GetCurrentSeqMap_CI().GetType() == CSeqMap::eSeqGap);
                 if (it.GetCurrentSeqMap_CI().IsUnknownLength()) {
                     // conventional designation, regardless of nominal length
                     if( gap_size > 0 && (m_Flags & fKeepUnknGapNomLen) != 0 )
                     {
-                        m_Out << ">?unk" << gap_size;
+                        buffer += ">?unk";
+                        buffer += NStr::NumericToString(gap_size);
                     } else {
-                        m_Out << ">?unk100";
+                        buffer += ">?unk100";
                     }
                 } else {
-                    m_Out << ">?" << gap_size;
+                    buffer += ">?";
+                    buffer += NStr::NumericToString(gap_size);
                 }
                 // print gap mods, if requested
                 if( (m_Flags & fShowGapModifiers) != 0 )
@@ -3072,24 +3266,16 @@ void CFastaOstream::x_WriteSequence(const CSeqVector& vec,
                         const string sGapModText = 
                             CNcbiOstrstreamToString(gap_mod_strm);
                         if( ! sGapModText.empty() ) {
-                            m_Out << ' ' << sGapModText;
+                            buffer += ' ';
+                            buffer += sGapModText;
                         }
                     }
                 }
-                m_Out << '\n';
+                buffer += '\n';
                 rem_line = m_Width;
             } else {
-                TSeqPos rem_gap = gap_size;
-                while (rem_gap >= rem_line) {
-                    m_Out.write(alt_gap_str.data(), rem_line);
-                    m_Out << '\n';
-                    rem_gap -= rem_line;
-                    rem_line = m_Width;
-                }
-                if (rem_gap > 0) {
-                    m_Out.write(alt_gap_str.data(), rem_gap);
-                    rem_line -= rem_gap;
-                }
+                s_AppendWrapped(buffer, alt_gap_str.data(), gap_size, false,
+                                m_Width, rem_line);
             }
             it.SkipGap();
             if (rem_state >= gap_size) {
@@ -3106,48 +3292,55 @@ void CFastaOstream::x_WriteSequence(const CSeqVector& vec,
                 }
             }
         } else {
-            TSeqPos     count   = min(TSeqPos(it.GetBufferSize()), rem_state);
-            TSeqPos     new_pos = it.GetPos() + count;
-            const char* ptr     = it.GetBufferPtr();
-            string      lc_buffer;
+            // Collect the residues up to the next change of the masking
+            // state or gap and format them as a whole rather than one
+            // iterator buffer at a time.
+            bool    hard_mask = (current_state & eHardMask) != 0;
+            TSeqPos limit     = min(rem_state, kFastaBlockSize);
+            TSeqPos count     = 0;
+
+            block.erase();
+            do {
+                TSeqPos chunk = min(TSeqPos(it.GetBufferSize()),
+                                    limit - count);
+                if ( !hard_mask ) {
+                    block.append(it.GetBufferPtr(), chunk);
+                }
+                count += chunk;
+                it.SetPos(it.GetPos() + chunk);
+            } while (count < limit  &&  it
+                     &&  !(separate_gaps  &&  it.IsInGap())
+                     &&  !(zero_gaps  &&  it.HasZeroGapBefore()));
 
             rem_state -= count;
-            if (current_state & eHardMask) {
-                ptr = (current_state & eSoftMask) ? lc_hard_mask_str.data()
-                    : uc_hard_mask_str.data();
-            } else if (current_state & eSoftMask) {
-                // ToLower() always operates in place. :-/
-                lc_buffer.assign(ptr, count);
-                NStr::ToLower(lc_buffer);
-                ptr = lc_buffer.data();
-            }
-            while ( count >= rem_line ) {
-                m_Out.write(ptr, rem_line);
-                if ( !(current_state & eHardMask) ) {
-                    ptr += rem_line;
+            if ( hard_mask ) {
+                const char* ptr = (current_state & eSoftMask)
+                    ? lc_hard_mask_str.data() : uc_hard_mask_str.data();
+                s_AppendWrapped(buffer, ptr, count, false, m_Width, rem_line);
+            } else {
+                if (current_state & eSoftMask) {
+                    s_ToLowerAscii(&block[0], block.size());
                 }
-                count -= rem_line;
-                m_Out << '\n';
-                rem_line = m_Width;
-            }
-            if ( count > 0 ) {
-                m_Out.write(ptr, count);
-                rem_line -= count;
+                s_AppendWrapped(buffer, block.data(), count, true,
+                                m_Width, rem_line);
             }
-            it.SetPos(new_pos);
+        }
+        if (out  &&  buffer.size() >= kFastaWriteBufferSize) {
+            out->write(buffer.data(), buffer.size());
+            buffer.erase();
         }
     }
     if ( rem_line < m_Width ) {
-        m_Out << '\n';
+        buffer += '\n';
     }
-    // m_Out << NcbiFlush;
 }
 
 
-void CFastaOstream::WriteSequence(const CBioseq_Handle& handle,
+bool CFastaOstream::x_GetSequence(const CBioseq_Handle& handle,
                                   const CSeq_loc* location,
-                                  const CSeq_loc::EOpFlags merge_flags)
-
+                                  const CSeq_loc::EOpFlags merge_flags,
+                                  CSeqVector& v,
+                                  TMSMap& masking_state)
 {
     vector<CTSE_Handle> used_tses;
     if ( !(m_Flags & fAssembleParts)  &&  !handle.IsSetInst_Seq_data() ) {
@@ -3155,12 +3348,11 @@ void CFastaOstream::WriteSequence(const CBioseq_Handle& handle,
         sel.SetLinkUsedTSE(handle.GetTSE_Handle());
         sel.SetLinkUsedTSE(used_tses);
         if ( !handle.GetSeqMap().CanResolveRange(&handle.GetScope(), sel) ) {
-            return;
+            return false;
         }
     }
 
     CScope&    scope = handle.GetScope();
-    CSeqVector v;
     if (location) {
         if (sequence::SeqLocCheck(*location, &scope)
             == sequence::eSeqLocCheck_error) {
@@ -3179,11 +3371,23 @@ void CFastaOstream::WriteSequence(const CBioseq_Handle& handle,
         v.SetCoding(CSeq_data::e_Ncbieaa);
     }
 
-    TMSMap masking_state;
     if (m_SoftMask.NotEmpty()  ||  m_HardMask.NotEmpty()) {
         x_GetMaskingStates(masking_state, handle.GetSeqId(), location, &scope);
     }
-    x_WriteSequence(v, masking_state);
+    return true;
+}
+
+
+void CFastaOstream::WriteSequence(const CBioseq_Handle& handle,
+                                  const CSeq_loc* location,
+                                  const CSeq_loc::EOpFlags merge_flags)
+
+{
+    CSeqVector v;
+    TMSMap     masking_state;
+    if (x_GetSequence(handle, location, merge_flags, v, masking_state)) {
+        x_WriteSequence(v, masking_state);
+    }
 }
 
 
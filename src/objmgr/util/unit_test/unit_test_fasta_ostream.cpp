@@ -57,6 +57,7 @@
 #include <corelib/ncbi_autoinit.hpp>
 
 #include <objects/seqset/Seq_entry.hpp>
+#include <objects/seqset/Bioseq_set.hpp>
 #include <objmgr/object_manager.hpp>
 #include <objmgr/scope.hpp>
 #include <objmgr/bioseq_ci.hpp>
@@ -64,7 +65,10 @@
 #include <objmgr/seq_vector.hpp>
 #include <objmgr/util/sequence.hpp>
 #include <objects/seq/seqport_util.hpp>
+#include <objects/seq/Bioseq.hpp>
 #include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_descr.hpp>
+#include <objects/seq/Seqdesc.hpp>
 #include <objects/seq/Seq_ext.hpp>
 #include <objects/seq/Seq_gap.hpp>
 #include <objects/seq/Seq_literal.hpp>
@@ -500,6 +504,151 @@ BOOST_AUTO_TEST_CASE(Test_FastaMask_SoftHardSimpleOverlap)
      }}
 }
 
+// A set of many nucleotide records of different lengths, some with a gap
+// and some without a title, so that formatting on several threads goes
+// through more than one batch
+static CRef<CSeq_entry> s_MakeManyRecords(size_t count)
+{
+    static const char kBases[] = "ACGT";
+
+    CRef<CSeq_entry> entry(new CSeq_entry);
+    CBioseq_set& bioseq_set = entry->SetSet();
+    bioseq_set.SetClass(CBioseq_set::eClass_genbank);
+
+    Uint4 seed = 1;
+    for (size_t i = 0;  i < count;  ++i) {
+        CRef<CSeq_entry> sub_entry(new CSeq_entry);
+        CBioseq& bioseq = sub_entry->SetSeq();
+        bioseq.SetId().push_back
+            (CRef<CSeq_id>(new CSeq_id("lcl|seq" +
+                                       NStr::NumericToString(i))));
+        if (i % 3 != 0) {
+            CRef<CSeqdesc> title(new CSeqdesc);
+            title->SetTitle("record " + NStr::NumericToString(i));
+            bioseq.SetDescr().Set().push_back(title);
+        }
+
+        string data;
+        seed = seed * 1103515245 + 12345;
+        size_t length = 1 + (seed >> 8) % 500;
+        for (size_t pos = 0;  pos < length;  ++pos) {
+            seed = seed * 1103515245 + 12345;
+            data += kBases[(seed >> 8) % 4];
+        }
+
+        CSeq_inst& inst = bioseq.SetInst();
+        inst.SetMol(CSeq_inst::eMol_dna);
+        if (i % 5 == 0) {
+            inst.SetRepr(CSeq_inst::eRepr_delta);
+            CRef<CDelta_seq> del1(new CDelta_seq);
+            del1->SetLiteral().SetLength(data.size());
+            del1->SetLiteral().SetSeq_data().SetIupacna(*new CIUPACna(data));
+            inst.SetExt().SetDelta().Set().push_back(del1);
+
+            CRef<CDelta_seq> del_gap(new CDelta_seq);
+            del_gap->SetLiteral().SetLength(20);
+            inst.SetExt().SetDelta().Set().push_back(del_gap);
+
+            CRef<CDelta_seq> del2(new CDelta_seq);
+            del2->SetLiteral().SetLength(data.size());
+            del2->SetLiteral().SetSeq_data().SetIupacna(*new CIUPACna(data));
+            inst.SetExt().SetDelta().Set().push_back(del2);
+            inst.SetLength(2 * data.size() + 20);
+        }
+        else {
+            inst.SetRepr(CSeq_inst::eRepr_raw);
+            inst.SetLength(data.size());
+            inst.SetSeq_data().SetIupacna(*new CIUPACna(data));
+        }
+        bioseq_set.SetSeq_set().push_back(sub_entry);
+    }
+    return entry;
+}
+
+BOOST_AUTO_TEST_CASE(Test_FastaThreads)
+{
+    CRef<CObjectManager> om(CObjectManager::GetInstance());
+
+    ///
+    /// formatting on several threads must give the same text as on one
+    ///
+    {{
+         CRef<CSeq_entry> entry = s_ReadData();
+         CRef<CScope> scope(new CScope(*om));
+         CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry(*entry);
+
+         CRef<CSeq_id> id(new CSeq_id("lcl|test-seq"));
+         CRef<CSeq_loc> soft_loc(new CSeq_loc);
+         soft_loc->SetInt().SetFrom(50);
+         soft_loc->SetInt().SetTo(75);
+         soft_loc->SetId(*id);
+
+         CRef<CSeq_loc> hard_loc(new CSeq_loc);
+         hard_loc->SetInt().SetFrom(60);
+         hard_loc->SetInt().SetTo(80);
+         hard_loc->SetId(*id);
+
+         string results[2];
+         for (unsigned int i = 0;  i < 2;  ++i) {
+             CNcbiOstrstream os;
+             {{
+                  CFastaOstream fasta_os(os);
+                  fasta_os.SetWidth(13);
+                  fasta_os.SetThreads(i == 0 ? 1 : 4);
+                  fasta_os.SetMask(CFastaOstream::eSoftMask, soft_loc);
+                  fasta_os.SetMask(CFastaOstream::eHardMask, hard_loc);
+                  fasta_os.Write(seh);
+              }}
+             os.flush();
+             results[i] = string(CNcbiOstrstreamToString(os));
+         }
+         BOOST_CHECK_EQUAL(results[0], results[1]);
+         BOOST_CHECK_EQUAL(NStr::Find(results[0], ">lcl|test-seq test sequence\n"
+                                      "CGGTTGCTTGGGT\n"), 0U);
+     }}
+
+    ///
+    /// with a few hundred records the work is split into several batches;
+    /// the records must still come out once each and in order
+    ///
+    {{
+         const size_t kRecords = 700;
+         CRef<CSeq_entry> entry = s_MakeManyRecords(kRecords);
+         CRef<CScope> scope(new CScope(*om));
+         CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry(*entry);
+
+         string results[3];
+         const unsigned int kThreads[] = { 1, 3, 4 };
+         for (unsigned int i = 0;  i < 3;  ++i) {
+             CNcbiOstrstream os;
+             {{
+                  CFastaOstream fasta_os(os);
+                  fasta_os.SetGapMode(CFastaOstream::eGM_dashes);
+                  fasta_os.SetThreads(kThreads[i]);
+                  fasta_os.Write(seh);
+              }}
+             os.flush();
+             results[i] = string(CNcbiOstrstreamToString(os));
+         }
+         BOOST_CHECK_EQUAL(results[0], results[1]);
+         BOOST_CHECK_EQUAL(results[0], results[2]);
+
+         SIZE_TYPE pos = 0;
+         for (size_t i = 0;  i < kRecords;  ++i) {
+             string defline = ">lcl|seq" + NStr::NumericToString(i);
+             if (i % 3 != 0) {
+                 defline += " record " + NStr::NumericToString(i);
+             }
+             pos = NStr::Find(results[2], defline + (i % 3 ? "\n" : ""), pos);
+             BOOST_REQUIRE(pos != NPOS);
+             ++pos;
+         }
+         BOOST_CHECK_EQUAL(NStr::Find(results[2], ">lcl|seq" +
+                                      NStr::NumericToString(kRecords)),
+                           NPOS);
+     }}
+}
+
 BOOST_AUTO_TEST_CASE(Test_FastaMods)
 {
     CRef<CSeq_entry> entry = s_ReadData();
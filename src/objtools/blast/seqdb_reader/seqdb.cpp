@@ -338,6 +338,7 @@ void CSeqDB::SetMmapStrategy(
         CRegionMap::SetMmapStrategy_Index(st);
     } else if (filetype == eMmap_SequenceFile) {
         CRegionMap::SetMmapStrategy_Sequence(st);
+        CRegionMap::SetMmapAdaptive_Sequence(strategy == eMmap_Adaptive);
     }
 }
 
@@ -1406,6 +1407,13 @@ Int8 CSeqDB::GetSliceSize() const
     return m_Impl->GetSliceSize();
 }
 
+void CSeqDB::GetMmapStats(SSeqDBMmapStats & stats) const
+{
+    m_Impl->Verify();
+
+    m_Impl->GetMmapStats(stats);
+}
+
 Int8 CSeqDB::GetDiskUsage() const
 {
     vector<string> paths;
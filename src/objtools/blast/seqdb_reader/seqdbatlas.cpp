@@ -39,6 +39,7 @@
 #include <objtools/blast/seqdb_reader/seqdbcommon.hpp>
 
 #include <corelib/ncbi_system.hpp>
+#include <corelib/ncbiapp.hpp>
 
 #if defined(NCBI_OS_UNIX)
 #include <unistd.h>
@@ -183,6 +184,35 @@ TOut SeqDB_CheckLength(TIn value)
     return result;
 }
 
+/// Get the page fault counts for this process.
+/// @param major Major (I/O) page faults are returned here. [out]
+/// @param minor Minor page faults are returned here. [out]
+/// @return true if the counts are available.
+static bool s_GetPageFaults(Int8 & major, Int8 & minor)
+{
+#if defined(NCBI_OS_UNIX)
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, & ru) == 0) {
+        major = ru.ru_majflt;
+        minor = ru.ru_minflt;
+        return true;
+    }
+#endif
+    major = minor = -1;
+    return false;
+}
+
+/// Read the SeqDB preload setting from the application registry.
+static bool s_GetPreloadConfig()
+{
+    CNcbiApplication* app = CNcbiApplication::Instance();
+    if (app) {
+        return app->GetConfig().GetBool("BLAST", "SEQDB_PRELOAD", false,
+                                        0, CNcbiRegistry::eReturn);
+    }
+    return false;
+}
+
 CSeqDBAtlas::CSeqDBAtlas(bool use_mmap)
     : m_UseMmap           (use_mmap),
       m_CurAlloc          (0),
@@ -190,11 +220,13 @@ CSeqDBAtlas::CSeqDBAtlas(bool use_mmap)
       m_OpenRegionsTrigger(CSeqDBMapStrategy::eOpenRegionsWindow),
       m_MaxFileSize       (0),
       m_Strategy          (*this),
-      m_SearchPath        (GenerateSearchPath())
+      m_SearchPath        (GenerateSearchPath()),
+      m_Preload           (s_GetPreloadConfig())
 {
     m_Alloc = false;
     m_OpenedFilesCount = 0;
     m_MaxOpenedFilesCount = 0;
+    s_GetPageFaults(m_MajorFaultsBase, m_MinorFaultsBase);
     Verify(true);
 }
 
@@ -466,6 +498,8 @@ EMemoryAdvise CRegionMap::sm_MmapStrategy_Index    = eMADV_Normal;
 
 EMemoryAdvise CRegionMap::sm_MmapStrategy_Sequence = eMADV_Normal;
 
+bool CRegionMap::sm_MmapAdaptive_Sequence = true;
+
 CRegionMap::CRegionMap(const string * fname, int fid, TIndx begin, TIndx end)
     : m_Data     (0),
       m_MemFile  (0),
@@ -556,6 +590,140 @@ void CSeqDBAtlas::UnregisterExternal(CSeqDBMemReg & memreg)
 
 // 16 GB should be enough
 
+void CSeqDBAtlas::MentionMapped(Int8 bytes, Int8 preload, double seconds)
+{
+    CFastMutexGuard guard(m_StatsLock);
+    m_MmapStats.files_mapped ++;
+    m_MmapStats.bytes_mapped += bytes;
+    m_MmapStats.peak_bytes_mapped =
+        max(m_MmapStats.peak_bytes_mapped, m_MmapStats.bytes_mapped);
+    m_MmapStats.preload_bytes += preload;
+    m_MmapStats.map_seconds += seconds;
+}
+
+void CSeqDBAtlas::MentionUnmapped(Int8 bytes)
+{
+    CFastMutexGuard guard(m_StatsLock);
+    m_MmapStats.bytes_mapped -= bytes;
+}
+
+void CSeqDBAtlas::MentionReadAhead(Int8 bytes, double seconds)
+{
+    CFastMutexGuard guard(m_StatsLock);
+    m_MmapStats.readahead_requests ++;
+    m_MmapStats.readahead_bytes += bytes;
+    m_MmapStats.map_seconds += seconds;
+}
+
+void CSeqDBAtlas::MentionAdviceChange()
+{
+    CFastMutexGuard guard(m_StatsLock);
+    m_MmapStats.advice_changes ++;
+}
+
+void CSeqDBAtlas::GetMmapStats(SSeqDBMmapStats & stats)
+{
+    {{
+        CFastMutexGuard guard(m_StatsLock);
+        stats = m_MmapStats;
+    }}
+    stats.sequential = IsSequential();
+
+    Int8 major(0), minor(0);
+    if (m_MajorFaultsBase >= 0 && s_GetPageFaults(major, minor)) {
+        stats.major_faults = major - m_MajorFaultsBase;
+        stats.minor_faults = minor - m_MinorFaultsBase;
+    }
+}
+
+void CSeqDBFileMemMap::x_AdviseMapping(double map_seconds)
+{
+    CStopWatch sw(CStopWatch::eStart);
+
+    void * data = m_MappedFile->GetPtr();
+    size_t size = m_MappedFile->GetSize();
+    Int8 preload = 0;
+
+    if (data && size) {
+        if (IsIndexFile()) {
+            EMemoryAdvise advice = CRegionMap::GetMmapStrategy_Index();
+
+            if (advice != eMADV_Normal) {
+                MemoryAdvise(data, size, advice);
+            }
+            if (advice == eMADV_WillNeed) {
+                preload = size;
+            }
+        } else if (IsOidOrderedFile()) {
+            EMemoryAdvise advice = CRegionMap::GetMmapStrategy_Sequence();
+
+            // Ask for the whole file to be read in the background,
+            // which is the closest portable analogue of MAP_POPULATE.
+            if (advice == eMADV_WillNeed || m_Atlas.GetPreload()) {
+                MemoryAdvise(data, size, eMADV_WillNeed);
+                preload = size;
+            }
+
+            CFastMutexGuard guard(m_HintLock);
+
+            if (CRegionMap::GetMmapAdaptive_Sequence()) {
+                m_Adaptive = true;
+                x_AdviseAccess(false);
+            } else if (advice == eMADV_Sequential) {
+                MemoryAdvise(data, size, advice);
+                m_Sequential = true;
+            }
+        }
+    }
+
+    m_Atlas.MentionMapped(size, preload, map_seconds + sw.Elapsed());
+}
+
+void CSeqDBFileMemMap::x_AdviseAccess(bool changed)
+{
+    m_Sequential = m_Atlas.IsSequential();
+    m_ReadAheadMark = m_ReadAheadEnd = 0;
+
+    void * data = m_MappedFile->GetPtr();
+    size_t size = m_MappedFile->GetSize();
+
+    if (data && size) {
+        MemoryAdvise(data,
+                     size,
+                     m_Sequential ? eMADV_Sequential : eMADV_Random);
+    }
+    if (changed) {
+        m_Atlas.MentionAdviceChange();
+    }
+}
+
+void CSeqDBFileMemMap::x_ReadAhead(TIndx offset)
+{
+    TIndx size = (TIndx) m_MappedFile->GetSize();
+    TIndx page = (TIndx) GetVirtualMemoryPageSize();
+    TIndx begin = max(offset, m_ReadAheadEnd);
+
+    // madvise() requires a page aligned address.
+    begin -= begin % page;
+
+    if (begin >= size) {
+        m_ReadAheadMark = size;
+        return;
+    }
+
+    CStopWatch sw(CStopWatch::eStart);
+    TIndx length = min(TIndx(eReadAheadWindow), size - begin);
+
+    MemoryAdvise((void *)(m_DataPtr + begin), (size_t) length, eMADV_WillNeed);
+
+    // The next request is issued when the reader is halfway through
+    // this window, so that I/O stays ahead of the reader.
+    m_ReadAheadEnd = begin + length;
+    m_ReadAheadMark = m_ReadAheadEnd - length / 2;
+
+    m_Atlas.MentionReadAhead(length, sw.Elapsed());
+}
+
 const Int8 CSeqDBMapStrategy::e_MaxMemory64 = Int8(16) << 30;
 
 Int8 CSeqDBMapStrategy::m_GlobalMaxBound = 0;
@@ -2457,6 +2457,20 @@ const string SeqDB_SimplifyAccession(const string &acc)
     else return "";
 }
 
+Uint8 SeqDB_IsamKeyHash(const char * key, size_t length)
+{
+    // 64 bit FNV-1a; see the lookup table notes in isam_files.txt.
+
+    Uint8 hash = NCBI_CONST_UINT8(14695981039346656037);
+
+    for(size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char) key[i];
+        hash *= NCBI_CONST_UINT8(1099511628211);
+    }
+
+    return hash;
+}
+
 void SeqDB_GetFileExtensions(bool db_is_protein, vector<string>& extn)
 {
     // NOTE: If more extensions are added, please keep in sync with
@@ -2474,6 +2488,7 @@ void SeqDB_GetFileExtensions(bool db_is_protein, vector<string>& extn)
     extn.push_back(kExtnMol + "nd");   // ISAM numeric data file
     extn.push_back(kExtnMol + "si");   // ISAM string index file
     extn.push_back(kExtnMol + "sd");   // ISAM string data file
+    extn.push_back(kExtnMol + "sl");   // ISAM string lookup table file
     extn.push_back(kExtnMol + "pi");   // ISAM PIG index file
     extn.push_back(kExtnMol + "pd");   // ISAM PIG data file
 
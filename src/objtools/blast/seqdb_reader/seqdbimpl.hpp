@@ -1127,6 +1127,12 @@ public:
         return m_Atlas.GetSliceSize();
     }
 
+    /// Retrieve memory mapping statistics from the atlas
+    void GetMmapStats(SSeqDBMmapStats & stats) const
+    {
+        m_Atlas.GetMmapStats(stats);
+    }
+
     /// Set the membership bit of all volumes
     void SetVolsMemBit(int mbit);
 
@@ -54,6 +54,40 @@ USING_SCOPE(objects);
 /// Special page size value which indicates a memory-only string index
 #define MEMORY_ONLY_PAGE_SIZE 1
 
+/// Format version of the string lookup table files
+#define LOOKUP_VERSION 1
+
+/// Size of the lookup table file header
+#define LOOKUP_HEADER_SIZE (4 * sizeof(Uint4))
+
+/// Size of one lookup table bucket (fingerprint, offset, index)
+#define LOOKUP_BUCKET_SIZE (3 * sizeof(Uint4))
+
+/// Number of keys to prefetch ahead in batched lookup table searches
+#define LOOKUP_PREFETCH_DISTANCE 8
+
+#if defined(__GNUC__)
+/// Hint that a lookup table bucket will be read soon
+#  define SEQDB_LOOKUP_PREFETCH(p) __builtin_prefetch(p)
+#else
+#  define SEQDB_LOOKUP_PREFETCH(p) ((void) (p))
+#endif
+
+/// Compute the lookup table fingerprint of a key hash
+///
+/// The fingerprint is the high half of the hash; zero is reserved to
+/// mark empty buckets.  This must match CWriteDB_IsamLookup.
+///
+/// @param hash
+///   The key hash, from SeqDB_IsamKeyHash.
+/// @return
+///   The fingerprint stored in the lookup table.
+static inline Uint4 s_LookupFingerprint(Uint8 hash)
+{
+    Uint4 fingerprint = (Uint4) (hash >> 32);
+    return fingerprint ? fingerprint : 1;
+}
+
 
 CSeqDBIsam::EErrorCode
 CSeqDBIsam::x_InitSearch(void)
@@ -117,11 +151,188 @@ CSeqDBIsam::x_InitSearch(void)
 
     m_KeySampleOffset = (9 * sizeof(Int4));
 
+    if (m_Type == eString) {
+        x_InitLookup();
+    }
+
     m_Initialized = true;
 
     return eNoError;
 }
 
+void CSeqDBIsam::x_InitLookup()
+{
+    m_LookupBuckets = 0;
+
+    TIndx file_length(0);
+
+    if (m_LookupFname.empty() ||
+        (m_PageSize == MEMORY_ONLY_PAGE_SIZE) ||
+        (! m_Atlas.GetFileSizeL(m_LookupFname, file_length)) ||
+        (file_length < (TIndx) LOOKUP_HEADER_SIZE)) {
+        return;
+    }
+
+    const Uint4 * header =
+        (const Uint4 *) m_LookupLease.GetFileDataPtr(m_LookupFname, 0);
+
+    Uint4 version     = SeqDB_GetStdOrd(& header[0]);
+    Uint4 num_buckets = SeqDB_GetStdOrd(& header[2]);
+    TIndx data_length = SeqDB_GetStdOrd(& header[3]);
+
+    TIndx expected_length =
+        LOOKUP_HEADER_SIZE + (TIndx) num_buckets * LOOKUP_BUCKET_SIZE;
+
+    // A table that does not match the data file (for example, one
+    // left behind when the ISAM files were rebuilt) is ignored, and
+    // searches fall back to the ISAM index.
+
+    if ((version != LOOKUP_VERSION) ||
+        (num_buckets == 0) ||
+        ((num_buckets & (num_buckets - 1)) != 0) ||
+        (data_length != m_DataFileLength) ||
+        (file_length != expected_length)) {
+
+        m_LookupLease.Clear();
+        return;
+    }
+
+    m_LookupBuckets = num_buckets;
+}
+
+const Uint4 * CSeqDBIsam::x_LookupBucket(const string & key, Uint8 hash)
+{
+    _ASSERT(m_LookupBuckets);
+
+    Uint4 fingerprint = s_LookupFingerprint(hash);
+    Uint4 mask        = m_LookupBuckets - 1;
+    Uint4 bucket      = (Uint4) hash & mask;
+
+    const Uint4 * table = (const Uint4 *)
+        m_LookupLease.GetFileDataPtr(m_LookupFname, LOOKUP_HEADER_SIZE);
+
+    const char * data_end =
+        m_DataLease.GetFileDataPtr(m_DataFname, m_DataFileLength);
+
+    // Linear probing; an empty bucket ends the search.  The probe
+    // limit only matters for a damaged table with no empty buckets.
+
+    for(Uint4 probes = 0; probes < m_LookupBuckets; probes++) {
+        const Uint4 * entry = table + 3 * bucket;
+        Uint4 entry_fp = SeqDB_GetStdOrd(entry);
+
+        if (entry_fp == 0) {
+            break;
+        }
+
+        if (entry_fp == fingerprint) {
+            TIndx offset = SeqDB_GetStdOrd(entry + 1);
+
+            if (offset < m_DataFileLength &&
+                x_DiffChar(key,
+                           m_DataLease.GetFileDataPtr(offset),
+                           data_end,
+                           true) == -1) {
+                return entry;
+            }
+        }
+
+        bucket = (bucket + 1) & mask;
+    }
+
+    return 0;
+}
+
+CSeqDBIsam::EErrorCode
+CSeqDBIsam::x_LookupStringSearch(const string   & term_in,
+                                 vector<string> & terms_out,
+                                 vector<string> & values_out,
+                                 vector<TIndx>  & indices_out)
+{
+    string key(term_in);
+    x_Lower(key);
+
+    const Uint4 * entry =
+        x_LookupBucket(key, SeqDB_IsamKeyHash(key.data(), key.size()));
+
+    if (! entry) {
+        return eNotFound;
+    }
+
+    // The bucket points at the first record with this key; the rest
+    // of the records with the same key follow it in the data file.
+
+    TIndx offset   = SeqDB_GetStdOrd(entry + 1);
+    TIndx term_num = SeqDB_GetStdOrd(entry + 2);
+
+    const char * beginp = m_DataLease.GetFileDataPtr(m_DataFname, offset);
+    const char * endp   = m_DataLease.GetFileDataPtr(m_DataFileLength);
+
+    x_ExtractPageData(key,
+                      term_num,
+                      beginp,
+                      endp,
+                      indices_out,
+                      terms_out,
+                      values_out);
+
+    return eNoError;
+}
+
+void CSeqDBIsam::x_TranslateSiListLookup(int vol_start, CSeqDBGiList & ids)
+{
+    int num_ids = ids.GetSize<string>();
+
+    if (! num_ids) return;
+
+    // Hash every untranslated key, then visit the keys in bucket
+    // order, so that the table is read front to back no matter how
+    // the list itself is sorted.
+
+    Uint4 mask = m_LookupBuckets - 1;
+
+    vector<Uint8> hashes(num_ids, 0);
+    vector< pair<Uint4, int> > order;
+    order.reserve(num_ids);
+
+    for(int i = 0; i < num_ids; i++) {
+        if (ids.IsValueSet<string>(i)) {
+            continue;
+        }
+
+        const string key = ids.GetKey<string>(i);
+        hashes[i] = SeqDB_IsamKeyHash(key.data(), key.size());
+        order.push_back(make_pair((Uint4) hashes[i] & mask, i));
+    }
+
+    sort(order.begin(), order.end());
+
+    const char * table =
+        m_LookupLease.GetFileDataPtr(m_LookupFname, LOOKUP_HEADER_SIZE);
+
+    string key;
+    int oid(-1);
+
+    for(size_t j = 0; j < order.size(); j++) {
+        if (j + LOOKUP_PREFETCH_DISTANCE < order.size()) {
+            Uint4 ahead = order[j + LOOKUP_PREFETCH_DISTANCE].first;
+            SEQDB_LOOKUP_PREFETCH(table + (TIndx) ahead * LOOKUP_BUCKET_SIZE);
+        }
+
+        int index = order[j].second;
+
+        const Uint4 * entry =
+            x_LookupBucket(ids.GetKey<string>(index), hashes[index]);
+
+        if (entry) {
+            TIndx offset = SeqDB_GetStdOrd(entry + 1);
+
+            x_LoadStringData(m_DataLease.GetFileDataPtr(offset), key, oid);
+            ids.SetValue<string>(index, oid + vol_start);
+        }
+    }
+}
+
 Int4 CSeqDBIsam::x_GetPageNumElements(Int4   sample_num,
                                       Int4 * start)
 {
@@ -996,6 +1207,13 @@ CSeqDBIsam::x_StringSearch(const string   & term_in,
         return eNotFound;
     }
 
+    if (m_LookupBuckets) {
+        return x_LookupStringSearch(term_in,
+                                    terms_out,
+                                    values_out,
+                                    indices_out);
+    }
+
     // We will set this option to avoid more complications
     bool ignore_case = true;
 
@@ -1151,6 +1369,7 @@ CSeqDBIsam::CSeqDBIsam(CSeqDBAtlas  & atlas,
       m_IdentType      (ident_type),
       m_IndexLease     (atlas),
       m_DataLease      (atlas),
+      m_LookupLease    (atlas),
       m_Type           (eNumeric),
       m_NumTerms       (0),
       m_NumSamples     (0),
@@ -1164,7 +1383,8 @@ CSeqDBIsam::CSeqDBIsam(CSeqDBAtlas  & atlas,
       m_FirstOffset    (0),
       m_LastOffset     (0),
       m_LongId         (false),
-      m_TermSize       (8)
+      m_TermSize       (8),
+      m_LookupBuckets  (0)
 {
     // These are the types that readdb.c seems to use.
 
@@ -1201,6 +1421,15 @@ CSeqDBIsam::CSeqDBIsam(CSeqDBAtlas  & atlas,
     }
     m_IndexLease.Init(m_IndexFname);
     m_DataLease.Init(m_DataFname);
+
+    // Accession indices may have a lookup table, which is mapped
+    // when the search is initialized; see x_InitLookup().
+
+    if (ident_type == eStringId) {
+        m_LookupFname = m_DataFname;
+        m_LookupFname[m_LookupFname.size() - 1] = 'l';
+    }
+
     if(m_Type == eNumeric) {
         m_PageSize = DEFAULT_NISAM_SIZE;
     } else {
@@ -1255,6 +1484,7 @@ void CSeqDBIsam::UnLease()
 {
     m_IndexLease.Clear();
     m_DataLease.Clear();
+    m_LookupLease.Clear();
 }
 
 bool CSeqDBIsam::x_IdentToOid(Int8 ident, TOid & oid)
@@ -1447,7 +1677,12 @@ void CSeqDBIsam::IdsToOids(int              vol_start,
         break;
 
     case eStringId:
-        x_TranslateGiList<string>(vol_start, ids);
+        x_InitLease();//Map files if needed
+        if ((m_Initialized || x_InitSearch() == eNoError) && m_LookupBuckets) {
+            x_TranslateSiListLookup(vol_start, ids);
+        } else {
+            x_TranslateGiList<string>(vol_start, ids);
+        }
         break;
 
     default:
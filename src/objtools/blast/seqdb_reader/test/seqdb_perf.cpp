@@ -122,6 +122,23 @@ CSeqDBPerfApp::x_ReportMemUsage() const
     SMemUsage total = std::accumulate(m_MemoryUsage.begin(),
                                       m_MemoryUsage.end(), SMemUsage());
     cout << total << endl;
+
+    if (m_BlastDb.NotEmpty()) {
+        SSeqDBMmapStats stats;
+        m_BlastDb->GetMmapStats(stats);
+        cout << "Files mapped: " << stats.files_mapped
+             << "; bytes mapped (peak): " << stats.bytes_mapped
+             << " (" << stats.peak_bytes_mapped << ")" << endl
+             << "Preloaded bytes: " << stats.preload_bytes
+             << "; read-ahead requests: " << stats.readahead_requests
+             << " (" << stats.readahead_bytes << " bytes)"
+             << "; advice changes: " << stats.advice_changes << endl
+             << "Page faults (major/minor): " << stats.major_faults
+             << "/" << stats.minor_faults
+             << "; time mapping and advising: " << stats.map_seconds
+             << "s; access order: "
+             << (stats.sequential ? "sequential" : "random") << endl;
+    }
 }
 
 int
@@ -196,6 +213,8 @@ CSeqDBPerfApp::x_InitApplicationData()
 //    CSeqDB::SetMmapStrategy(CSeqDB::eMmap_IndexFile, CSeqDB::eMmap_WillNeed);
 //    CSeqDB::SetMmapStrategy(CSeqDB::eMmap_SequenceFile, CSeqDB::eMmap_WillNeed);
 
+//    CSeqDB::SetMmapStrategy(CSeqDB::eMmap_SequenceFile, CSeqDB::eMmap_Adaptive);
+
     m_BlastDb.Reset(new CSeqDBExpert(kDbName, kSeqType));
     m_DbIsProtein = static_cast<bool>(m_BlastDb->GetSequenceType() == CSeqDB::eProtein);
 
@@ -32,6 +32,7 @@
   */
 #include <ncbi_pch.hpp>
 #include <corelib/ncbienv.hpp>
+#include <corelib/ncbithr.hpp>
 
 // Blast databases
 
@@ -778,6 +779,134 @@ CConstRef<CBioseq> CFastaBioseqSource::GetNext()
     return rv;
 }
 
+/// Reads Bioseqs from another source on a separate thread.
+///
+/// Parsing of the input then overlaps with the packing, header
+/// encoding and writing of the sequences already read.  Bioseqs are
+/// returned in the order the underlying source produces them; an
+/// error from that source is reported when its position is reached.
+class CPrefetchBioseqSource : public IBioseqSource {
+public:
+    /// Constructor; starts reading.
+    /// @param src Source to read from; must outlive this object. [in]
+    /// @param max_queued Maximum number of Bioseqs read ahead. [in]
+    CPrefetchBioseqSource(IBioseqSource & src, unsigned int max_queued);
+
+    /// Destructor; stops reading.
+    ~CPrefetchBioseqSource();
+
+    virtual CConstRef<CBioseq> GetNext();
+
+private:
+    /// One Bioseq read ahead, or the error which ended the input.
+    struct SPrefetched {
+        CConstRef<CBioseq> m_Bioseq; ///< Next Bioseq, empty at the end.
+        string             m_Error;  ///< Error message, if any.
+    };
+
+    /// The reading thread.
+    class CReader : public CThread {
+    public:
+        CReader(CPrefetchBioseqSource & owner) : m_Owner(owner) {}
+    protected:
+        virtual void * Main(void);
+    private:
+        CPrefetchBioseqSource & m_Owner;
+    };
+
+    IBioseqSource      & m_Source;  ///< Underlying source.
+    deque<SPrefetched>   m_Queue;   ///< Bioseqs read ahead.
+    CFastMutex           m_Lock;    ///< Protects m_Queue.
+    CSemaphore           m_Free;    ///< Free places in m_Queue.
+    CSemaphore           m_Ready;   ///< Entries in m_Queue.
+    volatile bool        m_Stop;    ///< Set to abandon reading.
+    bool                 m_Done;    ///< End of input was returned.
+    CRef<CReader>        m_Reader;  ///< Reading thread.
+};
+
+CPrefetchBioseqSource::CPrefetchBioseqSource(IBioseqSource & src,
+                                             unsigned int    max_queued)
+    : m_Source (src),
+      m_Free   (max_queued, max_queued + 1),
+      m_Ready  (0, max_queued + 1),
+      m_Stop   (false),
+      m_Done   (false)
+{
+    m_Reader.Reset(new CReader(*this));
+    m_Reader->Run();
+}
+
+CPrefetchBioseqSource::~CPrefetchBioseqSource()
+{
+    // Wake the reader if it waits for a free place; it stops before
+    // reading anything else.
+    m_Stop = true;
+    m_Free.Post();
+    m_Reader->Join();
+}
+
+void * CPrefetchBioseqSource::CReader::Main(void)
+{
+    CPrefetchBioseqSource & owner = m_Owner;
+
+    for(;;) {
+        owner.m_Free.Wait();
+        if (owner.m_Stop) {
+            break;
+        }
+
+        SPrefetched item;
+        try {
+            item.m_Bioseq = owner.m_Source.GetNext();
+        }
+        catch (const CException & e) {
+            item.m_Error = e.GetMsg();
+        }
+        catch (const exception & e) {
+            item.m_Error = e.what();
+        }
+        bool last = item.m_Bioseq.Empty();
+
+        {
+            CFastMutexGuard guard(owner.m_Lock);
+            owner.m_Queue.push_back(item);
+        }
+        owner.m_Ready.Post();
+
+        if (last) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+CConstRef<CBioseq> CPrefetchBioseqSource::GetNext()
+{
+    if (m_Done) {
+        return CConstRef<CBioseq>();
+    }
+
+    m_Ready.Wait();
+
+    SPrefetched item;
+    {
+        CFastMutexGuard guard(m_Lock);
+        item = m_Queue.front();
+        m_Queue.pop_front();
+    }
+
+    if (item.m_Bioseq.Empty()) {
+        m_Done = true;
+        if (! item.m_Error.empty()) {
+            NCBI_THROW(CWriteDBException, eFileErr, item.m_Error);
+        }
+    } else {
+        m_Free.Post();
+    }
+
+    return item.m_Bioseq;
+}
+
 bool CBuildDatabase::AddSequences(IBioseqSource & src, bool add_pig)
 {
     bool found = false;
@@ -1039,7 +1168,8 @@ CBuildDatabase::CBuildDatabase(const string         & dbname,
       m_Verbose      (false),
       m_ParseIDs     (((indexing & CWriteDB::eFullIndex) != 0 ? true : false)),
       m_LongIDs      (long_seqids),
-      m_FoundMatchingMasks(false)
+      m_FoundMatchingMasks(false),
+      m_NumThreads   (1)
 {
     s_CreateDirectories(dbname);
     const string output_dbname = CDirEntry::CreateAbsolutePath(dbname);
@@ -1091,7 +1221,8 @@ CBuildDatabase::CBuildDatabase(const string & dbname,
       m_Verbose      (false),
       m_ParseIDs     (parse_seqids),
       m_LongIDs      (long_seqids),
-      m_FoundMatchingMasks(false)
+      m_FoundMatchingMasks(false),
+      m_NumThreads   (1)
 {
     s_CreateDirectories(dbname);
     const string output_dbname = CDirEntry::CreateAbsolutePath(dbname);
@@ -1333,7 +1464,13 @@ bool CBuildDatabase::AddFasta(CNcbiIstream & fasta_file)
                                m_LongIDs);
 
         try {
-            success = AddSequences(fbs);
+            if (m_NumThreads > 1) {
+                const unsigned int kMaxQueued = 1024;
+                CPrefetchBioseqSource prefetch(fbs, kMaxQueued);
+                success = AddSequences(prefetch);
+            } else {
+                success = AddSequences(fbs);
+            }
 	    if (success == false)
             	NCBI_THROW(CWriteDBException, eFileErr, "No sequences added");
 
@@ -1512,6 +1649,16 @@ void CBuildDatabase::SetMaxFileSize(Uint8 max_file_size)
     m_OutputDb->SetMaxFileSize(max_file_size);
 }
 
+void CBuildDatabase::SetNumThreads(int num_threads)
+{
+#if defined(NCBI_THREADS)
+    m_NumThreads = max(num_threads, 1);
+#else
+    m_NumThreads = 1;
+#endif
+    m_OutputDb->SetNumThreads(m_NumThreads);
+}
+
 int
 CBuildDatabase::RegisterMaskingAlgorithm(EBlast_filter_program program,
                                          const string        & options,
@@ -188,6 +188,35 @@ string s_HexDumpFile(const string & fname,
     return s_HexDumpFile(fname, layout, base);
 }
 
+// Read a database file as s_HexDumpFile does, but leave out the
+// creation date recorded in the header of the index file (.pin or
+// .nin), so that builds made a minute apart still compare equal.
+
+static Uint4 s_ReadBE4(const string & raw, size_t offset)
+{
+    BOOST_REQUIRE(offset + 4 <= raw.size());
+    const unsigned char * p = (const unsigned char *) raw.data() + offset;
+    return (Uint4(p[0]) << 24) | (Uint4(p[1]) << 16) | (Uint4(p[2]) << 8) | p[3];
+}
+
+string s_HexDumpDbFile(const string & fname)
+{
+    ifstream f(fname.c_str(), ios::binary);
+    string raw((istreambuf_iterator<char>(f)), istreambuf_iterator<char>());
+
+    if (NStr::EndsWith(fname, ".pin") || NStr::EndsWith(fname, ".nin")) {
+        // Format version and sequence type, then the title and the
+        // date, each with its length in front.
+        size_t offset = 8;
+        offset += 4 + s_ReadBE4(raw, offset);
+        size_t date_len = s_ReadBE4(raw, offset);
+        BOOST_REQUIRE(offset + 4 + date_len <= raw.size());
+        raw.erase(offset, 4 + date_len);
+    }
+
+    return s_HexDumpText(raw, 16, 16);
+}
+
 // Copy the sequences listed in 'ids' (integers or FASTA Seq-ids) from
 // the CSeqDB object to the CWriteDB object, using CBioseqs as the
 // intermediate data.
@@ -1318,6 +1347,100 @@ BOOST_AUTO_TEST_CASE(MultiVolume)
     s_WrapUpFiles(f);
 }
 
+BOOST_AUTO_TEST_CASE(MultiVolumeThreaded)
+{
+    CSeqDB wdb("data/writedb_prot", CSeqDB::eProtein);
+
+    int gis[] = { 129295, 129296, 129297, 129299, 0 };
+    const char * names[] = { "multivol_st", "multivol_mt" };
+    vector<string> files[2];
+
+    // Build the same database with one and with several threads.
+    for(int n = 0; n < 2; n++) {
+        CWriteDB db(names[n],
+                    CWriteDB::eProtein,
+                    "title",
+                    CWriteDB::eFullIndex);
+
+        db.SetMaxVolumeLetters(500);
+        db.SetNumThreads(n ? 4 : 1);
+
+        for(int i = 0; gis[i]; i++) {
+            int oid(0);
+            wdb.GiToOid(gis[i], oid);
+            db.AddSequence(*wdb.GetBioseq(oid));
+        }
+
+        db.Close();
+        db.ListFiles(files[n]);
+    }
+
+    BOOST_REQUIRE_EQUAL(files[0].size(), files[1].size());
+
+    // The alias file lists the volume names, all others must match.
+    for(size_t i = 0; i < files[0].size(); i++) {
+        if (NStr::EndsWith(files[0][i], ".pal")) {
+            continue;
+        }
+        BOOST_REQUIRE_EQUAL(s_HexDumpDbFile(files[0][i]),
+                            s_HexDumpDbFile(files[1][i]));
+    }
+
+    s_WrapUpFiles(files[0]);
+    s_WrapUpFiles(files[1]);
+}
+
+BOOST_AUTO_TEST_CASE(MultiVolumeThreadedFasta)
+{
+    const char * names[] = { "fastavol_st", "fastavol_mt" };
+    vector<string> files[2];
+
+    // Build the same database from FASTA with one and with several
+    // threads; with several, the FASTA is parsed ahead on its own
+    // thread while the volumes are written.
+    for(int n = 0; n < 2; n++) {
+        CNcbiOstrstream log;
+        CBuildDatabase db(names[n], "title", true, false, true, false, &log);
+
+        db.SetMaxFileSize(4096);
+        db.SetNumThreads(n ? 4 : 1);
+        db.StartBuild();
+
+        // FASTA file contains 25 sequences.
+        CNcbiIfstream fasta("data/some_prots.fsa");
+        BOOST_REQUIRE(db.AddFasta(fasta));
+        BOOST_REQUIRE(db.EndBuild());
+
+        // EndBuild() logs every file it made.
+        vector<string> lines;
+        NStr::Split(string(CNcbiOstrstreamToString(log)), "\n", lines);
+        ITERATE(vector<string>, line, lines) {
+            if (NStr::StartsWith(*line, "file: ")) {
+                files[n].push_back(line->substr(6));
+            }
+        }
+    }
+
+    BOOST_REQUIRE(files[0].size() > 3);
+    BOOST_REQUIRE_EQUAL(files[0].size(), files[1].size());
+
+    for(int n = 0; n < 2; n++) {
+        CSeqDB db(names[n], CSeqDB::eProtein);
+        BOOST_REQUIRE_EQUAL(25, db.GetNumSeqs());
+    }
+
+    for(size_t i = 0; i < files[0].size(); i++) {
+        if (NStr::EndsWith(files[0][i], ".pal")) {
+            continue;
+        }
+        BOOST_REQUIRE_EQUAL(s_HexDumpDbFile(files[0][i]),
+                            s_HexDumpDbFile(files[1][i]));
+    }
+
+    s_WrapUpFiles(files[0]);
+    s_WrapUpFiles(files[1]);
+}
+
 BOOST_AUTO_TEST_CASE(UsPatId)
 {
 
@@ -1471,6 +1594,77 @@ BOOST_AUTO_TEST_CASE(HashToOid)
     s_WrapUpDb(*nucl);
 }
 
+BOOST_AUTO_TEST_CASE(AccessionLookupTable)
+{
+
+    CSeqDBExpert wdb_p("data/writedb_prot", CSeqDB::eProtein);
+
+    const char* accs[] = {
+        "AAC77159.1", "AAC76880.1", "AAC76230.1", "AAC76373.1",
+        "AAC77137.1", "AAC76637.2", "AAA58101.1", "AAC76702.1",
+        "AAC77109.1", "AAC76757.1", "AAA58162.1", "AAC76604.1", 0
+    };
+
+    TIdList ids;
+    s_BuildIds(ids, accs);
+
+    typedef CWriteDB::EIndexType TType;
+
+    TType itype = TType(CWriteDB::eFullIndex | CWriteDB::eAddAccLookup);
+
+    CRef<CWriteDB> plain(new CWriteDB("w-prot-acc-plain",
+                                      CWriteDB::eProtein,
+                                      "test of accession lookup (ISAM)",
+                                      CWriteDB::eFullIndex));
+
+    CRef<CWriteDB> lookup(new CWriteDB("w-prot-acc-lookup",
+                                       CWriteDB::eProtein,
+                                       "test of accession lookup (table)",
+                                       itype));
+
+    s_DupIdsBioseq(*plain, wdb_p, ids, 99);
+    s_DupIdsBioseq(*lookup, wdb_p, ids, 99);
+
+    plain->Close();
+    lookup->Close();
+
+    vector<string> files;
+    lookup->ListFiles(files);
+    BOOST_REQUIRE(find(files.begin(), files.end(),
+                       string("w-prot-acc-lookup.psl")) != files.end());
+
+    {
+        CSeqDB rd_plain("w-prot-acc-plain", CSeqDB::eProtein);
+        CSeqDB rd_lookup("w-prot-acc-lookup", CSeqDB::eProtein);
+
+        // Both forms of the index must resolve every key the same
+        // way, including version-less and mixed case accessions.
+
+        for(const char ** ptr = accs; *ptr; ptr ++) {
+            string acc(*ptr);
+            string nover(acc, 0, acc.find('.'));
+
+            const string keys[] = { acc, nover, NStr::ToLower(nover) };
+
+            for(size_t i = 0; i < (sizeof(keys)/sizeof(*keys)); i++) {
+                vector<int> oids1, oids2;
+                rd_plain.AccessionToOids(keys[i], oids1);
+                rd_lookup.AccessionToOids(keys[i], oids2);
+
+                BOOST_REQUIRE(! oids1.empty());
+                BOOST_REQUIRE(oids1 == oids2);
+            }
+        }
+
+        vector<int> oids;
+        rd_lookup.AccessionToOids("AAC00000.1", oids);
+        BOOST_REQUIRE(oids.empty());
+    }
+
+    s_WrapUpDb(*plain);
+    s_WrapUpDb(*lookup);
+}
+
 BOOST_AUTO_TEST_CASE(MismatchedDb_Bioseq) // per SB-1330
 {
     vector<string> files;
@@ -69,6 +69,7 @@ CWriteDB_Impl::CWriteDB_Impl(const string & dbname,
       m_MaskDataColumn   (-1),
       m_ParseIDs         (parse_ids),
       m_UseGiMask        (use_gi_mask),
+      m_NumThreads       (1),
       m_Pig              (0),
       m_Hash             (0),
       m_SeqLength        (0),
@@ -309,6 +310,74 @@ static void s_CheckDuplicateIds(set<CWriteDB_IsamKey<T> *,
     }
 };
 
+/// Closes a full volume on a separate thread.
+class CWriteDB_CloseVolumeThread : public CWriteDB_CloseThread {
+public:
+    /// Constructor.
+    /// @param volume Volume to close. [in]
+    /// @param num_threads Threads to use for the volume's files. [in]
+    CWriteDB_CloseVolumeThread(CRef<CWriteDB_Volume> volume, int num_threads)
+        : m_Volume(volume), m_NumThreads(num_threads)
+    {
+    }
+
+protected:
+    /// Close the volume.
+    virtual void x_Close()
+    {
+        m_Volume->Close(m_NumThreads);
+    }
+
+private:
+    /// The volume to close.
+    CRef<CWriteDB_Volume> m_Volume;
+
+    /// Threads to use for the volume's files.
+    int m_NumThreads;
+};
+
+void CWriteDB_Impl::x_CloseVolume(CRef<CWriteDB_Volume> volume)
+{
+    if (m_NumThreads <= 1) {
+        volume->Close();
+        return;
+    }
+
+    // Keep at most one volume per spare thread in flight; each one
+    // holds its ISAM tables in memory until it is written.
+    if (m_ClosingVolumes.size() + 1 >= (size_t) m_NumThreads) {
+        CRef<CWriteDB_CloseThread> oldest = m_ClosingVolumes.front();
+        m_ClosingVolumes.erase(m_ClosingVolumes.begin());
+        oldest->Finish();
+    }
+
+    CRef<CWriteDB_CloseThread> thr
+        (new CWriteDB_CloseVolumeThread(volume, m_NumThreads));
+    thr->Run();
+    m_ClosingVolumes.push_back(thr);
+}
+
+void CWriteDB_Impl::x_FinishClosingVolumes()
+{
+    string error;
+
+    NON_CONST_ITERATE(TWriteDBCloseThreads, iter, m_ClosingVolumes) {
+        try {
+            (**iter).Finish();
+        }
+        catch (const CWriteDBException & e) {
+            if (error.empty()) {
+                error = e.GetMsg();
+            }
+        }
+    }
+    m_ClosingVolumes.clear();
+
+    if (! error.empty()) {
+        NCBI_THROW(CWriteDBException, eFileErr, error);
+    }
+}
+
 void CWriteDB_Impl::Close()
 {
     if (m_Closed)
@@ -316,12 +385,25 @@ void CWriteDB_Impl::Close()
 
     m_Closed = true;
 
-    x_Publish();
+    try {
+        x_Publish();
+    }
+    catch (...) {
+        // Report the original error, not that of a background close.
+        try {
+            x_FinishClosingVolumes();
+        }
+        catch (const CWriteDBException &) {
+        }
+        throw;
+    }
     m_Sequence.erase();
     m_Ambig.erase();
 
+    x_FinishClosingVolumes();
+
     if (! m_Volume.Empty()) {
-        m_Volume->Close();
+        m_Volume->Close(m_NumThreads);
 
         if (m_UseGiMask) {
             for (unsigned int i=0; i<m_GiMasks.size(); ++i) {
@@ -1036,7 +1118,7 @@ void CWriteDB_Impl::x_Publish()
         int index = (int) m_VolumeList.size();
 
         if (m_Volume.NotEmpty()) {
-            m_Volume->Close();
+            x_CloseVolume(m_Volume);
         }
 
         {
@@ -1411,6 +1493,15 @@ void CWriteDB_Impl::SetMaxVolumeLetters(Uint8 sz)
     m_MaxVolumeLetters = sz;
 }
 
+void CWriteDB_Impl::SetNumThreads(int num_threads)
+{
+#if defined(NCBI_THREADS)
+    m_NumThreads = max(num_threads, 1);
+#else
+    m_NumThreads = 1;
+#endif
+}
+
 CRef<CBlast_def_line_set>
 CWriteDB_Impl::ExtractBioseqDeflines(const CBioseq & bs, bool parse_ids,
                                      bool long_seqids)
@@ -203,6 +203,17 @@ public:
     /// @param sz Maximum sequence letters per volume.
     void SetMaxVolumeLetters(Uint8 sz);
 
+    /// Set the number of threads used to finalize volumes.
+    ///
+    /// With more than one thread, a full volume is closed (its ISAM
+    /// indices sorted and written) in the background while sequences
+    /// are added to the next volume, and the component files of each
+    /// volume are finalized concurrently.  The output is identical to
+    /// that of a single threaded build.
+    ///
+    /// @param num_threads Number of threads to use.
+    void SetNumThreads(int num_threads);
+
     /// Extract deflines from a CBioseq.
     ///
     /// Given a CBioseq, this method extracts and returns header info
@@ -377,6 +388,7 @@ private:
     map<int, int> m_MaskAlgoMap;      ///< Mapping from algo_id to gi-mask id
     bool          m_ParseIDs;         ///< Generate ISAM files
     bool          m_UseGiMask;        ///< Generate GI-based mask files
+    int           m_NumThreads;       ///< Threads used to close volumes.
 
     /// Column titles.
     vector<string> m_ColumnTitles;
@@ -612,6 +624,16 @@ private:
     /// List of all volumes so far, up to and including m_Volume.
     vector< CRef<CWriteDB_Volume> > m_VolumeList;
 
+    /// Full volumes which are being closed in the background.
+    TWriteDBCloseThreads m_ClosingVolumes;
+
+    /// Close a full volume, in the background if threads are enabled.
+    /// @param volume The volume to close. [in]
+    void x_CloseVolume(CRef<CWriteDB_Volume> volume);
+
+    /// Wait for all volumes being closed in the background.
+    void x_FinishClosingVolumes();
+
     /// Blob data for the current sequence, indexed by letter.
     vector< CRef<CBlastDbBlob> > m_Blobs;
 
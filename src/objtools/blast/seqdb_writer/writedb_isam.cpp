@@ -34,6 +34,7 @@
 #include <objtools/blast/seqdb_writer/writedb_error.hpp>
 #include <objtools/blast/seqdb_writer/writedb_isam.hpp>
 #include <objtools/blast/seqdb_writer/writedb_convert.hpp>
+#include <objtools/blast/seqdb_reader/seqdbcommon.hpp>
 #include <serial/objistr.hpp>
 #include <serial/objostr.hpp>
 #include <serial/serial.hpp>
@@ -100,7 +101,8 @@ CWriteDB_Isam::CWriteDB_Isam(EIsamType      itype,
                              bool           protein,
                              int            index,
                              Uint8          max_file_size,
-                             bool           sparse)
+                             bool           sparse,
+                             bool           lookup)
 {
     m_DFile.Reset(new CWriteDB_IsamData(itype,
                                         dbname,
@@ -114,6 +116,14 @@ CWriteDB_Isam::CWriteDB_Isam(EIsamType      itype,
                                          index,
                                          m_DFile,
                                          sparse));
+
+    // Only accession indices are looked up by exact string key often
+    // enough for a lookup table to pay for itself.
+
+    if (lookup && itype == eAcc) {
+        m_LFile.Reset(new CWriteDB_IsamLookup(dbname, protein, index));
+        m_IFile->SetLookupFile(m_LFile);
+    }
 }
 
 CWriteDB_Isam::~CWriteDB_Isam()
@@ -148,12 +158,20 @@ void CWriteDB_Isam::Close()
 
     m_IFile->Close();
     m_DFile->Close();
+
+    if (m_LFile.NotEmpty()) {
+        m_LFile->Close();
+    }
 }
 
 void CWriteDB_Isam::RenameSingle()
 {
     m_IFile->RenameSingle();
     m_DFile->RenameSingle();
+
+    if (m_LFile.NotEmpty()) {
+        m_LFile->RenameSingle();
+    }
 }
 
 CWriteDB_IsamIndex::CWriteDB_IsamIndex(EWriteDBIsamType        itype,
@@ -209,6 +227,11 @@ CWriteDB_IsamIndex::~CWriteDB_IsamIndex()
     m_OidStringData.clear();
 }
 
+void CWriteDB_IsamIndex::SetLookupFile(CRef<CWriteDB_IsamLookup> lookup)
+{
+    m_LookupFile = lookup;
+}
+
 void CWriteDB_IsamIndex::x_WriteHeader()
 {
     int isam_version  = 1;
@@ -300,13 +323,14 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
     CWriteDB_PackedSemiTree::Iterator iter = m_StringSort.Begin();
     CWriteDB_PackedSemiTree::Iterator end_iter = m_StringSort.End();
 
-    string element, prev_elem;
+    string element, prev_elem, prev_key;
 
     // A string containing a NUL cannot possibly be valid, so I'm
     // using one as the "not set yet" value.
 
     element.resize(1);
     element[0] = char(0);
+    prev_key = element;
 
     while(iter != end_iter) {
         prev_elem.swap(element);
@@ -345,12 +369,30 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
         }
         output_count ++;
 
+        // Records with the same key are adjacent, so the lookup table
+        // only needs the first record of each run.
+
+        if (m_LookupFile.NotEmpty()) {
+            size_t key_len = element.find((char) eKeyDelim);
+            _ASSERT(key_len != string::npos);
+
+            if (prev_key.compare(0, string::npos,
+                                 element, 0, key_len) != 0) {
+                prev_key.assign(element, 0, key_len);
+                m_LookupFile->AddKey(prev_key, data_pos, index);
+            }
+        }
+
         data_pos = m_DataFile->Write(element);
         index ++;
 
         ++iter;
     }
 
+    if (m_LookupFile.NotEmpty()) {
+        m_LookupFile->SetDataFileLength(data_pos);
+    }
+
     // Write the final data position.
 
     WriteInt4(data_pos);
@@ -799,6 +841,96 @@ void CWriteDB_IsamData::x_Flush()
 {
 }
 
+CWriteDB_IsamLookup::CWriteDB_IsamLookup(const string & dbname,
+                                         bool           protein,
+                                         int            index)
+    : CWriteDB_File   (dbname,
+                       protein ? "psl" : "nsl",
+                       index,
+                       0,
+                       false),
+      m_DataFileLength(0)
+{
+}
+
+CWriteDB_IsamLookup::~CWriteDB_IsamLookup()
+{
+}
+
+void CWriteDB_IsamLookup::AddKey(const CTempString & key,
+                                 int                 data_offset,
+                                 int                 term_num)
+{
+    SLookupKey k;
+    k.hash   = SeqDB_IsamKeyHash(key.data(), key.size());
+    k.offset = (Uint4) data_offset;
+    k.term   = (Uint4) term_num;
+
+    m_Keys.push_back(k);
+}
+
+void CWriteDB_IsamLookup::x_Flush()
+{
+    // Lookup table files have a four word header followed by an
+    // open addressing hash table, all in big endian order:
+    //
+    //   Int4 version, Int4 number of keys, Int4 number of buckets,
+    //   Int4 length of the ISAM data file, then for each bucket:
+    //   Uint4 fingerprint, Uint4 data offset, Uint4 record index.
+    //
+    // The bucket count is a power of two and at most two thirds of
+    // the buckets are used, so that probe sequences stay short.  The
+    // low bits of the key hash select the first bucket; collisions
+    // are resolved by linear probing.  The high 32 bits of the hash
+    // are stored as a fingerprint (zero marks an empty bucket), so a
+    // probe only touches the data file when the fingerprint matches.
+
+    if (m_Keys.empty()) {
+        return;
+    }
+
+    Uint4 num_buckets = 2;
+
+    while (num_buckets < m_Keys.size() + m_Keys.size() / 2) {
+        num_buckets <<= 1;
+    }
+
+    Uint4 mask = num_buckets - 1;
+    vector<Uint4> table(3 * (size_t) num_buckets, 0);
+
+    ITERATE(vector<SLookupKey>, iter, m_Keys) {
+        Uint4 fingerprint = (Uint4) (iter->hash >> 32);
+
+        if (fingerprint == 0) {
+            fingerprint = 1;
+        }
+
+        Uint4 bucket = (Uint4) iter->hash & mask;
+
+        while (table[3 * bucket] != 0) {
+            bucket = (bucket + 1) & mask;
+        }
+
+        table[3 * bucket]     = fingerprint;
+        table[3 * bucket + 1] = iter->offset;
+        table[3 * bucket + 2] = iter->term;
+    }
+
+    Create();
+
+    WriteInt4(1);
+    WriteInt4((int) m_Keys.size());
+    WriteInt4((int) num_buckets);
+    WriteInt4(m_DataFileLength);
+
+    ITERATE(vector<Uint4>, iter, table) {
+        WriteInt4((int) *iter);
+    }
+
+    vector<SLookupKey> tmp;
+    m_Keys.swap(tmp);
+}
+
 bool CWriteDB_IsamIndex::CanFit(int num)
 {
     return (m_DataFileSize + (num+1) * m_BytesPerElem) < m_MaxFileSize;
@@ -816,6 +948,10 @@ void CWriteDB_Isam::ListFiles(vector<string> & files) const
     if (! m_IFile->Empty()) {
         files.push_back(m_IFile->GetFilename());
         files.push_back(m_DFile->GetFilename());
+
+        if (m_LFile.NotEmpty()) {
+            files.push_back(m_LFile->GetFilename());
+        }
     }
 }
 
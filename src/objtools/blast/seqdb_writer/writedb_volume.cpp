@@ -40,6 +40,95 @@ BEGIN_NCBI_SCOPE
 /// Include C++ std library symbols.
 USING_SCOPE(std);
 
+void * CWriteDB_CloseThread::Main(void)
+{
+    try {
+        x_Close();
+    }
+    catch (const CException & e) {
+        m_Error = e.GetMsg();
+    }
+    catch (const exception & e) {
+        m_Error = e.what();
+    }
+    return NULL;
+}
+
+void CWriteDB_CloseThread::Finish()
+{
+    Join();
+
+    if (! m_Error.empty()) {
+        NCBI_THROW(CWriteDBException, eFileErr, m_Error);
+    }
+}
+
+void WriteDB_RunCloseThreads(TWriteDBCloseThreads & threads,
+                             int                    num_threads)
+{
+    size_t batch = (size_t) max(num_threads, 1);
+    string error;
+
+    for(size_t start = 0; start < threads.size(); start += batch) {
+        size_t end = min(threads.size(), start + batch);
+
+        for(size_t i = start; i < end; i++) {
+            threads[i]->Run();
+        }
+
+        for(size_t i = start; i < end; i++) {
+            try {
+                threads[i]->Finish();
+            }
+            catch (const CWriteDBException & e) {
+                if (error.empty()) {
+                    error = e.GetMsg();
+                }
+            }
+        }
+    }
+
+    if (! error.empty()) {
+        NCBI_THROW(CWriteDBException, eFileErr, error);
+    }
+}
+
+/// Closes one component file of a volume on a separate thread.
+template<class TFile>
+class CWriteDB_CloseFileThread : public CWriteDB_CloseThread {
+public:
+    /// Constructor.
+    /// @param file Component file to close. [in]
+    CWriteDB_CloseFileThread(CRef<TFile> file)
+        : m_File(file)
+    {
+    }
+
+protected:
+    /// Close the file.
+    virtual void x_Close()
+    {
+        m_File->Close();
+    }
+
+private:
+    /// The file to close.
+    CRef<TFile> m_File;
+};
+
+/// Add a closing thread for a component file to a list.
+/// @param threads List to append to. [in|out]
+/// @param file Component file to close. [in]
+template<class TFile>
+static void s_AddCloseThread(TWriteDBCloseThreads & threads,
+                             CRef<TFile>            file)
+{
+    if (file.NotEmpty()) {
+        threads.push_back(CRef<CWriteDB_CloseThread>
+                          (new CWriteDB_CloseFileThread<TFile>(file)));
+    }
+}
+
 CWriteDB_Volume::CWriteDB_Volume(const string & dbname,
                                  bool           protein,
                                  const string & title,
@@ -97,12 +186,16 @@ CWriteDB_Volume::CWriteDB_Volume(const string & dbname,
                                          max_file_size,
                                          false));
 
+        bool acc_lookup =
+            (m_Indices & CWriteDB::eAddAccLookup) == CWriteDB::eAddAccLookup;
+
         m_AccIsam.Reset(new CWriteDB_Isam(eAcc,
                                           dbname,
                                           protein,
                                           index,
                                           max_file_size,
-                                          sparse));
+                                          sparse,
+                                          acc_lookup));
 
         if (m_Indices & CWriteDB::eAddTrace) {
             m_TraceIsam.Reset(new CWriteDB_Isam(eTrace,
@@ -300,8 +393,13 @@ int CWriteDB_Volume::x_FindNuclLength(const string & seq)
     return WriteDB_FindSequenceLength(m_Protein, seq);
 }
 
-void CWriteDB_Volume::Close()
+void CWriteDB_Volume::Close(int num_threads)
 {
+    if (num_threads > 1) {
+        x_CloseConcurrently(num_threads);
+        return;
+    }
+
     if (m_Open) {
         m_Open = false;
 
@@ -337,6 +435,43 @@ void CWriteDB_Volume::Close()
 #endif
 }
 
+void CWriteDB_Volume::x_CloseConcurrently(int num_threads)
+{
+    TWriteDBCloseThreads threads;
+
+    if (m_Open) {
+        m_Open = false;
+
+        // Each component file (and each ISAM index) is built from its
+        // own in-memory data, so they can be sorted and written in
+        // parallel.
+        s_AddCloseThread(threads, m_Idx);
+        s_AddCloseThread(threads, m_Hdr);
+        s_AddCloseThread(threads, m_Seq);
+
+        if (m_Indices != CWriteDB::eNoIndex) {
+            if (m_Protein) {
+                s_AddCloseThread(threads, m_PigIsam);
+            }
+            s_AddCloseThread(threads, m_GiIsam);
+            s_AddCloseThread(threads, m_AccIsam);
+            s_AddCloseThread(threads, m_GiIndex);
+            s_AddCloseThread(threads, m_TraceIsam);
+            s_AddCloseThread(threads, m_HashIsam);
+        }
+    }
+
+#if ((!defined(NCBI_COMPILER_WORKSHOP) || (NCBI_COMPILER_VERSION  > 550)) && \
+     (!defined(NCBI_COMPILER_MIPSPRO)) )
+    NON_CONST_ITERATE(vector< CRef<CWriteDB_Column> >, iter, m_Columns) {
+        s_AddCloseThread(threads, *iter);
+    }
+#endif
+
+    WriteDB_RunCloseThreads(threads, num_threads);
+    m_IdSet.clear();
+}
+
 void CWriteDB_Volume::RenameSingle()
 {
     _ASSERT(! m_Open);
@@ -42,6 +42,7 @@
 #include <objects/seq/seq__.hpp>
 #include <objtools/blast/seqdb_writer/writedb_files.hpp>
 #include <objtools/blast/seqdb_writer/writedb_isam.hpp>
+#include <corelib/ncbithr.hpp>
 #include "writedb_column.hpp"
 
 BEGIN_NCBI_SCOPE
@@ -98,6 +99,45 @@ private:
 };
 
 
+/// CWriteDB_CloseThread class
+///
+/// Finalizes one part of a database (a component file or a whole
+/// volume) on a separate thread.  Errors are kept until Join(), so
+/// that the owner can report them on its own thread.
+
+class CWriteDB_CloseThread : public CThread {
+public:
+    /// Wait for the thread to finish.
+    ///
+    /// Throws a CWriteDBException if closing failed.
+    void Finish();
+
+protected:
+    /// Perform the actual work.
+    virtual void x_Close() = 0;
+
+    /// Thread entry point.
+    virtual void * Main(void);
+
+private:
+    /// Error message, empty on success.
+    string m_Error;
+};
+
+/// Type used for lists of closing threads.
+typedef vector< CRef<CWriteDB_CloseThread> > TWriteDBCloseThreads;
+
+/// Run and wait for a list of closing threads.
+///
+/// At most num_threads threads are running at any time.  The first
+/// error is rethrown after all threads have finished.
+///
+/// @param threads Threads to run. [in]
+/// @param num_threads Maximum number of concurrent threads. [in]
+void WriteDB_RunCloseThreads(TWriteDBCloseThreads & threads,
+                             int                    num_threads);
+
+
 /// CWriteDB_Volume class
 ///
 /// This manufactures a blast database volume from sequences.
@@ -173,8 +213,12 @@ public:
     /// This method finalizes and closes all files associated with
     /// this volume.  (This is not a trivial operation, because ISAM
     /// indices and the index file (pin or nin) cannot be written
-    /// until all of the data has been seen.)
-    void Close();
+    /// until all of the data has been seen.)  If num_threads is
+    /// greater than one, the component files are finalized
+    /// concurrently; their contents do not depend on this.
+    ///
+    /// @param num_threads Maximum number of threads to use. [in]
+    void Close(int num_threads = 1);
 
     /// Get the name of the volume.
     ///
@@ -238,6 +282,10 @@ public:
 #endif
 
 private:
+    /// Close the volume, finalizing its files on several threads.
+    /// @param num_threads Maximum number of threads to use. [in]
+    void x_CloseConcurrently(int num_threads);
+
     // Configuration.
 
     string           m_DbName;      ///< Base name of the database.
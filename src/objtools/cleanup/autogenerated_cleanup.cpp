@@ -3620,6 +3620,9 @@ void CAutogeneratedCleanup::x_BasicCleanupSeqEntry_set( CBioseq_set & arg0 )
 
 void CAutogeneratedCleanup::BasicCleanupSeqEntry( CSeq_entry & arg0 )
 { // type Choice
+  if( m_NewCleanup.x_SkipUnchangedEntryBC( arg0 ) ) {
+    return;
+  }
   m_NewCleanup.EnteringEntry( arg0 );
   m_NewCleanup.x_CopyGBBlockDivToOrgnameDiv( arg0 );
   switch( arg0.Which() ) {
@@ -3924,6 +3927,9 @@ void CAutogeneratedCleanup::x_BasicCleanupBioseqSet_seq_set_E_E_set( CBioseq_set
 
 void CAutogeneratedCleanup::x_BasicCleanupBioseqSet_seq_set_E_E( CSeq_entry & arg0 )
 { // type Choice
+  if( m_NewCleanup.x_SkipUnchangedEntryBC( arg0 ) ) {
+    return;
+  }
   m_NewCleanup.EnteringEntry( arg0 );
   m_NewCleanup.x_CopyGBBlockDivToOrgnameDiv( arg0 );
   switch( arg0.Which() ) {
@@ -131,48 +131,6 @@ void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_ETC( arg0 );
 } // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_ETC
 
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_data_data_gene_gene( CGene_ref & arg0 )
-{ // type Sequence
-  m_NewCleanup.x_RemoveRedundantComment( arg0, *m_LastArg_ExtendedCleanupSeqFeat );
-  if( arg0.IsSetLocus_tag() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetLocus_tag() );
-  }
-  if( arg0.IsSetMaploc() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetMaploc() );
-  }
-} // end of x_ExtendedCleanupSeqFeat_data_data_gene_gene
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_data_data_gene( CGene_ref & arg0 )
-{ // type Reference
-    x_ExtendedCleanupSeqFeat_data_data_gene_gene( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_data_data_gene
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_imp_ETC( CImp_feat & arg0 )
-{ // type Sequence
-  if( arg0.IsSetKey() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetKey() );
-  }
-  if( arg0.IsSetLoc() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetLoc() );
-  }
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_imp_ETC
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_ETC( CImp_feat & arg0 )
-{ // type Reference
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_imp_ETC( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_ETC
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC( CProt_ref & arg0 )
-{ // type Sequence
-  m_NewCleanup.x_RemoveProtDescThatDupsProtName( arg0 );
-  m_NewCleanup.ProtRefEC( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_ETC( CProt_ref & arg0 )
-{ // type Reference
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_ETC
-
 void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_pub_ETC( CPubdesc & arg0 )
 { // type Sequence
   if( arg0.IsSetComment() ) {
@@ -185,45 +143,8 @@ void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_pub_ETC( arg0 );
 } // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_ETC
 
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC( CGene_ref & arg0 )
-{ // type Sequence
-  if( arg0.IsSetLocus_tag() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetLocus_tag() );
-  }
-  if( arg0.IsSetMaploc() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetMaploc() );
-  }
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_ETC( CGene_ref & arg0 )
-{ // type Reference
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_ETC
-
-template< typename Tcontainer_ncbi_cref_cgene_ref_ >
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_ETC( Tcontainer_ncbi_cref_cgene_ref_ & arg0 )
-{ // type UniSequence
-  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cgene_ref_, iter, arg0 ) { 
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_ETC( **iter );
-  }
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_ETC
-
-template< typename Tcontainer_ncbi_cref_cprot_ref_ >
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_ETC( Tcontainer_ncbi_cref_cprot_ref_ & arg0 )
-{ // type UniSequence
-  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cprot_ref_, iter, arg0 ) { 
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_ETC( **iter );
-  }
-} // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_ETC
-
 void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_ETC( CTxinit & arg0 )
 { // type Sequence
-  if( arg0.IsSetGene() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_ETC( arg0.SetGene() );
-  }
-  if( arg0.IsSetProtein() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_ETC( arg0.SetProtein() );
-  }
   if( arg0.IsSetTxorg() ) {
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_ETC( arg0.SetTxorg() );
   }
@@ -234,63 +155,15 @@ void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_ETC( arg0 );
 } // end of x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_ETC
 
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_data_data( CSeqFeatData & arg0 )
-{ // type Choice
-  switch( arg0.Which() ) {
-  case CSeqFeatData::e_Biosrc:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_ETC( arg0.SetBiosrc() );
-    break;
-  case CSeqFeatData::e_Gene:
-    x_ExtendedCleanupSeqFeat_data_data_gene( arg0.SetGene() );
-    break;
-  case CSeqFeatData::e_Imp:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_ETC( arg0.SetImp() );
-    break;
-  case CSeqFeatData::e_Org:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_ETC( arg0.SetOrg() );
-    break;
-  case CSeqFeatData::e_Prot:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_ETC( arg0.SetProt() );
-    break;
-  case CSeqFeatData::e_Pub:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_ETC( arg0.SetPub() );
-    break;
-  case CSeqFeatData::e_Txinit:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_ETC( arg0.SetTxinit() );
-    break;
-  default:
-    break;
-  }
-} // end of x_ExtendedCleanupSeqFeat_data_data
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_data( CSeqFeatData & arg0 )
-{ // type Reference
-    x_ExtendedCleanupSeqFeat_data_data( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_data
-
-void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_except_text_ETC( std::string & arg0 )
-{ // type Primitive
-  m_NewCleanup.x_ExceptTextEC( arg0 );
-} // end of x_ExtendedCleanupSeqFeat_except_text_ETC
-
 void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqFeat_xref_E_E_data_data_ETC( CSeqFeatData & arg0 )
 { // type Choice
   switch( arg0.Which() ) {
   case CSeqFeatData::e_Biosrc:
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_ETC( arg0.SetBiosrc() );
     break;
-  case CSeqFeatData::e_Gene:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_ETC( arg0.SetGene() );
-    break;
-  case CSeqFeatData::e_Imp:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_ETC( arg0.SetImp() );
-    break;
   case CSeqFeatData::e_Org:
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_ETC( arg0.SetOrg() );
     break;
-  case CSeqFeatData::e_Prot:
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_ETC( arg0.SetProt() );
-    break;
   case CSeqFeatData::e_Pub:
     x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_ETC( arg0.SetPub() );
     break;
@@ -345,31 +218,17 @@ void CAutogeneratedExtendedCleanup::ExtendedCleanupSeqFeat( CSeq_feat & arg0_raw
 
   CSeq_feat &arg0 = *new_feat;
 
-  m_LastArg_ExtendedCleanupSeqFeat = &arg0;
-
-  m_NewCleanup.x_BondEC( arg0 );
   m_NewCleanup.x_tRNAEC( arg0 );
   m_NewCleanup.CdRegionEC( arg0 );
-  m_NewCleanup.MoveDbxrefs( arg0 );
-  m_NewCleanup.MoveStandardName( arg0 );
-  m_NewCleanup.CreatePubFromFeat( arg0 );
   m_NewCleanup.ResynchProteinPartials( arg0 );
   m_NewCleanup.x_MoveSeqfeatOrgToSourceOrg( arg0 );
   if( arg0.IsSetData() ) {
-    x_ExtendedCleanupSeqFeat_data( arg0.SetData() );
-  }
-  if( arg0.IsSetExcept_text() ) {
-    x_ExtendedCleanupSeqFeat_except_text_ETC( arg0.SetExcept_text() );
-  }
-  if( arg0.IsSetTitle() ) {
-    x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_lineage_ETC( arg0.SetTitle() );
+    x_ExtendedCleanupSeqFeat_xref_E_E_data_ETC( arg0.SetData() );
   }
   if( arg0.IsSetXref() ) {
     x_ExtendedCleanupSeqFeat_xref_ETC( arg0.SetXref() );
   }
 
-  m_LastArg_ExtendedCleanupSeqFeat = NULL;
-
   if( efh ) {
     efh.Replace(arg0);
     arg0_raw.Assign( arg0 );
@@ -654,6 +513,9 @@ void CAutogeneratedExtendedCleanup::x_ExtendedCleanupSeqEntry_set( CBioseq_set &
 
 void CAutogeneratedExtendedCleanup::ExtendedCleanupSeqEntry( CSeq_entry & arg0 )
 { // type Choice
+  if( m_NewCleanup.x_SkipUnchangedEntryEC( arg0 ) ) {
+    return;
+  }
   switch( arg0.Which() ) {
   case CSeq_entry::e_Seq:
     x_ExtendedCleanupSeqEntry_seq( arg0.SetSeq() );
@@ -739,6 +601,9 @@ void CAutogeneratedExtendedCleanup::x_ExtendedCleanupBioseqSet_seq_set_E_E_set(
 
 void CAutogeneratedExtendedCleanup::x_ExtendedCleanupBioseqSet_seq_set_E_E( CSeq_entry & arg0 )
 { // type Choice
+  if( m_NewCleanup.x_SkipUnchangedEntryEC( arg0 ) ) {
+    return;
+  }
   switch( arg0.Which() ) {
   case CSeq_entry::e_Seq:
     x_ExtendedCleanupBioseqSet_seq_set_E_E_seq( arg0.SetSeq() );
@@ -42,9 +42,6 @@
 #include <objects/seqfeat/Org_ref.hpp>
 #include <objects/seqfeat/OrgName.hpp>
 #include <objects/seqfeat/MultiOrgName.hpp>
-#include <objects/seqfeat/Gene_ref.hpp>
-#include <objects/seqfeat/Imp_feat.hpp>
-#include <objects/seqfeat/Prot_ref.hpp>
 #include <objects/seq/Pubdesc.hpp>
 #include <objects/seqfeat/Txinit.hpp>
 #include <objects/seqfeat/SeqFeatXref.hpp>
@@ -72,7 +69,6 @@ public:
     CNewCleanup_imp & newCleanup ) : 
     m_Scope(scope), 
     m_NewCleanup(newCleanup), 
-    m_LastArg_ExtendedCleanupSeqFeat(NULL),
     m_Dummy(0)
   { } 
 
@@ -97,25 +93,10 @@ void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_o
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_org_ETC( COrg_ref & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_biosrc_ETC( CBioSource & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_biosrc_ETC( CBioSource & arg0 );
-  void x_ExtendedCleanupSeqFeat_data_data_gene_gene( CGene_ref & arg0 );
-  void x_ExtendedCleanupSeqFeat_data_data_gene( CGene_ref & arg0 );
-  void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_imp_ETC( CImp_feat & arg0 );
-  void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_imp_ETC( CImp_feat & arg0 );
-  void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC( CProt_ref & arg0 );
-  void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_E_ETC( CProt_ref & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_pub_ETC( CPubdesc & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_pub_ETC( CPubdesc & arg0 );
-  void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC( CGene_ref & arg0 );
-  void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_E_ETC( CGene_ref & arg0 );
-  template< typename Tcontainer_ncbi_cref_cgene_ref_ >
-void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_gene_ETC( Tcontainer_ncbi_cref_cgene_ref_ & arg0 );
-  template< typename Tcontainer_ncbi_cref_cprot_ref_ >
-void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_protein_ETC( Tcontainer_ncbi_cref_cprot_ref_ & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_txinit_ETC( CTxinit & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_txinit_ETC( CTxinit & arg0 );
-  void x_ExtendedCleanupSeqFeat_data_data( CSeqFeatData & arg0 );
-  void x_ExtendedCleanupSeqFeat_data( CSeqFeatData & arg0 );
-  void x_ExtendedCleanupSeqFeat_except_text_ETC( std::string & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_data_ETC( CSeqFeatData & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_data_ETC( CSeqFeatData & arg0 );
   void x_ExtendedCleanupSeqFeat_xref_E_E_ETC( CSeqFeatXref & arg0 );
@@ -178,7 +159,6 @@ void x_ExtendedCleanupBioseqSet_seq_set( Tcontainer_ncbi_cref_cseq_entry_ & arg0
   CScope & m_Scope;
   CNewCleanup_imp & m_NewCleanup;
 
-  CSeq_feat* m_LastArg_ExtendedCleanupSeqFeat;
 
   int m_Dummy;
 }; // end of CAutogeneratedExtendedCleanup
@@ -0,0 +1,96 @@
+#ifndef AUTOGENERATEDEXTENDEDFEATCLEANUP__HPP
+#define AUTOGENERATEDEXTENDEDFEATCLEANUP__HPP
+
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */ 
+/// This file was generated by application DATATOOL
+///
+/// ATTENTION:
+///   Don't edit or commit this file into SVN as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#include <objects/seqset/Seq_entry.hpp>
+#include <objects/seq/Bioseq.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_ext.hpp>
+#include <objects/seq/Map_ext.hpp>
+#include <objects/seqset/Bioseq_set.hpp>
+
+#include "newcleanupp.hpp"
+
+
+BEGIN_SCOPE(ncbi)
+BEGIN_SCOPE(objects)
+
+class CAutogeneratedExtendedFeatCleanup { 
+public: 
+  CAutogeneratedExtendedFeatCleanup(
+    CScope & scope,
+    CNewCleanup_imp & newCleanup ) : 
+    m_Scope(scope), 
+    m_NewCleanup(newCleanup), 
+    m_Dummy(0)
+  { } 
+
+  void ExtendedFeatCleanupSeqEntry( CSeq_entry & arg0 );
+
+private: 
+  void x_ExtendedFeatCleanupSeqEntry_set_set_annot_E_E_data_ftable_E_E_ETC( CSeq_feat & arg0_raw );
+  void x_ExtendedFeatCleanupSeqEntry_set_set_annot_E_E_data_ftable_E_ETC( CSeq_feat & arg0 );
+  template< typename Tcontainer_ncbi_cref_cseq_feat_ >
+void x_ExtendedFeatCleanupSeqEntry_set_set_annot_E_E_data_ftable_ETC( Tcontainer_ncbi_cref_cseq_feat_ & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_set_set_annot_E_E_data_ETC( CSeq_annot::C_Data & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_set_set_annot_E_E_ETC( CSeq_annot & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_set_set_annot_E_ETC( CSeq_annot & arg0 );
+  template< typename Tcontainer_ncbi_cref_cseq_annot_ >
+void x_ExtendedFeatCleanupSeqEntry_set_set_annot_ETC( Tcontainer_ncbi_cref_cseq_annot_ & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq_seq_inst_inst_ext_ext_map( CMap_ext & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq_seq_inst_inst_ext_ext( CSeq_ext & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq_seq_inst_inst_ext( CSeq_ext & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq_seq_inst_inst( CSeq_inst & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq_seq_inst( CSeq_inst & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq_seq( CBioseq & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_seq( CBioseq & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_set_set_seq_set_E( CSeq_entry & arg0 );
+  template< typename Tcontainer_ncbi_cref_cseq_entry_ >
+void x_ExtendedFeatCleanupSeqEntry_set_set_seq_set( Tcontainer_ncbi_cref_cseq_entry_ & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_set_set( CBioseq_set & arg0 );
+  void x_ExtendedFeatCleanupSeqEntry_set( CBioseq_set & arg0 );
+
+  CScope & m_Scope;
+  CNewCleanup_imp & m_NewCleanup;
+
+
+  int m_Dummy;
+}; // end of CAutogeneratedExtendedFeatCleanup
+
+END_SCOPE(objects)
+END_SCOPE(ncbi)
+
+#endif /* AUTOGENERATEDEXTENDEDFEATCLEANUP__HPP */
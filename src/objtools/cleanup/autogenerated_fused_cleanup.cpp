@@ -0,0 +1,3785 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */ 
+/// This file was generated by application DATATOOL
+///
+/// ATTENTION:
+///   Don't edit or commit this file into SVN as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#include <ncbi_pch.hpp>
+#include "autogenerated_fused_cleanup.hpp"
+#include "cleanup_utils.hpp"
+#include "autogenerated_cleanup_extra.hpp"
+#include <objects/misc/sequence_macros.hpp>
+
+BEGIN_SCOPE(ncbi)
+BEGIN_SCOPE(objects)
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_std_std_ETC( CDate_std & arg0 )
+{ // type Sequence
+  m_NewCleanup.x_DateStdBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_std_std_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_std_ETC( CDate_std & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_std_std_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_std_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_ETC( CDate & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CDate::e_Std:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_std_ETC( arg0.SetStd() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( CDate & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_rel_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_ETC( CPDB_seq_id & arg0 )
+{ // type Sequence
+  if( arg0.IsSetRel() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetRel() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_ETC( CPDB_seq_id & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_ETC( CSeq_id & arg0 )
+{ // type Choice
+  m_NewCleanup.SeqIdBC( arg0 );
+  switch( arg0.Which() ) {
+  case CSeq_id::e_Pdb:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_ETC( arg0.SetPdb() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( CSeq_id & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_b_ETC( CSeq_point & arg0 )
+{ // type Sequence
+  if( arg0.IsSetId() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetId() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_b_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC( CSeq_point & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_b_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_ETC( CSeq_bond & arg0 )
+{ // type Sequence
+  if( arg0.IsSetA() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC( arg0.SetA() );
+  }
+  if( arg0.IsSetB() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC( arg0.SetB() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_ETC( CSeq_bond & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv_equiv_E( CSeq_loc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_E1057_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv_equiv_E
+
+template< typename Tcontainer_ncbi_cref_cseq_loc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv_equiv( Tcontainer_ncbi_cref_cseq_loc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_loc_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv_equiv_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv_equiv
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv( CSeq_loc_equiv & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv_equiv( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_ETC( CSeq_interval & arg0 )
+{ // type Sequence
+  if( arg0.IsSetId() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetId() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC( CSeq_interval & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_mix_E( CSeq_loc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_E1057_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_mix_E
+
+template< typename Tcontainer_ncbi_cref_cseq_loc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_mix( Tcontainer_ncbi_cref_cseq_loc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_loc_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_mix_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_mix
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_ETC( CSeq_loc_mix & arg0 )
+{ // type Reference
+  m_NewCleanup.SeqLocMixBC( arg0 );
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_mix( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_interval_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_packed_int_ETC( Tcontainer_ncbi_cref_cseq_interval_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_interval_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_packed_int_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_ETC( CPacked_seqint & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_packed_int_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_packed_pnt_ETC( CPacked_seqpnt & arg0 )
+{ // type Sequence
+  if( arg0.IsSetId() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetId() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_packed_pnt_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_ETC( CPacked_seqpnt & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_packed_pnt_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_E1057_ETC( CSeq_loc & arg0 )
+{ // type Choice
+  m_NewCleanup.SeqLocBC( arg0 );
+  m_NewCleanup.x_BothStrandBC( arg0 );
+  switch( arg0.Which() ) {
+  case CSeq_loc::e_Bond:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_ETC( arg0.SetBond() );
+    break;
+  case CSeq_loc::e_Empty:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetEmpty() );
+    break;
+  case CSeq_loc::e_Equiv:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv( arg0.SetEquiv() );
+    break;
+  case CSeq_loc::e_Int:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC( arg0.SetInt() );
+    break;
+  case CSeq_loc::e_Mix:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_ETC( arg0.SetMix() );
+    break;
+  case CSeq_loc::e_Packed_int:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_ETC( arg0.SetPacked_int() );
+    break;
+  case CSeq_loc::e_Packed_pnt:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_ETC( arg0.SetPacked_pnt() );
+    break;
+  case CSeq_loc::e_Pnt:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC( arg0.SetPnt() );
+    break;
+  case CSeq_loc::e_Whole:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetWhole() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_E1057_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_E_ETC( CSeq_loc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_E1057_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_loc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( Tcontainer_ncbi_cref_cseq_loc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_loc_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_fields_E( CUser_field & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_fields_E
+
+template< typename Tcontainer_ncbi_cref_cuser_field_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_fields( Tcontainer_ncbi_cref_cuser_field_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cuser_field_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_fields_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_fields
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E( CUser_field & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E
+
+template< typename Tcontainer_ncbi_cref_cuser_field_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data( Tcontainer_ncbi_cref_cuser_field_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cuser_field_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_object1050( CUser_object & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_object1050
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_object( CUser_object & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_object1050( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_object
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E1049( CUser_object & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E1049
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_objects_E( CUser_object & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E1049( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_objects_E
+
+template< typename Tcontainer_ncbi_cref_cuser_object_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_objects( Tcontainer_ncbi_cref_cuser_object_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cuser_object_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_objects_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_objects
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data( CUser_field::C_Data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CUser_field::C_Data::e_Fields:
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_fields( arg0.SetFields() );
+    break;
+  case CUser_field::C_Data::e_Object:
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_object( arg0.SetObject() );
+    break;
+  case CUser_field::C_Data::e_Objects:
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data_objects( arg0.SetObjects() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_ETC( CUser_field & arg0 )
+{ // type Sequence
+  m_NewCleanup.x_AddNumToUserField( arg0 );
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_data( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_E_ETC( CUser_field & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E_data_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cuser_field_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_ETC( Tcontainer_ncbi_cref_cuser_field_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cuser_field_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_object1048_ETC( CUser_object & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_ETC( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_object1048_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_E_ETC( CUser_object & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_object1048_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cuser_object_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_ETC( Tcontainer_ncbi_cref_cuser_object_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cuser_object_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_id_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( Tcontainer_ncbi_cref_cseq_id_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_id_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_E_E_ETC( CDense_diag & arg0 )
+{ // type Sequence
+  if( arg0.IsSetIds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_E_ETC( CDense_diag & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cdense_diag_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_ETC( Tcontainer_ncbi_cref_cdense_diag_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cdense_diag_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_denseg_ETC( CDense_seg & arg0 )
+{ // type Sequence
+  if( arg0.IsSetIds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_denseg_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_ETC( CDense_seg & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_denseg_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc_disc_E( CSeq_align & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_E1020_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc_disc_E
+
+template< typename Tcontainer_ncbi_cref_cseq_align_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc_disc( Tcontainer_ncbi_cref_cseq_align_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_align_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc_disc_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc_disc
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc( CSeq_align_set & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc_disc( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_packed_ETC( CPacked_seg & arg0 )
+{ // type Sequence
+  if( arg0.IsSetIds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_packed_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_ETC( CPacked_seg & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_packed_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_E_E_ETC( CSparse_align & arg0 )
+{ // type Sequence
+  if( arg0.IsSetFirst_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetFirst_id() );
+  }
+  if( arg0.IsSetSecond_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetSecond_id() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_E_ETC( CSparse_align & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_E_ETC
+
+template< typename Tcontainer_ncbi_cref_csparse_align_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_ETC( Tcontainer_ncbi_cref_csparse_align_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_csparse_align_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_ETC( CSparse_seg & arg0 )
+{ // type Sequence
+  if( arg0.IsSetMaster_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetMaster_id() );
+  }
+  if( arg0.IsSetRows() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_rows_ETC( arg0.SetRows() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_ETC( CSparse_seg & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_sparse_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ETC( CSpliced_exon & arg0 )
+{ // type Sequence
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_ETC( arg0.SetExt() );
+  }
+  if( arg0.IsSetGenomic_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetGenomic_id() );
+  }
+  if( arg0.IsSetProduct_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetProduct_id() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_ETC( CSpliced_exon & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cspliced_exon_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_ETC( Tcontainer_ncbi_cref_cspliced_exon_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cspliced_exon_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_ETC( CSpliced_seg & arg0 )
+{ // type Sequence
+  if( arg0.IsSetExons() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_ETC( arg0.SetExons() );
+  }
+  if( arg0.IsSetGenomic_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetGenomic_id() );
+  }
+  if( arg0.IsSetProduct_id() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetProduct_id() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_ETC( CSpliced_seg & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_E_E_ETC( CStd_seg & arg0 )
+{ // type Sequence
+  if( arg0.IsSetIds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+  }
+  if( arg0.IsSetLoc() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetLoc() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_E_ETC( CStd_seg & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cstd_seg_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_ETC( Tcontainer_ncbi_cref_cstd_seg_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cstd_seg_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs( CSeq_align::C_Segs & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_align::C_Segs::e_Dendiag:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_ETC( arg0.SetDendiag() );
+    break;
+  case CSeq_align::C_Segs::e_Denseg:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_ETC( arg0.SetDenseg() );
+    break;
+  case CSeq_align::C_Segs::e_Disc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs_disc( arg0.SetDisc() );
+    break;
+  case CSeq_align::C_Segs::e_Packed:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_ETC( arg0.SetPacked() );
+    break;
+  case CSeq_align::C_Segs::e_Sparse:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_ETC( arg0.SetSparse() );
+    break;
+  case CSeq_align::C_Segs::e_Spliced:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_ETC( arg0.SetSpliced() );
+    break;
+  case CSeq_align::C_Segs::e_Std:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_ETC( arg0.SetStd() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_E1020_ETC( CSeq_align & arg0 )
+{ // type Sequence
+  if( arg0.IsSetBounds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetBounds() );
+  }
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_ETC( arg0.SetExt() );
+  }
+  if( arg0.IsSetSegs() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs( arg0.SetSegs() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_E1020_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_E_ETC( CSeq_align & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_E1020_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_align_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_ETC( Tcontainer_ncbi_cref_cseq_align_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_align_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_std_ETC( CAffil::C_Std & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Affil );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, City );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Country );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Div );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Email );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Fax );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Phone );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Postal_code );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Street );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Sub );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_std_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_str_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_CompressStringSpacesMarkChanged( arg0 );
+  m_NewCleanup.x_CleanupStringMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_str_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_ETC( CAffil & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CAffil::e_Std:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_std_ETC( arg0.SetStd() );
+    break;
+  case CAffil::e_Str:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_str_ETC( arg0.SetStr() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC( CAffil & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_pub_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_E_ETC( CAuthor & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAffil() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC( arg0.SetAffil() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_ETC( CAuthor & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cauthor_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_ETC( Tcontainer_ncbi_cref_cauthor_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cauthor_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_ETC( CAuth_list::C_Names & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CAuth_list::C_Names::e_Std:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_ETC( arg0.SetStd() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_ETC( CAuth_list & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAffil() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC( arg0.SetAffil() );
+  }
+  if( arg0.IsSetNames() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_ETC( arg0.SetNames() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( CAuth_list & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_E_E_ETC( CPubStatusDate & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_E_ETC( CPubStatusDate & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cpubstatusdate_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_ETC( Tcontainer_ncbi_cref_cpubstatusdate_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cpubstatusdate_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_ETC( CPubStatusDateSet & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_history_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_ETC( CImprint & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Issue );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Language );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Pages );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Part_sup );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Part_supi );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Section );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Volume );
+  if( arg0.IsSetCprt() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetCprt() );
+  }
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+  if( arg0.IsSetHistory() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_history_ETC( arg0.SetHistory() );
+  }
+  if( arg0.IsSetPub() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC( arg0.SetPub() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_ETC( CImprint & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_ETC( CCit_book & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAuthors() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetAuthors() );
+  }
+  if( arg0.IsSetImp() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_ETC( arg0.SetImp() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( CCit_book & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_journal_ETC( CCit_jour & arg0 )
+{ // type Sequence
+  if( arg0.IsSetImp() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_ETC( arg0.SetImp() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_journal_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_ETC( CCit_jour & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_journal_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_meet_meet_ETC( CMeeting & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+  if( arg0.IsSetPlace() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC( arg0.SetPlace() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_meet_meet_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_meet_ETC( CMeeting & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_meet_meet_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_meet_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_ETC( CCit_proc & arg0 )
+{ // type Sequence
+  if( arg0.IsSetBook() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( arg0.SetBook() );
+  }
+  if( arg0.IsSetMeet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_meet_ETC( arg0.SetMeet() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_ETC( CCit_proc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_proc_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_from_ETC( CCit_art::C_From & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CCit_art::C_From::e_Book:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( arg0.SetBook() );
+    break;
+  case CCit_art::C_From::e_Journal:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_ETC( arg0.SetJournal() );
+    break;
+  case CCit_art::C_From::e_Proc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_ETC( arg0.SetProc() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_from_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_E_name_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_StripSpacesMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_E_name_ETC
+
+template< typename Tcontainer_ncbi_cref_c_e_c_e >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_E_ETC( Tcontainer_ncbi_cref_c_e_c_e & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case Tcontainer_ncbi_cref_c_e_c_e::e_Name:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_E_name_ETC( arg0.SetName() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_E_ETC
+
+template< typename Tcontainer_ncbi_cref_c_e_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_ETC( Tcontainer_ncbi_cref_c_e_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_c_e_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_ETC( CTitle & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_title_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_ETC( CCit_art & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAuthors() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetAuthors() );
+  }
+  if( arg0.IsSetFrom() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_from_ETC( arg0.SetFrom() );
+  }
+  if( arg0.IsSetTitle() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_title_ETC( arg0.SetTitle() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_ETC( CCit_art & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_article_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_ETC
+
+template< typename Tcontainer_ncbi_cref_ccit_art_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_article_ETC( Tcontainer_ncbi_cref_ccit_art_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_ccit_art_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_article_ETC
+
+template< typename Tcontainer_ncbi_cref_ccit_book_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_book_ETC( Tcontainer_ncbi_cref_ccit_book_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_ccit_book_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_book_ETC
+
+template< typename Tcontainer_ncbi_cref_ccit_jour_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_journal_ETC( Tcontainer_ncbi_cref_ccit_jour_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_ccit_jour_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_journal_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_medline_ETC( CMedline_entry & arg0 )
+{ // type Sequence
+  if( arg0.IsSetCit() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_ETC( arg0.SetCit() );
+  }
+  if( arg0.IsSetEm() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetEm() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_medline_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_ETC( CMedline_entry & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_medline_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_ETC
+
+template< typename Tcontainer_ncbi_cref_cmedline_entry_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_medline_ETC( Tcontainer_ncbi_cref_cmedline_entry_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cmedline_entry_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_medline_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_E_E_ETC( CPatent_priority & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_E_ETC( CPatent_priority & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cpatent_priority_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_ETC( Tcontainer_ncbi_cref_cpatent_priority_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cpatent_priority_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_ETC( CCit_pat & arg0 )
+{ // type Sequence
+  if( arg0.IsSetApp_date() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetApp_date() );
+  }
+  if( arg0.IsSetApplicants() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetApplicants() );
+  }
+  if( arg0.IsSetAssignees() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetAssignees() );
+  }
+  if( arg0.IsSetAuthors() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetAuthors() );
+  }
+  if( arg0.IsSetDate_issue() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate_issue() );
+  }
+  if( arg0.IsSetPriority() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_priority_ETC( arg0.SetPriority() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_ETC( CCit_pat & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_patent_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_ETC
+
+template< typename Tcontainer_ncbi_cref_ccit_pat_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_patent_ETC( Tcontainer_ncbi_cref_ccit_pat_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_ccit_pat_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_patent_ETC
+
+template< typename Tcontainer_ncbi_cref_ccit_proc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_proc_ETC( Tcontainer_ncbi_cref_ccit_proc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_ccit_proc_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_proc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv_equiv_E( CPub & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv_equiv_E
+
+template< typename Tcontainer_ncbi_cref_cpub_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv_equiv( Tcontainer_ncbi_cref_cpub_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cpub_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv_equiv_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv_equiv
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv( CPub_equiv & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv_equiv( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_gen_ETC( CCit_gen & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAuthors() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetAuthors() );
+  }
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_gen_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_ETC( CCit_gen & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_gen_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_ETC( CCit_let & arg0 )
+{ // type Sequence
+  if( arg0.IsSetCit() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( arg0.SetCit() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_ETC( CCit_let & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_muid( int & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_RememberMuidThatMightBeConvertibleToPmid( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_muid
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_sub_ETC( CCit_sub & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAuthors() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_ETC( arg0.SetAuthors() );
+  }
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+  if( arg0.IsSetImp() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_ETC( arg0.SetImp() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_sub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_ETC( CCit_sub & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_sub_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC( CPub & arg0 )
+{ // type Choice
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC = &arg0;
+
+  m_NewCleanup.x_RememberPubOldLabel( arg0 );
+  switch( arg0.Which() ) {
+  case CPub::e_Article:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_ETC( arg0.SetArticle() );
+    break;
+  case CPub::e_Book:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( arg0.SetBook() );
+    break;
+  case CPub::e_Equiv:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_equiv( arg0.SetEquiv() );
+    break;
+  case CPub::e_Gen:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_ETC( arg0.SetGen() );
+    break;
+  case CPub::e_Journal:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_ETC( arg0.SetJournal() );
+    break;
+  case CPub::e_Man:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_ETC( arg0.SetMan() );
+    break;
+  case CPub::e_Medline:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_ETC( arg0.SetMedline() );
+    break;
+  case CPub::e_Muid:
+    _ASSERT( sizeof(int) == sizeof(arg0.SetMuid()) );
+    // the casting, etc. is a hack to get around the fact that we sometimes use TSeqPos 
+    // instead of int, but we can't tell where by looking at the .asn file.
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_muid( *(int*)&arg0.SetMuid() );
+    break;
+  case CPub::e_Patent:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_ETC( arg0.SetPatent() );
+    break;
+  case CPub::e_Proc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_ETC( arg0.SetProc() );
+    break;
+  case CPub::e_Sub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_ETC( arg0.SetSub() );
+    break;
+  default:
+    break;
+  }
+  m_NewCleanup.x_RememberSeqFeatCitPubs( arg0 );
+
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC = NULL;
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_ETC( CPub & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cpub_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_ETC( Tcontainer_ncbi_cref_cpub_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cpub_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_ETC( CPub_set & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CPub_set::e_Article:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_article_ETC( arg0.SetArticle() );
+    break;
+  case CPub_set::e_Book:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_book_ETC( arg0.SetBook() );
+    break;
+  case CPub_set::e_Journal:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_journal_ETC( arg0.SetJournal() );
+    break;
+  case CPub_set::e_Medline:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_medline_ETC( arg0.SetMedline() );
+    break;
+  case CPub_set::e_Patent:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_patent_ETC( arg0.SetPatent() );
+    break;
+  case CPub_set::e_Proc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_proc_ETC( arg0.SetProc() );
+    break;
+  case CPub_set::e_Pub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_pub_ETC( arg0.SetPub() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_ETC( CPub_set & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_cit_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_comment_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+  m_NewCleanup.x_FixUpEllipsis( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_comment_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_common_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_TrimInternalSemicolonsMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_common_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_E_E_ETC( CDbtag & arg0 )
+{ // type Sequence
+  m_NewCleanup.DbtagBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_E_ETC( CDbtag & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cdbtag_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC( Tcontainer_ncbi_cref_cdbtag_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cdbtag_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_E_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.OrgrefModBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_E_ETC
+
+template< typename Tcontainer_std_string_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_ETC( Tcontainer_std_string_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_std_string_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_E_ETC( *iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_E_E_ETC( COrgMod & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Attrib );
+  CLEAN_AND_COMPRESS_STRING_MEMBER_JUNK( arg0, Subname );
+  m_NewCleanup.x_OrgModBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_E_ETC( COrgMod & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_E_ETC
+
+template< typename Tcontainer_ncbi_cref_corgmod_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_ETC( Tcontainer_ncbi_cref_corgmod_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_corgmod_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid_hybrid_E( COrgName & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_E1026_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid_hybrid_E
+
+template< typename Tcontainer_ncbi_cref_corgname_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid_hybrid( Tcontainer_ncbi_cref_corgname_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_corgname_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid_hybrid_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid_hybrid
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid( CMultiOrgName & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid_hybrid( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name( COrgName::C_Name & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case COrgName::C_Name::e_Hybrid:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name_hybrid( arg0.SetHybrid() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_E1026_ETC( COrgName & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Attrib );
+  CLEAN_STRING_MEMBER( arg0, Div );
+  CLEAN_STRING_MEMBER( arg0, Lineage );
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetName() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name( arg0.SetName() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_E1026_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_hybrid_E_ETC( COrgName & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_E1026_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_hybrid_E_ETC
+
+template< typename Tcontainer_ncbi_cref_corgname_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_hybrid_ETC( Tcontainer_ncbi_cref_corgname_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_corgname_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_hybrid_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_hybrid_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_ETC( CMultiOrgName & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_hybrid_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_ETC( COrgName::C_Name & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case COrgName::C_Name::e_Hybrid:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_hybrid_ETC( arg0.SetHybrid() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname974( COrgName & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Attrib );
+  CLEAN_STRING_MEMBER( arg0, Div );
+  CLEAN_STRING_MEMBER( arg0, Lineage );
+  m_NewCleanup.x_CleanupOrgModAndSubSourceOther( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc );
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetName() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_ETC( arg0.SetName() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname974
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org_orgname( COrgName & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname974( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org_orgname
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org( COrg_ref & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Common );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Taxname );
+  m_NewCleanup.OrgrefBC( arg0 );
+  m_NewCleanup.x_GBQualToOrgRef( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  if( arg0.IsSetCommon() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_common_ETC( arg0.SetCommon() );
+  }
+  if( arg0.IsSetDb() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC( arg0.SetDb() );
+  }
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetOrgname() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org_orgname( arg0.SetOrgname() );
+  }
+  CLEAN_STRING_LIST( arg0, Syn );
+  m_NewCleanup.x_PostOrgRef( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org( COrg_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org_org( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_pcr_primers_ETC( CPCRReactionSet & arg0 )
+{ // type Reference
+  m_NewCleanup.PCRReactionSetBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_pcr_primers_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_source_ETC( CSubSource & arg0 )
+{ // type Sequence
+  m_NewCleanup.x_SubSourceBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_source_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_ETC( CSubSource & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_source_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_ETC
+
+template< typename Tcontainer_ncbi_cref_csubsource_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_subtype_ETC( Tcontainer_ncbi_cref_csubsource_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_csubsource_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_subtype_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc( CBioSource & arg0 )
+{ // type Sequence
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc = &arg0;
+
+  m_NewCleanup.BiosourceBC( arg0 );
+  if( arg0.IsSetOrg() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc_org( arg0.SetOrg() );
+  }
+  if( arg0.IsSetPcr_primers() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_pcr_primers_ETC( arg0.SetPcr_primers() );
+  }
+  if( arg0.IsSetSubtype() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_subtype_ETC( arg0.SetSubtype() );
+  }
+  m_NewCleanup.BiosourceFeatBC( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  m_NewCleanup.x_PostBiosource( arg0 );
+  m_NewCleanup.x_ModernizePCRPrimers( arg0 );
+
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc = NULL;
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc( CBioSource & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc_biosrc( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc1058_ETC( CSeq_loc & arg0 )
+{ // type Choice
+  m_NewCleanup.SeqLocBC( arg0 );
+  m_NewCleanup.x_BothStrandBC( arg0 );
+  switch( arg0.Which() ) {
+  case CSeq_loc::e_Bond:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_ETC( arg0.SetBond() );
+    break;
+  case CSeq_loc::e_Empty:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetEmpty() );
+    break;
+  case CSeq_loc::e_Equiv:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_equiv( arg0.SetEquiv() );
+    break;
+  case CSeq_loc::e_Int:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC( arg0.SetInt() );
+    break;
+  case CSeq_loc::e_Mix:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_ETC( arg0.SetMix() );
+    break;
+  case CSeq_loc::e_Packed_int:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_ETC( arg0.SetPacked_int() );
+    break;
+  case CSeq_loc::e_Packed_pnt:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_ETC( arg0.SetPacked_pnt() );
+    break;
+  case CSeq_loc::e_Pnt:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC( arg0.SetPnt() );
+    break;
+  case CSeq_loc::e_Whole:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetWhole() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc1058_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( CSeq_loc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc1058_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_E_E_ETC( CCode_break & arg0 )
+{ // type Sequence
+  if( arg0.IsSetLoc() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetLoc() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_E_ETC( CCode_break & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_E_ETC
+
+template< typename Tcontainer_ncbi_cref_ccode_break_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_ETC( Tcontainer_ncbi_cref_ccode_break_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_ccode_break_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_cdregion_cdregion( CCdregion & arg0 )
+{ // type Sequence
+  m_NewCleanup.CdregionFeatBC( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  if( arg0.IsSetCode_break() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_ETC( arg0.SetCode_break() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_cdregion_cdregion
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_cdregion( CCdregion & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_cdregion_cdregion( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_cdregion
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_E_E_ETC( CClone_seq & arg0 )
+{ // type Sequence
+  if( arg0.IsSetLocation() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetLocation() );
+  }
+  if( arg0.IsSetSeq() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetSeq() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_E_ETC( CClone_seq & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cclone_seq_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_ETC( Tcontainer_ncbi_cref_cclone_seq_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cclone_seq_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_ETC( CClone_seq_set & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_clone_seq_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_ETC( CClone_ref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetClone_seq() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_clone_seq_ETC( arg0.SetClone_seq() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_ETC( CClone_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_clone_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_desc_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_CompressStringSpacesMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_desc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+  m_NewCleanup.x_TrimInternalSemicolonsMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_E_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_E_ETC
+
+template< typename Tcontainer_std_string_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_ETC( Tcontainer_std_string_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_std_string_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_E_ETC( *iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_gene_gene( CGene_ref & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Allele );
+  CLEAN_STRING_MEMBER( arg0, Desc );
+  CLEAN_STRING_MEMBER( arg0, Locus );
+  CLEAN_STRING_MEMBER( arg0, Locus_tag );
+  CLEAN_STRING_MEMBER( arg0, Maploc );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Locus );
+  m_NewCleanup.GeneFeatBC( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  if( arg0.IsSetAllele() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetAllele() );
+  }
+  if( arg0.IsSetDesc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_desc_ETC( arg0.SetDesc() );
+  }
+  if( arg0.IsSetLocus() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_ETC( arg0.SetLocus() );
+  }
+  if( arg0.IsSetLocus_tag() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetLocus_tag() );
+  }
+  if( arg0.IsSetMaploc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetMaploc() );
+  }
+  if( arg0.IsSetSyn() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_ETC( arg0.SetSyn() );
+  }
+  CLEAN_STRING_LIST( arg0, Syn );
+  m_NewCleanup.GenerefBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_gene_gene
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_gene( CGene_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_gene_gene( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_gene
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_imp_ETC( CImp_feat & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Descr );
+  CLEAN_STRING_MEMBER( arg0, Key );
+  CLEAN_STRING_MEMBER( arg0, Loc );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_imp_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_ETC( CImp_feat & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_imp_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns1021_ETC( CSeq_align & arg0 )
+{ // type Sequence
+  if( arg0.IsSetBounds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetBounds() );
+  }
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_ETC( arg0.SetExt() );
+  }
+  if( arg0.IsSetSegs() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns_segs( arg0.SetSegs() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns1021_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_ETC( CSeq_align & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_aligns1021_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_ETC( CNum_ref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAligns() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_aligns_ETC( arg0.SetAligns() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ETC( CNum_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ref_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ETC( CNumbering & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CNumbering::e_Ref:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ref_ETC( arg0.SetRef() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( CNumbering & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_num_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname1019_ETC( COrgName & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Attrib );
+  CLEAN_STRING_MEMBER( arg0, Div );
+  CLEAN_STRING_MEMBER( arg0, Lineage );
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetName() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname_name_ETC( arg0.SetName() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname1019_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_ETC( COrgName & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_orgname1019_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_org_org( COrg_ref & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Common );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Taxname );
+  m_NewCleanup.OrgrefBC( arg0 );
+  m_NewCleanup.x_GBQualToOrgRef( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  if( arg0.IsSetCommon() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_common_ETC( arg0.SetCommon() );
+  }
+  if( arg0.IsSetDb() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC( arg0.SetDb() );
+  }
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetOrgname() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_ETC( arg0.SetOrgname() );
+  }
+  CLEAN_STRING_LIST( arg0, Syn );
+  m_NewCleanup.x_PostOrgRef( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_org_org
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_org( COrg_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_org_org( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_org
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_E_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.ProtActivityBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_E_ETC
+
+template< typename Tcontainer_std_string_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_ETC( Tcontainer_std_string_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_std_string_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_E_ETC( *iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_desc_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_TrimInternalSemicolonsMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_desc_ETC
+
+template< typename Tcontainer_std_string_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ec_ETC( Tcontainer_std_string_ & arg0 )
+{ // type UniSequence
+  m_NewCleanup.x_CleanupECNumberList( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ec_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_E_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_CompressStringSpacesMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+  m_NewCleanup.x_RemoveFlankingQuotes( arg0 );
+  m_NewCleanup.ProtNameBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_E_ETC
+
+template< typename Tcontainer_std_string_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_ETC( Tcontainer_std_string_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_std_string_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_E_ETC( *iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_prot_prot( CProt_ref & arg0 )
+{ // type Sequence
+  m_NewCleanup.ProtFeatfBC( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  m_NewCleanup.ProtrefBC( arg0 );
+  if( arg0.IsSetActivity() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_ETC( arg0.SetActivity() );
+  }
+  if( arg0.IsSetDesc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_desc_ETC( arg0.SetDesc() );
+  }
+  if( arg0.IsSetEc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ec_ETC( arg0.SetEc() );
+  }
+  if( arg0.IsSetName() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_ETC( arg0.SetName() );
+  }
+  CLEAN_STRING_LIST( arg0, Name );
+  m_NewCleanup.PostProtFeatfBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_prot_prot
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_prot( CProt_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_prot_prot( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_prot
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv_equiv_E( CPub & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_E1034_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv_equiv_E
+
+template< typename Tcontainer_ncbi_cref_cpub_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv_equiv( Tcontainer_ncbi_cref_cpub_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cpub_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv_equiv_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv_equiv
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv( CPub_equiv & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv_equiv( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_E1034_ETC( CPub & arg0 )
+{ // type Choice
+  m_NewCleanup.x_RememberPubOldLabel( arg0 );
+  switch( arg0.Which() ) {
+  case CPub::e_Article:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_article_ETC( arg0.SetArticle() );
+    break;
+  case CPub::e_Book:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_ETC( arg0.SetBook() );
+    break;
+  case CPub::e_Equiv:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_equiv( arg0.SetEquiv() );
+    break;
+  case CPub::e_Gen:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_gen_ETC( arg0.SetGen() );
+    break;
+  case CPub::e_Journal:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_journal_ETC( arg0.SetJournal() );
+    break;
+  case CPub::e_Man:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_ETC( arg0.SetMan() );
+    break;
+  case CPub::e_Medline:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_medline_ETC( arg0.SetMedline() );
+    break;
+  case CPub::e_Patent:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_patent_ETC( arg0.SetPatent() );
+    break;
+  case CPub::e_Proc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_proc_ETC( arg0.SetProc() );
+    break;
+  case CPub::e_Sub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_sub_ETC( arg0.SetSub() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_E1034_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub_E_ETC( CPub & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_E1034_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cpub_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub1006_ETC( Tcontainer_ncbi_cref_cpub_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cpub_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub1006_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_pub_pub_ETC( CPub_equiv & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub1006_ETC( arg0.Set() );
+  }
+  m_NewCleanup.x_NotePubdescOrAnnotPubs( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_pub_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_pub_ETC( CPubdesc & arg0 )
+{ // type Sequence
+  if( arg0.IsSetComment() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetComment() );
+  }
+  if( arg0.IsSetNum() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( arg0.SetNum() );
+  }
+  if( arg0.IsSetPub() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_pub_pub_ETC( arg0.SetPub() );
+  }
+  m_NewCleanup.PubdescBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_ETC( CPubdesc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_pub_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_region_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_CompressStringSpacesMarkChanged( arg0 );
+  m_NewCleanup.x_CleanupStringMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+  m_NewCleanup.x_TrimInternalSemicolonsMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_region_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_product_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+  m_NewCleanup.x_RemoveFlankingQuotes( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_product_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_E_E_ETC( CRNA_qual & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Qual );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Val );
+  if( arg0.IsSetQual() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetQual() );
+  }
+  if( arg0.IsSetVal() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetVal() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_E_ETC( CRNA_qual & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_E_ETC
+
+template< typename Tcontainer_ncbi_cref_crna_qual_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_ETC( Tcontainer_ncbi_cref_crna_qual_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_crna_qual_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_ETC( CRNA_qual_set & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_quals_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_ETC( CRNA_gen & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Class );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Product );
+  if( arg0.IsSetClass() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetClass() );
+  }
+  if( arg0.IsSetProduct() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_product_ETC( arg0.SetProduct() );
+  }
+  if( arg0.IsSetQuals() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_quals_ETC( arg0.SetQuals() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_ETC( CRNA_gen & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_gen_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_name_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_CompressStringSpacesMarkChanged( arg0 );
+  m_NewCleanup.x_CleanupStringMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+  m_NewCleanup.x_RemoveFlankingQuotes( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_name_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_tRNA_tRNA_ETC( CTrna_ext & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAnticodon() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetAnticodon() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_tRNA_tRNA_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_tRNA_ETC( CTrna_ext & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_tRNA_tRNA_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_tRNA_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_ETC( CRNA_ref::C_Ext & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CRNA_ref::C_Ext::e_Gen:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_gen_ETC( arg0.SetGen() );
+    break;
+  case CRNA_ref::C_Ext::e_Name:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_name_ETC( arg0.SetName() );
+    break;
+  case CRNA_ref::C_Ext::e_TRNA:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_tRNA_ETC( arg0.SetTRNA() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_rna_rna( CRNA_ref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_ETC( arg0.SetExt() );
+  }
+  m_NewCleanup.RnaFeatBC( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+  m_NewCleanup.RnarefBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_rna_rna
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_rna( CRNA_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_rna_rna( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_rna
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_site( CSeqFeatData::ESite & arg0 )
+{ // type Enum
+  m_NewCleanup.SiteFeatBC( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_site
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC( CGene_ref & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Allele );
+  CLEAN_STRING_MEMBER( arg0, Desc );
+  CLEAN_STRING_MEMBER( arg0, Locus );
+  CLEAN_STRING_MEMBER( arg0, Locus_tag );
+  CLEAN_STRING_MEMBER( arg0, Maploc );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Locus );
+  if( arg0.IsSetAllele() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetAllele() );
+  }
+  if( arg0.IsSetDesc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_desc_ETC( arg0.SetDesc() );
+  }
+  if( arg0.IsSetLocus() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_ETC( arg0.SetLocus() );
+  }
+  if( arg0.IsSetLocus_tag() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetLocus_tag() );
+  }
+  if( arg0.IsSetMaploc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetMaploc() );
+  }
+  if( arg0.IsSetSyn() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_syn_ETC( arg0.SetSyn() );
+  }
+  CLEAN_STRING_LIST( arg0, Syn );
+  m_NewCleanup.GenerefBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_ETC( CGene_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cgene_ref_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_ETC( Tcontainer_ncbi_cref_cgene_ref_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cgene_ref_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC( CProt_ref & arg0 )
+{ // type Sequence
+  m_NewCleanup.ProtrefBC( arg0 );
+  if( arg0.IsSetActivity() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_activity_ETC( arg0.SetActivity() );
+  }
+  if( arg0.IsSetDesc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_desc_ETC( arg0.SetDesc() );
+  }
+  if( arg0.IsSetEc() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ec_ETC( arg0.SetEc() );
+  }
+  if( arg0.IsSetName() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_name_ETC( arg0.SetName() );
+  }
+  CLEAN_STRING_LIST( arg0, Name );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_ETC( CProt_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cprot_ref_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_ETC( Tcontainer_ncbi_cref_cprot_ref_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cprot_ref_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_ETC( COrg_ref & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Common );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Taxname );
+  m_NewCleanup.OrgrefBC( arg0 );
+  if( arg0.IsSetCommon() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_common_ETC( arg0.SetCommon() );
+  }
+  if( arg0.IsSetDb() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC( arg0.SetDb() );
+  }
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetOrgname() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_orgname_ETC( arg0.SetOrgname() );
+  }
+  CLEAN_STRING_LIST( arg0, Syn );
+  m_NewCleanup.x_PostOrgRef( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_ETC( COrg_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_txorg_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_ETC( CTxinit & arg0 )
+{ // type Sequence
+  if( arg0.IsSetGene() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_ETC( arg0.SetGene() );
+  }
+  if( arg0.IsSetProtein() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_ETC( arg0.SetProtein() );
+  }
+  if( arg0.IsSetTxorg() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_ETC( arg0.SetTxorg() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_ETC( CTxinit & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ext997_ETC( CUser_object & arg0 )
+{ // type Sequence
+  m_NewCleanup.UserObjectBC( arg0 );
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_fields_ETC( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ext997_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ETC( CUser_object & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ext997_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence_E_variation( CVariation_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation1033_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence_E_variation
+
+template< typename Tcvariation_ref_container_ncbi_cref_c_e_consequence_c_e_consequence >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence_E( Tcvariation_ref_container_ncbi_cref_c_e_consequence_c_e_consequence & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case Tcvariation_ref_container_ncbi_cref_c_e_consequence_c_e_consequence::e_Variation:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence_E_variation( arg0.SetVariation() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence_E
+
+template< typename Tcontainer_ncbi_cref_c_e_consequence_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence( Tcontainer_ncbi_cref_c_e_consequence_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_c_e_consequence_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_E_seq_ETC( CDelta_item::C_Seq & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CDelta_item::C_Seq::e_Loc:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetLoc() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_E_seq_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_E_ETC( CDelta_item & arg0 )
+{ // type Sequence
+  if( arg0.IsSetSeq() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_E_seq_ETC( arg0.SetSeq() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_ETC( CDelta_item & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cdelta_item_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_ETC( Tcontainer_ncbi_cref_cdelta_item_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cdelta_item_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_ETC( CVariation_inst & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDelta() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_delta_ETC( arg0.SetDelta() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_ETC( CVariation_inst & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_instance_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_ETC
+
+template< typename Tcvariation_ref_container_ncbi_cref_c_e_somatic_origin_c_e_somatic_origin >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_ETC( Tcvariation_ref_container_ncbi_cref_c_e_somatic_origin_c_e_somatic_origin & arg0 )
+{ // type Sequence
+  if( arg0.IsSetSource() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_source_ETC( arg0.SetSource() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_ETC
+
+template< typename Tcontainer_ncbi_cref_c_e_somatic_origin_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_ETC( Tcontainer_ncbi_cref_c_e_somatic_origin_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_c_e_somatic_origin_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_E1032_ETC( CVariation_ref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetConsequence() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence( arg0.SetConsequence() );
+  }
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data( arg0.SetData() );
+  }
+  if( arg0.IsSetSomatic_origin() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_ETC( arg0.SetSomatic_origin() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_E1032_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set_variations_E( CVariation_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_E1032_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set_variations_E
+
+template< typename Tcontainer_ncbi_cref_cvariation_ref_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set_variations( Tcontainer_ncbi_cref_cvariation_ref_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cvariation_ref_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set_variations_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set_variations
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set( CVariation_ref::C_Data::C_Set & arg0 )
+{ // type Sequence
+  if( arg0.IsSetVariations() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set_variations( arg0.SetVariations() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data( CVariation_ref::C_Data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CVariation_ref::C_Data::e_Instance:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_instance_ETC( arg0.SetInstance() );
+    break;
+  case CVariation_ref::C_Data::e_Set:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data_set( arg0.SetSet() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation1033_ETC( CVariation_ref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetConsequence() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_consequence( arg0.SetConsequence() );
+  }
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_data( arg0.SetData() );
+  }
+  if( arg0.IsSetSomatic_origin() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_somatic_origin_ETC( arg0.SetSomatic_origin() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation1033_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_ETC( CVariation_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation1033_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data( CSeqFeatData & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqFeatData::e_Biosrc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_biosrc( arg0.SetBiosrc() );
+    break;
+  case CSeqFeatData::e_Cdregion:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_cdregion( arg0.SetCdregion() );
+    break;
+  case CSeqFeatData::e_Clone:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_ETC( arg0.SetClone() );
+    break;
+  case CSeqFeatData::e_Gene:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_gene( arg0.SetGene() );
+    break;
+  case CSeqFeatData::e_Imp:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_ETC( arg0.SetImp() );
+    break;
+  case CSeqFeatData::e_Num:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( arg0.SetNum() );
+    break;
+  case CSeqFeatData::e_Org:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_org( arg0.SetOrg() );
+    break;
+  case CSeqFeatData::e_Prot:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_prot( arg0.SetProt() );
+    break;
+  case CSeqFeatData::e_Pub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_ETC( arg0.SetPub() );
+    break;
+  case CSeqFeatData::e_Region:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_region_ETC( arg0.SetRegion() );
+    break;
+  case CSeqFeatData::e_Rna:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_rna( arg0.SetRna() );
+    break;
+  case CSeqFeatData::e_Seq:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetSeq() );
+    break;
+  case CSeqFeatData::e_Site:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_site( arg0.SetSite() );
+    break;
+  case CSeqFeatData::e_Txinit:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_ETC( arg0.SetTxinit() );
+    break;
+  case CSeqFeatData::e_User:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ETC( arg0.SetUser() );
+    break;
+  case CSeqFeatData::e_Variation:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_ETC( arg0.SetVariation() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_data( CSeqFeatData & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_ETC( CSeq_loc_equiv & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_location_location995_ETC( CSeq_loc & arg0 )
+{ // type Choice
+  m_NewCleanup.SeqLocBC( arg0 );
+  m_NewCleanup.ConvertSeqLocWholeToInt( arg0 );
+  switch( arg0.Which() ) {
+  case CSeq_loc::e_Bond:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_ETC( arg0.SetBond() );
+    break;
+  case CSeq_loc::e_Empty:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetEmpty() );
+    break;
+  case CSeq_loc::e_Equiv:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_ETC( arg0.SetEquiv() );
+    break;
+  case CSeq_loc::e_Int:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC( arg0.SetInt() );
+    break;
+  case CSeq_loc::e_Mix:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_mix_ETC( arg0.SetMix() );
+    break;
+  case CSeq_loc::e_Packed_int:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_ETC( arg0.SetPacked_int() );
+    break;
+  case CSeq_loc::e_Packed_pnt:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_pnt_ETC( arg0.SetPacked_pnt() );
+    break;
+  case CSeq_loc::e_Pnt:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_bond_bond_b_ETC( arg0.SetPnt() );
+    break;
+  case CSeq_loc::e_Whole:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetWhole() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_location_location995_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_location_ETC( CSeq_loc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_location_location995_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_location_ETC
+
+template< typename Tcontainer_ncbi_cref_cgb_qual_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_qual_ETC( Tcontainer_ncbi_cref_cgb_qual_ & arg0 )
+{ // type UniSequence
+  m_NewCleanup.x_ExpandCombinedQuals( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_qual_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_basis_basis_ETC( CEvidenceBasis & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAccessions() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetAccessions() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_basis_basis_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_basis_ETC( CEvidenceBasis & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_basis_basis_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_basis_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_ETC( CInferenceSupport & arg0 )
+{ // type Sequence
+  if( arg0.IsSetBasis() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_basis_ETC( arg0.SetBasis() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_ETC( CInferenceSupport & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cinferencesupport_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_ETC( Tcontainer_ncbi_cref_cinferencesupport_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cinferencesupport_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_E_E_ETC( CModelEvidenceItem & arg0 )
+{ // type Sequence
+  if( arg0.IsSetId() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetId() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_E_ETC( CModelEvidenceItem & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cmodelevidenceitem_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_ETC( Tcontainer_ncbi_cref_cmodelevidenceitem_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cmodelevidenceitem_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_ETC( CModelEvidenceSupport & arg0 )
+{ // type Sequence
+  if( arg0.IsSetEst() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_ETC( arg0.SetEst() );
+  }
+  if( arg0.IsSetIdentification() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetIdentification() );
+  }
+  if( arg0.IsSetMrna() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_ETC( arg0.SetMrna() );
+  }
+  if( arg0.IsSetProtein() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_protein_ETC( arg0.SetProtein() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_ETC( CModelEvidenceSupport & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cmodelevidencesupport_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_ETC( Tcontainer_ncbi_cref_cmodelevidencesupport_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cmodelevidencesupport_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_ETC( CSeqFeatSupport & arg0 )
+{ // type Sequence
+  if( arg0.IsSetInference() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_inference_ETC( arg0.SetInference() );
+  }
+  if( arg0.IsSetModel_evidence() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_ETC( arg0.SetModel_evidence() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_support_ETC( CSeqFeatSupport & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_support_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_title_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_title_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname1027( COrgName & arg0 )
+{ // type Sequence
+  CLEAN_STRING_MEMBER( arg0, Attrib );
+  CLEAN_STRING_MEMBER( arg0, Div );
+  CLEAN_STRING_MEMBER( arg0, Lineage );
+  m_NewCleanup.x_CleanupOrgModAndSubSourceOther( arg0, *m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_ETC );
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetName() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname_name( arg0.SetName() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname1027
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname( COrgName & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname_orgname1027( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org( COrg_ref & arg0 )
+{ // type Sequence
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Common );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Taxname );
+  m_NewCleanup.OrgrefBC( arg0 );
+  if( arg0.IsSetCommon() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_common_ETC( arg0.SetCommon() );
+  }
+  if( arg0.IsSetDb() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC( arg0.SetDb() );
+  }
+  if( arg0.IsSetMod() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_mod_ETC( arg0.SetMod() );
+  }
+  if( arg0.IsSetOrgname() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org_orgname( arg0.SetOrgname() );
+  }
+  CLEAN_STRING_LIST( arg0, Syn );
+  m_NewCleanup.x_PostOrgRef( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org( COrg_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org_org( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_ETC( CBioSource & arg0 )
+{ // type Sequence
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_ETC = &arg0;
+
+  m_NewCleanup.BiosourceBC( arg0 );
+  if( arg0.IsSetOrg() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_org( arg0.SetOrg() );
+  }
+  if( arg0.IsSetPcr_primers() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_pcr_primers_ETC( arg0.SetPcr_primers() );
+  }
+  if( arg0.IsSetSubtype() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_subtype_ETC( arg0.SetSubtype() );
+  }
+  m_NewCleanup.x_PostBiosource( arg0 );
+  m_NewCleanup.x_ModernizePCRPrimers( arg0 );
+
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_ETC = NULL;
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_ETC( CBioSource & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_biosrc_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_ETC( CCdregion & arg0 )
+{ // type Sequence
+  if( arg0.IsSetCode_break() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_code_break_ETC( arg0.SetCode_break() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_ETC( CCdregion & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_cdregion_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub_E_E_equiv_ETC( CPub_equiv & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub1006_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub_E_E_equiv_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_ETC( CPubdesc & arg0 )
+{ // type Sequence
+  if( arg0.IsSetComment() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_E_locus_tag_ETC( arg0.SetComment() );
+  }
+  if( arg0.IsSetNum() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( arg0.SetNum() );
+  }
+  if( arg0.IsSetPub() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_pub_pub_E_E_equiv_ETC( arg0.SetPub() );
+  }
+  m_NewCleanup.PubdescBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_ETC( CPubdesc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ETC( CRNA_ref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ext_ETC( arg0.SetExt() );
+  }
+  m_NewCleanup.RnarefBC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_ETC( CRNA_ref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_rna_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_ETC( CSeqFeatData & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqFeatData::e_Biosrc:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_ETC( arg0.SetBiosrc() );
+    break;
+  case CSeqFeatData::e_Cdregion:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_cdregion_ETC( arg0.SetCdregion() );
+    break;
+  case CSeqFeatData::e_Clone:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_clone_ETC( arg0.SetClone() );
+    break;
+  case CSeqFeatData::e_Gene:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_gene_E_ETC( arg0.SetGene() );
+    break;
+  case CSeqFeatData::e_Imp:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_imp_ETC( arg0.SetImp() );
+    break;
+  case CSeqFeatData::e_Num:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( arg0.SetNum() );
+    break;
+  case CSeqFeatData::e_Org:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_ETC( arg0.SetOrg() );
+    break;
+  case CSeqFeatData::e_Prot:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_protein_E_ETC( arg0.SetProt() );
+    break;
+  case CSeqFeatData::e_Pub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_ETC( arg0.SetPub() );
+    break;
+  case CSeqFeatData::e_Rna:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_rna_ETC( arg0.SetRna() );
+    break;
+  case CSeqFeatData::e_Seq:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetSeq() );
+    break;
+  case CSeqFeatData::e_Txinit:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_ETC( arg0.SetTxinit() );
+    break;
+  case CSeqFeatData::e_User:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_E_ETC( arg0.SetUser() );
+    break;
+  case CSeqFeatData::e_Variation:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_ETC( arg0.SetVariation() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_ETC( CSeqFeatData & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_ETC( CSeqFeatXref & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_ETC( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_ETC( CSeqFeatXref & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseqfeatxref_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_ETC( Tcontainer_ncbi_cref_cseqfeatxref_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseqfeatxref_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC( CSeq_feat & arg0_raw )
+{ // type Sequence
+  CRef<CSeq_feat> raw_ref( &arg0_raw );
+  CSeq_feat_EditHandle efh;
+
+  CRef<CSeq_feat> new_feat;
+
+  try {
+    // Try to use an edit handle so we can update the object manager
+    efh = CSeq_feat_EditHandle( m_Scope.GetSeq_featHandle( arg0_raw ) );
+    new_feat.Reset( new CSeq_feat );
+    new_feat->Assign( arg0_raw );
+  } catch(...) {
+    new_feat.Reset( &arg0_raw );
+  }
+
+  CSeq_feat &arg0 = *new_feat;
+
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC = &arg0;
+
+  CLEAN_STRING_MEMBER( arg0, Comment );
+  CLEAN_STRING_MEMBER( arg0, Except_text );
+  CLEAN_STRING_MEMBER( arg0, Title );
+  CLEAN_AND_COMPRESS_STRING_MEMBER( arg0, Comment );
+  m_NewCleanup.ImpFeatBC( arg0 );
+  m_NewCleanup.SeqfeatBC( arg0 );
+  if( arg0.IsSetCit() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_cit_ETC( arg0.SetCit() );
+  }
+  if( arg0.IsSetComment() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_comment_ETC( arg0.SetComment() );
+  }
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data( arg0.SetData() );
+  }
+  if( arg0.IsSetDbxref() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_dbxref_ETC( arg0.SetDbxref() );
+  }
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ETC( arg0.SetExt() );
+  }
+  if( arg0.IsSetExts() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_ETC( arg0.SetExts() );
+  }
+  if( arg0.IsSetLocation() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_location_ETC( arg0.SetLocation() );
+  }
+  if( arg0.IsSetProduct() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetProduct() );
+  }
+  if( arg0.IsSetQual() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_qual_ETC( arg0.SetQual() );
+  }
+  if( arg0.IsSetSupport() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_ETC( arg0.SetSupport() );
+  }
+  if( arg0.IsSetTitle() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_title_ETC( arg0.SetTitle() );
+  }
+  if( arg0.IsSetXref() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_ETC( arg0.SetXref() );
+  }
+  m_NewCleanup.x_PostSeqFeat( arg0 );
+  m_NewCleanup.x_SeqfeatEC( arg0 );
+
+  m_LastArg_x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC = NULL;
+
+  if( efh ) {
+    efh.Replace(arg0);
+    arg0_raw.Assign( arg0 );
+  }
+
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_E_ETC( CSeq_feat & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_ftable_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_feat_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_ftable_ETC( Tcontainer_ncbi_cref_cseq_feat_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_feat_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_ftable_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_ftable_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_graph_E_E_ETC( CSeq_graph & arg0 )
+{ // type Sequence
+  if( arg0.IsSetLoc() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetLoc() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_graph_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_graph_E_ETC( CSeq_graph & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_graph_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_graph_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_graph_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_graph_ETC( Tcontainer_ncbi_cref_cseq_graph_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_graph_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_graph_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_graph_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled_int_scaled_data( CSeqTable_multi_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data1053_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled_int_scaled_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled_int_scaled( CScaled_int_multi_data & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled_int_scaled_data( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled_int_scaled
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled( CScaled_int_multi_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled_int_scaled( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled_real_scaled_data( CSeqTable_multi_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data1053_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled_real_scaled_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled_real_scaled( CScaled_real_multi_data & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled_real_scaled_data( arg0.SetData() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled_real_scaled
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled( CScaled_real_multi_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled_real_scaled( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_int_delta1054_ETC( CSeqTable_multi_data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqTable_multi_data::e_Id:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetId() );
+    break;
+  case CSeqTable_multi_data::e_Int_delta:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_delta( arg0.SetInt_delta() );
+    break;
+  case CSeqTable_multi_data::e_Int_scaled:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled( arg0.SetInt_scaled() );
+    break;
+  case CSeqTable_multi_data::e_Interval:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_packed_int_ETC( arg0.SetInterval() );
+    break;
+  case CSeqTable_multi_data::e_Loc:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetLoc() );
+    break;
+  case CSeqTable_multi_data::e_Real_scaled:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled( arg0.SetReal_scaled() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_int_delta1054_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_delta( CSeqTable_multi_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_int_delta1054_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_delta
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data1053_ETC( CSeqTable_multi_data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqTable_multi_data::e_Id:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetId() );
+    break;
+  case CSeqTable_multi_data::e_Int_delta:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_delta( arg0.SetInt_delta() );
+    break;
+  case CSeqTable_multi_data::e_Int_scaled:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_int_scaled( arg0.SetInt_scaled() );
+    break;
+  case CSeqTable_multi_data::e_Interval:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_loc_packed_int_packed_int_ETC( arg0.SetInterval() );
+    break;
+  case CSeqTable_multi_data::e_Loc:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetLoc() );
+    break;
+  case CSeqTable_multi_data::e_Real_scaled:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_real_scaled( arg0.SetReal_scaled() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data1053_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_ETC( CSeqTable_multi_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data1053_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_ETC( CSeqTable_single_data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqTable_single_data::e_Id:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetId() );
+    break;
+  case CSeqTable_single_data::e_Interval:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_ETC( arg0.SetInterval() );
+    break;
+  case CSeqTable_single_data::e_Loc:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetLoc() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_ETC( CSeqTable_single_data & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_ETC( CSeqTable_column & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_ETC( arg0.SetData() );
+  }
+  if( arg0.IsSetDefault() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_ETC( arg0.SetDefault() );
+  }
+  if( arg0.IsSetSparse_other() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_ETC( arg0.SetSparse_other() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_ETC( CSeqTable_column & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseqtable_column_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_ETC( Tcontainer_ncbi_cref_cseqtable_column_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseqtable_column_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_seq_table_ETC( CSeq_table & arg0 )
+{ // type Sequence
+  if( arg0.IsSetColumns() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_ETC( arg0.SetColumns() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_seq_table_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_seq_table_ETC( CSeq_table & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_seq_table_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_annots_E_E_data_ETC( CSeq_annot::C_Data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_annot::C_Data::e_Align:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_ETC( arg0.SetAlign() );
+    break;
+  case CSeq_annot::C_Data::e_Ftable:
+    x_FusedCleanupSeqAnnot_data_ftable_ETC( arg0.SetFtable() );
+    break;
+  case CSeq_annot::C_Data::e_Graph:
+    x_FusedCleanupSeqAnnot_data_graph_ETC( arg0.SetGraph() );
+    break;
+  case CSeq_annot::C_Data::e_Ids:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+    break;
+  case CSeq_annot::C_Data::e_Locs:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetLocs() );
+    break;
+  case CSeq_annot::C_Data::e_Seq_table:
+    x_FusedCleanupSeqAnnot_data_seq_table_ETC( arg0.SetSeq_table() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data_annots_E_E_data_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_desc_desc_E_E_align_align_ETC( CAlign_def & arg0 )
+{ // type Sequence
+  if( arg0.IsSetIds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+  }
+} // end of x_FusedCleanupSeqAnnot_desc_desc_E_E_align_align_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_desc_desc_E_E_align_ETC( CAlign_def & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_desc_desc_E_E_align_align_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_desc_desc_E_E_align_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_desc_desc_E_E_ETC( CAnnotdesc & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CAnnotdesc::e_Align:
+    x_FusedCleanupSeqAnnot_desc_desc_E_E_align_ETC( arg0.SetAlign() );
+    break;
+  case CAnnotdesc::e_Create_date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetCreate_date() );
+    break;
+  case CAnnotdesc::e_Pub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_ETC( arg0.SetPub() );
+    break;
+  case CAnnotdesc::e_Region:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetRegion() );
+    break;
+  case CAnnotdesc::e_Src:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_ETC( arg0.SetSrc() );
+    break;
+  case CAnnotdesc::e_Update_date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetUpdate_date() );
+    break;
+  case CAnnotdesc::e_User:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_spliced_exons_E_E_ext_E_E_data_E_E_data_objects_E_ETC( arg0.SetUser() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_desc_desc_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_desc_desc_E_ETC( CAnnotdesc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_desc_desc_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqAnnot_desc_desc_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cannotdesc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_desc_desc_ETC( Tcontainer_ncbi_cref_cannotdesc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cannotdesc_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_desc_desc_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_desc_desc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_desc_ETC( CAnnot_descr & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_desc_desc_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_desc_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_annots_E_E_ETC( CSeq_annot & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqSubmit_data_annots_E_E_data_ETC( arg0.SetData() );
+  }
+  if( arg0.IsSetDesc() ) {
+    x_FusedCleanupSeqAnnot_desc_ETC( arg0.SetDesc() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_annots_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_annots_E_ETC( CSeq_annot & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_annots_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_annots_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseq_annot_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_annots_ETC( Tcontainer_ncbi_cref_cseq_annot_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_annot_, iter, arg0 ) { 
+    x_FusedCleanupSeqSubmit_data_annots_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_annots_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_comment_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_CleanupStringJunkMarkChanged( arg0 );
+  m_NewCleanup.x_RemoveSpacesBetweenTildesMarkChanged( arg0 );
+  m_NewCleanup.X_CommentTildeFixes( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_comment_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_embl_ETC( CEMBL_block & arg0 )
+{ // type Sequence
+  m_NewCleanup.EMBLblockBC( arg0 );
+  if( arg0.IsSetCreation_date() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetCreation_date() );
+  }
+  if( arg0.IsSetUpdate_date() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetUpdate_date() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_embl_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_ETC( CEMBL_block & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_embl_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_genbank_origin_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.GBblockOriginBC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_genbank_origin_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_genbank_ETC( CGB_block & arg0 )
+{ // type Sequence
+  m_NewCleanup.GBblockBC( arg0 );
+  if( arg0.IsSetEntry_date() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetEntry_date() );
+  }
+  if( arg0.IsSetOrigin() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_genbank_origin_ETC( arg0.SetOrigin() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_genbank_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_ETC( CGB_block & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_genbank_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E_molinfo_molinfo( CMolInfo & arg0 )
+{ // type Sequence
+  m_NewCleanup.MolInfoBC( arg0 );
+  m_NewCleanup.x_FixUnsetMolFromBiomol( arg0, *m_LastArg_x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_ETC );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E_molinfo_molinfo
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E_molinfo( CMolInfo & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E_molinfo_molinfo( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E_molinfo
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_name_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_CleanupStringMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_name_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_replace_replace_ETC( CPDB_replace & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_replace_replace_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_replace_ETC( CPDB_replace & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_replace_replace_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_replace_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_ETC( CPDB_block & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDeposition() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDeposition() );
+  }
+  if( arg0.IsSetReplace() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_replace_ETC( arg0.SetReplace() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_ETC( CPDB_block & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_pdb_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_pir_ETC( CPIR_block & arg0 )
+{ // type Sequence
+  if( arg0.IsSetSeqref() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetSeqref() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_pir_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_ETC( CPIR_block & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_pir_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_region_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_CleanupStringMarkChanged( arg0 );
+  m_NewCleanup.x_ConvertDoubleQuotesMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_region_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_sp_ETC( CSP_block & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAnnotupd() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetAnnotupd() );
+  }
+  if( arg0.IsSetCreated() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetCreated() );
+  }
+  if( arg0.IsSetSeqref() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetSeqref() );
+  }
+  if( arg0.IsSetSequpd() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetSequpd() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_sp_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_ETC( CSP_block & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_sp_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_title_ETC( std::string & arg0 )
+{ // type Primitive
+  m_NewCleanup.x_DecodeXMLMarkChanged( arg0 );
+  m_NewCleanup.x_CompressStringSpacesMarkChanged( arg0 );
+  m_NewCleanup.x_CleanupStringMarkChanged( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_title_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E( CSeqdesc & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqdesc::e_Comment:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_comment_ETC( arg0.SetComment() );
+    break;
+  case CSeqdesc::e_Create_date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetCreate_date() );
+    break;
+  case CSeqdesc::e_Embl:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_ETC( arg0.SetEmbl() );
+    break;
+  case CSeqdesc::e_Genbank:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_ETC( arg0.SetGenbank() );
+    break;
+  case CSeqdesc::e_Modelev:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_ETC( arg0.SetModelev() );
+    break;
+  case CSeqdesc::e_Molinfo:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E_molinfo( arg0.SetMolinfo() );
+    break;
+  case CSeqdesc::e_Name:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_name_ETC( arg0.SetName() );
+    break;
+  case CSeqdesc::e_Num:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( arg0.SetNum() );
+    break;
+  case CSeqdesc::e_Org:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_ETC( arg0.SetOrg() );
+    break;
+  case CSeqdesc::e_Pdb:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_ETC( arg0.SetPdb() );
+    break;
+  case CSeqdesc::e_Pir:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_ETC( arg0.SetPir() );
+    break;
+  case CSeqdesc::e_Pub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_ETC( arg0.SetPub() );
+    break;
+  case CSeqdesc::e_Region:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_region_ETC( arg0.SetRegion() );
+    break;
+  case CSeqdesc::e_Source:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_ETC( arg0.SetSource() );
+    break;
+  case CSeqdesc::e_Sp:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_ETC( arg0.SetSp() );
+    break;
+  case CSeqdesc::e_Title:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_title_ETC( arg0.SetTitle() );
+    break;
+  case CSeqdesc::e_Update_date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetUpdate_date() );
+    break;
+  case CSeqdesc::e_User:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ETC( arg0.SetUser() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E( CSeqdesc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E_E( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E
+
+template< typename Tcontainer_ncbi_cref_cseqdesc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr( Tcontainer_ncbi_cref_cseqdesc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseqdesc_, iter, arg0 ) { 
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr_E( **iter );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr( CSeq_descr & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr_descr( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_E_E_ETC( CDelta_seq & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CDelta_seq::e_Loc:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0.SetLoc() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_E_ETC( CDelta_seq & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cdelta_seq_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_ETC( Tcontainer_ncbi_cref_cdelta_seq_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cdelta_seq_, iter, arg0 ) { 
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta( CDelta_ext & arg0 )
+{ // type Reference
+  m_NewCleanup.DeltaExtBC( arg0, *m_LastArg_x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ETC );
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta_delta_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_map_ETC( CMap_ext & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_map_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_ref_ETC( CRef_ext & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_loc_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_ref_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_seg_ETC( CSeg_ext & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_seg_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext( CSeq_ext & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_ext::e_Delta:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_delta( arg0.SetDelta() );
+    break;
+  case CSeq_ext::e_Map:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_map_ETC( arg0.SetMap() );
+    break;
+  case CSeq_ext::e_Ref:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_ref_ETC( arg0.SetRef() );
+    break;
+  case CSeq_ext::e_Seg:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext_seg_ETC( arg0.SetSeg() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext( CSeq_ext & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext_ext( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_deleted_ETC( CSeq_hist::C_Deleted & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_hist::C_Deleted::e_Date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_deleted_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_replaced_by_ETC( CSeq_hist_rec & arg0 )
+{ // type Sequence
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+  if( arg0.IsSetIds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_replaced_by_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_ETC( CSeq_hist_rec & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_replaced_by_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_ETC( CSeq_hist & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAssembly() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_pub_pub_num_num_ref_ref_aligns_aligns_segs_disc_disc_ETC( arg0.SetAssembly() );
+  }
+  if( arg0.IsSetDeleted() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_deleted_ETC( arg0.SetDeleted() );
+  }
+  if( arg0.IsSetReplaced_by() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_ETC( arg0.SetReplaced_by() );
+  }
+  if( arg0.IsSetReplaces() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_replaced_by_ETC( arg0.SetReplaces() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_ETC( CSeq_hist & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_hist_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ETC( CSeq_inst & arg0 )
+{ // type Sequence
+  m_LastArg_x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ETC = &arg0;
+
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ext( arg0.SetExt() );
+  }
+  if( arg0.IsSetHist() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_hist_ETC( arg0.SetHist() );
+  }
+
+  m_LastArg_x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ETC = NULL;
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_ETC( CSeq_inst & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_inst_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_ETC( CBioseq & arg0 )
+{ // type Sequence
+  m_LastArg_x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_ETC = &arg0;
+
+  m_NewCleanup.ProtSeqBC( arg0 );
+  m_NewCleanup.x_RemoveSingleStrand( arg0 );
+  if( arg0.IsSetAnnot() ) {
+    x_FusedCleanupSeqSubmit_data_annots_ETC( arg0.SetAnnot() );
+  }
+  if( arg0.IsSetDescr() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_descr( arg0.SetDescr() );
+  }
+  if( arg0.IsSetId() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetId() );
+  }
+  if( arg0.IsSetInst() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_inst_ETC( arg0.SetInst() );
+  }
+  m_NewCleanup.x_AddPartialToProteinTitle( arg0 );
+  m_NewCleanup.x_ClearEmptyDescr( arg0 );
+
+  m_LastArg_x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_ETC = NULL;
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_ETC( CBioseq & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_seq_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_molinfo_molinfo_ETC( CMolInfo & arg0 )
+{ // type Sequence
+  m_NewCleanup.MolInfoBC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_molinfo_molinfo_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_molinfo_ETC( CMolInfo & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_molinfo_molinfo_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_molinfo_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_ETC( CSeqdesc & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeqdesc::e_Comment:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_comment_ETC( arg0.SetComment() );
+    break;
+  case CSeqdesc::e_Create_date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetCreate_date() );
+    break;
+  case CSeqdesc::e_Embl:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_embl_ETC( arg0.SetEmbl() );
+    break;
+  case CSeqdesc::e_Genbank:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_genbank_ETC( arg0.SetGenbank() );
+    break;
+  case CSeqdesc::e_Modelev:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_support_support_model_evidence_E_ETC( arg0.SetModelev() );
+    break;
+  case CSeqdesc::e_Molinfo:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_molinfo_ETC( arg0.SetMolinfo() );
+    break;
+  case CSeqdesc::e_Name:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_name_ETC( arg0.SetName() );
+    break;
+  case CSeqdesc::e_Num:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_num_ETC( arg0.SetNum() );
+    break;
+  case CSeqdesc::e_Org:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_txinit_txinit_txorg_ETC( arg0.SetOrg() );
+    break;
+  case CSeqdesc::e_Pdb:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pdb_ETC( arg0.SetPdb() );
+    break;
+  case CSeqdesc::e_Pir:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_pir_ETC( arg0.SetPir() );
+    break;
+  case CSeqdesc::e_Pub:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_data_data_pub_ETC( arg0.SetPub() );
+    break;
+  case CSeqdesc::e_Region:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_region_ETC( arg0.SetRegion() );
+    break;
+  case CSeqdesc::e_Source:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_biosrc_ETC( arg0.SetSource() );
+    break;
+  case CSeqdesc::e_Sp:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_sp_ETC( arg0.SetSp() );
+    break;
+  case CSeqdesc::e_Title:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_title_ETC( arg0.SetTitle() );
+    break;
+  case CSeqdesc::e_Update_date:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetUpdate_date() );
+    break;
+  case CSeqdesc::e_User:
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_ext_ETC( arg0.SetUser() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_ETC( CSeqdesc & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_E_ETC( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_ETC
+
+template< typename Tcontainer_ncbi_cref_cseqdesc_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_ETC( Tcontainer_ncbi_cref_cseqdesc_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseqdesc_, iter, arg0 ) { 
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_E_ETC( **iter );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_ETC( CSeq_descr & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_descr_ETC( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqEntry_set_set_seq_set_E( CSeq_entry & arg0 )
+{ // type Reference
+    FusedCleanupSeqEntry( arg0 );
+} // end of x_FusedCleanupSeqEntry_set_set_seq_set_E
+
+template< typename Tcontainer_ncbi_cref_cseq_entry_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqEntry_set_set_seq_set( Tcontainer_ncbi_cref_cseq_entry_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_entry_, iter, arg0 ) { 
+    x_FusedCleanupSeqEntry_set_set_seq_set_E( **iter );
+  }
+} // end of x_FusedCleanupSeqEntry_set_set_seq_set
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqEntry_set_set_ETC( CBioseq_set & arg0 )
+{ // type Sequence
+  m_NewCleanup.SeqsetBC( arg0 );
+  if( arg0.IsSetAnnot() ) {
+    x_FusedCleanupSeqSubmit_data_annots_ETC( arg0.SetAnnot() );
+  }
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+  if( arg0.IsSetDescr() ) {
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_set_set_descr_ETC( arg0.SetDescr() );
+  }
+  if( arg0.IsSetSeq_set() ) {
+    x_FusedCleanupSeqEntry_set_set_seq_set( arg0.SetSeq_set() );
+  }
+  m_NewCleanup.x_ClearEmptyDescr( arg0 );
+} // end of x_FusedCleanupSeqEntry_set_set_ETC
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqEntry_set( CBioseq_set & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqEntry_set_set_ETC( arg0 );
+} // end of x_FusedCleanupSeqEntry_set
+
+void CAutogeneratedFusedCleanup::FusedCleanupSeqEntry( CSeq_entry & arg0 )
+{ // type Choice
+  if( m_NewCleanup.x_SkipUnchangedEntryFC( arg0 ) ) {
+    return;
+  }
+  m_NewCleanup.EnteringEntry( arg0 );
+  m_NewCleanup.x_CopyGBBlockDivToOrgnameDiv( arg0 );
+  switch( arg0.Which() ) {
+  case CSeq_entry::e_Seq:
+    x_FusedCleanupSeqSubmit_data_entrys_E_E_seq_ETC( arg0.SetSeq() );
+    break;
+  case CSeq_entry::e_Set:
+    x_FusedCleanupSeqEntry_set( arg0.SetSet() );
+    break;
+  default:
+    break;
+  }
+  m_NewCleanup.LeavingEntry( arg0 );
+} // end of FusedCleanupSeqEntry
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys_E( CSeq_entry & arg0 )
+{ // type Reference
+    FusedCleanupSeqEntry( arg0 );
+} // end of x_FusedCleanupSeqSubmit_data_entrys_E
+
+template< typename Tcontainer_ncbi_cref_cseq_entry_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data_entrys( Tcontainer_ncbi_cref_cseq_entry_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_entry_, iter, arg0 ) { 
+    x_FusedCleanupSeqSubmit_data_entrys_E( **iter );
+  }
+} // end of x_FusedCleanupSeqSubmit_data_entrys
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_data( CSeq_submit::C_Data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_submit::C_Data::e_Annots:
+    x_FusedCleanupSeqSubmit_data_annots_ETC( arg0.SetAnnots() );
+    break;
+  case CSeq_submit::C_Data::e_Delete:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetDelete() );
+    break;
+  case CSeq_submit::C_Data::e_Entrys:
+    x_FusedCleanupSeqSubmit_data_entrys( arg0.SetEntrys() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqSubmit_data
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub_cit_cit_authors_authors( CAuth_list & arg0 )
+{ // type Sequence
+  m_NewCleanup.x_AuthListBCWithFixInitials( arg0 );
+  if( arg0.IsSetAffil() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_imp_pub_ETC( arg0.SetAffil() );
+  }
+  if( arg0.IsSetNames() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_ETC( arg0.SetNames() );
+  }
+} // end of x_FusedCleanupSeqSubmit_sub_sub_cit_cit_authors_authors
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub_cit_cit_authors( CAuth_list & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_sub_sub_cit_cit_authors_authors( arg0 );
+} // end of x_FusedCleanupSeqSubmit_sub_sub_cit_cit_authors
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub_cit_cit( CCit_sub & arg0 )
+{ // type Sequence
+  if( arg0.IsSetAuthors() ) {
+    x_FusedCleanupSeqSubmit_sub_sub_cit_cit_authors( arg0.SetAuthors() );
+  }
+  if( arg0.IsSetDate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetDate() );
+  }
+  if( arg0.IsSetImp() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_imp_ETC( arg0.SetImp() );
+  }
+} // end of x_FusedCleanupSeqSubmit_sub_sub_cit_cit
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub_cit( CCit_sub & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_sub_sub_cit_cit( arg0 );
+} // end of x_FusedCleanupSeqSubmit_sub_sub_cit
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub_contact_contact( CContact_info & arg0 )
+{ // type Sequence
+  if( arg0.IsSetContact() ) {
+    x_FusedCleanupSeqAnnot_data_ftable_E_E_xref_E_E_data_data_variation_variation_pub_pub_man_man_cit_cit_authors_authors_names_std_E_ETC( arg0.SetContact() );
+  }
+} // end of x_FusedCleanupSeqSubmit_sub_sub_contact_contact
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub_contact( CContact_info & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_sub_sub_contact_contact( arg0 );
+} // end of x_FusedCleanupSeqSubmit_sub_sub_contact
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub_sub( CSubmit_block & arg0 )
+{ // type Sequence
+  if( arg0.IsSetCit() ) {
+    x_FusedCleanupSeqSubmit_sub_sub_cit( arg0.SetCit() );
+  }
+  if( arg0.IsSetContact() ) {
+    x_FusedCleanupSeqSubmit_sub_sub_contact( arg0.SetContact() );
+  }
+  if( arg0.IsSetReldate() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_sparse_other_sparse_other_interval_interval_id_id_pdb_pdb_rel_ETC( arg0.SetReldate() );
+  }
+} // end of x_FusedCleanupSeqSubmit_sub_sub
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqSubmit_sub( CSubmit_block & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqSubmit_sub_sub( arg0 );
+} // end of x_FusedCleanupSeqSubmit_sub
+
+void CAutogeneratedFusedCleanup::FusedCleanupSeqSubmit( CSeq_submit & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqSubmit_data( arg0.SetData() );
+  }
+  if( arg0.IsSetSub() ) {
+    x_FusedCleanupSeqSubmit_sub( arg0.SetSub() );
+  }
+} // end of FusedCleanupSeqSubmit
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext_E( CUser_object & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E_E1049( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext_E
+
+template< typename Tcontainer_ncbi_cref_cuser_object_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_ext( Tcontainer_ncbi_cref_cuser_object_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cuser_object_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_ext
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc_disc_E( CSeq_align & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc_disc_E
+
+template< typename Tcontainer_ncbi_cref_cseq_align_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc_disc( Tcontainer_ncbi_cref_cseq_align_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_align_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc_disc_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc_disc
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc( CSeq_align_set & arg0 )
+{ // type Reference
+  if( arg0.IsSet() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc_disc( arg0.Set() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E_segs( CSeq_align::C_Segs & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_align::C_Segs::e_Dendiag:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_dendiag_ETC( arg0.SetDendiag() );
+    break;
+  case CSeq_align::C_Segs::e_Denseg:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_denseg_ETC( arg0.SetDenseg() );
+    break;
+  case CSeq_align::C_Segs::e_Disc:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_disc( arg0.SetDisc() );
+    break;
+  case CSeq_align::C_Segs::e_Packed:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_packed_ETC( arg0.SetPacked() );
+    break;
+  case CSeq_align::C_Segs::e_Sparse:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_sparse_ETC( arg0.SetSparse() );
+    break;
+  case CSeq_align::C_Segs::e_Spliced:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_spliced_ETC( arg0.SetSpliced() );
+    break;
+  case CSeq_align::C_Segs::e_Std:
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs_std_ETC( arg0.SetStd() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E_segs
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E_E( CSeq_align & arg0 )
+{ // type Sequence
+  if( arg0.IsSetBounds() ) {
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetBounds() );
+  }
+  if( arg0.IsSetExt() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_ext( arg0.SetExt() );
+  }
+  if( arg0.IsSetSegs() ) {
+    x_FusedCleanupSeqAnnot_data_align_E_E_segs( arg0.SetSegs() );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align_E_E
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align_E( CSeq_align & arg0 )
+{ // type Reference
+    x_FusedCleanupSeqAnnot_data_align_E_E( arg0 );
+} // end of x_FusedCleanupSeqAnnot_data_align_E
+
+template< typename Tcontainer_ncbi_cref_cseq_align_ >
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data_align( Tcontainer_ncbi_cref_cseq_align_ & arg0 )
+{ // type UniSequence
+  NON_CONST_ITERATE( typename Tcontainer_ncbi_cref_cseq_align_, iter, arg0 ) { 
+    x_FusedCleanupSeqAnnot_data_align_E( **iter );
+  }
+} // end of x_FusedCleanupSeqAnnot_data_align
+
+void CAutogeneratedFusedCleanup::x_FusedCleanupSeqAnnot_data( CSeq_annot::C_Data & arg0 )
+{ // type Choice
+  switch( arg0.Which() ) {
+  case CSeq_annot::C_Data::e_Align:
+    x_FusedCleanupSeqAnnot_data_align( arg0.SetAlign() );
+    break;
+  case CSeq_annot::C_Data::e_Ftable:
+    x_FusedCleanupSeqAnnot_data_ftable_ETC( arg0.SetFtable() );
+    break;
+  case CSeq_annot::C_Data::e_Graph:
+    x_FusedCleanupSeqAnnot_data_graph_ETC( arg0.SetGraph() );
+    break;
+  case CSeq_annot::C_Data::e_Ids:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_data_data_id_ETC( arg0.SetIds() );
+    break;
+  case CSeq_annot::C_Data::e_Locs:
+    x_FusedCleanupSeqAnnot_data_seq_table_seq_table_columns_E_E_default_default_loc_loc_equiv_equiv_ETC( arg0.SetLocs() );
+    break;
+  case CSeq_annot::C_Data::e_Seq_table:
+    x_FusedCleanupSeqAnnot_data_seq_table_ETC( arg0.SetSeq_table() );
+    break;
+  default:
+    break;
+  }
+} // end of x_FusedCleanupSeqAnnot_data
+
+void CAutogeneratedFusedCleanup::FusedCleanupSeqAnnot( CSeq_annot & arg0 )
+{ // type Sequence
+  if( arg0.IsSetData() ) {
+    x_FusedCleanupSeqAnnot_data( arg0.SetData() );
+  }
+  if( arg0.IsSetDesc() ) {
+    x_FusedCleanupSeqAnnot_desc_ETC( arg0.SetDesc() );
+  }
+} // end of FusedCleanupSeqAnnot
+
+
+END_SCOPE(objects)
+END_SCOPE(ncbi)
+
@@ -0,0 +1,15 @@
+#!/bin/sh
+
+# The rules are those of BasicCleanup followed by the feature rules of
+# ExtendedCleanup; only the check for unchanged entries differs.
+spec=autogenerated_fused_cleanup.tmp.txt
+cat autogenerated_fused_cleanup.txt > $spec
+sed -e '1,/^# Don.t forget: order matters!/d' \
+    -e 's/x_SkipUnchangedEntryBC/x_SkipUnchangedEntryFC/' \
+    autogenerated_cleanup.txt >> $spec
+sed -e '1,/^# Don.t forget: order matters!/d' \
+    autogenerated_extended_feat_cleanup.txt >> $spec
+
+datatool -pch ncbi_pch.hpp -m ../../objects/seqset/seqset.asn  -m ../../objects/general/general.asn -m ../../objects/seq/seq.asn  -m ../../objects/seqloc/seqloc.asn -m ../../objects/seqfeat/seqfeat.asn -m ../../objects/seqblock/seqblock.asn  -m ../../objects/seqalign/seqalign.asn -m ../../objects/pub/pub.asn  -m ../../objects/biblio/biblio.asn  -m ../../objects/seqres/seqres.asn -m ../../objects/seqtable/seqtable.asn -m ../../objects/medline/medline.asn -m ../../objects/submit/submit.asn -oA -tvs $spec
+
+rm -f $spec
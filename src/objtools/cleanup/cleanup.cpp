@@ -31,6 +31,7 @@
  */
 #include <ncbi_pch.hpp>
 #include <corelib/ncbistd.hpp>
+#include <corelib/ncbi_safe_static.hpp>
 #include <serial/serialbase.hpp>
 #include <objects/seq/Bioseq.hpp>
 #include <objects/seq/Seq_annot.hpp>
@@ -79,7 +80,12 @@ enum EChangeType {
 // *********************** CCleanup implementation **********************
 
 
+// Entries whose digests are kept for eClean_SkipUnchanged
+static const size_t kMaxCleanDigests = 100000;
+
+
 CCleanup::CCleanup(CScope* scope, EScopeOptions scope_handling)
+    : m_CleanDigests(kMaxCleanDigests)
 {
     if (scope && scope_handling == eScope_UseInPlace) {
         m_Scope = scope;
@@ -120,7 +126,10 @@ CRef<CCleanupChange> makeCleanupChange(Uint4 options)
 #define CLEANUP_SETUP \
     CRef<CCleanupChange> changes(makeCleanupChange(options)); \
     CNewCleanup_imp clean_i(changes, options); \
-    clean_i.SetScope(*m_Scope);
+    clean_i.SetScope(*m_Scope); \
+    if (options & eClean_SkipUnchanged) { \
+        clean_i.SetCleanDigests(&m_CleanDigests); \
+    }
 
 CConstRef<CCleanupChange> CCleanup::BasicCleanup(CSeq_entry& se, Uint4 options)
 {
@@ -184,6 +193,9 @@ CConstRef<CCleanupChange> CCleanup::BasicCleanup(CSeq_entry_Handle& seh, Uint4 o
     CRef<CCleanupChange> changes(makeCleanupChange(options));
     CNewCleanup_imp clean_i(changes, options);
     clean_i.SetScope(seh.GetScope());
+    if (options & eClean_SkipUnchanged) {
+        clean_i.SetCleanDigests(&m_CleanDigests);
+    }
     clean_i.BasicCleanupSeqEntryHandle(seh);
     return changes;
 }
@@ -261,11 +273,41 @@ CConstRef<CCleanupChange> CCleanup::ExtendedCleanup(CSeq_entry_Handle& seh,  Uin
     CRef<CCleanupChange> changes(makeCleanupChange(options));
     CNewCleanup_imp clean_i(changes, options);
     clean_i.SetScope(seh.GetScope());
+    if (options & eClean_SkipUnchanged) {
+        clean_i.SetCleanDigests(&m_CleanDigests);
+    }
     clean_i.ExtendedCleanupSeqEntryHandle(seh); // (m_Scope->GetSeq_annotHandle(sa));
     return changes;
 }
 
 
+static CSafeStatic<CSectionTimes> s_RuleTimes;
+
+
+void CCleanup::EnableRuleTiming(bool enable)
+{
+    s_RuleTimes->Enable(enable);
+}
+
+
+bool CCleanup::IsRuleTimingEnabled(void)
+{
+    return s_RuleTimes->IsEnabled();
+}
+
+
+void CCleanup::GetRuleTimes(TRuleTimes& times)
+{
+    s_RuleTimes->GetTimes(times);
+}
+
+
+CSectionTimes& CCleanup::x_GetRuleTimes(void)
+{
+    return s_RuleTimes.Get();
+}
+
+
 // *********************** CCleanupChange implementation **********************
 
 
@@ -37,6 +37,8 @@
 #include <ncbi_pch.hpp>
 
 #include <corelib/ncbi_autoinit.hpp>
+#include <corelib/rwstream.hpp>
+#include <serial/serial.hpp>
 
 #include <objects/misc/sequence_macros.hpp>
 #include <objmgr/annot_ci.hpp>
@@ -62,6 +64,7 @@
 #include <objects/valid/Comment_rule.hpp>
 #include <objects/valid/Comment_set.hpp>
 
+#include <util/checksum.hpp>
 #include <util/ncbi_cache.hpp>
 #include <util/sequtil/sequtil_convert.hpp>
 #include <util/sequtil/sequtil_manip.hpp>
@@ -70,6 +73,8 @@
 
 #include "autogenerated_cleanup.hpp"
 #include "autogenerated_extended_cleanup.hpp"
+#include "autogenerated_extended_feat_cleanup.hpp"
+#include "autogenerated_fused_cleanup.hpp"
 
 BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(objects)
@@ -172,7 +177,10 @@ CNewCleanup_imp::CNewCleanup_imp (CRef<CCleanupChange> changes, Uint4 options)
       m_SyncGenCodes(false),
       m_StripSerial(true),
       m_IsEmblOrDdbj(false),
-      m_KeepTopNestedSet(false)
+      m_KeepTopNestedSet(false),
+      m_RuleTimes(CCleanup::x_GetRuleTimes()),
+      m_CleanDigests(NULL),
+      m_ChangeCount(0)
 {
     if (options & CCleanup::eClean_GpipeMode) {
         m_IsGpipe = true;
@@ -203,6 +211,26 @@ void CNewCleanup_imp::BasicCleanupSeqEntry (
     CSeq_entry& se
 )
 
+{
+    x_BasicCleanupSeqEntry(se, false);
+}
+
+void CNewCleanup_imp::BasicCleanupSeqSubmit (
+    CSeq_submit& ss
+)
+
+{
+    x_BasicCleanupSeqSubmit(ss, false);
+}
+
+// With fused set, the walker also applies the rules of ExtendedCleanup
+// that only look at the feature they are given, see
+// autogenerated_fused_cleanup.txt
+void CNewCleanup_imp::x_BasicCleanupSeqEntry (
+    CSeq_entry& se,
+    bool fused
+)
+
 {
     // The class CAutogeneratedCleanup is actually auto-generated code
     // created by datatool from autogenerated_cleanup.txt
@@ -211,44 +239,100 @@ void CNewCleanup_imp::BasicCleanupSeqEntry (
     // The idea is that we don't have to hand-write the
     // error-prone traversal code.
     SetGlobalFlags(se);
-    CAutogeneratedCleanup auto_cleanup( *m_Scope, *this );
-    auto_cleanup.BasicCleanupSeqEntry( se );
-    x_PostProcessing();
+    if (m_CleanDigests) {
+        m_CleanRoots.insert(&se);
+    }
+    if (fused) {
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: fused walker");
+        CAutogeneratedFusedCleanup auto_cleanup( *m_Scope, *this );
+        auto_cleanup.FusedCleanupSeqEntry( se );
+    } else {
+        CSectionTimer timer(m_RuleTimes, "BasicCleanup: walker");
+        CAutogeneratedCleanup auto_cleanup( *m_Scope, *this );
+        auto_cleanup.BasicCleanupSeqEntry( se );
+    }
+    {{
+        CSectionTimer timer(m_RuleTimes, "BasicCleanup: post-processing");
+        x_PostProcessing();
+    }}
 
-    EXPLORE_ALL_BIOSEQS_WITHIN_SEQENTRY (bit, se) {
-        CBioseq& bs = *bit;
-        SetGeneticCode (bs);
+    {{
+        CSectionTimer timer(m_RuleTimes, "BasicCleanup: genetic codes");
+        EXPLORE_ALL_BIOSEQS_WITHIN_SEQENTRY (bit, se) {
+            CBioseq& bs = *bit;
+            SetGeneticCode (bs);
+        }
+    }}
+    // ExtendedCleanup remembers its own digests instead
+    if (m_CleanDigests  &&  !fused) {
+        x_RememberCleanEntries(se, 'B');
     }
 }
 
-void CNewCleanup_imp::BasicCleanupSeqSubmit (
-    CSeq_submit& ss
+void CNewCleanup_imp::x_BasicCleanupSeqSubmit (
+    CSeq_submit& ss,
+    bool fused
 )
 
 {
     SetGlobalFlags(ss);
-    CAutogeneratedCleanup auto_cleanup( *m_Scope, *this );
-    auto_cleanup.BasicCleanupSeqSubmit( ss );
-    x_PostProcessing();
+    if (m_CleanDigests  &&  ss.IsEntrys()) {
+        ITERATE(CSeq_submit::TData::TEntrys, it, ss.GetData().GetEntrys()) {
+            m_CleanRoots.insert(it->GetPointer());
+        }
+    }
+    if (fused) {
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: fused walker");
+        CAutogeneratedFusedCleanup auto_cleanup( *m_Scope, *this );
+        auto_cleanup.FusedCleanupSeqSubmit( ss );
+    } else {
+        CSectionTimer timer(m_RuleTimes, "BasicCleanup: walker");
+        CAutogeneratedCleanup auto_cleanup( *m_Scope, *this );
+        auto_cleanup.BasicCleanupSeqSubmit( ss );
+    }
+    {{
+        CSectionTimer timer(m_RuleTimes, "BasicCleanup: post-processing");
+        x_PostProcessing();
+    }}
 
     CRef<CSeq_entry> se (ss.SetData().SetEntrys().front());
     if (se.NotEmpty()) {
+        CSectionTimer timer(m_RuleTimes, "BasicCleanup: genetic codes");
         EXPLORE_ALL_BIOSEQS_WITHIN_SEQENTRY (bit, *se) {
             CBioseq& bs = *bit;
             SetGeneticCode (bs);
         }
     }
+    if (m_CleanDigests  &&  !fused  &&  ss.IsEntrys()) {
+        ITERATE(CSeq_submit::TData::TEntrys, it, ss.GetData().GetEntrys()) {
+            x_RememberCleanEntries(**it, 'B');
+        }
+    }
 }
 
 void CNewCleanup_imp::BasicCleanupSeqAnnot (
     CSeq_annot& sa
 )
 
+{
+    x_BasicCleanupSeqAnnot(sa, false);
+}
+
+void CNewCleanup_imp::x_BasicCleanupSeqAnnot (
+    CSeq_annot& sa,
+    bool fused
+)
+
 {
     // no Seq-entry context, so skip setup function
     ResetGlobalFlags();
-    CAutogeneratedCleanup auto_cleanup( *m_Scope, *this );
-    auto_cleanup.BasicCleanupSeqAnnot( sa );
+    if (fused) {
+        CAutogeneratedFusedCleanup auto_cleanup( *m_Scope, *this );
+        auto_cleanup.FusedCleanupSeqAnnot( sa );
+    } else {
+        CAutogeneratedCleanup auto_cleanup( *m_Scope, *this );
+        auto_cleanup.BasicCleanupSeqAnnot( sa );
+    }
     x_PostProcessing();
 }
 
@@ -487,6 +571,7 @@ void CNewCleanup_imp::SetGeneticCode (
 
 void CNewCleanup_imp::ChangeMade (CCleanupChange::EChanges e)
 {
+    ++m_ChangeCount;
     if (m_Changes) {
         m_Changes->SetChanged (e);
     }
@@ -590,6 +675,257 @@ void CNewCleanup_imp::LeavingEntry (
 #endif
 }
 
+
+// The members of these sets are independent records, so one member can
+// be left alone while the others are cleaned
+static bool s_HasIndependentMembers(const CBioseq_set& bss)
+{
+    if (!bss.IsSetClass()) {
+        return false;
+    }
+    switch (bss.GetClass()) {
+    case CBioseq_set::eClass_genbank:
+    case CBioseq_set::eClass_pop_set:
+    case CBioseq_set::eClass_phy_set:
+    case CBioseq_set::eClass_mut_set:
+    case CBioseq_set::eClass_eco_set:
+    case CBioseq_set::eClass_wgs_set:
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+// Everything in a set but its members
+static void s_WriteSetShell(CNcbiOstream& out, const CBioseq_set& bss)
+{
+    out << 'S';
+    if (bss.IsSetId()) {
+        out << 'i' << MSerial_AsnBinary << bss.GetId();
+    }
+    if (bss.IsSetColl()) {
+        out << 'c' << MSerial_AsnBinary << bss.GetColl();
+    }
+    if (bss.IsSetLevel()) {
+        out << 'l' << bss.GetLevel() << ' ';
+    }
+    if (bss.IsSetClass()) {
+        out << 'k' << bss.GetClass() << ' ';
+    }
+    if (bss.IsSetRelease()) {
+        out << 'r' << bss.GetRelease().size() << ' ' << bss.GetRelease();
+    }
+    if (bss.IsSetDate()) {
+        out << 'd' << MSerial_AsnBinary << bss.GetDate();
+    }
+    if (bss.IsSetDescr()) {
+        out << 'e' << MSerial_AsnBinary << bss.GetDescr();
+    }
+    if (bss.IsSetAnnot()) {
+        ITERATE(CBioseq_set::TAnnot, it, bss.GetAnnot()) {
+            out << 'a' << MSerial_AsnBinary << **it;
+        }
+    }
+}
+
+
+// Cleanup was called for the entry, or it is a member of a set of
+// independent records that cleanup was called for.
+bool CNewCleanup_imp::x_IsInSkipRegion(const CSeq_entry& se)
+{
+    if (m_CleanRoots.find(&se) != m_CleanRoots.end()) {
+        return true;
+    }
+    CSeq_entry_Handle seh =
+        m_Scope->GetSeq_entryHandle(se, CScope::eMissing_Null);
+    if (!seh) {
+        return false;
+    }
+    CSeq_entry_Handle parent = seh.GetParentEntry();
+    if (!parent  ||
+        !s_HasIndependentMembers(*parent.GetSet().GetCompleteBioseq_set())) {
+        return false;
+    }
+    return x_IsInSkipRegion(*parent.GetCompleteSeq_entry());
+}
+
+
+// The entries skipped on their own.  A set of independent records is not
+// one of them, its members are, so it is never digested as a whole.
+bool CNewCleanup_imp::x_IsSkipUnit(const CSeq_entry& se)
+{
+    if (se.IsSet()  &&  s_HasIndependentMembers(se.GetSet())) {
+        return false;
+    }
+    return x_IsInSkipRegion(se);
+}
+
+
+// The digests are looked up by a label of the entry rather than by its
+// address, so that a record read again, or copied, is recognized too.
+// Two entries with the same label only cost a missed skip, as the digest
+// itself is compared.
+string CNewCleanup_imp::x_GetCleanDigestKey(const CSeq_entry& se, char kind)
+{
+    string label;
+    se.GetLabel(&label, CSeq_entry::eBoth);
+    return label.empty() ? label : kind + label;
+}
+
+
+// Digest of everything the cleanup of an entry depends on: its options and
+// global flags, the sets around the entry and the entry itself.  The kind
+// of the cleanup is in the key, so one digest serves both kinds.
+string CNewCleanup_imp::x_GetCleanDigest(const CSeq_entry& se)
+{
+    CChecksumStreamWriter md5(CChecksum::eMD5);
+    {{
+        CWStream wstr(&md5);
+        wstr << m_Options << ' ' << m_StripSerial << m_IsEmblOrDdbj;
+        CSeq_entry_Handle seh =
+            m_Scope->GetSeq_entryHandle(se, CScope::eMissing_Null);
+        if (seh) {
+            for (CSeq_entry_Handle parent = seh.GetParentEntry();  parent;
+                 parent = parent.GetParentEntry()) {
+                wstr << x_GetSetShellDigest(
+                    *parent.GetSet().GetCompleteBioseq_set());
+            }
+        }
+        wstr << MSerial_AsnBinary << se;
+    }}
+    string digest;
+    md5.GetChecksum().GetMD5Digest(digest);
+    return digest;
+}
+
+
+// The sets around the members of a set are digested once for them all,
+// until a change is made
+string CNewCleanup_imp::x_GetSetShellDigest(const CBioseq_set& bss)
+{
+    TShellDigests::const_iterator it = m_ShellDigests.find(&bss);
+    if (it != m_ShellDigests.end()  &&  it->second.second == m_ChangeCount) {
+        return it->second.first;
+    }
+    CChecksumStreamWriter md5(CChecksum::eMD5);
+    {{
+        CWStream wstr(&md5);
+        s_WriteSetShell(wstr, bss);
+    }}
+    string digest;
+    md5.GetChecksum().GetMD5Digest(digest);
+    m_ShellDigests[&bss] = make_pair(digest, m_ChangeCount);
+    return digest;
+}
+
+
+// The digest an entry was skipped with, while no change has been made
+// since; empty otherwise.
+string CNewCleanup_imp::x_GetSkippedDigest(const CSeq_entry& se)
+{
+    TSkippedDigests::const_iterator it = m_SkippedDigests.find(&se);
+    if (it == m_SkippedDigests.end()  ||
+        it->second.second != m_ChangeCount) {
+        return kEmptyStr;
+    }
+    return it->second.first;
+}
+
+
+// The first of the kinds of cleanup the entry has not changed since, or 0.
+// The entry is digested at most once for all of them.
+char CNewCleanup_imp::x_GetUnchangedKind(const CSeq_entry& se, const char* kinds)
+{
+    if (!m_CleanDigests  ||  !x_IsSkipUnit(se)) {
+        return 0;
+    }
+    string key = x_GetCleanDigestKey(se, *kinds);
+    if (key.empty()) {
+        return 0;
+    }
+    string digest = x_GetSkippedDigest(se);
+    for (const char* kind = kinds;  *kind;  ++kind) {
+        // the key is the kind followed by the label
+        key[0] = *kind;
+        CCleanup::TCleanDigests::iterator it = m_CleanDigests->find(key);
+        if (it == m_CleanDigests->end()) {
+            continue;
+        }
+        if (digest.empty()) {
+            digest = x_GetCleanDigest(se);
+        }
+        if (it->second == digest) {
+            m_SkippedDigests[&se] = make_pair(digest, m_ChangeCount);
+            return *kind;
+        }
+    }
+    m_SkippedDigests.erase(&se);
+    return 0;
+}
+
+
+void CNewCleanup_imp::x_RememberCleanEntries(const CSeq_entry& se, char kind)
+{
+    if (se.IsSet()  &&  s_HasIndependentMembers(se.GetSet())) {
+        if (se.GetSet().IsSetSeq_set()) {
+            ITERATE(CBioseq_set::TSeq_set, it, se.GetSet().GetSeq_set()) {
+                x_RememberCleanEntries(**it, kind);
+            }
+        }
+        return;
+    }
+    string key = x_GetCleanDigestKey(se, kind);
+    if (key.empty()) {
+        return;
+    }
+    string digest = x_GetSkippedDigest(se);
+    (*m_CleanDigests)[key] = digest.empty() ? x_GetCleanDigest(se) : digest;
+}
+
+
+// The walkers do not go into an entry that has not changed since the same
+// kind of cleanup was last done to it.  The passes over the whole record
+// still run; the pub fixes made there from the pubs of other members
+// (muid to pmid, feature citations) only see the members walked.
+bool CNewCleanup_imp::x_SkipUnchangedEntryBC(CSeq_entry& se)
+{
+    if (x_GetUnchangedKind(se, "B") == 0) {
+        return false;
+    }
+    // the later passes need a record read again to be in the scope
+    EnteringEntry(se);
+    return true;
+}
+
+
+bool CNewCleanup_imp::x_SkipUnchangedEntryEC(CSeq_entry& se)
+{
+    return x_GetUnchangedKind(se, "E") != 0;
+}
+
+
+// The fused walker skips an entry left unchanged since ExtendedCleanup.
+// One left unchanged since BasicCleanup only gets the feature rules of
+// ExtendedCleanup the fused walker would have applied.
+bool CNewCleanup_imp::x_SkipUnchangedEntryFC(CSeq_entry& se)
+{
+    switch (x_GetUnchangedKind(se, "EB")) {
+    case 'E':
+        EnteringEntry(se);
+        return true;
+    case 'B':
+        {{
+            EnteringEntry(se);
+            CAutogeneratedExtendedFeatCleanup auto_cleanup( *m_Scope, *this );
+            auto_cleanup.ExtendedFeatCleanupSeqEntry( se );
+        }}
+        return true;
+    default:
+        return false;
+    }
+}
+
 // Strips all spaces in string in following manner. If the function
 // meets several spaces (spaces and tabs) in succession it replaces them
 // with one space. Strips all spaces after '(' and before ( ')' or ',' ).
@@ -1082,6 +1418,7 @@ void CNewCleanup_imp::GBblockBC (
 )
 
 {
+    CSectionTimer timer(m_RuleTimes, "BasicCleanup: GenBank block");
     CLEAN_STRING_LIST (gbk, Extra_accessions);
 
     if (! EXTRAACCN_ON_GENBANKBLOCK_IS_SORTED (gbk, s_AccessionCompare)) {
@@ -1565,6 +1902,7 @@ void CNewCleanup_imp::BiosourceBC (
     CBioSource& biosrc
 )
 {
+    CSectionTimer timer(m_RuleTimes, "BasicCleanup: BioSource");
     if( FIELD_EQUALS( biosrc, Genome, CBioSource::eGenome_virion ) ) {
         RESET_FIELD( biosrc, Genome );
         ChangeMade ( CCleanupChange::eChangeBioSourceGenome );
@@ -1949,6 +2287,7 @@ void CNewCleanup_imp::OrgrefBC (
 )
 
 {
+    CSectionTimer timer(m_RuleTimes, "BasicCleanup: Org-ref");
     CLEAN_STRING_MEMBER (org, Taxname);
     CLEAN_STRING_MEMBER (org, Common);
     CLEAN_STRING_LIST (org, Syn);
@@ -2368,6 +2707,7 @@ void CNewCleanup_imp::PubdescBC (
     CPubdesc& pubdesc
 )
 {
+    CSectionTimer timer(m_RuleTimes, "BasicCleanup: Pubdesc");
     if ( FIELD_IS_SET(pubdesc, Comment)) {
         x_ConvertDoubleQuotesMarkChanged( GET_MUTABLE(pubdesc, Comment) );
     }
@@ -7361,6 +7701,7 @@ void CNewCleanup_imp::SeqfeatBC (
 )
 
 {
+    CSectionTimer timer(m_RuleTimes, "BasicCleanup: Seq-feat");
     // note - need to clean up GBQuals before dbxrefs, because they may be converted to populate other fields
     x_CleanSeqFeatQuals(sf);
 
@@ -12955,6 +13296,87 @@ void CNewCleanup_imp::CreatePubFromFeat(CSeq_feat& feat)
 }
 
 
+// The rules of ExtendedCleanup that only look at the feature they are
+// given, in the order the extended walker used to apply them.  Run in the
+// same pass as BasicCleanup, see autogenerated_extended_feat_cleanup.txt.
+void CNewCleanup_imp::x_SeqfeatEC(CSeq_feat& feat)
+{
+    CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: Seq-feat");
+    x_BondEC(feat);
+    MoveDbxrefs(feat);
+    MoveStandardName(feat);
+    CreatePubFromFeat(feat);
+
+    if (feat.IsSetData()) {
+        if (feat.GetData().IsGene()) {
+            x_RemoveRedundantComment(feat.SetData().SetGene(), feat);
+        }
+        x_SeqFeatDataEC(feat.SetData());
+    }
+    if (feat.IsSetTitle()) {
+        x_TrimInternalSemicolonsMarkChanged(feat.SetTitle());
+    }
+    if (feat.IsSetXref()) {
+        NON_CONST_ITERATE(CSeq_feat::TXref, it, feat.SetXref()) {
+            if ((*it)->IsSetData()) {
+                x_SeqFeatDataEC((*it)->SetData());
+            }
+        }
+    }
+    if (feat.IsSetExcept_text()) {
+        x_ExceptTextEC(feat.SetExcept_text());
+    }
+}
+
+
+void CNewCleanup_imp::x_SeqFeatDataEC(CSeqFeatData& data)
+{
+    switch (data.Which()) {
+    case CSeqFeatData::e_Gene:
+        x_GeneRefEC(data.SetGene());
+        break;
+    case CSeqFeatData::e_Prot:
+        x_RemoveProtDescThatDupsProtName(data.SetProt());
+        ProtRefEC(data.SetProt());
+        break;
+    case CSeqFeatData::e_Imp:
+        if (data.GetImp().IsSetKey()) {
+            x_TrimInternalSemicolonsMarkChanged(data.SetImp().SetKey());
+        }
+        if (data.GetImp().IsSetLoc()) {
+            x_TrimInternalSemicolonsMarkChanged(data.SetImp().SetLoc());
+        }
+        break;
+    case CSeqFeatData::e_Txinit:
+        if (data.GetTxinit().IsSetGene()) {
+            NON_CONST_ITERATE(CTxinit::TGene, it, data.SetTxinit().SetGene()) {
+                x_GeneRefEC(**it);
+            }
+        }
+        if (data.GetTxinit().IsSetProtein()) {
+            NON_CONST_ITERATE(CTxinit::TProtein, it, data.SetTxinit().SetProtein()) {
+                x_RemoveProtDescThatDupsProtName(**it);
+                ProtRefEC(**it);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+
+void CNewCleanup_imp::x_GeneRefEC(CGene_ref& gene)
+{
+    if (gene.IsSetMaploc()) {
+        x_TrimInternalSemicolonsMarkChanged(gene.SetMaploc());
+    }
+    if (gene.IsSetLocus_tag()) {
+        x_TrimInternalSemicolonsMarkChanged(gene.SetLocus_tag());
+    }
+}
+
+
 void CNewCleanup_imp::ResynchProteinPartials ( CSeq_feat& feat )
 {
     if (!feat.IsSetData() || !feat.GetData().IsProt()) {
@@ -13311,33 +13733,57 @@ bool IsTransgenic(const CBioSource& src)
 void CNewCleanup_imp::x_ExtendedCleanupExtra(CSeq_entry_Handle seh)
 {
     // This is for global changes
-    if (CCleanup::FixGeneXrefSkew(seh)) {
-        ChangeMade(CCleanupChange::eChangeGeneRef);
-    }
-    if (CCleanup::MoveProteinSpecificFeats(seh)) {
-        ChangeMade(CCleanupChange::eMoveFeat);
-    }
-    if (CCleanup::ConvertPubFeatsToPubDescs(seh)) {
-        ChangeMade(CCleanupChange::eAddDescriptor);
-        ChangeMade(CCleanupChange::eRemoveFeat);
-    }
-    if (CCleanup::RescueSiteRefPubs(seh)) {
-        ChangeMade(CCleanupChange::eAddDescriptor);
-        ChangeMade(CCleanupChange::eRemoveFeat);
-    }
-    if (CCleanup::ConvertSrcFeatsToSrcDescs(seh)) {
-        ChangeMade(CCleanupChange::eAddDescriptor);
-        ChangeMade(CCleanupChange::eRemoveFeat);
-    }
-    if (CCleanup::RenormalizeNucProtSets(seh)) {
-        ChangeMade(CCleanupChange::eCollapseSet);
-    }
-    if (CCleanup::RepairXrefs(seh)) {
-        ChangeMade(CCleanupChange::eAddSeqFeatXref);
-    }
-    if (CCleanup::RepackageProteins(seh)) {
-        ChangeMade(CCleanupChange::eChangeOther);
-    }
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: gene xref skew");
+        if (CCleanup::FixGeneXrefSkew(seh)) {
+            ChangeMade(CCleanupChange::eChangeGeneRef);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: protein-specific features");
+        if (CCleanup::MoveProteinSpecificFeats(seh)) {
+            ChangeMade(CCleanupChange::eMoveFeat);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: pub features");
+        if (CCleanup::ConvertPubFeatsToPubDescs(seh)) {
+            ChangeMade(CCleanupChange::eAddDescriptor);
+            ChangeMade(CCleanupChange::eRemoveFeat);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: site-ref pubs");
+        if (CCleanup::RescueSiteRefPubs(seh)) {
+            ChangeMade(CCleanupChange::eAddDescriptor);
+            ChangeMade(CCleanupChange::eRemoveFeat);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: source features");
+        if (CCleanup::ConvertSrcFeatsToSrcDescs(seh)) {
+            ChangeMade(CCleanupChange::eAddDescriptor);
+            ChangeMade(CCleanupChange::eRemoveFeat);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: nuc-prot sets");
+        if (CCleanup::RenormalizeNucProtSets(seh)) {
+            ChangeMade(CCleanupChange::eCollapseSet);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: xrefs");
+        if (CCleanup::RepairXrefs(seh)) {
+            ChangeMade(CCleanupChange::eAddSeqFeatXref);
+        }
+    }}
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: protein packaging");
+        if (CCleanup::RepackageProteins(seh)) {
+            ChangeMade(CCleanupChange::eChangeOther);
+        }
+    }}
 }
 
 
@@ -13347,16 +13793,22 @@ void CNewCleanup_imp::ExtendedCleanupSeqEntry (
 
 {
     // extended cleanup includes basic cleanup
-    BasicCleanupSeqEntry( seq_entry );
+    x_BasicCleanupSeqEntry( seq_entry, true );
     if( ! (m_Options & CCleanup::eClean_NoNcbiUserObjects) ) {
         x_AddNcbiCleanupObject(seq_entry);
     }
 
-    CAutogeneratedExtendedCleanup auto_ext_cleanup( *m_Scope, *this );
-    auto_ext_cleanup.ExtendedCleanupSeqEntry( seq_entry );
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: walker");
+        CAutogeneratedExtendedCleanup auto_ext_cleanup( *m_Scope, *this );
+        auto_ext_cleanup.ExtendedCleanupSeqEntry( seq_entry );
+    }}
     
     CSeq_entry_Handle seh = m_Scope->GetSeq_entryHandle(seq_entry);
     x_ExtendedCleanupExtra(seh);
+    if (m_CleanDigests) {
+        x_RememberCleanEntries(seq_entry, 'E');
+    }
     // TODO: implement more of ExtendedCleanup
 }
 
@@ -13365,7 +13817,7 @@ void CNewCleanup_imp::ExtendedCleanupSeqSubmit (
 )
 {
     // extended cleanup includes basic cleanup
-    BasicCleanupSeqSubmit( ss );
+    x_BasicCleanupSeqSubmit( ss, true );
 
     if( ! (m_Options & CCleanup::eClean_NoNcbiUserObjects) && ss.IsEntrys() ) {
         NON_CONST_ITERATE(CSeq_submit::TData::TEntrys, it, ss.SetData().SetEntrys()) {
@@ -13373,12 +13825,18 @@ void CNewCleanup_imp::ExtendedCleanupSeqSubmit (
         }
     }
 
-    CAutogeneratedExtendedCleanup auto_ext_cleanup( *m_Scope, *this );
-    auto_ext_cleanup.ExtendedCleanupSeqSubmit( ss );
+    {{
+        CSectionTimer timer(m_RuleTimes, "ExtendedCleanup: walker");
+        CAutogeneratedExtendedCleanup auto_ext_cleanup( *m_Scope, *this );
+        auto_ext_cleanup.ExtendedCleanupSeqSubmit( ss );
+    }}
     if (ss.IsSetData() && ss.GetData().IsEntrys()) {
         NON_CONST_ITERATE(CSeq_submit::TData::TEntrys, it, ss.SetData().SetEntrys()) {
             CSeq_entry_Handle seh = m_Scope->GetSeq_entryHandle(**it);
             x_ExtendedCleanupExtra(seh);
+            if (m_CleanDigests) {
+                x_RememberCleanEntries(**it, 'E');
+            }
         }
     }
 
@@ -13391,7 +13849,7 @@ void CNewCleanup_imp::ExtendedCleanupSeqAnnot (
 
 {
     // extended cleanup includes basic cleanup
-    BasicCleanupSeqAnnot( sa );
+    x_BasicCleanupSeqAnnot( sa, true );
 
     CAutogeneratedExtendedCleanup auto_ext_cleanup( *m_Scope, *this );
     auto_ext_cleanup.ExtendedCleanupSeqAnnot( sa );
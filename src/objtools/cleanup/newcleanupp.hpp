@@ -36,12 +36,14 @@
 
 #include <stack>
 
+#include <objects/seqfeat/BioSource.hpp>
 #include <objects/seqfeat/OrgMod.hpp>
 #include <objects/seqfeat/SeqFeatData.hpp>
 #include <objects/seqfeat/Seq_feat.hpp>
 #include <objects/seq/MolInfo.hpp>
 #include <objects/seqblock/GB_block.hpp>
 
+#include <objtools/cleanup/cleanup.hpp>
 #include <objtools/cleanup/cleanup_change.hpp>
 
 BEGIN_NCBI_SCOPE
@@ -141,6 +143,15 @@ public:
     
     void SetScope(CScope& scope) { m_Scope.Reset(&scope); }
 
+    // Per-rule-family timing, see CCleanup::EnableRuleTiming().
+    // The times are passed to CCleanup on destruction.
+    CLocalSectionTimes& GetRuleTimes(void) { return m_RuleTimes; }
+
+    // Digests of the entries already cleaned, see
+    // CCleanup::eClean_SkipUnchanged.  NULL to walk everything.
+    void SetCleanDigests(CCleanup::TCleanDigests* digests)
+        { m_CleanDigests = digests; }
+
     /// Basic Cleanup methods
 
     void BasicCleanupSeqEntry (
@@ -231,6 +242,25 @@ private:
     void EnteringEntry(CSeq_entry& se);
     void LeavingEntry (CSeq_entry& se);
 
+    // BasicCleanup, or with fused set the walk of ExtendedCleanup that
+    // also does BasicCleanup
+    void x_BasicCleanupSeqEntry(CSeq_entry& se, bool fused);
+    void x_BasicCleanupSeqSubmit(CSeq_submit& ss, bool fused);
+    void x_BasicCleanupSeqAnnot(CSeq_annot& sa, bool fused);
+
+    // skip an entry left unchanged since it was last cleaned
+    bool x_SkipUnchangedEntryBC(CSeq_entry& se);
+    bool x_SkipUnchangedEntryEC(CSeq_entry& se);
+    bool x_SkipUnchangedEntryFC(CSeq_entry& se);
+    char x_GetUnchangedKind(const CSeq_entry& se, const char* kinds);
+    void x_RememberCleanEntries(const CSeq_entry& se, char kind);
+    bool x_IsInSkipRegion(const CSeq_entry& se);
+    bool x_IsSkipUnit(const CSeq_entry& se);
+    string x_GetCleanDigestKey(const CSeq_entry& se, char kind);
+    string x_GetCleanDigest(const CSeq_entry& se);
+    string x_GetSetShellDigest(const CBioseq_set& bss);
+    string x_GetSkippedDigest(const CSeq_entry& se);
+
     void SetGeneticCode (CBioseq& bs);
 
     void SubmitblockBC (CSubmit_block& sb);
@@ -330,6 +360,9 @@ private:
     void MoveDbxrefs(CSeq_feat& sf);
     void MoveStandardName(CSeq_feat& sf);
     void CreatePubFromFeat(CSeq_feat& sf);
+    void x_SeqfeatEC(CSeq_feat& feat);
+    void x_SeqFeatDataEC(CSeqFeatData& data);
+    void x_GeneRefEC(CGene_ref& gene);
     void ResynchProteinPartials ( CSeq_feat& feat );
     void ResynchPeptidePartials( CBioseq& seq );
     void x_SetPartialsForProtein(CBioseq& prot, bool partial5, bool partial3, bool feat_partial);
@@ -651,8 +684,24 @@ protected:
 
     bool m_KeepTopNestedSet;
 
+    CLocalSectionTimes m_RuleTimes;
+
+    CCleanup::TCleanDigests* m_CleanDigests;
+    /// the entries cleanup was called for, when m_CleanDigests is set
+    set<const CSeq_entry*> m_CleanRoots;
+    /// the entries skipped, with their digest and the change count then
+    typedef map<const CSeq_entry*, pair<string, size_t> > TSkippedDigests;
+    TSkippedDigests m_SkippedDigests;
+    /// digests of the sets around the entries, with the change count then
+    typedef map<const CBioseq_set*, pair<string, size_t> > TShellDigests;
+    TShellDigests m_ShellDigests;
+    /// calls to ChangeMade so far
+    size_t m_ChangeCount;
+
     friend class CAutogeneratedCleanup;
     friend class CAutogeneratedExtendedCleanup;
+    friend class CAutogeneratedFusedCleanup;
+    friend class CAutogeneratedExtendedFeatCleanup;
 };
 
 
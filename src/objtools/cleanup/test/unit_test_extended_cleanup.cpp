@@ -55,6 +55,7 @@
 #include <corelib/test_boost.hpp>
 
 #include <objects/seqset/Seq_entry.hpp>
+#include <objects/seqset/Bioseq_set.hpp>
 #include <objmgr/object_manager.hpp>
 #include <objmgr/scope.hpp>
 #include <objmgr/bioseq_ci.hpp>
@@ -1187,4 +1188,94 @@ BOOST_AUTO_TEST_CASE(Test_MatPeptidePartial)
         }
         ++f;
     }
-}
\ No newline at end of file
+}
+
+// number of times a rule family ran, see CCleanup::EnableRuleTiming()
+static size_t s_GetRuleCalls(const string& family)
+{
+    CCleanup::TRuleTimes times;
+    CCleanup::GetRuleTimes(times);
+    CCleanup::TRuleTimes::const_iterator it = times.find(family);
+    return it == times.end() ? 0 : it->second.m_Calls;
+}
+
+
+// ExtendedCleanup may replace the feature objects, so look them up again
+static CSeq_feat& s_GetMemberFeat(CSeq_entry& entry, size_t n)
+{
+    CBioseq_set::TSeq_set::iterator member =
+        entry.SetSet().SetSeq_set().begin();
+    advance(member, n);
+    return *(*member)->SetSeq().SetAnnot().front()->SetData().SetFtable().front();
+}
+
+
+BOOST_AUTO_TEST_CASE(Test_SkipUnchanged)
+{
+    // a set of two independent records, each with a feature to clean
+    CRef<CSeq_entry> entry(new CSeq_entry);
+    entry->SetSet().SetClass(CBioseq_set::eClass_genbank);
+    for (int i = 0; i < 2; ++i) {
+        CRef<CSeq_entry> member = BuildGoodSeq();
+        ChangeId(member, "_" + NStr::IntToString(i));
+        AddMiscFeature(member)->SetComment("  spaces  ");
+        entry->SetSet().SetSeq_set().push_back(member);
+    }
+
+    CRef<CScope> scope(new CScope(*CObjectManager::GetInstance()));
+    CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry(*entry);
+
+    CCleanup cleanup(scope);
+    const Uint4 options = CCleanup::eClean_SkipUnchanged |
+                          CCleanup::eClean_NoNcbiUserObjects;
+    CCleanup::EnableRuleTiming();
+
+    cleanup.BasicCleanup(*entry, options);
+    BOOST_CHECK_EQUAL(s_GetMemberFeat(*entry, 0).GetComment(), "spaces");
+    BOOST_CHECK_EQUAL(s_GetMemberFeat(*entry, 1).GetComment(), "spaces");
+    size_t feat_calls = s_GetRuleCalls("BasicCleanup: Seq-feat");
+    BOOST_CHECK(feat_calls >= 2);
+
+    // the basic pass of ExtendedCleanup does not walk the record again
+    cleanup.ExtendedCleanup(*entry, options);
+    BOOST_CHECK_EQUAL(s_GetRuleCalls("BasicCleanup: Seq-feat"), feat_calls);
+    cleanup.ExtendedCleanup(*entry, options);
+
+    // nor does another cleanup of the unchanged record
+    CRef<CSeq_entry> copy(new CSeq_entry);
+    copy->Assign(*entry);
+    feat_calls = s_GetRuleCalls("BasicCleanup: Seq-feat");
+    cleanup.ExtendedCleanup(*entry, options);
+    BOOST_CHECK_EQUAL(s_GetRuleCalls("BasicCleanup: Seq-feat"), feat_calls);
+    BOOST_CHECK(copy->Equals(*entry));
+
+    // after an edit, only the member that was edited is walked
+    s_GetMemberFeat(*entry, 1).SetComment("  spaces  ");
+    cleanup.ExtendedCleanup(*entry, options);
+    BOOST_CHECK_EQUAL(s_GetMemberFeat(*entry, 1).GetComment(), "spaces");
+    BOOST_CHECK_EQUAL(s_GetRuleCalls("BasicCleanup: Seq-feat"), feat_calls + 1);
+    BOOST_CHECK(copy->Equals(*entry));
+
+    CCleanup::EnableRuleTiming(false);
+}
+
+
+BOOST_AUTO_TEST_CASE(Test_RuleTiming)
+{
+    CCleanup::EnableRuleTiming();
+
+    CRef<CSeq_entry> entry = BuildGoodNucProtSet();
+    CRef<CScope> scope(new CScope(*CObjectManager::GetInstance()));
+    CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry(*entry);
+
+    CCleanup cleanup(scope);
+    cleanup.ExtendedCleanup(*entry);
+    CCleanup::EnableRuleTiming(false);
+
+    CCleanup::TRuleTimes times;
+    CCleanup::GetRuleTimes(times);
+    BOOST_CHECK(times.find("ExtendedCleanup: fused walker") != times.end());
+    BOOST_CHECK(times.find("ExtendedCleanup: Seq-feat") != times.end());
+    BOOST_CHECK(times.find("ExtendedCleanup: walker") != times.end());
+    BOOST_CHECK(times.find("ExtendedCleanup: nuc-prot sets") != times.end());
+}
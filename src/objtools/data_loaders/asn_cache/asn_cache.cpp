@@ -41,15 +41,18 @@
 #include <util/compress/stream.hpp>
 
 #include <objects/seq/seq_id_handle.hpp>
+#include <objects/seqloc/Seq_id.hpp>
 #include <objects/seqloc/Seq_id_set.hpp>
 
 #include <objtools/data_loaders/asn_cache/Cache_blob.hpp>
 #include <objtools/data_loaders/asn_cache/chunk_file.hpp>
 #include <objtools/data_loaders/asn_cache/seq_id_chunk_file.hpp>
 #include <objtools/data_loaders/asn_cache/asn_index.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
 #include <objtools/data_loaders/asn_cache/asn_cache.hpp>
 #include <objtools/data_loaders/asn_cache/asn_cache_util.hpp>
 #include <objtools/data_loaders/asn_cache/file_names.hpp>
+#include <objtools/data_loaders/asn_cache/asn_cache_exception.hpp>
 
 BEGIN_NCBI_SCOPE
 USING_SCOPE(objects);
@@ -87,12 +90,114 @@ CAsnCache::CAsnCache(const string& db_path)
             m_SeqIdChunk.reset();
         }
     }
+
+    x_OpenFlatIndex();
 }
 
 CAsnCache::~CAsnCache()
 {
 }
 
+
+/// The flat index is used only if it was built from the BDB index as it
+/// is now: any update of the BDB index makes it out of date.
+static CAsnFlatIndex* s_OpenFlatIndex(const string& db_path,
+                                      CAsnIndex::E_index_type type)
+{
+    string flat_path = NASNCacheFileName::GetFlatIndex(db_path, type);
+    if ( !CFile(flat_path).Exists() ) {
+        return NULL;
+    }
+    AutoPtr<CAsnFlatIndex> index(new CAsnFlatIndex(flat_path));
+    if ( !index->IsCurrent(NASNCacheFileName::GetBDBIndex(db_path, type)) ) {
+        LOG_POST(Info << flat_path << " is out of date: not using it");
+        return NULL;
+    }
+    return index.release();
+}
+
+void CAsnCache::x_OpenFlatIndex()
+{
+    try {
+        m_FlatIndex.reset(s_OpenFlatIndex(m_DbPath, CAsnIndex::e_main));
+        if ( !m_FlatIndex.get() ) {
+            return;
+        }
+        ///
+        /// Either both indices are used as flat ones, or none: the BDB
+        /// indices cannot be shared between threads.
+        ///
+        if (m_SeqIdIndex.get()) {
+            m_FlatSeqIdIndex.reset(
+                s_OpenFlatIndex(m_DbPath, CAsnIndex::e_seq_id));
+            if ( !m_FlatSeqIdIndex.get() ) {
+                LOG_POST(Info << "no up-to-date flat seq-id index in "
+                         << m_DbPath << ": not using flat indices");
+                m_FlatIndex.reset();
+                return;
+            }
+        }
+        m_ChunkMaps.resize(m_FlatIndex->GetMaxChunkId() + 1);
+        for (CAsnIndex::TChunkId chunk = 1;  chunk < m_ChunkMaps.size();
+             ++chunk) {
+            CFile chunk_file(CChunkFile::s_MakeChunkFileName(m_DbPath, chunk));
+            if (chunk_file.Exists()  &&  chunk_file.GetLength() > 0) {
+                m_ChunkMaps[chunk].reset(new CMemoryFile(chunk_file.GetPath()));
+            }
+        }
+        if (m_SeqIdIndex.get()) {
+            CFile seq_id_chunk(NASNCacheFileName::GetSeqIdChunk(m_DbPath));
+            if (seq_id_chunk.GetLength() > 0) {
+                m_SeqIdChunkMap.reset(new CMemoryFile(seq_id_chunk.GetPath()));
+            }
+        }
+    }
+    catch (CException& e) {
+        ERR_POST(Error << "error opening flat cache index: disabling: " << e);
+        m_FlatIndex.reset();
+        m_FlatSeqIdIndex.reset();
+        m_ChunkMaps.clear();
+        m_SeqIdChunkMap.reset();
+    }
+}
+
+bool CAsnCache::IsFlatIndexCurrent() const
+{
+    if ( !m_FlatIndex.get() ) {
+        return false;
+    }
+    if ( !m_FlatIndex->IsCurrent(
+             NASNCacheFileName::GetBDBIndex(m_DbPath, CAsnIndex::e_main)) ) {
+        return false;
+    }
+    return !m_FlatSeqIdIndex.get()  ||
+        m_FlatSeqIdIndex->IsCurrent(
+            NASNCacheFileName::GetBDBIndex(m_DbPath, CAsnIndex::e_seq_id));
+}
+
+bool CAsnCache::s_AddIndexInfo(const CAsnIndex::SIndexInfo& current_info,
+                               Uint4                        version,
+                               vector<CAsnIndex::SIndexInfo>&  info,
+                               bool                         multiple)
+{
+    bool should_report = (!version || version == current_info.version) &&
+       (info.empty() || multiple ||
+       ( !version &&
+         /// versionless - choose best version and timestamp
+         (info[0].version < current_info.version ||
+          (info[0].version == current_info.version &&
+           info[0].timestamp < current_info.timestamp)) ||
+         /// version specified; choose best timestamp for this version
+         (version && info[0].timestamp < current_info.timestamp)));
+    if (should_report) {
+        if (!multiple) {
+            info.clear();
+        }
+        info.push_back(current_info);
+    }
+    return should_report;
+}
+
 bool CAsnCache::s_GetChunkAndOffset(const CSeq_id_Handle&   idh,
                                     CAsnIndex&              index,
                                     vector<CAsnIndex::SIndexInfo>&  info,
@@ -124,27 +229,66 @@ bool CAsnCache::s_GetChunkAndOffset(const CSeq_id_Handle&   idh,
             break;
         }
 
-        bool should_report = (!version || version == current_info.version) &&
-           (info.empty() || multiple ||
-           ( !version &&
-             /// versionless - choose best version and timestamp
-             (info[0].version < current_info.version ||
-              (info[0].version == current_info.version &&
-               info[0].timestamp < current_info.timestamp)) ||
-             /// version specified; choose best timestamp for this version
-             (version && info[0].timestamp < current_info.timestamp)));
-        if (should_report) {
+        if (s_AddIndexInfo(current_info, version, info, multiple)) {
             was_id_found = true;
-            if (!multiple) {
-                info.clear();
-            }
-            info.push_back(current_info);
         }
     }
 
     return  was_id_found;
 }
 
+bool CAsnCache::s_GetChunkAndOffset(const CSeq_id_Handle&   idh,
+                                    const CAsnFlatIndex&    index,
+                                    vector<CAsnIndex::SIndexInfo>&  info,
+                                    bool                    multiple)
+{
+    bool    was_id_found = false;
+
+    string seq_id;
+    Uint4 version;
+    GetNormalizedSeqId(idh, seq_id, version);
+
+    vector<CAsnIndex::SIndexInfo> entries;
+    index.Find(seq_id, version, entries);
+    ITERATE (vector<CAsnIndex::SIndexInfo>, it, entries) {
+        if (s_AddIndexInfo(*it, version, info, multiple)) {
+            was_id_found = true;
+        }
+    }
+
+    return  was_id_found;
+}
+
+bool CAsnCache::x_GetChunkAndOffset(const CSeq_id_Handle&   idh,
+                                    CAsnIndex::E_index_type type,
+                                    vector<CAsnIndex::SIndexInfo>&  info,
+                                    bool                    multiple)
+{
+    if (type == CAsnIndex::e_seq_id) {
+        if (m_FlatSeqIdIndex.get()) {
+            return s_GetChunkAndOffset(idh, *m_FlatSeqIdIndex, info, multiple);
+        }
+        return m_SeqIdIndex.get()  &&
+            s_GetChunkAndOffset(idh, *m_SeqIdIndex, info, multiple);
+    }
+    if (m_FlatIndex.get()) {
+        return s_GetChunkAndOffset(idh, *m_FlatIndex, info, multiple);
+    }
+    return s_GetChunkAndOffset(idh, *m_Index, info, multiple);
+}
+
+bool CAsnCache::x_GetChunkAndOffset(const CSeq_id_Handle&   idh,
+                                    CAsnIndex::E_index_type type,
+                                    CAsnIndex::SIndexInfo&  info)
+{
+    vector<CAsnIndex::SIndexInfo> info_vector;
+    if (!x_GetChunkAndOffset(idh, type, info_vector, false)) {
+        return false;
+    }
+    info = info_vector[0];
+    return true;
+}
+
 bool CAsnCache::s_GetChunkAndOffset(const CSeq_id_Handle&   idh,
                                     CAsnIndex&              index,
                                     CAsnIndex::SIndexInfo&  info)
@@ -169,7 +313,8 @@ bool CAsnCache::GetIdInfo(const CSeq_id_Handle& idh,
     /// However, we need to check whether the cache is old-style, without
     /// a SeqId index, and in that case get the info out of the main index
     ///
-    if ( s_GetChunkAndOffset(idh, m_SeqIdIndex.get() ? *m_SeqIdIndex : *m_Index,
+    if ( x_GetChunkAndOffset(idh, m_SeqIdIndex.get() ? CAsnIndex::e_seq_id
+                                                     : CAsnIndex::e_main,
                              info) )
     {
         this_gi = info.gi;
@@ -211,7 +356,7 @@ bool CAsnCache::GetSeqIds(const CSeq_id_Handle& id,
     CAsnIndex::SIndexInfo info;
 
     was_seqid_blob_found = m_SeqIdIndex.get() &&
-        s_GetChunkAndOffset(id, *m_SeqIdIndex, info);
+        x_GetChunkAndOffset(id, CAsnIndex::e_seq_id, info);
     _TRACE("GetSeqIds id=" << id.GetSeqId()->AsFastaString()
            << " gi=" << info.gi
            << " timestamp=" << info.timestamp
@@ -220,7 +365,22 @@ bool CAsnCache::GetSeqIds(const CSeq_id_Handle& id,
 
     if ( was_seqid_blob_found ){
         try {
-            m_SeqIdChunk->Read( all_ids, info.offs, info.size );
+            if ( m_SeqIdChunkMap.get() ) {
+                if ( info.offs + info.size > m_SeqIdChunkMap->GetSize() ) {
+                    NCBI_THROW( CASNCacheException, eCantFindChunkFile,
+                                "SeqIds chunk is beyond the end of the file" );
+                }
+                const char* data =
+                    static_cast<const char*>(m_SeqIdChunkMap->GetPtr()) + info.offs;
+                CObjectIStreamAsnBinary asn_stream( data, info.size );
+                CSeq_id seq_id;
+                while ( asn_stream.GetStreamPos() < info.size ) {
+                    asn_stream >> seq_id;
+                    all_ids.push_back( CSeq_id_Handle::GetHandle(seq_id) );
+                }
+            } else {
+                m_SeqIdChunk->Read( all_ids, info.offs, info.size );
+            }
         }
         catch ( CException & e ) {
             ERR_POST( "Unable to read or unpack a SeqIds chunk."
@@ -252,7 +412,7 @@ bool CAsnCache::GetBlob(const CSeq_id_Handle& idh,
 
     CAsnIndex::SIndexInfo info;
 
-    was_blob_found = s_GetChunkAndOffset(idh, *m_Index, info);
+    was_blob_found = x_GetChunkAndOffset(idh, CAsnIndex::e_main, info);
 
     if (! was_blob_found ) {
         return false;
@@ -270,6 +430,27 @@ bool CAsnCache::x_GetBlob(const CAsnIndex::SIndexInfo &info, CCache_blob& blob)
            << " offs=" << info.offs
            << " size=" << info.size);
     try {
+        if ( m_FlatIndex.get() ) {
+            ///
+            /// Read from the mapped chunk: no state is changed here, so that
+            /// several threads can do it at once
+            ///
+            if ( info.chunk >= m_ChunkMaps.size()  ||
+                 !m_ChunkMaps[info.chunk].get() ) {
+                NCBI_THROW( CASNCacheException, eCantFindChunkFile,
+                            "Chunk file is not available" );
+            }
+            const CMemoryFile& chunk = *m_ChunkMaps[info.chunk];
+            if ( info.offs + info.size > chunk.GetSize() ) {
+                NCBI_THROW( CASNCacheException, eCantFindChunkFile,
+                            "Blob is beyond the end of the chunk file" );
+            }
+            CObjectIStreamAsnBinary asn_stream(
+                static_cast<const char*>(chunk.GetPtr()) + info.offs,
+                info.size );
+            asn_stream >> blob;
+            return true;
+        }
         if ( !m_CurrChunk.get()  ||  info.chunk != m_CurrChunkId) {
             try {
                 m_CurrChunk.reset(new CChunkFile(m_DbPath, info.chunk));
@@ -300,7 +481,7 @@ bool CAsnCache::GetMultipleBlobs(const CSeq_id_Handle& id,
 {
     vector<CAsnIndex::SIndexInfo> info;
 
-    bool was_blob_found = s_GetChunkAndOffset(id, *m_Index, info, true);
+    bool was_blob_found = x_GetChunkAndOffset(id, CAsnIndex::e_main, info, true);
 
     if (! was_blob_found ) {
         return false;
@@ -372,13 +553,13 @@ GetMultipleEntries(const CSeq_id_Handle& id)
 bool CAsnCache::GetIndexEntry( const CSeq_id_Handle& id_handle,
                                CAsnIndex::SIndexInfo& info )
 {
-    return  s_GetChunkAndOffset(id_handle, *m_Index, info);
+    return  x_GetChunkAndOffset(id_handle, CAsnIndex::e_main, info);
 }
 
 bool CAsnCache::GetMultipleIndexEntries(const objects::CSeq_id_Handle & id,
                                         vector<CAsnIndex::SIndexInfo> &info)
 {
-    return s_GetChunkAndOffset(id, *m_Index, info, true);
+    return x_GetChunkAndOffset(id, CAsnIndex::e_main, info, true);
 }
 
 END_NCBI_SCOPE
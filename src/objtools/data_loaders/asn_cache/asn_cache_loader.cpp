@@ -45,6 +45,8 @@
 
 #include <objtools/data_loaders/asn_cache/asn_cache_loader.hpp>
 #include <objtools/data_loaders/asn_cache/asn_cache.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
+#include <objtools/data_loaders/asn_cache/file_names.hpp>
 
 
 #define NCBI_USE_ERRCODE_X   Objtools_AsnCache_Loader
@@ -54,8 +56,7 @@ BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(objects)
 
 CAsnCache_DataLoader::SCacheInfo::SCacheInfo()
-    : requests(0)
-    , found(0)
+    : shared(false)
 {
 }
 
@@ -90,14 +91,16 @@ string CAsnCache_DataLoader::GetLoaderNameFromArgs(const string& db_path)
 
 
 CAsnCache_DataLoader::CAsnCache_DataLoader(void)
-    : CDataLoader(GetLoaderNameFromArgs())
+    : CDataLoader(GetLoaderNameFromArgs()),
+      m_SharedIndex(NULL)
 {
     m_IndexMap.resize(15);
 }
 
 
 CAsnCache_DataLoader::CAsnCache_DataLoader(const string& dl_name)
-    : CDataLoader(dl_name)
+    : CDataLoader(dl_name),
+      m_SharedIndex(NULL)
 {
     m_IndexMap.resize(15);
 }
@@ -105,9 +108,70 @@ CAsnCache_DataLoader::CAsnCache_DataLoader(const string& dl_name)
 CAsnCache_DataLoader::CAsnCache_DataLoader(const string& dl_name,
                                            const string& db_path)
     : CDataLoader(dl_name),
+      m_SharedIndex(NULL),
       m_DbPath(db_path)
 {
     m_IndexMap.resize(15);
+    x_CheckIndices(time(0));
+}
+
+
+// How often the loader checks that the flat indices it uses are still
+// current, and looks for new ones, in seconds
+static const time_t kIndexCheckInterval = 10;
+
+void CAsnCache_DataLoader::x_CheckIndices(time_t now)
+{
+    CFastMutexGuard LOCK(m_Mutex);
+    if (time_t(m_NextIndexCheck.Get()) > now) {
+        // another thread has just checked
+        return;
+    }
+    m_NextIndexCheck.Set(now + kIndexCheckInterval);
+    if (m_DbPath.empty()) {
+        return;
+    }
+
+    // The per-thread caches may have opened the flat indices too
+    NON_CONST_ITERATE (TIndexMap, it, m_IndexMap) {
+        if (it->get()  &&  (*it)->cache->IsThreadSafe()  &&
+            !(*it)->cache->IsFlatIndexCurrent()) {
+            m_KeptIndices.push_back(AutoPtr<SCacheInfo>(it->release()));
+            it->reset();
+        }
+    }
+    if (m_SharedIndex) {
+        if (m_SharedIndex->cache->IsFlatIndexCurrent()) {
+            return;
+        }
+        LOG_POST(Info << "ASN cache " << m_DbPath
+                 << " was updated: reopening it");
+        m_SharedIndex = NULL;
+    }
+
+    // With the flat indices one cache serves all threads
+    string flat_path =
+        NASNCacheFileName::GetFlatIndex(m_DbPath, CAsnIndex::e_main);
+    if ( !CFile(flat_path).Exists() ) {
+        return;
+    }
+    try {
+        if ( !CAsnFlatIndex(flat_path).IsCurrent(
+                 NASNCacheFileName::GetBDBIndex(m_DbPath, CAsnIndex::e_main)) ) {
+            return;
+        }
+        AutoPtr<SCacheInfo> index(new SCacheInfo);
+        index->cache.Reset(new CAsnCache(m_DbPath));
+        if (index->cache->IsThreadSafe()) {
+            index->shared = true;
+            m_SharedIndex = index.get();
+            m_KeptIndices.push_back(AutoPtr<SCacheInfo>(index.release()));
+        }
+    }
+    catch (CException& e) {
+        ERR_POST(Warning << "failed to open shared ASN cache "
+                 << m_DbPath << ": " << e);
+    }
 }
 
 
@@ -133,7 +197,7 @@ CAsnCache_DataLoader::TBlobId
 CAsnCache_DataLoader::GetBlobId(const CSeq_id_Handle& idh)
 {
     SCacheInfo& index = x_GetIndex();
-    CFastMutexGuard LOCK(index.cache_mtx);
+    CCacheGuard LOCK(index);
 
     CAsnIndex::SIndexInfo info;
     TBlobId blob_id;
@@ -154,7 +218,7 @@ bool CAsnCache_DataLoader::CanGetBlobById() const
 TGi CAsnCache_DataLoader::GetGi(const CSeq_id_Handle& idh)
 {
     SCacheInfo& index = x_GetIndex();
-    CFastMutexGuard LOCK(index.cache_mtx);
+    CCacheGuard LOCK(index);
 
     CAsnIndex::TGi gi = 0;
     time_t timestamp = 0;
@@ -169,7 +233,7 @@ TGi CAsnCache_DataLoader::GetGi(const CSeq_id_Handle& idh)
 TSeqPos CAsnCache_DataLoader::GetSequenceLength(const CSeq_id_Handle& idh)
 {
     SCacheInfo& index = x_GetIndex();
-    CFastMutexGuard LOCK(index.cache_mtx);
+    CCacheGuard LOCK(index);
 
     CAsnIndex::TGi gi = 0;
     time_t timestamp = 0;
@@ -197,11 +261,11 @@ void CAsnCache_DataLoader::GetIds(const CSeq_id_Handle& idh,
     /// the entire sequence.
     ///
     SCacheInfo& index = x_GetIndex();
-    CFastMutexGuard LOCK(index.cache_mtx);
+    CCacheGuard LOCK(index);
 
     vector<CSeq_id_Handle> bioseq_ids;
     bool res = index.cache->GetSeqIds(idh, bioseq_ids, false);
-    ++index.requests;
+    index.requests.Add(1);
     if (res) {
         ids.swap(bioseq_ids);
     }
@@ -211,7 +275,7 @@ void CAsnCache_DataLoader::GetIds(const CSeq_id_Handle& idh,
 int CAsnCache_DataLoader::GetTaxId(const CSeq_id_Handle& idh)
 {
     SCacheInfo& index = x_GetIndex();
-    CFastMutexGuard LOCK(index.cache_mtx);
+    CCacheGuard LOCK(index);
 
     CAsnIndex::TGi gi = 0;
     time_t timestamp = 0;
@@ -231,7 +295,7 @@ int CAsnCache_DataLoader::GetTaxId(const CSeq_id_Handle& idh)
 void CAsnCache_DataLoader::GetGis(const TIds& ids, TLoaded& loaded, TIds& ret)
 {
     SCacheInfo& index = x_GetIndex();
-    CFastMutexGuard LOCK(index.cache_mtx);
+    CCacheGuard LOCK(index);
 
     ret.clear();
     ret.resize(ids.size());
@@ -258,13 +322,13 @@ CAsnCache_DataLoader::GetBlobById(const TBlobId& blob_id)
     CTSE_LoadLock lock = GetDataSource()->GetTSE_LoadLock(blob_id);
     if ( !lock.IsLoaded() ) {
         SCacheInfo& index = x_GetIndex();
-        CFastMutexGuard LOCK(index.cache_mtx);
+        CCacheGuard LOCK(index);
 
         CRef<CSeq_entry> entry = index.cache->GetEntry(idh);
-        ++index.requests;
+        index.requests.Add(1);
 
         if (entry) {
-            ++index.found;
+            index.found.Add(1);
             lock->SetSeq_entry(*entry);
             lock.SetLoaded();
 
@@ -320,6 +384,14 @@ CAsnCache_DataLoader::GetRecords(const CSeq_id_Handle& idh,
 
 CAsnCache_DataLoader::SCacheInfo& CAsnCache_DataLoader::x_GetIndex()
 {
+    time_t now = time(0);
+    if (time_t(m_NextIndexCheck.Get()) <= now) {
+        x_CheckIndices(now);
+    }
+    SCacheInfo* shared = m_SharedIndex;
+    if (shared) {
+        return *shared;
+    }
     if (m_IndexMap.empty()) {
         NCBI_THROW(CException, eUnknown,
                    "setup failure: no cache objects available");
@@ -0,0 +1,385 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:  See asn_flat_index.hpp
+ */
+
+#include <ncbi_pch.hpp>
+
+#include <algorithm>
+#include <string.h>
+
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbistre.hpp>
+#include <corelib/ncbitime.hpp>
+#include <db/bdb/bdb_cursor.hpp>
+
+#include <objtools/data_loaders/asn_cache/asn_cache_exception.hpp>
+#include <objtools/data_loaders/asn_cache/asn_flat_index.hpp>
+#include <objtools/data_loaders/asn_cache/file_names.hpp>
+
+BEGIN_NCBI_SCOPE
+
+static const char   kFlatIndexMagic[8] = { 'A', 'S', 'N', 'F', 'L', 'A', 'T', '2' };
+static const Uint4  kFlatIndexByteOrder = 0x01020304;
+
+struct CAsnFlatIndex::SHeader
+{
+    char    magic[8];
+    Uint4   byte_order;
+    Uint4   index_type;
+    Uint8   record_count;
+    Uint8   strings_size;
+    Uint4   max_chunk;
+    Uint4   reserved;
+    // The BDB index as it was when the flat index was built
+    Int8    source_mtime;   // in nanoseconds
+    Uint8   source_size;
+};
+
+struct CAsnFlatIndex::SRecord
+{
+    Uint8   seq_id_offs;    // in the seq-id string pool
+    Uint8   gi;
+    Uint8   offs;
+    Uint4   seq_id_size;
+    Uint4   version;
+    Uint4   timestamp;
+    Uint4   chunk;
+    Uint4   size;
+    Uint4   seq_length;
+    Uint4   taxid;
+    Uint4   reserved;
+};
+
+
+CAsnFlatIndex::CAsnFlatIndex( const string & file_name )
+    : m_Header( NULL )
+    , m_Records( NULL )
+    , m_Strings( NULL )
+{
+    m_File.reset( new CMemoryFile( file_name ) );
+    size_t  file_size = m_File->GetSize();
+    const char * data = static_cast<const char *>( m_File->GetPtr() );
+    if ( ! data  ||  file_size < sizeof( SHeader ) ) {
+        NCBI_THROW( CASNCacheException, eBadIndexFile,
+                    "Truncated ASN cache index " + file_name );
+    }
+
+    m_Header = reinterpret_cast<const SHeader *>( data );
+    if ( memcmp( m_Header->magic, kFlatIndexMagic, sizeof( kFlatIndexMagic ) ) != 0
+         ||  m_Header->byte_order != kFlatIndexByteOrder ) {
+        NCBI_THROW( CASNCacheException, eBadIndexFile,
+                    "Not an ASN cache index or wrong byte order: " + file_name );
+    }
+    Uint8   max_records = ( file_size - sizeof( SHeader ) ) / sizeof( SRecord );
+    if ( m_Header->record_count > max_records
+         ||  m_Header->strings_size != file_size - sizeof( SHeader )
+                 - m_Header->record_count * sizeof( SRecord ) ) {
+        NCBI_THROW( CASNCacheException, eBadIndexFile,
+                    "Inconsistent size of ASN cache index " + file_name );
+    }
+    m_Records = reinterpret_cast<const SRecord *>( data + sizeof( SHeader ) );
+    m_Strings = data + sizeof( SHeader )
+        + m_Header->record_count * sizeof( SRecord );
+    // Lookups jump all over the file
+    m_File->MemMapAdvise( CMemoryFile::eMMA_Random );
+}
+
+
+CAsnFlatIndex::~CAsnFlatIndex()
+{
+}
+
+
+// Modification time, to the nanosecond, and size of a file
+static bool s_GetFileStamp( const string & file_name, Int8 & mtime, Uint8 & size )
+{
+    CDirEntry::SStat    stat;
+    if ( ! CDirEntry( file_name ).Stat( &stat ) ) {
+        return  false;
+    }
+    mtime = Int8( stat.orig.st_mtime ) * kNanoSecondsPerSecond + stat.mtime_nsec;
+    size = stat.orig.st_size;
+    return  true;
+}
+
+
+bool    CAsnFlatIndex::IsCurrent( const string & bdb_file_name ) const
+{
+    Int8    mtime;
+    Uint8   size;
+    return  s_GetFileStamp( bdb_file_name, mtime, size )
+        &&  mtime == m_Header->source_mtime
+        &&  size == m_Header->source_size;
+}
+
+
+CAsnIndex::E_index_type CAsnFlatIndex::GetIndexType() const
+{
+    return CAsnIndex::E_index_type( m_Header->index_type );
+}
+
+
+CAsnIndex::TChunkId CAsnFlatIndex::GetMaxChunkId() const
+{
+    return m_Header->max_chunk;
+}
+
+
+Uint8   CAsnFlatIndex::GetRecordCount() const
+{
+    return m_Header->record_count;
+}
+
+
+const char * CAsnFlatIndex::x_GetSeqIdPtr( const SRecord & record ) const
+{
+    if ( record.seq_id_offs > m_Header->strings_size
+         ||  record.seq_id_size > m_Header->strings_size - record.seq_id_offs ) {
+        NCBI_THROW( CASNCacheException, eBadIndexFile,
+                    "Seq-id out of the string pool of a flat ASN cache index" );
+    }
+    return  m_Strings + record.seq_id_offs;
+}
+
+
+string  CAsnFlatIndex::x_GetSeqId( const SRecord & record ) const
+{
+    return string( x_GetSeqIdPtr( record ), record.seq_id_size );
+}
+
+
+// Compare the seq-id of the record with the key, like string::compare
+static int  s_CompareSeqId( const char * record_seq_id, size_t record_size,
+                            const string & seq_id )
+{
+    size_t  common_size = min( record_size, seq_id.size() );
+    int     result = memcmp( record_seq_id, seq_id.data(), common_size );
+    if ( result != 0 ) {
+        return result;
+    }
+    return record_size < seq_id.size() ? -1 :
+        ( record_size > seq_id.size() ? 1 : 0 );
+}
+
+
+Uint8   CAsnFlatIndex::x_LowerBound( const string & seq_id,
+                                     CAsnIndex::TVersion version ) const
+{
+    Uint8   first = 0;
+    Uint8   count = m_Header->record_count;
+    while ( count > 0 ) {
+        Uint8   step = count / 2;
+        const SRecord & record = m_Records[first + step];
+        int     cmp = s_CompareSeqId( x_GetSeqIdPtr( record ),
+                                      record.seq_id_size, seq_id );
+        if ( cmp < 0  ||  ( cmp == 0  &&  record.version < version ) ) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return  first;
+}
+
+
+bool    CAsnFlatIndex::x_IsSeqId( Uint8 pos, const string & seq_id ) const
+{
+    if ( pos >= m_Header->record_count ) {
+        return  false;
+    }
+    const SRecord & record = m_Records[pos];
+    return  s_CompareSeqId( x_GetSeqIdPtr( record ),
+                            record.seq_id_size, seq_id ) == 0;
+}
+
+
+void    CAsnFlatIndex::Find( const string & seq_id,
+                             CAsnIndex::TVersion version,
+                             vector<CAsnIndex::SIndexInfo> & info ) const
+{
+    for ( Uint8 pos = x_LowerBound( seq_id, version );
+          x_IsSeqId( pos, seq_id );  ++pos ) {
+        const SRecord & record = m_Records[pos];
+        CAsnIndex::SIndexInfo   current_info;
+        current_info.seq_id = x_GetSeqId( record );
+        current_info.version = record.version;
+        current_info.gi = record.gi;
+        current_info.timestamp = record.timestamp;
+        current_info.chunk = record.chunk;
+        current_info.offs = record.offs;
+        current_info.size = record.size;
+        current_info.sequence_length = record.seq_length;
+        current_info.taxonomy_id = record.taxid;
+        info.push_back( current_info );
+    }
+}
+
+
+size_t  CAsnFlatIndex::Count( const string & seq_id,
+                              CAsnIndex::TVersion version ) const
+{
+    size_t  count = 0;
+    for ( Uint8 pos = x_LowerBound( seq_id, version );
+          x_IsSeqId( pos, seq_id );  ++pos ) {
+        ++count;
+    }
+    return  count;
+}
+
+
+// Index entry collected by Build()
+struct SFlatIndexEntry
+{
+    string              seq_id;
+    CAsnIndex::TVersion version;
+    CAsnIndex::TGi      gi;
+    CAsnIndex::TTimestamp timestamp;
+    CAsnIndex::TChunkId chunk;
+    CAsnIndex::TOffset  offs;
+    CAsnIndex::TSize    size;
+    CAsnIndex::TSeqLength seq_length;
+    CAsnIndex::TTaxId   taxid;
+
+    bool operator<( const SFlatIndexEntry & other ) const
+    {
+        int cmp = seq_id.compare( other.seq_id );
+        if ( cmp != 0 ) return cmp < 0;
+        if ( version != other.version ) return version < other.version;
+        if ( gi != other.gi ) return gi < other.gi;
+        return timestamp < other.timestamp;
+    }
+};
+
+
+Uint8   CAsnFlatIndex::Build( CAsnIndex & index, const string & file_name )
+{
+    CStopWatch  sw( CStopWatch::eStart );
+
+    // Taken before reading, so that any change made meanwhile makes the
+    // flat index out of date
+    Int8    source_mtime;
+    Uint8   source_size;
+    if ( ! s_GetFileStamp( index.FileName(), source_mtime, source_size ) ) {
+        NCBI_THROW( CASNCacheException, eBadIndexFile,
+                    "Unable to get the modification time of " + index.FileName() );
+    }
+
+    vector<SFlatIndexEntry> entries;
+    Uint8   strings_size = 0;
+    CAsnIndex::TChunkId max_chunk = 0;
+    {{
+        CBDB_FileCursor cursor( index );
+        cursor.InitMultiFetch( 1 * 1024 * 1024 );
+        cursor.SetCondition( CBDB_FileCursor::eFirst, CBDB_FileCursor::eLast );
+        while ( cursor.Fetch() == eBDB_Ok ) {
+            SFlatIndexEntry entry;
+            entry.seq_id = index.GetSeqId();
+            entry.version = index.GetVersion();
+            entry.gi = index.GetGi();
+            entry.timestamp = index.GetTimestamp();
+            entry.chunk = index.GetChunkId();
+            entry.offs = index.GetOffset();
+            entry.size = index.GetSize();
+            entry.seq_length = index.GetSeqLength();
+            entry.taxid = index.GetTaxId();
+            strings_size += entry.seq_id.size();
+            max_chunk = max( max_chunk, entry.chunk );
+            entries.push_back( entry );
+        }
+    }}
+    // The BDB key order is not necessarily the byte order of the seq-ids
+    sort( entries.begin(), entries.end() );
+
+    string  temp_name = file_name + ".tmp";
+    {{
+        CNcbiOfstream   ostr( temp_name.c_str(), ios::out | ios::binary | ios::trunc );
+        if ( ! ostr ) {
+            NCBI_THROW( CASNCacheException, eBadIndexFile,
+                        "Unable to create ASN cache index " + temp_name );
+        }
+
+        SHeader header;
+        memset( &header, 0, sizeof( header ) );
+        memcpy( header.magic, kFlatIndexMagic, sizeof( kFlatIndexMagic ) );
+        header.byte_order = kFlatIndexByteOrder;
+        header.index_type = index.GetIndexType();
+        header.record_count = entries.size();
+        header.strings_size = strings_size;
+        header.max_chunk = max_chunk;
+        header.source_mtime = source_mtime;
+        header.source_size = source_size;
+        ostr.write( reinterpret_cast<const char *>( &header ), sizeof( header ) );
+
+        Uint8   seq_id_offs = 0;
+        ITERATE ( vector<SFlatIndexEntry>, it, entries ) {
+            SRecord record;
+            memset( &record, 0, sizeof( record ) );
+            record.seq_id_offs = seq_id_offs;
+            record.seq_id_size = Uint4( it->seq_id.size() );
+            record.version = it->version;
+            record.gi = it->gi;
+            record.timestamp = it->timestamp;
+            record.chunk = it->chunk;
+            record.offs = it->offs;
+            record.size = it->size;
+            record.seq_length = it->seq_length;
+            record.taxid = it->taxid;
+            ostr.write( reinterpret_cast<const char *>( &record ), sizeof( record ) );
+            seq_id_offs += it->seq_id.size();
+        }
+        ITERATE ( vector<SFlatIndexEntry>, it, entries ) {
+            ostr.write( it->seq_id.data(), it->seq_id.size() );
+        }
+
+        ostr.flush();
+        if ( ! ostr ) {
+            NCBI_THROW( CASNCacheException, eBadIndexFile,
+                        "Unable to write ASN cache index " + temp_name );
+        }
+    }}
+
+    if ( ! CFile( temp_name ).Rename( file_name, CDirEntry::fRF_Overwrite ) ) {
+        NCBI_THROW( CASNCacheException, eBadIndexFile,
+                    "Unable to rename " + temp_name + " to " + file_name );
+    }
+
+    LOG_POST( Info << "Wrote " << entries.size() << " index entries to "
+              << file_name << " in " << sw.Elapsed() << " seconds" );
+    return  entries.size();
+}
+
+
+Uint8   CAsnFlatIndex::Build( const string & cache_dir, CAsnIndex::E_index_type type )
+{
+    CAsnIndex   index( type );
+    index.Open( NASNCacheFileName::GetBDBIndex( cache_dir, type ),
+                CBDB_RawFile::eReadOnly );
+    return  Build( index, NASNCacheFileName::GetFlatIndex( cache_dir, type ) );
+}
+
+END_NCBI_SCOPE
@@ -54,6 +54,7 @@
 
 #include <objtools/lds2/lds2_db.hpp>
 #include <objtools/lds2/lds2.hpp>
+#include <objtools/lds2/lds2_handlers.hpp>
 #include <objtools/data_loaders/lds2/lds2_dataloader.hpp>
 
 #include <common/test_assert.h>  /* This header must go last */
@@ -72,6 +73,7 @@ private:
     void x_ConvertFile(const string& rel_name);
 
     void x_TestDatabase(const string& id);
+    bool x_TestIndexThreads(int threads);
     void x_InitStressTest(void);
     void x_RunStressTest(void);
 
@@ -122,6 +124,12 @@ void CLDS2TestApplication::Init(void)
 
     arg_desc->AddFlag("readonly", "Test an existing database in read-only mode.");
 
+    arg_desc->AddOptionalKey("threads", "count",
+        "Compare the database built by the given number of indexing " \
+        "threads with the one built by the serial indexer.",
+        CArgDescriptions::eInteger);
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(2, 64));
+
     SetupArgDescriptions(arg_desc.release());
 }
 
@@ -279,6 +287,216 @@ void CLDS2TestApplication::x_TestDatabase(const string& id)
 }
 
 
+// All the tables with the rows sorted: the rows are the same, but the
+// order of the ids of an object depends on the order the seq-id handles
+// were created in by the indexing threads.
+static string s_DumpDatabase(CLDS2_Manager& mgr)
+{
+    CLDS2_Database& db = *mgr.GetDatabase();
+    vector<string> tables;
+    {{
+        CNcbiOstrstream out;
+        db.Dump(kEmptyStr, out);
+        string names = CNcbiOstrstreamToString(out);
+        NStr::Split(names, "\n", tables, NStr::fSplit_Tokenize);
+        // skip the title
+        tables.erase(tables.begin());
+    }}
+    string dump;
+    ITERATE(vector<string>, it, tables) {
+        CNcbiOstrstream out;
+        db.Dump(*it, out);
+        string table = CNcbiOstrstreamToString(out);
+        vector<string> rows;
+        NStr::Split(table, "\n", rows, NStr::fSplit_Tokenize);
+        sort(rows.begin() + 1, rows.end());
+        dump += *it + "\n" + NStr::Join(rows, "\n") + "\n";
+    }
+    return dump;
+}
+
+
+static bool s_CompareDatabases(CLDS2_Manager& serial, CLDS2_Manager& mt,
+                               const string& step)
+{
+    if (s_DumpDatabase(serial) != s_DumpDatabase(mt)) {
+        ERR_POST(Error << step << ": the databases are different");
+        return false;
+    }
+    cout << step << ": the databases are the same" << endl;
+    return true;
+}
+
+
+// File handler counting the files it has to read completely.
+class CCountingFileHandler : public CLDS2_UrlHandler_File
+{
+public:
+    CCountingFileHandler(void) { m_Filled.Set(0); }
+
+    virtual void FillInfo(SLDS2_File& info)
+    {
+        m_Filled.Add(1);
+        CLDS2_UrlHandler_File::FillInfo(info);
+    }
+
+    CAtomicCounter m_Filled;
+};
+
+
+static bool s_IsWALDatabase(const string& db_file)
+{
+    // Write and read format versions in the database header,
+    // 2 for the write-ahead log mode.
+    char header[20];
+    CNcbiIfstream in(db_file.c_str(), ios::binary | ios::in);
+    return in.read(header, sizeof(header))  &&
+        (header[18] == 2  ||  header[19] == 2);
+}
+
+
+// Index the same data with the serial indexer and with 'threads'
+// threads, compare all tables, then change the data and update both
+// databases again.
+bool CLDS2TestApplication::x_TestIndexThreads(int threads)
+{
+    cout << "Comparing serial and " << threads <<
+        " thread(s) indexing..." << endl;
+    string work_dir = CDirEntry::ConcatPath(
+        CDirEntry(m_DbFile).GetDir(), "lds2_threads");
+    CDir(work_dir).Remove();
+    string data_dir = CDirEntry::ConcatPath(work_dir, "data");
+    CDir(m_DataDir).Copy(data_dir,
+        CDirEntry::fCF_Recursive | CDirEntry::fCF_PreserveTime);
+
+    string serial_db = CDirEntry::ConcatPath(work_dir, "serial.db");
+    string mt_db = CDirEntry::ConcatPath(work_dir, "mt.db");
+    CLDS2_Manager serial(serial_db);
+    CLDS2_Manager mt(mt_db);
+    CRef<CCountingFileHandler> serial_handler(new CCountingFileHandler);
+    CRef<CCountingFileHandler> mt_handler(new CCountingFileHandler);
+    serial.RegisterUrlHandler(serial_handler);
+    mt.RegisterUrlHandler(mt_handler);
+    mt.SetIndexThreads(threads);
+    mt.SetWALUpdate(true);
+    serial.SetGBReleaseMode(CLDS2_Manager::eGB_Guess);
+    mt.SetGBReleaseMode(CLDS2_Manager::eGB_Guess);
+    serial.AddDataDir(data_dir);
+    mt.AddDataDir(data_dir);
+
+    serial.UpdateData();
+    mt.UpdateData();
+    bool ok = s_CompareDatabases(serial, mt, "New database");
+
+    // The WAL journal mode is only used during the update.
+    if ( s_IsWALDatabase(mt_db) ) {
+        ERR_POST(Error << mt_db << " is left in WAL journal mode");
+        return false;
+    }
+
+    // Change a file keeping its size and time: the CRC must be reused
+    // from the database rather than the file read again. Touch another
+    // file: it must be read, but nothing else changes.
+    vector<string> files;
+    CDir::TEntries entries =
+        CDir(data_dir).GetEntries("*", CDir::fIgnoreRecursive);
+    ITERATE(CDir::TEntries, it, entries) {
+        if ( (*it)->IsFile() ) {
+            files.push_back((*it)->GetPath());
+        }
+    }
+    sort(files.begin(), files.end());
+    _ASSERT(files.size() >= 3);
+    const string& changed = files[0];
+    const string& touched = files[1];
+    const string& removed = files[2];
+    Uint4 changed_crc = serial.GetDatabase()->GetFileInfo(changed).crc;
+    Uint4 touched_crc = serial.GetDatabase()->GetFileInfo(touched).crc;
+    {{
+        CTime changed_time;
+        CFile(changed).GetTime(&changed_time);
+        string data;
+        {{
+            CNcbiIfstream in(changed.c_str(), ios::binary | ios::in);
+            NcbiStreamToString(&data, in);
+        }}
+        // Same size, different content, which is not read again if
+        // the CRC is reused.
+        _ASSERT( !data.empty() );
+        data[data.size() - 1] ^= 1;
+        {{
+            CNcbiOfstream out(changed.c_str(), ios::binary | ios::out);
+            out << data;
+        }}
+        CFile(changed).SetTime(&changed_time);
+    }}
+    CTime touched_time(CTime::eCurrent);
+    touched_time.AddSecond(10);
+    CFile(touched).SetTime(&touched_time);
+    CFile(removed).Remove();
+
+    serial_handler->m_Filled.Set(0);
+    mt_handler->m_Filled.Set(0);
+    serial.UpdateData();
+    mt.UpdateData();
+    ok = s_CompareDatabases(serial, mt, "Updated database")  &&  ok;
+
+    // Only the touched file is read again, through the handler's own
+    // FillInfo().
+    CCountingFileHandler* handlers[] = { serial_handler, mt_handler };
+    for (size_t i = 0; i < sizeof(handlers)/sizeof(handlers[0]); i++) {
+        if (handlers[i]->m_Filled.Get() != 1) {
+            ERR_POST(Error << "FillInfo() of the handler was called " <<
+                handlers[i]->m_Filled.Get() << " times instead of once");
+            ok = false;
+        }
+    }
+
+    CLDS2_Manager* managers[] = { &serial, &mt };
+    for (size_t i = 0; i < sizeof(managers)/sizeof(managers[0]); i++) {
+        CLDS2_Database& db = *managers[i]->GetDatabase();
+        if (db.GetFileInfo(changed).crc != changed_crc) {
+            ERR_POST(Error << db.GetDbFile() <<
+                ": CRC of the file with unchanged size and time was not reused");
+            ok = false;
+        }
+        if (db.GetFileInfo(touched).crc != touched_crc) {
+            ERR_POST(Error << db.GetDbFile() <<
+                ": CRC of the touched file changed");
+            ok = false;
+        }
+        if ( db.GetFileInfo(removed).exists() ) {
+            ERR_POST(Error << db.GetDbFile() <<
+                ": removed file is still indexed");
+            ok = false;
+        }
+    }
+
+    // The database written by the threads is opened read-only the same
+    // way as the serial one, without the write-ahead log files.
+    {{
+        CLDS2_Database::TStringSet serial_names;
+        serial.GetDatabase()->GetFileNames(serial_names);
+        CRef<CLDS2_Database> ro_db(
+            new CLDS2_Database(mt_db, CLDS2_Database::eRead));
+        CLDS2_Database::TStringSet names;
+        ro_db->GetFileNames(names);
+        if (names != serial_names) {
+            ERR_POST(Error << mt_db << ": read-only database has " <<
+                names.size() << " files instead of " << serial_names.size());
+            ok = false;
+        }
+    }}
+    if ( CFile(mt_db + "-shm").Exists()  ||  CFile(mt_db + "-wal").Exists() ) {
+        ERR_POST(Error << mt_db << ": write-ahead log files are left");
+        ok = false;
+    }
+
+    CDir(work_dir).Remove();
+    return ok;
+}
+
+
 const TIntId kStressTestFiles = 50;
 const TIntId kStressTestEntriesPerFile = 20;
 const TIntId kStressTestEntries = kStressTestFiles*kStressTestEntriesPerFile;
@@ -472,6 +690,14 @@ int CLDS2TestApplication::Run(void)
         }
     }
 
+    if ( args["threads"] ) {
+        bool ok = x_TestIndexThreads(args["threads"].AsInteger());
+        if (m_GZip  ||  args["format"]) {
+            CDir(m_DataDir).Remove();
+        }
+        return ok ? 0 : 1;
+    }
+
     bool readonly = args["readonly"];
     if ( m_RunStress ) {
         // Even in readonly mode create ASN.1 files for stress test.
@@ -32,6 +32,8 @@
 #include <ncbi_pch.hpp>
 #include <corelib/ncbistd.hpp>
 #include <corelib/ncbiobj.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbimtx.hpp>
 #include <connect/ncbi_conn_stream.hpp>
 
 #include <objects/seqset/Seq_entry.hpp>
@@ -57,6 +59,8 @@
 #include <objtools/format/flat_expt.hpp>
 
 #include <objects/misc/sequence_macros.hpp>
+#include <exception>
+#include <set>
 
 BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(objects)
@@ -178,6 +182,39 @@ void CFlatFileGenerator::SetFeatTree(feature::CFeatTree* tree)
 
 
 
+static void s_BasicCleanup(const CSeq_entry_Handle& entry)
+{
+    entry.GetTopLevelEntry().GetCompleteObject();
+    CSeq_entry_EditHandle tseh = entry.GetTopLevelEntry().GetEditHandle();
+    CBioseq_set_EditHandle bseth;
+    CBioseq_EditHandle bseqh;
+    CRef<CSeq_entry> tmp_se(new CSeq_entry);
+
+    if ( tseh.IsSet() ) {
+        bseth = tseh.SetSet();
+        CConstRef<CBioseq_set> bset = bseth.GetCompleteObject();
+        bseth.Remove(bseth.eKeepSeq_entry);
+        tmp_se->SetSet(const_cast<CBioseq_set&>(*bset));
+    }
+    else {
+        bseqh = tseh.SetSeq();
+        CConstRef<CBioseq> bseq = bseqh.GetCompleteObject();
+        bseqh.Remove(bseqh.eKeepSeq_entry);
+        tmp_se->SetSeq(const_cast<CBioseq&>(*bseq));
+    }
+
+    CCleanup cleanup;
+    cleanup.BasicCleanup( *tmp_se );
+
+    if ( tmp_se->IsSet() ) {
+        tseh.SelectSet(bseth);
+    }
+    else {
+        tseh.SelectSeq(bseqh);
+    }
+}
+
+
 // Generate a flat-file report for a Seq-entry
 // (the other CFlatFileGenerator::Generate functions ultimately
 // call this)
@@ -189,35 +226,7 @@ void CFlatFileGenerator::Generate
 
     if ( m_Ctx->GetConfig().BasicCleanup() )
     {
-
-        entry.GetTopLevelEntry().GetCompleteObject();
-        CSeq_entry_EditHandle tseh = entry.GetTopLevelEntry().GetEditHandle();
-        CBioseq_set_EditHandle bseth;
-        CBioseq_EditHandle bseqh;
-        CRef<CSeq_entry> tmp_se(new CSeq_entry);
-
-        if ( tseh.IsSet() ) {
-            bseth = tseh.SetSet();
-            CConstRef<CBioseq_set> bset = bseth.GetCompleteObject();
-            bseth.Remove(bseth.eKeepSeq_entry);
-            tmp_se->SetSet(const_cast<CBioseq_set&>(*bset));
-        }
-        else {
-            bseqh = tseh.SetSeq();
-            CConstRef<CBioseq> bseq = bseqh.GetCompleteObject();
-            bseqh.Remove(bseqh.eKeepSeq_entry);
-            tmp_se->SetSeq(const_cast<CBioseq&>(*bseq));
-        }
-
-        CCleanup cleanup;
-        cleanup.BasicCleanup( *tmp_se );
-
-        if ( tmp_se->IsSet() ) {
-            tseh.SelectSet(bseth);
-        }
-        else {
-            tseh.SelectSeq(bseqh);
-        }
+        s_BasicCleanup(entry);
     }
 
     m_Ctx->SetSGS(false);
@@ -583,6 +592,224 @@ void CFlatFileGenerator::Generate
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Multi-threaded generation
+
+// Text of one report, kept till the preceding reports are written out
+class CFlatTextBuffer : public IFlatTextOStream
+{
+public:
+    virtual void AddParagraph(const list<string>&  text,
+                              const CSerialObject* obj = 0)
+    {
+        ITERATE(list<string>, line, text) {
+            m_Text += *line;
+            m_Text += '\n';
+        }
+    }
+
+    virtual void AddLine(const CTempString& line,
+                         const CSerialObject* obj = 0,
+                         EAddNewline add_newline = eAddNewline_Yes)
+    {
+        m_Text.append(line.data(), line.size());
+        if ( add_newline == eAddNewline_Yes ) {
+            m_Text += '\n';
+        }
+    }
+
+    string& SetText(void) { return m_Text; }
+
+private:
+    string m_Text;
+};
+
+
+// Reports being generated by CFlatFileGeneratorThread's
+struct SFlatFileJobQueue
+{
+    struct SResult
+    {
+        SResult(void) : done(false) {}
+
+        bool                  done;
+        CRef<CFlatTextBuffer> text;
+        exception_ptr         error;
+    };
+
+    SFlatFileJobQueue(const CFlatFileGenerator::TBioseqJobs& j,
+                      size_t max_ahead)
+        : jobs(j), results(j.size()), next(0), written(0),
+          max_ahead(max_ahead), stop(false)
+    {}
+
+    const CFlatFileGenerator::TBioseqJobs& jobs;
+    vector<SResult>     results;
+    CFastMutex          lock;
+    CConditionVariable  job_done;
+    CConditionVariable  job_written;
+    size_t              next;       // Next job to take
+    size_t              written;    // Jobs written out
+    // Limits the number of buffered reports
+    size_t              max_ahead;
+    bool                stop;
+};
+
+
+class CFlatFileGeneratorThread : public CThread
+{
+public:
+    CFlatFileGeneratorThread(SFlatFileJobQueue&      queue,
+                             const CFlatFileContext& ctx)
+        : m_Queue(queue)
+    {
+        // Cleanup edits the entries, it is done before the threads start.
+        CFlatFileConfig cfg(ctx.GetConfig());
+        cfg.BasicCleanup(false);
+        m_Generator.Reset(new CFlatFileGenerator(cfg));
+        if ( ctx.GetAnnotSelector() ) {
+            m_Generator->SetAnnotSelector() = *ctx.GetAnnotSelector();
+        }
+        if ( ctx.GetSubmitBlock() ) {
+            m_Generator->SetSubmit(*ctx.GetSubmitBlock());
+        }
+    }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    SFlatFileJobQueue&       m_Queue;
+    CRef<CFlatFileGenerator> m_Generator;
+    // Entry the feature tree of the generator is built for
+    CSeq_entry_Handle        m_FeatTreeEntry;
+};
+
+
+void* CFlatFileGeneratorThread::Main(void)
+{
+    for (;;) {
+        size_t job;
+        {{
+            CFastMutexGuard guard(m_Queue.lock);
+            while ( !m_Queue.stop  &&  m_Queue.next < m_Queue.jobs.size()  &&
+                    m_Queue.next >= m_Queue.written + m_Queue.max_ahead ) {
+                m_Queue.job_written.WaitForSignal(m_Queue.lock);
+            }
+            if ( m_Queue.stop  ||  m_Queue.next >= m_Queue.jobs.size() ) {
+                break;
+            }
+            job = m_Queue.next++;
+        }}
+
+        CRef<CFlatTextBuffer> text(new CFlatTextBuffer);
+        exception_ptr error;
+        try {
+            const CBioseq_Handle& bsh = m_Queue.jobs[job].bsh;
+            CSeq_entry_Handle top = bsh.GetTopLevelEntry();
+            if ( top != m_FeatTreeEntry ) {
+                m_Generator->SetFeatTree(new feature::CFeatTree(top));
+                m_FeatTreeEntry = top;
+            }
+            CRef<CFlatItemOStream>
+                item_os(new CFormatItemOStream(text.GetPointer()));
+            m_Generator->Generate(bsh, *item_os);
+        }
+        catch (...) {
+            error = current_exception();
+        }
+
+        CFastMutexGuard guard(m_Queue.lock);
+        SFlatFileJobQueue::SResult& result = m_Queue.results[job];
+        result.done = true;
+        result.text = text;
+        result.error = error;
+        m_Queue.job_done.SignalAll();
+    }
+    return 0;
+}
+
+
+void CFlatFileGenerator::Generate(const TBioseqJobs& jobs,
+                                  unsigned int       nthreads)
+{
+    if ( nthreads > jobs.size() ) {
+        nthreads = static_cast<unsigned int>(jobs.size());
+    }
+    if ( nthreads <= 1 ) {
+        CSeq_entry_Handle feat_tree_entry;
+        ITERATE(TBioseqJobs, job, jobs) {
+            CSeq_entry_Handle top = job->bsh.GetTopLevelEntry();
+            if ( top != feat_tree_entry ) {
+                SetFeatTree(new feature::CFeatTree(top));
+                feat_tree_entry = top;
+            }
+            Generate(job->bsh, *job->os);
+        }
+        return;
+    }
+
+    if ( m_Ctx->GetConfig().BasicCleanup() ) {
+        set<CSeq_entry_Handle> cleaned;
+        ITERATE(TBioseqJobs, job, jobs) {
+            CSeq_entry_Handle top = job->bsh.GetTopLevelEntry();
+            if ( cleaned.insert(top).second ) {
+                s_BasicCleanup(top);
+            }
+        }
+    }
+
+    SFlatFileJobQueue queue(jobs, 4 * nthreads);
+    vector< CRef<CFlatFileGeneratorThread> > threads;
+    try {
+        for (unsigned int i = 0;  i < nthreads;  ++i) {
+            threads.push_back(CRef<CFlatFileGeneratorThread>(
+                new CFlatFileGeneratorThread(queue, *m_Ctx)));
+            threads.back()->Run();
+        }
+
+        // Write the reports out in the order of the jobs
+        for (size_t i = 0;  i < jobs.size();  ++i) {
+            CRef<CFlatTextBuffer> text;
+            {{
+                CFastMutexGuard guard(queue.lock);
+                while ( !queue.results[i].done ) {
+                    queue.job_done.WaitForSignal(queue.lock);
+                }
+                if ( queue.results[i].error ) {
+                    rethrow_exception(queue.results[i].error);
+                }
+                text.Swap(queue.results[i].text);
+            }}
+            COStreamTextOStream text_os(*jobs[i].os);
+            text_os.AddLine(text->SetText(), 0,
+                            IFlatTextOStream::eAddNewline_No);
+            text.Reset();
+
+            CFastMutexGuard guard(queue.lock);
+            queue.written = i + 1;
+            queue.job_written.SignalAll();
+        }
+    }
+    catch (...) {
+        {{
+            CFastMutexGuard guard(queue.lock);
+            queue.stop = true;
+            queue.job_written.SignalAll();
+        }}
+        NON_CONST_ITERATE(vector< CRef<CFlatFileGeneratorThread> >, it,
+                          threads) {
+            (*it)->Join();
+        }
+        throw;
+    }
+    NON_CONST_ITERATE(vector< CRef<CFlatFileGeneratorThread> >, it, threads) {
+        (*it)->Join();
+    }
+}
+
+
 //void CFlatFileGenerator::Reset(void)
 //{
 //    m_Ctx->Reset();
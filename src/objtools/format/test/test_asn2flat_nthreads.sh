@@ -0,0 +1,45 @@
+#! /bin/sh
+# $Id$
+#
+# asn2flat -nthreads N must write exactly what asn2flat writes with one
+# thread, for a Seq-entry and for a release file (-batch).
+
+if (asn2flat -help) > /dev/null 2>&1; then
+    :
+else
+    echo "asn2flat not found"
+    echo "NCBI_UNITTEST_SKIPPED"
+    exit 0
+fi
+
+dir=test_asn2flat_nthreads.$$
+mkdir $dir || exit 1
+trap 'rm -rf $dir' 0 1 2 15
+
+$CHECK_EXEC test_flatfile_mt -sets 60 -entry-out $dir/entry.asn || exit 1
+$CHECK_EXEC test_flatfile_mt -sets 60 -release-out $dir/release.asnb || exit 1
+
+status=0
+
+compare() {
+    input=$1
+    shift
+    asn2flat -i $input "$@" -nthreads 1 -o $dir/serial.gbk || exit 1
+    for n in 2 4 8; do
+        asn2flat -i $input "$@" -nthreads $n -o $dir/mt.gbk || exit 1
+        if cmp $dir/serial.gbk $dir/mt.gbk; then
+            echo "OK: $input $* -nthreads $n"
+        else
+            echo "FAILURE: $input $* -nthreads $n differs from -nthreads 1"
+            status=1
+        fi
+    done
+}
+
+compare $dir/entry.asn
+compare $dir/entry.asn -format embl -mode release
+compare $dir/entry.asn -cleanup
+compare $dir/release.asnb -batch
+compare $dir/release.asnb -batch -format embl -view nuc
+
+exit $status
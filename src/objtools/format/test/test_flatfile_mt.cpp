@@ -0,0 +1,325 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   CFlatFileGenerator::Generate(TBioseqJobs, nthreads) must write exactly
+ *   what it writes with one thread.  The reports of nucleotide and protein
+ *   Bioseqs of several nuc-prot sets are generated in GenBank and EMBL
+ *   formats, with and without cleanup, into one stream and into a stream
+ *   per Bioseq, using 1 to 8 threads.  The entries can also be written
+ *   out as input for the same comparison of asn2flat -nthreads (see
+ *   test_asn2flat_nthreads.sh).
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <serial/serial.hpp>
+#include <serial/objostr.hpp>
+
+#include <objects/seqset/Seq_entry.hpp>
+#include <objects/seqset/Bioseq_set.hpp>
+#include <objects/seq/Bioseq.hpp>
+#include <objects/seq/Seq_descr.hpp>
+#include <objects/seq/Seqdesc.hpp>
+#include <objects/seq/MolInfo.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_data.hpp>
+#include <objects/seq/IUPACna.hpp>
+#include <objects/seq/IUPACaa.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seqloc/Seq_id.hpp>
+#include <objects/seqloc/Seq_loc.hpp>
+#include <objects/seqloc/Seq_interval.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+#include <objects/seqfeat/BioSource.hpp>
+#include <objects/seqfeat/Org_ref.hpp>
+#include <objects/seqfeat/Gene_ref.hpp>
+#include <objects/seqfeat/Prot_ref.hpp>
+#include <objects/seqfeat/Cdregion.hpp>
+
+#include <objmgr/object_manager.hpp>
+#include <objmgr/scope.hpp>
+#include <objmgr/bioseq_ci.hpp>
+#include <objtools/format/flat_file_config.hpp>
+#include <objtools/format/flat_file_generator.hpp>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+USING_SCOPE(objects);
+
+
+class CTestFlatFileMTApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run(void);
+
+private:
+    CRef<CSeq_entry> x_BuildNucProt(size_t n);
+    CRef<CSeq_entry> x_BuildEntry(size_t sets);
+    string x_Generate(const CFlatFileConfig& cfg, size_t sets,
+                      unsigned int nthreads, bool stream_per_bioseq);
+};
+
+
+void CTestFlatFileMTApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Multi-threaded flat file generation test");
+    arg_desc->AddDefaultKey("sets", "number",
+                            "Number of nuc-prot sets",
+                            CArgDescriptions::eInteger, "40");
+    arg_desc->SetConstraint("sets", new CArgAllow_Integers(1, 99999));
+    arg_desc->AddOptionalKey("entry-out", "File",
+                             "Write the sets as one Seq-entry (ASN.1 text) "
+                             "and exit", CArgDescriptions::eOutputFile);
+    arg_desc->AddOptionalKey("release-out", "File",
+                             "Write the sets as a release file (binary "
+                             "Bioseq-set) and exit",
+                             CArgDescriptions::eOutputFile,
+                             CArgDescriptions::fBinary);
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+// A nucleotide with a gene and a CDS of two exons, and its protein
+CRef<CSeq_entry> CTestFlatFileMTApp::x_BuildNucProt(size_t n)
+{
+    static const char* const kCodons[] =
+        { "GCT", "CGA", "AAC", "GAT", "TGC", "CAG", "GAA", "GGT", "CAT",
+          "ATC", "TTG", "AAA", "ATG", "TTC", "CCT", "TCT", "ACT", "TGG" };
+    static const char kAminoAcids[] = "ARNDCQEGHILKMFPSTW";
+    const size_t kNumCodons = sizeof(kCodons) / sizeof(kCodons[0]);
+
+    string suffix = NStr::SizetToString(n + 1);
+    string nuc_acc = "AB" + string(6 - suffix.size(), '0') + suffix;
+    string prot_acc = "BAA" + string(5 - suffix.size(), '0') + suffix;
+
+    // Coding region of 40 + n % 50 codons, split by an intron of 60 bases
+    size_t codons = 40 + n % 50;
+    string cds, protein;
+    cds += "ATG";
+    protein += 'M';
+    for (size_t i = 1;  i < codons;  ++i) {
+        size_t c = (i * 7 + n) % kNumCodons;
+        cds += kCodons[c];
+        protein += kAminoAcids[c];
+    }
+    cds += "TAA";
+    TSeqPos exon1 = TSeqPos(cds.size() / 2);
+    string nuc = string(100, 'C') + cds.substr(0, exon1) + "GT"
+        + string(56, 'A') + "AG" + cds.substr(exon1) + string(100, 'G');
+    TSeqPos cds_from = 100;
+    TSeqPos intron_to = cds_from + exon1 + 60;
+
+    CRef<CSeq_entry> nuc_entry(new CSeq_entry);
+    CBioseq& nuc_seq = nuc_entry->SetSeq();
+    nuc_seq.SetId().push_back(CRef<CSeq_id>(new CSeq_id("gb|" + nuc_acc + ".1|")));
+    nuc_seq.SetInst().SetRepr(CSeq_inst::eRepr_raw);
+    nuc_seq.SetInst().SetMol(CSeq_inst::eMol_dna);
+    nuc_seq.SetInst().SetLength(TSeqPos(nuc.size()));
+    nuc_seq.SetInst().SetSeq_data().SetIupacna().Set(nuc);
+    CRef<CSeqdesc> title(new CSeqdesc);
+    title->SetTitle("Test organism gene" + suffix + " gene, complete cds");
+    nuc_seq.SetDescr().Set().push_back(title);
+    CRef<CSeqdesc> nuc_molinfo(new CSeqdesc);
+    nuc_molinfo->SetMolinfo().SetBiomol(CMolInfo::eBiomol_genomic);
+    nuc_seq.SetDescr().Set().push_back(nuc_molinfo);
+
+    CRef<CSeq_entry> prot_entry(new CSeq_entry);
+    CBioseq& prot_seq = prot_entry->SetSeq();
+    prot_seq.SetId().push_back(CRef<CSeq_id>(new CSeq_id("gb|" + prot_acc + ".1|")));
+    prot_seq.SetInst().SetRepr(CSeq_inst::eRepr_raw);
+    prot_seq.SetInst().SetMol(CSeq_inst::eMol_aa);
+    prot_seq.SetInst().SetLength(TSeqPos(protein.size()));
+    prot_seq.SetInst().SetSeq_data().SetIupacaa().Set(protein);
+    CRef<CSeqdesc> prot_molinfo(new CSeqdesc);
+    prot_molinfo->SetMolinfo().SetBiomol(CMolInfo::eBiomol_peptide);
+    prot_molinfo->SetMolinfo().SetCompleteness(CMolInfo::eCompleteness_complete);
+    prot_seq.SetDescr().Set().push_back(prot_molinfo);
+
+    CRef<CSeq_feat> prot(new CSeq_feat);
+    prot->SetData().SetProt().SetName().push_back("protein " + suffix);
+    prot->SetLocation().SetWhole().Assign(*prot_seq.GetId().front());
+    CRef<CSeq_annot> prot_annot(new CSeq_annot);
+    prot_annot->SetData().SetFtable().push_back(prot);
+    prot_seq.SetAnnot().push_back(prot_annot);
+
+    CRef<CSeq_annot> annot(new CSeq_annot);
+    const CSeq_id& nuc_id = *nuc_seq.GetId().front();
+
+    CRef<CSeq_feat> gene(new CSeq_feat);
+    gene->SetData().SetGene().SetLocus("gene" + suffix);
+    gene->SetLocation().SetInt().SetId().Assign(nuc_id);
+    gene->SetLocation().SetInt().SetFrom(cds_from);
+    gene->SetLocation().SetInt().SetTo(TSeqPos(cds_from + cds.size() + 60 - 1));
+    annot->SetData().SetFtable().push_back(gene);
+
+    CRef<CSeq_feat> cdregion(new CSeq_feat);
+    cdregion->SetData().SetCdregion();
+    CRef<CSeq_interval> exon(new CSeq_interval);
+    exon->SetId().Assign(nuc_id);
+    exon->SetFrom(cds_from);
+    exon->SetTo(cds_from + exon1 - 1);
+    cdregion->SetLocation().SetPacked_int().Set().push_back(exon);
+    exon.Reset(new CSeq_interval);
+    exon->SetId().Assign(nuc_id);
+    exon->SetFrom(intron_to);
+    exon->SetTo(TSeqPos(intron_to + cds.size() - exon1 - 1));
+    cdregion->SetLocation().SetPacked_int().Set().push_back(exon);
+    cdregion->SetProduct().SetWhole().Assign(*prot_seq.GetId().front());
+    annot->SetData().SetFtable().push_back(cdregion);
+
+    CRef<CSeq_entry> entry(new CSeq_entry);
+    CBioseq_set& set = entry->SetSet();
+    set.SetClass(CBioseq_set::eClass_nuc_prot);
+    CRef<CSeqdesc> source(new CSeqdesc);
+    // Left for cleanup to trim
+    source->SetSource().SetOrg().SetTaxname("Test organism ");
+    set.SetDescr().Set().push_back(source);
+    set.SetSeq_set().push_back(nuc_entry);
+    set.SetSeq_set().push_back(prot_entry);
+    set.SetAnnot().push_back(annot);
+    return entry;
+}
+
+
+CRef<CSeq_entry> CTestFlatFileMTApp::x_BuildEntry(size_t sets)
+{
+    CRef<CSeq_entry> top(new CSeq_entry);
+    top->SetSet().SetClass(CBioseq_set::eClass_genbank);
+    for (size_t i = 0;  i < sets;  ++i) {
+        top->SetSet().SetSeq_set().push_back(x_BuildNucProt(i));
+    }
+    return top;
+}
+
+
+// Every run gets entries of its own, as cleanup edits them
+string CTestFlatFileMTApp::x_Generate(const CFlatFileConfig& cfg,
+                                      size_t sets, unsigned int nthreads,
+                                      bool stream_per_bioseq)
+{
+    CRef<CObjectManager> objmgr = CObjectManager::GetInstance();
+    CScope scope(*objmgr);
+    CSeq_entry_Handle seh = scope.AddTopLevelSeqEntry(*x_BuildEntry(sets));
+
+    CFlatFileGenerator generator(cfg);
+    CNcbiOstrstream common;
+    vector< AutoPtr<CNcbiOstrstream> > streams;
+    CFlatFileGenerator::TBioseqJobs jobs;
+    for (CBioseq_CI it(seh);  it;  ++it) {
+        CNcbiOstrstream* os = &common;
+        if ( stream_per_bioseq ) {
+            streams.push_back(AutoPtr<CNcbiOstrstream>(new CNcbiOstrstream));
+            os = streams.back().get();
+        }
+        jobs.push_back(CFlatFileGenerator::SBioseqJob(*it, *os));
+    }
+    generator.Generate(jobs, nthreads);
+
+    string text = CNcbiOstrstreamToString(common);
+    for (size_t i = 0;  i < streams.size();  ++i) {
+        text += "--- " + NStr::SizetToString(i) + '\n';
+        text += CNcbiOstrstreamToString(*streams[i]);
+    }
+    return text;
+}
+
+
+int CTestFlatFileMTApp::Run(void)
+{
+    const CArgs& args = GetArgs();
+    size_t sets = args["sets"].AsInteger();
+
+    if ( args["entry-out"] ) {
+        args["entry-out"].AsOutputFile() << MSerial_AsnText
+                                         << *x_BuildEntry(sets);
+        return 0;
+    }
+    if ( args["release-out"] ) {
+        args["release-out"].AsOutputFile() << MSerial_AsnBinary
+                                           << x_BuildEntry(sets)->GetSet();
+        return 0;
+    }
+
+    vector<CFlatFileConfig> configs;
+    configs.push_back(CFlatFileConfig(CFlatFileConfig::eFormat_GenBank,
+                                      CFlatFileConfig::eMode_Entrez,
+                                      CFlatFileConfig::eStyle_Normal, 0,
+                                      CFlatFileConfig::fViewAll));
+    configs.push_back(CFlatFileConfig(CFlatFileConfig::eFormat_EMBL,
+                                      CFlatFileConfig::eMode_Release,
+                                      CFlatFileConfig::eStyle_Normal, 0,
+                                      CFlatFileConfig::fViewNucleotides));
+    configs.push_back(configs.front());
+    configs.back().BasicCleanup(true);
+
+    int errors = 0;
+    for (size_t c = 0;  c < configs.size();  ++c) {
+        for (int per_bioseq = 0;  per_bioseq < 2;  ++per_bioseq) {
+            string serial = x_Generate(configs[c], sets, 1,
+                                       per_bioseq != 0);
+            if ( NStr::Find(serial, "gene" + NStr::SizetToString(sets))
+                 == NPOS ) {
+                ERR_POST(Error << "configuration " << c
+                         << ": the last gene is not in the report");
+                ++errors;
+            }
+            for (unsigned int nthreads = 2;  nthreads <= 8;  nthreads *= 2) {
+                string mt = x_Generate(configs[c], sets, nthreads,
+                                       per_bioseq != 0);
+                if ( mt != serial ) {
+                    ERR_POST(Error << "configuration " << c << ", "
+                             << (per_bioseq ? "a stream per Bioseq" :
+                                 "one stream") << ": " << nthreads
+                             << " threads wrote " << mt.size()
+                             << " bytes, differing from the "
+                             << serial.size() << " bytes of one thread");
+                    ++errors;
+                }
+            }
+        }
+    }
+
+    if ( errors ) {
+        ERR_POST(Error << errors << " error(s)");
+        return 1;
+    }
+    NcbiCout << sets * 2 << " Bioseqs: OK" << NcbiEndl;
+    return 0;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestFlatFileMTApp().AppMain(argc, argv);
+}
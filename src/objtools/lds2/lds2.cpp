@@ -31,6 +31,7 @@
 
 #include <ncbi_pch.hpp>
 #include <corelib/ncbifile.hpp>
+#include <corelib/ncbithr.hpp>
 #include <corelib/stream_utils.hpp>
 #include <util/checksum.hpp>
 #include <util/format_guess.hpp>
@@ -54,6 +55,7 @@
 #include <set>
 #include <map>
 #include <stack>
+#include <exception>
 
 
 #define NCBI_USE_ERRCODE_X Objtools_LDS2
@@ -67,16 +69,75 @@ BEGIN_SCOPE(objects)
 typedef CLDS2_Database::TSeqIdSet TSeqIdSet;
 typedef SLDS2_AnnotIdInfo::TRange TAnnotRange;
 
+
+// Top level object found in a data file, with its bioseqs and annotations.
+struct SLDS2_ParsedBlob
+{
+    typedef vector<TSeqIdSet> TBioseqs;
+
+    SLDS2_Blob::EBlobType       type;
+    Int8                        file_pos;
+    TBioseqs                    bioseqs;
+    // All ids used in the bioseqs
+    TSeqIdSet                   bioseq_ids;
+    CLDS2_Database::TLDS2Annots annots;
+    // Apply CLDS2_Manager::EDuplicateIdMode to the bioseqs
+    bool                        check_dup_ids;
+
+    SLDS2_ParsedBlob(void)
+        : type(SLDS2_Blob::eUnknown),
+          file_pos(0),
+          check_dup_ids(true)
+    {}
+};
+typedef vector< AutoPtr<SLDS2_ParsedBlob> > TParsedBlobs;
+
+
+// Data file processed by an indexing thread.
+struct SLDS2_FileJob
+{
+    enum EAction {
+        eSkip,        // file not changed
+        eRemove,      // file does not exist
+        eUnsupported, // unsupported format
+        eParse        // new or modified file
+    };
+
+    SLDS2_File                  db_info;
+    SLDS2_File                  file_info;
+    CRef<CLDS2_UrlHandler_Base> handler;
+    EAction                     action;
+    int                         parsed_entries;
+    TParsedBlobs                blobs;
+    exception_ptr               error;
+
+    SLDS2_FileJob(void)
+        : action(eSkip),
+          parsed_entries(0)
+    {}
+};
+
+
+// Store the blob in the database.
+static void s_StoreBlob(CLDS2_Manager&    mgr,
+                        CLDS2_Database&   db,
+                        Int8              file_id,
+                        SLDS2_ParsedBlob& blob);
+
+
 class CLDS2_ObjectParser
 {
 public:
     typedef SLDS2_File::TFormat TFormat;
 
+    // If 'blobs' is not null, the parsed blobs are collected there
+    // rather than stored in the database.
     CLDS2_ObjectParser(CLDS2_Manager&   mgr,
                        Int8             file_id,
                        TFormat          format,
                        CNcbiIstream&    in,
-                       CLDS2_Database&  db);
+                       CLDS2_Database&  db,
+                       TParsedBlobs*    blobs = 0);
     ~CLDS2_ObjectParser(void) {}
 
     // Try to parse the next blob, return true on success
@@ -136,6 +197,7 @@ private:
     CLDS2_Manager&           m_Manager;
     CNcbiIstream&            m_Stream;
     CLDS2_Database&          m_Db;
+    TParsedBlobs*            m_Blobs;
 
     Int8                     m_CurFileId;
     ESerialDataFormat        m_Format;
@@ -539,10 +601,12 @@ CLDS2_ObjectParser::CLDS2_ObjectParser(CLDS2_Manager&   mgr,
                                        Int8             file_id,
                                        TFormat          format,
                                        CNcbiIstream&    in,
-                                       CLDS2_Database&  db)
+                                       CLDS2_Database&  db,
+                                       TParsedBlobs*    blobs)
     : m_Manager(mgr),
       m_Stream(in),
       m_Db(db),
+      m_Blobs(blobs),
       m_CurFileId(file_id),
       m_Format(eSerial_None),
       m_CurBlobPos(0),
@@ -713,20 +777,46 @@ void CLDS2_ObjectParser::EndBlob(SLDS2_Blob::EBlobType blob_type)
         return;
     }
 
+    AutoPtr<SLDS2_ParsedBlob> blob(new SLDS2_ParsedBlob);
+    blob->type = blob_type;
+    blob->file_pos = m_CurBlobPos;
+    ITERATE(TBioseqs, it, m_Bioseqs) {
+        blob->bioseqs.push_back((*it)->ids);
+    }
+    blob->bioseq_ids.swap(m_BioseqIds);
+    blob->annots.swap(m_Annots);
+    ResetBlob();
+
+    if ( m_Blobs ) {
+        m_Blobs->push_back(blob);
+    }
+    else {
+        s_StoreBlob(m_Manager, m_Db, m_CurFileId, *blob);
+    }
+}
+
+
+static void s_StoreBlob(CLDS2_Manager&    mgr,
+                        CLDS2_Database&   db,
+                        Int8              file_id,
+                        SLDS2_ParsedBlob& blob)
+{
+    SLDS2_Blob::EBlobType blob_type = blob.type;
+
     // Add blob to the database
-    Int8 blob_id = m_Db.AddBlob(m_CurFileId, blob_type, m_CurBlobPos);
+    Int8 blob_id = db.AddBlob(file_id, blob_type, blob.file_pos);
 
     // Add each bioseq to the database
-    ITERATE(TBioseqs, it, m_Bioseqs) {
+    ITERATE(SLDS2_ParsedBlob::TBioseqs, it, blob.bioseqs) {
         // Check for seq-id conflicts
-        if (m_Manager.GetDuplicateIdMode() !=
+        if (blob.check_dup_ids  &&  mgr.GetDuplicateIdMode() !=
             CLDS2_Manager::eDuplicate_Store) {
             CSeq_id_Handle dup;
-            ITERATE(TSeqIdSet, id, (*it)->ids) {
+            ITERATE(TSeqIdSet, id, *it) {
                 // 0 - no such id yet
                 // >0 - single id
                 // -1 - conflict (multiple ids)
-                if ( m_Db.GetBioseqId(*id) != 0) {
+                if ( db.GetBioseqId(*id) != 0) {
                     dup = *id;
                     break;
                 }
@@ -734,8 +824,8 @@ void CLDS2_ObjectParser::EndBlob(SLDS2_Blob::EBlobType blob_type)
             if ( dup ) {
                 // Remove from the list of known ids so that all
                 // annotations become external (???).
-                m_BioseqIds.erase(dup);
-                if (m_Manager.GetDuplicateIdMode() ==
+                blob.bioseq_ids.erase(dup);
+                if (mgr.GetDuplicateIdMode() ==
                     CLDS2_Manager::eDuplicate_Skip) {
                     ERR_POST_X(8, Warning <<
                         "Bioseq with duplicate seq-id found: " <<
@@ -750,11 +840,11 @@ void CLDS2_ObjectParser::EndBlob(SLDS2_Blob::EBlobType blob_type)
                 }
             }
         }
-        m_Db.AddBioseq(blob_id, (*it)->ids);
+        db.AddBioseq(blob_id, *it);
     }
 
     // Add annotations
-    NON_CONST_ITERATE(TAnnots, it, m_Annots) {
+    NON_CONST_ITERATE(CLDS2_Database::TLDS2Annots, it, blob.annots) {
         SLDS2_Annot& annot = **it;
         annot.blob_id = blob_id;
         NON_CONST_ITERATE(SLDS2_Annot::TIdMap, id, annot.ref_ids) {
@@ -768,14 +858,14 @@ void CLDS2_ObjectParser::EndBlob(SLDS2_Blob::EBlobType blob_type)
                 blob_type == SLDS2_Blob::eBioseq_set_element || 
                 blob_type == SLDS2_Blob::eSeq_submit ) 
             {
-                if (m_BioseqIds.find(id->first) != m_BioseqIds.end()) {
+                if (blob.bioseq_ids.find(id->first) !=
+                    blob.bioseq_ids.end()) {
                     ref_id.external = false;
                 }
             }
         }
-        m_Db.AddAnnot(annot);
+        db.AddAnnot(annot);
     }
-    ResetBlob();
 }
 
 
@@ -946,7 +1036,9 @@ CLDS2_Manager::CLDS2_Manager(const string& db_file)
                    CFastaReader::fNoSeqData  |
                    CFastaReader::fParseGaps  |
                    CFastaReader::fParseRawID),
-      m_SeqAlignGroupSize(0)
+      m_SeqAlignGroupSize(0),
+      m_IndexThreads(1),
+      m_WALUpdate(false)
 {
     SetDbFile(db_file);
     // Initialize default handlers
@@ -1044,14 +1136,21 @@ CLDS2_Manager::x_GetUrlHandler(const SLDS2_File& file_info)
 
 
 SLDS2_File CLDS2_Manager::x_GetFileInfo(const string&                file_name,
-                                        CRef<CLDS2_UrlHandler_Base>& handler)
+                                        CRef<CLDS2_UrlHandler_Base>& handler,
+                                        const SLDS2_File&            db_info)
 {
     SLDS2_File info(file_name);
 
     // Find handler for the file or use the default one
     handler.Reset(x_GetUrlHandler(info));
     if ( handler ) {
-        handler->FillInfo(info);
+        if (db_info.id != 0  &&
+            db_info.handler == handler->GetHandlerName()) {
+            handler->FillInfo(info, db_info);
+        }
+        else {
+            handler->FillInfo(info);
+        }
         // Make sure handler name is set
         info.handler = handler->GetHandlerName();
     }
@@ -1074,7 +1173,81 @@ static bool IsSupportedFormat(CFormatGuess::EFormat format)
 }
 
 
+// Checks and parses data files for CLDS2_Manager::x_UpdateDataMT.
+class CLDS2_IndexThread : public CThread
+{
+public:
+    typedef vector< AutoPtr<SLDS2_FileJob> > TJobs;
+
+    CLDS2_IndexThread(CLDS2_Manager& mgr,
+                      TJobs&         jobs,
+                      size_t&        next_job,
+                      CFastMutex&    jobs_mutex)
+        : m_Manager(mgr),
+          m_Jobs(jobs),
+          m_NextJob(next_job),
+          m_JobsMutex(jobs_mutex)
+    {}
+
+    virtual void* Main(void)
+    {
+        for (;;) {
+            size_t job_idx;
+            {{
+                CFastMutexGuard guard(m_JobsMutex);
+                if (m_NextJob >= m_Jobs.size()) {
+                    break;
+                }
+                job_idx = m_NextJob++;
+            }}
+            SLDS2_FileJob& job = *m_Jobs[job_idx];
+            try {
+                m_Manager.x_PrepareFile(job);
+            }
+            catch (...) {
+                job.error = current_exception();
+            }
+        }
+        return 0;
+    }
+
+private:
+    CLDS2_Manager& m_Manager;
+    TJobs&         m_Jobs;
+    size_t&        m_NextJob;
+    CFastMutex&    m_JobsMutex;
+};
+
+
+// Files checked and parsed by x_UpdateDataMT before writing them
+// to the database, per indexing thread.
+static const size_t kLDS2FilesPerThread = 16;
+
+
 void CLDS2_Manager::UpdateData(void)
+{
+    if ( !m_WALUpdate  ||  m_Db->GetDbFile() == ":memory:" ) {
+        x_UpdateData();
+        return;
+    }
+    // The mode is persistent in the database file and a read-only
+    // connection to a WAL database needs a writable -shm file, so it is
+    // used for the time of the update only (see EndUpdate()).
+    int db_flags = m_Db->GetSQLiteFlags();
+    m_Db->SetSQLiteFlags((db_flags & ~CSQLITE_Connection::eAllJournal) |
+                         CSQLITE_Connection::fJournalWAL);
+    try {
+        x_UpdateData();
+    }
+    catch (...) {
+        m_Db->SetSQLiteFlags(db_flags);
+        throw;
+    }
+    m_Db->SetSQLiteFlags(db_flags);
+}
+
+
+void CLDS2_Manager::x_UpdateData(void)
 {
     if ( !CDirEntry(m_Db->GetDbFile()).Exists() ) {
         // Create the database if it does not exist yet.
@@ -1089,10 +1262,15 @@ void CLDS2_Manager::UpdateData(void)
     m_Db->GetFileNames(m_Files);
 
     m_Db->BeginUpdate();
+    if (m_IndexThreads > 1) {
+        x_UpdateDataMT(m_Files);
+        m_Db->EndUpdate();
+        return;
+    }
     ITERATE(TFiles, it, m_Files) {
         CRef<CLDS2_UrlHandler_Base> handler;
-        SLDS2_File file_info = x_GetFileInfo(*it, handler);
         SLDS2_File db_info = m_Db->GetFileInfo(*it);
+        SLDS2_File file_info = x_GetFileInfo(*it, handler, db_info);
         if (!file_info.exists()  ||  !IsSupportedFormat(file_info.format)) {
             // the file does not exist
             if (db_info.id != 0) {
@@ -1132,12 +1310,134 @@ void CLDS2_Manager::UpdateData(void)
 }
 
 
-void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
-                                CLDS2_UrlHandler_Base& handler)
+void CLDS2_Manager::x_UpdateDataMT(const TFiles& files)
+{
+    typedef CLDS2_IndexThread::TJobs TJobs;
+    typedef vector< CRef<CLDS2_IndexThread> > TThreads;
+
+    // The files are processed in batches: the threads check and parse
+    // the files of a batch, then all the results are written to the
+    // database by this thread, so that only the parsed data of a single
+    // batch is kept in memory.
+    size_t batch_size = kLDS2FilesPerThread * m_IndexThreads;
+    TFiles::const_iterator file_it = files.begin();
+    while (file_it != files.end()) {
+        TJobs jobs;
+        for ( ; file_it != files.end()  &&  jobs.size() < batch_size;
+              ++file_it) {
+            AutoPtr<SLDS2_FileJob> job(new SLDS2_FileJob);
+            // The database is only read and written by this thread.
+            job->db_info = m_Db->GetFileInfo(*file_it);
+            job->file_info.name = *file_it;
+            jobs.push_back(job);
+        }
+
+        size_t next_job = 0;
+        CFastMutex jobs_mutex;
+        TThreads threads;
+        size_t thread_count = min<size_t>(m_IndexThreads, jobs.size());
+        for (size_t i = 0; i < thread_count; i++) {
+            CRef<CLDS2_IndexThread> thread(
+                new CLDS2_IndexThread(*this, jobs, next_job, jobs_mutex));
+            thread->Run();
+            threads.push_back(thread);
+        }
+        NON_CONST_ITERATE(TThreads, it, threads) {
+            (*it)->Join();
+        }
+
+        NON_CONST_ITERATE(TJobs, it, jobs) {
+            SLDS2_FileJob& job = **it;
+            if ( job.error ) {
+                rethrow_exception(job.error);
+            }
+            x_StoreFile(job);
+        }
+    }
+}
+
+
+void CLDS2_Manager::x_PrepareFile(SLDS2_FileJob& job)
+{
+    string file_name = job.file_info.name;
+    job.file_info = x_GetFileInfo(file_name, job.handler, job.db_info);
+    if ( !job.file_info.exists() ) {
+        job.action = SLDS2_FileJob::eRemove;
+        return;
+    }
+    if ( !IsSupportedFormat(job.file_info.format) ) {
+        job.action = SLDS2_FileJob::eUnsupported;
+        return;
+    }
+    // By now the handler must be set.
+    _ASSERT(job.handler);
+    if (job.db_info.id != 0) {
+        job.file_info.id = job.db_info.id;
+        if (job.file_info == job.db_info) {
+            job.action = SLDS2_FileJob::eSkip;
+            return;
+        }
+    }
+    job.action = SLDS2_FileJob::eParse;
+    job.parsed_entries = x_ParseFile(job.file_info, *job.handler, &job.blobs);
+}
+
+
+void CLDS2_Manager::x_StoreFile(SLDS2_FileJob& job)
+{
+    switch ( job.action ) {
+    case SLDS2_FileJob::eSkip:
+        break;
+    case SLDS2_FileJob::eRemove:
+    case SLDS2_FileJob::eUnsupported:
+        if (job.db_info.id != 0) {
+            // remove the file from the database
+            m_Db->DeleteFile(job.db_info.id);
+        }
+        if (job.action == SLDS2_FileJob::eUnsupported) {
+            if (m_ErrorMode == eError_Throw) {
+                LDS2_THROW(eIndexerError,
+                    "Unrecognized file format: " + job.file_info.name);
+            }
+            else if (m_ErrorMode == eError_Report) {
+                ERR_POST_X(9, Error <<
+                    "Unrecognized file format: " + job.file_info.name);
+            }
+        }
+        break;
+    case SLDS2_FileJob::eParse:
+        if (job.parsed_entries == 0) {
+            // Nothing found in the file
+            if (job.db_info.id != 0) {
+                m_Db->DeleteFile(job.db_info.id);
+            }
+            break;
+        }
+        if (job.db_info.id == 0) {
+            m_Db->AddFile(job.file_info);
+        }
+        else {
+            m_Db->UpdateFile(job.file_info);
+        }
+        NON_CONST_ITERATE(TParsedBlobs, it, job.blobs) {
+            s_StoreBlob(*this, *m_Db, job.file_info.id, **it);
+        }
+        job.blobs.clear();
+        job.handler->SaveChunks(job.file_info, *m_Db);
+        break;
+    }
+}
+
+
+int CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
+                               CLDS2_UrlHandler_Base& handler,
+                               TParsedBlobs*          blobs)
 {
     // Always open file as binary. Otherwise on Win32 file positions will
-    // be invalid.
-    auto_ptr<CNcbiIstream> in(handler.OpenStream(info, 0, m_Db));
+    // be invalid. Chunks are not needed to read from the start, so the
+    // database is not passed to the handler when collecting blobs.
+    auto_ptr<CNcbiIstream> in(handler.OpenStream(info, 0,
+        blobs ? NULL : m_Db.GetPointer()));
     _ASSERT(in.get());
     int parsed_entries = 0;
     switch ( info.format ) {
@@ -1146,7 +1446,7 @@ void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
     case CFormatGuess::eXml:
         {
             CLDS2_ObjectParser parser(*this,
-                info.id, info.format, *in, *m_Db);
+                info.id, info.format, *in, *m_Db, blobs);
             while ( !in->eof() ) {
                 try {
                     if ( !parser.ParseNext() ) {
@@ -1173,7 +1473,7 @@ void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
                     break;
                 }
             }
-            if (parsed_entries == 0) {
+            if (parsed_entries == 0  &&  !blobs) {
                 // Nothing found in the file
                 m_Db->DeleteFile(info.id);
             }
@@ -1195,15 +1495,27 @@ void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
                         if ( !se->IsSeq() ) {
                             continue;
                         }
-                        Int8 blob_id = m_Db->AddBlob(info.id,
-                            SLDS2_Blob::eSeq_entry, pos);
                         // Index bioseq
                         TSeqIdSet ids;
                         const CBioseq& bs = se->GetSeq();
                         ITERATE(CBioseq::TId, id, bs.GetId()) {
                             ids.insert(CSeq_id_Handle::GetHandle(**id));
                         }
-                        m_Db->AddBioseq(blob_id, ids);
+                        if ( blobs ) {
+                            AutoPtr<SLDS2_ParsedBlob> blob(
+                                new SLDS2_ParsedBlob);
+                            blob->type = SLDS2_Blob::eSeq_entry;
+                            blob->file_pos = pos;
+                            blob->bioseqs.push_back(ids);
+                            blob->bioseq_ids.swap(ids);
+                            blob->check_dup_ids = false;
+                            blobs->push_back(blob);
+                        }
+                        else {
+                            Int8 blob_id = m_Db->AddBlob(info.id,
+                                SLDS2_Blob::eSeq_entry, pos);
+                            m_Db->AddBioseq(blob_id, ids);
+                        }
                         parsed_entries++;
                     } catch (CObjReaderParseException&) {
                         if ( !lr.AtEOF() ) {
@@ -1213,7 +1525,12 @@ void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
                 }
             }
             catch (CException) {
-                m_Db->DeleteFile(info.id);
+                if ( blobs ) {
+                    blobs->clear();
+                }
+                else {
+                    m_Db->DeleteFile(info.id);
+                }
                 if (m_ErrorMode == eError_Throw) {
                     throw;
                 }
@@ -1221,9 +1538,9 @@ void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
                     ERR_POST_X(7, Warning <<
                         "Failed to parse fasta file " << info.name);
                 }
-                return;
+                return 0;
             }
-            if (parsed_entries == 0) {
+            if (parsed_entries == 0  &&  !blobs) {
                 // Nothing in the file
                 m_Db->DeleteFile(info.id);
             }
@@ -1238,12 +1555,15 @@ void CLDS2_Manager::x_ParseFile(const SLDS2_File&      info,
             ERR_POST_X(5, Warning <<
                 "Unsupported data file format: " << info.name);
         }
-        m_Db->DeleteFile(info.id);
-        break;
+        if ( !blobs ) {
+            m_Db->DeleteFile(info.id);
+        }
+        return 0;
     }
-    if (parsed_entries > 0) {
+    if (parsed_entries > 0  &&  !blobs) {
         handler.SaveChunks(info, *m_Db);
     }
+    return parsed_entries;
 }
 
 
@@ -441,11 +441,19 @@ void CLDS2_Database::Create(void)
     // Close the connection if any
     x_ResetDbConnection();
 
-    // Delete all data
+    // Delete all data, including the write-ahead log if any
     CFile dbf(m_DbFile);
     if ( dbf.Exists() ) {
         dbf.Remove();
     }
+    CFile walf(m_DbFile + "-wal");
+    if ( walf.Exists() ) {
+        walf.Remove();
+    }
+    CFile shmf(m_DbFile + "-shm");
+    if ( shmf.Exists() ) {
+        shmf.Remove();
+    }
 
     // Initialize connection and create tables:
     x_ExecuteSqls(kLDS2_CreateDB,
@@ -1029,6 +1037,20 @@ void CLDS2_Database::EndUpdate(void)
         sizeof(kLDS2_CreateDBIdx)/sizeof(kLDS2_CreateDBIdx[0]));
     conn.ExecuteSql("end transaction;");
     Analyze();
+    if (m_DbFlags & CSQLITE_Connection::fJournalWAL) {
+        // Leave the write-ahead log mode, it is persistent in the file
+        // and read-only connections would need a writable -shm file.
+        // This moves the update to the database file and fails if there
+        // are still readers, then the database is left in WAL mode.
+        try {
+            conn.ExecuteSql("PRAGMA journal_mode = DELETE;");
+        }
+        catch (CSQLITE_Exception& ex) {
+            ERR_POST_X(11, Warning <<
+                "LDS2: Database " << m_DbFile <<
+                " is left in WAL journal mode: " << ex.GetMsg());
+        }
+    }
 }
 
 
@@ -31,6 +31,7 @@
 
 #include <ncbi_pch.hpp>
 #include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
 #include <util/checksum.hpp>
 #include <util/format_guess.hpp>
 #include <util/compress/compress.hpp>
@@ -51,10 +52,36 @@ BEGIN_SCOPE(objects)
 
 void CLDS2_UrlHandler_Base::FillInfo(SLDS2_File& info)
 {
-    info.format = GetFileFormat(info);
-    info.crc = GetFileCRC(info);
     info.size = GetFileSize(info);
     info.time = GetFileTime(info);
+    if ( !info.exists() ) {
+        // The file was removed, there is nothing to read
+        return;
+    }
+    info.format = GetFileFormat(info);
+    info.crc = GetFileCRC(info);
+}
+
+
+void CLDS2_UrlHandler_Base::FillInfo(SLDS2_File&       info,
+                                     const SLDS2_File& db_info)
+{
+    if (db_info.id != 0  &&  db_info.time != 0) {
+        info.size = GetFileSize(info);
+        info.time = GetFileTime(info);
+        if ( !info.exists() ) {
+            // The file was removed, there is nothing to read
+            return;
+        }
+        if (info.size == db_info.size  &&  info.time == db_info.time) {
+            // Unchanged file - do not read it again
+            info.format = db_info.format;
+            info.crc = db_info.crc;
+            return;
+        }
+    }
+    // New or changed file, let the handler fill everything
+    FillInfo(info);
 }
 
 
@@ -115,7 +142,8 @@ Int8 CLDS2_UrlHandler_File::GetFileTime(const SLDS2_File& file_info)
 {
     CFile f(file_info.name);
     CFile::SStat stat;
-    return f.Stat(&stat) ? stat.mtime_nsec : 0;
+    return f.Stat(&stat) ?
+        Int8(stat.orig.st_mtime)*kNanoSecondsPerSecond + stat.mtime_nsec : 0;
 }
 
 
@@ -139,7 +139,8 @@ CGff2Reader::CGff2Reader(
     CReaderBase(iFlags, name, title),
     m_pErrors(0),
     mCurrentFeatureCount(0),
-    mParsingAlignment(false)
+    mParsingAlignment(false),
+    mStreamMaxTo(0)
 {
 }
 
@@ -197,6 +198,11 @@ CGff2Reader::ReadSeqAnnot(
     mCurrentFeatureCount = 0;
     mParsingAlignment = false;
 
+    bool streaming = (m_iFlags & (fStreamBySeqId | fStreamByLocus));
+    if (streaming) {
+        xResetStreamState();
+    }
+
     map<string, list<CRef<CSeq_align>>> alignments;
     list<string> id_list;
    
@@ -215,6 +221,13 @@ CGff2Reader::ReadSeqAnnot(
             return pAnnot;
         }
         xReportProgress(pEC);
+        if (streaming  &&  line == "###") {
+            // all forward references before this point are resolved
+            if (mCurrentFeatureCount) {
+                break;
+            }
+            continue;
+        }
         if ( xParseStructuredComment(line) ) {
             continue;
         }
@@ -235,6 +248,22 @@ CGff2Reader::ReadSeqAnnot(
             break;
         }
 
+        if (streaming) {
+            vector<CTempStringEx> columns;
+            CGff2Record::TokenizeGFF(columns, line);
+            if (columns.size() >= 9) {
+                if (mCurrentFeatureCount  &&  xIsStreamBoundary(columns)) {
+                    xUngetLine(lr);
+                    break;
+                }
+                mStreamSeqId = columns[0];
+                if (xIsStreamLocusFeature(columns)) {
+                    mStreamMaxTo = max(mStreamMaxTo, NStr::StringToUInt(
+                        columns[4], NStr::fConvErr_NoThrow));
+                }
+            }
+        }
+
         if ( CGff2Reader::IsAlignmentData(line) &&
              x_ParseAlignmentGff(line, id_list, alignments)) {
             continue;
@@ -844,6 +873,35 @@ CGff2Reader::xIsCurrentDataType(
     return (!mParsingAlignment  ||  !mCurrentFeatureCount);
 }
 
+//  ----------------------------------------------------------------------------
+bool
+CGff2Reader::xIsStreamBoundary(
+    const vector<CTempStringEx>& columns)
+//  ----------------------------------------------------------------------------
+{
+    return !NStr::Equal(columns[0], mStreamSeqId);
+}
+
+//  ----------------------------------------------------------------------------
+bool
+CGff2Reader::xIsStreamLocusFeature(
+    const vector<CTempStringEx>& columns)
+//  ----------------------------------------------------------------------------
+{
+    return true;
+}
+
+//  ----------------------------------------------------------------------------
+void
+CGff2Reader::xResetStreamState()
+//  ----------------------------------------------------------------------------
+{
+    //  features of annots already handed out can't be parents any more
+    mStreamSeqId.clear();
+    mStreamMaxTo = 0;
+    m_MapIdToFeature.clear();
+}
+
 //  ----------------------------------------------------------------------------
 bool CGff2Reader::x_ParseFeatureGff(
     const string& strLine,
@@ -214,6 +214,118 @@ bool CGff3Reader::IsInGenbankMode() const
     return (m_iFlags & CGff3Reader::fGenbankMode);
 }
 
+//  ----------------------------------------------------------------------------
+static bool s_GetRawAttribute(
+    const CTempString& attributes,
+    const CTempString& key,
+    CTempString& value)
+//  ----------------------------------------------------------------------------
+{
+    vector<CTempString> pairs;
+    NStr::Split(attributes, ";", pairs);
+    for (vector<CTempString>::const_iterator it = pairs.begin();
+            it != pairs.end(); ++it) {
+        CTempString pair = NStr::TruncateSpaces_Unsafe(*it);
+        SIZE_TYPE eq = pair.find('=');
+        if (eq == NPOS) {
+            continue;
+        }
+        if (NStr::EqualNocase(
+                NStr::TruncateSpaces_Unsafe(pair.substr(0, eq)), key)) {
+            value = NStr::TruncateSpaces_Unsafe(pair.substr(eq + 1));
+            return true;
+        }
+    }
+    return false;
+}
+
+//  ----------------------------------------------------------------------------
+bool CGff3Reader::xIsStreamBoundary(
+    const vector<CTempStringEx>& columns)
+//  ----------------------------------------------------------------------------
+{
+    if (CGff2Reader::xIsStreamBoundary(columns)) {
+        return true;
+    }
+    if (!(m_iFlags & fStreamByLocus)) {
+        return false;
+    }
+
+    //  In a file sorted by start, a feature without parent that starts past
+    //  everything read so far can't be related to any of it. Continuation
+    //  lines of a feature already seen are never a boundary.
+    CTempString value;
+    if (s_GetRawAttribute(columns[8], "Parent", value)  ||
+            s_GetRawAttribute(columns[8], "Derives_from", value)) {
+        return false;
+    }
+    if (s_GetRawAttribute(columns[8], "ID", value)  &&
+            m_MapIdToFeature.find(value) != m_MapIdToFeature.end()) {
+        return false;
+    }
+    //  Features over the whole seqid read so far go with the next locus.
+    TSeqPos from = NStr::StringToUInt(columns[3], NStr::fConvErr_NoThrow);
+    return (mStreamMaxTo > 0  &&  from > mStreamMaxTo);
+}
+
+//  ----------------------------------------------------------------------------
+bool CGff3Reader::xIsStreamLocusFeature(
+    const vector<CTempStringEx>& columns)
+//  ----------------------------------------------------------------------------
+{
+    //  Features describing the whole sequence would make every later feature
+    //  look related to what has been read so far.
+    CTempString value;
+    if (s_GetRawAttribute(columns[8], "Parent", value)) {
+        return true;
+    }
+    static const char* const seqTypes[] = {
+        "chromosome", "contig", "region", "replicon", "supercontig",
+    };
+    for (size_t i = 0; i < sizeof(seqTypes)/sizeof(seqTypes[0]); ++i) {
+        if (NStr::EqualNocase(columns[2], seqTypes[i])) {
+            return false;
+        }
+    }
+    map<string, TSeqPos>::const_iterator it =
+        mSequenceRegionEnds.find(columns[0]);
+    if (it == mSequenceRegionEnds.end()) {
+        return true;
+    }
+    TSeqPos from = NStr::StringToUInt(columns[3], NStr::fConvErr_NoThrow);
+    TSeqPos to = NStr::StringToUInt(columns[4], NStr::fConvErr_NoThrow);
+    return (from > 1  ||  to < it->second);
+}
+
+//  ----------------------------------------------------------------------------
+bool CGff3Reader::xParseStructuredComment(
+    const string& strLine)
+//  ----------------------------------------------------------------------------
+{
+    if (!CGff2Reader::xParseStructuredComment(strLine)) {
+        return false;
+    }
+    //  ##sequence-region seqid start end
+    if (NStr::StartsWith(strLine, "##sequence-region")) {
+        vector<string> tokens;
+        NStr::Split(strLine, " \t", tokens, NStr::fSplit_Tokenize);
+        if (tokens.size() == 4) {
+            mSequenceRegionEnds[tokens[1]] =
+                NStr::StringToUInt(tokens[3], NStr::fConvErr_NoThrow);
+        }
+    }
+    return true;
+}
+
+//  ----------------------------------------------------------------------------
+void CGff3Reader::xResetStreamState()
+//  ----------------------------------------------------------------------------
+{
+    CGff2Reader::xResetStreamState();
+    mCdsParentMap.clear();
+    mMrnaLocs.clear();
+}
+
 //  ----------------------------------------------------------------------------
 bool CGff3Reader::x_UpdateFeatureCds(
     const CGff2Record& gff,
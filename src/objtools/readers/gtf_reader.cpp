@@ -267,6 +267,16 @@ CGtfReader::ReadSeqAnnots(
     ReadSeqAnnots( annots, lr, pMessageListener );
 }
 
+//  ----------------------------------------------------------------------------
+void CGtfReader::xResetStreamState()
+//  ----------------------------------------------------------------------------
+{
+    CGff2Reader::xResetStreamState();
+    m_GeneMap.clear();
+    m_CdsMap.clear();
+    m_MrnaMap.clear();
+}
+
 //  ----------------------------------------------------------------------------
 bool CGtfReader::x_UpdateAnnotFeature(
     const CGff2Record& gff,
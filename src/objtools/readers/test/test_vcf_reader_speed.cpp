@@ -0,0 +1,259 @@
+/*  $Id$
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+* File Description:
+*   Time of CVcfReader on a generated VCF laid out like the 1000 Genomes
+*   release files: phased GT columns for every sample, mostly SNPs with
+*   the usual INFO keys. The same data is read with genotypes decoded
+*   into the features, with fLazyGenotypes, with a few samples selected,
+*   and on 1 to -threads parsing threads. Every run must produce a feature
+*   per data line.
+*
+*/
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbitime.hpp>
+
+#include <objects/seq/Seq_annot.hpp>
+#include <objtools/readers/message_listener.hpp>
+#include <objtools/readers/vcf_reader.hpp>
+
+BEGIN_NCBI_SCOPE
+USING_SCOPE(objects);
+
+
+class CTestVcfReaderSpeedApp : public CNcbiApplication
+{
+private:
+    virtual void Init(void);
+    virtual int  Run(void);
+
+    string x_BuildVcf(size_t samples, size_t variants);
+    size_t x_Read(const string& vcf, int flags, unsigned int threads,
+                  const vector<string>& samples, double& seconds);
+};
+
+
+void CTestVcfReaderSpeedApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "CVcfReader on a generated many-sample VCF");
+    arg_desc->AddDefaultKey("samples", "number",
+                            "Number of sample columns",
+                            CArgDescriptions::eInteger, "2504");
+    arg_desc->SetConstraint("samples", new CArgAllow_Integers(1, 100000));
+    arg_desc->AddDefaultKey("variants", "number",
+                            "Number of data lines",
+                            CArgDescriptions::eInteger, "20000");
+    arg_desc->SetConstraint("variants", new CArgAllow_Integers(1, 10000000));
+    arg_desc->AddDefaultKey("threads", "number",
+                            "Largest number of parsing threads to time",
+                            CArgDescriptions::eInteger, "4");
+    arg_desc->SetConstraint("threads", new CArgAllow_Integers(1, 64));
+    arg_desc->AddDefaultKey("select", "number",
+                            "Number of samples for the selected sample run",
+                            CArgDescriptions::eInteger, "10");
+    arg_desc->SetConstraint("select", new CArgAllow_Integers(1, 100000));
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+// Pseudo-random numbers, the same on every run
+static unsigned int s_Random(Uint4& seed, unsigned int max_value)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % (max_value + 1);
+}
+
+
+static string s_SampleName(size_t u)
+{
+    return "HG" + NStr::NumericToString(u + 100000).substr(1);
+}
+
+
+string CTestVcfReaderSpeedApp::x_BuildVcf(size_t samples, size_t variants)
+{
+    static const char* const kBases[] = { "A", "C", "G", "T" };
+
+    string vcf =
+        "##fileformat=VCFv4.1\n"
+        "##INFO=<ID=AC,Number=A,Type=Integer,Description=\"Allele count\">\n"
+        "##INFO=<ID=AF,Number=A,Type=Float,Description=\"Allele frequency\">\n"
+        "##INFO=<ID=AN,Number=1,Type=Integer,Description=\"Allele number\">\n"
+        "##INFO=<ID=NS,Number=1,Type=Integer,Description=\"Samples\">\n"
+        "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Read depth\">\n"
+        "##INFO=<ID=VT,Number=.,Type=String,Description=\"Variant type\">\n"
+        "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+        "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT";
+    for (size_t u = 0;  u < samples;  ++u) {
+        vcf += "\t" + s_SampleName(u);
+    }
+    vcf += "\n";
+
+    Uint4 seed = 1;
+    unsigned int pos = 16050000;
+    string line;
+    for (size_t v = 0;  v < variants;  ++v) {
+        pos += 1 + s_Random(seed, 200);
+        unsigned int ref = s_Random(seed, 3);
+        unsigned int alt = (ref + 1 + s_Random(seed, 2)) % 4;
+        bool indel = s_Random(seed, 9) == 0;
+        // about one sample in 20 carries the alternative
+        string genotypes;
+        size_t ac = 0;
+        for (size_t u = 0;  u < samples;  ++u) {
+            unsigned int r = s_Random(seed, 79);
+            const char* gt = "\t0|0";
+            if (r < 2) {
+                gt = "\t0|1";
+                ++ac;
+            }
+            else if (r < 4) {
+                gt = "\t1|0";
+                ++ac;
+            }
+            else if (r == 4) {
+                gt = "\t1|1";
+                ac += 2;
+            }
+            genotypes += gt;
+        }
+        line = "22\t" + NStr::NumericToString(pos) + "\trs" +
+            NStr::NumericToString(100000 + v) + "\t" + kBases[ref] + "\t";
+        line += indel ? string(kBases[ref]) + kBases[alt] : kBases[alt];
+        line += "\t100\tPASS\tAC=" + NStr::NumericToString(ac) +
+            ";AF=" + NStr::DoubleToString(double(ac) / (2 * samples), 6) +
+            ";AN=" + NStr::NumericToString(2 * samples) +
+            ";NS=" + NStr::NumericToString(samples) +
+            ";DP=" + NStr::NumericToString(samples * 3 + s_Random(seed, 999)) +
+            ";VT=" + (indel ? "INDEL" : "SNP") + "\tGT";
+        vcf += line + genotypes + "\n";
+    }
+    return vcf;
+}
+
+
+size_t CTestVcfReaderSpeedApp::x_Read(
+    const string& vcf, int flags, unsigned int threads,
+    const vector<string>& samples, double& seconds)
+{
+    CStopWatch sw(CStopWatch::eStart);
+    CVcfReader reader(flags);
+    if ( !samples.empty() ) {
+        reader.SetSamples(samples);
+    }
+    reader.SetParseThreads(threads);
+
+    CNcbiIstrstream istr(vcf.data(), vcf.size());
+    CMessageListenerLenient errors;
+    CVcfReader::TAnnots annots;
+    reader.ReadSeqAnnots(annots, istr, &errors);
+    size_t features = 0;
+    ITERATE(CVcfReader::TAnnots, it, annots) {
+        features += (*it)->GetData().GetFtable().size();
+    }
+    seconds = sw.Elapsed();
+    if (errors.Count() != 0) {
+        ERR_POST(errors.Count() << " messages reading the data");
+    }
+    return features;
+}
+
+
+int CTestVcfReaderSpeedApp::Run(void)
+{
+    const CArgs& args = GetArgs();
+    size_t samples = args["samples"].AsInteger();
+    size_t variants = args["variants"].AsInteger();
+    unsigned int max_threads = args["threads"].AsInteger();
+
+    CStopWatch sw(CStopWatch::eStart);
+    string vcf = x_BuildVcf(samples, variants);
+    double megabytes = double(vcf.size()) / (1024 * 1024);
+    NcbiCout << variants << " variants, " << samples << " samples, "
+             << megabytes << " MB generated in "
+             << sw.Elapsed() << " s" << NcbiEndl;
+
+    vector<string> selected;
+    size_t select = min<size_t>(args["select"].AsInteger(), samples);
+    for (size_t u = 0;  u < select;  ++u) {
+        selected.push_back(s_SampleName(u * samples / select));
+    }
+
+    struct SRun {
+        const char* m_Name;
+        int m_Flags;
+        bool m_Select;
+    };
+    const SRun kRuns[] = {
+        { "eager",                  0,                          false },
+        { "lazy",                   CVcfReader::fLazyGenotypes, false },
+        { "eager, samples",         0,                          true  },
+        { "lazy, samples",          CVcfReader::fLazyGenotypes, true  }
+    };
+
+    // 1, 2, 4, ... and -threads
+    vector<unsigned int> thread_counts;
+    for (unsigned int threads = 1;  threads < max_threads;  threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    int result = 0;
+    for (size_t r = 0;  r < sizeof(kRuns) / sizeof(kRuns[0]);  ++r) {
+        const SRun& run = kRuns[r];
+        ITERATE(vector<unsigned int>, it, thread_counts) {
+            unsigned int threads = *it;
+            double seconds = 0;
+            size_t features = x_Read(vcf, run.m_Flags, threads,
+                run.m_Select ? selected : vector<string>(), seconds);
+            NcbiCout << run.m_Name << ", " << threads << " thread(s): "
+                     << seconds << " s ("
+                     << megabytes / seconds << " MB/s)"
+                     << NcbiEndl;
+            if (features != variants) {
+                ERR_POST(features << " features instead of " << variants);
+                result = 1;
+            }
+        }
+    }
+    return result;
+}
+
+
+END_NCBI_SCOPE
+
+
+USING_NCBI_SCOPE;
+
+int main(int argc, const char* argv[])
+{
+    return CTestVcfReaderSpeedApp().AppMain(argc, argv);
+}
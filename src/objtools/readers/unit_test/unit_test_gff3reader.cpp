@@ -39,6 +39,8 @@
 #include <corelib/ncbifile.hpp>
 
 #include <objtools/readers/gff3_reader.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <util/line_reader.hpp>
 #include "error_logger.hpp"
 
 #include <cstdio>
@@ -325,3 +327,76 @@ BOOST_AUTO_TEST_CASE(RunTests)
         BOOST_CHECK_NO_THROW(sRunTest(sName, testInfo, args["keep-diffs"]));
     }
 }
+
+//  ----------------------------------------------------------------------------
+//  Streaming of sorted input: same features, returned per seqid or per locus
+//  ----------------------------------------------------------------------------
+static const char* const kSortedGff3 =
+    "##gff-version 3\n"
+    "chr1\tsrc\tgene\t100\t500\t.\t+\t.\tID=gene1\n"
+    "chr1\tsrc\tmRNA\t100\t500\t.\t+\t.\tID=rna1;Parent=gene1\n"
+    "chr1\tsrc\texon\t100\t200\t.\t+\t.\tParent=rna1\n"
+    "chr1\tsrc\texon\t300\t500\t.\t+\t.\tParent=rna1\n"
+    "chr1\tsrc\tgene\t1000\t1500\t.\t-\t.\tID=gene2\n"
+    "chr1\tsrc\tmRNA\t1000\t1500\t.\t-\t.\tID=rna2;Parent=gene2\n"
+    "chr1\tsrc\texon\t1000\t1500\t.\t-\t.\tParent=rna2\n"
+    "chr2\tsrc\tgene\t100\t500\t.\t+\t.\tID=gene3\n"
+    "chr2\tsrc\tmRNA\t100\t500\t.\t+\t.\tID=rna3;Parent=gene3\n"
+    "chr2\tsrc\texon\t100\t500\t.\t+\t.\tParent=rna3\n";
+
+//  features over the whole seqid don't tie the loci together
+static const char* const kSortedGff3WithRegions =
+    "##gff-version 3\n"
+    "##sequence-region chr1 1 5000\n"
+    "##sequence-region chr2 1 800\n"
+    "chr1\tsrc\tregion\t1\t5000\t.\t+\t.\tID=chr1\n"
+    "chr1\tsrc\tgene\t100\t500\t.\t+\t.\tID=gene1\n"
+    "chr1\tsrc\tmRNA\t100\t500\t.\t+\t.\tID=rna1;Parent=gene1\n"
+    "chr1\tsrc\texon\t100\t500\t.\t+\t.\tParent=rna1\n"
+    "chr1\tsrc\tgene\t1000\t1500\t.\t-\t.\tID=gene2\n"
+    "chr1\tsrc\tmRNA\t1000\t1500\t.\t-\t.\tID=rna2;Parent=gene2\n"
+    "chr1\tsrc\texon\t1000\t1500\t.\t-\t.\tParent=rna2\n"
+    "chr2\tsrc\tbiological_region\t1\t800\t.\t+\t.\tID=chr2\n"
+    "chr2\tsrc\tgene\t100\t300\t.\t+\t.\tID=gene3\n"
+    "chr2\tsrc\tmRNA\t100\t300\t.\t+\t.\tID=rna3;Parent=gene3\n"
+    "chr2\tsrc\texon\t100\t300\t.\t+\t.\tParent=rna3\n"
+    "chr2\tsrc\tgene\t500\t700\t.\t+\t.\tID=gene4\n"
+    "chr2\tsrc\tmRNA\t500\t700\t.\t+\t.\tID=rna4;Parent=gene4\n"
+    "chr2\tsrc\texon\t500\t700\t.\t+\t.\tParent=rna4\n";
+
+static size_t s_ReadSorted(
+    const char* input, unsigned int flags, size_t& featCount)
+{
+    CNcbiIstrstream istr(input);
+    CStreamLineReader lr(istr);
+    CGff3Reader reader(flags);
+
+    size_t annotCount = 0;
+    featCount = 0;
+    CRef<CSeq_annot> pAnnot = reader.ReadSeqAnnot(lr);
+    while (pAnnot) {
+        ++annotCount;
+        featCount += pAnnot->GetData().GetFtable().size();
+        pAnnot = reader.ReadSeqAnnot(lr);
+    }
+    return annotCount;
+}
+
+BOOST_AUTO_TEST_CASE(StreamSorted)
+{
+    const unsigned int byLocus =
+        CGff2Reader::fStreamBySeqId | CGff2Reader::fStreamByLocus;
+    size_t featsAll, featsSeqId, featsLocus;
+    BOOST_CHECK_EQUAL(s_ReadSorted(kSortedGff3, 0, featsAll), 1u);
+    BOOST_CHECK_EQUAL(s_ReadSorted(
+        kSortedGff3, CGff2Reader::fStreamBySeqId, featsSeqId), 2u);
+    BOOST_CHECK_EQUAL(s_ReadSorted(kSortedGff3, byLocus, featsLocus), 3u);
+    BOOST_CHECK_EQUAL(featsSeqId, featsAll);
+    BOOST_CHECK_EQUAL(featsLocus, featsAll);
+
+    //  each region goes with the first locus after it
+    BOOST_CHECK_EQUAL(s_ReadSorted(kSortedGff3WithRegions, 0, featsAll), 1u);
+    BOOST_CHECK_EQUAL(
+        s_ReadSorted(kSortedGff3WithRegions, byLocus, featsLocus), 4u);
+    BOOST_CHECK_EQUAL(featsLocus, featsAll);
+}
@@ -39,6 +39,7 @@
 #include <corelib/ncbifile.hpp>
 
 #include <objtools/readers/vcf_reader.hpp>
+#include <util/line_reader.hpp>
 #include "error_logger.hpp"
 
 #include <cstdio>
@@ -189,7 +190,8 @@ void sUpdateAll(CDir& test_cases_dir) {
     }
 }
 
-void sRunTest(const string &sTestName, const STestInfo & testInfo, bool keep)
+void sRunTest(const string &sTestName, const STestInfo & testInfo, bool keep,
+    unsigned int threads = 1)
 {
     cerr << "Testing " << testInfo.mInFile.GetName() << " against " <<
         testInfo.mOutFile.GetName() << " and " <<
@@ -199,6 +201,7 @@ void sRunTest(const string &sTestName, const STestInfo & testInfo, bool keep)
     CErrorLogger logger(logName);
 
     READERCLASS reader(0);
+    reader.SetParseThreads(threads);
     CNcbiIfstream ifstr(testInfo.mInFile.GetPath().c_str());
 
     typedef list<CRef<CSeq_annot> > ANNOTS;
@@ -320,5 +323,116 @@ BOOST_AUTO_TEST_CASE(RunTests)
         cout << "Running test: " << sName << endl;
 
         BOOST_CHECK_NO_THROW(sRunTest(sName, testInfo, args["keep-diffs"]));
+
+        //  parallel parsing must give the very same output
+        cout << "Running test: " << sName << " (4 threads)" << endl;
+        BOOST_CHECK_NO_THROW(sRunTest(sName, testInfo, false, 4));
+    }
+}
+
+//  ----------------------------------------------------------------------------
+//  Lazy genotypes and sample selection decode to the same values
+//  ----------------------------------------------------------------------------
+static const char* const kSamplesVcf =
+    "##fileformat=VCFv4.1\n"
+    "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\tS2\tS3\n"
+    "1\t100\trs1\tA\tG\t50\tPASS\tDP=10\tGT:DP\t0|1:3\t1|1:4\t0|0:5\n"
+    "1\t200\trs2\tC\tT\t.\tPASS\t.\tGT\t0|0\t0|1\t1|0\n";
+
+static void s_ReadSamples(
+    int flags,
+    const vector<string>& samples,
+    vector<map<string, vector<string> > >& genotypes)
+{
+    CNcbiIstrstream istr(kSamplesVcf);
+    CStreamLineReader lr(istr);
+    CVcfReader reader(flags);
+    reader.SetSamples(samples);
+    reader.SetParseThreads(2);
+    CRef<CSeq_annot> pAnnot = reader.ReadSeqAnnot(lr);
+    BOOST_REQUIRE(pAnnot);
+
+    genotypes.clear();
+    ITERATE (CSeq_annot::TData::TFtable, it, pAnnot->GetData().GetFtable()) {
+        genotypes.push_back(map<string, vector<string> >());
+        BOOST_CHECK(CVcfReader::GetGenotypeData(
+            **it, reader.GetGenotypeHeaders(), genotypes.back()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LazyGenotypes)
+{
+    vector<string> all, some;
+    some.push_back("S3");
+    some.push_back("S1");
+
+    vector<map<string, vector<string> > > eager, lazy, selected;
+    s_ReadSamples(0, all, eager);
+    s_ReadSamples(CVcfReader::fLazyGenotypes, all, lazy);
+    s_ReadSamples(CVcfReader::fLazyGenotypes, some, selected);
+
+    BOOST_REQUIRE_EQUAL(eager.size(), 2u);
+    BOOST_REQUIRE_EQUAL(lazy.size(), 2u);
+    BOOST_REQUIRE_EQUAL(selected.size(), 2u);
+    for (size_t u = 0; u < eager.size(); ++u) {
+        BOOST_CHECK_EQUAL(eager[u].size(), 3u);
+        BOOST_CHECK(eager[u] == lazy[u]);
+        BOOST_CHECK_EQUAL(selected[u].size(), 2u);
+        BOOST_CHECK(selected[u]["S1"] == eager[u]["S1"]);
+        BOOST_CHECK(selected[u]["S3"] == eager[u]["S3"]);
+    }
+    BOOST_CHECK_EQUAL(eager[0]["S2"][1], "4");
+}
+
+//  ----------------------------------------------------------------------------
+//  Lazy INFO is kept raw and decodes to the same values
+//  ----------------------------------------------------------------------------
+static const char* const kInfoVcf =
+    "##fileformat=VCFv4.1\n"
+    "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+    "1\t100\trs1\tA\tG\t50\tPASS\tDP=10;AF=0.25,0.5;R5\n"
+    "1\t200\trs2\tC\tT\t.\tPASS\t.\n";
+
+static void s_ReadInfos(
+    int flags,
+    vector<map<string, vector<string> > >& infos,
+    vector<bool>& found)
+{
+    CNcbiIstrstream istr(kInfoVcf);
+    CStreamLineReader lr(istr);
+    CVcfReader reader(flags);
+    CRef<CSeq_annot> pAnnot = reader.ReadSeqAnnot(lr);
+    BOOST_REQUIRE(pAnnot);
+
+    infos.clear();
+    found.clear();
+    ITERATE (CSeq_annot::TData::TFtable, it, pAnnot->GetData().GetFtable()) {
+        infos.push_back(map<string, vector<string> >());
+        found.push_back(CVcfReader::GetInfoData(**it, infos.back()));
     }
 }
+
+BOOST_AUTO_TEST_CASE(LazyInfo)
+{
+    vector<map<string, vector<string> > > eager, lazy;
+    vector<bool> eager_found, lazy_found;
+    s_ReadInfos(0, eager, eager_found);
+    s_ReadInfos(CVcfReader::fLazyGenotypes, lazy, lazy_found);
+
+    BOOST_REQUIRE_EQUAL(eager.size(), 2u);
+    BOOST_REQUIRE_EQUAL(lazy.size(), 2u);
+    BOOST_CHECK(eager_found[0]);
+    BOOST_CHECK(lazy_found[0]);
+    BOOST_CHECK(!eager_found[1]);
+    BOOST_CHECK(!lazy_found[1]);
+
+    //  R5 is a variant property unless INFO is left raw
+    BOOST_CHECK_EQUAL(eager[0].size(), 2u);
+    BOOST_CHECK_EQUAL(lazy[0].size(), 3u);
+    BOOST_CHECK(lazy[0].find("R5") != lazy[0].end());
+    BOOST_CHECK(lazy[0]["R5"].empty());
+    BOOST_CHECK(eager[0]["DP"] == lazy[0]["DP"]);
+    BOOST_CHECK(eager[0]["AF"] == lazy[0]["AF"]);
+    BOOST_REQUIRE_EQUAL(lazy[0]["AF"].size(), 2u);
+    BOOST_CHECK_EQUAL(lazy[0]["AF"][1], "0.5");
+}
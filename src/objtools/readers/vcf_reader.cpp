@@ -40,6 +40,7 @@
 
 #include <util/static_map.hpp>
 #include <util/line_reader.hpp>
+#include <util/thread_pool_old.hpp>
 
 #include <serial/iterator.hpp>
 #include <serial/objistrasn.hpp>
@@ -77,6 +78,7 @@
 #include <objtools/error_codes.hpp>
 
 #include <algorithm>
+#include <exception>
 
 #define NCBI_USE_ERRCODE_X   Objtools_Rd_RepMask
 
@@ -94,7 +96,6 @@ public:
     CVcfData() { m_pdQual = 0; };
     ~CVcfData() { delete m_pdQual; };
 
-    string m_strLine;
     string m_strChrom;
     int m_iPos;
     vector<string> m_Ids;
@@ -103,9 +104,11 @@ public:
     double* m_pdQual;
     string m_strFilter;
     INFOS m_Info;
+    string m_strInfo;           // raw, fLazyGenotypes only
     vector<string> m_FormatKeys;
 //    vector< vector<string> > m_GenotypeData;
     GTDATA m_GenotypeData;
+    string m_strGenotypes;      // raw sample columns, fLazyGenotypes only
     enum SetType_t {
         ST_ALL_SNV,
         ST_ALL_DEL,
@@ -115,6 +118,25 @@ public:
     } m_SetType;
 };
 
+//  ----------------------------------------------------------------------------
+static void s_SplitInfo(
+    const CTempString& info,
+    map<string, vector<string> >& infos)
+//  ----------------------------------------------------------------------------
+{
+    vector<CTempString> entries;
+    NStr::Split( info, ";", entries, NStr::eMergeDelims );
+    for ( vector<CTempString>::const_iterator it = entries.begin(); 
+        it != entries.end(); ++it ) 
+    {
+        CTempString key, value;
+        NStr::SplitInTwo( *it, "=", key, value );
+        vector<string>& values = infos[string(key)];
+        values.clear();
+        NStr::Split( value, ",", values );
+    }
+}
+
 //  ----------------------------------------------------------------------------
 ESpecType SpecType( 
     const string& spectype )
@@ -166,11 +188,86 @@ ESpecNumber SpecNumber(
     }    
 };
 
+//  ============================================================================
+class CVcfDataLineErrors : public CMessageListenerLenient
+//  ============================================================================
+{
+};
+
+//  ============================================================================
+class CVcfDataBlock : public CObject
+//  ============================================================================
+{
+public:
+    CVcfDataBlock(
+        CVcfReader::TDataLines& lines) :
+        m_Done(0, kMax_UInt), m_Finished(false) { m_Lines.swap(lines); };
+
+    void Wait(void)
+    {
+        if (!m_Finished) {
+            for (size_t u=0; u < m_Tasks.size(); ++u) {
+                m_Done.Wait();
+            }
+            m_Finished = true;
+        }
+    }
+
+    CVcfReader::TDataLines m_Lines;
+    vector<CRef<CVcfDataLineTask> > m_Tasks;
+    CSemaphore m_Done;  // posted by each task
+    bool m_Finished;
+};
+
+//  ============================================================================
+class CVcfDataLineTask : public CStdRequest
+//  ============================================================================
+{
+public:
+    CVcfDataLineTask(
+        CVcfReader& reader,
+        CVcfDataBlock& block,
+        size_t from,
+        size_t to) :
+        m_Reader(reader), m_Block(block), m_From(from), m_To(to) {};
+
+    virtual void Process(void)
+    {
+        try {
+            for (size_t u = m_From; u < m_To; ++u) {
+                CVcfReader::SDataLine& dataLine = m_Block.m_Lines[u];
+                dataLine.m_FirstError = m_Errors.Count();
+                m_Reader.xBuildDataFeature(
+                    dataLine.m_Line, dataLine.m_Feature, &m_Errors);
+                dataLine.m_ErrorCount =
+                    m_Errors.Count() - dataLine.m_FirstError;
+            }
+        }
+        catch (...) {
+            m_Exception = current_exception();
+        }
+        //  the block may go away right after this
+        m_Block.m_Done.Post();
+    }
+
+    CVcfReader& m_Reader;
+    CVcfDataBlock& m_Block;
+    size_t m_From;
+    size_t m_To;
+    CVcfDataLineErrors m_Errors;
+    exception_ptr m_Exception;
+};
+
+//  ----------------------------------------------------------------------------
+//  data lines per parsing thread and block
+static const size_t kDataBlockLines = 1024;
+
 //  ----------------------------------------------------------------------------
 CVcfReader::CVcfReader(
     int flags ):
     CReaderBase(flags),
-    m_MetaHandled(false)
+    m_MetaHandled(false),
+    m_ParseThreads(1)
 //  ----------------------------------------------------------------------------
 {
 }
@@ -180,6 +277,104 @@ CVcfReader::CVcfReader(
 CVcfReader::~CVcfReader()
 //  ----------------------------------------------------------------------------
 {
+    xDiscardDataBlock();
+    if (m_ParsePool) {
+        m_ParsePool->KillAllThreads(CStdPoolOfThreads::fKill_Wait);
+    }
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::SetSamples(
+    const vector<string>& samples)
+//  ----------------------------------------------------------------------------
+{
+    m_Samples.clear();
+    m_Samples.insert(samples.begin(), samples.end());
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::SetParseThreads(
+    unsigned int threads)
+//  ----------------------------------------------------------------------------
+{
+    xDiscardDataBlock();
+    if (m_ParsePool) {
+        m_ParsePool->KillAllThreads(CStdPoolOfThreads::fKill_Wait);
+        m_ParsePool.reset();
+    }
+    m_ParseThreads = max(threads, 1u);
+    if (m_ParseThreads > 1) {
+        //  room for the block being parsed and the one being merged
+        m_ParsePool.reset(new CStdPoolOfThreads(
+            m_ParseThreads, 2 * m_ParseThreads));
+        m_ParsePool->Spawn(m_ParseThreads);
+    }
+}
+
+//  ----------------------------------------------------------------------------
+bool
+CVcfReader::GetGenotypeData(
+    const CSeq_feat& feat,
+    const vector<string>& headers,
+    map<string, vector<string> >& genotypes)
+//  ----------------------------------------------------------------------------
+{
+    genotypes.clear();
+    if (!feat.IsSetExt()) {
+        return false;
+    }
+    const CUser_object& ext = feat.GetExt();
+    if (ext.HasField("genotype-data-raw")) {
+        const CUser_field& raw = ext.GetField("genotype-data-raw");
+        if (!raw.GetData().IsStr()) {
+            return false;
+        }
+        vector<CTempString> columns;
+        NStr::Split(raw.GetData().GetStr(), "\t", columns, NStr::eMergeDelims);
+        for (size_t u = 0; u < columns.size()  &&  u < headers.size(); ++u) {
+            NStr::Split(columns[u], ":", genotypes[headers[u]],
+                NStr::eMergeDelims);
+        }
+        return true;
+    }
+    if (ext.HasField("genotype-data")) {
+        const CUser_field& data = ext.GetField("genotype-data");
+        if (!data.GetData().IsFields()) {
+            return false;
+        }
+        ITERATE (CUser_field::C_Data::TFields, it, data.GetData().GetFields()) {
+            const CUser_field& sample = **it;
+            if (!sample.GetLabel().IsStr()  ||  !sample.GetData().IsStrs()) {
+                continue;
+            }
+            const CUser_field::C_Data::TStrs& values = sample.GetData().GetStrs();
+            genotypes[sample.GetLabel().GetStr()].assign(
+                values.begin(), values.end());
+        }
+        return true;
+    }
+    return false;
+}
+
+//  ----------------------------------------------------------------------------
+bool
+CVcfReader::GetInfoData(
+    const CSeq_feat& feat,
+    map<string, vector<string> >& infos)
+//  ----------------------------------------------------------------------------
+{
+    infos.clear();
+    if (!feat.IsSetExt()  ||  !feat.GetExt().HasField("info")) {
+        return false;
+    }
+    const CUser_field& info = feat.GetExt().GetField("info");
+    if (!info.GetData().IsStr()) {
+        return false;
+    }
+    s_SplitInfo(info.GetData().GetStr(), infos);
+    return true;
 }
 
 //  ----------------------------------------------------------------------------                
@@ -202,6 +397,7 @@ CVcfReader::ReadSeqAnnot(
 
     string line;
     unsigned int dataCount = 0;
+    TDataLines dataLines;
     while (xGetLine(lr, line)) {
         if (IsCanceled()) {
             AutoPtr<CObjReaderLineException> pErr(
@@ -211,9 +407,22 @@ CVcfReader::ReadSeqAnnot(
                 "Reader stopped by user.",
                 ILineError::eProblem_ProgressInfo));
             ProcessError(*pErr, pEC);
+            xDiscardDataBlock();
             return CRef<CSeq_annot>();
         }
         xReportProgress(pEC);
+        if (m_ParseThreads > 1  &&  !NStr::StartsWith(line, "#")  &&
+                !NStr::StartsWith(line, "browser")  &&
+                !NStr::StartsWith(line, "track")) {
+            dataLines.push_back(SDataLine(m_uLineNumber, line));
+            if (dataLines.size() >= kDataBlockLines * m_ParseThreads) {
+                dataCount += xProcessDataBlock(dataLines, annot, pEC, false);
+            }
+            continue;
+        }
+        if (!dataLines.empty()  ||  m_PendingBlock) {
+            dataCount += xProcessDataBlock(dataLines, annot, pEC, true);
+        }
         if (xIsTrackLine(line)  &&  dataCount) {
             xUngetLine(lr);
             break;
@@ -243,6 +452,9 @@ CVcfReader::ReadSeqAnnot(
             ILineError::eProblem_GeneralParsingError) );
         ProcessWarning(*pErr, pEC);
     }
+    if (!dataLines.empty()  ||  m_PendingBlock) {
+        xProcessDataBlock(dataLines, annot, pEC, true);
+    }
     xAssignTrackData(annot);
     xAssignVcfMeta(annot, pEC);
     return annot;
@@ -506,6 +718,17 @@ CVcfReader::xProcessHeaderLine(
     }
     else {
         m_GenotypeHeaders.erase( m_GenotypeHeaders.begin(), pos_format+1 );
+        m_SampleColumns.clear();
+        if ( ! m_Samples.empty() ) {
+            vector<string> selected;
+            for (size_t u=0; u < m_GenotypeHeaders.size(); ++u) {
+                if (m_Samples.find(m_GenotypeHeaders[u]) != m_Samples.end()) {
+                    m_SampleColumns.push_back(u);
+                    selected.push_back(m_GenotypeHeaders[u]);
+                }
+            }
+            m_GenotypeHeaders.swap(selected);
+        }
         m_Meta->SetUser().AddField("genotype-headers", m_GenotypeHeaders);
     }
     
@@ -554,6 +777,163 @@ CVcfReader::xProcessDataLine(
     if ( NStr::StartsWith( line, "#" ) ) {
         return false;
     }
+    CRef<CSeq_feat> pFeat;
+    if (!xBuildDataFeature(line, pFeat, pEC)) {
+        return false;
+    }
+    pAnnot->SetData().SetFtable().push_back( pFeat );
+    return true;
+}
+
+//  ----------------------------------------------------------------------------
+unsigned int
+CVcfReader::xProcessDataBlock(
+    TDataLines& lines,
+    CRef<CSeq_annot> pAnnot,
+    ILineErrorListener* pEC,
+    bool flush)
+//  ----------------------------------------------------------------------------
+{
+    //  put the new lines on the pool in consecutive runs per task, then merge
+    //  the previous block while they are parsed
+    CRef<CVcfDataBlock> pPrevious = m_PendingBlock;
+    m_PendingBlock.Reset();
+    if (!lines.empty()) {
+        m_PendingBlock.Reset(new CVcfDataBlock(lines));
+        TDataLines& blockLines = m_PendingBlock->m_Lines;
+        size_t taskCount = min<size_t>(m_ParseThreads, blockLines.size());
+        size_t from = 0;
+        for (size_t u=0; u < taskCount; ++u) {
+            size_t to = from + (blockLines.size() - from) / (taskCount - u);
+            m_PendingBlock->m_Tasks.push_back(CRef<CVcfDataLineTask>(
+                new CVcfDataLineTask(*this, *m_PendingBlock, from, to)));
+            from = to;
+        }
+        NON_CONST_ITERATE (vector<CRef<CVcfDataLineTask> >, it,
+                m_PendingBlock->m_Tasks) {
+            m_ParsePool->AcceptRequest(CRef<CStdRequest>(*it));
+        }
+    }
+
+    unsigned int dataCount = 0;
+    if (pPrevious) {
+        dataCount += xFinishDataBlock(*pPrevious, pAnnot, pEC);
+    }
+    if (flush  &&  m_PendingBlock) {
+        pPrevious.Swap(m_PendingBlock);
+        m_PendingBlock.Reset();
+        dataCount += xFinishDataBlock(*pPrevious, pAnnot, pEC);
+    }
+    return dataCount;
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xDiscardDataBlock()
+//  ----------------------------------------------------------------------------
+{
+    //  the tasks use the reader, wait for them
+    if (m_PendingBlock) {
+        m_PendingBlock->Wait();
+        m_PendingBlock.Reset();
+    }
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::ProcessError(
+    CObjReaderLineException& err,
+    ILineErrorListener* pContainer)
+//  ----------------------------------------------------------------------------
+{
+    if (dynamic_cast<CVcfDataLineErrors*>(pContainer)) {
+        pContainer->PutError(err);
+        return;
+    }
+    CReaderBase::ProcessError(err, pContainer);
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::ProcessWarning(
+    CObjReaderLineException& err,
+    ILineErrorListener* pContainer)
+//  ----------------------------------------------------------------------------
+{
+    if (dynamic_cast<CVcfDataLineErrors*>(pContainer)) {
+        pContainer->PutError(err);
+        return;
+    }
+    CReaderBase::ProcessWarning(err, pContainer);
+}
+
+//  ----------------------------------------------------------------------------
+unsigned int
+CVcfReader::xFinishDataBlock(
+    CVcfDataBlock& block,
+    CRef<CSeq_annot> pAnnot,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    typedef vector<CRef<CVcfDataLineTask> > TASKS;
+    block.Wait();
+    ITERATE (TASKS, it, block.m_Tasks) {
+        if ((*it)->m_Exception) {
+            xDiscardDataBlock();
+            rethrow_exception((*it)->m_Exception);
+        }
+    }
+
+    //  report messages and collect features in input order
+    unsigned int currentLine = m_uLineNumber;
+    unsigned int dataCount = 0;
+    NON_CONST_ITERATE (TASKS, it, block.m_Tasks) {
+        CVcfDataLineTask& task = **it;
+        for (size_t u = task.m_From; u < task.m_To; ++u) {
+            SDataLine& dataLine = block.m_Lines[u];
+            m_uLineNumber = dataLine.m_LineNumber;
+            for (size_t e=0; e < dataLine.m_ErrorCount; ++e) {
+                AutoPtr<ILineError> pClone(task.m_Errors.GetError(
+                    dataLine.m_FirstError + e).Clone());
+                CObjReaderLineException* pErr =
+                    dynamic_cast<CObjReaderLineException*>(pClone.get());
+                if (!pErr) {
+                    continue;
+                }
+                if (pErr->Severity() <= eDiag_Warning) {
+                    ProcessWarning(*pErr, pEC);
+                }
+                else {
+                    ProcessError(*pErr, pEC);
+                }
+            }
+            if (!dataLine.m_Feature) {
+                // same as ReadSeqAnnot() reports for a line it can't use
+                AutoPtr<CObjReaderLineException> pErr(
+                    CObjReaderLineException::Create(
+                    eDiag_Warning,
+                    0,
+                    "CVcfReader::ReadSeqAnnot: Unrecognized line or record type.",
+                    ILineError::eProblem_GeneralParsingError) );
+                ProcessWarning(*pErr, pEC);
+                continue;
+            }
+            pAnnot->SetData().SetFtable().push_back(dataLine.m_Feature);
+            ++dataCount;
+        }
+    }
+    m_uLineNumber = currentLine;
+    return dataCount;
+}
+
+//  ----------------------------------------------------------------------------
+bool
+CVcfReader::xBuildDataFeature(
+    const string& line,
+    CRef<CSeq_feat>& pResult,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
     CVcfData data;
     if (!xParseData(line, data, pEC)) {
         return false;
@@ -590,7 +970,7 @@ CVcfReader::xProcessDataLine(
     if ( pFeat->GetExt().GetData().empty() ) {
         pFeat->ResetExt();
     }
-    pAnnot->SetData().SetFtable().push_back( pFeat );
+    pResult = pFeat;
     return true;
 }
 
@@ -834,14 +1214,13 @@ CVcfReader::xParseData(
     ILineErrorListener* pEC)
 //  ----------------------------------------------------------------------------
 {
-    vector<string> columns;
+    vector<CTempString> columns;
     NStr::Split( line, "\t", columns, NStr::eMergeDelims );
     if ( columns.size() < 8 ) {
         return false;
     }
+    bool lazy = (m_iFlags & fLazyGenotypes);
     try {
-        data.m_strLine = line;
-
         data.m_strChrom = columns[0];
         data.m_iPos = NStr::StringToInt( columns[1] );
         NStr::Split( columns[2], ";", data.m_Ids, NStr::eNoMergeDelims );
@@ -855,25 +1234,37 @@ CVcfReader::xParseData(
         }
         data.m_strFilter = columns[6];
 
-        vector<string> infos;
         if ( columns[7] != "." ) {
-            NStr::Split( columns[7], ";", infos, NStr::eMergeDelims );
-            for ( vector<string>::iterator it = infos.begin(); 
-                it != infos.end(); ++it ) 
-            {
-                string key, value;
-                NStr::SplitInTwo( *it, "=", key, value );
-                data.m_Info[key] = vector<string>();
-                NStr::Split( value, ",", data.m_Info[key] );
+            if ( lazy ) {
+                data.m_strInfo = columns[7];
+            }
+            else {
+                s_SplitInfo( columns[7], data.m_Info );
             }
         }
         if ( columns.size() > 8 ) {
             NStr::Split( columns[8], ":", data.m_FormatKeys, NStr::eMergeDelims );
 
-            for ( size_t u=9; u < columns.size(); ++u ) {
-                vector<string> values;
-                NStr::Split( columns[u], ":", values, NStr::eMergeDelims );
-                data.m_GenotypeData[ m_GenotypeHeaders[u-9] ] = values;
+            //  sample u is in column 9+u, the kept ones are in the headers
+            size_t sampleCount = m_Samples.empty() ?
+                min(columns.size() - 9, m_GenotypeHeaders.size()) :
+                m_SampleColumns.size();
+            for ( size_t u=0; u < sampleCount; ++u ) {
+                size_t col = 9 + (m_Samples.empty() ? u : m_SampleColumns[u]);
+                if ( col >= columns.size() ) {
+                    break;
+                }
+                if ( lazy ) {
+                    if ( u > 0 ) {
+                        data.m_strGenotypes += '\t';
+                    }
+                    data.m_strGenotypes.append(
+                        columns[col].data(), columns[col].size());
+                    continue;
+                }
+                vector<string>& values = data.m_GenotypeData[ m_GenotypeHeaders[u] ];
+                values.clear();
+                NStr::Split( columns[col], ":", values, NStr::eMergeDelims );
             }
         }
     }
@@ -1149,6 +1540,12 @@ CVcfReader::xProcessInfo(
         return false;
     }
     CSeq_feat::TExt& ext = pFeature->SetExt();
+    if (m_iFlags & fLazyGenotypes) {
+        if (!data.m_strInfo.empty()) {
+            ext.AddField( "info", data.m_strInfo );
+        }
+        return true;
+    }
     if (data.m_Info.empty()) {
         return true;
     }
@@ -1219,6 +1616,11 @@ CVcfReader::xProcessFormat(
     CSeq_feat::TExt& ext = pFeature->SetExt();
     ext.AddField("format", data.m_FormatKeys);
 
+    if (m_iFlags & fLazyGenotypes) {
+        ext.AddField("genotype-data-raw", data.m_strGenotypes);
+        return true;
+    }
+
     CRef<CUser_field> pGenotypeData( new CUser_field );
     pGenotypeData->SetLabel().SetStr("genotype-data");
 
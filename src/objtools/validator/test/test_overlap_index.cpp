@@ -0,0 +1,363 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Time of the overlapping feature queries of the validator: the
+ *   location index of the validator cache against the annotation
+ *   iterators of sequence::GetOverlappingFeatures(). A bioseq gets genes
+ *   with an mRNA and a CDS of several exons each, and the gene, mRNA and
+ *   CDS overlapping every feature are looked up the way the feature
+ *   checks do. Both must find the same features.
+ *
+ *   Layouts: "tiled" - evenly spaced, partly overlapping genes; "bacterial"
+ *   - a 5 Mb genome of short adjacent single-exon genes; "eukaryotic" - a
+ *   chromosome with genes tens of kb long, every 40th of them 1 to 2 Mb
+ *   long with the following genes nested in its introns.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbitime.hpp>
+
+#include <objects/seqset/Seq_entry.hpp>
+#include <objects/seq/Bioseq.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_data.hpp>
+#include <objects/seq/IUPACna.hpp>
+#include <objects/seqloc/Seq_id.hpp>
+#include <objects/seqloc/Seq_loc.hpp>
+#include <objects/seqloc/Seq_interval.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+#include <objects/seqfeat/Gene_ref.hpp>
+#include <objects/seqfeat/RNA_ref.hpp>
+#include <objects/seqfeat/Cdregion.hpp>
+
+#include <objmgr/object_manager.hpp>
+#include <objmgr/scope.hpp>
+#include <objmgr/util/sequence.hpp>
+#include <objtools/validator/validatorp.hpp>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+USING_SCOPE(objects);
+USING_SCOPE(validator);
+
+
+class CTestOverlapIndexApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run(void);
+
+private:
+    CRef<CSeq_entry> x_BuildEntry(size_t genes);
+    CRef<CSeq_entry> x_BuildBacterialEntry(void);
+    CRef<CSeq_entry> x_BuildEukaryoticEntry(size_t genes);
+    CRef<CSeq_entry> x_NewEntry(TSeqPos length, bool with_data);
+    void x_AddFeat(CSeq_entry& entry, CSeq_feat& feat);
+    void x_AddGene(CSeq_entry& entry, size_t index, CSeq_loc& mrna_loc,
+                   CSeq_loc& cds_loc, bool with_mrna);
+};
+
+
+void CTestOverlapIndexApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Validator overlapping feature queries");
+    arg_desc->AddDefaultKey("genes", "number",
+                            "Number of genes on the bioseq",
+                            CArgDescriptions::eInteger, "2000");
+    arg_desc->SetConstraint("genes", new CArgAllow_Integers(1, 1000000));
+    arg_desc->AddDefaultKey("layout", "layout",
+                            "Features on the bioseq: tiled, bacterial "
+                            "(-genes is ignored) or eukaryotic",
+                            CArgDescriptions::eString, "tiled");
+    arg_desc->SetConstraint("layout",
+                            &(*new CArgAllow_Strings,
+                              "tiled", "bacterial", "eukaryotic"));
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+static CRef<CSeq_loc> s_MakeExons(TSeqPos from, size_t exons,
+                                  TSeqPos exon_len, TSeqPos intron_len,
+                                  ENa_strand strand)
+{
+    CRef<CSeq_loc> loc(new CSeq_loc);
+    for (size_t i = 0;  i < exons;  ++i) {
+        CRef<CSeq_interval> exon(new CSeq_interval);
+        exon->SetId().SetLocal().SetStr("bench");
+        exon->SetFrom(from);
+        exon->SetTo(from + exon_len - 1);
+        exon->SetStrand(strand);
+        if (strand == eNa_strand_minus) {
+            loc->SetPacked_int().Set().push_front(exon);
+        }
+        else {
+            loc->SetPacked_int().Set().push_back(exon);
+        }
+        from += exon_len + intron_len;
+    }
+    return loc;
+}
+
+
+void CTestOverlapIndexApp::x_AddFeat(CSeq_entry& entry, CSeq_feat& feat)
+{
+    if ( !entry.GetSeq().IsSetAnnot() ) {
+        entry.SetSeq().SetAnnot().push_back(CRef<CSeq_annot>(new CSeq_annot));
+    }
+    entry.SetSeq().SetAnnot().front()->SetData().SetFtable()
+        .push_back(CRef<CSeq_feat>(&feat));
+}
+
+
+// Long bioseqs get no sequence data, the queries do not need it
+CRef<CSeq_entry> CTestOverlapIndexApp::x_NewEntry(TSeqPos length,
+                                                  bool with_data)
+{
+    CRef<CSeq_entry> entry(new CSeq_entry);
+    CBioseq& seq = entry->SetSeq();
+    seq.SetId().push_back(CRef<CSeq_id>(new CSeq_id("lcl|bench")));
+    seq.SetInst().SetMol(CSeq_inst::eMol_dna);
+    seq.SetInst().SetLength(length);
+    if (with_data) {
+        seq.SetInst().SetRepr(CSeq_inst::eRepr_raw);
+        seq.SetInst().SetSeq_data().SetIupacna().Set(string(length, 'A'));
+    }
+    else {
+        seq.SetInst().SetRepr(CSeq_inst::eRepr_virtual);
+    }
+    return entry;
+}
+
+
+// A gene over the mRNA extremes, the mRNA (if required) and the CDS
+void CTestOverlapIndexApp::x_AddGene(CSeq_entry& entry, size_t index,
+                                     CSeq_loc& mrna_loc, CSeq_loc& cds_loc,
+                                     bool with_mrna)
+{
+    CRef<CSeq_feat> gene(new CSeq_feat);
+    gene->SetData().SetGene().SetLocus("gene" + NStr::SizetToString(index));
+    gene->SetLocation().SetInt().SetId().SetLocal().SetStr("bench");
+    gene->SetLocation().SetInt().SetFrom(mrna_loc.GetStart(eExtreme_Positional));
+    gene->SetLocation().SetInt().SetTo(mrna_loc.GetStop(eExtreme_Positional));
+    gene->SetLocation().SetInt().SetStrand(mrna_loc.GetStrand());
+    x_AddFeat(entry, *gene);
+
+    if (with_mrna) {
+        CRef<CSeq_feat> mrna(new CSeq_feat);
+        mrna->SetData().SetRna().SetType(CRNA_ref::eType_mRNA);
+        mrna->SetLocation(mrna_loc);
+        x_AddFeat(entry, *mrna);
+    }
+
+    CRef<CSeq_feat> cds(new CSeq_feat);
+    cds->SetData().SetCdregion();
+    cds->SetLocation(cds_loc);
+    x_AddFeat(entry, *cds);
+}
+
+
+// Genes of 3 to 6 exons, partly overlapping each other on both strands
+CRef<CSeq_entry> CTestOverlapIndexApp::x_BuildEntry(size_t genes)
+{
+    const TSeqPos kStep = 600;
+    CRef<CSeq_entry> entry = x_NewEntry(TSeqPos(genes) * kStep + 2000, true);
+
+    for (size_t i = 0;  i < genes;  ++i) {
+        TSeqPos    from = TSeqPos(i) * kStep;
+        size_t     exons = 3 + i % 4;
+        ENa_strand strand = i % 3 == 2 ? eNa_strand_minus : eNa_strand_plus;
+
+        x_AddGene(*entry, i, *s_MakeExons(from, exons, 150, 100, strand),
+                  *s_MakeExons(from + 30, exons, 120, 130, strand), true);
+    }
+    return entry;
+}
+
+
+// Pseudo-random numbers, the same on every run
+static TSeqPos s_Random(Uint4& seed, TSeqPos min_value, TSeqPos max_value)
+{
+    seed = seed * 1103515245 + 12345;
+    return min_value + (seed >> 8) % (max_value - min_value + 1);
+}
+
+
+// About 4300 genes of 300 to 1800 bases on a 5 Mb genome, no mRNAs
+CRef<CSeq_entry> CTestOverlapIndexApp::x_BuildBacterialEntry(void)
+{
+    const TSeqPos kLength = 5000000;
+    CRef<CSeq_entry> entry = x_NewEntry(kLength, false);
+    Uint4 seed = 1;
+    size_t genes = 0;
+
+    for (TSeqPos from = 100;  ;  ++genes) {
+        TSeqPos len = s_Random(seed, 100, 600) * 3;
+        if (from + len + 100 > kLength) {
+            break;
+        }
+        ENa_strand strand = s_Random(seed, 0, 1) ?
+            eNa_strand_minus : eNa_strand_plus;
+
+        x_AddGene(*entry, genes, *s_MakeExons(from, 1, len, 0, strand),
+                  *s_MakeExons(from, 1, len, 0, strand), false);
+        from += len + s_Random(seed, 10, 200);
+    }
+    return entry;
+}
+
+
+// Genes of 5 to 15 exons, 10 to 80 kb long, 30 kb apart on average. Every
+// 40th gene is 1 to 2 Mb long and the genes starting in it are nested in
+// its introns.
+CRef<CSeq_entry> CTestOverlapIndexApp::x_BuildEukaryoticEntry(size_t genes)
+{
+    const TSeqPos kExon = 150;
+    TSeqPos length = TSeqPos(genes) * 30000 + 2000000;
+    CRef<CSeq_entry> entry = x_NewEntry(length, false);
+    Uint4 seed = 1;
+
+    TSeqPos from = 10000;
+    for (size_t i = 0;  i < genes;  ++i) {
+        size_t exons = s_Random(seed, 5, 15);
+        TSeqPos len = i % 40 == 0 ?
+            s_Random(seed, 1000000, 2000000) : s_Random(seed, 10000, 80000);
+        TSeqPos intron = (len - TSeqPos(exons) * kExon) / TSeqPos(exons - 1);
+        ENa_strand strand = s_Random(seed, 0, 1) ?
+            eNa_strand_minus : eNa_strand_plus;
+
+        x_AddGene(*entry, i,
+                  *s_MakeExons(from, exons, kExon, intron, strand),
+                  *s_MakeExons(from + kExon + intron, exons - 2, kExon,
+                               intron, strand), true);
+        // the next gene starts in the first intron of a long one
+        from += i % 40 == 0 ?
+            kExon + 1000 : len + s_Random(seed, 1000, 20000);
+    }
+    return entry;
+}
+
+
+struct SQuery
+{
+    CSeqFeatData::E_Choice  m_Type;
+    CSeqFeatData::ESubtype  m_Subtype;
+    sequence::EOverlapType  m_Overlap;
+};
+
+
+int CTestOverlapIndexApp::Run(void)
+{
+    const SQuery kQueries[] = {
+        { CSeqFeatData::e_Gene, CSeqFeatData::eSubtype_gene,
+          sequence::eOverlap_Contained },
+        { CSeqFeatData::e_Rna, CSeqFeatData::eSubtype_mRNA,
+          sequence::eOverlap_CheckIntRev },
+        { CSeqFeatData::e_Cdregion, CSeqFeatData::eSubtype_cdregion,
+          sequence::eOverlap_Interval }
+    };
+    const size_t kNumQueries = sizeof(kQueries) / sizeof(kQueries[0]);
+
+    const CArgs& args = GetArgs();
+    size_t genes = args["genes"].AsInteger();
+    CRef<CSeq_entry> entry;
+    if (args["layout"].AsString() == "bacterial") {
+        entry = x_BuildBacterialEntry();
+    }
+    else if (args["layout"].AsString() == "eukaryotic") {
+        entry = x_BuildEukaryoticEntry(genes);
+    }
+    else {
+        entry = x_BuildEntry(genes);
+    }
+    CRef<CObjectManager> objmgr = CObjectManager::GetInstance();
+    CScope scope(*objmgr);
+    scope.AddTopLevelSeqEntry(*entry);
+
+    vector< CConstRef<CSeq_feat> > feats;
+    ITERATE(CSeq_annot::TData::TFtable, it,
+            entry->GetSeq().GetAnnot().front()->GetData().GetFtable()) {
+        feats.push_back(*it);
+    }
+
+    // sequence::
+    vector<sequence::TFeatScores> expected(feats.size() * kNumQueries);
+    CStopWatch sw(CStopWatch::eStart);
+    for (size_t i = 0;  i < feats.size();  ++i) {
+        for (size_t q = 0;  q < kNumQueries;  ++q) {
+            sequence::GetOverlappingFeatures(feats[i]->GetLocation(),
+                kQueries[q].m_Type, kQueries[q].m_Subtype,
+                kQueries[q].m_Overlap, expected[i * kNumQueries + q], scope);
+        }
+    }
+    double iterator_time = sw.Elapsed();
+
+    // the validator cache, including building the index
+    vector<sequence::TFeatScores> found(feats.size() * kNumQueries);
+    CValidator::CCacheImpl cache;
+    sw.Restart();
+    for (size_t i = 0;  i < feats.size();  ++i) {
+        for (size_t q = 0;  q < kNumQueries;  ++q) {
+            cache.GetOverlappingFeatures(feats[i]->GetLocation(),
+                kQueries[q].m_Type, kQueries[q].m_Subtype,
+                kQueries[q].m_Overlap, found[i * kNumQueries + q], scope);
+        }
+    }
+    double index_time = sw.Elapsed();
+
+    size_t mismatches = 0;
+    for (size_t i = 0;  i < found.size();  ++i) {
+        if (found[i] != expected[i]) {
+            ++mismatches;
+        }
+    }
+
+    size_t queries = feats.size() * kNumQueries;
+    NcbiCout << feats.size() << " features, " << queries << " queries" << NcbiEndl
+             << "sequence::GetOverlappingFeatures: " << iterator_time << " s ("
+             << iterator_time * 1e6 / queries << " us/query)" << NcbiEndl
+             << "validator cache:                  " << index_time << " s ("
+             << index_time * 1e6 / queries << " us/query)" << NcbiEndl;
+    if (mismatches) {
+        ERR_POST(mismatches << " queries found different features");
+        return 1;
+    }
+    return 0;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestOverlapIndexApp().AppMain(argc, argv);
+}
@@ -20771,3 +20771,186 @@ BOOST_AUTO_TEST_CASE(Test_VR_708)
     CheckErrors(*eval, expected_errors);
     CLEAR_ERRORS
 }
+
+
+BOOST_AUTO_TEST_CASE(Test_CheckTiming)
+{
+    CRef<CSeq_entry> entry = unit_test_util::BuildGoodNucProtSet();
+
+    STANDARD_SETUP
+
+    CValidator::TCheckTimes before;
+    CValidator::GetCheckTimes(before);
+
+    CValidator::EnableCheckTiming();
+    eval = validator.Validate(seh, options);
+    CValidator::EnableCheckTiming(false);
+
+    CValidator::TCheckTimes times;
+    CValidator::GetCheckTimes(times);
+    // both the nucleotide and the protein are checked
+    BOOST_CHECK_EQUAL(times["Bioseq: inst"].m_Calls,
+                      before["Bioseq: inst"].m_Calls + 2);
+    BOOST_CHECK(times["Feat: data"].m_Calls > before["Feat: data"].m_Calls);
+
+    // nothing is added when disabled
+    eval = validator.Validate(seh, options);
+    CValidator::TCheckTimes after;
+    CValidator::GetCheckTimes(after);
+    BOOST_CHECK_EQUAL(after["Bioseq: inst"].m_Calls,
+                      times["Bioseq: inst"].m_Calls);
+}
+
+
+static CRef<CSeq_loc> s_MakeOverlapInterval(TSeqPos from, TSeqPos to,
+                                            ENa_strand strand)
+{
+    CRef<CSeq_loc> loc(new CSeq_loc());
+    loc->SetInt().SetId().SetLocal().SetStr("good");
+    loc->SetInt().SetFrom(from);
+    loc->SetInt().SetTo(to);
+    if (strand != eNa_strand_unknown) {
+        loc->SetInt().SetStrand(strand);
+    }
+    return loc;
+}
+
+
+static CRef<CSeq_loc> s_MakeOverlapMix(TSeqPos from1, TSeqPos to1,
+                                       ENa_strand strand1,
+                                       TSeqPos from2, TSeqPos to2,
+                                       ENa_strand strand2)
+{
+    CRef<CSeq_loc> loc(new CSeq_loc());
+    loc->SetMix().Set().push_back(s_MakeOverlapInterval(from1, to1, strand1));
+    loc->SetMix().Set().push_back(s_MakeOverlapInterval(from2, to2, strand2));
+    return loc;
+}
+
+
+static void s_AddOverlapGene(CRef<CSeq_entry> entry, CRef<CSeq_loc> loc,
+                             const string& locus)
+{
+    CRef<CSeq_feat> feat(new CSeq_feat());
+    feat->SetData().SetGene().SetLocus(locus);
+    feat->SetLocation(*loc);
+    unit_test_util::AddFeat(feat, entry);
+}
+
+
+// Genes on all the strands, of one and several intervals; a few share
+// their locations, to check the ties
+static void s_AddOverlapGenes(CRef<CSeq_entry> entry)
+{
+    static const ENa_strand kStrands[] = {
+        eNa_strand_unknown, eNa_strand_plus, eNa_strand_minus,
+        eNa_strand_both, eNa_strand_both_rev, eNa_strand_other
+    };
+    const size_t kNumStrands = sizeof(kStrands) / sizeof(kStrands[0]);
+    for (size_t i = 0;  i < kNumStrands;  ++i) {
+        ENa_strand strand = kStrands[i];
+        s_AddOverlapGene(entry, s_MakeOverlapInterval(5, 24, strand), "b");
+        s_AddOverlapGene(entry, s_MakeOverlapInterval(5, 24, strand), "a");
+        s_AddOverlapGene(entry,
+            s_MakeOverlapInterval(30 + i, 40 + i, strand), "c");
+        s_AddOverlapGene(entry,
+            s_MakeOverlapInterval(12 + i, 12 + i, strand), "d");
+        if (strand == eNa_strand_minus) {
+            s_AddOverlapGene(entry,
+                s_MakeOverlapMix(40, 50, strand, 10, 20, strand), "e");
+        }
+        else {
+            s_AddOverlapGene(entry,
+                s_MakeOverlapMix(10, 20, strand, 40, 50, strand), "e");
+        }
+        s_AddOverlapGene(entry, s_MakeOverlapMix(
+            2 + i, 8, strand, 25, 35 + i, kStrands[(i + 1) % kNumStrands]),
+            "f");
+    }
+}
+
+
+// The features found by the validator cache are those and in the order
+// that sequence::GetOverlappingFeatures() finds
+static void s_CheckCachedOverlappingFeatures(CScope& scope)
+{
+    static const ENa_strand kStrands[] = {
+        eNa_strand_unknown, eNa_strand_plus, eNa_strand_minus,
+        eNa_strand_both, eNa_strand_other
+    };
+    static const sequence::EOverlapType kOverlapTypes[] = {
+        sequence::eOverlap_Simple, sequence::eOverlap_Contained,
+        sequence::eOverlap_Contains, sequence::eOverlap_Subset,
+        sequence::eOverlap_SubsetRev, sequence::eOverlap_CheckIntervals,
+        sequence::eOverlap_CheckIntRev, sequence::eOverlap_Interval
+    };
+
+    vector< CRef<CSeq_loc> > queries;
+    for (size_t s = 0;  s < sizeof(kStrands) / sizeof(kStrands[0]);  ++s) {
+        for (TSeqPos from = 0;  from < 60;  from += 4) {
+            queries.push_back(s_MakeOverlapInterval(from, from, kStrands[s]));
+            queries.push_back(s_MakeOverlapInterval(
+                from, min(from + 10, TSeqPos(59)), kStrands[s]));
+            queries.push_back(s_MakeOverlapInterval(
+                from, min(from + 25, TSeqPos(59)), kStrands[s]));
+        }
+        queries.push_back(s_MakeOverlapMix(
+            10, 20, kStrands[s], 40, 50, kStrands[s]));
+        queries.push_back(s_MakeOverlapMix(
+            40, 50, kStrands[s], 10, 20, kStrands[s]));
+    }
+
+    CCacheImpl cache;
+    for (size_t t = 0;  t < sizeof(kOverlapTypes) / sizeof(kOverlapTypes[0]);  ++t) {
+        ITERATE(vector< CRef<CSeq_loc> >, q, queries) {
+            sequence::TFeatScores expected;
+            sequence::GetOverlappingFeatures(**q,
+                CSeqFeatData::e_Gene, CSeqFeatData::eSubtype_gene,
+                kOverlapTypes[t], expected, scope);
+            sequence::TFeatScores found;
+            cache.GetOverlappingFeatures(**q,
+                CSeqFeatData::e_Gene, CSeqFeatData::eSubtype_gene,
+                kOverlapTypes[t], found, scope);
+
+            BOOST_REQUIRE_EQUAL(found.size(), expected.size());
+            for (size_t i = 0;  i < found.size();  ++i) {
+                BOOST_CHECK_EQUAL(found[i].first, expected[i].first);
+                BOOST_CHECK(found[i].second == expected[i].second);
+            }
+            CConstRef<CSeq_feat> best = cache.GetBestOverlappingFeat(**q,
+                CSeqFeatData::eSubtype_gene, kOverlapTypes[t], scope);
+            BOOST_CHECK(best == sequence::GetBestOverlappingFeat(**q,
+                CSeqFeatData::eSubtype_gene, kOverlapTypes[t], scope));
+            best = cache.GetBestOverlappingFeat(**q,
+                CSeqFeatData::e_Gene, kOverlapTypes[t], scope);
+            BOOST_CHECK(best == sequence::GetBestOverlappingFeat(**q,
+                CSeqFeatData::e_Gene, kOverlapTypes[t], scope));
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(Test_CacheOverlappingFeatures)
+{
+    CRef<CSeq_entry> entry = unit_test_util::BuildGoodSeq();
+    s_AddOverlapGenes(entry);
+
+    {{
+        STANDARD_SETUP
+        s_CheckCachedOverlappingFeatures(scope);
+    }}
+
+    // circular, with a gene across the origin the annotation index sees
+    // as covering the whole bioseq
+    entry->SetSeq().SetInst().SetTopology(CSeq_inst::eTopology_circular);
+    {{
+        STANDARD_SETUP
+        s_CheckCachedOverlappingFeatures(scope);
+    }}
+    s_AddOverlapGene(entry, s_MakeOverlapMix(
+        50, 59, eNa_strand_plus, 0, 5, eNa_strand_plus), "g");
+    {{
+        STANDARD_SETUP
+        s_CheckCachedOverlappingFeatures(scope);
+    }}
+}
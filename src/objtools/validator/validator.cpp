@@ -31,6 +31,8 @@
  */
 #include <ncbi_pch.hpp>
 #include <corelib/ncbistd.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbi_safe_static.hpp>
 #include <serial/serialbase.hpp>
 #include <objects/submit/Seq_submit.hpp>
 #include <objects/seq/Bioseq.hpp>
@@ -46,7 +48,6 @@
 #include <objtools/validator/validatorp.hpp>
 #include <objtools/validator/validerror_format.hpp>
 
-
 BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(objects)
 BEGIN_SCOPE(validator)
@@ -97,14 +98,6 @@ CConstRef<CValidError> CValidator::Validate
 (const CSeq_entry_Handle& seh,
  Uint4 options)
 {
-    static unsigned int num_e = 0, mult = 0;
-
-    num_e++;
-    if (num_e % 200 == 0) {
-        num_e = 0;
-        mult++;
-    }
-
     CRef<CValidError> errors(new CValidError(&*seh.GetCompleteSeq_entry()));
     CValidErrorFormat::SetSuppressionRules(seh, *errors);
     CValidError_imp imp(*m_ObjMgr, &(*errors), m_Taxon.get(), options);
@@ -288,6 +281,33 @@ void CValidator::SetProgressCallback(TProgressCallback callback, void* user_data
 }
 
 
+static CSafeStatic<CSectionTimes> s_CheckTimes;
+
+
+CSectionTimes& CValidator::x_GetCheckTimes(void)
+{
+    return s_CheckTimes.Get();
+}
+
+
+void CValidator::EnableCheckTiming(bool enable)
+{
+    s_CheckTimes->Enable(enable);
+}
+
+
+bool CValidator::IsCheckTimingEnabled(void)
+{
+    return s_CheckTimes->IsEnabled();
+}
+
+
+void CValidator::GetCheckTimes(TCheckTimes& times)
+{
+    s_CheckTimes->GetTimes(times);
+}
+
+
 bool CValidator::BadCharsInAuthorName(const string& str, bool allowcomma, bool allowperiod, bool last)
 {
     if (NStr::IsBlank(str)) {
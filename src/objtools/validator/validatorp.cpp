@@ -33,6 +33,7 @@
 #include <ncbi_pch.hpp>
 #include <corelib/ncbistd.hpp>
 #include <corelib/ncbistr.hpp>
+#include <corelib/ncbimtx.hpp>
 #include <corelib/ncbiapp.hpp>
 #include <objmgr/object_manager.hpp>
 
@@ -59,6 +60,10 @@
 #include <objects/seq/Seq_descr.hpp>
 #include <objects/seq/Pubdesc.hpp>
 #include <objects/seq/MolInfo.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_ext.hpp>
+#include <objects/seq/Delta_ext.hpp>
+#include <objects/seq/Delta_seq.hpp>
 #include <objects/seqfeat/BioSource.hpp>
 #include <objects/seqfeat/OrgMod.hpp>
 #include <objects/seqfeat/OrgName.hpp>
@@ -165,6 +170,7 @@ CValidError*     errs,
 Uint4            options) :
 m_ObjMgr(&objmgr),
 m_ErrRepository(errs),
+m_CheckTimes(CValidator::x_GetCheckTimes()),
 m_taxon(NULL)
 {
     x_Init(options);
@@ -178,17 +184,22 @@ ITaxon3*         taxon,
 Uint4            options) :
 m_ObjMgr(&objmgr),
 m_ErrRepository(errs),
+m_CheckTimes(CValidator::x_GetCheckTimes()),
 m_taxon(taxon)
 {
     x_Init(options);
 }
 
 
+// Guards the initialization of the shared source qualifier table
+DEFINE_STATIC_FAST_MUTEX(s_SourceQualTagsMutex);
+
 void CValidError_imp::x_Init(Uint4 options)
 {
     SetOptions(options);
     Reset();
 
+    CFastMutexGuard GUARD(s_SourceQualTagsMutex);
     if (m_SourceQualTags.get() == 0) {
         InitializeSourceQualTags();
     }
@@ -3713,6 +3724,351 @@ CCacheImpl::GetBioseqHandleFromLocation(
 }
 
 
+// Strands of a location as the annotation iterators see them
+// (CHandleRange::x_IncludesPlus() and x_IncludesMinus())
+enum EFeatRangeStrand {
+    fFeatRangeStrand_Plus  = 1,
+    fFeatRangeStrand_Minus = 2
+};
+
+static int s_GetFeatRangeStrands(ENa_strand strand)
+{
+    int strands = 0;
+    // anything but minus includes plus, 'other' too
+    if (strand != eNa_strand_minus) {
+        strands |= fFeatRangeStrand_Plus;
+    }
+    if (strand == eNa_strand_unknown  ||  strand == eNa_strand_minus  ||
+        strand == eNa_strand_both  ||  strand == eNa_strand_both_rev) {
+        strands |= fFeatRangeStrand_Minus;
+    }
+    return strands;
+}
+
+
+// The strand the annotation index keeps for a feature of one interval
+static ENa_strand s_GetFeatRangeStrand(int strands)
+{
+    switch (strands) {
+    case fFeatRangeStrand_Plus:
+        return eNa_strand_plus;
+    case fFeatRangeStrand_Minus:
+        return eNa_strand_minus;
+    default:
+        return eNa_strand_unknown;
+    }
+}
+
+
+// Intervals overlap only on the same strand, unless one of them is unknown
+// (CHandleRange::x_IntersectingStrands())
+static bool s_IntersectingStrands(ENa_strand strand1, ENa_strand strand2)
+{
+    return strand1 == eNa_strand_unknown  ||  strand2 == eNa_strand_unknown  ||
+        strand1 == strand2;
+}
+
+
+// Features of segmented bioseqs may come from the segments, these are
+// left to the annotation iterators
+static bool s_CanIndexFeatRanges(const CBioseq_Handle& bsh)
+{
+    if ( !bsh.IsSetInst_Repr() ) {
+        return false;
+    }
+    switch (bsh.GetInst_Repr()) {
+    case CSeq_inst::eRepr_seg:
+    case CSeq_inst::eRepr_ref:
+        return false;
+    case CSeq_inst::eRepr_delta:
+        if (bsh.IsSetInst_Ext()  &&  bsh.GetInst_Ext().IsDelta()) {
+            ITERATE(CDelta_ext::Tdata, seg, bsh.GetInst_Ext().GetDelta().Get()) {
+                if ((*seg)->IsLoc()) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    default:
+        return true;
+    }
+}
+
+
+// Same ordering as sequence::GetOverlappingFeatures() uses
+class COverlapScoreLess
+{
+public:
+    COverlapScoreLess(CScope* scope) : m_Scope(scope) {}
+
+    bool operator()(const TFeatScore& feat1, const TFeatScore& feat2) const
+    {
+        if (feat1.first != feat2.first) {
+            return feat1.first < feat2.first;
+        }
+        // genes at identical positions are ordered by label
+        const CSeq_feat& f1 = *feat1.second;
+        const CSeq_feat& f2 = *feat2.second;
+        if (Compare(f1.GetLocation(), f2.GetLocation(), m_Scope,
+                    fCompareOverlapping) == eSame  &&
+            f1.IsSetData()  &&  f1.GetData().IsGene()  &&
+            f2.IsSetData()  &&  f2.GetData().IsGene()) {
+            string label1, label2;
+            f1.GetData().GetGene().GetLabel(&label1);
+            f2.GetData().GetGene().GetLabel(&label2);
+            return label1 < label2;
+        }
+        return false;
+    }
+
+private:
+    CScope* m_Scope;
+};
+
+
+const CCacheImpl::SFeatRangeIndex&
+CCacheImpl::x_GetFeatRangeIndex(const SFeatKey& featKey)
+{
+    TFeatRangeCache::const_iterator find_iter = m_featRangeCache.find(featKey);
+    if (find_iter != m_featRangeCache.end()) {
+        return find_iter->second;
+    }
+
+    const TFeatValue& feats = GetFeatFromCache(featKey);
+    SFeatRangeIndex& index = m_featRangeCache[featKey];
+    for (size_t i = 0;  i < feats.size()  &&  !index.m_Irregular;  ++i) {
+        CRef<SFeatRange> range(new SFeatRange);
+        TSeqPos from = kInvalidSeqPos, to = 0;
+        range->m_Strands = 0;
+        range->m_Gaps = false;
+        // The annotation index gives the features with parts on other
+        // bioseqs, empty parts or intervals going back to the origin a
+        // range different from their extremes, leave them to sequence::
+        CSeq_id_Handle idh;
+        TSeqPos prev_from = kInvalidSeqPos;
+        ENa_strand prev_strand = eNa_strand_unknown;
+        for (CSeq_loc_CI loc_it(feats[i].GetLocation(),
+                                CSeq_loc_CI::eEmpty_Allow);
+             loc_it;  ++loc_it) {
+            if ( !loc_it.GetSeq_id_Handle() ) {
+                continue; // null
+            }
+            ENa_strand strand = loc_it.IsSetStrand() ?
+                loc_it.GetStrand() : eNa_strand_unknown;
+            TSeqRange r = loc_it.GetRange();
+            if (loc_it.IsEmpty()  ||  loc_it.IsInBond()  ||
+                loc_it.IsInEquivSet()  ||  r.Empty()  ||
+                (idh  &&  idh != loc_it.GetSeq_id_Handle())  ||
+                (prev_from != kInvalidSeqPos  &&  strand == prev_strand  &&
+                 (strand == eNa_strand_minus ?
+                  r.GetFrom() > prev_from : r.GetFrom() < prev_from))) {
+                index.m_Irregular = true;
+                break;
+            }
+            if ( idh ) {
+                range->m_Gaps = true;
+            }
+            idh = loc_it.GetSeq_id_Handle();
+            prev_from = r.GetFrom();
+            prev_strand = strand;
+            from = min(from, r.GetFrom());
+            to = max(to, r.GetTo());
+            range->m_Strands |= s_GetFeatRangeStrands(strand);
+        }
+        // the interval tree takes int coordinates
+        if ( !idh  ||  !featKey.bioseq_h.IsSynonym(idh)  ||
+             to > TSeqPos(kMax_Int) ) {
+            index.m_Irregular = true;
+            break;
+        }
+        range->m_Order = i;
+        range->m_Feat = feats[i];
+        index.m_Feats.Insert(CRange<int>(int(from), int(to)),
+                             CConstRef<CObject>(range));
+    }
+    if (index.m_Irregular) {
+        index.m_Feats.Clear();
+    }
+    return index;
+}
+
+
+void CCacheImpl::GetOverlappingFeatures(
+    const CSeq_loc& loc,
+    CSeqFeatData::E_Choice feat_type, CSeqFeatData::ESubtype feat_subtype,
+    EOverlapType overlap_type, TFeatScores& feats, CScope& scope)
+{
+    CBioseq_Handle bsh;
+    if (loc.IsInt()  ||  loc.IsPnt()  ||  loc.IsPacked_int()  ||
+        loc.IsMix()  ||  loc.IsPacked_pnt()) {
+        const CSeq_id* id = loc.GetId();
+        if (id) {
+            bsh = scope.GetBioseqHandle(*id);
+        }
+    }
+    TSeqPos from = 0, to = 0;
+    if (bsh) {
+        from = loc.GetStart(eExtreme_Positional);
+        to = loc.GetStop(eExtreme_Positional);
+    }
+
+    // the annotation selector takes the type from the subtype
+    SFeatKey key(feat_type, feat_subtype, bsh);
+    if (feat_subtype == CSeqFeatData::eSubtype_any) {
+        key.feat_subtype = kAnyFeatSubtype;
+        if (feat_type == CSeqFeatData::e_not_set) {
+            key.feat_type = kAnyFeatType;
+        }
+    }
+    else {
+        key.feat_type = CSeqFeatData::GetTypeFromSubtype(feat_subtype);
+    }
+
+    const SFeatRangeIndex* index = 0;
+    if (bsh  &&  from <= to  &&  s_CanIndexFeatRanges(bsh)) {
+        index = &x_GetFeatRangeIndex(key);
+        if (index->m_Irregular) {
+            index = 0;
+        }
+    }
+    if ( !index ) {
+        sequence::GetOverlappingFeatures(loc, feat_type, feat_subtype,
+                                         overlap_type, feats, scope);
+        return;
+    }
+
+    // These types are tested with the query location first, and the
+    // annotation iterator would require the intervals to overlap
+    bool revert_locations = false;
+    switch (overlap_type) {
+    case eOverlap_Simple:
+    case eOverlap_Contained:
+    case eOverlap_Contains:
+        break;
+    default:
+        revert_locations = true;
+        break;
+    }
+
+    TSeqPos circular_length = kInvalidSeqPos;
+    if (bsh.IsSetInst_Topology()  &&
+        bsh.GetInst_Topology() == CSeq_inst::eTopology_circular) {
+        circular_length = bsh.GetBioseqLength();
+    }
+    ENa_strand strand = loc.IsSetStrand() ? loc.GetStrand() : eNa_strand_unknown;
+    int strands = s_GetFeatRangeStrands(strand);
+
+    // Collect the features with the total range overlapping [from, to]
+    // (order in the feature cache, feature)
+    typedef pair<size_t, const SFeatRange*> TCandidate;
+    vector<TCandidate> candidates;
+    CRange<int> query(int(min(from, TSeqPos(kMax_Int))),
+                      int(min(to, TSeqPos(kMax_Int))));
+    for (CIntervalTree::const_iterator it =
+             index->m_Feats.IntervalsOverlapping(query);  it;  ++it) {
+        const SFeatRange& feat =
+            static_cast<const SFeatRange&>(*it.GetValue());
+        if ( !revert_locations ) {
+            if ((feat.m_Strands & strands) == 0) {
+                continue;
+            }
+        }
+        else if ( !feat.m_Gaps ) {
+            if ( !s_IntersectingStrands(strand,
+                                        s_GetFeatRangeStrand(feat.m_Strands)) ) {
+                continue;
+            }
+        }
+        else {
+            bool overlap = false;
+            for (CSeq_loc_CI loc_it(feat.m_Feat.GetLocation());
+                 loc_it  &&  !overlap;  ++loc_it) {
+                TSeqRange r = loc_it.GetRange();
+                overlap = r.GetFrom() <= to  &&  r.GetTo() >= from  &&
+                    s_IntersectingStrands(strand, loc_it.IsSetStrand() ?
+                        loc_it.GetStrand() : eNa_strand_unknown);
+            }
+            if ( !overlap ) {
+                continue;
+            }
+        }
+        candidates.push_back(TCandidate(feat.m_Order, &feat));
+    }
+    // the scores are sorted stably, keep the order of the feature iterator
+    sort(candidates.begin(), candidates.end());
+
+    try {
+        ITERATE(vector<TCandidate>, it, candidates) {
+            const CMappedFeat& feat = it->second->m_Feat;
+            const CSeq_loc& feat_loc = feat.GetOriginalFeature().GetLocation();
+            try {
+                Int8 diff = revert_locations ?
+                    TestForOverlap64(loc, feat_loc, overlap_type,
+                                     circular_length, &scope) :
+                    TestForOverlap64(feat_loc, loc, overlap_type,
+                                     circular_length, &scope);
+                if (diff < 0) {
+                    continue;
+                }
+                if (overlap_type == eOverlap_Contained) {
+                    ECompare cmp = Compare(feat.GetLocation(), loc, &scope,
+                                           fCompareOverlapping);
+                    if (cmp != eContains  &&  cmp != eSame) {
+                        continue;
+                    }
+                }
+                feats.push_back(
+                    TFeatScore(diff, ConstRef(&feat.GetMappedFeature())));
+            }
+            catch (CObjmgrUtilException&) {
+                continue;
+            }
+        }
+    }
+    catch (exception&) {
+    }
+
+    stable_sort(feats.begin(), feats.end(), COverlapScoreLess(&scope));
+}
+
+
+CConstRef<CSeq_feat> CCacheImpl::GetBestOverlappingFeat(
+    const CSeq_loc& loc, CSeqFeatData::ESubtype feat_subtype,
+    EOverlapType overlap_type, CScope& scope)
+{
+    TFeatScores feats;
+    GetOverlappingFeatures(loc,
+        CSeqFeatData::GetTypeFromSubtype(feat_subtype), feat_subtype,
+        overlap_type, feats, scope);
+    if (feats.empty()) {
+        return CConstRef<CSeq_feat>();
+    }
+    return feats.front().second;
+}
+
+
+CConstRef<CSeq_feat> CCacheImpl::GetBestOverlappingFeat(
+    const CSeq_loc& loc, CSeqFeatData::E_Choice feat_type,
+    EOverlapType overlap_type, CScope& scope)
+{
+    TFeatScores feats;
+    GetOverlappingFeatures(loc, feat_type, CSeqFeatData::eSubtype_any,
+                           overlap_type, feats, scope);
+    if (feats.empty()) {
+        return CConstRef<CSeq_feat>();
+    }
+    return feats.front().second;
+}
+
+
+CConstRef<CSeq_feat> CCacheImpl::GetOverlappingOperon(
+    const CSeq_loc& loc, CScope& scope)
+{
+    return GetBestOverlappingFeat(loc, CSeqFeatData::eSubtype_operon,
+                                  eOverlap_Contained, scope);
+}
+
+
 CRef<feature::CFeatTree> CGeneCache::GetFeatTreeFromCache(CBioseq_Handle bsh)
 {
     TSeqTreeMap::iterator smit = m_SeqTreeMap.find(bsh);
@@ -226,16 +226,30 @@ void CValidError_bioseq::ValidateBioseq (
             m_AllFeatIt = NULL;
         }
         m_mRNACDSIndex.SetBioseq(m_AllFeatIt, &m_CurrentHandle.GetScope());
-        ValidateSeqIds(seq);
-        ValidateInst(seq);
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: seq-ids");
+            ValidateSeqIds(seq);
+        }}
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: inst");
+            ValidateInst(seq);
+        }}
         ValidateBioseqContext(seq);
-        ValidatemRNAGene(seq);
-        ValidateHistory(seq);
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: mRNA gene");
+            ValidatemRNAGene(seq);
+        }}
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: history");
+            ValidateHistory(seq);
+        }}
         FOR_EACH_ANNOT_ON_BIOSEQ (annot, seq) {
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: annots");
             m_AnnotValidator.ValidateSeqAnnot(**annot);
             m_AnnotValidator.ValidateSeqAnnotContext(**annot, seq);
         }
         if (seq.IsSetDescr()) {
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: descriptors");
             if (m_CurrentHandle) {
                 CSeq_entry_Handle ctx = m_CurrentHandle.GetSeq_entry_Handle();
                 if (ctx) {
@@ -1179,24 +1193,45 @@ void CValidError_bioseq::ValidateBioseqContext(
 
             // Check that gene on non-segmented sequence does not have
             // multiple intervals
-            ValidateMultiIntervalGene(seq);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: multi-interval genes");
+                ValidateMultiIntervalGene(seq);
+            }}
 
-            ValidateSeqFeatContext(seq);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: feature context");
+                ValidateSeqFeatContext(seq);
+            }}
 
             // Check for duplicate features and overlapping peptide features.
-            ValidateDupOrOverlapFeats(seq);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: duplicate/overlapping features");
+                ValidateDupOrOverlapFeats(seq);
+            }}
 
             // Check for introns within introns.
-            ValidateTwintrons(seq);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: twintrons");
+                ValidateTwintrons(seq);
+            }}
 
             // check for equivalent source features
-            x_ValidateSourceFeatures (bsh);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: source features");
+                x_ValidateSourceFeatures (bsh);
+            }}
 
             // check for equivalen pub features
-            x_ValidatePubFeatures (bsh);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: pub features");
+                x_ValidatePubFeatures (bsh);
+            }}
 
             // Check for colliding genes
-            ValidateCollidingGenes(seq);
+            {{
+                CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: colliding genes");
+                ValidateCollidingGenes(seq);
+            }}
 
             // Detect absence of BioProject DBLink for complete bacterial genomes
             ValidateCompleteGenome(seq);
@@ -1212,7 +1247,10 @@ void CValidError_bioseq::ValidateBioseqContext(
         m_unknown_count = 0;
 
         // Validate descriptors that affect this bioseq
-        ValidateSeqDescContext(seq);
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Bioseq: descriptor context");
+            ValidateSeqDescContext(seq);
+        }}
 
         if (m_dblink_count > 1) {
             PostErr(eDiag_Critical, eErr_SEQ_DESCR_DBLinkProblem,
@@ -4616,7 +4654,7 @@ static bool s_LocIntervalsCoverSegs (const CSeq_loc& loc)
 }
 
 
-bool s_HasMobileElementForInterval(TSeqPos from, TSeqPos to, CBioseq_Handle bsh)
+bool s_HasMobileElementForInterval(TSeqPos from, TSeqPos to, CBioseq_Handle bsh, CCacheImpl& cache)
 {
     CRef<CSeq_loc> loc(new CSeq_loc());
     loc->SetInt().SetId().Assign(*(bsh.GetSeqId()));
@@ -4632,7 +4670,7 @@ bool s_HasMobileElementForInterval(TSeqPos from, TSeqPos to, CBioseq_Handle bsh)
     rev_loc->SetInt().SetStrand(eNa_strand_minus);
 
     TFeatScores mobile_elements;
-    GetOverlappingFeatures(*loc, CSeqFeatData::e_Imp,
+    cache.GetOverlappingFeatures(*loc, CSeqFeatData::e_Imp,
         CSeqFeatData::eSubtype_mobile_element, eOverlap_Contained, mobile_elements, bsh.GetScope());
     ITERATE(TFeatScores, m, mobile_elements) {
         if (m->second->GetLocation().Compare(*loc) == 0 || m->second->GetLocation().Compare(*rev_loc) == 0) {
@@ -4640,7 +4678,7 @@ bool s_HasMobileElementForInterval(TSeqPos from, TSeqPos to, CBioseq_Handle bsh)
         }
     }
     mobile_elements.clear();
-    GetOverlappingFeatures(*rev_loc, CSeqFeatData::e_Imp,
+    cache.GetOverlappingFeatures(*rev_loc, CSeqFeatData::e_Imp,
         CSeqFeatData::eSubtype_mobile_element, eOverlap_Contained, mobile_elements, bsh.GetScope());
     ITERATE(TFeatScores, m, mobile_elements) {
         if (m->second->GetLocation().Compare(*loc) == 0 || m->second->GetLocation().Compare(*rev_loc) == 0) {
@@ -4652,7 +4690,7 @@ bool s_HasMobileElementForInterval(TSeqPos from, TSeqPos to, CBioseq_Handle bsh)
 }
 
 
-bool s_AllIntervalGapsAreMobileElements(const CSeq_loc& loc, CBioseq_Handle bsh)
+bool s_AllIntervalGapsAreMobileElements(const CSeq_loc& loc, CBioseq_Handle bsh, CCacheImpl& cache)
 {
     CSeq_loc_CI si(loc);
     if (!si) {
@@ -4677,7 +4715,7 @@ bool s_AllIntervalGapsAreMobileElements(const CSeq_loc& loc, CBioseq_Handle bsh)
             if (gap_end > 0) {
                 gap_end--;
             }
-            if (!s_HasMobileElementForInterval(gap_start, gap_end, bsh)) {
+            if (!s_HasMobileElementForInterval(gap_start, gap_end, bsh, cache)) {
                 return false;
             }
         }
@@ -4706,7 +4744,7 @@ void CValidError_bioseq::ValidateMultiIntervalGene(const CBioseq& seq)
                 continue;
             }
 
-            if (s_AllIntervalGapsAreMobileElements(loc, m_CurrentHandle)) {
+            if (s_AllIntervalGapsAreMobileElements(loc, m_CurrentHandle, GetCache())) {
                 // ignore, "space between" is a mobile element
                 continue;
             }
@@ -4995,7 +5033,7 @@ void CValidError_bioseq::x_ReportGeneOverlapError(const CSeq_feat& feat, const s
 
     } else if (feat.GetData().IsRna()) {
 
-        if (GetOverlappingOperon(feat.GetLocation(), *m_Scope)) {
+        if (GetCache().GetOverlappingOperon(feat.GetLocation(), *m_Scope)) {
             return;
         }
 
@@ -5065,7 +5103,7 @@ void CValidError_bioseq::ValidateBadGeneOverlap(const CSeq_feat& feat)
 
     const CSeq_loc& loc = feat.GetLocation();
 
-    CConstRef<CSeq_feat> gene = GetBestOverlappingFeat(loc, CSeqFeatData::eSubtype_gene, eOverlap_Simple, *m_Scope);
+    CConstRef<CSeq_feat> gene = GetCache().GetBestOverlappingFeat(loc, CSeqFeatData::eSubtype_gene, eOverlap_Simple, *m_Scope);
     if (! gene) return;
     if (TestForOverlapEx(gene->GetLocation(), feat.GetLocation(), eOverlap_Contained, m_Scope) < 0) {
 
@@ -5315,7 +5353,7 @@ bool CValidError_bioseq::x_IsSameAsCDS(
         return false;
     }
 
-    CConstRef<CSeq_feat> cds = GetBestOverlappingFeat(
+    CConstRef<CSeq_feat> cds = GetCache().GetBestOverlappingFeat(
             feat.GetLocation(),
             CSeqFeatData::e_Cdregion,
             overlap_type,
@@ -5369,7 +5407,7 @@ bool CValidError_bioseq::x_MatchesOverlappingFeaturePartial (const CMappedFeat&
         }
         if (!rval && look_for_gene) {
             TFeatScores genes;
-            GetOverlappingFeatures (feat.GetLocation(), CSeqFeatData::e_Gene,
+            GetCache().GetOverlappingFeatures (feat.GetLocation(), CSeqFeatData::e_Gene,
                 CSeqFeatData::eSubtype_gene, eOverlap_Contains, genes, *m_Scope);
             ITERATE (TFeatScores, s, genes) {
                 const CSeq_loc& gene_loc = s->second->GetLocation();
@@ -5384,7 +5422,7 @@ bool CValidError_bioseq::x_MatchesOverlappingFeaturePartial (const CMappedFeat&
     } else if (feat.GetData().IsCdregion()) {
         // coding region is ok if same as mRNA AND partial at splice site or gap
         TFeatScores mRNAs;
-        GetOverlappingFeatures (feat.GetLocation(), CSeqFeatData::e_Rna,
+        GetCache().GetOverlappingFeatures (feat.GetLocation(), CSeqFeatData::e_Rna,
             CSeqFeatData::eSubtype_mRNA, eOverlap_CheckIntervals, mRNAs, *m_Scope);
         ITERATE (TFeatScores, s, mRNAs) {
             const CSeq_loc& mrna_loc = s->second->GetLocation();
@@ -5399,7 +5437,7 @@ bool CValidError_bioseq::x_MatchesOverlappingFeaturePartial (const CMappedFeat&
     } else if (feat.GetData().GetSubtype() == CSeqFeatData::eSubtype_exon) {
         // exon is ok if its partialness and endpoint matches the mRNA endpoint
         TFeatScores mRNAs;
-        GetOverlappingFeatures (feat.GetLocation(), CSeqFeatData::e_Rna,
+        GetCache().GetOverlappingFeatures (feat.GetLocation(), CSeqFeatData::e_Rna,
             CSeqFeatData::eSubtype_mRNA, eOverlap_CheckIntRev, mRNAs, *m_Scope);
         ITERATE (TFeatScores, s, mRNAs) {
             const CSeq_loc& mrna_loc = s->second->GetLocation();
@@ -5661,7 +5699,7 @@ void CValidError_bioseq::x_ValidateCodingRegionParentPartialness(const CSeq_feat
     CConstRef<CSeq_feat> mrna = GetmRNAforCDS(cds, *m_Scope);
     if (mrna) {
         TFeatScores contained_mrna;
-        GetOverlappingFeatures(gene->GetLocation(), CSeqFeatData::e_Rna,
+        GetCache().GetOverlappingFeatures(gene->GetLocation(), CSeqFeatData::e_Rna,
             CSeqFeatData::eSubtype_cdregion, eOverlap_Contained, contained_mrna, *m_Scope);
         if (contained_mrna.size() == 1) {
             // messy for alternate splicing, so only check if there is only one
@@ -8476,7 +8514,7 @@ void CValidError_bioseq::ValidateSeqDescContext(const CBioseq& seq)
                     if (seq.IsAa()) {
                         CConstRef<CSeq_feat> cds = m_Imp.GetCDSGivenProduct(seq);
                         if (cds) {
-                            CConstRef<CSeq_feat> src_f = GetBestOverlappingFeat(
+                            CConstRef<CSeq_feat> src_f = GetCache().GetBestOverlappingFeat(
                                 cds->GetLocation(),
                                 CSeqFeatData::eSubtype_biosrc,
                                 eOverlap_Contained,
@@ -33,6 +33,7 @@
 #include <ncbi_pch.hpp>
 #include <corelib/ncbistd.hpp>
 #include <corelib/ncbistr.hpp>
+#include <corelib/ncbimtx.hpp>
 #include <objtools/validator/validatorp.hpp>
 #include <objtools/validator/utilities.hpp>
 #include <objtools/format/items/gene_finder.hpp>
@@ -220,6 +221,7 @@ void CValidError_feat::ValidateSeqFeat(
         }
 
         if (m_Scope) {
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: seq-loc and product");
             CBioseq_Handle bsh = GetCache().GetBioseqHandleFromLocation(m_Scope, feat.GetLocation(), m_Imp.GetTSE_Handle());
             m_Imp.ValidateSeqLoc(feat.GetLocation(), bsh, 
                                  (feat.GetData().IsGene() || !m_Imp.IsGpipe()),
@@ -233,22 +235,34 @@ void CValidError_feat::ValidateSeqFeat(
                 }
             }
         }
-        x_ValidateSeqFeatLoc(feat);
-    
-        ValidateFeatPartialness(feat);
-    
-        ValidateExcept(feat);
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: location");
+            x_ValidateSeqFeatLoc(feat);
+        }}
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: partialness");
+            ValidateFeatPartialness(feat);
+        }}
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: exceptions");
+            ValidateExcept(feat);
+        }}
 
         if (feat.IsSetXref()) {
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: xrefs");
             FOR_EACH_SEQFEATXREF_ON_SEQFEAT (it, feat) {
                 ValidateSeqFeatXref (**it, feat);
             }
         }
 
-
-        ValidateSeqFeatData(feat.GetData(), feat);
-  
-        ValidateBothStrands (feat);
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: data");
+            ValidateSeqFeatData(feat.GetData(), feat);
+        }}
+        {{
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: both strands");
+            ValidateBothStrands (feat);
+        }}
     
         if (feat.CanGetDbxref ()) {
             m_Imp.ValidateDbxref (feat.GetDbxref (), feat);
@@ -268,11 +282,15 @@ void CValidError_feat::ValidateSeqFeat(
         }
         */
 
-        FOR_EACH_GBQUAL_ON_FEATURE (it, feat) {
-            x_ValidateGbQual(**it, feat);
+        if (feat.IsSetQual()) {
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: qualifiers");
+            FOR_EACH_GBQUAL_ON_FEATURE (it, feat) {
+                x_ValidateGbQual(**it, feat);
+            }
         }
 
         if (feat.IsSetExt()) {
+            CSectionTimer timer(m_Imp.GetCheckTimes(), "Feat: ext user object");
             ValidateExtUserObject (feat.GetExt(), feat);
         }
 
@@ -1965,7 +1983,7 @@ void CValidError_feat::ValidateIntron (
 
     // suppress if contained by rRNA - different consensus splice site
     TFeatScores scores;
-    GetOverlappingFeatures(loc,
+    GetCache().GetOverlappingFeatures(loc,
                            CSeqFeatData::e_Rna,
                            CSeqFeatData::eSubtype_rRNA,
                            eOverlap_Contained,
@@ -1976,7 +1994,7 @@ void CValidError_feat::ValidateIntron (
 
     // suppress if contained by tRNA - different consensus splice site
     scores.clear();
-    GetOverlappingFeatures(loc,
+    GetCache().GetOverlappingFeatures(loc,
                            CSeqFeatData::e_Rna,
                            CSeqFeatData::eSubtype_tRNA,
                            eOverlap_Contained,
@@ -2622,7 +2640,7 @@ void CValidError_feat::ValidateSpliceExon(const CSeq_feat& feat, const CBioseq_H
 
     bool overlap_feat_exists = false;
     // Locate overlapping mRNA feature
-    CConstRef<CSeq_feat> mrna = GetBestOverlappingFeat(
+    CConstRef<CSeq_feat> mrna = GetCache().GetBestOverlappingFeat(
         loc,
         CSeqFeatData::eSubtype_mRNA,
         eOverlap_Contained,
@@ -2637,7 +2655,7 @@ void CValidError_feat::ValidateSpliceExon(const CSeq_feat& feat, const CBioseq_H
     }
     else {
         // Locate overlapping gene feature.
-        CConstRef<CSeq_feat> gene = GetBestOverlappingFeat(
+        CConstRef<CSeq_feat> gene = GetCache().GetBestOverlappingFeat(
             loc,
             CSeqFeatData::eSubtype_gene,
             eOverlap_Contained,
@@ -2724,7 +2742,7 @@ void CValidError_feat::ValidateSpliceMrna(const CSeq_feat& feat, const CBioseq_H
     bool ignore_mrna_partial3 = false;
 
     // Retrieve overlapping cdregion
-    CConstRef<CSeq_feat> cds = GetBestOverlappingFeat(
+    CConstRef<CSeq_feat> cds = GetCache().GetBestOverlappingFeat(
         loc,
         CSeqFeatData::eSubtype_cdregion,
         eOverlap_Contains,
@@ -3293,10 +3311,14 @@ void CValidError_feat::x_ReportUninformativeNames(const CProt_ref& prot, const C
 }
 
 
+// The missing EC number files are reported once per process
+DEFINE_STATIC_FAST_MUTEX(s_ECNumFileStatusMutex);
+
 void CValidError_feat::x_ReportECNumFileStatus(const CSeq_feat& feat)
 {
     static bool file_status_reported = false;
 
+    CFastMutexGuard GUARD(s_ECNumFileStatusMutex);
     if (!file_status_reported) {
         if (CProt_ref::GetECNumAmbiguousStatus() == CProt_ref::eECFile_not_found) {
             PostErr (eDiag_Warning, eErr_SEQ_FEAT_EcNumberDataMissing,
@@ -3548,7 +3570,7 @@ void CValidError_feat::ValidateRna(const CRNA_ref& rna, const CSeq_feat& feat)
 
     if ( rna_type == CRNA_ref::eType_tRNA ) {
         TFeatScores scores;
-        GetOverlappingFeatures(feat.GetLocation(),
+        GetCache().GetOverlappingFeatures(feat.GetLocation(),
                                CSeqFeatData::e_Rna,
                                CSeqFeatData::eSubtype_rRNA,
                                eOverlap_Interval,
@@ -4168,7 +4190,7 @@ void CValidError_feat::ValidateImp(
         }
         if (feat.IsSetComment() && ! NStr::IsBlank (feat.GetComment())) {
             if (NStr::FindWord(feat.GetComment(), "cspA") != NPOS) {
-                CConstRef<CSeq_feat> cds = GetBestOverlappingFeat(feat.GetLocation(), CSeqFeatData::eSubtype_cdregion, eOverlap_Simple, *m_Scope);
+                CConstRef<CSeq_feat> cds = GetCache().GetBestOverlappingFeat(feat.GetLocation(), CSeqFeatData::eSubtype_cdregion, eOverlap_Simple, *m_Scope);
                 if (cds) {
                     string content_label;
                     feature::GetLabel(*cds, &content_label, feature::fFGL_Content, m_Scope);
@@ -4213,7 +4235,7 @@ void CValidError_feat::ValidateImp(
     case CSeqFeatData::eSubtype_transit_peptide:
         if (m_Imp.IsEmbl() || m_Imp.IsDdbj()) {
             const CSeq_loc& loc = feat.GetLocation();
-            CConstRef<CSeq_feat> cds = GetOverlappingCDS(loc, *m_Scope);
+            CConstRef<CSeq_feat> cds = GetCache().GetBestOverlappingFeat(loc, CSeqFeatData::eSubtype_cdregion, eOverlap_Contained, *m_Scope);
             PostErr(!cds ? eDiag_Error : eDiag_Warning, eErr_SEQ_FEAT_PeptideFeatureLacksCDS,
                 "sig/mat/transit_peptide feature cannot be associated with a "
                 "protein product of a coding region feature", feat);
@@ -4227,7 +4249,7 @@ void CValidError_feat::ValidateImp(
     case CSeqFeatData::eSubtype_preprotein:
         if (m_Imp.IsEmbl() || m_Imp.IsDdbj()) {
             const CSeq_loc& loc = feat.GetLocation();
-            CConstRef<CSeq_feat> cds = GetOverlappingCDS(loc, *m_Scope);
+            CConstRef<CSeq_feat> cds = GetCache().GetBestOverlappingFeat(loc, CSeqFeatData::eSubtype_cdregion, eOverlap_Contained, *m_Scope);
             PostErr(!cds ? eDiag_Error : eDiag_Warning, eErr_SEQ_FEAT_PeptideFeatureLacksCDS,
                 "Pre/pro protein feature cannot be associated with a "
                 "protein product of a coding region feature", feat);
@@ -5354,7 +5376,7 @@ void CValidError_feat::ValidatePeptideOnCodonBoundry
 {
     const CSeq_loc& loc = feat.GetLocation();
 
-    CConstRef<CSeq_feat> cds = GetOverlappingCDS(loc, *m_Scope);
+    CConstRef<CSeq_feat> cds = GetCache().GetBestOverlappingFeat(loc, CSeqFeatData::eSubtype_cdregion, eOverlap_Contained, *m_Scope);
     if ( !cds ) {
         return;
     }
@@ -6148,7 +6170,7 @@ void CValidError_feat::ValidateBadMRNAOverlap(const CSeq_feat& feat)
 {
     const CSeq_loc& loc = feat.GetLocation();
 
-    CConstRef<CSeq_feat> mrna = GetBestOverlappingFeat(
+    CConstRef<CSeq_feat> mrna = GetCache().GetBestOverlappingFeat(
         loc,
         CSeqFeatData::eSubtype_mRNA,
         eOverlap_Simple,
@@ -6157,7 +6179,7 @@ void CValidError_feat::ValidateBadMRNAOverlap(const CSeq_feat& feat)
         return;
     }
 
-    mrna = GetBestOverlappingFeat(
+    mrna = GetCache().GetBestOverlappingFeat(
         loc,
         CSeqFeatData::eSubtype_mRNA,
         eOverlap_CheckIntRev,
@@ -6166,7 +6188,7 @@ void CValidError_feat::ValidateBadMRNAOverlap(const CSeq_feat& feat)
         return;
     }
 
-    mrna = GetBestOverlappingFeat(
+    mrna = GetCache().GetBestOverlappingFeat(
         loc,
         CSeqFeatData::eSubtype_mRNA,
         eOverlap_Interval,
@@ -6187,7 +6209,7 @@ void CValidError_feat::ValidateBadMRNAOverlap(const CSeq_feat& feat)
         err_type = eErr_SEQ_FEAT_PseudoCDSmRNArange;
     }
 
-    mrna = GetBestOverlappingFeat(
+    mrna = GetCache().GetBestOverlappingFeat(
         loc,
         CSeqFeatData::eSubtype_mRNA,
         eOverlap_SubsetRev,
@@ -8021,7 +8043,7 @@ void CValidError_feat::ValidateOperon(const CSeq_feat& gene)
     }
 
     CConstRef<CSeq_feat> operon = 
-        GetOverlappingOperon(gene.GetLocation(), *m_Scope);
+        GetCache().GetOverlappingOperon(gene.GetLocation(), *m_Scope);
     if ( !operon  ||  !operon->CanGetQual() ) {
         return;
     }
@@ -8049,7 +8071,7 @@ void CValidError_feat::ValidateGeneCdsPair(const CSeq_feat& gene)
     const CSeq_loc& gene_loc = gene.GetLocation();
 
     TFeatScores scores;
-    GetOverlappingFeatures(gene_loc,
+    GetCache().GetOverlappingFeatures(gene_loc,
                            CSeqFeatData::e_Cdregion,
                            CSeqFeatData::eSubtype_cdregion,
                            eOverlap_Interval,
@@ -8057,7 +8079,7 @@ void CValidError_feat::ValidateGeneCdsPair(const CSeq_feat& gene)
 
     if (scores.empty()) { // There is no CDRegion
 
-        GetOverlappingFeatures(gene_loc,
+        GetCache().GetOverlappingFeatures(gene_loc,
                                CSeqFeatData::e_not_set,
                                CSeqFeatData::eSubtype_3UTR,
                                eOverlap_Interval,
@@ -8066,7 +8088,7 @@ void CValidError_feat::ValidateGeneCdsPair(const CSeq_feat& gene)
         if (!scores.empty()) { // 3UTR is present, check for 5UTR
 
             scores.clear();
-            GetOverlappingFeatures(gene_loc,
+            GetCache().GetOverlappingFeatures(gene_loc,
                                    CSeqFeatData::e_not_set,
                                    CSeqFeatData::eSubtype_5UTR,
                                    eOverlap_Interval,
@@ -170,6 +170,14 @@ CTraversalMerger::CNodeLabeler::x_AppendDirectNodeLabel( CRef<CTraversalNode> no
     // because it will be added recursively elsewhere
 
     m_Out_result += "[";
+    ITERATE( CTraversalNode::TUserCallVec, skip_user_call_iter, node->GetSkipUserCalls() ) {
+        // we don't care if the last one has an unnecessary comma
+        m_Out_result += (*skip_user_call_iter)->GetUserFuncName() + ",";
+        const CTraversalNode::TNodeVec &node_vec = (*skip_user_call_iter)->GetExtraArgNodes();
+        copy( node_vec.begin(), node_vec.end(), 
+            inserter(m_DependencyNodes, m_DependencyNodes.begin()) );
+    }
+    m_Out_result += "][";
     ITERATE( CTraversalNode::TUserCallVec, pre_user_call_iter, node->GetPreCalleesUserCalls() ) {
         // we don't care if the last one has an unnecessary comma
         m_Out_result += (*pre_user_call_iter)->GetUserFuncName() + ",";
@@ -207,6 +207,21 @@ void CTraversalNode::GenerateCode( const string &func_class_name, CNcbiOstream&
     traversal_output_file << endl;
     traversal_output_file << "{ // type " << GetTypeAsString() << endl;
 
+    // generate calls which may skip this node
+    ITERATE( TUserCallVec, skip_iter, m_SkipUserCalls ) {
+        traversal_output_file << "  if( " << (*skip_iter)->GetUserFuncName() << "( " << ( x_IsSeqFeat() ? "arg0_raw" : "arg0" );
+        ITERATE( CTraversalNode::TNodeVec, extra_arg_iter, (*skip_iter)->GetExtraArgNodes() ) {
+            _ASSERT( (*extra_arg_iter)->GetDoStoreArg() );
+            traversal_output_file << ", *" << (*extra_arg_iter)->GetStoredArgVariable();
+        }
+        ITERATE( vector<string>, constant_arg_iter, (*skip_iter)->GetConstantArgs() ) {
+            traversal_output_file << ", " << *constant_arg_iter;
+        }
+        traversal_output_file << " ) ) {" << endl;
+        traversal_output_file << "    return;" << endl;
+        traversal_output_file << "  }" << endl;
+    }
+
     // seq-feat functions require a little extra at the top
     if( x_IsSeqFeat() ) {
         traversal_output_file << "  CRef<CSeq_feat> raw_ref( &arg0_raw );" << endl;
@@ -467,6 +482,11 @@ void CTraversalNode::AddPostCalleesUserCall( CRef<CUserCall> user_call )
     m_PostCalleesUserCalls.push_back( user_call );
 }
 
+void CTraversalNode::AddSkipUserCall( CRef<CUserCall> user_call )
+{
+    m_SkipUserCalls.push_back( user_call );
+}
+
 void CTraversalNode::RemoveXFromFuncName(void)
 {
     if( NStr::StartsWith(m_FuncName, "x_") ) {
@@ -535,6 +555,7 @@ void CTraversalNode::Clear(void)
     // no user calls
     m_PreCalleesUserCalls.clear();
     m_PostCalleesUserCalls.clear();
+    m_SkipUserCalls.clear();
 
     // No one should depend on our value now
     m_ReferencingUserCalls.clear();
@@ -658,6 +679,7 @@ CRef<CTraversalNode> CTraversalNode::x_CloneWithoutCallers( const string &var_na
     // This function should only be called before user calls are added
     _ASSERT(m_PreCalleesUserCalls.empty());
     _ASSERT(m_PostCalleesUserCalls.empty());
+    _ASSERT(m_SkipUserCalls.empty());
     _ASSERT(m_ReferencingUserCalls.empty());
     _ASSERT(! m_DoStoreArg);
 
@@ -152,6 +152,7 @@ public:
     bool IsTemplate(void) const { return m_IsTemplate; }
     const TUserCallVec &GetPostCalleesUserCalls() const { return m_PostCalleesUserCalls; }
     const TUserCallVec &GetPreCalleesUserCalls() const { return m_PreCalleesUserCalls; }
+    const TUserCallVec &GetSkipUserCalls() const { return m_SkipUserCalls; }
     
     const string GetStoredArgVariable(void) const { return ( m_DoStoreArg ? "m_LastArg_" + m_FuncName : kEmptyStr); };
 
@@ -160,6 +161,7 @@ public:
 
     void AddPreCalleesUserCall( CRef<CUserCall> user_call );
     void AddPostCalleesUserCall( CRef<CUserCall> user_call );
+    void AddSkipUserCall( CRef<CUserCall> user_call );
 
     void RemoveXFromFuncName(void);
 
@@ -233,6 +235,8 @@ private:
 
     TUserCallVec m_PreCalleesUserCalls;
     TUserCallVec m_PostCalleesUserCalls;
+    // calls which return true if the node should be skipped
+    TUserCallVec m_SkipUserCalls;
     // The user calls that need the value of this node.
     TUserCallVec m_ReferencingUserCalls;
 
@@ -215,6 +215,8 @@ void CTraversalPatternMatchCallback::x_DoAttachment(
         new CTraversalNode::CUserCall(pattern->GetFunc(), extra_arg_nodes, pattern->GetConstantArgs() ) );
     if( pattern->GetWhen() == CTraversalSpecFileParser::CDescFileNode::eWhen_afterCallees ) {
         node->AddPostCalleesUserCall( user_call );
+    } else if( pattern->GetWhen() == CTraversalSpecFileParser::CDescFileNode::eWhen_skipNode ) {
+        node->AddSkipUserCall( user_call );
     } else {
         node->AddPreCalleesUserCall( user_call );
     }
@@ -113,6 +113,12 @@ use m_NewCleanup.SeqfeatBC { POST Seq-feat }
  * the need to explicitly call cleanup.  You may want to use POST when you want your children
  * cleaned up before you look at them (e.g. to make sure strings are cleaned, etc.)
  *
+ * With the "SKIP" keyword, the user function returns bool and is called first, before any
+ * other user function of the node.  If it returns true, the node is skipped: nothing else
+ * is called for it and its children are not traversed.  Example:
+
+use m_NewCleanup.x_SkipUnchangedEntryBC { SKIP Seq-entry }
+
  * Patterns are basically of the same form as the "stack paths" which are documented elsewhere.
  * They are dot-separated units, each of which is either a type name (e.g. "Seq-loc" ) or a 
  * member name (e.g. "location"), or a "?", which means
@@ -466,6 +472,9 @@ void CTraversalSpecFileParser::x_ParseUseClause( CTokenizer &tokenizer )
         if( tokenizer.NextWillBe("POST") ) {
             tokenizer.DiscardOne("POST");
             when = CDescFileNode::eWhen_afterCallees;
+        } else if( tokenizer.NextWillBe("SKIP") ) {
+            tokenizer.DiscardOne("SKIP");
+            when = CDescFileNode::eWhen_skipNode;
         }
 
         string pattern;
@@ -54,7 +54,8 @@ public:
     public:
         enum EWhen {
             eWhen_afterCallees = 1,
-            eWhen_beforeCallees            
+            eWhen_beforeCallees,
+            eWhen_skipNode // before everything else, skips the node if true
         };
 
         CDescFileNode( const string &func, const string &pattern, 
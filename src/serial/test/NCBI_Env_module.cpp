@@ -0,0 +1,88 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'we_cpp.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <serial/test/NCBI_Env_module.hpp>
+#include <serial/test/Argument.hpp>
+#include <serial/test/Db_Clipboard.hpp>
+#include <serial/test/Db_Env.hpp>
+#include <serial/test/Filter_Value.hpp>
+#include <serial/test/Full_Time.hpp>
+#include <serial/test/Item_Set.hpp>
+#include <serial/test/Name.hpp>
+#include <serial/test/Named_Item_Set.hpp>
+#include <serial/test/Named_Query.hpp>
+#include <serial/test/Query_Command.hpp>
+#include <serial/test/Query_History.hpp>
+#include <serial/test/Query_Related.hpp>
+#include <serial/test/Query_Search.hpp>
+#include <serial/test/Query_Select.hpp>
+#include <serial/test/Time.hpp>
+#include <serial/test/Web_Env.hpp>
+#include <serial/test/Web_Saved.hpp>
+#include <serial/test/Web_Settings.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Env_RegisterModuleClasses(void)
+{
+    ncbi::objects::CArgument::GetTypeInfo();
+    ncbi::objects::CDb_Clipboard::GetTypeInfo();
+    ncbi::objects::CDb_Env::GetTypeInfo();
+    ncbi::objects::CFilter_Value::GetTypeInfo();
+    ncbi::objects::CFull_Time::GetTypeInfo();
+    ncbi::objects::CItem_Set::GetTypeInfo();
+    ncbi::objects::CName::GetTypeInfo();
+    ncbi::objects::CNamed_Item_Set::GetTypeInfo();
+    ncbi::objects::CNamed_Query::GetTypeInfo();
+    ncbi::objects::CQuery_Command::GetTypeInfo();
+    ncbi::objects::CQuery_History::GetTypeInfo();
+    ncbi::objects::CQuery_Related::GetTypeInfo();
+    ncbi::objects::CQuery_Search::GetTypeInfo();
+    ncbi::objects::CQuery_Select::GetTypeInfo();
+    ncbi::objects::CTime::GetTypeInfo();
+    ncbi::objects::CWeb_Env::GetTypeInfo();
+    ncbi::objects::CWeb_Saved::GetTypeInfo();
+    ncbi::objects::CWeb_Settings::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
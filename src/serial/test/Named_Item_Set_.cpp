@@ -0,0 +1,125 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'we_cpp.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <serial/test/Named_Item_Set.hpp>
+#include <serial/test/Item_Set.hpp>
+#include <serial/test/Name.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CNamed_Item_Set_Base::ResetName(void)
+{
+    if ( !m_Name ) {
+        m_Name.Reset(new TName());
+        return;
+    }
+    (*m_Name).Reset();
+}
+
+void CNamed_Item_Set_Base::SetName(CNamed_Item_Set_Base::TName& value)
+{
+    m_Name.Reset(&value);
+}
+
+void CNamed_Item_Set_Base::ResetDb(void)
+{
+    m_Db.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CNamed_Item_Set_Base::ResetItem_Set(void)
+{
+    if ( !m_Item_Set ) {
+        m_Item_Set.Reset(new TItem_Set());
+        return;
+    }
+    (*m_Item_Set).Reset();
+}
+
+void CNamed_Item_Set_Base::SetItem_Set(CNamed_Item_Set_Base::TItem_Set& value)
+{
+    m_Item_Set.Reset(&value);
+}
+
+void CNamed_Item_Set_Base::Reset(void)
+{
+    ResetName();
+    ResetDb();
+    ResetItem_Set();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Named-Item-Set", CNamed_Item_Set)
+{
+    SET_CLASS_MODULE("NCBI-Env");
+    ADD_NAMED_REF_MEMBER("name", m_Name, CName);
+    ADD_NAMED_STD_MEMBER("db", m_Db)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("item-Set", m_Item_Set, CItem_Set);
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CNamed_Item_Set_Base::CNamed_Item_Set_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetName();
+        ResetItem_Set();
+    }
+}
+
+// destructor
+CNamed_Item_Set_Base::~CNamed_Item_Set_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
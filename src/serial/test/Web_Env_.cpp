@@ -0,0 +1,106 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'we_cpp.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <serial/test/Web_Env.hpp>
+#include <serial/test/Argument.hpp>
+#include <serial/test/Db_Env.hpp>
+#include <serial/test/Query_History.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CWeb_Env_Base::ResetArguments(void)
+{
+    m_Arguments.clear();
+    m_set_State[0] &= ~0x3;
+}
+
+void CWeb_Env_Base::ResetDb_Env(void)
+{
+    m_Db_Env.clear();
+    m_set_State[0] &= ~0xc;
+}
+
+void CWeb_Env_Base::ResetQueries(void)
+{
+    m_Queries.clear();
+    m_set_State[0] &= ~0x30;
+}
+
+void CWeb_Env_Base::Reset(void)
+{
+    ResetArguments();
+    ResetDb_Env();
+    ResetQueries();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Web-Env", CWeb_Env)
+{
+    SET_CLASS_MODULE("NCBI-Env");
+    ADD_NAMED_MEMBER("arguments", m_Arguments, STL_list_set, (STL_CRef, (CLASS, (CArgument))))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_MEMBER("db-Env", m_Db_Env, STL_list_set, (STL_CRef, (CLASS, (CDb_Env))))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_MEMBER("queries", m_Queries, STL_list, (STL_CRef, (CLASS, (CQuery_History))))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(21700);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CWeb_Env_Base::CWeb_Env_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CWeb_Env_Base::~CWeb_Env_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,19 @@
+#include <ncbi_pch.hpp>
+#include "Argument.cpp"
+#include "Db_Clipboard.cpp"
+#include "Db_Env.cpp"
+#include "Filter_Value.cpp"
+#include "Full_Time.cpp"
+#include "Item_Set.cpp"
+#include "Name.cpp"
+#include "Named_Item_Set.cpp"
+#include "Named_Query.cpp"
+#include "Query_Command.cpp"
+#include "Query_History.cpp"
+#include "Query_Related.cpp"
+#include "Query_Search.cpp"
+#include "Query_Select.cpp"
+#include "Time.cpp"
+#include "Web_Env.cpp"
+#include "Web_Saved.cpp"
+#include "Web_Settings.cpp"
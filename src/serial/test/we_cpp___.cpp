@@ -0,0 +1,20 @@
+#include <ncbi_pch.hpp>
+#include "Argument_.cpp"
+#include "Db_Clipboard_.cpp"
+#include "Db_Env_.cpp"
+#include "Filter_Value_.cpp"
+#include "Full_Time_.cpp"
+#include "Item_Set_.cpp"
+#include "Name_.cpp"
+#include "Named_Item_Set_.cpp"
+#include "Named_Query_.cpp"
+#include "Query_Command_.cpp"
+#include "Query_History_.cpp"
+#include "Query_Related_.cpp"
+#include "Query_Search_.cpp"
+#include "Query_Select_.cpp"
+#include "Time_.cpp"
+#include "Web_Env_.cpp"
+#include "Web_Saved_.cpp"
+#include "Web_Settings_.cpp"
+#include "NCBI_Env_module.cpp"
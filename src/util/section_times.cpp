@@ -0,0 +1,114 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Time spent in named sections of code, summed up over threads.
+ *
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <util/section_times.hpp>
+
+BEGIN_NCBI_SCOPE
+
+
+CSectionTimes::CSectionTimes(void)
+{
+    m_Enabled.Set(0);
+}
+
+
+void CSectionTimes::Enable(bool enable)
+{
+    m_Enabled.Set(enable ? 1 : 0);
+}
+
+
+bool CSectionTimes::IsEnabled(void) const
+{
+    return m_Enabled.Get() != 0;
+}
+
+
+void CSectionTimes::GetTimes(TTimes& times) const
+{
+    CFastMutexGuard GUARD(m_Mutex);
+    times = m_Times;
+}
+
+
+void CSectionTimes::Add(const TTimes& times)
+{
+    CFastMutexGuard GUARD(m_Mutex);
+    ITERATE(TTimes, it, times) {
+        STime& total = m_Times[it->first];
+        total.m_Seconds += it->second.m_Seconds;
+        total.m_Calls += it->second.m_Calls;
+    }
+}
+
+
+void CSectionTimes::Print(CNcbiOstream& out, const TTimes& times,
+                          const string& indent)
+{
+    typedef multimap<double, TTimes::const_iterator, greater<double> > TByTime;
+    TByTime by_time;
+    ITERATE(TTimes, it, times) {
+        by_time.insert(TByTime::value_type(it->second.m_Seconds, it));
+    }
+    ITERATE(TByTime, it, by_time) {
+        out << indent << it->second->first << "\t" << it->first << "\t"
+            << it->second->second.m_Calls << "\n";
+    }
+    out.flush();
+}
+
+
+CLocalSectionTimes::~CLocalSectionTimes(void)
+{
+    if (m_Times.empty()) {
+        return;
+    }
+    // equal names at different addresses go into one section
+    CSectionTimes::TTimes times;
+    ITERATE(TTimes, it, m_Times) {
+        CSectionTimes::STime& time = times[it->first];
+        time.m_Seconds += it->second.m_Seconds;
+        time.m_Calls += it->second.m_Calls;
+    }
+    m_Totals.Add(times);
+}
+
+
+void CLocalSectionTimes::Add(const char* section, double seconds)
+{
+    CSectionTimes::STime& time = m_Times[section];
+    time.m_Seconds += seconds;
+    time.m_Calls++;
+}
+
+
+END_NCBI_SCOPE